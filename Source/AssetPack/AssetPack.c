@@ -0,0 +1,241 @@
+/*////////////////////////////////////////////////////
+Asset Pack - read only access to a packed asset blob
+
+Lookup by id is an open addressed hash probe into the
+pack directory, no copies are made, all pointers point
+into the pack itself (flash on target, mmap on host).
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "AssetPack.h"
+
+#ifdef ASSET_PACK_HOST
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+//linker script symbols around the .assetpack section
+extern const uint8_t _sassetpack[];
+extern const uint8_t _eassetpack[];
+#endif
+
+
+#define FNV_OFFSET_BASIS		0x811C9DC5
+#define FNV_PRIME				0x01000193
+
+
+////////////////////////////////////////////
+//Asset id from the asset name - FNV-1a.
+//0 is reserved for empty directory slots.
+uint32_t AssetPack_GetId(const char* name)
+{
+	uint32_t hash = FNV_OFFSET_BASIS;
+
+	while (*name)
+	{
+		hash ^= (uint8_t)(*name++);
+		hash *= FNV_PRIME;
+	}
+
+	if (!hash)
+		hash = 1;
+
+	return hash;
+}
+
+////////////////////////////////////////////
+//FNV-1a of a blob, used for dedup at pack time
+uint32_t AssetPack_Hash(const uint8_t* data, uint32_t size)
+{
+	uint32_t hash = FNV_OFFSET_BASIS;
+
+	for (uint32_t i = 0 ; i < size ; i++)
+	{
+		hash ^= data[i];
+		hash *= FNV_PRIME;
+	}
+
+	return hash;
+}
+
+
+////////////////////////////////////////////
+//Open a pack at base.  Validates the header and
+//that the directory and every entry fit inside
+//size.  Returns 0 on success, -1 if the pack is
+//not valid.
+int AssetPack_Open(AssetPack* pack, const void* base, uint32_t size)
+{
+	const AssetPackHeader* header = (const AssetPackHeader*)base;
+
+	memset(pack, 0x00, sizeof(AssetPack));
+
+	if ((!base) || (size < sizeof(AssetPackHeader)))
+		return -1;
+
+	if ((header->magic != ASSET_PACK_MAGIC) || (header->version != ASSET_PACK_VERSION))
+		return -1;
+
+	//dir size must be a power of 2
+	if ((!header->dirSize) || (header->dirSize & (header->dirSize - 1)))
+		return -1;
+
+	if ((header->totalSize > size) ||
+		(header->dataOffset < sizeof(AssetPackHeader) + header->dirSize * sizeof(AssetEntry)) ||
+		(header->dataOffset > header->totalSize))
+		return -1;
+
+	const AssetEntry* directory = (const AssetEntry*)((const uint8_t*)base + sizeof(AssetPackHeader));
+
+	for (uint16_t i = 0 ; i < header->dirSize ; i++)
+	{
+		if (!directory[i].id)
+			continue;
+
+		if ((directory[i].offset < header->dataOffset) ||
+			(directory[i].offset > header->totalSize) ||
+			(directory[i].size > header->totalSize - directory[i].offset))
+			return -1;
+	}
+
+	pack->base = (const uint8_t*)base;
+	pack->size = header->totalSize;
+	pack->header = header;
+	pack->directory = directory;
+
+	return 0;
+}
+
+
+////////////////////////////////////////////
+//Find an asset by id.  Probes from the home slot
+//until the id or an empty slot is found.
+//Returns NULL if the asset is not in the pack.
+const AssetEntry* AssetPack_Find(const AssetPack* pack, uint32_t id)
+{
+	if ((!pack->header) || (!id))
+		return NULL;
+
+	uint16_t mask = pack->header->dirSize - 1;
+	uint16_t slot = id & mask;
+
+	for (uint16_t i = 0 ; i < pack->header->dirSize ; i++)
+	{
+		const AssetEntry* entry = &pack->directory[slot];
+
+		if (entry->id == id)
+			return entry;
+
+		if (!entry->id)
+			return NULL;
+
+		slot = (slot + 1) & mask;
+	}
+
+	return NULL;
+}
+
+const uint8_t* AssetPack_GetData(const AssetPack* pack, const AssetEntry* entry)
+{
+	return pack->base + entry->offset;
+}
+
+////////////////////////////////////////////
+//Find an asset by id and check the type.
+//Returns a pointer to the blob and the blob size
+//in size (if not NULL), or NULL if not found.
+const uint8_t* AssetPack_GetAsset(const AssetPack* pack, uint32_t id, AssetType_t type, uint32_t* size)
+{
+	const AssetEntry* entry = AssetPack_Find(pack, id);
+
+	if ((!entry) || (entry->type != type))
+		return NULL;
+
+	if (size)
+		*size = entry->size;
+
+	return AssetPack_GetData(pack, entry);
+}
+
+
+////////////////////////////////////////////
+//Iterate over the pack - walk slots
+//0 to AssetPack_GetNumSlots() - 1 and skip
+//the slots that return NULL.
+uint16_t AssetPack_GetNumSlots(const AssetPack* pack)
+{
+	if (!pack->header)
+		return 0;
+
+	return pack->header->dirSize;
+}
+
+const AssetEntry* AssetPack_GetSlot(const AssetPack* pack, uint16_t slot)
+{
+	if ((!pack->header) || (slot >= pack->header->dirSize) || (!pack->directory[slot].id))
+		return NULL;
+
+	return &pack->directory[slot];
+}
+
+
+#ifdef ASSET_PACK_HOST
+
+////////////////////////////////////////////
+//Map a pack file read only.  Returns 0 on success.
+int AssetPack_MapFile(AssetPack* pack, const char* path)
+{
+	struct stat st;
+	int fd = open(path, O_RDONLY);
+
+	memset(pack, 0x00, sizeof(AssetPack));
+
+	if (fd < 0)
+		return -1;
+
+	if ((fstat(fd, &st) < 0) || (st.st_size <= 0) || (st.st_size > 0x7FFFFFFF))
+	{
+		close(fd);
+		return -1;
+	}
+
+	void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (base == MAP_FAILED)
+		return -1;
+
+	if (AssetPack_Open(pack, base, (uint32_t)st.st_size) < 0)
+	{
+		munmap(base, (size_t)st.st_size);
+		return -1;
+	}
+
+	//keep the mapped length so unmap releases all of it
+	pack->size = (uint32_t)st.st_size;
+
+	return 0;
+}
+
+void AssetPack_Unmap(AssetPack* pack)
+{
+	if (pack->base)
+		munmap((void*)pack->base, pack->size);
+
+	memset(pack, 0x00, sizeof(AssetPack));
+}
+
+#else
+
+////////////////////////////////////////////
+//Open the pack linked into the .assetpack section
+int AssetPack_OpenLinked(AssetPack* pack)
+{
+	return AssetPack_Open(pack, _sassetpack, (uint32_t)(_eassetpack - _sassetpack));
+}
+
+#endif
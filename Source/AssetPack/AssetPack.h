@@ -0,0 +1,125 @@
+/*
+////////////////////////////////////////////////////
+Asset Pack Header File
+
+Binary asset pack shared by all of the games.  Images,
+fonts, sounds and tables are packed into one read only
+blob by the host tool in Tools/assetpack_build.c instead
+of being compiled into each project as its own C array.
+
+Pack Layout (little endian, all offsets from pack start):
+AssetPackHeader
+AssetEntry directory[dirSize]  - hashed on asset id
+blob data                      - ASSET_PACK_ALIGN aligned
+
+The directory is an open addressed hash table with
+linear probing.  dirSize is a power of 2 with at least
+twice as many slots as assets, so a lookup by id is a
+mask and usually one compare.  id 0 marks an empty slot.
+The asset id is the FNV-1a hash of the asset name, the
+tool also writes a header of ASSET_ID_xxx defines so the
+games don't have to hash names at runtime.
+
+Identical blobs are stored once - the tool compares
+content hashes at pack time and points duplicate entries
+at the same offset.
+
+Target:
+The pack is linked into the .assetpack section in flash
+(see the TrueSTUDIO linker scripts).  Either have the
+tool write the pack as a .c file (Packs/<name>.c, linked by
+the projects as a source file), or convert a .pak into
+an object file and add it to the link:
+
+arm-none-eabi-objcopy -I binary -O elf32-littlearm -B arm
+  --rename-section .data=.assetpack,alloc,load,readonly,data,contents
+  assets.pak assets.o
+
+and open it with AssetPack_OpenLinked().  Each game loads
+its sounds from a pack built from its manifest in Manifest/:
+Space Invaders (F411 and F103) from Packs/spaceInvaders.c,
+asteroids (F429 and F411) from Packs/asteroids.c and pong
+from Packs/pong.c.
+
+Host:
+Build with ASSET_PACK_HOST defined and open the pack
+file with AssetPack_MapFile() (mmap).
+
+*/
+
+#ifndef __ASSETPACK_H
+#define __ASSETPACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ASSET_PACK_MAGIC			0x4B415041		//"APAK"
+#define ASSET_PACK_VERSION			1
+#define ASSET_PACK_ALIGN			4
+
+
+typedef enum
+{
+	ASSET_TYPE_NONE = 0,
+	ASSET_TYPE_IMAGE = 1,		//param: xSize, ySize, bytesPerLine, bitsPerPixel
+	ASSET_TYPE_FONT = 2,		//param: glyph width, glyph height, first char, num chars
+	ASSET_TYPE_SOUND = 3,		//param: sample rate, bit depth
+	ASSET_TYPE_TABLE = 4,		//param: element size
+}AssetType_t;
+
+
+typedef struct
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t numAssets;
+	uint16_t dirSize;			//directory slots, power of 2
+	uint16_t reserved;
+	uint32_t dataOffset;		//first blob
+	uint32_t totalSize;			//header + directory + blobs
+}AssetPackHeader;
+
+
+typedef struct
+{
+	uint32_t id;				//FNV-1a of the name, 0 = empty
+	uint32_t offset;			//blob offset from pack start
+	uint32_t size;				//blob size in bytes
+	uint8_t type;				//AssetType_t
+	uint8_t reserved;
+	uint16_t contentHash;		//low bits of the blob hash
+	uint16_t param[4];			//type specific, see AssetType_t
+}AssetEntry;
+
+
+typedef struct
+{
+	const uint8_t* base;
+	uint32_t size;
+	const AssetPackHeader* header;
+	const AssetEntry* directory;
+}AssetPack;
+
+
+
+uint32_t AssetPack_GetId(const char* name);
+uint32_t AssetPack_Hash(const uint8_t* data, uint32_t size);
+
+int AssetPack_Open(AssetPack* pack, const void* base, uint32_t size);
+
+const AssetEntry* AssetPack_Find(const AssetPack* pack, uint32_t id);
+const uint8_t* AssetPack_GetData(const AssetPack* pack, const AssetEntry* entry);
+const uint8_t* AssetPack_GetAsset(const AssetPack* pack, uint32_t id, AssetType_t type, uint32_t* size);
+
+uint16_t AssetPack_GetNumSlots(const AssetPack* pack);
+const AssetEntry* AssetPack_GetSlot(const AssetPack* pack, uint16_t slot);
+
+#ifdef ASSET_PACK_HOST
+int AssetPack_MapFile(AssetPack* pack, const char* path);
+void AssetPack_Unmap(AssetPack* pack);
+#else
+int AssetPack_OpenLinked(AssetPack* pack);
+#endif
+
+
+#endif
@@ -0,0 +1,2871 @@
+//Generated by assetpack_build from ../Manifest/asteroids.txt - do not edit
+//Asset pack linked into the .assetpack flash section,
+//open it with AssetPack_OpenLinked()
+
+#include <stdint.h>
+
+__attribute__((section(".assetpack"), aligned(4), used))
+const uint8_t _apasteroids[45788] =
+{
+0x41, 0x50, 0x41, 0x4B, 0x01, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+0xDC, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x31, 0x5F, 0x5E,
+0x0C, 0x7A, 0x00, 0x00, 0x4F, 0x0E, 0x00, 0x00, 0x03, 0x00, 0xD7, 0x51, 0xF8, 0x2A, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x94, 0x0B, 0xEC, 0xB5, 0x44, 0x13, 0x00, 0x00, 0xA5, 0x29, 0x00, 0x00,
+0x03, 0x00, 0x1E, 0x98, 0xF8, 0x2A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x26, 0x9C, 0xBD,
+0x5C, 0x88, 0x00, 0x00, 0x80, 0x2A, 0x00, 0x00, 0x03, 0x00, 0x77, 0xEF, 0xF8, 0x2A, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0x5D, 0xF5, 0xBA, 0x94, 0x01, 0x00, 0x00, 0xAE, 0x11, 0x00, 0x00,
+0x03, 0x00, 0xDE, 0x5D, 0xF8, 0x2A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x75, 0x87, 0xE1,
+0xEC, 0x3C, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x03, 0x00, 0x47, 0xF5, 0xF8, 0x2A, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x60, 0xC7, 0xC7, 0xCC, 0xD5, 0x5B, 0x36, 0xB7, 0x4E,
+0x4E, 0xBF, 0x2F, 0x37, 0x30, 0x46, 0xC4, 0xC4, 0x60, 0x39, 0xAE, 0x4A, 0x4D, 0x60, 0x60, 0x9F,
+0xB9, 0x56, 0x42, 0x41, 0x9F, 0x9F, 0xCC, 0xDA, 0x18, 0xA9, 0xA0, 0xA0, 0xA0, 0x13, 0x13, 0xA4,
+0xA3, 0xA0, 0xA6, 0xA6, 0x30, 0x30, 0xC8, 0xC8, 0xB7, 0x27, 0x57, 0xCC, 0xCC, 0xC0, 0xC0, 0x1A,
+0x1A, 0xAA, 0xA6, 0xA1, 0x28, 0x28, 0xA1, 0xA1, 0xCB, 0xC4, 0xCB, 0xCB, 0xB7, 0x36, 0x36, 0xA2,
+0xA2, 0xB7, 0xC1, 0xDC, 0xAA, 0xA5, 0xA2, 0xA2, 0x41, 0x41, 0x52, 0x52, 0xCF, 0xE4, 0xD9, 0x25,
+0x25, 0x1C, 0x1C, 0xD8, 0xD8, 0xA3, 0xA3, 0xBF, 0x41, 0x5B, 0xCA, 0xCA, 0x3D, 0x3D, 0x39, 0x39,
+0x23, 0x23, 0x44, 0xDE, 0xA4, 0xA4, 0xA4, 0xE9, 0x38, 0xA5, 0xA5, 0xBE, 0xBE, 0x38, 0x38, 0xA5,
+0xAE, 0x5A, 0xC5, 0xB4, 0xB3, 0xB3, 0x3A, 0x3A, 0xF0, 0xF0, 0xBF, 0xBB, 0xCD, 0x27, 0xB1, 0xAC,
+0xBE, 0x37, 0x37, 0xA6, 0xA6, 0x4B, 0x4B, 0xE9, 0xE9, 0x20, 0x58, 0x4F, 0xE5, 0xD1, 0x4F, 0x49,
+0xC0, 0xBA, 0xC0, 0xC0, 0xA9, 0xA9, 0xA7, 0xA8, 0xD7, 0xD7, 0xAE, 0xAE, 0xA8, 0xB7, 0x52, 0x48,
+0x48, 0x4B, 0x42, 0x57, 0x4E, 0x53, 0x56, 0x52, 0x50, 0x48, 0x4E, 0x4C, 0x4C, 0xBF, 0xBF, 0xF2,
+0xF2, 0x56, 0x56, 0xFA, 0xEF, 0xAA, 0xB9, 0x41, 0x47, 0x55, 0x26, 0xAA, 0xB0, 0x1E, 0x55, 0x55,
+0xDF, 0xE2, 0x33, 0x0D, 0x3A, 0x36, 0x2B, 0x29, 0x24, 0x24, 0x43, 0x43, 0x36, 0x36, 0xC6, 0xC6,
+0x54, 0x54, 0x53, 0x53, 0x1F, 0x1F, 0x53, 0x53, 0x4E, 0x4E, 0x53, 0x53, 0x53, 0x53, 0x43, 0x43,
+0x52, 0x52, 0x15, 0x15, 0x49, 0x49, 0x52, 0x52, 0xAD, 0xAD, 0x52, 0x52, 0x4B, 0x4B, 0xAE, 0xAE,
+0xD2, 0xD3, 0x20, 0x05, 0xC0, 0xBD, 0xAE, 0xAE, 0x2D, 0x34, 0x49, 0x45, 0xAF, 0xB6, 0x50, 0x50,
+0x50, 0x50, 0xE5, 0x19, 0xD1, 0xD1, 0x4E, 0x4E, 0x32, 0x2A, 0xB0, 0xB0, 0x0F, 0x44, 0xD6, 0xC7,
+0xB0, 0xC2, 0x3B, 0xCF, 0xC1, 0x2D, 0x49, 0xCA, 0xB1, 0xB1, 0xC6, 0x49, 0xCB, 0xBE, 0xBA, 0xBE,
+0x0B, 0x48, 0x4A, 0x3D, 0x34, 0x3A, 0x36, 0x40, 0x4D, 0x4D, 0x4D, 0x4B, 0x37, 0x4D, 0x21, 0x11,
+0x36, 0xF7, 0x27, 0xBA, 0xC0, 0xD8, 0xC3, 0xD0, 0x3F, 0x43, 0x4C, 0x47, 0xC7, 0xBC, 0x30, 0x45,
+0x4B, 0x3D, 0xB8, 0xB4, 0xCC, 0xD4, 0xC0, 0xD7, 0xC9, 0xB4, 0xB4, 0x0C, 0x31, 0x35, 0x2B, 0xD5,
+0xBD, 0x31, 0xDE, 0xE3, 0x2A, 0xDD, 0xEC, 0xC3, 0x15, 0x34, 0x2A, 0x11, 0x1D, 0xCF, 0x2A, 0x36,
+0x10, 0xC0, 0xB6, 0x39, 0x42, 0x2F, 0xB7, 0xB7, 0xCE, 0x48, 0x48, 0x20, 0xBB, 0x2C, 0xF0, 0x31,
+0x47, 0x3F, 0x29, 0xD6, 0xC5, 0xC1, 0x2D, 0x34, 0xDA, 0x42, 0x3E, 0xB9, 0xB9, 0xE8, 0x46, 0x46,
+0x46, 0xC3, 0xC5, 0x3E, 0x37, 0x21, 0xC4, 0xC6, 0xD3, 0x2C, 0x29, 0xDF, 0xBA, 0x11, 0x45, 0x45,
+0x3A, 0x3A, 0x44, 0x44, 0x30, 0x30, 0x24, 0x23, 0xE8, 0xBB, 0xBB, 0xDB, 0xD9, 0xCE, 0xC1, 0xD3,
+0x43, 0x39, 0x0C, 0x0C, 0xE6, 0x24, 0xD8, 0xBB, 0xC6, 0xD7, 0xD7, 0xBB, 0xBB, 0xD1, 0x31, 0x30,
+0xCA, 0xCA, 0xC2, 0x2E, 0x19, 0x0D, 0x26, 0xE6, 0xEF, 0x20, 0x1D, 0xBC, 0xBF, 0x25, 0x3F, 0x30,
+0xBC, 0xBC, 0x0E, 0x36, 0x3B, 0x18, 0x14, 0x35, 0x35, 0x41, 0x41, 0x2B, 0x29, 0x43, 0x43, 0x43,
+0xDB, 0xDB, 0xF3, 0x3F, 0x36, 0xCA, 0xCA, 0x38, 0x38, 0x3B, 0x2D, 0x1F, 0x32, 0x32, 0x31, 0x32,
+0x40, 0xF1, 0xF1, 0xF3, 0xF3, 0xDA, 0x16, 0x16, 0x18, 0x18, 0xE6, 0xD8, 0xDD, 0xF4, 0xF4, 0x0F,
+0x0B, 0x1E, 0x38, 0x38, 0xD1, 0xD1, 0x2E, 0x43, 0x43, 0xD7, 0xD7, 0xCA, 0x36, 0x36, 0x43, 0x43,
+0x38, 0x23, 0x23, 0x43, 0x43, 0x26, 0x10, 0x3B, 0x43, 0x43, 0xF4, 0xF4, 0x32, 0x43, 0x43, 0x1B,
+0x1B, 0x13, 0x36, 0x36, 0x29, 0x29, 0x3C, 0x3B, 0x38, 0x3C, 0x3C, 0x43, 0x43, 0x43, 0x38, 0x38,
+0xCB, 0xCB, 0xCF, 0x28, 0x28, 0xF6, 0xF6, 0xF6, 0xEB, 0xEB, 0xDF, 0xF6, 0xF6, 0x0E, 0x0E, 0xD7,
+0xC4, 0xC4, 0x19, 0x19, 0x26, 0x2B, 0x2B, 0xBF, 0xBF, 0xBF, 0x36, 0x36, 0xC8, 0xC8, 0xC8, 0xCF,
+0xCF, 0xCF, 0xCC, 0xCC, 0xD6, 0xD6, 0xD6, 0xBF, 0xBF, 0xCA, 0xE6, 0xE6, 0xC1, 0xC1, 0xC1, 0x27,
+0x27, 0xBF, 0xBD, 0xBD, 0x03, 0x03, 0x3D, 0x25, 0x25, 0xBD, 0xBD, 0xBD, 0x3C, 0x3C, 0xC6, 0xC6,
+0xC6, 0xDB, 0xDB, 0xDA, 0xD7, 0xD7, 0xF4, 0xF4, 0xF4, 0x33, 0x33, 0x36, 0x36, 0x36, 0x42, 0x42,
+0x42, 0x30, 0x30, 0x10, 0xE7, 0xE7, 0x3C, 0x3B, 0x3B, 0xD7, 0xD7, 0x2B, 0x35, 0x35, 0xCF, 0xCF,
+0xCF, 0xDE, 0xDE, 0xDA, 0xBD, 0xBD, 0xC0, 0x0E, 0x0E, 0xCA, 0xCA, 0xCA, 0x14, 0x14, 0x14, 0x3D,
+0x3D, 0x39, 0xBD, 0xBD, 0xDE, 0xEA, 0xEA, 0xBD, 0xD3, 0xD3, 0xBD, 0xBD, 0xBD, 0x42, 0x42, 0x42,
+0xBD, 0xBD, 0xBD, 0xE6, 0xE6, 0xD0, 0xD8, 0xD8, 0xC1, 0xBE, 0xBE, 0x2D, 0x2D, 0x2D, 0xCA, 0xCA,
+0xCA, 0x42, 0x42, 0x2A, 0xBE, 0xBE, 0x1D, 0x1B, 0x1B, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xE7,
+0xE7, 0xFD, 0xD3, 0xD3, 0x41, 0xED, 0xED, 0xDA, 0x26, 0x26, 0xBE, 0xBE, 0xBE, 0x20, 0x20, 0x20,
+0x1D, 0x1D, 0x1D, 0x34, 0x34, 0x3A, 0x3B, 0x3B, 0x33, 0x2F, 0x2F, 0x1E, 0x39, 0x39, 0x3C, 0x27,
+0x27, 0x3D, 0x35, 0x35, 0x22, 0x15, 0x15, 0xE2, 0x30, 0x30, 0x30, 0x31, 0x31, 0x39, 0x41, 0x3D,
+0x3D, 0x3B, 0xED, 0xED, 0xCC, 0x28, 0x28, 0xCA, 0x1B, 0x1B, 0x41, 0x18, 0x18, 0x3E, 0x41, 0x41,
+0x3B, 0x17, 0xE5, 0x2C, 0x28, 0x25, 0x25, 0x2D, 0x2D, 0x2D, 0xBE, 0xBE, 0xBE, 0x41, 0x41, 0x41,
+0xBE, 0xBE, 0xBE, 0x31, 0x32, 0x2C, 0xE6, 0x17, 0x17, 0x2A, 0x32, 0x32, 0x41, 0xD2, 0xD2, 0xE1,
+0x41, 0x41, 0xF4, 0xBE, 0xBE, 0x2E, 0x3F, 0x3F, 0xD6, 0x27, 0x27, 0x3A, 0xDC, 0xDC, 0x2C, 0x29,
+0x23, 0xE6, 0xC5, 0xCC, 0xCC, 0xC6, 0xC7, 0xC7, 0xCF, 0x25, 0x25, 0x26, 0x23, 0x1C, 0x36, 0x40,
+0xE3, 0xE3, 0xD9, 0x3A, 0x3A, 0xD8, 0xE3, 0x0B, 0x40, 0x40, 0xD9, 0xD9, 0x10, 0x40, 0x40, 0x1C,
+0x1C, 0xD8, 0x35, 0x40, 0x30, 0x30, 0x09, 0xEE, 0xE3, 0xC2, 0xC2, 0xBF, 0xBF, 0xBF, 0xC4, 0xDA,
+0xD5, 0xD5, 0xBF, 0xBF, 0xCD, 0xCD, 0xCE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xCB, 0xF6, 0xEE, 0xED,
+0x16, 0x16, 0x40, 0x40, 0x40, 0x40, 0x26, 0x26, 0x26, 0x26, 0x40, 0x3F, 0xDF, 0xBF, 0xBF, 0xD2,
+0x37, 0x3C, 0xD5, 0xD5, 0xCA, 0xD1, 0x36, 0xF1, 0xF1, 0xDA, 0xDA, 0x3B, 0x24, 0x16, 0xC2, 0xC2,
+0x20, 0x20, 0x40, 0x18, 0x18, 0x25, 0x25, 0x40, 0x40, 0xF1, 0x1B, 0x1B, 0x23, 0x23, 0xC0, 0xC0,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC4, 0xC4, 0xC6, 0xCD,
+0xC1, 0xC1, 0xD8, 0xD8, 0xEA, 0xEA, 0xC6, 0xD4, 0xE1, 0xE1, 0x28, 0xD8, 0xD8, 0xD8, 0xC4, 0xDB,
+0xDB, 0x20, 0x3F, 0x31, 0x31, 0x2E, 0x2D, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x1F, 0xED,
+0xED, 0x3F, 0x3B, 0x25, 0x25, 0xD0, 0x1F, 0x3E, 0x3E, 0x37, 0x28, 0xE4, 0xE4, 0xDF, 0xDA, 0xCE,
+0xCE, 0xC3, 0xC3, 0xC0, 0xC0, 0x17, 0xE1, 0xE1, 0xE1, 0xE1, 0x3E, 0x3E, 0xDC, 0xDC, 0xDC, 0xDC,
+0xD6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xD8, 0xEB, 0xEB, 0xD4, 0xC6, 0x26, 0x26, 0xEE,
+0xEE, 0xC7, 0xC7, 0xF2, 0xE3, 0xD5, 0xD5, 0xF7, 0x30, 0x36, 0x36, 0x23, 0x33, 0x35, 0x35, 0x1C,
+0xDD, 0xDD, 0xDD, 0x29, 0xE8, 0xE8, 0xE8, 0x30, 0x3F, 0x3F, 0x3F, 0x38, 0x31, 0x3F, 0x3F, 0x3F,
+0x3F, 0x1E, 0x1E, 0x1E, 0xFD, 0x12, 0x12, 0x12, 0x3E, 0x3B, 0x3B, 0x3B, 0xDB, 0x36, 0x36, 0x36,
+0x36, 0xE9, 0xC5, 0xC5, 0xC5, 0x26, 0xEF, 0xEF, 0xEF, 0xC1, 0xD6, 0xD6, 0xD6, 0xD6, 0x30, 0xC2,
+0xC2, 0xC2, 0xC3, 0x12, 0x12, 0x12, 0x12, 0x15, 0x19, 0x19, 0x19, 0xE3, 0xCB, 0xCB, 0xCB, 0xCB,
+0xD1, 0xC1, 0xC1, 0xC1, 0xC1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xDE, 0xDE, 0xDE, 0xDE, 0xEF, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC5, 0xC5, 0xC5, 0xC9, 0xD7, 0xD8, 0xD8, 0xD8, 0x2A, 0x36, 0x36, 0x36,
+0x3C, 0x3E, 0x3E, 0x3E, 0xF5, 0x1E, 0x1E, 0x1E, 0x1E, 0xD7, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xD5, 0x0E, 0x0E, 0x0E, 0x0E, 0xE8, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x38,
+0x3E, 0x3E, 0x3E, 0x3E, 0xDC, 0xDC, 0xDC, 0xDC, 0x28, 0x1D, 0x1D, 0x1D, 0x1D, 0xC1, 0xD9, 0xD9,
+0xD9, 0xD9, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0x10, 0x10, 0x10, 0x10, 0x10, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0xCF, 0xCA, 0xCA, 0xCA, 0xCA, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xD3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCC, 0xC6, 0xC6, 0xC6, 0xC6, 0xC2, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xE4, 0x1A, 0x1A, 0x1A,
+0x1A, 0x1A, 0x22, 0x36, 0x3B, 0x3B, 0x3B, 0x3B, 0x23, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xDD, 0xDD,
+0xDD, 0xDD, 0xDD, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xDD, 0xDD, 0xDD,
+0xDD, 0xDD, 0xC3, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xD5, 0xC6, 0xC6,
+0xC7, 0xC7, 0xC4, 0x13, 0x13, 0x13, 0x13, 0x13, 0x3C, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0xD6, 0xD9,
+0xD9, 0xD9, 0xD9, 0xDC, 0x31, 0x31, 0x31, 0x31, 0x31, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x31,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCA, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xF4, 0xCF, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xD4, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xE4, 0xE4, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xD1, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC4, 0xC4,
+0xC4, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xD4, 0xD4, 0xC6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x34, 0x34, 0x34, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xC4, 0xC4,
+0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0x34, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2C, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2E, 0x2E, 0xE7, 0xE7, 0xE7, 0xE7,
+0xE7, 0xC8, 0xC8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0x0E,
+0x0E, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC5, 0xC5, 0xC5, 0xD6, 0xD6, 0xD6, 0xD6, 0xEB, 0x39, 0x39,
+0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xE9, 0xE9, 0xE9, 0xE9, 0x0C, 0x3A, 0x3A, 0x3A, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xC5, 0xC5, 0xC5,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x15, 0x15, 0x15, 0x25, 0x25, 0x25, 0x25, 0x25, 0x30, 0x30, 0x30,
+0x30, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xC9, 0xC9, 0xC9, 0xC9, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1F,
+0x1F, 0x1F, 0x1F, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xCD, 0xCD, 0xCD, 0xCD, 0x0C, 0x0C, 0x0C, 0x0C,
+0x0C, 0x34, 0x34, 0x34, 0x34, 0x34, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x29, 0xE3, 0xE3, 0xE3, 0xE3, 0xDE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC9,
+0x11, 0x11, 0x11, 0x11, 0x1C, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x39, 0x39,
+0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x28, 0x16, 0x15, 0x15,
+0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC9, 0x18, 0x18, 0x18, 0x18,
+0x29, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x29, 0x29, 0x29, 0x29, 0x29, 0xDD, 0xDD, 0xDD, 0xDD,
+0xDD, 0xDD, 0x0F, 0x0F, 0x0F, 0x0F, 0x18, 0x27, 0x27, 0x27, 0x27, 0x27, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x03, 0x03, 0x03, 0x03,
+0x03, 0x03, 0x03, 0xE1, 0xE1, 0xE1, 0xE2, 0xE0, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0x20, 0x2A,
+0x2A, 0x2A, 0x2A, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x24, 0x24, 0x24, 0x24, 0x1C,
+0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+0xF2, 0x2D, 0x2D, 0x2D, 0x2D, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x18, 0x18, 0x18, 0x18, 0x18, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 0x0A, 0xF1, 0xF1,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xE0, 0xD6,
+0xD6, 0xD6, 0xD6, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xDD, 0x20, 0x20, 0x20, 0x20, 0x35, 0x35, 0x35, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+0x35, 0x30, 0x1C, 0x1C, 0x1C, 0x1C, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCB, 0xD2, 0xD2, 0xD2, 0xD2, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xF1, 0x2D, 0x2D, 0x2D, 0x2D, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34,
+0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x15, 0x15, 0x15, 0x15, 0x15, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xD3, 0xD6, 0xD6, 0xD6, 0xD8, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDA, 0xD7, 0xD7, 0xD7, 0xD3,
+0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE,
+0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE,
+0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE,
+0xCE, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xD0, 0x13, 0x13, 0x13, 0x13, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x28, 0x28,
+0x28, 0x0C, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x18, 0x18, 0x18, 0x18, 0x2E, 0x2E, 0x2E, 0x2E,
+0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x1B, 0x1B, 0x1B, 0x1B, 0xEA, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xDD, 0xDD, 0xDD, 0xDD, 0xE5, 0xF4, 0xF4, 0xF4, 0xF4,
+0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x0A, 0x0A, 0x0A,
+0x0A, 0x0C, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x11, 0x11, 0x11, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x13, 0x13, 0x13, 0x13, 0x13, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x23, 0x12, 0x12, 0x12, 0x12, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xE6, 0xE3, 0xE3, 0xE3, 0xE3, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x15, 0x15, 0x15, 0x15, 0x20,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x11, 0x11, 0x11,
+0x11, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE,
+0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE5,
+0xE5, 0xE5, 0xE5, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B,
+0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+0x1B, 0x1B, 0x0B, 0x0B, 0x0B, 0x0B, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+0xE6, 0xE6, 0xE6, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x0E, 0x0E, 0x0E, 0x0E, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xF1, 0xF1, 0xF1, 0xF1, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xED,
+0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
+0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF1, 0xF7, 0xF7, 0xF7,
+0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07,
+0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10,
+0x10, 0x0F, 0x0E, 0x0B, 0x07, 0xF8, 0xF3, 0xEF, 0xEC, 0xEA, 0xE8, 0xE7, 0xE6, 0xE5, 0xE5, 0xE5,
+0xE6, 0xE7, 0xEA, 0xF3, 0x0E, 0x16, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x21, 0x21,
+0x22, 0x22, 0x1D, 0x16, 0x05, 0xEA, 0xE2, 0xDC, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9,
+0xD8, 0xD8, 0xD8, 0xDE, 0xE6, 0xF6, 0x17, 0x20, 0x27, 0x29, 0x2A, 0x2A, 0x2A, 0x2A, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2C, 0x2C, 0x26, 0x1D, 0x0E, 0xE8, 0xDD, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0,
+0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xD2, 0xDA, 0xE5, 0x0D, 0x1F, 0x29, 0x30, 0x32, 0x32, 0x32, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x33, 0x2C, 0x23, 0x14, 0xE7, 0xDA, 0xD1, 0xCA, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xD0, 0xDA, 0xEA, 0x19, 0x27, 0x31, 0x38,
+0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3B, 0x3B, 0x38, 0x31, 0x27, 0x17, 0xE6, 0xD6,
+0xCD, 0xC5, 0xC3, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xC1, 0xC2, 0xC9, 0xD3, 0xE0,
+0x10, 0x25, 0x31, 0x3A, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x3B,
+0x32, 0x26, 0x10, 0xDF, 0xD0, 0xC7, 0xBF, 0xBD, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB,
+0xBB, 0xBE, 0xC6, 0xD0, 0xDE, 0x10, 0x27, 0x33, 0x3C, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x3E, 0x36, 0x2B, 0x1A, 0xE5, 0xD4, 0xC9, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xC3, 0xCB, 0xD7, 0xEA, 0x1D, 0x2D, 0x37, 0x3E, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3A, 0x32, 0x26, 0x10, 0xDF, 0xD1,
+0xC8, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xC5, 0xCE, 0xDA,
+0xF1, 0x21, 0x2E, 0x38, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40,
+0x39, 0x30, 0x24, 0x09, 0xDD, 0xD0, 0xC7, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xC0, 0xC7, 0xD0, 0xDC, 0xFD, 0x23, 0x2F, 0x38, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x38, 0x2F, 0x22, 0xF4, 0xDB, 0xCF, 0xC6, 0xBF, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xC8, 0xD2, 0xE0, 0x11, 0x26, 0x32, 0x3A,
+0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3D, 0x35, 0x2B, 0x1B, 0xE8,
+0xD6, 0xCB, 0xC3, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC4, 0xCC,
+0xD8, 0xED, 0x1F, 0x2D, 0x37, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3F, 0x38, 0x2E, 0x20, 0xF0, 0xD9, 0xCD, 0xC4, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBD, 0xC3, 0xCC, 0xD8, 0xEE, 0x20, 0x2F, 0x39, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x36, 0x2B, 0x1A, 0xE4, 0xD3, 0xC8, 0xC0, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xC8, 0xD3, 0xE4, 0x1B, 0x2C, 0x37, 0x40, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x37, 0x2B, 0x19, 0xE2, 0xD1, 0xC6,
+0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC2, 0xCC, 0xD9, 0xFC, 0x26,
+0x34, 0x3E, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x39, 0x2D, 0x1A,
+0xE2, 0xD0, 0xC5, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xC4, 0xD0,
+0xE2, 0x1C, 0x2F, 0x3B, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B,
+0x30, 0x1D, 0xE2, 0xCF, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE,
+0xC7, 0xD6, 0xF5, 0x28, 0x37, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3D, 0x31, 0x1E, 0xE1, 0xCD, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xC1, 0xCD, 0xE1, 0x20, 0x33, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3E, 0x31, 0x1A, 0xDC, 0xC9, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC,
+0xC8, 0xDA, 0x18, 0x31, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C,
+0x2D, 0x08, 0xD3, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xD6,
+0x15, 0x31, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x37, 0x22, 0xDE,
+0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xD7, 0x1A, 0x34, 0x42,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x2C, 0xEC, 0xCE, 0xBE, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0xDE, 0x24, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x41, 0x30, 0x08, 0xD0, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBD, 0xCE, 0xF3, 0x2F, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x31,
+0x0C, 0xD0, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xDA, 0x23, 0x3A, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x30, 0xF8, 0xCE, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBE, 0xCF, 0x0F, 0x32, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40,
+0x2D, 0xEA, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0xE2, 0x29, 0x3D, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x28, 0xE3, 0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC4, 0xD7, 0x1C, 0x36, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x24, 0xDF, 0xC9,
+0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xD0, 0xF1, 0x2C, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x41, 0x35, 0x20, 0xDF, 0xCB, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xCB, 0xDD, 0x1C, 0x31, 0x3D,
+0x44, 0x44, 0x44, 0x43, 0x3D, 0x32, 0x20, 0xE4, 0xD0, 0xC6, 0xC0, 0xBD, 0xBE, 0xC2, 0xC9, 0xD5,
+0xEA, 0x21, 0x30, 0x39, 0x3D, 0x3E, 0x3C, 0x37, 0x2E, 0x20, 0xEF, 0xDA, 0xCF, 0xCA, 0xC8, 0xC9,
+0xCD, 0xD3, 0xDE, 0xF4, 0x1E, 0x29, 0x2F, 0x32, 0x31, 0x2E, 0x28, 0x1F, 0x0E, 0xE8, 0xDE, 0xDA,
+0xD8, 0xDA, 0xDC, 0xE1, 0xE8, 0xF6, 0x13, 0x1A, 0x1E, 0x1F, 0x1D, 0x19, 0x15, 0x0D, 0xFC, 0xF7,
+0xFB, 0x0D, 0x12, 0x14, 0x13, 0x11, 0x0B, 0xF3, 0xEB, 0xE5, 0xE1, 0xDF, 0xE0, 0xE2, 0xE8, 0x08,
+0x1B, 0x25, 0x2B, 0x2E, 0x2D, 0x29, 0x21, 0x0D, 0xE2, 0xD6, 0xCF, 0xCC, 0xCC, 0xD0, 0xD9, 0xED,
+0x21, 0x30, 0x38, 0x3C, 0x3B, 0x36, 0x2B, 0x12, 0xD9, 0xCA, 0xC2, 0xBE, 0xC0, 0xC7, 0xD5, 0x0F,
+0x2F, 0x3D, 0x44, 0x44, 0x43, 0x39, 0x25, 0xDE, 0xC7, 0xBB, 0xBB, 0xBB, 0xBE, 0xCD, 0xFA, 0x33,
+0x44, 0x44, 0x44, 0x44, 0x3D, 0x22, 0xD3, 0xBD, 0xBB, 0xBB, 0xBB, 0xBD, 0xD4, 0x28, 0x43, 0x44,
+0x44, 0x44, 0x44, 0x31, 0xDB, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x2B, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x2B, 0xCE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xEB, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x38, 0xDB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xE4, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x33, 0xD1, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC3, 0x22, 0x44, 0x44, 0x44, 0x44, 0x41, 0xF1, 0xBC, 0xBB, 0xBB, 0xBB, 0xBE, 0x0B, 0x42,
+0x44, 0x44, 0x44, 0x40, 0xF1, 0xBD, 0xBB, 0xBB, 0xBB, 0xC5, 0x1F, 0x44, 0x44, 0x44, 0x44, 0x31,
+0xD4, 0xBB, 0xBB, 0xBB, 0xBE, 0xE1, 0x36, 0x44, 0x44, 0x44, 0x36, 0xE5, 0xC2, 0xBB, 0xBB, 0xC3,
+0xDF, 0x2E, 0x41, 0x44, 0x3F, 0x2C, 0xE2, 0xC9, 0xC1, 0xC4, 0xD0, 0xF7, 0x2D, 0x38, 0x37, 0x2E,
+0x18, 0xDD, 0xD1, 0xD0, 0xD7, 0xE7, 0x19, 0x24, 0x26, 0x20, 0x13, 0xF0, 0xEB, 0xF1, 0x04, 0x09,
+0xF4, 0xE9, 0xE5, 0xE3, 0xEA, 0x16, 0x26, 0x2C, 0x29, 0x1A, 0xE0, 0xD0, 0xCB, 0xD0, 0xE8, 0x2A,
+0x3B, 0x3D, 0x31, 0xF4, 0xCA, 0xBD, 0xBF, 0xD1, 0x25, 0x40, 0x44, 0x41, 0x23, 0xCA, 0xBB, 0xBB,
+0xC4, 0x1D, 0x44, 0x44, 0x44, 0x2B, 0xC6, 0xBB, 0xBB, 0xC0, 0x27, 0x44, 0x44, 0x44, 0x22, 0xBB,
+0xBB, 0xBB, 0xC8, 0x39, 0x44, 0x44, 0x44, 0xD7, 0xBB, 0xBB, 0xBB, 0x0E, 0x44, 0x44, 0x44, 0x25,
+0xBB, 0xBB, 0xBB, 0xD2, 0x44, 0x44, 0x44, 0x34, 0xBE, 0xBB, 0xBB, 0xCB, 0x41, 0x44, 0x44, 0x33,
+0xBF, 0xBB, 0xBB, 0xD3, 0x42, 0x44, 0x44, 0x24, 0xBC, 0xBB, 0xBB, 0x03, 0x44, 0x44, 0x3F, 0xDE,
+0xBB, 0xBB, 0xCC, 0x2E, 0x44, 0x41, 0x23, 0xCC, 0xBF, 0xCA, 0x10, 0x35, 0x38, 0x26, 0xDF, 0xD0,
+0xD5, 0xED, 0x22, 0x26, 0x1B, 0xF0, 0xEC, 0xF6, 0x08, 0xEF, 0xE6, 0xE6, 0x13, 0x27, 0x2A, 0x15,
+0xD6, 0xCD, 0xD8, 0x24, 0x3B, 0x37, 0xF2, 0xC4, 0xBE, 0xD9, 0x38, 0x44, 0x39, 0xD2, 0xBB, 0xBB,
+0x18, 0x44, 0x44, 0x25, 0xBB, 0xBB, 0xC8, 0x41, 0x44, 0x43, 0xC6, 0xBB, 0xBB, 0x31, 0x44, 0x44,
+0xDD, 0xBB, 0xBB, 0x11, 0x44, 0x44, 0x1B, 0xBB, 0xBB, 0xDD, 0x44, 0x44, 0x27, 0xBB, 0xBB, 0xDA,
+0x44, 0x44, 0x21, 0xBB, 0xBB, 0xE9, 0x44, 0x44, 0xEF, 0xBB, 0xBB, 0x24, 0x44, 0x44, 0xD3, 0xBB,
+0xC2, 0x34, 0x44, 0x32, 0xC7, 0xBC, 0xDB, 0x38, 0x3C, 0x03, 0xC7, 0xCE, 0x1D, 0x32, 0x23, 0xDF,
+0xDA, 0xED, 0x1B, 0x13, 0x02, 0x18, 0x1A, 0xE6, 0xD6, 0xE6, 0x2B, 0x30, 0xEA, 0xC7, 0xD0, 0x2F,
+0x40, 0x1A, 0xBF, 0xC2, 0x2D, 0x44, 0x2D, 0xBB, 0xBB, 0x2B, 0x44, 0x36, 0xBB, 0xBB, 0x2A, 0x44,
+0x39, 0xBB, 0xBB, 0x31, 0x44, 0x37, 0xBB, 0xBB, 0x3B, 0x44, 0x29, 0xBB, 0xBB, 0x44, 0x44, 0xE1,
+0xBB, 0xC4, 0x44, 0x44, 0xC2, 0xBB, 0xEE, 0x44, 0x3E, 0xBB, 0xBB, 0x3A, 0x44, 0xF5, 0xBB, 0xCC,
+0x44, 0x41, 0xC4, 0xBB, 0x27, 0x44, 0x16, 0xBF, 0xD5, 0x39, 0x31, 0xD2, 0xCF, 0x1E, 0x2B, 0xF4,
+0xDD, 0xF2, 0x13, 0xF7, 0x16, 0x1C, 0xDE, 0xD8, 0x23, 0x30, 0xDE, 0xC7, 0x1A, 0x3E, 0x07, 0xBD,
+0xE1, 0x44, 0x2A, 0xBB, 0xCC, 0x44, 0x3C, 0xBB, 0xBF, 0x44, 0x44, 0xBB, 0xBB, 0x44, 0x44, 0xBB,
+0xBB, 0x44, 0x44, 0xBB, 0xBB, 0x44, 0x44, 0xBB, 0xBB, 0x44, 0x44, 0xBB, 0xBB, 0x44, 0x44, 0xBB,
+0xBB, 0x44, 0x44, 0xBB, 0xC1, 0x44, 0x36, 0xBB, 0xD5, 0x44, 0x18, 0xBB, 0x1B, 0x44, 0xD6, 0xBB,
+0x34, 0x41, 0xC7, 0xC6, 0x3A, 0x2D, 0xC6, 0xE0, 0x36, 0xFD, 0xD1, 0x17, 0x24, 0xE9, 0xEE, 0x0D,
+0xF3, 0x1D, 0x10, 0xD5, 0x13, 0x32, 0xD6, 0xCE, 0x36, 0x2A, 0xBF, 0xED, 0x44, 0xD2, 0xBB, 0x40,
+0x38, 0xBB, 0xE7, 0x44, 0xCA, 0xBB, 0x44, 0x3A, 0xBB, 0x1A, 0x44, 0xBB, 0xBB, 0x44, 0x28, 0xBB,
+0x3D, 0x44, 0xBB, 0xCB, 0x44, 0xCA, 0xBB, 0x44, 0x37, 0xBB, 0x37, 0x44, 0xBB, 0xCC, 0x44, 0xC4,
+0xBB, 0x44, 0x23, 0xBB, 0x40, 0x41, 0xBB, 0x21, 0x44, 0xBB, 0xD2, 0x44, 0xCD, 0xC3, 0x43, 0xEB,
+0xC0, 0x3A, 0x23, 0xC3, 0x29, 0x27, 0xD0, 0x1A, 0x26, 0xDE, 0xFE, 0x17, 0xF4, 0x08, 0xE5, 0x1B,
+0x17, 0xD6, 0x22, 0x25, 0xCA, 0x25, 0x31, 0xC3, 0x24, 0x38, 0xBC, 0x24, 0x3F, 0xBB, 0x22, 0x43,
+0xBB, 0x24, 0x44, 0xBB, 0x26, 0x44, 0xBB, 0x2D, 0x44, 0xBB, 0x33, 0x44, 0xBB, 0x3C, 0x44, 0xBB,
+0x44, 0x3C, 0xBB, 0x44, 0x2E, 0xBB, 0x44, 0x04, 0xBB, 0x44, 0xD1, 0xBB, 0x44, 0xBF, 0xC1, 0x44,
+0xBB, 0xDB, 0x44, 0xBB, 0x28, 0x44, 0xBB, 0x43, 0x33, 0xBB, 0x44, 0xE8, 0xBB, 0x44, 0xC4, 0xD0,
+0x44, 0xBB, 0x1C, 0x3D, 0xBB, 0x36, 0x1E, 0xC2, 0x3D, 0xDA, 0xD5, 0x37, 0xCF, 0x10, 0x27, 0xD3,
+0x21, 0x0C, 0xE5, 0x1C, 0xEE, 0xF8, 0x0A, 0x12, 0xEC, 0xEB, 0x25, 0xD9, 0x1B, 0x1E, 0xD2, 0x31,
+0xDC, 0xDB, 0x39, 0xC4, 0x29, 0x27, 0xC3, 0x42, 0xCB, 0xDD, 0x43, 0xBB, 0x3D, 0x19, 0xBD, 0x44,
+0xBB, 0x21, 0x3F, 0xBB, 0x44, 0xC9, 0xCE, 0x44, 0xBB, 0x44, 0x11, 0xBB, 0x44, 0xBB, 0x39, 0x34,
+0xBB, 0x44, 0xBB, 0x1C, 0x44, 0xBB, 0x44, 0xBB, 0xE2, 0x44, 0xBB, 0x44, 0xC1, 0xD0, 0x44, 0xBB,
+0x44, 0xC4, 0xD1, 0x44, 0xBB, 0x44, 0xC3, 0xD5, 0x44, 0xBB, 0x44, 0xC2, 0xE0, 0x44, 0xBB, 0x44,
+0xBC, 0x1B, 0x3A, 0xBB, 0x44, 0xBB, 0x31, 0x24, 0xC0, 0x44, 0xBB, 0x3A, 0xE4, 0xD2, 0x3E, 0xBD,
+0x3C, 0xD2, 0x08, 0x29, 0xCC, 0x37, 0xCE, 0x24, 0xF8, 0xE0, 0x25, 0xDC, 0x22, 0xE4, 0x0B, 0x0E,
+0xF5, 0xEF, 0x19, 0xE4, 0x15, 0x0E, 0xE0, 0x29, 0xD4, 0x2A, 0xDA, 0x15, 0x1F, 0xD3, 0x36, 0xC5,
+0x39, 0xD0, 0x18, 0x29, 0xC7, 0x3F, 0xBD, 0x42, 0xC5, 0x29, 0x1E, 0xC6, 0x44, 0xBB, 0x44, 0xBB,
+0x3A, 0xE2, 0x3F, 0x3B, 0x2E, 0x44, 0x14, 0x44, 0xFC, 0x44, 0x25, 0x0C, 0x34, 0xBB, 0x2D, 0xBB,
+0xF6, 0xBB, 0xC5, 0xBF, 0xBB, 0xF5, 0xBB, 0x3A, 0xBE, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x34, 0x15, 0xD2, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC6, 0xDF,
+0x26, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x29, 0xE4, 0xC9, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xCA, 0xE4, 0x29, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x3E, 0x2C, 0xEE, 0xCE, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xC3, 0xD5, 0x15, 0x31, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0x29, 0xEA,
+0xCE, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xD1, 0xF1, 0x2A, 0x3B, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x33, 0x1E, 0xDE, 0xCA, 0xBE, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xD3, 0xF2, 0x29, 0x39, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x42, 0x37, 0x26, 0xEA, 0xD1, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBF, 0xCA, 0xDA, 0x14, 0x2D, 0x3A, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x35,
+0x26, 0xF0, 0xD5, 0xC7, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xC7, 0xD4, 0xEA,
+0x23, 0x32, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3B, 0x31, 0x21, 0xE9, 0xD4,
+0xC8, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xC7, 0xD3, 0xE6, 0x1E, 0x2E, 0x39,
+0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3D, 0x34, 0x28, 0x11, 0xDE, 0xCF, 0xC6, 0xBF,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC3, 0xCB, 0xD7, 0xEC, 0x20, 0x2E, 0x38, 0x3F, 0x43,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3B, 0x33, 0x29, 0x16, 0xE3, 0xD3, 0xC9, 0xC2, 0xBD, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC2, 0xCA, 0xD3, 0xE2, 0x14, 0x26, 0x32, 0x39, 0x3F, 0x43, 0x44,
+0x44, 0x44, 0x44, 0x42, 0x3D, 0x37, 0x2F, 0x23, 0x0C, 0xDF, 0xD3, 0xCA, 0xC3, 0xBF, 0xBC, 0xBB,
+0xBB, 0xBB, 0xBC, 0xC0, 0xC5, 0xCC, 0xD5, 0xE3, 0x12, 0x25, 0x2F, 0x37, 0x3C, 0x40, 0x43, 0x44,
+0x44, 0x43, 0x40, 0x3C, 0x37, 0x30, 0x25, 0x15, 0xE5, 0xD7, 0xCE, 0xC7, 0xC2, 0xBF, 0xBC, 0xBB,
+0xBC, 0xBD, 0xC0, 0xC4, 0xCA, 0xD2, 0xDD, 0xF0, 0x1D, 0x29, 0x32, 0x38, 0x3C, 0x40, 0x41, 0x42,
+0x42, 0x40, 0x3D, 0x39, 0x33, 0x2B, 0x20, 0x09, 0xE1, 0xD5, 0xCD, 0xC7, 0xC3, 0xC0, 0xBE, 0xBD,
+0xBE, 0xC0, 0xC3, 0xC7, 0xCD, 0xD5, 0xE0, 0xF7, 0x1E, 0x29, 0x31, 0x37, 0x3B, 0x3E, 0x40, 0x40,
+0x40, 0x3E, 0x3B, 0x37, 0x32, 0x2A, 0x1F, 0x0B, 0xE2, 0xD7, 0xCF, 0xC9, 0xC5, 0xC2, 0xC0, 0xBF,
+0xC0, 0xC1, 0xC4, 0xC8, 0xCD, 0xD4, 0xDE, 0xF0, 0x1B, 0x27, 0x2F, 0x35, 0x39, 0x3C, 0x3E, 0x3F,
+0x3F, 0x3D, 0x3B, 0x37, 0x32, 0x2B, 0x22, 0x12, 0xE7, 0xDA, 0xD2, 0xCC, 0xC7, 0xC4, 0xC2, 0xC0,
+0xC1, 0xC2, 0xC4, 0xC8, 0xCC, 0xD3, 0xDC, 0xE9, 0x14, 0x23, 0x2C, 0x32, 0x37, 0x3A, 0x3D, 0x3E,
+0x3E, 0x3D, 0x3B, 0x38, 0x33, 0x2D, 0x25, 0x19, 0xEF, 0xDF, 0xD5, 0xCE, 0xC9, 0xC6, 0xC3, 0xC2,
+0xC1, 0xC2, 0xC4, 0xC7, 0xCB, 0xD1, 0xD9, 0xE4, 0x0A, 0x1E, 0x28, 0x2F, 0x35, 0x39, 0x3B, 0x3D,
+0x3D, 0x3D, 0x3B, 0x38, 0x34, 0x2F, 0x28, 0x1D, 0x07, 0xE3, 0xD8, 0xD1, 0xCB, 0xC7, 0xC4, 0xC2,
+0xC2, 0xC2, 0xC4, 0xC6, 0xCA, 0xCF, 0xD6, 0xE0, 0xF2, 0x1A, 0x26, 0x2E, 0x33, 0x38, 0x3B, 0x3D,
+0x3D, 0x3D, 0x3C, 0x39, 0x36, 0x30, 0x29, 0x20, 0x0F, 0xE6, 0xDA, 0xD2, 0xCC, 0xC8, 0xC4, 0xC2,
+0xC2, 0xC2, 0xC3, 0xC6, 0xC9, 0xCF, 0xD5, 0xDF, 0xEF, 0x1A, 0x25, 0x2D, 0x34, 0x38, 0x3B, 0x3D,
+0x3E, 0x3D, 0x3C, 0x39, 0x36, 0x31, 0x29, 0x20, 0x0E, 0xE5, 0xD9, 0xD1, 0xCB, 0xC7, 0xC4, 0xC2,
+0xC1, 0xC2, 0xC3, 0xC6, 0xCA, 0xCF, 0xD7, 0xE1, 0xFC, 0x1D, 0x28, 0x30, 0x36, 0x3A, 0x3D, 0x3E,
+0x3F, 0x3E, 0x3C, 0x39, 0x35, 0x2F, 0x27, 0x1A, 0xEF, 0xDE, 0xD4, 0xCD, 0xC8, 0xC4, 0xC2, 0xC0,
+0xC1, 0xC2, 0xC4, 0xC7, 0xCC, 0xD3, 0xDC, 0xEC, 0x19, 0x26, 0x2F, 0x35, 0x3A, 0x3D, 0x3F, 0x40,
+0x3F, 0x3E, 0x3B, 0x37, 0x31, 0x28, 0x1C, 0xF2, 0xDE, 0xD4, 0xCC, 0xC7, 0xC3, 0xC0, 0xBF, 0xBF,
+0xC0, 0xC3, 0xC6, 0xCC, 0xD3, 0xDE, 0xF2, 0x1D, 0x29, 0x32, 0x38, 0x3D, 0x40, 0x41, 0x42, 0x41,
+0x3E, 0x3B, 0x35, 0x2E, 0x24, 0x13, 0xE5, 0xD7, 0xCE, 0xC7, 0xC3, 0xBF, 0xBE, 0xBD, 0xBE, 0xC0,
+0xC4, 0xC9, 0xD0, 0xDA, 0xEC, 0x1B, 0x29, 0x32, 0x39, 0x3E, 0x41, 0x43, 0x43, 0x43, 0x40, 0x3C,
+0x37, 0x2F, 0x24, 0x0F, 0xE1, 0xD4, 0xCB, 0xC4, 0xC0, 0xBD, 0xBB, 0xBB, 0xBD, 0xBF, 0xC4, 0xCA,
+0xD3, 0xE0, 0x0F, 0x25, 0x30, 0x38, 0x3E, 0x42, 0x44, 0x44, 0x44, 0x43, 0x3F, 0x3A, 0x32, 0x27,
+0x14, 0xE2, 0xD3, 0xCA, 0xC3, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xC3, 0xCA, 0xD4, 0xE3, 0x18,
+0x2A, 0x35, 0x3D, 0x42, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3F, 0x38, 0x2E, 0x1E, 0xEA, 0xD6, 0xCA,
+0xC2, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xC8, 0xD3, 0xE4, 0x1B, 0x2C, 0x38, 0x40, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x36, 0x29, 0x13, 0xDD, 0xCE, 0xC4, 0xBD, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBD, 0xC4, 0xCF, 0xDF, 0x18, 0x2D, 0x39, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3F, 0x35, 0x26, 0xF3, 0xD6, 0xC8, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xC9, 0xD8,
+0x0F, 0x2B, 0x39, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x36, 0x25, 0xEA, 0xD1, 0xC4,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC2, 0xCF, 0xE6, 0x24, 0x36, 0x42, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x43, 0x38, 0x26, 0xE7, 0xCF, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xC5, 0xD6, 0x13, 0x30, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x2B, 0xED, 0xCF,
+0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0xDB, 0x20, 0x37, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x42, 0x33, 0x14, 0xD3, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7,
+0xDF, 0x27, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x27, 0xDE, 0xC5, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xDE, 0x28, 0x3E, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x37, 0x17, 0xD0, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xD5, 0x22, 0x3C, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x35, 0x00, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8,
+0xF2, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x37, 0x0F, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xCF, 0x1E, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x23, 0xD2, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x22, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x37,
+0xF4, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0x10, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x36, 0xEB, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD3, 0x28, 0x43, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x3E, 0x1A, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD4, 0x2A, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x35, 0xE5, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC9, 0x17, 0x3D, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x36, 0xE9, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x24, 0x41, 0x44, 0x44,
+0x44, 0x44, 0x40, 0x24, 0xD1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0x17, 0x3B, 0x44, 0x44, 0x44,
+0x44, 0x3E, 0x20, 0xD1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xD5, 0x25, 0x3E, 0x44, 0x44, 0x44, 0x42,
+0x2E, 0xE2, 0xC5, 0xBB, 0xBB, 0xBB, 0xBF, 0xD2, 0x1C, 0x38, 0x44, 0x44, 0x44, 0x3E, 0x2A, 0xE1,
+0xC8, 0xBC, 0xBB, 0xBD, 0xC7, 0xDE, 0x25, 0x39, 0x42, 0x44, 0x3E, 0x31, 0x13, 0xD4, 0xC6, 0xC0,
+0xC2, 0xC9, 0xDA, 0x19, 0x30, 0x3A, 0x3C, 0x38, 0x2C, 0x13, 0xDA, 0xCE, 0xC9, 0xCB, 0xD2, 0xE3,
+0x1B, 0x2B, 0x32, 0x31, 0x2C, 0x1F, 0xEE, 0xDC, 0xD6, 0xD5, 0xDA, 0xE4, 0x0A, 0x1D, 0x23, 0x24,
+0x20, 0x17, 0xFB, 0xEC, 0xE7, 0xEA, 0xED, 0xF3, 0x03, 0x09, 0x05, 0xF6, 0xF3, 0xF3, 0x09, 0x15,
+0x1D, 0x1F, 0x1C, 0x13, 0xEE, 0xE1, 0xDB, 0xDA, 0xDF, 0xEE, 0x1D, 0x29, 0x2E, 0x2C, 0x22, 0xEF,
+0xD7, 0xCD, 0xCC, 0xD2, 0xE5, 0x23, 0x34, 0x3A, 0x37, 0x29, 0xE9, 0xCD, 0xC3, 0xC2, 0xCD, 0xEB,
+0x2F, 0x3F, 0x42, 0x3B, 0x24, 0xD5, 0xC0, 0xBB, 0xBF, 0xD2, 0x25, 0x40, 0x44, 0x44, 0x33, 0xDF,
+0xBF, 0xBB, 0xBB, 0xC9, 0x20, 0x43, 0x44, 0x44, 0x39, 0xDE, 0xBB, 0xBB, 0xBB, 0xC8, 0x29, 0x44,
+0x44, 0x44, 0x33, 0xCC, 0xBB, 0xBB, 0xBB, 0xD8, 0x3E, 0x44, 0x44, 0x44, 0xF5, 0xBB, 0xBB, 0xBB,
+0xC4, 0x30, 0x44, 0x44, 0x44, 0x26, 0xBC, 0xBB, 0xBB, 0xBE, 0x2C, 0x44, 0x44, 0x44, 0x25, 0xBB,
+0xBB, 0xBB, 0xC2, 0x36, 0x44, 0x44, 0x44, 0xEA, 0xBB, 0xBB, 0xBB, 0xD9, 0x44, 0x44, 0x44, 0x39,
+0xC3, 0xBB, 0xBB, 0xBF, 0x33, 0x44, 0x44, 0x44, 0xD6, 0xBB, 0xBB, 0xBB, 0x23, 0x44, 0x44, 0x44,
+0xE2, 0xBB, 0xBB, 0xBB, 0x21, 0x44, 0x44, 0x44, 0xDA, 0xBB, 0xBB, 0xC1, 0x2E, 0x44, 0x44, 0x37,
+0xCC, 0xBB, 0xBB, 0xD5, 0x3B, 0x44, 0x44, 0x16, 0xC0, 0xBB, 0xC5, 0x22, 0x43, 0x44, 0x2C, 0xD0,
+0xBE, 0xC4, 0xED, 0x37, 0x3E, 0x2E, 0xDE, 0xC8, 0xCB, 0xE5, 0x2C, 0x34, 0x28, 0xE7, 0xD4, 0xD7,
+0xED, 0x1F, 0x24, 0x19, 0xEF, 0xEB, 0xF1, 0x01, 0xF0, 0xE8, 0xEE, 0x19, 0x23, 0x1F, 0xE9, 0xD6,
+0xD5, 0xFA, 0x2D, 0x33, 0x1C, 0xD1, 0xC6, 0xD6, 0x2C, 0x40, 0x33, 0xD7, 0xBD, 0xC4, 0x21, 0x44,
+0x42, 0xEB, 0xBB, 0xBB, 0xF7, 0x44, 0x44, 0x1B, 0xBB, 0xBB, 0xE3, 0x44, 0x44, 0x20, 0xBB, 0xBB,
+0xE2, 0x44, 0x44, 0x11, 0xBB, 0xBB, 0x18, 0x44, 0x44, 0xD8, 0xBB, 0xBB, 0x36, 0x44, 0x44, 0xBE,
+0xBB, 0xC1, 0x44, 0x44, 0x29, 0xBB, 0xBB, 0x21, 0x44, 0x44, 0xC3, 0xBB, 0xC3, 0x44, 0x44, 0x1B,
+0xBB, 0xBB, 0x37, 0x44, 0x3A, 0xBB, 0xBB, 0x0D, 0x44, 0x44, 0xC2, 0xBB, 0xD9, 0x44, 0x44, 0xCF,
+0xBB, 0xD4, 0x44, 0x43, 0xD4, 0xBB, 0xD7, 0x3E, 0x3C, 0xD7, 0xC0, 0xE1, 0x37, 0x2F, 0xDA, 0xCE,
+0xF4, 0x2D, 0x20, 0xDF, 0xDF, 0x10, 0x18, 0x04, 0x11, 0x10, 0xE9, 0xE1, 0x12, 0x2A, 0x16, 0xD0,
+0xD7, 0x2E, 0x34, 0xD9, 0xC3, 0x0E, 0x42, 0x27, 0xBC, 0xC8, 0x40, 0x44, 0xC8, 0xBB, 0x28, 0x44,
+0x10, 0xBB, 0xD4, 0x44, 0x3C, 0xBB, 0xBB, 0x44, 0x44, 0xBB, 0xBB, 0x3F, 0x44, 0xC9, 0xBB, 0x2F,
+0x44, 0xD8, 0xBB, 0x16, 0x44, 0x14, 0xBB, 0xE4, 0x44, 0x1D, 0xBB, 0xE5, 0x44, 0x17, 0xBB, 0xF2,
+0x44, 0xE7, 0xBB, 0x23, 0x44, 0xD4, 0xBB, 0x32, 0x44, 0xC6, 0xBB, 0x3E, 0x40, 0xC0, 0xC9, 0x40,
+0x2A, 0xC0, 0xE5, 0x3C, 0xEB, 0xCB, 0x20, 0x2A, 0xDF, 0xE1, 0x1F, 0x10, 0xF1, 0xFC, 0xE6, 0x15,
+0x23, 0xDD, 0xDD, 0x31, 0x16, 0xC7, 0x24, 0x3B, 0xC7, 0xD0, 0x44, 0xF3, 0xBB, 0x38, 0x41, 0xBB,
+0xDC, 0x44, 0xC8, 0xBB, 0x44, 0x2B, 0xBB, 0x3B, 0x44, 0xBB, 0xE0, 0x44, 0xBB, 0xBB, 0x44, 0xDB,
+0xBB, 0x44, 0x32, 0xBB, 0x43, 0x44, 0xBB, 0x2B, 0x44, 0xBB, 0xE7, 0x44, 0xBB, 0xCF, 0x44, 0xBB,
+0xC9, 0x44, 0xC2, 0xC7, 0x44, 0xC9, 0xC8, 0x44, 0xCD, 0xCD, 0x41, 0xD2, 0xD6, 0x38, 0xD7, 0xE2,
+0x2E, 0xDD, 0xF3, 0x1A, 0xEE, 0xF8, 0xE5, 0x24, 0xE6, 0xDE, 0x32, 0xD2, 0xE6, 0x3A, 0xC0, 0x26,
+0x34, 0xBB, 0x3F, 0x14, 0xBB, 0x44, 0xC4, 0xCD, 0x44, 0xBB, 0x35, 0x3D, 0xBB, 0x44, 0xCD, 0xBD,
+0x44, 0xBB, 0x37, 0x3F, 0xBB, 0x44, 0xC0, 0xCB, 0x44, 0xBB, 0x44, 0xF6, 0xBB, 0x44, 0xBB, 0x38,
+0x2E, 0xBB, 0x44, 0xBB, 0x2A, 0x33, 0xBB, 0x44, 0xBE, 0x26, 0x29, 0xC2, 0x40, 0xC8, 0x27, 0x14,
+0xD5, 0x30, 0xD7, 0x20, 0xEF, 0xF4, 0xF4, 0x1F, 0xDF, 0x22, 0xE4, 0xEB, 0x2A, 0xC8, 0x3E, 0xC2,
+0x36, 0xDB, 0xDE, 0x39, 0xBB, 0x44, 0xBB, 0x44, 0xC6, 0x19, 0x33, 0xBB, 0x44, 0xBB, 0x44, 0xBB,
+0x44, 0xC6, 0x15, 0x34, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x43, 0xCD, 0x17, 0x2A, 0xC6,
+0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x43, 0xC2, 0x35, 0xD3, 0x24, 0xE3, 0x10, 0x0B,
+0xED, 0x15, 0xEA, 0x15, 0xEE, 0x08, 0x10, 0xE9, 0x1F, 0xDD, 0x27, 0xD4, 0x30, 0xCA, 0x3A, 0xC8,
+0x3A, 0xC3, 0x3E, 0xBF, 0x42, 0xBB, 0x44, 0xBE, 0x41, 0xBF, 0x3F, 0xC2, 0x3B, 0xCC, 0x2B, 0xE7,
+0xEA, 0x25, 0xCF, 0x38, 0xBD, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x43,
+0xE7, 0x44, 0x32, 0x44, 0x40, 0x36, 0x3F, 0xD2, 0x37, 0xBB, 0x23, 0xBB, 0xEC, 0xBB, 0xDE, 0xC7,
+0x2D, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x2B, 0xE2, 0xC7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC8, 0xE5, 0x2C, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x2C, 0xE6, 0xC9, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0xE0, 0x29, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x2F, 0xF0,
+0xCD, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xDA, 0x22, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x43, 0x34, 0x17, 0xD4, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xD1, 0x0F, 0x31, 0x41, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x3B, 0x27, 0xE2, 0xC9, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0xDE,
+0x23, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x34, 0x1A, 0xD8, 0xC5, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBF, 0xCD, 0xE8, 0x28, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x30, 0x14, 0xD6, 0xC5,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xCF, 0xE9, 0x28, 0x39, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3E,
+0x31, 0x19, 0xDA, 0xC8, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xCB, 0xDF, 0x1F, 0x33, 0x3F, 0x44,
+0x44, 0x44, 0x44, 0x40, 0x36, 0x25, 0xE8, 0xD0, 0xC4, 0xBC, 0xBB, 0xBB, 0xBB, 0xBD, 0xC6, 0xD4,
+0xF2, 0x28, 0x37, 0x40, 0x44, 0x44, 0x44, 0x43, 0x3C, 0x30, 0x1D, 0xE1, 0xCE, 0xC3, 0xBD, 0xBB,
+0xBB, 0xBB, 0xC0, 0xC9, 0xD7, 0x06, 0x28, 0x35, 0x3E, 0x43, 0x44, 0x44, 0x41, 0x3A, 0x2F, 0x1E,
+0xE4, 0xD1, 0xC6, 0xBF, 0xBC, 0xBB, 0xBD, 0xC1, 0xC9, 0xD5, 0xEB, 0x21, 0x30, 0x39, 0x3F, 0x42,
+0x42, 0x40, 0x3B, 0x32, 0x25, 0xF9, 0xDA, 0xCD, 0xC5, 0xC0, 0xBE, 0xBE, 0xC1, 0xC6, 0xCF, 0xDD,
+0x0F, 0x26, 0x32, 0x39, 0x3E, 0x3F, 0x3F, 0x3C, 0x37, 0x2E, 0x20, 0xEE, 0xD9, 0xCE, 0xC6, 0xC2,
+0xC0, 0xC1, 0xC4, 0xC9, 0xD2, 0xDF, 0x0E, 0x24, 0x2F, 0x36, 0x3A, 0x3C, 0x3C, 0x3A, 0x35, 0x2D,
+0x21, 0xFC, 0xDE, 0xD2, 0xCB, 0xC6, 0xC4, 0xC4, 0xC5, 0xCA, 0xD1, 0xDB, 0xEE, 0x1C, 0x29, 0x31,
+0x36, 0x38, 0x39, 0x38, 0x35, 0x2F, 0x26, 0x19, 0xEB, 0xDB, 0xD2, 0xCC, 0xC8, 0xC7, 0xC7, 0xC9,
+0xCE, 0xD5, 0xE0, 0xF5, 0x1D, 0x28, 0x2F, 0x33, 0x35, 0x36, 0x35, 0x32, 0x2C, 0x24, 0x17, 0xED,
+0xDE, 0xD5, 0xCF, 0xCC, 0xCA, 0xCB, 0xCD, 0xD0, 0xD6, 0xDF, 0xEF, 0x17, 0x23, 0x2A, 0x2E, 0x31,
+0x32, 0x31, 0x2F, 0x2B, 0x25, 0x1B, 0x08, 0xE5, 0xDC, 0xD5, 0xD1, 0xCF, 0xCE, 0xCF, 0xD1, 0xD6,
+0xDC, 0xE6, 0x06, 0x1A, 0x22, 0x28, 0x2B, 0x2E, 0x2E, 0x2D, 0x2B, 0x27, 0x20, 0x18, 0xF8, 0xE6,
+0xDE, 0xD8, 0xD4, 0xD2, 0xD2, 0xD3, 0xD5, 0xD9, 0xDF, 0xE7, 0xFB, 0x17, 0x1F, 0x24, 0x27, 0x29,
+0x2A, 0x29, 0x28, 0x24, 0x1F, 0x18, 0x0A, 0xEB, 0xE3, 0xDD, 0xD9, 0xD7, 0xD6, 0xD7, 0xD8, 0xDB,
+0xE0, 0xE6, 0xF0, 0x0F, 0x18, 0x1E, 0x22, 0x24, 0x25, 0x25, 0x24, 0x22, 0x1E, 0x1A, 0x12, 0xF8,
+0xEB, 0xE4, 0xE0, 0xDD, 0xDC, 0xDB, 0xDB, 0xDD, 0xE0, 0xE4, 0xEA, 0xF4, 0x0F, 0x16, 0x1B, 0x1D,
+0x20, 0x20, 0x20, 0x1F, 0x1D, 0x1A, 0x16, 0x10, 0xFA, 0xEE, 0xE8, 0xE5, 0xE2, 0xE1, 0xE0, 0xE0,
+0xE2, 0xE4, 0xE7, 0xEC, 0xF4, 0x0A, 0x11, 0x16, 0x19, 0x1A, 0x1B, 0x1A, 0x1A, 0x18, 0x16, 0x13,
+0x0F, 0x08, 0xF4, 0xEF, 0xEB, 0xE9, 0xE7, 0xE6, 0xE6, 0xE6, 0xE8, 0xEB, 0xEE, 0xF3, 0xFB, 0x0B,
+0x0F, 0x12, 0x14, 0x13, 0x14, 0x14, 0x13, 0x12, 0x11, 0x0E, 0x0A, 0xFD, 0xF5, 0xF1, 0xEF, 0xEE,
+0xEC, 0xEC, 0xED, 0xEE, 0xF0, 0xF2, 0xF4, 0xF7, 0x02, 0x08, 0x0A, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+0x0B, 0x0A, 0x09, 0x06, 0x04, 0xFE, 0xFA, 0xF9, 0xF7, 0xF6, 0xF6, 0xFA, 0xFA, 0xFB, 0x04, 0x04,
+0x03, 0x03, 0xFE, 0xFA, 0xF8, 0xF6, 0xF3, 0xF3, 0xF3, 0xF2, 0xF1, 0xF2, 0xF3, 0xF5, 0xF8, 0xFE,
+0x07, 0x0A, 0x0D, 0x0D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x0A, 0x04, 0xF7, 0xF3, 0xF0,
+0xEE, 0xED, 0xEB, 0xEB, 0xEB, 0xEC, 0xEE, 0xF0, 0xF4, 0xF9, 0x09, 0x0E, 0x10, 0x12, 0x14, 0x15,
+0x15, 0x15, 0x15, 0x13, 0x11, 0x0E, 0x08, 0xF7, 0xF1, 0xEE, 0xEB, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9,
+0xEA, 0xEC, 0xEF, 0xF5, 0x07, 0x0E, 0x12, 0x14, 0x16, 0x18, 0x19, 0x19, 0x18, 0x17, 0x14, 0x11,
+0x0C, 0xFC, 0xF1, 0xED, 0xEA, 0xE7, 0xE6, 0xE5, 0xE5, 0xE6, 0xE7, 0xE9, 0xEC, 0xF1, 0xFA, 0x0D,
+0x12, 0x15, 0x18, 0x1A, 0x1B, 0x1B, 0x1B, 0x19, 0x17, 0x14, 0x10, 0x09, 0xF3, 0xED, 0xE9, 0xE6,
+0xE5, 0xE4, 0xE3, 0xE4, 0xE5, 0xE7, 0xEA, 0xEE, 0xF4, 0x0A, 0x11, 0x15, 0x18, 0x1A, 0x1B, 0x1C,
+0x1C, 0x1B, 0x1A, 0x17, 0x13, 0x0D, 0xF7, 0xEF, 0xEA, 0xE6, 0xE4, 0xE2, 0xE2, 0xE3, 0xE4, 0xE5,
+0xE8, 0xEC, 0xF1, 0x07, 0x10, 0x15, 0x18, 0x1B, 0x1C, 0x1E, 0x1E, 0x1D, 0x1B, 0x18, 0x14, 0x0E,
+0xFB, 0xEF, 0xEA, 0xE7, 0xE4, 0xE3, 0xE2, 0xE3, 0xE3, 0xE5, 0xE7, 0xEB, 0xF0, 0x02, 0x0F, 0x15,
+0x18, 0x1B, 0x1D, 0x1E, 0x1E, 0x1D, 0x1B, 0x18, 0x14, 0x0F, 0xFC, 0xF0, 0xEA, 0xE7, 0xE5, 0xE3,
+0xE2, 0xE3, 0xE3, 0xE5, 0xE8, 0xEB, 0xF1, 0x05, 0x0F, 0x15, 0x19, 0x1B, 0x1C, 0x1D, 0x1D, 0x1C,
+0x1A, 0x18, 0x13, 0x0D, 0xF7, 0xEF, 0xEA, 0xE7, 0xE5, 0xE3, 0xE3, 0xE4, 0xE5, 0xE7, 0xEA, 0xEE,
+0xF4, 0x0A, 0x11, 0x16, 0x19, 0x1B, 0x1C, 0x1C, 0x1C, 0x1B, 0x18, 0x15, 0x10, 0x07, 0xF3, 0xED,
+0xE9, 0xE7, 0xE5, 0xE5, 0xE5, 0xE6, 0xE7, 0xEA, 0xED, 0xF2, 0x06, 0x0F, 0x13, 0x17, 0x19, 0x1B,
+0x1B, 0x1B, 0x19, 0x17, 0x14, 0x10, 0x08, 0xF5, 0xEF, 0xEB, 0xE9, 0xE8, 0xE7, 0xE8, 0xE8, 0xEA,
+0xEB, 0xEE, 0xF3, 0x06, 0x0E, 0x12, 0x15, 0x17, 0x19, 0x19, 0x18, 0x17, 0x14, 0x11, 0x0C, 0x04,
+0xF4, 0xF0, 0xED, 0xEC, 0xEB, 0xEB, 0xEB, 0xEC, 0xED, 0xEF, 0xF3, 0xF9, 0x09, 0x0E, 0x11, 0x13,
+0x15, 0x16, 0x15, 0x14, 0x12, 0x0F, 0x0C, 0x06, 0xF7, 0xF3, 0xF2, 0xF0, 0xF0, 0xF2, 0xF2, 0xF3,
+0xF2, 0xF3, 0xF6, 0xFA, 0x06, 0x0A, 0x0C, 0x0E, 0x10, 0x10, 0x10, 0x0E, 0x0C, 0x0A, 0x06, 0x02,
+0xFA, 0xF9, 0xFB, 0xFC, 0x06, 0x09, 0x09, 0x09, 0x04, 0x05, 0x03, 0xFE, 0xFD, 0xFA, 0xFA, 0xFB,
+0xFC, 0x05, 0xFA, 0xF7, 0xF6, 0xF8, 0xFA, 0x06, 0x09, 0x0C, 0x0F, 0x11, 0x13, 0x13, 0x12, 0x10,
+0x0D, 0x09, 0xFD, 0xF5, 0xF2, 0xF0, 0xEE, 0xED, 0xEE, 0xEE, 0xEF, 0xF0, 0xF3, 0xF9, 0x0A, 0x10,
+0x13, 0x16, 0x18, 0x19, 0x18, 0x17, 0x14, 0x10, 0x09, 0xF5, 0xEF, 0xEB, 0xE8, 0xE7, 0xE7, 0xE8,
+0xE8, 0xEA, 0xEE, 0xF5, 0x0B, 0x13, 0x18, 0x1B, 0x1D, 0x1E, 0x1D, 0x1C, 0x18, 0x13, 0x0A, 0xF2,
+0xEA, 0xE6, 0xE3, 0xE2, 0xE2, 0xE2, 0xE3, 0xE7, 0xED, 0xF9, 0x12, 0x19, 0x1D, 0x21, 0x23, 0x22,
+0x21, 0x1E, 0x19, 0x11, 0xF4, 0xE9, 0xE3, 0xE0, 0xDD, 0xDD, 0xDD, 0xDF, 0xE3, 0xE9, 0xF5, 0x13,
+0x1C, 0x22, 0x25, 0x27, 0x26, 0x25, 0x21, 0x1A, 0x10, 0xEF, 0xE5, 0xDE, 0xDB, 0xD9, 0xD8, 0xD9,
+0xDD, 0xE2, 0xEB, 0x0E, 0x1B, 0x23, 0x28, 0x2A, 0x2B, 0x2A, 0x26, 0x20, 0x16, 0xF2, 0xE3, 0xDC,
+0xD7, 0xD5, 0xD4, 0xD5, 0xD9, 0xDF, 0xEA, 0x11, 0x1F, 0x27, 0x2C, 0x2F, 0x2F, 0x2D, 0x28, 0x1F,
+0x11, 0xE9, 0xDD, 0xD6, 0xD2, 0xD0, 0xD0, 0xD4, 0xD9, 0xE3, 0x05, 0x1E, 0x28, 0x2F, 0x32, 0x32,
+0x31, 0x2C, 0x24, 0x15, 0xE8, 0xDA, 0xD2, 0xCE, 0xCC, 0xCD, 0xD1, 0xD7, 0xE3, 0x11, 0x23, 0x2D,
+0x33, 0x36, 0x36, 0x32, 0x2C, 0x20, 0xF6, 0xDD, 0xD2, 0xCC, 0xC9, 0xC9, 0xCC, 0xD2, 0xDE, 0x08,
+0x23, 0x2F, 0x36, 0x39, 0x39, 0x36, 0x2E, 0x21, 0xF2, 0xDA, 0xCF, 0xC8, 0xC5, 0xC6, 0xCA, 0xD2,
+0xE1, 0x17, 0x2A, 0x35, 0x3B, 0x3D, 0x3B, 0x35, 0x2A, 0x16, 0xDF, 0xCF, 0xC7, 0xC3, 0xC3, 0xC6,
+0xCE, 0xDC, 0x13, 0x2B, 0x37, 0x3D, 0x3F, 0x3D, 0x37, 0x2B, 0x13, 0xDB, 0xCB, 0xC3, 0xC0, 0xC0,
+0xC5, 0xCF, 0xE2, 0x20, 0x33, 0x3D, 0x42, 0x42, 0x3D, 0x34, 0x21, 0xE2, 0xCD, 0xC2, 0xBD, 0xBD,
+0xC1, 0xCB, 0xDD, 0x1E, 0x34, 0x3F, 0x44, 0x44, 0x40, 0x35, 0x20, 0xDD, 0xC9, 0xBE, 0xBB, 0xBB,
+0xC1, 0xCE, 0xE9, 0x2A, 0x3C, 0x44, 0x44, 0x44, 0x3D, 0x2C, 0xEB, 0xCD, 0xBF, 0xBB, 0xBB, 0xBC,
+0xC8, 0xE0, 0x28, 0x3C, 0x44, 0x44, 0x44, 0x3F, 0x2D, 0xE7, 0xC9, 0xBB, 0xBB, 0xBB, 0xBC, 0xCB,
+0xF0, 0x32, 0x43, 0x44, 0x44, 0x44, 0x39, 0x1D, 0xD2, 0xBE, 0xBB, 0xBB, 0xBB, 0xC3, 0xDE, 0x2C,
+0x42, 0x44, 0x44, 0x44, 0x3D, 0x21, 0xD2, 0xBC, 0xBB, 0xBB, 0xBB, 0xC4, 0xE4, 0x33, 0x44, 0x44,
+0x44, 0x44, 0x38, 0xF7, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xD1, 0x26, 0x42, 0x44, 0x44, 0x44, 0x3F,
+0x1D, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xCE, 0x26, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x0F, 0xC4, 0xBB,
+0xBB, 0xBB, 0xBB, 0xDB, 0x35, 0x44, 0x44, 0x44, 0x44, 0x2F, 0xD2, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC,
+0x2B, 0x44, 0x44, 0x44, 0x44, 0x35, 0xD6, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC, 0x2D, 0x44, 0x44, 0x44,
+0x44, 0x2D, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xE3, 0x3E, 0x44, 0x44, 0x44, 0x3F, 0xE2, 0xBB, 0xBB,
+0xBB, 0xBB, 0xD0, 0x35, 0x44, 0x44, 0x44, 0x44, 0xF4, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x38, 0x44,
+0x44, 0x44, 0x40, 0xDE, 0xBB, 0xBB, 0xBB, 0xBB, 0xE8, 0x44, 0x44, 0x44, 0x44, 0x2B, 0xC2, 0xBB,
+0xBB, 0xBB, 0xCC, 0x38, 0x44, 0x44, 0x44, 0x38, 0xCC, 0xBB, 0xBB, 0xBB, 0xC7, 0x34, 0x44, 0x44,
+0x44, 0x38, 0xCA, 0xBB, 0xBB, 0xBB, 0xCE, 0x3C, 0x44, 0x44, 0x44, 0x27, 0xBC, 0xBB, 0xBB, 0xBB,
+0x13, 0x44, 0x44, 0x44, 0x3F, 0xD1, 0xBB, 0xBB, 0xBB, 0xD2, 0x40, 0x44, 0x44, 0x44, 0xE4, 0xBB,
+0xBB, 0xBB, 0xCC, 0x3C, 0x44, 0x44, 0x44, 0xE2, 0xBB, 0xBB, 0xBB, 0xD3, 0x42, 0x44, 0x44, 0x3F,
+0xCF, 0xBB, 0xBB, 0xBB, 0x18, 0x44, 0x44, 0x44, 0x25, 0xBB, 0xBB, 0xBB, 0xCE, 0x3E, 0x44, 0x44,
+0x3A, 0xCA, 0xBB, 0xBB, 0xC2, 0x31, 0x44, 0x44, 0x3F, 0xD4, 0xBB, 0xBB, 0xC1, 0x2D, 0x44, 0x44,
+0x3C, 0xD1, 0xBB, 0xBB, 0xC8, 0x34, 0x44, 0x44, 0x31, 0xC7, 0xBB, 0xBB, 0xDB, 0x3F, 0x44, 0x44,
+0x08, 0xBB, 0xBB, 0xC3, 0x27, 0x44, 0x44, 0x30, 0xCB, 0xBB, 0xBC, 0xEA, 0x3F, 0x44, 0x38, 0xD9,
+0xBB, 0xBC, 0xDB, 0x38, 0x44, 0x39, 0xE1, 0xC0, 0xBF, 0xDB, 0x33, 0x41, 0x35, 0xE0, 0xC4, 0xC4,
+0xE3, 0x32, 0x3D, 0x2D, 0xDA, 0xC6, 0xCC, 0x0F, 0x33, 0x35, 0x1C, 0xD4, 0xCC, 0xDA, 0x21, 0x31,
+0x29, 0xEB, 0xD4, 0xD7, 0xF7, 0x26, 0x26, 0x13, 0xE1, 0xE0, 0xEC, 0x18, 0x1E, 0x13, 0xEF, 0xEA,
+0xF2, 0x09, 0x07, 0x09, 0x08, 0x12, 0x11, 0xF2, 0xE6, 0xE6, 0x12, 0x21, 0x1D, 0xE9, 0xD9, 0xDF,
+0x1B, 0x2E, 0x23, 0xDE, 0xD0, 0xDD, 0x28, 0x34, 0x21, 0xD1, 0xC9, 0xE9, 0x34, 0x36, 0xF1, 0xC6,
+0xCA, 0x22, 0x3F, 0x30, 0xCF, 0xBF, 0xDA, 0x3C, 0x41, 0xEE, 0xBB, 0xC5, 0x30, 0x44, 0x2D, 0xC0,
+0xBB, 0x14, 0x44, 0x3D, 0xC7, 0xBB, 0xDC, 0x44, 0x44, 0xCF, 0xBB, 0xD0, 0x44, 0x44, 0xD5, 0xBB,
+0xCA, 0x44, 0x44, 0xD2, 0xBB, 0xCB, 0x44, 0x44, 0xC9, 0xBB, 0xD8, 0x44, 0x44, 0xBC, 0xBB, 0x1B,
+0x44, 0x3B, 0xBB, 0xBB, 0x3F, 0x44, 0xF4, 0xBB, 0xC3, 0x44, 0x44, 0xBB, 0xBB, 0x2B, 0x44, 0x2B,
+0xBB, 0xBB, 0x44, 0x44, 0xBB, 0xBB, 0x34, 0x44, 0xFC, 0xBB, 0xD0, 0x44, 0x41, 0xBB, 0xBB, 0x44,
+0x44, 0xBB, 0xBB, 0x3E, 0x44, 0xCC, 0xBB, 0x28, 0x44, 0xE8, 0xBB, 0x08, 0x44, 0x19, 0xBB, 0xDF,
+0x44, 0x25, 0xBB, 0xDD, 0x44, 0x1F, 0xBB, 0xE7, 0x44, 0x0B, 0xBB, 0x1E, 0x44, 0xD8, 0xBB, 0x2F,
+0x44, 0xC9, 0xBB, 0x3D, 0x3E, 0xBE, 0xC9, 0x43, 0x2A, 0xBD, 0xEF, 0x42, 0xDE, 0xC1, 0x2E, 0x36,
+0xCC, 0xD6, 0x38, 0x16, 0xCA, 0x1A, 0x2E, 0xDB, 0xDE, 0x26, 0x12, 0xDC, 0x12, 0x18, 0xED, 0xF5,
+0x02, 0x02, 0x0F, 0xF1, 0xEB, 0x20, 0x0A, 0xD9, 0x21, 0x22, 0xD1, 0x06, 0x33, 0xD3, 0xD8, 0x39,
+0xE1, 0xCA, 0x38, 0x1A, 0xC1, 0x35, 0x30, 0xBB, 0x2C, 0x3C, 0xBB, 0x1F, 0x44, 0xBB, 0xF5, 0x44,
+0xBB, 0xE6, 0x44, 0xBB, 0xE1, 0x44, 0xBB, 0xE5, 0x44, 0xBB, 0x18, 0x44, 0xBB, 0x2D, 0x44, 0xBB,
+0x3F, 0x3F, 0xBB, 0x44, 0x23, 0xBB, 0x44, 0xCE, 0xBB, 0x44, 0xBB, 0xDE, 0x44, 0xBB, 0x3E, 0x3E,
+0xBB, 0x44, 0xCE, 0xBC, 0x44, 0xBB, 0x2A, 0x44, 0xBB, 0x44, 0xCD, 0xC3, 0x44, 0xBB, 0x3D, 0x2B,
+0xBB, 0x44, 0xBB, 0x27, 0x38, 0xBB, 0x44, 0xC0, 0x19, 0x34, 0xBB, 0x44, 0xC1, 0x25, 0x29, 0xC6,
+0x3F, 0xC1, 0x30, 0xEC, 0xD9, 0x32, 0xCC, 0x31, 0xD9, 0x18, 0x16, 0xDF, 0x21, 0xE1, 0x11, 0x08,
+0xF4, 0xF7, 0x13, 0xE3, 0x24, 0xD6, 0x2D, 0xD4, 0x23, 0xEB, 0xE4, 0x2B, 0xC9, 0x3E, 0xBD, 0x44,
+0xBB, 0x42, 0xC2, 0x38, 0xD1, 0x1E, 0x18, 0xD5, 0x36, 0xC2, 0x44, 0xBB, 0x44, 0xBB, 0x3E, 0xD6,
+0x44, 0xF9, 0x44, 0x13, 0x44, 0xE0, 0x3A, 0x3B, 0x39, 0x35, 0x2D, 0x21, 0xF7, 0xDD, 0xD2, 0xCB,
+0xC7, 0xC6, 0xC7, 0xCA, 0xD1, 0xDB, 0xF0, 0x1E, 0x2C, 0x33, 0x38, 0x3A, 0x39, 0x36, 0x2F, 0x25,
+0x13, 0xE3, 0xD5, 0xCD, 0xC9, 0xC7, 0xC8, 0xCA, 0xD0, 0xDA, 0xEC, 0x1C, 0x2A, 0x32, 0x37, 0x38,
+0x38, 0x35, 0x2E, 0x24, 0x11, 0xE2, 0xD5, 0xCE, 0xC9, 0xC8, 0xC9, 0xCD, 0xD4, 0xDF, 0xFF, 0x21,
+0x2C, 0x33, 0x37, 0x38, 0x36, 0x31, 0x29, 0x1C, 0xEC, 0xDA, 0xD1, 0xCB, 0xC9, 0xC9, 0xCC, 0xD1,
+0xDB, 0xED, 0x1C, 0x29, 0x31, 0x35, 0x37, 0x35, 0x31, 0x2A, 0x1D, 0xF0, 0xDC, 0xD2, 0xCC, 0xCA,
+0xCA, 0xCC, 0xD2, 0xDC, 0xEF, 0x1D, 0x29, 0x31, 0x35, 0x36, 0x34, 0x2F, 0x27, 0x19, 0xEA, 0xDA,
+0xD1, 0xCC, 0xCA, 0xCB, 0xCF, 0xD6, 0xE1, 0x0D, 0x23, 0x2D, 0x33, 0x35, 0x35, 0x32, 0x2C, 0x21,
+0x08, 0xE0, 0xD4, 0xCE, 0xCB, 0xCB, 0xCE, 0xD3, 0xDD, 0xF1, 0x1D, 0x29, 0x30, 0x34, 0x35, 0x33,
+0x2D, 0x23, 0x11, 0xE3, 0xD7, 0xCF, 0xCC, 0xCB, 0xCD, 0xD2, 0xDB, 0xED, 0x1B, 0x28, 0x30, 0x34,
+0x35, 0x33, 0x2D, 0x24, 0x12, 0xE3, 0xD7, 0xCF, 0xCB, 0xCB, 0xCD, 0xD3, 0xDC, 0xF0, 0x1D, 0x29,
+0x31, 0x34, 0x34, 0x32, 0x2C, 0x22, 0x0A, 0xE0, 0xD5, 0xCE, 0xCB, 0xCB, 0xCE, 0xD4, 0xE0, 0x09,
+0x22, 0x2C, 0x32, 0x35, 0x34, 0x30, 0x29, 0x1D, 0xEE, 0xDB, 0xD2, 0xCC, 0xCA, 0xCC, 0xD0, 0xD8,
+0xE7, 0x17, 0x26, 0x2F, 0x34, 0x35, 0x33, 0x2E, 0x25, 0x12, 0xE3, 0xD6, 0xCF, 0xCB, 0xCA, 0xCD,
+0xD3, 0xDE, 0xF9, 0x21, 0x2C, 0x32, 0x35, 0x35, 0x31, 0x2A, 0x1D, 0xED, 0xDA, 0xD1, 0xCB, 0xC9,
+0xCB, 0xCF, 0xD8, 0xE8, 0x1A, 0x28, 0x30, 0x35, 0x36, 0x34, 0x2E, 0x23, 0x0C, 0xDF, 0xD3, 0xCC,
+0xC9, 0xC9, 0xCC, 0xD4, 0xE0, 0x10, 0x25, 0x2F, 0x35, 0x37, 0x36, 0x31, 0x28, 0x18, 0xE5, 0xD6,
+0xCD, 0xC9, 0xC8, 0xCA, 0xD0, 0xDB, 0xF2, 0x21, 0x2D, 0x34, 0x37, 0x37, 0x34, 0x2C, 0x1F, 0xEE,
+0xD9, 0xCF, 0xC9, 0xC7, 0xC8, 0xCD, 0xD6, 0xE6, 0x1A, 0x2A, 0x33, 0x37, 0x38, 0x36, 0x30, 0x25,
+0x0E, 0xDE, 0xD1, 0xCA, 0xC6, 0xC6, 0xC9, 0xD1, 0xDE, 0x0F, 0x26, 0x31, 0x37, 0x39, 0x39, 0x34,
+0x2B, 0x1B, 0xE6, 0xD5, 0xCB, 0xC6, 0xC5, 0xC7, 0xCD, 0xD7, 0xEC, 0x20, 0x2E, 0x36, 0x3A, 0x3B,
+0x38, 0x30, 0x24, 0xF9, 0xDA, 0xCE, 0xC6, 0xC4, 0xC4, 0xC8, 0xD1, 0xDF, 0x15, 0x29, 0x34, 0x3A,
+0x3C, 0x3B, 0x36, 0x2C, 0x1B, 0xE3, 0xD2, 0xC9, 0xC4, 0xC2, 0xC4, 0xCA, 0xD5, 0xEA, 0x21, 0x30,
+0x38, 0x3C, 0x3D, 0x3A, 0x33, 0x27, 0x0B, 0xDA, 0xCD, 0xC5, 0xC2, 0xC2, 0xC5, 0xCC, 0xDA, 0x0A,
+0x27, 0x34, 0x3B, 0x3E, 0x3E, 0x3A, 0x32, 0x23, 0xEE, 0xD6, 0xCA, 0xC3, 0xC0, 0xC1, 0xC5, 0xCE,
+0xDD, 0x15, 0x2B, 0x36, 0x3D, 0x40, 0x3F, 0x3A, 0x31, 0x21, 0xE7, 0xD3, 0xC7, 0xC1, 0xBF, 0xBF,
+0xC4, 0xCE, 0xDE, 0x18, 0x2D, 0x38, 0x3F, 0x41, 0x40, 0x3B, 0x32, 0x21, 0xE7, 0xD2, 0xC6, 0xC0,
+0xBD, 0xBE, 0xC3, 0xCC, 0xDC, 0x16, 0x2D, 0x39, 0x3F, 0x42, 0x41, 0x3D, 0x34, 0x25, 0xED, 0xD4,
+0xC7, 0xC0, 0xBC, 0xBC, 0xC0, 0xC8, 0xD6, 0x05, 0x29, 0x37, 0x3F, 0x43, 0x43, 0x40, 0x39, 0x2C,
+0x13, 0xD9, 0xCA, 0xC1, 0xBC, 0xBB, 0xBD, 0xC4, 0xCF, 0xE4, 0x20, 0x32, 0x3D, 0x43, 0x44, 0x43,
+0x3D, 0x34, 0x23, 0xE6, 0xD0, 0xC4, 0xBD, 0xBB, 0xBB, 0xBF, 0xC7, 0xD5, 0x05, 0x2A, 0x38, 0x41,
+0x44, 0x44, 0x43, 0x3C, 0x30, 0x1A, 0xDC, 0xCB, 0xC0, 0xBB, 0xBB, 0xBB, 0xBF, 0xC9, 0xDA, 0x16,
+0x2E, 0x3B, 0x43, 0x44, 0x44, 0x43, 0x3B, 0x2E, 0x15, 0xD9, 0xC8, 0xBF, 0xBB, 0xBB, 0xBB, 0xBF,
+0xC9, 0xDA, 0x17, 0x2F, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x30, 0x18, 0xDA, 0xC8, 0xBE, 0xBB,
+0xBB, 0xBB, 0xBD, 0xC6, 0xD6, 0x0F, 0x2D, 0x3B, 0x43, 0x44, 0x44, 0x44, 0x40, 0x34, 0x21, 0xE1,
+0xCC, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xC2, 0xCF, 0xE7, 0x26, 0x37, 0x41, 0x44, 0x44, 0x44, 0x44,
+0x3B, 0x2C, 0x07, 0xD4, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xC6, 0xD6, 0x14, 0x30, 0x3D, 0x44,
+0x44, 0x44, 0x44, 0x42, 0x37, 0x24, 0xE4, 0xCD, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xC9, 0xDD,
+0x1E, 0x34, 0x40, 0x44, 0x44, 0x44, 0x44, 0x41, 0x35, 0x20, 0xDE, 0xCA, 0xBE, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBE, 0xCA, 0xDF, 0x21, 0x36, 0x42, 0x44, 0x44, 0x44, 0x44, 0x41, 0x35, 0x20, 0xDD, 0xC9,
+0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC9, 0xDD, 0x20, 0x35, 0x41, 0x44, 0x44, 0x44, 0x44, 0x43,
+0x37, 0x24, 0xE2, 0xCB, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC6, 0xD8, 0x19, 0x32, 0x40, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x3C, 0x2B, 0xEE, 0xCF, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xD0,
+0xF1, 0x2C, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x33, 0x1A, 0xD7, 0xC5, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBC, 0xC8, 0xDD, 0x20, 0x36, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0x29, 0xE9,
+0xCD, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xCF, 0xF1, 0x2C, 0x3D, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x42, 0x35, 0x1E, 0xDA, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xD8, 0x1B, 0x34,
+0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x2F, 0x08, 0xD1, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBD, 0xCA, 0xE2, 0x26, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3A, 0x27, 0xE3, 0xCA, 0xBD,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xD0, 0x00, 0x2F, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+0x35, 0x1C, 0xD7, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xD9, 0x1D, 0x36, 0x43, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x3F, 0x2E, 0xF4, 0xCF, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCB,
+0xE5, 0x29, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x24, 0xDE, 0xC7, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xC2, 0xD4, 0x17, 0x34, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x30, 0x08,
+0xD0, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xCB, 0xE7, 0x2B, 0x3D, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x37, 0x1F, 0xD8, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xDC, 0x23, 0x39,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0x27, 0xE0, 0xC8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xC3, 0xD7, 0x1E, 0x37, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x29, 0xE2, 0xC8, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xC3, 0xD7, 0x1F, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0x25,
+0xDD, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0xE0, 0x28, 0x3C, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x35, 0x17, 0xD2, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xD0, 0x11, 0x34, 0x43,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x27, 0xDE, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCA,
+0xE8, 0x2E, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x2B, 0xE3, 0xC8, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xC9, 0xE9, 0x2E, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x27, 0xDD, 0xC5, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCF, 0x12, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0x15,
+0xD0, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC6, 0xE2, 0x2C, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3B, 0x22, 0xD6, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xDE, 0x29, 0x3F, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x3A, 0x1F, 0xD4, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0xE9, 0x30, 0x43, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x32, 0xF1, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xD6, 0x23, 0x3C,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x1A, 0xD0, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xD3, 0x1F,
+0x3B, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x15, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1, 0xDA,
+0x29, 0x40, 0x44, 0x44, 0x44, 0x44, 0x42, 0x2E, 0xE0, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCE,
+0x18, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0xEE, 0xC8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC,
+0x14, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44, 0x32, 0xE6, 0xC5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xD4,
+0x24, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x22, 0xD2, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xC9, 0x09,
+0x38, 0x44, 0x44, 0x44, 0x44, 0x42, 0x2B, 0xD9, 0xBF, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0xFA, 0x38,
+0x44, 0x44, 0x44, 0x44, 0x40, 0x25, 0xD3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD1, 0x23, 0x3F, 0x44,
+0x44, 0x44, 0x44, 0x35, 0xEA, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0x09, 0x39, 0x44, 0x44, 0x44,
+0x44, 0x39, 0x0B, 0xC7, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0x0C, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x36,
+0xE7, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x25, 0x42, 0x44, 0x44, 0x44, 0x41, 0x25, 0xD0, 0xBB,
+0xBB, 0xBB, 0xBB, 0xC6, 0x09, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x2D, 0xD6, 0xBC, 0xBB, 0xBB, 0xBB,
+0xC5, 0xF7, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x28, 0xD1, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0x21, 0x41,
+0x44, 0x44, 0x44, 0x3B, 0x08, 0xC4, 0xBB, 0xBB, 0xBB, 0xC0, 0xE6, 0x38, 0x44, 0x44, 0x44, 0x41,
+0x21, 0xCB, 0xBB, 0xBB, 0xBB, 0xBE, 0xDE, 0x35, 0x44, 0x44, 0x44, 0x41, 0x1F, 0xC9, 0xBB, 0xBB,
+0xBB, 0xC1, 0xED, 0x3A, 0x44, 0x44, 0x44, 0x3A, 0xEA, 0xC0, 0xBB, 0xBB, 0xBB, 0xCD, 0x28, 0x44,
+0x44, 0x44, 0x44, 0x24, 0xCB, 0xBB, 0xBB, 0xBB, 0xC5, 0x16, 0x40, 0x44, 0x44, 0x44, 0x2C, 0xD0,
+0xBB, 0xBB, 0xBB, 0xC4, 0x14, 0x40, 0x44, 0x44, 0x44, 0x26, 0xCB, 0xBB, 0xBB, 0xBB, 0xCB, 0x26,
+0x44, 0x44, 0x44, 0x3E, 0xF5, 0xC0, 0xBB, 0xBB, 0xBC, 0xE2, 0x3A, 0x44, 0x44, 0x44, 0x28, 0xCA,
+0xBB, 0xBB, 0xBB, 0xD3, 0x31, 0x44, 0x44, 0x44, 0x2F, 0xD0, 0xBB, 0xBB, 0xBB, 0xD2, 0x31, 0x44,
+0x44, 0x44, 0x2B, 0xCB, 0xBB, 0xBB, 0xBB, 0xDD, 0x39, 0x44, 0x44, 0x42, 0x15, 0xC1, 0xBB, 0xBB,
+0xC4, 0x1E, 0x44, 0x44, 0x44, 0x32, 0xD0, 0xBB, 0xBB, 0xBB, 0xE0, 0x3C, 0x44, 0x44, 0x3B, 0xDE,
+0xBB, 0xBB, 0xBB, 0xD7, 0x37, 0x44, 0x44, 0x3D, 0xE1, 0xBB, 0xBB, 0xBB, 0xDA, 0x3B, 0x44, 0x44,
+0x38, 0xD7, 0xBB, 0xBB, 0xBD, 0x04, 0x42, 0x44, 0x44, 0x29, 0xC6, 0xBB, 0xBB, 0xCB, 0x30, 0x44,
+0x44, 0x3C, 0xDC, 0xBB, 0xBB, 0xBF, 0x18, 0x44, 0x44, 0x44, 0x0F, 0xBD, 0xBB, 0xBB, 0xE6, 0x41,
+0x44, 0x44, 0x1D, 0xC0, 0xBB, 0xBB, 0xE4, 0x41, 0x44, 0x44, 0x17, 0xBE, 0xBB, 0xBC, 0x0C, 0x44,
+0x44, 0x40, 0xE2, 0xBB, 0xBB, 0xC4, 0x2B, 0x44, 0x44, 0x33, 0xCA, 0xBB, 0xBB, 0xDB, 0x3F, 0x44,
+0x44, 0xED, 0xBB, 0xBB, 0xC6, 0x2F, 0x44, 0x44, 0x28, 0xC1, 0xBB, 0xBE, 0x1F, 0x44, 0x44, 0x31,
+0xC7, 0xBB, 0xBB, 0x12, 0x44, 0x44, 0x33, 0xC7, 0xBB, 0xBC, 0x1B, 0x44, 0x44, 0x2C, 0xC2, 0xBB,
+0xC1, 0x2A, 0x44, 0x44, 0x18, 0xBB, 0xBB, 0xCE, 0x3A, 0x44, 0x3E, 0xD4, 0xBB, 0xBB, 0x13, 0x44,
+0x44, 0x24, 0xBD, 0xBB, 0xCF, 0x3C, 0x44, 0x39, 0xCB, 0xBB, 0xC0, 0x2C, 0x44, 0x43, 0xDC, 0xBB,
+0xBB, 0x1A, 0x44, 0x44, 0xEE, 0xBB, 0xBB, 0x04, 0x44, 0x44, 0x07, 0xBB, 0xBB, 0x10, 0x44, 0x44,
+0xE8, 0xBB, 0xBB, 0x20, 0x44, 0x42, 0xD4, 0xBB, 0xC1, 0x33, 0x44, 0x37, 0xC4, 0xBB, 0xD2, 0x42,
+0x44, 0x1C, 0xBB, 0xBB, 0x21, 0x44, 0x3F, 0xCC, 0xBB, 0xCD, 0x40, 0x44, 0x18, 0xBB, 0xBB, 0x2B,
+0x44, 0x36, 0xC1, 0xBB, 0xEB, 0x44, 0x42, 0xCE, 0xBB, 0xD2, 0x44, 0x44, 0xDB, 0xBB, 0xCA, 0x40,
+0x44, 0xE4, 0xBB, 0xC7, 0x3F, 0x44, 0xE6, 0xBB, 0xC9, 0x40, 0x44, 0xDA, 0xBB, 0xD0, 0x44, 0x44,
+0xCF, 0xBB, 0xE2, 0x44, 0x3B, 0xC1, 0xBB, 0x27, 0x44, 0x27, 0xBB, 0xC3, 0x3F, 0x44, 0xD4, 0xBB,
+0xE6, 0x44, 0x35, 0xBB, 0xBE, 0x3A, 0x44, 0xD7, 0xBB, 0xE9, 0x44, 0x2F, 0xBB, 0xC4, 0x41, 0x44,
+0xC7, 0xBB, 0x2C, 0x44, 0xE2, 0xBB, 0xE9, 0x44, 0x27, 0xBB, 0xCE, 0x44, 0x37, 0xBB, 0xC4, 0x44,
+0x3E, 0xBE, 0xC0, 0x41, 0x41, 0xBF, 0xBE, 0x40, 0x41, 0xC0, 0xC0, 0x42, 0x3F, 0xBC, 0xC3, 0x44,
+0x39, 0xBB, 0xCB, 0x44, 0x2C, 0xBB, 0xE0, 0x44, 0xEE, 0xBB, 0x26, 0x44, 0xCA, 0xBB, 0x3F, 0x3D,
+0xBB, 0xCD, 0x44, 0x1B, 0xBB, 0x28, 0x44, 0xC6, 0xBE, 0x44, 0x32, 0xBB, 0x10, 0x44, 0xCA, 0xBD,
+0x44, 0x2F, 0xBB, 0x20, 0x44, 0xC2, 0xC4, 0x44, 0x11, 0xBB, 0x38, 0x3E, 0xBB, 0xEA, 0x44, 0xC5,
+0xC5, 0x44, 0xE6, 0xBB, 0x44, 0x2E, 0xBB, 0x35, 0x3E, 0xBB, 0x1D, 0x44, 0xBB, 0xDC, 0x44, 0xC1,
+0xCB, 0x44, 0xC7, 0xC6, 0x44, 0xCC, 0xC3, 0x44, 0xCE, 0xC3, 0x44, 0xCA, 0xC6, 0x44, 0xC5, 0xCD,
+0x44, 0xBF, 0xDD, 0x44, 0xBB, 0x1B, 0x44, 0xBB, 0x35, 0x36, 0xBB, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x29, 0xE6, 0xCB, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCA, 0xE5, 0x29, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x3E, 0x2B, 0xE8, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0,
+0xD4, 0x18, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x2B, 0xE5, 0xC9,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC9, 0xE9, 0x2C, 0x3F, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x28, 0xE0, 0xC6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC1, 0xD8, 0x21, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x26, 0xDC,
+0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0xF8, 0x32, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x3D, 0x26, 0xDA, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF,
+0xD7, 0x24, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x2A, 0xDE, 0xC3, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC3, 0xE0, 0x2C, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x35, 0xF4, 0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC2, 0xDF, 0x2C, 0x42, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x43, 0x2E, 0xE0, 0xC2, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0,
+0x1F, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xE2, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBD, 0xD7, 0x29, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x1A, 0xCD, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD1, 0x22, 0x3F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B,
+0x15, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xDD, 0x2F, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x2A, 0xD7, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD5, 0x29, 0x43, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x2A, 0xD5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xE1, 0x33, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x3A, 0x00, 0xC5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD2, 0x27,
+0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x19, 0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD2,
+0x28, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3A, 0xF3, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF,
+0xE2, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2A, 0xD2, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xD0, 0x29, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x32, 0xDB, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xCD, 0x25, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x31, 0xD9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xD2, 0x2B, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0xD0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE,
+0xE3, 0x37, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0xF3, 0xC2, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCD,
+0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x26, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0x0C,
+0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2F, 0xD6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xE8, 0x39,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0xDA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xE4, 0x37, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x33, 0xDA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xE9, 0x3A, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x2F, 0xD5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC3, 0x09, 0x3D, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x29, 0xCE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0x1E, 0x42, 0x44, 0x44, 0x44, 0x44,
+0x41, 0x1D, 0xC7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x2B, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3A,
+0xEA, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xDD, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x31, 0xD7,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0x0F, 0x3E, 0x44, 0x44, 0x44, 0x44, 0x43, 0x22, 0xCB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xCE, 0x27, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0xF3, 0xC2, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xDB, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x32, 0xD9, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC3, 0x00, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xCC, 0x24, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x0F, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD7,
+0x30, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0xE1, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xE5, 0x38,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x2E, 0xD5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0x0C, 0x3C, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x26, 0xCF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC9, 0x1D, 0x40, 0x44, 0x44,
+0x44, 0x44, 0x41, 0x1F, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC, 0x22, 0x42, 0x44, 0x44, 0x44,
+0x44, 0x3F, 0x1B, 0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCE, 0x24, 0x42, 0x44, 0x44, 0x44, 0x44,
+0x3F, 0x1A, 0xC9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCE, 0x24, 0x42, 0x44, 0x44, 0x44, 0x44, 0x3F,
+0x1C, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC, 0x20, 0x41, 0x44, 0x44, 0x44, 0x44, 0x41, 0x21,
+0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0x18, 0x3E, 0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0xD2,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC4, 0xF1, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xDB, 0xBD,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xDD, 0x32, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0xEF, 0xC4, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xD1, 0x26, 0x42, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x20, 0xCD, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xC7, 0x0E, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2F, 0xDB, 0xBE, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBE, 0xDC, 0x2F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3A, 0x10, 0xC8, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xCC, 0x1D, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2A, 0xD7, 0xBC, 0xBB, 0xBB, 0xBB,
+0xBB, 0xC0, 0xE0, 0x31, 0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x0B, 0xC8, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xCC, 0x1B, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2C, 0xD9, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBF, 0xDC, 0x2F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3B, 0x15, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xC9, 0x13, 0x3A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2F, 0xDE, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE,
+0xD7, 0x2A, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3D, 0x1E, 0xCE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7,
+0xF4, 0x37, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0xE5, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xD4,
+0x26, 0x40, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x21, 0xD1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC6, 0xEC,
+0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0xE7, 0xC4, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xD3, 0x25,
+0x3F, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x21, 0xD1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC8, 0xF4, 0x36,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xE1, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xDA, 0x2B, 0x42,
+0x44, 0x44, 0x44, 0x44, 0x38, 0x12, 0xCA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD0, 0x1F, 0x3C, 0x44,
+0x44, 0x44, 0x44, 0x3E, 0x22, 0xD2, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xCA, 0x0B, 0x37, 0x44, 0x44,
+0x44, 0x44, 0x41, 0x2A, 0xDA, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xC6, 0xEA, 0x33, 0x44, 0x44, 0x44,
+0x44, 0x42, 0x2D, 0xDF, 0xC2, 0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xE6, 0x31, 0x44, 0x44, 0x44, 0x44,
+0x42, 0x2D, 0xDF, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xC7, 0xEA, 0x32, 0x44, 0x44, 0x44, 0x44, 0x40,
+0x29, 0xDA, 0xC1, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0x0D, 0x36, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x20,
+0xD3, 0xBE, 0xBB, 0xBB, 0xBB, 0xBE, 0xD3, 0x20, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x34, 0xF9, 0xCA,
+0xBB, 0xBB, 0xBB, 0xBB, 0xC5, 0xE3, 0x2E, 0x42, 0x44, 0x44, 0x44, 0x3E, 0x26, 0xD8, 0xC1, 0xBB,
+0xBB, 0xBB, 0xBF, 0xD3, 0x20, 0x3B, 0x44, 0x44, 0x44, 0x42, 0x30, 0xE9, 0xC8, 0xBB, 0xBB, 0xBB,
+0xBB, 0xCC, 0x0C, 0x35, 0x44, 0x44, 0x44, 0x44, 0x35, 0x0D, 0xCC, 0xBC, 0xBB, 0xBB, 0xBB, 0xCA,
+0xEF, 0x32, 0x43, 0x44, 0x44, 0x44, 0x35, 0x11, 0xCD, 0xBD, 0xBB, 0xBB, 0xBC, 0xCB, 0xF5, 0x33,
+0x43, 0x44, 0x44, 0x42, 0x32, 0xF4, 0xCB, 0xBC, 0xBB, 0xBB, 0xBF, 0xD0, 0x17, 0x37, 0x44, 0x44,
+0x44, 0x3E, 0x2A, 0xE0, 0xC6, 0xBB, 0xBB, 0xBB, 0xC5, 0xDC, 0x27, 0x3C, 0x44, 0x44, 0x43, 0x36,
+0x17, 0xD2, 0xC0, 0xBB, 0xBB, 0xC0, 0xD0, 0x14, 0x35, 0x42, 0x44, 0x44, 0x3B, 0x25, 0xDC, 0xC5,
+0xBC, 0xBB, 0xBE, 0xCC, 0xEC, 0x2E, 0x3F, 0x44, 0x44, 0x3C, 0x29, 0xE2, 0xC9, 0xBD, 0xBB, 0xBF,
+0xCB, 0xE9, 0x2C, 0x3D, 0x44, 0x43, 0x3B, 0x27, 0xE1, 0xC9, 0xBE, 0xBC, 0xC1, 0xCF, 0xF4, 0x2F,
+0x3D, 0x43, 0x41, 0x37, 0x20, 0xDA, 0xC6, 0xBE, 0xBE, 0xC5, 0xD6, 0x1A, 0x34, 0x3F, 0x41, 0x3C,
+0x2E, 0x05, 0xD1, 0xC3, 0xBF, 0xC2, 0xCD, 0xE8, 0x29, 0x39, 0x3F, 0x3E, 0x34, 0x1E, 0xDA, 0xC8,
+0xC2, 0xC2, 0xCB, 0xDE, 0x21, 0x34, 0x3D, 0x3D, 0x35, 0x23, 0xE1, 0xCD, 0xC4, 0xC4, 0xCB, 0xDD,
+0x1D, 0x32, 0x3B, 0x3B, 0x34, 0x21, 0xE1, 0xCE, 0xC6, 0xC6, 0xCE, 0xE0, 0x20, 0x32, 0x39, 0x38,
+0x2F, 0x1B, 0xDD, 0xCD, 0xC8, 0xC9, 0xD3, 0xEC, 0x25, 0x33, 0x37, 0x34, 0x28, 0xF7, 0xD6, 0xCC,
+0xCA, 0xCF, 0xDD, 0x17, 0x2C, 0x34, 0x34, 0x2C, 0x19, 0xE1, 0xD2, 0xCD, 0xCF, 0xD9, 0xF9, 0x24,
+0x2F, 0x31, 0x2C, 0x1D, 0xE7, 0xD6, 0xD0, 0xD2, 0xDA, 0xF1, 0x21, 0x2C, 0x2E, 0x2A, 0x1C, 0xE9,
+0xDA, 0xD3, 0xD5, 0xDE, 0xF6, 0x20, 0x2A, 0x2A, 0x25, 0x16, 0xE7, 0xDB, 0xD8, 0xDA, 0xE4, 0x0E,
+0x1F, 0x26, 0x25, 0x1E, 0x0A, 0xE4, 0xDC, 0xDD, 0xE1, 0xEF, 0x16, 0x1F, 0x22, 0x1F, 0x13, 0xEE,
+0xE5, 0xE3, 0xE5, 0xEC, 0x0D, 0x18, 0x1D, 0x19, 0x12, 0xF7, 0xEC, 0xE9, 0xEB, 0xF0, 0x05, 0x0E,
+0x11, 0x11, 0x0D, 0xFC, 0xF7, 0xF6, 0xF5, 0x05, 0xFE, 0x05, 0xF8, 0xF4, 0xF5, 0x05, 0x0E, 0x16,
+0x14, 0x10, 0xF6, 0xEC, 0xE9, 0xEA, 0xEF, 0x0F, 0x1A, 0x1E, 0x1C, 0x10, 0xEC, 0xE2, 0xE1, 0xE4,
+0xF4, 0x19, 0x22, 0x22, 0x1B, 0xF3, 0xE1, 0xDA, 0xDC, 0xE7, 0x17, 0x25, 0x29, 0x24, 0x0F, 0xE0,
+0xD5, 0xD6, 0xE0, 0x13, 0x27, 0x2D, 0x29, 0x17, 0xDF, 0xD2, 0xD1, 0xDC, 0x12, 0x2A, 0x32, 0x2D,
+0x19, 0xDC, 0xCE, 0xCE, 0xDA, 0x18, 0x30, 0x35, 0x2E, 0x12, 0xD5, 0xCA, 0xCC, 0xDE, 0x23, 0x36,
+0x38, 0x2B, 0xE8, 0xCC, 0xC6, 0xCE, 0xEF, 0x30, 0x3C, 0x37, 0x1F, 0xD4, 0xC4, 0xC5, 0xD7, 0x26,
+0x3C, 0x3E, 0x2E, 0xDE, 0xC4, 0xC0, 0xCD, 0x1B, 0x3B, 0x42, 0x36, 0xEA, 0xC4, 0xBC, 0xC7, 0x10,
+0x3B, 0x44, 0x3A, 0xF0, 0xC3, 0xBB, 0xC4, 0x10, 0x3E, 0x44, 0x3A, 0xE8, 0xBF, 0xBB, 0xC6, 0x20,
+0x43, 0x44, 0x37, 0xD7, 0xBB, 0xBB, 0xCD, 0x30, 0x44, 0x44, 0x2A, 0xC7, 0xBB, 0xBB, 0xE3, 0x41,
+0x44, 0x41, 0xE3, 0xBB, 0xBB, 0xC8, 0x31, 0x44, 0x44, 0x28, 0xC0, 0xBB, 0xBB, 0x1A, 0x44, 0x44,
+0x38, 0xC9, 0xBB, 0xBB, 0xE4, 0x44, 0x44, 0x40, 0xD0, 0xBB, 0xBB, 0xDB, 0x44, 0x44, 0x42, 0xCF,
+0xBB, 0xBB, 0xDF, 0x44, 0x44, 0x3F, 0xC8, 0xBB, 0xBB, 0x0B, 0x44, 0x44, 0x36, 0xBD, 0xBB, 0xBB,
+0x2E, 0x44, 0x44, 0x17, 0xBB, 0xBB, 0xCA, 0x44, 0x44, 0x44, 0xC7, 0xBB, 0xBB, 0x22, 0x44, 0x44,
+0x1D, 0xBB, 0xBB, 0xCF, 0x44, 0x44, 0x3E, 0xBB, 0xBB, 0xBB, 0x3E, 0x44, 0x44, 0xCA, 0xBB, 0xBB,
+0x2E, 0x44, 0x44, 0xD8, 0xBB, 0xBB, 0x1F, 0x44, 0x44, 0xE3, 0xBB, 0xBB, 0x20, 0x44, 0x44, 0xDE,
+0xBB, 0xBB, 0x2C, 0x44, 0x44, 0xCD, 0xBB, 0xBB, 0x3B, 0x44, 0x44, 0xBC, 0xBB, 0xC1, 0x44, 0x44,
+0x31, 0xBB, 0xBB, 0xEC, 0x44, 0x44, 0xD5, 0xBB, 0xBB, 0x3F, 0x44, 0x3B, 0xBB, 0xBB, 0xE1, 0x44,
+0x44, 0xD0, 0xBB, 0xBD, 0x44, 0x44, 0x29, 0xBB, 0xBB, 0x30, 0x44, 0x3E, 0xBB, 0xBB, 0xED, 0x44,
+0x44, 0xC2, 0xBB, 0xD8, 0x44, 0x44, 0xCC, 0xBB, 0xCF, 0x44, 0x44, 0xCF, 0xBB, 0xD0, 0x44, 0x44,
+0xCE, 0xBB, 0xD6, 0x44, 0x44, 0xCA, 0xBB, 0xE8, 0x44, 0x3A, 0xC2, 0xBB, 0x20, 0x44, 0x29, 0xBD,
+0xC4, 0x35, 0x43, 0xE6, 0xBD, 0xD7, 0x3D, 0x36, 0xCE, 0xC3, 0x1F, 0x3D, 0x1B, 0xC7, 0xD5, 0x32,
+0x31, 0xD8, 0xCC, 0x19, 0x31, 0x12, 0xD2, 0xE2, 0x29, 0x22, 0xDC, 0xDD, 0x19, 0x1F, 0xEE, 0xE7,
+0x07, 0x16, 0x04, 0xF3, 0x09, 0xEA, 0xF0, 0x19, 0x13, 0xE3, 0xE5, 0x21, 0x23, 0xDC, 0xD9, 0x25,
+0x2A, 0xD9, 0xD4, 0x28, 0x30, 0xD5, 0xCC, 0x2E, 0x36, 0xD0, 0xC8, 0x33, 0x39, 0xC8, 0xC8, 0x3C,
+0x35, 0xBF, 0xCC, 0x43, 0x30, 0xBB, 0xD9, 0x44, 0x10, 0xBB, 0x44, 0x44, 0xE4, 0x35, 0x44, 0x44,
+0x07, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x31, 0x21, 0xE9, 0xD4, 0xC8,
+0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC3, 0xCD, 0xDD, 0x14,
+0x2A, 0x37, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x31,
+0x20, 0xE8, 0xD3, 0xC7, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC1,
+0xCB, 0xDA, 0x0E, 0x29, 0x36, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3F, 0x35, 0x26, 0xF8, 0xD8, 0xCA, 0xC0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBD, 0xC6, 0xD2, 0xE6, 0x1F, 0x31, 0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x3C, 0x31, 0x20, 0xE6, 0xD2, 0xC6, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBE, 0xC7, 0xD3, 0xE9, 0x22, 0x32, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x3D, 0x32, 0x22, 0xEB, 0xD4, 0xC7, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC3,
+0xCE, 0xDF, 0x19, 0x2D, 0x39, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x3A, 0x2D,
+0x19, 0xDF, 0xCE, 0xC3, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xC4, 0xCF, 0xE1, 0x1B,
+0x2E, 0x3A, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3B, 0x30, 0x1E, 0xE4, 0xD1, 0xC5,
+0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xC9, 0xD6, 0xF1, 0x25, 0x34, 0x3E, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x42, 0x3A, 0x2E, 0x1B, 0xE1, 0xD0, 0xC5, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBF, 0xC7, 0xD3, 0xE7, 0x20, 0x30, 0x3B, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3E, 0x35,
+0x28, 0x0D, 0xDB, 0xCC, 0xC3, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xC7, 0xD3, 0xE5, 0x1E, 0x2F,
+0x3A, 0x41, 0x44, 0x44, 0x44, 0x44, 0x40, 0x39, 0x2E, 0x1D, 0xE6, 0xD3, 0xC8, 0xC1, 0xBC, 0xBB,
+0xBB, 0xBD, 0xC2, 0xCA, 0xD5, 0xE8, 0x1F, 0x2F, 0x39, 0x40, 0x43, 0x44, 0x43, 0x40, 0x3A, 0x32,
+0x24, 0xF7, 0xDA, 0xCD, 0xC5, 0xC0, 0xBE, 0xBE, 0xC0, 0xC5, 0xCC, 0xD7, 0xEC, 0x20, 0x2F, 0x38,
+0x3E, 0x40, 0x41, 0x3F, 0x3B, 0x34, 0x29, 0x17, 0xE2, 0xD3, 0xCA, 0xC5, 0xC2, 0xC1, 0xC3, 0xC7,
+0xCE, 0xD9, 0xEE, 0x20, 0x2D, 0x36, 0x3B, 0x3E, 0x3D, 0x3A, 0x35, 0x2D, 0x20, 0xF2, 0xDB, 0xD0,
+0xC9, 0xC6, 0xC5, 0xC6, 0xCA, 0xD0, 0xDB, 0xEE, 0x1D, 0x2A, 0x33, 0x37, 0x3A, 0x39, 0x36, 0x30,
+0x27, 0x17, 0xE7, 0xD9, 0xD0, 0xCC, 0xC9, 0xCA, 0xCD, 0xD2, 0xDA, 0xE9, 0x17, 0x26, 0x2E, 0x33,
+0x35, 0x34, 0x31, 0x2B, 0x22, 0x11, 0xE6, 0xDA, 0xD3, 0xD0, 0xCF, 0xD0, 0xD3, 0xD9, 0xE3, 0x08,
+0x1D, 0x27, 0x2D, 0x30, 0x30, 0x2D, 0x28, 0x20, 0x12, 0xEA, 0xDF, 0xD8, 0xD5, 0xD4, 0xD5, 0xD9,
+0xDF, 0xE9, 0x0E, 0x1C, 0x24, 0x28, 0x2A, 0x29, 0x26, 0x20, 0x17, 0xF6, 0xE7, 0xE0, 0xDC, 0xDB,
+0xDD, 0xDF, 0xE3, 0xEB, 0x08, 0x17, 0x1D, 0x22, 0x22, 0x21, 0x1E, 0x19, 0x10, 0xF4, 0xEB, 0xE6,
+0xE5, 0xE5, 0xE6, 0xE9, 0xED, 0xF5, 0x0C, 0x13, 0x16, 0x18, 0x18, 0x16, 0x12, 0x0C, 0xFC, 0xF4,
+0xF5, 0xF6, 0xFD, 0xFD, 0xFE, 0x00, 0xFD, 0x03, 0xFA, 0xF8, 0xF8, 0xF6, 0xF3, 0xF3, 0xF6, 0x07,
+0x0F, 0x14, 0x17, 0x19, 0x17, 0x14, 0x0F, 0xF9, 0xEE, 0xE9, 0xE6, 0xE5, 0xE5, 0xE7, 0xED, 0x05,
+0x14, 0x1B, 0x20, 0x22, 0x21, 0x1D, 0x15, 0xF8, 0xE8, 0xE1, 0xDD, 0xDD, 0xDD, 0xE2, 0xEA, 0x0D,
+0x1C, 0x23, 0x27, 0x28, 0x26, 0x1F, 0x14, 0xEC, 0xDF, 0xD9, 0xD6, 0xD6, 0xDA, 0xE2, 0xF3, 0x1B,
+0x26, 0x2C, 0x2D, 0x2C, 0x26, 0x1A, 0xEE, 0xDD, 0xD5, 0xD1, 0xD1, 0xD5, 0xDE, 0xF1, 0x1D, 0x2A,
+0x30, 0x32, 0x30, 0x28, 0x1A, 0xE8, 0xD8, 0xD0, 0xCD, 0xCE, 0xD3, 0xDF, 0x0F, 0x25, 0x30, 0x34,
+0x35, 0x30, 0x25, 0x0B, 0xDC, 0xD0, 0xCA, 0xC9, 0xCD, 0xD7, 0xEC, 0x22, 0x30, 0x37, 0x38, 0x35,
+0x2B, 0x16, 0xDE, 0xCF, 0xC8, 0xC7, 0xCA, 0xD3, 0xE8, 0x22, 0x32, 0x39, 0x3B, 0x37, 0x2C, 0x15,
+0xDB, 0xCC, 0xC5, 0xC4, 0xC9, 0xD4, 0xF2, 0x28, 0x36, 0x3C, 0x3C, 0x36, 0x29, 0xF0, 0xD3, 0xC6,
+0xC2, 0xC3, 0xCA, 0xDB, 0x1B, 0x32, 0x3C, 0x3F, 0x3C, 0x32, 0x1C, 0xDA, 0xC9, 0xC1, 0xC1, 0xC5,
+0xD3, 0x09, 0x2E, 0x3B, 0x3E, 0x3E, 0x36, 0x24, 0xDF, 0xCA, 0xC1, 0xC1, 0xC3, 0xD0, 0xF2, 0x2D,
+0x3C, 0x3E, 0x3E, 0x38, 0x25, 0xDE, 0xC9, 0xC1, 0xC1, 0xC2, 0xCF, 0x04, 0x30, 0x3D, 0x3D, 0x3D,
+0x37, 0x21, 0xD9, 0xC5, 0xC2, 0xC2, 0xC3, 0xD4, 0x1A, 0x36, 0x3D, 0x3D, 0x3D, 0x32, 0x0D, 0xCF,
+0xC2, 0xC2, 0xC2, 0xC8, 0xE1, 0x2A, 0x3D, 0x3D, 0x3C, 0x3C, 0x27, 0xDC, 0xC5, 0xC3, 0xC3, 0xC3,
+0xD2, 0x1C, 0x38, 0x3C, 0x3C, 0x3C, 0x31, 0xEF, 0xCB, 0xC3, 0xC3, 0xC3, 0xCB, 0xF4, 0x32, 0x3C,
+0x3C, 0x3C, 0x37, 0x16, 0xCF, 0xC4, 0xC4, 0xC4, 0xC7, 0xE4, 0x2F, 0x3B, 0x3B, 0x3B, 0x3A, 0x1E,
+0xD2, 0xC4, 0xC4, 0xC4, 0xC5, 0xE1, 0x2D, 0x3B, 0x3B, 0x3B, 0x3A, 0x1F, 0xD2, 0xC4, 0xC4, 0xC4,
+0xC5, 0xE2, 0x2E, 0x3A, 0x3A, 0x3A, 0x39, 0x1C, 0xD0, 0xC5, 0xC5, 0xC5, 0xC7, 0xE9, 0x31, 0x3A,
+0x3A, 0x3A, 0x36, 0x0F, 0xCB, 0xC5, 0xC5, 0xC5, 0xCB, 0x0D, 0x37, 0x39, 0x39, 0x39, 0x31, 0xE6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xD3, 0x22, 0x39, 0x39, 0x39, 0x39, 0x27, 0xD7, 0xC6, 0xC6, 0xC6, 0xC6,
+0xDF, 0x2E, 0x39, 0x39, 0x39, 0x38, 0x14, 0xCC, 0xC7, 0xC7, 0xC7, 0xCC, 0x14, 0x38, 0x38, 0x38,
+0x38, 0x2D, 0xDF, 0xC7, 0xC7, 0xC7, 0xC7, 0xD9, 0x29, 0x38, 0x38, 0x38, 0x38, 0x1B, 0xCF, 0xC8,
+0xC8, 0xC8, 0xCB, 0x0D, 0x36, 0x37, 0x37, 0x37, 0x2E, 0xDF, 0xC8, 0xC8, 0xC8, 0xC8, 0xDA, 0x2A,
+0x37, 0x37, 0x37, 0x37, 0x17, 0xCE, 0xC8, 0xC8, 0xC9, 0xCD, 0x15, 0x36, 0x36, 0x36, 0x36, 0x2A,
+0xDB, 0xC9, 0xC9, 0xC9, 0xC9, 0xE0, 0x2E, 0x36, 0x36, 0x36, 0x34, 0xF7, 0xCA, 0xC9, 0xC9, 0xC9,
+0xD2, 0x20, 0x35, 0x35, 0x35, 0x35, 0x22, 0xD4, 0xCA, 0xCA, 0xCA, 0xCA, 0xF4, 0x33, 0x35, 0x35,
+0x35, 0x2D, 0xE1, 0xCA, 0xCA, 0xCA, 0xCA, 0xDC, 0x2A, 0x34, 0x34, 0x34, 0x34, 0x0F, 0xCC, 0xCB,
+0xCB, 0xCB, 0xD2, 0x1E, 0x34, 0x34, 0x34, 0x34, 0x22, 0xD5, 0xCB, 0xCB, 0xCB, 0xCB, 0xF2, 0x32,
+0x34, 0x33, 0x33, 0x2C, 0xE1, 0xCC, 0xCC, 0xCC, 0xCC, 0xDF, 0x2B, 0x33, 0x33, 0x33, 0x33, 0x00,
+0xCC, 0xCC, 0xCC, 0xCC, 0xD5, 0x20, 0x33, 0x33, 0x32, 0x32, 0x1E, 0xD4, 0xCD, 0xCD, 0xCD, 0xCE,
+0x0C, 0x32, 0x32, 0x32, 0x32, 0x29, 0xDE, 0xCD, 0xCD, 0xCD, 0xCD, 0xE4, 0x2C, 0x32, 0x31, 0x31,
+0x30, 0xEE, 0xCE, 0xCE, 0xCE, 0xCE, 0xD8, 0x23, 0x31, 0x31, 0x31, 0x31, 0x19, 0xD3, 0xCE, 0xCE,
+0xCE, 0xD1, 0x14, 0x31, 0x31, 0x30, 0x30, 0x25, 0xDB, 0xCF, 0xCF, 0xCF, 0xCF, 0xE9, 0x2D, 0x30,
+0x30, 0x30, 0x2C, 0xE8, 0xCF, 0xCF, 0xCF, 0xCF, 0xDC, 0x25, 0x2F, 0x2F, 0x2F, 0x2F, 0x13, 0xD2,
+0xD0, 0xD0, 0xD0, 0xD4, 0x18, 0x2F, 0x2F, 0x2F, 0x2F, 0x20, 0xD9, 0xD0, 0xD0, 0xD0, 0xD0, 0xF2,
+0x2E, 0x2E, 0x2E, 0x2E, 0x29, 0xE4, 0xD1, 0xD1, 0xD1, 0xD1, 0xE2, 0x27, 0x2E, 0x2E, 0x2E, 0x2E,
+0xF6, 0xD1, 0xD1, 0xD2, 0xD2, 0xDA, 0x1F, 0x2D, 0x2D, 0x2D, 0x2D, 0x18, 0xD6, 0xD2, 0xD2, 0xD2,
+0xD4, 0x12, 0x2D, 0x2D, 0x2D, 0x2D, 0x22, 0xDE, 0xD3, 0xD3, 0xD3, 0xD3, 0xEB, 0x2A, 0x2C, 0x2C,
+0x2C, 0x28, 0xE8, 0xD3, 0xD3, 0xD3, 0xD3, 0xE1, 0x24, 0x2C, 0x2C, 0x2B, 0x2B, 0x09, 0xD4, 0xD4,
+0xD4, 0xD4, 0xDB, 0x1B, 0x2B, 0x2B, 0x2B, 0x2B, 0x18, 0xD9, 0xD4, 0xD4, 0xD4, 0xD6, 0x11, 0x2A,
+0x2A, 0x2A, 0x2A, 0x20, 0xDF, 0xD5, 0xD5, 0xD5, 0xD5, 0xF2, 0x2A, 0x2A, 0x2A, 0x2A, 0x24, 0xE5,
+0xD6, 0xD6, 0xD6, 0xD6, 0xE7, 0x25, 0x29, 0x29, 0x29, 0x28, 0xEE, 0xD6, 0xD6, 0xD6, 0xD6, 0xE2,
+0x21, 0x29, 0x28, 0x28, 0x28, 0x07, 0xD7, 0xD7, 0xD7, 0xD7, 0xDE, 0x1C, 0x28, 0x28, 0x28, 0x28,
+0x11, 0xD9, 0xD7, 0xD8, 0xD8, 0xDC, 0x17, 0x27, 0x27, 0x27, 0x27, 0x17, 0xDC, 0xD8, 0xD8, 0xD8,
+0xDA, 0x13, 0x27, 0x27, 0x26, 0x26, 0x19, 0xDE, 0xD9, 0xD9, 0xD9, 0xDA, 0x0F, 0x26, 0x26, 0x26,
+0x26, 0x1A, 0xDF, 0xD9, 0xDA, 0xDA, 0xDA, 0x0F, 0x25, 0x25, 0x25, 0x25, 0x19, 0xE0, 0xDA, 0xDA,
+0xDA, 0xDC, 0x10, 0x25, 0x24, 0x24, 0x24, 0x17, 0xDF, 0xDB, 0xDB, 0xDB, 0xDD, 0x13, 0x24, 0x24,
+0x24, 0x24, 0x14, 0xDE, 0xDC, 0xDC, 0xDC, 0xE0, 0x17, 0x23, 0x23, 0x23, 0x23, 0x0C, 0xDC, 0xDC,
+0xDC, 0xDC, 0xE5, 0x1A, 0x22, 0x22, 0x22, 0x22, 0xF2, 0xDD, 0xDD, 0xDD, 0xDD, 0xEC, 0x1F, 0x22,
+0x21, 0x21, 0x1D, 0xE9, 0xDE, 0xDE, 0xDE, 0xDE, 0x07, 0x21, 0x21, 0x21, 0x21, 0x14, 0xE2, 0xDF,
+0xDF, 0xDF, 0xE3, 0x16, 0x20, 0x20, 0x20, 0x20, 0xF5, 0xDF, 0xDF, 0xE0, 0xE0, 0xEF, 0x1D, 0x1F,
+0x1F, 0x1F, 0x17, 0xE7, 0xE0, 0xE0, 0xE0, 0xE3, 0x12, 0x1E, 0x1E, 0x1E, 0x1E, 0xF9, 0xE1, 0xE1,
+0xE1, 0xE1, 0xF1, 0x1C, 0x1E, 0x1D, 0x1D, 0x14, 0xE7, 0xE2, 0xE2, 0xE2, 0xE8, 0x14, 0x1D, 0x1D,
+0x1D, 0x1A, 0xF0, 0xE3, 0xE3, 0xE3, 0xE4, 0x0B, 0x1C, 0x1C, 0x1C, 0x1C, 0x06, 0xE4, 0xE4, 0xE4,
+0xE4, 0xF4, 0x1A, 0x1B, 0x1B, 0x1B, 0x0E, 0xE7, 0xE5, 0xE5, 0xE5, 0xF0, 0x17, 0x1A, 0x1A, 0x1A,
+0x10, 0xEA, 0xE6, 0xE6, 0xE6, 0xEF, 0x14, 0x19, 0x19, 0x19, 0x10, 0xEB, 0xE7, 0xE7, 0xE7, 0xF0,
+0x13, 0x18, 0x18, 0x18, 0x0F, 0xEC, 0xE8, 0xE8, 0xE8, 0xF2, 0x13, 0x17, 0x17, 0x17, 0x0B, 0xEC,
+0xE9, 0xE9, 0xE9, 0xF8, 0x14, 0x16, 0x15, 0x14, 0xFD, 0xEB, 0xEA, 0xEA, 0xED, 0x09, 0x14, 0x14,
+0x14, 0x10, 0xF4, 0xEB, 0xEB, 0xEB, 0xF2, 0x0E, 0x13, 0x13, 0x13, 0x09, 0xF0, 0xED, 0xED, 0xEF,
+0x01, 0x10, 0x12, 0x12, 0x0E, 0xF7, 0xEE, 0xEE, 0xEE, 0xF5, 0x0B, 0x10, 0x10, 0x0F, 0x06, 0xF2,
+0xF0, 0xF0, 0xF3, 0x06, 0x0D, 0x0F, 0x0E, 0x08, 0xF6, 0xF2, 0xF1, 0xF4, 0xFC, 0x0A, 0x0D, 0x0C,
+0x08, 0xF9, 0xF5, 0xF4, 0xF5, 0xFB, 0x08, 0x0A, 0x0A, 0x07, 0xFB, 0xF7, 0xF7, 0xF8, 0xFC, 0x05,
+0x07, 0x06, 0x04, 0xFD, 0xFB, 0xFB, 0xFC, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xE8, 0x04,
+0x11, 0x12, 0x10, 0x0D, 0x09, 0x05, 0xFC, 0xFA, 0xFA, 0xFB, 0xFC, 0xFD, 0xFF, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xD8, 0xE0, 0xEA,
+0xF9, 0x0D, 0x0E, 0x0D, 0x0B, 0x07, 0x03, 0xFC, 0xFB, 0xFB, 0xFC, 0xFD, 0xFE, 0x00, 0x01, 0x01,
+0x01, 0x01, 0xFD, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFE, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF6, 0xF9, 0xFD, 0x03, 0x04, 0x03,
+0x02, 0x02, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0x00, 0x01, 0x01, 0x00, 0x01, 0xFE, 0xFE, 0xFE, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xF6, 0xF9, 0xFC, 0x02, 0x03, 0x03,
+0x02, 0x01, 0xFF, 0xFE, 0xFE, 0x11, 0x04, 0xF3, 0xF2, 0xF5, 0xF9, 0x03, 0x05, 0x05, 0x04, 0x02,
+0xFE, 0xFD, 0xFD, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFE, 0xFE, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0xFD, 0x12, 0x09, 0xF5, 0xF0, 0xF3, 0xF8, 0x04, 0x06, 0x06, 0x04, 0x01,
+0xFD, 0xFD, 0xFD, 0xFE, 0x00, 0x01, 0xFA, 0xFC, 0x01, 0x02, 0x02, 0x02, 0x01, 0xFE, 0x01, 0x01,
+0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x03, 0xF6, 0xF9, 0x01, 0x04, 0x04, 0x03, 0x01, 0xFE,
+0xFD, 0xFE, 0xFE, 0x00, 0x01, 0x00, 0xFA, 0xFC, 0xFE, 0xCC, 0xD3, 0xE0, 0xF8, 0x15, 0x15, 0x0F,
+0x04, 0xDE, 0x12, 0x1E, 0x1C, 0x12, 0xF7, 0xF1, 0xEF, 0xF4, 0x04, 0x08, 0x07, 0x05, 0xFD, 0xFB,
+0xFC, 0xFD, 0x01, 0x02, 0x01, 0x00, 0xFF, 0xFE, 0xFF, 0xD0, 0xD4, 0xDE, 0xF1, 0x12, 0x14, 0x10,
+0x09, 0xDA, 0xFB, 0x1C, 0x1C, 0x14, 0x02, 0xF3, 0xEF, 0xF4, 0xFE, 0x07, 0x07, 0x05, 0xFF, 0xFC,
+0xFC, 0xFD, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
+0x03, 0x02, 0xFE, 0xFD, 0xFE, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xFE, 0xFF, 0x00,
+0xCA, 0xD3, 0xE5, 0x13, 0x18, 0x13, 0x04, 0xF3, 0xF3, 0xF8, 0x05, 0x07, 0x05, 0xFF, 0xFC, 0xFC,
+0xFE, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x01,
+0xCD, 0xD3, 0xE2, 0x0F, 0x18, 0x13, 0x08, 0xF4, 0xF3, 0xF8, 0x0B, 0xFC, 0xF9, 0xFB, 0x01, 0x03,
+0x02, 0xFD, 0xFD, 0xFE, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xE4, 0xEC, 0x03, 0x0D, 0x0B, 0x04,
+0xF8, 0xF7, 0xFE, 0x04, 0x04, 0x02, 0xFD, 0xF8, 0x09, 0x06, 0x0B, 0xF7, 0xF7, 0xF9, 0x05, 0x05,
+0x03, 0xFB, 0xFC, 0xFD, 0x01, 0x02, 0x01, 0xFF, 0xFE, 0xFF, 0xE5, 0xEB, 0xF9, 0x2B, 0xCC, 0xDB,
+0x17, 0x1F, 0x16, 0xF3, 0xED, 0xF2, 0x06, 0x06, 0x0B, 0x06, 0xF9, 0xF9, 0xFB, 0xFE, 0x05, 0x03,
+0xFD, 0xFC, 0xFD, 0xFE, 0x01, 0x01, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xCC, 0xD8,
+0x12, 0x1F, 0x18, 0xF7, 0xED, 0xF1, 0x04, 0x0A, 0x08, 0xFE, 0xF9, 0xFB, 0x00, 0xFB, 0x09, 0x03,
+0xF9, 0xFA, 0xFE, 0x03, 0x03, 0x0C, 0x08, 0xFB, 0xF9, 0xFB, 0x03, 0x04, 0x02, 0xFD, 0xFD, 0xFE,
+0xFF, 0x01, 0x00, 0xFF, 0xF1, 0xFB, 0x07, 0x06, 0xFE, 0xFB, 0xFC, 0x01, 0x02, 0xF9, 0x09, 0x04,
+0xFA, 0xFA, 0xFD, 0x03, 0x03, 0x0B, 0x09, 0xFD, 0xF9, 0xFA, 0x02, 0x03, 0xE2, 0xF4, 0x0F, 0x0D,
+0xFB, 0xF6, 0xF8, 0x04, 0xF3, 0xFB, 0x06, 0x05, 0xFD, 0xFC, 0xFD, 0x01, 0x02, 0x01, 0x01, 0x06,
+0xF6, 0xFC, 0x06, 0x05, 0xFD, 0xFB, 0xFD, 0x02, 0xFB, 0xFC, 0x01, 0x02, 0xE2, 0xF2, 0x0F, 0x0E,
+0x02, 0xF6, 0xF8, 0x03, 0x05, 0x03, 0xFC, 0xFC, 0xFD, 0x02, 0x02, 0x00, 0xFE, 0xFE, 0xD3, 0xD4,
+0xE9, 0x1A, 0x17, 0xF7, 0xEE, 0xF4, 0x09, 0x09, 0xFB, 0xF8, 0xFB, 0x04, 0x04, 0xFE, 0xFD, 0xFE,
+0xFA, 0xFC, 0x02, 0x02, 0x01, 0x0B, 0xF7, 0xF8, 0x03, 0x05, 0x03, 0xFC, 0xFC, 0x00, 0xD8, 0xD1,
+0xF1, 0x19, 0x13, 0xF3, 0xF0, 0xF8, 0x09, 0x08, 0xFD, 0xF6, 0xF6, 0xFB, 0x06, 0xFC, 0xFE, 0xFE,
+0xFA, 0xFB, 0x01, 0x02, 0x01, 0x0B, 0xF8, 0xF8, 0x02, 0x05, 0x18, 0x30, 0x21, 0xE5, 0xE4, 0xED,
+0x1B, 0x0F, 0xEE, 0xF0, 0x07, 0x0B, 0x05, 0xF8, 0xF9, 0xFA, 0xF8, 0xFA, 0x03, 0xFC, 0x02, 0x01,
+0xFA, 0x03, 0x02, 0xFE, 0xFD, 0xFF, 0x01, 0xF4, 0xF7, 0x07, 0xF5, 0x2E, 0x23, 0xE8, 0xE3, 0xF6,
+0x12, 0x0D, 0xF5, 0xE0, 0x0A, 0x12, 0x08, 0xF3, 0xF6, 0x07, 0x07, 0xFC, 0xFA, 0xFD, 0x0A, 0xF7,
+0xF8, 0x06, 0x05, 0xFC, 0xFB, 0xFC, 0x02, 0xF4, 0xF7, 0x04, 0x06, 0x02, 0xFC, 0xFD, 0x02, 0x02,
+0xFF, 0xFE, 0xFF, 0xC8, 0xD4, 0x17, 0x1F, 0x04, 0xEA, 0x3C, 0xE0, 0xDD, 0x11, 0x19, 0x0C, 0xEC,
+0xF4, 0x0C, 0x0A, 0xF7, 0xF8, 0x01, 0x04, 0x02, 0xFD, 0xFD, 0x02, 0x02, 0xFF, 0xFE, 0xFE, 0x01,
+0x00, 0xFF, 0xFF, 0xD3, 0xD4, 0x06, 0x1D, 0x0F, 0xEC, 0x3D, 0xE4, 0xDC, 0x0C, 0x19, 0x0B, 0xEE,
+0xF4, 0x0A, 0x09, 0xF8, 0xF9, 0x03, 0xD1, 0x2C, 0x10, 0xDF, 0xEC, 0x15, 0x0F, 0xF2, 0xF3, 0x07,
+0x09, 0xFC, 0xF9, 0xFE, 0x04, 0x02, 0xFC, 0xFE, 0x01, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0xCD, 0x2B, 0x16, 0xE0, 0xEA, 0x13, 0x11, 0xF3, 0xF3, 0x06,
+0x09, 0xFD, 0xF9, 0xF9, 0x05, 0x04, 0xFC, 0xFC, 0x02, 0x02, 0xFE, 0xFE, 0x00, 0x01, 0x00, 0xFF,
+0xFF, 0x00, 0x00, 0xFF, 0x01, 0x05, 0x08, 0x03, 0xFA, 0xFE, 0x03, 0x01, 0xFD, 0xFE, 0x01, 0x01,
+0xFE, 0xFF, 0x00, 0xF9, 0x02, 0x03, 0xFE, 0xFD, 0x01, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF,
+0xFF, 0x00, 0x00, 0xFF, 0x02, 0x03, 0x08, 0x04, 0xFA, 0xE2, 0x0F, 0x10, 0xF4, 0xF4, 0x08, 0x08,
+0xFA, 0xFA, 0x03, 0x03, 0xFD, 0xFD, 0x01, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x01,
+0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xE2, 0x0B, 0x11, 0xF3, 0xF2, 0x08, 0x09,
+0xFA, 0xF9, 0x03, 0x04, 0xFD, 0xFC, 0x01, 0x02, 0xFE, 0xFA, 0xFE, 0x03, 0xFE, 0xFD, 0x02, 0x02,
+0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x01, 0x00, 0xFF, 0xF9, 0x08, 0xF9, 0xF9, 0x04, 0x04,
+0xFC, 0xFD, 0x02, 0x02, 0xFE, 0xFE, 0x01, 0x00, 0xFF, 0xFA, 0xFD, 0x03, 0x00, 0x38, 0x30, 0xDE,
+0xE2, 0x19, 0x12, 0xED, 0xF4, 0x0D, 0x06, 0xF6, 0xFD, 0x06, 0xFD, 0xFB, 0x02, 0x03, 0xFE, 0xFD,
+0x01, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x33, 0x31, 0xE1,
+0xE0, 0x18, 0x14, 0xED, 0xF3, 0x0D, 0x07, 0xF6, 0xFB, 0x06, 0x01, 0xFB, 0x01, 0x03, 0xFE, 0xFD,
+0x01, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFB, 0xFC, 0x02, 0x01, 0xFD, 0xFF, 0x01, 0xFF, 0xFE, 0x00, 0x00,
+0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xF4, 0x08, 0xFD,
+0xF9, 0x03, 0x04, 0xFC, 0xFD, 0xFC, 0xFC, 0x02, 0x02, 0xFE, 0xFE, 0x01, 0x00, 0xFE, 0x00, 0x01,
+0xFE, 0x01, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF3, 0x08, 0x02,
+0xF9, 0x02, 0x04, 0xFC, 0xFD, 0x02, 0x01, 0xFE, 0xE1, 0x0F, 0x0C, 0xF1, 0xFB, 0x0A, 0xFA, 0xF9,
+0x05, 0x03, 0xFB, 0xFF, 0x02, 0xFE, 0xFE, 0x01, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0xFF,
+0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE1, 0x0E, 0x10, 0xF4, 0xF6, 0x09, 0x02, 0xF8,
+0x03, 0x04, 0xFC, 0xFD, 0x02, 0xFF, 0xFE, 0xFF, 0xFD, 0xFB, 0x02, 0x02, 0xFD, 0xFD, 0x02, 0x02,
+0xFD, 0x01, 0x01, 0xFE, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x08, 0x08, 0xF9, 0xFB, 0x05, 0xFE,
+0xFC, 0x02, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0xFE, 0xBF, 0x14, 0x20, 0xE2, 0xF2, 0x15, 0xF3,
+0xF2, 0x0C, 0x2F, 0x25, 0xDE, 0xFC, 0x1A, 0xEE, 0xF3, 0x0F, 0xF9, 0xF6, 0x07, 0x04, 0xF9, 0x03,
+0x03, 0xFC, 0xFE, 0x02, 0xFE, 0xFE, 0x01, 0xFF, 0xFF, 0xBF, 0x0C, 0x21, 0xE3, 0xEF, 0x15, 0xF5,
+0xF2, 0x0C, 0x2C, 0x27, 0xDF, 0xF3, 0x1A, 0xEF, 0xF1, 0x0E, 0xFC, 0xF5, 0x07, 0x05, 0xF9, 0x02,
+0x03, 0xFC, 0xFE, 0x02, 0xFE, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0xFC, 0x03, 0x00,
+0xFD, 0x01, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xFE, 0x01, 0xC5, 0x29, 0xE3, 0xE4, 0x1A,
+0xF7, 0xEE, 0x0E, 0x06, 0xF5, 0x07, 0x05, 0xF9, 0x03, 0x03, 0xFC, 0x01, 0x02, 0xFE, 0xFF, 0x01,
+0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0x01, 0xFE, 0x00, 0x00, 0xC3, 0x29, 0xE6, 0xE2, 0x19,
+0x01, 0xED, 0x0D, 0x07, 0x05, 0xFA, 0x08, 0xFC, 0xFA, 0x04, 0xFE, 0xFC, 0x02, 0x01, 0xFD, 0x01,
+0x01, 0xFE, 0xFF, 0xF5, 0xF5, 0xEB, 0x0D, 0x07, 0xF4, 0x07, 0x05, 0xF8, 0x05, 0xFE, 0xFC, 0x03,
+0x00, 0xF4, 0xF9, 0x07, 0x0B, 0xF6, 0x07, 0x02, 0xF9, 0x04, 0xFF, 0xFC, 0x01, 0x01, 0xFD, 0x01,
+0x01, 0xFE, 0x00, 0xF3, 0xFA, 0xEB, 0x2A, 0xE8, 0x31, 0xE4, 0xE8, 0x1B, 0xEF, 0xF2, 0x0F, 0xF6,
+0xF8, 0xFA, 0xF6, 0x05, 0x03, 0xFA, 0x03, 0xFB, 0xFB, 0x03, 0xFD, 0xFD, 0x02, 0xFE, 0xFE, 0x01,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x2D, 0xDF, 0x31, 0xE7, 0xE6, 0x1B, 0xF1, 0xF0, 0x0F, 0xF7,
+0xF7, 0x09, 0xFB, 0xFA, 0x05, 0xFD, 0xF2, 0x03, 0x06, 0xF9, 0x03, 0x03, 0xFC, 0x02, 0x02, 0xFD,
+0x01, 0x01, 0xFE, 0x00, 0x00, 0xF1, 0x20, 0xE6, 0x0C, 0x0F, 0xEF, 0x08, 0xFB, 0xF8, 0x04, 0xFE,
+0xFC, 0x03, 0xFE, 0xFE, 0x02, 0xFF, 0xF3, 0xFD, 0x06, 0xF9, 0x02, 0x03, 0xFC, 0x01, 0x02, 0xFD,
+0x01, 0x01, 0xE1, 0x0F, 0x03, 0xEB, 0x22, 0xE7, 0x05, 0x11, 0xEF, 0x07, 0x03, 0xF8, 0x05, 0x01,
+0xFB, 0x03, 0xFE, 0xFD, 0x02, 0x0C, 0xF7, 0x07, 0x02, 0xFA, 0x04, 0xFD, 0xFD, 0x02, 0xFC, 0xFC,
+0x03, 0xFD, 0xE1, 0x0E, 0x07, 0xF1, 0x0B, 0xFD, 0xF8, 0x06, 0xFC, 0xFC, 0x04, 0xFD, 0xFC, 0x02,
+0xFE, 0xFE, 0x01, 0xE1, 0xE9, 0xD7, 0x1F, 0xF1, 0xEC, 0x13, 0xF3, 0xF8, 0x0A, 0xF6, 0x01, 0x04,
+0xFB, 0x03, 0x02, 0xFD, 0x03, 0xFE, 0xFA, 0x02, 0x01, 0xFD, 0x02, 0x07, 0x03, 0x08, 0xF9, 0x03,
+0x03, 0xFB, 0x03, 0xDD, 0xF3, 0xD5, 0x0D, 0xF5, 0xEE, 0x0E, 0xF8, 0xF7, 0x09, 0xF9, 0xFC, 0xFC,
+0xF9, 0xF7, 0x07, 0xFB, 0xFA, 0x05, 0xF8, 0x00, 0x03, 0xFC, 0x02, 0x07, 0xFC, 0x09, 0xF9, 0x02,
+0x03, 0x37, 0xDD, 0x31, 0xE0, 0xF4, 0xF2, 0xE8, 0x12, 0xF4, 0xF6, 0x0B, 0xF7, 0x03, 0x05, 0xF7,
+0x01, 0xF7, 0x06, 0xFD, 0xF9, 0x05, 0xFB, 0xFD, 0xFB, 0x02, 0xFC, 0x01, 0x01, 0xFE, 0x01, 0xF2,
+0x07, 0x3B, 0xD9, 0x31, 0xE3, 0xEF, 0x19, 0xEA, 0x0B, 0x0B, 0xF3, 0x08, 0xE9, 0xF0, 0x10, 0xF1,
+0x07, 0x06, 0xF7, 0x06, 0xFC, 0xFC, 0x03, 0x06, 0xFD, 0x09, 0xF8, 0x04, 0x03, 0xF8, 0x05, 0xF1,
+0x06, 0xFE, 0xF9, 0x05, 0xFD, 0xFD, 0x03, 0xFD, 0x01, 0x01, 0xFE, 0xF7, 0xEB, 0xDF, 0xE2, 0xD7,
+0x21, 0xE7, 0xF9, 0x11, 0xEF, 0x0C, 0xFD, 0xFD, 0x08, 0x06, 0x37, 0xDD, 0x2A, 0xE6, 0xF7, 0x14,
+0xEC, 0x0D, 0xFD, 0xF6, 0x09, 0xF9, 0x02, 0x04, 0xFB, 0x03, 0xFE, 0xFE, 0x01, 0xDE, 0xE5, 0xD7,
+0x21, 0xE7, 0xF8, 0x11, 0xEF, 0x0B, 0xFF, 0xF7, 0x07, 0xFA, 0x3A, 0xDB, 0x29, 0xE9, 0xF2, 0x15,
+0xED, 0x0C, 0x05, 0xF6, 0x09, 0xF9, 0xFE, 0xBF, 0x1C, 0xF5, 0xE5, 0x19, 0xEC, 0x09, 0x0A, 0xF4,
+0x0A, 0xF9, 0xFC, 0x05, 0xFB, 0x03, 0xFE, 0xFD, 0x02, 0xFE, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x18, 0x09, 0xE3, 0x19, 0xED, 0x06, 0x0B, 0xF3,
+0x09, 0xFA, 0xFC, 0x05, 0xFB, 0x03, 0x00, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xFA,
+0x01, 0x01, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+0x00, 0xFF, 0x01, 0x05, 0x09, 0x06, 0xF9, 0x06, 0xFB, 0x02, 0x02, 0xFD, 0x02, 0xFE, 0xFF, 0xFA,
+0xFE, 0x02, 0xFD, 0x02, 0xFD, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+0x00, 0xFF, 0x00, 0x06, 0x08, 0x07, 0xF9, 0x06, 0xFB, 0x01, 0xE1, 0x11, 0xED, 0x09, 0x03, 0xF7,
+0x08, 0xF8, 0x04, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x02, 0xFF,
+0xFF, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xF6, 0xE1, 0x10, 0xEF, 0x06, 0x06, 0xF6,
+0x08, 0xF9, 0x03, 0x02, 0xFC, 0x03, 0xFC, 0xFC, 0xFD, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0xFE, 0x00,
+0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xF5, 0x02, 0xF7, 0x06, 0xFA, 0x0D, 0x14,
+0x0E, 0xF2, 0x0E, 0xF4, 0x08, 0xFC, 0xFB, 0x03, 0xFA, 0x04, 0xFC, 0x02, 0x00, 0xFE, 0xFE, 0xFE,
+0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0F, 0x13,
+0x0F, 0xF2, 0x0E, 0xF5, 0x07, 0xFD, 0xFB, 0x05, 0xFB, 0x03, 0xFD, 0xFF, 0x01, 0xFE, 0x01, 0xFE,
+0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0xFA, 0x00, 0x00, 0xFD, 0x02, 0xFE, 0x01, 0x02, 0xFE,
+0x01, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+0xFF, 0x00, 0x04, 0x0A, 0x03, 0xFC, 0x05, 0xF9, 0x04, 0xFD, 0xFE, 0x02, 0xFD, 0x02, 0xFE, 0x01,
+0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+0xFF, 0x00, 0x04, 0x0A, 0x04, 0xFB, 0x05, 0xFB, 0xE2, 0x0E, 0xF2, 0xFB, 0x07, 0xF7, 0x07, 0xF9,
+0x05, 0xFC, 0x01, 0x00, 0xFD, 0x01, 0xFE, 0x01, 0x02, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFF,
+0xFF, 0x00, 0xF2, 0x07, 0xF8, 0x04, 0xFD, 0xFD, 0xE2, 0x0D, 0xF3, 0xF9, 0x08, 0xF5, 0x08, 0xF9,
+0x04, 0xFD, 0xFE, 0x01, 0xFD, 0x02, 0xFD, 0x01, 0x01, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFF,
+0xFF, 0x00, 0xF2, 0x07, 0xF8, 0x03, 0xFE, 0x44, 0xD6, 0x30, 0xDE, 0x1B, 0xF0, 0xFD, 0x0B, 0xF3,
+0x0B, 0xF5, 0x08, 0xF9, 0x04, 0xFD, 0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0xFF,
+0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x44, 0xD5, 0x30, 0xDF, 0x19, 0xF2, 0xF9, 0x0C, 0xF2,
+0x0C, 0xF5, 0x08, 0xFA, 0x04, 0xFE, 0xFD, 0x02, 0xFD, 0x02, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFE,
+0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0x00, 0xFF,
+0x00, 0xFD, 0x01, 0x02, 0xFE, 0x01, 0xFF, 0xFE, 0xFA, 0x01, 0xFD, 0xFE, 0x01, 0xFE, 0x01, 0xFE,
+0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFE, 0xFE, 0xFA, 0xF4, 0xFF, 0xFC,
+0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0xFE, 0xFA, 0x01, 0xFE, 0x02, 0x01, 0xFF, 0x01, 0xFF,
+0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF9, 0xF5, 0xE0, 0x10,
+0xEC, 0x0D, 0xF3, 0x08, 0xF9, 0x04, 0xFE, 0xFD, 0x02, 0xFD, 0x02, 0x01, 0x01, 0x00, 0xFD, 0x01,
+0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x05, 0x07, 0xFB, 0x05, 0xFB, 0x04, 0xE0, 0x10,
+0xEC, 0x0D, 0xF3, 0x08, 0xF9, 0x03, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFE, 0xFD, 0x01,
+0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0B, 0x04, 0x07, 0xFA, 0xE6, 0xC8, 0x11, 0xE6, 0xF9,
+0x05, 0xF3, 0x0A, 0xF4, 0x0A, 0xF6, 0x07, 0xF9, 0x05, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x01, 0xFC,
+0xFB, 0xFE, 0xFE, 0xFE, 0x01, 0x0D, 0xFA, 0x08, 0xFA, 0x05, 0xFB, 0xE2, 0xCA, 0x09, 0xE9, 0xEF,
+0xE7, 0xF4, 0xFE, 0xF4, 0x0A, 0xF5, 0x08, 0xF8, 0x06, 0xF1, 0x07, 0xF7, 0x05, 0xF8, 0x04, 0xFA,
+0xFC, 0xFC, 0x01, 0xFD, 0x01, 0x0D, 0xFA, 0x08, 0x29, 0x3A, 0x0C, 0x19, 0x0D, 0xF7, 0x0E, 0xED,
+0xE9, 0xF6, 0xF9, 0xF6, 0x07, 0xF8, 0x07, 0xF9, 0x04, 0xF2, 0x07, 0xF8, 0x04, 0xF8, 0x04, 0xFB,
+0x02, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x2D, 0x36, 0x14, 0x15, 0x11, 0xF3, 0x10, 0xF1,
+0x0D, 0xF4, 0x09, 0xF6, 0x07, 0xF9, 0x05, 0xFB, 0x03, 0xFD, 0x02, 0xFE, 0x01, 0xF6, 0xF7, 0xFA,
+0xFD, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0xFE, 0x01, 0xFE,
+0xEF, 0xE7, 0x02, 0xF3, 0x04, 0xF9, 0xFE, 0x00, 0xFD, 0x02, 0xFD, 0x01, 0xFD, 0xF5, 0xF8, 0xFA,
+0xFE, 0x0D, 0xF9, 0x08, 0xFA, 0x05, 0xFC, 0x03, 0xF9, 0x02, 0xFC, 0x02, 0xFE, 0x02, 0xFE, 0x01,
+0xED, 0xE8, 0xFB, 0xF4, 0xFF, 0xFB, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x01, 0xBD, 0x1A, 0xD7, 0x1A,
+0xE5, 0x17, 0xEC, 0x10, 0xF2, 0x0B, 0xF6, 0x08, 0xF7, 0x05, 0xFA, 0x04, 0xFC, 0x01, 0xFA, 0x02,
+0xFC, 0x02, 0xFD, 0x0D, 0xFA, 0x08, 0xFA, 0x05, 0xFB, 0x03, 0xFC, 0x02, 0xBD, 0x19, 0xD0, 0x1C,
+0xE1, 0x16, 0xEB, 0x0F, 0xF2, 0x0B, 0xF6, 0x06, 0xF2, 0x07, 0xF7, 0x05, 0xFA, 0xFB, 0xFA, 0xFE,
+0xFC, 0x01, 0xFD, 0x0E, 0xF9, 0x08, 0xFA, 0x05, 0xFB, 0x03, 0xFC, 0x44, 0xE9, 0x2A, 0xDC, 0x1D,
+0xE7, 0x14, 0xEF, 0x0E, 0xF4, 0x09, 0xF8, 0x03, 0xF2, 0x06, 0xF8, 0x05, 0xF9, 0xFC, 0xFD, 0xFD,
+0xF9, 0xFE, 0xFC, 0x01, 0xFD, 0x01, 0xFD, 0xF2, 0x06, 0xF7, 0x05, 0x44, 0xE5, 0x2E, 0xE4, 0x1D,
+0xEA, 0x13, 0xF0, 0xF3, 0xE5, 0x0C, 0xEF, 0x0A, 0xF4, 0x08, 0xF8, 0x05, 0xFA, 0x04, 0xFC, 0x03,
+0x0C, 0xF9, 0x08, 0xFA, 0x05, 0xFC, 0xFA, 0xF2, 0x05, 0xF7, 0x05, 0x11, 0xEB, 0x0D, 0xF2, 0x09,
+0xF7, 0x06, 0xFA, 0xED, 0xE7, 0x06, 0xF1, 0x08, 0xF6, 0x06, 0xF9, 0x04, 0xFB, 0x03, 0xFC, 0x02,
+0x0D, 0xF9, 0x08, 0xFA, 0x05, 0xFB, 0xFA, 0x0A, 0x09, 0x03, 0x05, 0x11, 0xEB, 0x0E, 0xF2, 0x0A,
+0xF6, 0x07, 0xF9, 0x04, 0xFB, 0x03, 0xFD, 0xFD, 0xFA, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x01,
+0xFE, 0x01, 0x02, 0x00, 0x01, 0xFF, 0x00, 0x0A, 0x08, 0x03, 0x05, 0xFD, 0x03, 0xFD, 0x02, 0xFD,
+0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFC, 0xFA, 0x01, 0xFC, 0x02, 0xFD, 0x01, 0xFE, 0x01,
+0xFE, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+0xFF, 0xF7, 0xBC, 0x1F, 0xD6, 0x19, 0xE5, 0x11, 0xEF, 0x0B, 0xF6, 0x06, 0xFA, 0x03, 0xFE, 0xFE,
+0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+0x00, 0xF5, 0xBD, 0x1F, 0xD6, 0x19, 0xE5, 0x12, 0xEF, 0x0B, 0xF5, 0x07, 0xFA, 0x03, 0xFD, 0x00,
+0x01, 0xFE, 0x03, 0xFD, 0x02, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xFB, 0xFB, 0x00, 0xFC,
+0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0xFF, 0x04, 0x0D, 0xF9, 0x08,
+0xFA, 0x05, 0xFD, 0x03, 0xFE, 0x01, 0x00, 0xFF, 0xFE, 0xFD, 0x01, 0xFE, 0xFB, 0xFB, 0xFF, 0xFD,
+0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0xE9, 0xE8, 0x07, 0xEF, 0x0B, 0x07, 0x06, 0x03,
+0x03, 0x02, 0x00, 0x01, 0xFE, 0x01, 0x01, 0x02, 0xFE, 0xFE, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xF6,
+0x1E, 0xF0, 0x13, 0xF3, 0x0C, 0xF8, 0x06, 0xFC, 0xE8, 0xE9, 0x05, 0xEF, 0x09, 0xF4, 0x08, 0xF8,
+0x05, 0xFA, 0x03, 0xFC, 0x02, 0xFE, 0x02, 0x02, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xF8,
+0x1E, 0xF0, 0x13, 0xF3, 0x0C, 0xF8, 0x06, 0xFB, 0x02, 0x01, 0xFD, 0x02, 0xFD, 0x02, 0xFE, 0x01,
+0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFD, 0xFA, 0x02, 0xFC,
+0x02, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0C, 0x08,
+0x04, 0x06, 0xFC, 0x05, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0xFD, 0xFE, 0xFD, 0xF9, 0x02, 0xFC,
+0x02, 0xFD, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x05, 0xEF, 0xF8, 0x0C, 0xFB,
+0x07, 0xFC, 0x04, 0xFF, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0x01, 0xFD, 0xFE, 0x00, 0xFE, 0x01, 0xF3,
+0xF8, 0xFB, 0xF9, 0x04, 0xFA, 0x03, 0xFC, 0x02, 0xFB, 0xFA, 0xE0, 0x07, 0xEE, 0xF9, 0xFA, 0xF7,
+0x05, 0xF8, 0x05, 0xFB, 0x03, 0xFD, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+0x41, 0xE4, 0x2E, 0xE5, 0x1C, 0xF1, 0x0D, 0x07, 0xF7, 0x08, 0xF7, 0x07, 0xFA, 0x04, 0xFC, 0x01,
+0xFF, 0xFD, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x37,
+0x3F, 0xE6, 0x2E, 0xE5, 0x1D, 0xF0, 0x0E, 0x05, 0xF9, 0x09, 0xF7, 0x07, 0xF9, 0x05, 0xFC, 0x02,
+0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
+0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFA, 0xFB, 0xFF, 0xFC,
+0x02, 0xFD, 0x01, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFA,
+0xF2, 0x05, 0xF7, 0xFE, 0xFC, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x01, 0xFF, 0xFA, 0xFC, 0x01, 0xFC,
+0x02, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xE0,
+0xEF, 0xF2, 0xF0, 0x07, 0xF4, 0x06, 0xF9, 0x01, 0xFE, 0xFC, 0x02, 0xFD, 0x02, 0x01, 0xFE, 0xFF,
+0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x04, 0x0E, 0xFB, 0x08, 0x03, 0x02, 0x04, 0xFC, 0x03, 0xE0,
+0xF7, 0xF0, 0xF3, 0x06, 0xF4, 0x07, 0xF8, 0x04, 0xFC, 0xFD, 0x02, 0xFD, 0x02, 0xFE, 0xFD, 0xFE,
+0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x05, 0x0D, 0xFB, 0xC9, 0xCB, 0x12, 0xD7, 0x13, 0xE8, 0xF9,
+0xFE, 0xF2, 0x09, 0xF5, 0x06, 0xFB, 0xFE, 0x03, 0xFC, 0x04, 0xFD, 0x02, 0xFC, 0xFA, 0x02, 0xFC,
+0x01, 0xFE, 0x0E, 0x05, 0x05, 0x06, 0xFB, 0x05, 0xFD, 0xC7, 0xCD, 0x10, 0xCE, 0x10, 0xE5, 0xF0,
+0x07, 0xEF, 0x0B, 0xF4, 0x06, 0xF1, 0xF8, 0xFC, 0xF8, 0xFD, 0xF9, 0x02, 0xFA, 0xFA, 0x01, 0xFB,
+0x01, 0xFD, 0x0E, 0x05, 0x38, 0x44, 0xE4, 0x2F, 0xEF, 0x16, 0x12, 0xF3, 0xE4, 0xEF, 0xF6, 0xF1,
+0x07, 0xF5, 0x04, 0xFB, 0xFC, 0xF2, 0xF9, 0xFA, 0xF9, 0xFB, 0xFA, 0x00, 0xFB, 0x00, 0xFD, 0xFE,
+0xFF, 0xFE, 0x00, 0xFE, 0x3A, 0x42, 0xE5, 0x2F, 0xED, 0x17, 0x11, 0xF4, 0x10, 0xF3, 0x0A, 0xFA,
+0xFE, 0x05, 0xFB, 0x04, 0xFC, 0x01, 0xFB, 0xF1, 0x03, 0xF8, 0xFB, 0x02, 0xFB, 0x02, 0xFD, 0x02,
+0xFE, 0xFE, 0x01, 0xFE, 0x01, 0xFD, 0xFE, 0x00, 0xFE, 0xE8, 0xE4, 0x0A, 0xEC, 0x02, 0xF7, 0xF7,
+0x05, 0xF8, 0x04, 0xFC, 0xFC, 0x02, 0xF9, 0xF2, 0x03, 0xFD, 0x0D, 0xFB, 0x06, 0x04, 0xFD, 0x05,
+0xFD, 0xFA, 0xFC, 0xFD, 0xFD, 0x02, 0x00, 0xFF, 0x01, 0xE7, 0xE5, 0x0A, 0xEC, 0x05, 0xF7, 0xF7,
+0x05, 0xF8, 0x04, 0xFB, 0xFC, 0xC8, 0xC8, 0x14, 0xD7, 0x0D, 0xF2, 0xED, 0x0D, 0xF1, 0x08, 0xFA,
+0xF9, 0xFD, 0xF9, 0x03, 0xFC, 0x02, 0x02, 0xFC, 0xFA, 0xFF, 0xFC, 0xFD, 0x00, 0x09, 0x0D, 0xFB,
+0x08, 0x03, 0xFE, 0x04, 0xFD, 0xC7, 0xCA, 0x12, 0xD6, 0xE2, 0xEB, 0xE9, 0xF6, 0xF2, 0xF7, 0xFA,
+0xF9, 0xFF, 0xFB, 0xFC, 0xF1, 0xFB, 0xF9, 0xF8, 0xFA, 0xF9, 0xFA, 0xFD, 0xFB, 0x09, 0x0C, 0xFA,
+0x08, 0x02, 0xFE, 0x04, 0xFD, 0x02, 0xFF, 0xFF, 0xF5, 0xF6, 0x44, 0xF0, 0x26, 0x22, 0xEC, 0x1C,
+0xF3, 0x0C, 0x0C, 0xF5, 0xF6, 0xF9, 0xFA, 0xFB, 0xFD, 0xF9, 0xFA, 0xFD, 0xFB, 0xFD, 0xFD, 0xFB,
+0xFA, 0x00, 0xFC, 0xFD, 0xFF, 0xFD, 0xF7, 0xF2, 0x03, 0x21, 0x44, 0xF4, 0x28, 0x21, 0xEF, 0x1C,
+0xF3, 0x0D, 0x0B, 0xF7, 0xE6, 0xE6, 0x08, 0xED, 0xFB, 0xF9, 0xF6, 0x05, 0xF8, 0xFD, 0xFE, 0xFA,
+0xFA, 0x04, 0x0D, 0x03, 0x06, 0x06, 0xF6, 0xF3, 0xFE, 0xF6, 0xFC, 0xFC, 0x11, 0x1C, 0xF7, 0xEE,
+0xE5, 0x08, 0xF0, 0xF5, 0xE4, 0xE6, 0x08, 0xEC, 0xFD, 0xF8, 0xF6, 0x05, 0xF8, 0xFD, 0xFF, 0xFB,
+0x02, 0x04, 0x0E, 0x02, 0x06, 0x06, 0xFC, 0x05, 0xFB, 0xFA, 0x03, 0xFC, 0x13, 0x1B, 0xF7, 0xED,
+0xE7, 0x0F, 0xEF, 0xFA, 0x05, 0xF6, 0x06, 0xFA, 0xFC, 0x03, 0xFC, 0x02, 0xFE, 0xFE, 0x01, 0xFE,
+0x00, 0x00, 0xFD, 0xFD, 0xFA, 0xFB, 0x00, 0xFC, 0xFF, 0xFE, 0xFE, 0x00, 0xFE, 0xFF, 0x00, 0xFF,
+0x0A, 0x0C, 0xFC, 0x08, 0x04, 0x00, 0x04, 0xFD, 0x02, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0xFA, 0xFB, 0x00, 0xFC, 0x00, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0xFF, 0xFF,
+0x00, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0xFF, 0xEB, 0xBB, 0xE2, 0xE5, 0xDA, 0x0D, 0xE9, 0xF0, 0x07, 0xF1, 0x04,
+0xFA, 0xF8, 0x04, 0xFB, 0xFD, 0x02, 0xFC, 0x01, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0x00, 0xFF, 0x00,
+0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE9, 0xBB, 0xE5, 0xE4, 0xDB, 0x0E, 0xE9, 0xF1, 0x07, 0xF1, 0x04,
+0xFA, 0xF8, 0x04, 0xFB, 0x01, 0x01, 0xFD, 0x01, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0xF9, 0xFC, 0xFE,
+0xFC, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x08, 0x0D, 0x01, 0x07, 0x06,
+0xFD, 0x04, 0x02, 0x02, 0x03, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0xF9, 0xFC, 0xFE,
+0xFC, 0x00, 0xFE, 0xFE, 0xE6, 0xE4, 0x06, 0xED, 0xF3, 0x03, 0xF4, 0x08, 0x0D, 0xF9, 0x07, 0x05,
+0x14, 0x44, 0x24, 0x18, 0x29, 0xF8, 0x15, 0x15, 0xF6, 0x0E, 0x08, 0xFC, 0x09, 0xFD, 0x03, 0x04,
+0xFD, 0x02, 0x02, 0xFE, 0xD9, 0xBB, 0xE5, 0xDF, 0xD9, 0x0A, 0xE8, 0xED, 0x06, 0xF0, 0xF9, 0xFC,
+0x16, 0x44, 0x22, 0x19, 0x29, 0xF6, 0x15, 0x14, 0xF6, 0x0F, 0x08, 0xFC, 0x09, 0xFD, 0x03, 0x04,
+0xFD, 0x02, 0x02, 0xFE, 0xDF, 0xBB, 0xE7, 0xE2, 0xDB, 0x0A, 0xEA, 0xEE, 0x07, 0xF1, 0xF9, 0xFE,
+0xF7, 0x02, 0xFC, 0xFB, 0x02, 0xFD, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFA, 0xFB, 0x00, 0xFC, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0xFF,
+0x03, 0x0E, 0x08, 0x04, 0x08, 0x02, 0x04, 0x05, 0xFE, 0x02, 0x02, 0xFE, 0xFD, 0xFE, 0xFF, 0xFE,
+0x00, 0xFA, 0xFB, 0x00, 0xFC, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xE6, 0xE3, 0xFE, 0xEE, 0xF0, 0x03,
+0xF5, 0x0C, 0x07, 0xFA, 0x07, 0x02, 0xFE, 0x05, 0xFE, 0x01, 0x02, 0xFE, 0xFD, 0xFF, 0xF4, 0xF3,
+0xFE, 0xF8, 0xF9, 0x01, 0xFB, 0xFC, 0xFF, 0xF9, 0xFB, 0xFE, 0xE5, 0xE3, 0xFE, 0xEE, 0xF1, 0x03,
+0xF4, 0xF8, 0xFE, 0xF9, 0xFD, 0xFD, 0xFC, 0x02, 0xFF, 0xFE, 0x01, 0xFE, 0x12, 0x44, 0x31, 0x0E,
+0x2F, 0x16, 0x0E, 0x1B, 0x08, 0x0B, 0x0F, 0xF9, 0x07, 0x08, 0xFB, 0x04, 0x03, 0xFC, 0x03, 0x00,
+0xFE, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x15, 0x44, 0x30, 0x14,
+0x2F, 0x16, 0x10, 0x1B, 0x08, 0x0C, 0x0F, 0xFE, 0x08, 0x08, 0xFD, 0x05, 0x04, 0xFE, 0x03, 0x02,
+0xFF, 0x02, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0xFD, 0xFF, 0xFE, 0xFE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0xF9, 0xFB, 0xFE, 0xFC, 0xFD, 0xFF, 0xFD, 0xFE,
+0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF1, 0xF7, 0xFB, 0xF7, 0xFB,
+0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE, 0xFA, 0xFB, 0xFE, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE,
+0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE1, 0xE7, 0xF1, 0xEC, 0xF2, 0xF6, 0xF4,
+0xF7, 0xFA, 0xF9, 0xFB, 0xFC, 0xFB, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+0x0C, 0x0C, 0x02, 0x07, 0x06, 0x01, 0x04, 0x03, 0xFB, 0xE0, 0xE8, 0xF9, 0xED, 0xF2, 0xFB, 0xF4,
+0xF8, 0xFC, 0xF9, 0xFB, 0xFD, 0xFC, 0xFD, 0xFD, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF,
+0x0D, 0x0B, 0xC1, 0xC6, 0xF5, 0xDA, 0xDE, 0xF7, 0xE9, 0xEC, 0xF7, 0xF2, 0xF4, 0xFA, 0xF7, 0xF9,
+0xFD, 0xFB, 0xFC, 0xFE, 0xFC, 0xF9, 0xFB, 0xFD, 0xFC, 0xFD, 0x0A, 0x0D, 0x04, 0x06, 0x07, 0x01,
+0x03, 0x04, 0xC0, 0xC7, 0xE5, 0xD0, 0xDD, 0xEF, 0xE3, 0xEB, 0xF5, 0xEF, 0xF3, 0xF2, 0xF0, 0xF7,
+0xF7, 0xF5, 0xF8, 0xFA, 0xF9, 0xF8, 0xFA, 0xFB, 0xFB, 0xFC, 0x0A, 0x0D, 0x2A, 0x44, 0x2C, 0x1B,
+0x2F, 0x1B, 0x10, 0x1B, 0xED, 0xE3, 0x0D, 0xF4, 0xEF, 0x07, 0xF9, 0xF6, 0x03, 0xF3, 0xF2, 0xFC,
+0xF8, 0xF6, 0xF9, 0xFB, 0xF9, 0xF9, 0xF9, 0xFB, 0xFC, 0x03, 0x06, 0x01, 0x2D, 0x44, 0x2A, 0x1C,
+0x2F, 0x1A, 0x11, 0x1B, 0x10, 0x0A, 0x10, 0x0A, 0x06, 0x09, 0x06, 0x04, 0x05, 0xF2, 0xF4, 0x01,
+0xF8, 0xF8, 0xFD, 0xFB, 0xFB, 0xFA, 0xFA, 0xFC, 0xFC, 0x04, 0x06, 0x01, 0xFE, 0x03, 0x01, 0xED,
+0xE0, 0xEE, 0xF4, 0xEC, 0xF3, 0xF8, 0xF4, 0xF8, 0xFB, 0xF8, 0xFA, 0xFC, 0xFB, 0xF2, 0xF4, 0xFE,
+0x0B, 0x08, 0x02, 0x06, 0x05, 0x03, 0x04, 0xFD, 0xFA, 0xFE, 0xFE, 0xFC, 0x02, 0x02, 0xFD, 0xEC,
+0xE0, 0xEF, 0xF4, 0xED, 0xF4, 0xF8, 0xF4, 0xF8, 0xFB, 0xF9, 0xFA, 0xFC, 0xD2, 0xBC, 0xDD, 0xE5,
+0xD9, 0xE9, 0xF0, 0xE8, 0xF0, 0xF6, 0xF2, 0xF4, 0xF7, 0xF7, 0xF8, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC,
+0xF9, 0xFA, 0xFD, 0xFC, 0xFC, 0xFE, 0x0C, 0x0C, 0x04, 0x07, 0x07, 0x02, 0xD0, 0xBC, 0xDE, 0xE4,
+0xD7, 0xE8, 0xE8, 0xD9, 0xE7, 0xF2, 0xE8, 0xEF, 0xF6, 0xF2, 0xF5, 0xFA, 0xF8, 0xF9, 0xFA, 0xF1,
+0xF3, 0xF9, 0xF7, 0xF7, 0xFB, 0xF8, 0x0B, 0x0C, 0x01, 0x05, 0x07, 0x01, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0xED, 0xE0, 0xED, 0xF5, 0xED, 0xF3, 0x44, 0x44, 0x18, 0x28, 0x2C, 0x15, 0x16, 0x18,
+0x0D, 0x0D, 0x0F, 0x09, 0x07, 0x07, 0x04, 0x04, 0x04, 0x01, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFA,
+0xFA, 0xFD, 0xFC, 0xFC, 0xFE, 0xFE, 0xF8, 0xF2, 0x44, 0x44, 0x17, 0x28, 0x2B, 0x15, 0x17, 0x1B,
+0x10, 0x0D, 0x10, 0x0B, 0x08, 0xF0, 0xE0, 0xEC, 0xF6, 0xED, 0xF1, 0xF8, 0xF5, 0xF6, 0xFA, 0xF7,
+0xF7, 0xFB, 0xFB, 0xFA, 0x08, 0x0E, 0xFE, 0xF2, 0xFC, 0x04, 0xF8, 0xFB, 0xFA, 0x0E, 0x1D, 0x14,
+0x08, 0x11, 0x0E, 0x06, 0x06, 0xDD, 0xD8, 0xEB, 0xEC, 0xE7, 0xEF, 0xF4, 0xF1, 0xF4, 0xF8, 0xF6,
+0xF8, 0xFA, 0xFA, 0xFA, 0x08, 0x0D, 0x07, 0x04, 0x08, 0x05, 0x02, 0x04, 0xFA, 0x0F, 0x1D, 0x13,
+0x09, 0x11, 0x0E, 0x06, 0x04, 0xE1, 0xE6, 0xF7, 0xEF, 0xEF, 0xF7, 0xF6, 0x04, 0x0C, 0x04, 0xFD,
+0x07, 0x04, 0xFE, 0x04, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0xFE, 0xFD, 0xFE, 0xFF, 0xFE,
+0xFE, 0xFF, 0xFF, 0xFA, 0xF9, 0xFC, 0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0x0B, 0x0D, 0x06, 0x06,
+0x08, 0x05, 0x04, 0x05, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFA, 0xFA, 0xFD, 0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF,
+0xFF, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xC0, 0xC3, 0xE4, 0xDE, 0xD8, 0xE6, 0xEC, 0xE7, 0xEC,
+0xF3, 0xF1, 0xF2, 0xF6, 0xF7, 0xF7, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xF4, 0xBF, 0xC4, 0xE5, 0xDD, 0xD8, 0xE7, 0xEC, 0xE7, 0xEC,
+0xF3, 0xF1, 0xF2, 0xF6, 0xF7, 0xF7, 0xF9, 0xFA, 0xFA, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xFC, 0xFD,
+0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0x0A, 0x0E, 0x08, 0x05, 0x08, 0x06, 0x04, 0x04, 0x04, 0x03,
+0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0xFA, 0xFA, 0xFC, 0xF5, 0xE0, 0xE5, 0xF3,
+0xEF, 0xF7, 0x44, 0x3F, 0x1C, 0x23, 0x2B, 0x1E, 0x15, 0x1A, 0x17, 0x0F, 0x0F, 0x0F, 0x0C, 0x09,
+0x09, 0x08, 0x06, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0xF4, 0xE0, 0xE5, 0xF4,
+0xEF, 0xD6, 0x0D, 0x2B, 0x0D, 0xEF, 0x17, 0x11, 0xF7, 0x0A, 0x0C, 0x05, 0x03, 0x07, 0x05, 0x02,
+0x04, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xD3, 0xBB, 0xD1, 0xE6, 0xD8, 0xDB, 0xEA, 0xE9, 0xE7, 0xED, 0xF2, 0xF0, 0xF2, 0xF6, 0xF6,
+0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFC, 0xFD, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFC, 0xF9, 0xFA, 0xFD, 0xFC, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+0xFF, 0x0B, 0x0D, 0x08, 0x05, 0x08, 0x07, 0x04, 0x04, 0x05, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x01, 0xFD, 0xF9, 0xFB, 0xFD, 0xFC, 0xFC, 0xFB, 0xE3, 0xE2, 0xEF, 0xF1, 0xEC, 0xF0, 0xF6,
+0xF4, 0x05, 0x0B, 0x04, 0xFB, 0x06, 0x05, 0x00, 0x02, 0x03, 0x02, 0xFE, 0xF3, 0xF2, 0xF8, 0xF9,
+0xF7, 0xF8, 0xFB, 0xFB, 0xF9, 0xF8, 0xFA, 0xFC, 0xF9, 0xE2, 0xE2, 0xEF, 0xF1, 0xEC, 0xF0, 0xF5,
+0xF4, 0xF4, 0xF7, 0xF8, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 0x35, 0x44, 0x38, 0x1D, 0x2B, 0x2C, 0x1D,
+0x18, 0x1C, 0x18, 0x11, 0x11, 0x10, 0x0D, 0x0B, 0x0A, 0x09, 0x07, 0x07, 0x06, 0x05, 0x04, 0x04,
+0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x37, 0x44, 0x37, 0x1F, 0x2D, 0x2C, 0x1D,
+0x19, 0x1D, 0x18, 0x12, 0x12, 0x11, 0x0E, 0x0C, 0x0B, 0x0A, 0x08, 0x07, 0x07, 0x06, 0x05, 0x04,
+0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0xFE, 0xFE, 0x01, 0x00, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+0xFE, 0xFD, 0xFA, 0xF9, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xF1, 0xF5, 0xF9, 0xF7, 0xF7, 0xFA, 0xFB, 0xFA, 0xFB, 0xFC, 0xFC,
+0xFC, 0xFE, 0xFA, 0xF9, 0xFC, 0xFD, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+0xFF, 0xF1, 0xE0, 0xE4, 0xEE, 0xEB, 0xEB, 0xF0, 0xF2, 0xF2, 0xF3, 0xF6, 0xF7, 0xF7, 0xF8, 0xF9,
+0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0x09, 0x0E, 0x0A, 0x05, 0x07, 0x08, 0x06, 0x04,
+0x05, 0xF1, 0xE0, 0xE4, 0xF1, 0xEF, 0xEC, 0xF1, 0xF5, 0xF4, 0xF4, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA,
+0xFA, 0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0x09, 0xE5, 0xBE, 0xC4, 0xDE, 0xDF, 0xD7, 0xDE,
+0xE8, 0xE7, 0xE6, 0xEB, 0xEF, 0xEF, 0xF0, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF7, 0xF7, 0xF8, 0xFA,
+0xFA, 0xFB, 0x0C, 0x0D, 0x07, 0x05, 0x07, 0x07, 0x04, 0xE1, 0xBD, 0xC4, 0xD4, 0xD4, 0xD3, 0xDC,
+0xE2, 0xE2, 0xE4, 0xE9, 0xEB, 0xE9, 0xEB, 0xF0, 0xF1, 0xF0, 0xF2, 0xF5, 0xF5, 0xF4, 0xF6, 0xF8,
+0xF8, 0xF9, 0x0C, 0x0C, 0x3F, 0x44, 0x37, 0x23, 0x2D, 0x2E, 0x22, 0x1A, 0x05, 0xF4, 0x0E, 0x0D,
+0x03, 0x04, 0x09, 0x07, 0xFA, 0xF2, 0xF4, 0xFA, 0xF9, 0xF6, 0xF7, 0xFA, 0xF9, 0xF7, 0xF8, 0xFA,
+0xFA, 0xFA, 0xFB, 0xF3, 0x3F, 0x44, 0x36, 0x22, 0x2D, 0x2D, 0x22, 0x1E, 0x1F, 0x1B, 0x16, 0x14,
+0x13, 0x11, 0x0E, 0x05, 0xFA, 0x07, 0x07, 0x03, 0x01, 0x03, 0x04, 0x03, 0xFD, 0xFA, 0xFB, 0xFD,
+0xFD, 0xFC, 0xFC, 0xF3, 0xF2, 0xEA, 0xDF, 0xE5, 0xEF, 0xEE, 0xEE, 0xF6, 0xF9, 0xF5, 0xF5, 0xF9,
+0xF9, 0xF8, 0xF9, 0xF2, 0xF1, 0xF6, 0x0A, 0x0A, 0x03, 0x02, 0x06, 0x06, 0x04, 0x02, 0xFB, 0xFB,
+0xFD, 0xFE, 0xFE, 0x01, 0x01, 0xEB, 0xE0, 0xE6, 0xF0, 0xEF, 0xEC, 0xF0, 0xF4, 0xF4, 0xF4, 0xF6,
+0xF7, 0xF7, 0xF8, 0xE1, 0xBE, 0xC2, 0xDB, 0xE0, 0xD7, 0xDB, 0xE5, 0xE7, 0xE6, 0xE8, 0xEC, 0xEE,
+0xEF, 0xF0, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF8, 0xF7, 0xF8, 0xFA, 0xFA, 0xFA, 0xFB, 0x08,
+0x0D, 0x0B, 0x06, 0xE0, 0xBE, 0xC3, 0xDA, 0xDE, 0xD7, 0xDB, 0xE4, 0xE7, 0xE6, 0xE0, 0xDB, 0xE2,
+0xE9, 0xE9, 0xE9, 0xEC, 0xF0, 0xF1, 0xF1, 0xF3, 0xF4, 0xF4, 0xF5, 0xF3, 0xF0, 0xF2, 0xF6, 0x01,
+0x0A, 0x08, 0xFD, 0xFB, 0x02, 0x02, 0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xE8, 0xE0, 0xE7,
+0xF0, 0xEE, 0xEC, 0xF0, 0xF3, 0xF3, 0xF4, 0xF5, 0xF7, 0x37, 0x44, 0x3F, 0x25, 0x29, 0x2F, 0x28,
+0x1E, 0x1D, 0x1D, 0x19, 0x15, 0x14, 0x13, 0x11, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x07,
+0x06, 0x06, 0x00, 0xFC, 0x01, 0x03, 0x01, 0xFE, 0x01, 0x39, 0x44, 0x3E, 0x26, 0x2A, 0x2F, 0x28,
+0x1E, 0x1D, 0x1E, 0x1A, 0x16, 0x14, 0x13, 0x11, 0x0F, 0x0E, 0xF9, 0xE3, 0xE4, 0xEE, 0xF2, 0xEE,
+0xEE, 0xF2, 0xF3, 0xF3, 0xF4, 0xF6, 0xF7, 0xF7, 0xF8, 0xF9, 0xF3, 0xF5, 0x08, 0x08, 0x0B, 0x1B,
+0x1B, 0x12, 0x0E, 0x11, 0x11, 0x0D, 0x0B, 0x0B, 0x0B, 0x09, 0xF2, 0xE1, 0xE3, 0xED, 0xF1, 0xED,
+0xE8, 0xDE, 0xE1, 0xEA, 0xEC, 0xEA, 0xEC, 0xF0, 0xF1, 0xF2, 0xF3, 0xFE, 0x0A, 0x06, 0x0C, 0x1C,
+0x1B, 0x12, 0x0E, 0x11, 0x11, 0x0D, 0x0B, 0x0B, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x06, 0x05, 0x05,
+0xEE, 0xE0, 0xE3, 0xED, 0xF0, 0xEC, 0xEE, 0xF2, 0xF3, 0xF3, 0xF4, 0xF6, 0xF7, 0xF7, 0xFE, 0x0C,
+0x0B, 0x06, 0x05, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xFB, 0xF9, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0x07, 0x0D,
+0x0C, 0x08, 0x07, 0x08, 0x08, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02,
+0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFB, 0xF9, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xFF,
+0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xD4, 0xBC, 0xC3, 0xD7, 0xDC, 0xD6, 0xD8, 0xDF, 0xE4,
+0xE4, 0xE5, 0xE8, 0xEB, 0xED, 0xEE, 0xEF, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF8,
+0xF9, 0xF9, 0xFA, 0xFA, 0xFB, 0xFB, 0xFC, 0xD3, 0xBC, 0xC4, 0xD8, 0xDC, 0xD6, 0xD8, 0xE0, 0xE4,
+0xE4, 0xE5, 0xE9, 0xEB, 0xEC, 0xED, 0xEF, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8,
+0x08, 0x0D, 0x0A, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x03, 0x03,
+0x02, 0x02, 0x0C, 0x39, 0x42, 0x34, 0x23, 0x25, 0x29, 0x25, 0x1E, 0x1B, 0x1B, 0x19, 0x16, 0x14,
+0x15, 0x16, 0x13, 0x10, 0x0F, 0x0E, 0x0D, 0x0B, 0x0A, 0x0A, 0x09, 0x08, 0x07, 0x07, 0x06, 0x06,
+0x05, 0x05, 0x0F, 0x39, 0x42, 0x33, 0x24, 0x25, 0x29, 0x25, 0x17, 0xC8, 0xC1, 0xD2, 0xE1, 0xDD,
+0xD9, 0xDE, 0xE4, 0xE7, 0xE6, 0xE8, 0xEB, 0xED, 0xEE, 0xEF, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6,
+0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB, 0xE9, 0xC2, 0xBD, 0xCD, 0xDB, 0xD9,
+0xD6, 0xDA, 0xE1, 0xE3, 0xE4, 0xE5, 0xE8, 0xEB, 0xEC, 0xED, 0xEF, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5,
+0xF6, 0xF6, 0xF7, 0xF8, 0xF7, 0xF7, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC,
+0xFC, 0x07, 0x0D, 0x0D, 0x09, 0x07, 0x08, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04,
+0x03, 0x03, 0x03, 0x02, 0xFB, 0xFA, 0xFB, 0xF3, 0xE2, 0xE1, 0xE8, 0xEE, 0xED, 0xEC, 0xEE, 0xF1,
+0xF2, 0xF5, 0x06, 0x07, 0xFC, 0xFA, 0xFD, 0x03, 0x01, 0xFA, 0xF3, 0xF2, 0xF5, 0xF7, 0xF7, 0xF7,
+0xF7, 0xF8, 0xF7, 0xF7, 0xF8, 0xF9, 0xFA, 0xF1, 0xE2, 0xE0, 0xE8, 0xEE, 0xED, 0xEC, 0xEE, 0xF1,
+0xF2, 0xF2, 0xF3, 0xF4, 0xF6, 0x0B, 0x41, 0x44, 0x41, 0x2E, 0x2A, 0x2F, 0x2D, 0x26, 0x21, 0x20,
+0x1F, 0x1C, 0x19, 0x17, 0x16, 0x14, 0x12, 0x11, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x0A, 0x09,
+0x08, 0x07, 0x07, 0x06, 0x06, 0x11, 0x42, 0x44, 0x40, 0x2E, 0x2C, 0x30, 0x2E, 0x27, 0x22, 0x21,
+0x20, 0x1D, 0x1A, 0x18, 0x16, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09,
+0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0xFC, 0xFA, 0xFA, 0xFC,
+0xFD, 0xFC, 0xFC, 0xFC, 0xFA, 0xF9, 0xFA, 0x02, 0x05, 0x04, 0x01, 0x01, 0x02, 0xFB, 0xF3, 0xF2,
+0xF4, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFA, 0xF8, 0xF9, 0xFB,
+0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xEB, 0xE0, 0xE2, 0xE9, 0xEA, 0xE9,
+0xE9, 0xEC, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9,
+0x05, 0x0C, 0x0C, 0x09, 0x06, 0x07, 0x08, 0x07, 0x06, 0x05, 0xEA, 0xE0, 0xE2, 0xEA, 0xEE, 0xEC,
+0xEC, 0xEE, 0xF0, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xF9,
+0x06, 0xD9, 0xBF, 0xBF, 0xCE, 0xD9, 0xD8, 0xD6, 0xD8, 0xDE, 0xE1, 0xE2, 0xE3, 0xE5, 0xE8, 0xE9,
+0xEB, 0xEC, 0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4, 0xF8, 0x09, 0x09, 0x05, 0xFD, 0x02, 0x04,
+0x04, 0xD6, 0xBE, 0xBD, 0xC7, 0xD0, 0xD2, 0xD2, 0xD5, 0xD9, 0xDD, 0xDF, 0xDF, 0xE0, 0xE3, 0xE5,
+0xE7, 0xE8, 0xEA, 0xEB, 0xEC, 0xED, 0xEF, 0xF0, 0xF1, 0xF5, 0x06, 0x18, 0x43, 0x44, 0x42, 0x31,
+0x2D, 0x30, 0x30, 0x26, 0x17, 0x15, 0x1B, 0x1B, 0x17, 0x14, 0x13, 0x13, 0x0F, 0x09, 0x08, 0x0A,
+0x0A, 0x07, 0x05, 0x05, 0x04, 0xFE, 0xFD, 0x02, 0x02, 0x02, 0xF8, 0x16, 0x43, 0x44, 0x41, 0x31,
+0x2D, 0x30, 0x30, 0x2A, 0x25, 0x22, 0x19, 0x08, 0x08, 0x11, 0x12, 0x16, 0x1F, 0x1F, 0x1A, 0x15,
+0x14, 0x15, 0x14, 0x12, 0x0F, 0x0E, 0x0E, 0x0D, 0x0C, 0x0B, 0x07, 0xED, 0xE1, 0xE0, 0xE6, 0xEC,
+0xEC, 0xEB, 0xEC, 0xEE, 0xF0, 0xF0, 0xE4, 0xDE, 0xE1, 0xE8, 0xEB, 0xF2, 0x17, 0x1B, 0x16, 0x0E,
+0x0E, 0x10, 0x10, 0x0E, 0x0B, 0x0A, 0x0A, 0x0A, 0x09, 0x08, 0x08, 0xF0, 0xE2, 0xE1, 0xE7, 0xED,
+0xED, 0xEC, 0xED, 0xEF, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF5, 0xDD, 0xC1, 0xBE, 0xC9, 0xD6,
+0xD8, 0xD5, 0xD6, 0xDA, 0xDE, 0xE0, 0xE1, 0xE3, 0xE5, 0xE7, 0xE9, 0xEA, 0xEB, 0xED, 0xEE, 0xEF,
+0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 0xF7, 0x06, 0xDE, 0xC1, 0xBE, 0xC9, 0xD6,
+0xD8, 0xD5, 0xD6, 0xDA, 0xDF, 0xE1, 0xE2, 0xE3, 0xE5, 0xE7, 0xDF, 0xDB, 0xDE, 0xE3, 0xE7, 0xE7,
+0xE7, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF7, 0xF6, 0xF3, 0xF3, 0xF5, 0xF7,
+0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xF7, 0xE6, 0xE0, 0xE3, 0xE9, 0xEC, 0xEC,
+0xEB, 0xED, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF4, 0xF0, 0xEF, 0xF1, 0xF4, 0x2E,
+0x44, 0x44, 0x3E, 0x30, 0x2E, 0x31, 0x30, 0x2B, 0x27, 0x24, 0x23, 0x21, 0x1F, 0x1D, 0x1B, 0x19,
+0x18, 0x16, 0x15, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0A, 0x09, 0x09, 0x09, 0x30,
+0x44, 0x44, 0x3E, 0x30, 0x2E, 0x30, 0x30, 0x2B, 0x27, 0x24, 0x23, 0x21, 0x1F, 0x1C, 0x1B, 0x19,
+0x18, 0x16, 0x15, 0x13, 0x12, 0xFD, 0xE6, 0xE4, 0xE9, 0xEF, 0xF0, 0xEE, 0xEE, 0xEF, 0xF1, 0xF8,
+0x18, 0x1D, 0x19, 0x11, 0x0A, 0x0C, 0x0F, 0x0F, 0x0D, 0x0B, 0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x08,
+0x08, 0x07, 0x07, 0x06, 0x06, 0xEE, 0xE2, 0xE1, 0xE6, 0xEB, 0xED, 0xEC, 0xEC, 0xEE, 0xEF, 0xF6,
+0x17, 0x1C, 0x19, 0x12, 0x0E, 0xEB, 0xE5, 0xE7, 0xED, 0xF1, 0xF0, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4,
+0xF4, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB,
+0xFB, 0xFB, 0xFB, 0xFB, 0xF5, 0xE5, 0xE0, 0xE3, 0xE9, 0xEC, 0xEC, 0xEB, 0xEC, 0xEE, 0xF0, 0xF0,
+0xF1, 0xF2, 0xF3, 0xF4, 0xF4, 0xF5, 0xF7, 0x08, 0x0B, 0x09, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05,
+0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFD, 0xFA,
+0xFA, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0x05, 0x0C, 0x0D, 0x0C, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07,
+0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0xFE, 0xFA,
+0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x01, 0x01, 0x01, 0x00,
+0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xE2, 0xC4, 0xBD, 0xC4, 0xCF, 0xD5, 0xD5, 0xD4, 0xD6,
+0xD9, 0xDD, 0xDE, 0xE0, 0xE1, 0xE3, 0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xEE, 0xEF, 0xEF,
+0xF0, 0xF1, 0xF2, 0xF3, 0xF3, 0xF4, 0xF5, 0xDF, 0xC3, 0xBC, 0xC4, 0xCF, 0xD5, 0xD4, 0xD4, 0xD6,
+0xD9, 0xDC, 0xDE, 0xDF, 0xE1, 0xE3, 0xE4, 0xE6, 0xE7, 0xE9, 0xEC, 0xF0, 0xF1, 0xF0, 0xF0, 0xF1,
+0xF3, 0xF4, 0xF4, 0xFB, 0x30, 0x40, 0x3F, 0x34, 0x2B, 0x29, 0x2A, 0x2A, 0x27, 0x24, 0x21, 0x20,
+0x1E, 0x1C, 0x1B, 0x19, 0x18, 0x17, 0x15, 0x14, 0x13, 0x12, 0x13, 0x14, 0x13, 0x12, 0x10, 0x0F,
+0x0F, 0x0E, 0x0D, 0x10, 0x32, 0x41, 0x3F, 0x35, 0x2C, 0x2A, 0x2B, 0x2B, 0x28, 0x24, 0x22, 0x20,
+0x1F, 0x1D, 0x1C, 0xEF, 0xC9, 0xC0, 0xC6, 0xD1, 0xD8, 0xD8, 0xD7, 0xD8, 0xDB, 0xDE, 0xE0, 0xE1,
+0xE2, 0xE4, 0xE5, 0xE7, 0xE8, 0xE9, 0xEA, 0xEC, 0xED, 0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3,
+0xF3, 0xF4, 0xF4, 0xDF, 0xC4, 0xBC, 0xC3, 0xCD, 0xD4, 0xD4, 0xD3, 0xD5, 0xD8, 0xDB, 0xDD, 0xDF,
+0xE0, 0xE2, 0xE3, 0xE5, 0xE6, 0xE8, 0xE9, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1,
+0xF2, 0xF3, 0xF5, 0x05, 0x09, 0x07, 0x04, 0xFE, 0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0x02, 0x03,
+0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFB, 0xEC, 0xE2, 0xE0, 0xE4, 0xE9, 0xEB, 0xEB, 0xEB, 0xEC,
+0xED, 0xEE, 0xF1, 0xF6, 0xFA, 0xF8, 0xF6, 0xF6, 0xF4, 0xF1, 0xF1, 0xF2, 0xF4, 0xF5, 0xF5, 0xF5,
+0xF4, 0xF5, 0xF5, 0xF6, 0xF7, 0xF7, 0xF7, 0xEB, 0xE1, 0xE0, 0xE4, 0xE8, 0xEB, 0xEA, 0xEA, 0xEB,
+0xED, 0xEE, 0xEF, 0x2E, 0x44, 0x44, 0x43, 0x37, 0x31, 0x30, 0x31, 0x2F, 0x2C, 0x29, 0x27, 0x25,
+0x23, 0x22, 0x20, 0x1E, 0x1D, 0x1B, 0x1A, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10,
+0x0F, 0x0F, 0x0E, 0x33, 0x44, 0x44, 0x44, 0x39, 0x33, 0x33, 0x34, 0x32, 0x2E, 0x2B, 0x29, 0x27,
+0x25, 0x23, 0x21, 0x1F, 0x1E, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x15, 0x14, 0x13, 0x12, 0x11,
+0x10, 0x10, 0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x06,
+0x05, 0x03, 0xFE, 0x01, 0x03, 0x03, 0x03, 0xFC, 0xF5, 0xF3, 0xF4, 0xF5, 0xF7, 0xF7, 0xF7, 0xF7,
+0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+0xFB, 0xFB, 0xFB, 0xEF, 0xE4, 0xE0, 0xE3, 0xE7, 0xE8, 0xE7, 0xE7, 0xE8, 0xEA, 0xEC, 0xEC, 0xED,
+0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF3, 0xF4, 0xF9, 0x08, 0x09, 0x07, 0x04, 0x03, 0x04,
+0x05, 0x05, 0x03, 0xEE, 0xE3, 0xE0, 0xE3, 0xE7, 0xEA, 0xEB, 0xEB, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+0xF0, 0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF4, 0xF5, 0xDA, 0xC4, 0xBE, 0xC3, 0xCB, 0xD2, 0xD3,
+0xD3, 0xD4, 0xD6, 0xD8, 0xDA, 0xDC, 0xDE, 0xDF, 0xE1, 0xE2, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9,
+0xEA, 0xEC, 0xF0, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xD8, 0xC2, 0xBB, 0xBD, 0xC4, 0xCB, 0xCE,
+0xCE, 0xCF, 0xD1, 0xD4, 0xD6, 0xD7, 0xD8, 0xDA, 0xDC, 0xDE, 0xDF, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5,
+0xE7, 0xE9, 0xEC, 0x09, 0x38, 0x44, 0x44, 0x41, 0x38, 0x33, 0x32, 0x2F, 0x29, 0x25, 0x24, 0x23,
+0x23, 0x21, 0x1F, 0x1D, 0x1B, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0E,
+0x0E, 0x0D, 0x0A, 0x15, 0x3A, 0x44, 0x44, 0x42, 0x39, 0x34, 0x34, 0x34, 0x32, 0x2F, 0x28, 0x20,
+0x1D, 0x1E, 0x1F, 0x1E, 0x1C, 0x1A, 0x18, 0x17, 0x18, 0x18, 0x18, 0x16, 0x18, 0x1E, 0x20, 0x1F,
+0x1C, 0x19, 0x0B, 0xEA, 0xE7, 0xEA, 0xF0, 0xF3, 0xF3, 0xF1, 0xF1, 0xF2, 0xF3, 0xF1, 0xE6, 0xE0,
+0xE0, 0xE3, 0xE7, 0xEA, 0xEC, 0xED, 0xED, 0xED, 0xF0, 0xF5, 0xF8, 0xF7, 0x08, 0x16, 0x1A, 0x19,
+0x16, 0x13, 0xF3, 0xE7, 0xE6, 0xE9, 0xED, 0xF0, 0xF0, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 0xF3,
+0xF3, 0xF4, 0xF4, 0xF8, 0xDF, 0xC7, 0xBE, 0xC1, 0xC8, 0xCF, 0xD2, 0xD2, 0xD2, 0xD4, 0xD6, 0xD8,
+0xDA, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEB,
+0xEC, 0xED, 0xEE, 0xEF, 0xDA, 0xC4, 0xBD, 0xC0, 0xC8, 0xCF, 0xD2, 0xD2, 0xD2, 0xD4, 0xD6, 0xD8,
+0xDA, 0xDC, 0xDD, 0xDE, 0xE0, 0xE1, 0xE3, 0xE4, 0xE5, 0xE4, 0xDE, 0xDA, 0xDB, 0xDE, 0xE1, 0xE3,
+0xE4, 0xE4, 0xE5, 0xE6, 0xE7, 0xE9, 0xEA, 0xED, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF0, 0xEE,
+0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xEF, 0xE4, 0xDF, 0xE0, 0xE3, 0xE7, 0xE8,
+0xE9, 0xE9, 0xE9, 0xEA, 0xEC, 0xED, 0xED, 0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF1, 0xF2, 0xF0, 0xEE,
+0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0x17, 0x3B, 0x44, 0x44, 0x44,
+0x3B, 0x36, 0x34, 0x34, 0x33, 0x31, 0x2F, 0x2D, 0x2B, 0x29, 0x27, 0x26, 0x24, 0x23, 0x21, 0x20,
+0x1F, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x20, 0x3E, 0x44, 0x44, 0x44,
+0x3D, 0x38, 0x36, 0x36, 0x34, 0x32, 0x2F, 0x2D, 0x2B, 0x29, 0x28, 0x26, 0x25, 0x23, 0x22, 0x20,
+0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x15, 0x14, 0x13, 0x13, 0x12, 0x11,
+0x11, 0x0D, 0x09, 0xFB, 0xF5, 0xF5, 0xF6, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA,
+0xFD, 0x09, 0x0C, 0x0C, 0x0B, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x06,
+0x06, 0xF8, 0xF4, 0xF3, 0xF4, 0xF5, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9,
+0xF9, 0xEF, 0xE5, 0xE1, 0xE1, 0xE4, 0xE7, 0xE9, 0xEA, 0xEA, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEE,
+0xEF, 0xEF, 0xF0, 0xF1, 0xF1, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6,
+0xF6, 0xEE, 0xE4, 0xE0, 0xE1, 0xE4, 0xE7, 0xE9, 0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xEE,
+0xEE, 0xF0, 0xF3, 0xF8, 0xF9, 0xF8, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFA, 0xF9, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA,
+0xFA, 0x03, 0x0A, 0x0C, 0x0D, 0x0C, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07,
+0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x02, 0xFD, 0xFC, 0xFD, 0xFE, 0x01, 0x01, 0xFF, 0xFE,
+0xFE, 0xFE, 0x01, 0x02, 0x02, 0x02, 0x02, 0xF7, 0xD5, 0xC4, 0xBE, 0xC1, 0xC7, 0xCC, 0xD0, 0xD1,
+0xD1, 0xD2, 0xD4, 0xD5, 0xD7, 0xD9, 0xDA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE3, 0xE4, 0xE5,
+0xE6, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEA, 0xD1, 0xC1, 0xBC, 0xBF, 0xC5, 0xCB, 0xCE, 0xCF,
+0xCF, 0xD0, 0xD2, 0xD4, 0xD7, 0x0F, 0x30, 0x37, 0x35, 0x2F, 0x29, 0x26, 0x25, 0x25, 0x25, 0x24,
+0x22, 0x21, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x18, 0x16, 0x15, 0x15, 0x14, 0x13,
+0x13, 0x12, 0x11, 0x11, 0x13, 0x2D, 0x3D, 0x42, 0x40, 0x3A, 0x34, 0x31, 0x30, 0x2F, 0x2E, 0x2D,
+0x2B, 0x29, 0x28, 0x26, 0x25, 0x24, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x18, 0xDA, 0xC7, 0xC2,
+0xC5, 0xCB, 0xD0, 0xD3, 0xD4, 0xD4, 0xD5, 0xD6, 0xD8, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xE0, 0xE1,
+0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE7, 0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xE7, 0xCF, 0xC1, 0xBD,
+0xBF, 0xC5, 0xCA, 0xCD, 0xCF, 0xCF, 0xD0, 0xD2, 0xD3, 0xD5, 0xD7, 0xD8, 0xD9, 0xDA, 0xDC, 0xDD,
+0xDE, 0xDF, 0xE0, 0xE1, 0xE3, 0xE5, 0xE7, 0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xED,
+0xEE, 0xEF, 0xEF, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xE8, 0xE2, 0xDF, 0xE0, 0xE2, 0xE5, 0xE6, 0xE7,
+0xE7, 0xE8, 0xE9, 0xE9, 0xEB, 0xED, 0xF0, 0xF1, 0xEF, 0xED, 0xED, 0xED, 0xEE, 0xEF, 0xF0, 0xF0,
+0xF0, 0xF0, 0xF1, 0xF1, 0xF2, 0xF2, 0xF3, 0xF2, 0xE9, 0xE2, 0xE0, 0xE1, 0xE3, 0xE5, 0xE7, 0xE8,
+0xE8, 0x19, 0x39, 0x44, 0x44, 0x44, 0x3E, 0x39, 0x36, 0x34, 0x33, 0x32, 0x31, 0x2F, 0x2D, 0x2C,
+0x2A, 0x29, 0x27, 0x26, 0x25, 0x24, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x1A,
+0x19, 0x28, 0x40, 0x44, 0x44, 0x44, 0x42, 0x3D, 0x3B, 0x39, 0x38, 0x37, 0x36, 0x34, 0x31, 0x30,
+0x2E, 0x2D, 0x2B, 0x2A, 0x28, 0x27, 0x26, 0x24, 0x22, 0x21, 0x21, 0x20, 0x20, 0x1F, 0x1E, 0x1C,
+0x1B, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x15, 0x14, 0x13, 0x13, 0x12, 0x11, 0x10, 0x10,
+0x0F, 0x0F, 0x0D, 0x09, 0x04, 0xFE, 0x03, 0x02, 0xF7, 0xF6, 0xFD, 0x08, 0x09, 0x09, 0x08, 0x07,
+0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xF8, 0xEB, 0xE4, 0xE1,
+0xE2, 0xE4, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xED,
+0xEE, 0xEF, 0xF1, 0xF5, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF3, 0xE9, 0xE2, 0xE0,
+0xE1, 0xE4, 0xE6, 0xE7, 0xE8, 0xE8, 0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xED, 0xEE, 0xEE,
+0xEF, 0xE2, 0xCD, 0xC2, 0xBF, 0xC1, 0xC6, 0xCA, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD4, 0xD5,
+0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE1, 0xE3, 0xE4, 0xE6, 0xE6, 0xE7, 0xE7,
+0xE8, 0xDE, 0xCA, 0xBE, 0xBB, 0xBB, 0xBE, 0xC2, 0xC6, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCF,
+0xD0, 0xD2, 0xD3, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDC, 0xDE, 0xE0, 0x17, 0x37, 0x44, 0x44,
+0x43, 0x3D, 0x39, 0x34, 0x2F, 0x2C, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x25, 0x23, 0x21, 0x20,
+0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x19, 0x18, 0x17, 0x16, 0x14, 0x29, 0x3F, 0x44, 0x44,
+0x44, 0x43, 0x3E, 0x3B, 0x3A, 0x39, 0x36, 0x31, 0x2D, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x27, 0x25,
+0x24, 0x24, 0x24, 0x23, 0x22, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x19, 0x17, 0x16, 0x14, 0x13,
+0x12, 0x11, 0x11, 0x11, 0x10, 0x0F, 0xF5, 0xE9, 0xE5, 0xE4, 0xE6, 0xE9, 0xED, 0xEF, 0xF0, 0xEF,
+0xF0, 0xF2, 0xF5, 0xF7, 0xF7, 0xF6, 0xF5, 0xF4, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF6, 0xF3, 0xF2,
+0xF1, 0xF1, 0xF2, 0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xFA, 0x07, 0x0A, 0xEB, 0xD1,
+0xC4, 0xC0, 0xC1, 0xC4, 0xC9, 0xCC, 0xCE, 0xCF, 0xCF, 0xD0, 0xD2, 0xD3, 0xD4, 0xD6, 0xD7, 0xD8,
+0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE2, 0xE3, 0xE4, 0xE4, 0xDD, 0xCB,
+0xC0, 0xBC, 0xBD, 0xC1, 0xC5, 0xC8, 0xCA, 0xCC, 0xCD, 0xCF, 0xD0, 0xD1, 0xD2, 0xD4, 0xD5, 0xD6,
+0xD7, 0xD8, 0xD9, 0xDA, 0xDC, 0xDD, 0xDE, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE2, 0xDE, 0xDA,
+0xD9, 0xDA, 0xDB, 0xDD, 0xDF, 0xE0, 0xE1, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE9,
+0xEA, 0xEA, 0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xEC, 0xEB, 0xEB, 0xEB, 0xEC, 0xEB, 0xE4, 0xE0,
+0xDE, 0xDE, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE8, 0xE8, 0xE9, 0xEA, 0xEA,
+0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xEE, 0xEE, 0xEC, 0xEC, 0xEB, 0xEC, 0xED, 0xED, 0xEE, 0xEF,
+0xEF, 0xEF, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF3, 0x24, 0x3B, 0x44,
+0x44, 0x44, 0x43, 0x3F, 0x3C, 0x3A, 0x39, 0x38, 0x37, 0x35, 0x34, 0x32, 0x31, 0x30, 0x2E, 0x2D,
+0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x30, 0x42, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x41, 0x3E, 0x3D, 0x3C, 0x3B, 0x39, 0x38, 0x36, 0x35, 0x33, 0x32, 0x31,
+0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1F,
+0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x1B, 0x1A, 0x1A, 0x19, 0x18, 0x18, 0x17, 0x16, 0x16, 0x15, 0x13,
+0x11, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A,
+0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x04, 0xF8,
+0xF5, 0xF4, 0xF4, 0xF5, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF5,
+0xEB, 0xE5, 0xE2, 0xE1, 0xE2, 0xE4, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE9, 0xE9, 0xEA, 0xEA, 0xEB,
+0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xEF,
+0xE8, 0xE2, 0xE0, 0xE0, 0xE1, 0xE2, 0xE4, 0xE5, 0xE6, 0xE6, 0xE7, 0xE8, 0xEA, 0xEC, 0xED, 0xED,
+0xED, 0xED, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF9, 0x06, 0x09, 0x09, 0x09,
+0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0xFF,
+0xFD, 0xFD, 0xFE, 0xFF, 0x01, 0x01, 0x01, 0xF0, 0xD7, 0xC9, 0xC2, 0xC0, 0xC2, 0xC5, 0xC8, 0xCA,
+0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB,
+0xDC, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0x11, 0x29, 0x26, 0x14, 0xE5, 0xDC, 0xDA, 0xDB, 0xDE, 0xE1,
+0xE3, 0xE4, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE8, 0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xEB, 0xEC,
+0xEC, 0xED, 0xED, 0xEE, 0xEE, 0xF0, 0x20, 0x32, 0x3B, 0x3E, 0x3D, 0x3A, 0x37, 0x34, 0x32, 0x31,
+0x30, 0x2F, 0x2F, 0x2E, 0x2D, 0x2B, 0x2A, 0x29, 0x28, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22,
+0x22, 0x21, 0x20, 0x1F, 0x1F, 0x1D, 0xEA, 0xD3, 0xC8, 0xC5, 0xC6, 0xC8, 0xCB, 0xCE, 0xD0, 0xD1,
+0xD2, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDE,
+0xDF, 0xE0, 0xE1, 0xE1, 0xE2, 0xE1, 0xD3, 0xC6, 0xBE, 0xBC, 0xBD, 0xC0, 0xC3, 0xC5, 0xC7, 0xC8,
+0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCF, 0xD0, 0xD1, 0xD2, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDE, 0xDF, 0xE0, 0xE1, 0xE0, 0xDD, 0xDA, 0xD8, 0xD8, 0xD9, 0xDA,
+0xDB, 0xDD, 0xDD, 0xDE, 0xDF, 0xE0, 0xE0, 0xE1, 0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6,
+0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE9, 0xE9, 0xEA, 0xE8, 0xE3, 0xDF, 0xDD, 0xDD, 0xDE, 0xDF,
+0xEC, 0x29, 0x3B, 0x43, 0x44, 0x44, 0x41, 0x3D, 0x3B, 0x38, 0x37, 0x35, 0x34, 0x34, 0x33, 0x32,
+0x30, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x24, 0x23,
+0x2A, 0x3B, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x40, 0x3F, 0x3E, 0x3D, 0x3B, 0x3A,
+0x39, 0x38, 0x37, 0x35, 0x34, 0x32, 0x31, 0x30, 0x2F, 0x2E, 0x2D, 0x2D, 0x2C, 0x2C, 0x2B, 0x2A,
+0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x24, 0x23, 0x22, 0x21, 0x21, 0x20, 0x1F, 0x1E, 0x1C, 0x1B,
+0x1A, 0x19, 0x19, 0x19, 0x18, 0x16, 0x15, 0x13, 0x13, 0x12, 0x13, 0x14, 0x15, 0x15, 0x15, 0x14,
+0x14, 0x13, 0x12, 0x12, 0x12, 0x11, 0x0D, 0xF2, 0xEA, 0xE7, 0xE6, 0xE6, 0xE7, 0xE8, 0xE8, 0xE8,
+0xE8, 0xE8, 0xE9, 0xE9, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xEE, 0xF0, 0xF2, 0xF3, 0xF3,
+0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xEE, 0xE7, 0xE3, 0xE1, 0xE1, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5,
+0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xD9, 0xCB, 0xC3, 0xC0, 0xBF, 0xC1,
+0xC3, 0xC6, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD2, 0xD3, 0xD4,
+0xD5, 0xD6, 0xD7, 0xD8, 0xDA, 0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xD1, 0xC5, 0xBC, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBD, 0xBF, 0xC1, 0xC2, 0xC3, 0xC4, 0xC4, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD,
+0xCE, 0xCF, 0xD0, 0xD1, 0xD3, 0xDF, 0x20, 0x34, 0x3C, 0x3F, 0x3E, 0x3B, 0x36, 0x32, 0x2E, 0x2C,
+0x2B, 0x2A, 0x2A, 0x2A, 0x29, 0x28, 0x27, 0x25, 0x24, 0x23, 0x23, 0x22, 0x21, 0x21, 0x20, 0x1F,
+0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x28, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x41, 0x3E,
+0x3B, 0x38, 0x36, 0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x30, 0x2F, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B,
+0x2B, 0x2A, 0x29, 0x27, 0x26, 0x25, 0x24, 0x23, 0x23, 0x22, 0x22, 0x21, 0x1E, 0xEC, 0xD9, 0xD9,
+0xE0, 0xEB, 0x09, 0x13, 0x16, 0x16, 0x15, 0x14, 0x13, 0x12, 0x13, 0x13, 0x14, 0x14, 0x14, 0x13,
+0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0E, 0xFF, 0xDD, 0xD1, 0xD4,
+0xDD, 0xEC, 0x10, 0x17, 0x19, 0x19, 0x17, 0x16, 0x14, 0x13, 0x07, 0xDC, 0xCE, 0xC6, 0xC3, 0xC3,
+0xC4, 0xC6, 0xC8, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5,
+0xD5, 0xD6, 0xD7, 0xD8, 0xD8, 0xD9, 0xDA, 0xDB, 0xDB, 0xDC, 0xD9, 0xCD, 0xC3, 0xBD, 0xBB, 0xBB,
+0xBC, 0xBE, 0xC0, 0xC2, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCE, 0xCF, 0xD0,
+0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD4, 0xD5, 0xD6, 0xD7, 0xD7, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB,
+0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xE0, 0xE0, 0xDE, 0xDB, 0xD9, 0xD9, 0xD9, 0xDA, 0xDB, 0xDC,
+0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE2, 0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5,
+0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE4, 0xDF, 0xDC, 0xDB, 0xDB, 0xDB, 0xDC, 0xDD,
+0xDE, 0xDF, 0xE0, 0xE0, 0xE1, 0xE1, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6,
+0xE6, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9,
+0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0x0E,
+0x2A, 0x39, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x40, 0x3E, 0x3D, 0x3C, 0x3B, 0x3A, 0x39, 0x38,
+0x37, 0x36, 0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x30, 0x2F, 0x2E, 0x2E, 0x2D, 0x2C, 0x2B, 0x2F,
+0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40,
+0x3F, 0x3E, 0x3D, 0x3C, 0x3B, 0x3A, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34, 0x33, 0x33, 0x32, 0x31,
+0x30, 0x2F, 0x2E, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x28, 0x27, 0x26, 0x26, 0x25,
+0x24, 0x24, 0x23, 0x23, 0x22, 0x21, 0x21, 0x20, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x1A,
+0x1A, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14,
+0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0F, 0x0E, 0x0C, 0x0A, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0xF3, 0xEB, 0xE7, 0xE4, 0xE3, 0xE4, 0xE4,
+0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB,
+0xEB, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xED, 0xED, 0xE9, 0xE4, 0xE1, 0xE0, 0xDF, 0xDF, 0xE0,
+0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9,
+0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xED, 0xEE, 0xEF,
+0xF0, 0xF2, 0xF3, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF5, 0xF5, 0xF5, 0xF5, 0xEB, 0xD9, 0xCD, 0xC6, 0xC3, 0xC1, 0xC2, 0xC3, 0xC4, 0xC6, 0xC7, 0xC8,
+0xC9, 0xCA, 0xCB, 0xCC, 0xCC, 0xCD, 0xCE, 0xD6, 0xE9, 0x1B, 0x26, 0x2B, 0x2C, 0x2C, 0x2B, 0x29,
+0x28, 0x27, 0x26, 0x25, 0x20, 0xF4, 0xDB, 0xD1, 0xCC, 0xCA, 0xCA, 0xCB, 0xCD, 0xCE, 0xCF, 0xD0,
+0xD1, 0xD2, 0xD3, 0xD3, 0xD4, 0xD5, 0xD6, 0xE0, 0x13, 0x26, 0x2E, 0x31, 0x32, 0x32, 0x30, 0x2F,
+0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x28, 0x27, 0x26, 0x26, 0x25, 0x25, 0x24, 0x24,
+0x23, 0x22, 0x22, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1E, 0x1E, 0x1B, 0xEF, 0xDA, 0xCF,
+0xCA, 0xC7, 0xC7, 0xC7, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD0, 0xD1, 0xD2, 0xD2,
+0xD3, 0xD4, 0xD4, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9, 0xD8, 0xCF, 0xC6, 0xC0,
+0xBC, 0xBB, 0xBB, 0xBB, 0xBD, 0xBE, 0xBF, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9,
+0xCA, 0xCA, 0xCB, 0xCC, 0xCD, 0xCD, 0xCE, 0xCF, 0xCF, 0xD0, 0xD0, 0xCF, 0xCE, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCE, 0xCF, 0xD0, 0xD0, 0xD1, 0xD2, 0xD2, 0xD3, 0xD3, 0xD4, 0xD4, 0xD5, 0xD6, 0xD7, 0xD7,
+0xD8, 0xD8, 0xD9, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xD9, 0xD7, 0xD6, 0xD6, 0xDE,
+0x17, 0x2C, 0x36, 0x3B, 0x3E, 0x3E, 0x3D, 0x3C, 0x3A, 0x39, 0x37, 0x36, 0x35, 0x34, 0x33, 0x33,
+0x32, 0x31, 0x31, 0x30, 0x2F, 0x2F, 0x2E, 0x2D, 0x2D, 0x2C, 0x2B, 0x2B, 0x2A, 0x2A, 0x29, 0x30,
+0x3B, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x42,
+0x41, 0x40, 0x3F, 0x3E, 0x3D, 0x3C, 0x3B, 0x3B, 0x3A, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x35,
+0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x30, 0x30, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x2A, 0x29,
+0x29, 0x28, 0x27, 0x26, 0x25, 0x25, 0x24, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x20, 0x1D, 0x18, 0x14, 0x11, 0x0F, 0x0D, 0x0D, 0x0B, 0x0A, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B,
+0x03, 0xF0, 0xEB, 0xE7, 0xE5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8,
+0xE8, 0xE9, 0xE7, 0xDA, 0xCF, 0xC8, 0xC4, 0xC1, 0xC1, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7,
+0xC7, 0xC8, 0xC9, 0xCA, 0xCA, 0xCB, 0xCC, 0xCC, 0xCD, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD2,
+0xD3, 0xD4, 0xD3, 0xCC, 0xC4, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBF, 0xC0, 0xC1, 0xC2, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC8, 0xD3,
+0xE8, 0x1E, 0x2A, 0x30, 0x32, 0x31, 0x2F, 0x2D, 0x2A, 0x29, 0x27, 0x26, 0x26, 0x25, 0x24, 0x24,
+0x23, 0x22, 0x21, 0x21, 0x20, 0x20, 0x1F, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1C, 0x1D, 0x2B,
+0x37, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3F, 0x3E, 0x3C, 0x3B, 0x3A,
+0x3A, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 0x34, 0x34, 0x33, 0x32, 0x31, 0x30, 0x30,
+0x2F, 0x2E, 0x2D, 0x2D, 0x2C, 0x2C, 0x2B, 0x2B, 0x23, 0x05, 0xDD, 0xD2, 0xCC, 0xCA, 0xC9, 0xCA,
+0xD3, 0xE1, 0x09, 0x1C, 0x23, 0x26, 0x27, 0x28, 0x27, 0x26, 0x25, 0x24, 0x24, 0x23, 0x22, 0x22,
+0x22, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x12, 0xE4, 0xD7, 0xCF, 0xCB, 0xC9, 0xC8, 0xCB,
+0xD3, 0xE1, 0x09, 0x1C, 0x22, 0x25, 0x26, 0x26, 0x25, 0x24, 0x19, 0xE9, 0xDA, 0xD2, 0xCD, 0xCB,
+0xCA, 0xCA, 0xCB, 0xCC, 0xCD, 0xCD, 0xCE, 0xCF, 0xD0, 0xD0, 0xD1, 0xD1, 0xD2, 0xD2, 0xD3, 0xD3,
+0xD4, 0xD4, 0xD5, 0xD5, 0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD1, 0xC9, 0xC3, 0xBE, 0xBC, 0xBB,
+0xBB, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0xC0, 0xC1, 0xC2, 0xC3, 0xC3, 0xC4, 0xC5, 0xC5, 0xC6,
+0xC7, 0xC7, 0xC8, 0xC9, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCD, 0xCE, 0xCF, 0xCF, 0xD0, 0xD1, 0xD1,
+0xD2, 0xD2, 0xD3, 0xD3, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9,
+0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDD, 0xDE, 0xDE, 0xDD, 0xDB, 0xD9, 0xD8, 0xD8, 0xD7,
+0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDE,
+0xDE, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xDF, 0xDD, 0xDB, 0xD9, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDE,
+0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE1, 0xE1,
+0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xEA,
+0x1A, 0x2B, 0x36, 0x3C, 0x40, 0x42, 0x43, 0x43, 0x42, 0x41, 0x41, 0x40, 0x3F, 0x3E, 0x3D, 0x3D,
+0x3C, 0x3B, 0x3B, 0x3A, 0x39, 0x39, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 0x34, 0x34, 0x33, 0x35,
+0x3C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x42, 0x41, 0x41, 0x40, 0x3F, 0x3E,
+0x3E, 0x3D, 0x3C, 0x3C, 0x3B, 0x3B, 0x3A, 0x39, 0x39, 0x38, 0x37, 0x37, 0x36, 0x35, 0x35, 0x34,
+0x34, 0x33, 0x33, 0x32, 0x32, 0x31, 0x31, 0x30, 0x2F, 0x2F, 0x2E, 0x2E, 0x2D, 0x2D, 0x2C, 0x2C,
+0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x28, 0x27, 0x27, 0x26, 0x26, 0x26, 0x25, 0x25, 0x24, 0x24, 0x24,
+0x23, 0x23, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E,
+0x1D, 0x1C, 0x1C, 0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x17, 0x12, 0x0D, 0xFB, 0xF3,
+0xF0, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xEF, 0xEA, 0xE7, 0xE5, 0xE4,
+0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 0xEB, 0xEC,
+0xEC, 0xED, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xEC, 0xDF, 0xD5,
+0xCD, 0xC8, 0xC5, 0xC3, 0xC2, 0xC2, 0xC2, 0xC3, 0xC7, 0xCE, 0xD7, 0xE1, 0xEE, 0x0D, 0x15, 0x19,
+0x1A, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x14, 0xEC, 0xDD,
+0xD3, 0xCE, 0xCA, 0xC8, 0xC7, 0xC6, 0xC6, 0xC7, 0xCB, 0xD3, 0xDE, 0xEC, 0x11, 0x1A, 0x1E, 0x21,
+0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D,
+0x1D, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19,
+0x14, 0xEC, 0xDD, 0xD4, 0xCE, 0xCB, 0xC9, 0xC7, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC9, 0xC9, 0xCA,
+0xCA, 0xCB, 0xCB, 0xCC, 0xCC, 0xCD, 0xCD, 0xCE, 0xCE, 0xCF, 0xCF, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1,
+0xD0, 0xCA, 0xC4, 0xC0, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBD,
+0xBD, 0xBE, 0xBF, 0xBF, 0xC0, 0xC1, 0xC1, 0xC2, 0xC2, 0xC3, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xC1,
+0xC2, 0xC2, 0xC3, 0xC3, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC7, 0xC7, 0xC8, 0xC9, 0xC9,
+0xCA, 0xCA, 0xCB, 0xCB, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCE, 0xCD, 0xCC, 0xCC, 0xD3, 0xE0, 0x0B,
+0x20, 0x28, 0x2D, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x30, 0x30, 0x2F, 0x2F, 0x2E, 0x2E,
+0x2D, 0x2D, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x2A, 0x31, 0x3A, 0x41,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x43, 0x43, 0x42, 0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3D, 0x3D, 0x3D,
+0x3C, 0x3C, 0x3B, 0x3B, 0x3A, 0x39, 0x39, 0x38, 0x38, 0x37, 0x36, 0x36, 0x35, 0x35, 0x34, 0x33,
+0x33, 0x32, 0x32, 0x31, 0x31, 0x30, 0x30, 0x2F, 0x2F, 0x2E, 0x2C, 0x2A, 0x28, 0x27, 0x26, 0x25,
+0x25, 0x24, 0x24, 0x23, 0x22, 0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1C, 0x19, 0x15, 0x12, 0x0F, 0x0C, 0x09,
+0x06, 0x04, 0xFD, 0xFC, 0xFB, 0xFB, 0xFB, 0xFA, 0xFA, 0xFB, 0xF1, 0xE2, 0xD8, 0xD1, 0xCC, 0xC9,
+0xC7, 0xC6, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC8, 0xC8, 0xC9, 0xC9,
+0xCA, 0xCA, 0xCB, 0xCB, 0xCC, 0xCC, 0xCD, 0xCE, 0xCE, 0xCF, 0xCD, 0xC9, 0xC3, 0xBE, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBE, 0xC2, 0xC9, 0xD3, 0xDE, 0xEE, 0x11, 0x18, 0x1B,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1B, 0x1B, 0x1A, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17,
+0x17, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x14, 0x1D, 0x29, 0x33, 0x3A, 0x3F, 0x42, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x41, 0x40, 0x3F, 0x3E, 0x3E, 0x3D, 0x3C, 0x3C, 0x3B, 0x3B,
+0x3B, 0x3A, 0x3A, 0x39, 0x39, 0x39, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 0x34, 0x34, 0x34, 0x33,
+0x33, 0x32, 0x31, 0x30, 0x2A, 0x1F, 0x0C, 0xE6, 0xDC, 0xD7, 0xD4, 0xD2, 0xD1, 0xD0, 0xD0, 0xD0,
+0xD1, 0xD8, 0xE2, 0xF5, 0x18, 0x20, 0x24, 0x27, 0x29, 0x2A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A,
+0x2A, 0x2A, 0x29, 0x29, 0x23, 0x18, 0xF0, 0xE2, 0xDB, 0xD6, 0xD3, 0xD1, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD1, 0xD8, 0xE1, 0xF2, 0x16, 0x1E, 0x23, 0x26, 0x28, 0x29, 0x2A, 0x2A, 0x25, 0x1C, 0x05, 0xE6,
+0xDE, 0xD9, 0xD5, 0xD3, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3,
+0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD2, 0xCD, 0xC7, 0xC3,
+0xC0, 0xBE, 0xBD, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF, 0xBF,
+0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC2, 0xC2, 0xC3, 0xC3, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6,
+0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xCA, 0xCA, 0xCB, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCE,
+0xCE, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3,
+0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9, 0xD8, 0xD7,
+0xD6, 0xD5, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6,
+0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xDA, 0xD9, 0xD8, 0xD7,
+0xD6, 0xD5, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5,
+0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD9, 0xD9, 0xD9, 0xDA, 0xDB, 0xDD, 0xDF, 0xE1, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE8,
+0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB,
+0xEC, 0xEC, 0xEC, 0xEC, 0xED, 0xEF, 0xF5, 0x07, 0x0E, 0x11, 0x13, 0x14, 0x15, 0x16, 0x16, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
+0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x13, 0x12, 0x0F, 0x0B,
+0xFB, 0xF4, 0xF0, 0xEE, 0xED, 0xEC, 0xEB, 0xEB, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEA, 0xEA, 0xEA, 0xE9, 0xE7, 0xE5,
+0xE3, 0xE1, 0xE0, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE,
+0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE2, 0xF3, 0x1B,
+0x27, 0x2E, 0x34, 0x37, 0x3A, 0x3C, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3A, 0x3A, 0x3A, 0x39, 0x3A, 0x3F, 0x43,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43,
+0x42, 0x42, 0x41, 0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x36, 0x35,
+0x35, 0x35, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x30, 0x30,
+0x30, 0x2F, 0x2F, 0x2F, 0x2E, 0x2D, 0x2C, 0x2A, 0x29, 0x27, 0x26, 0x25, 0x24, 0x23, 0x23, 0x22,
+0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1B, 0x19, 0x17, 0x15, 0x13, 0x11, 0x10, 0x0E, 0x0D, 0x0C,
+0x0B, 0x0A, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 0x07,
+0x08, 0x0A, 0x07, 0xEC, 0xE2, 0xDA, 0xD4, 0xD0, 0xCD, 0xCB, 0xC9, 0xC8, 0xC7, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9,
+0xCA, 0xCA, 0xCA, 0xC7, 0xC4, 0xC0, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBF, 0xC5, 0xCA, 0xD0, 0xD6, 0xDB, 0xDF, 0xE3, 0xE5, 0xE7, 0xE9, 0xEA, 0xEB, 0xEC, 0xED,
+0xED, 0xED, 0xED, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEE,
+0x11, 0x20, 0x29, 0x30, 0x35, 0x39, 0x3C, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D,
+0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34, 0x33, 0x33,
+0x32, 0x31, 0x31, 0x30, 0x30, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C,
+0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x25, 0x24, 0x23, 0x22, 0x21,
+0x20, 0x20, 0x1F, 0x1C, 0x12, 0xEE, 0xE3, 0xDC, 0xD7, 0xD4, 0xD1, 0xCF, 0xCE, 0xCD, 0xCC, 0xCC,
+0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD,
+0xCE, 0xCE, 0xCE, 0xCD, 0xC9, 0xC5, 0xC1, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBC, 0xC0, 0xC5, 0xCA, 0xCF, 0xD3, 0xD7, 0xDB, 0xDE, 0xE1, 0xE4, 0xE6, 0xE9, 0xEA,
+0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1,
+0xF0, 0xF3, 0x13, 0x20, 0x28, 0x2F, 0x34, 0x38, 0x3A, 0x3D, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31,
+0x30, 0x30, 0x2F, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28,
+0x28, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x1F, 0x1E, 0x18, 0x0A, 0xEA, 0xE2, 0xDC, 0xD8, 0xD5, 0xD2, 0xD1, 0xCF,
+0xCE, 0xCD, 0xCC, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xCC, 0xCA, 0xC6, 0xC3, 0xC0, 0xBE, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC6, 0xC6,
+0xC6, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xCA, 0xCB, 0xCB, 0xCC, 0xCD, 0xCE, 0xCE, 0xCE, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCE,
+0xCE, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD4, 0xD5, 0xD6, 0xD6,
+0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2,
+0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6,
+0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8,
+0xE7, 0xE6, 0xE4, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+0xDE, 0xDD, 0xDC, 0xDB, 0xDB, 0xDA, 0xD9, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xDC, 0xE5, 0xF4, 0x16, 0x1F, 0x25, 0x2A, 0x2D, 0x30, 0x32,
+0x34, 0x35, 0x36, 0x37, 0x38, 0x38, 0x39, 0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x39, 0x3C, 0x3F, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3C, 0x3B, 0x3A, 0x39, 0x39, 0x38, 0x37, 0x37, 0x36,
+0x35, 0x35, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2E, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x2A, 0x29, 0x29,
+0x28, 0x28, 0x27, 0x27, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x23, 0x1F, 0x19, 0x10, 0xF3, 0xE9, 0xE3, 0xDF, 0xDC, 0xDA, 0xD8, 0xD6, 0xD5, 0xD3, 0xD3, 0xD2,
+0xD1, 0xD1, 0xD0, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0,
+0xCF, 0xCD, 0xCA, 0xC8, 0xC5, 0xC2, 0xC0, 0xBE, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0xC2,
+0xC5, 0xC8, 0xCB, 0xCE, 0xD0, 0xD2, 0xD4, 0xD6, 0xD7, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDD, 0xDE,
+0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE3, 0xEA, 0x07, 0x18, 0x20,
+0x26, 0x2A, 0x2E, 0x31, 0x33, 0x35, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3B, 0x3C, 0x3C, 0x3C, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+0x3B, 0x3B, 0x3A, 0x3A, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34,
+0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x2F,
+0x2F, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x28, 0x27, 0x23, 0x1F, 0x18,
+0x10, 0xF5, 0xEB, 0xE6, 0xE2, 0xDF, 0xDD, 0xDB, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD5, 0xD4, 0xD4,
+0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD0, 0xCD, 0xCA,
+0xC8, 0xC5, 0xC3, 0xC1, 0xC0, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBF, 0xC2, 0xC5, 0xC7, 0xCA, 0xCC, 0xCE, 0xD1, 0xD3, 0xD4, 0xD6, 0xD8, 0xD9, 0xDB,
+0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6,
+0xEB, 0x06, 0x16, 0x1E, 0x24, 0x28, 0x2C, 0x2F, 0x31, 0x33, 0x34, 0x35, 0x36, 0x37, 0x37, 0x38,
+0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x36, 0x35, 0x35, 0x34, 0x33,
+0x33, 0x32, 0x31, 0x31, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x1D, 0x18, 0x11, 0xFA, 0xEE, 0xE8,
+0xE4, 0xE1, 0xDF, 0xDD, 0xDB, 0xDA, 0xD8, 0xD7, 0xD6, 0xD6, 0xD5, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xCE, 0xCC, 0xCA, 0xC8, 0xC6, 0xC5,
+0xC4, 0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xC4, 0xC6, 0xC8, 0xCB, 0xCD, 0xD0, 0xD2, 0xD4, 0xD6,
+0xD8, 0xDA, 0xDC, 0xDE, 0xE0, 0xE2, 0xE4, 0xE6, 0xE5, 0xE2, 0xDF, 0xDC, 0xD9, 0xD7, 0xD5, 0xD3,
+0xD1, 0xD0, 0xCF, 0xCE, 0xCD, 0xCC, 0xCC, 0xCD, 0xCF, 0xD1, 0xD3, 0xD5, 0xD8, 0xDA, 0xDC, 0xDE,
+0xE1, 0xE3, 0xE5, 0xE7, 0xE9, 0xEB, 0xED, 0xF0, 0xEE, 0xEA, 0xE6, 0xE3, 0xE0, 0xDD, 0xDB, 0xD9,
+0xD8, 0xD6, 0xD5, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6,
+0xD6, 0xD5, 0xD5, 0xD5, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD3, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD2, 0xD4, 0xD7, 0xDB, 0xDE, 0xE3, 0xE7, 0xED, 0xF5, 0x0C, 0x12, 0x16, 0x19,
+0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x26, 0x27, 0x27, 0x28, 0x28, 0x29, 0x29,
+0x29, 0x29, 0x2A, 0x2B, 0x2D, 0x30, 0x33, 0x35, 0x37, 0x39, 0x3B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x39, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 0x37, 0x36, 0x36, 0x36,
+0x36, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x32, 0x32, 0x31, 0x31, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x28, 0x25, 0x23, 0x20, 0x1E, 0x1B,
+0x18, 0x14, 0x11, 0x0C, 0x03, 0xF4, 0xF0, 0xED, 0xEB, 0xE9, 0xE8, 0xE7, 0xE5, 0xE4, 0xE4, 0xE3,
+0xE2, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xDF, 0xDF, 0xDE, 0xDC, 0xD9, 0xD7, 0xD4, 0xD2, 0xD0,
+0xCF, 0xCD, 0xCC, 0xCB, 0xCA, 0xC9, 0xC8, 0xC7, 0xC7, 0xC6, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC7, 0xC9, 0xCA, 0xCC, 0xCE, 0xD0, 0xD1, 0xD2, 0xD4, 0xD5,
+0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0,
+0xE1, 0xE1, 0xE2, 0xE2, 0xE5, 0xEB, 0xF3, 0x0D, 0x15, 0x1A, 0x1D, 0x21, 0x23, 0x25, 0x27, 0x29,
+0x2A, 0x2B, 0x2D, 0x2E, 0x2E, 0x2F, 0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B,
+0x2A, 0x2A, 0x2A, 0x29, 0x27, 0x25, 0x23, 0x21, 0x1E, 0x1B, 0x18, 0x15, 0x12, 0x0E, 0x09, 0xF8,
+0xF2, 0xEF, 0xED, 0xEB, 0xE9, 0xE7, 0xE6, 0xE5, 0xE4, 0xE3, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xE0,
+0xE0, 0xDF, 0xDF, 0xDE, 0xDD, 0xDB, 0xD9, 0xD7, 0xD5, 0xD3, 0xD2, 0xD0, 0xCF, 0xCE, 0xCC, 0xCB,
+0xCB, 0xCA, 0xC9, 0xC8, 0xC8, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC9, 0xCA, 0xCB, 0xCD, 0xCE, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8,
+0xD9, 0xDA, 0xDB, 0xDC, 0xDC, 0xDD, 0xDE, 0xDE, 0xDF, 0xE0, 0xE0, 0xE1, 0xE1, 0xE2, 0xE4, 0xE8,
+0xEE, 0xF8, 0x0F, 0x15, 0x19, 0x1C, 0x1F, 0x21, 0x23, 0x25, 0x27, 0x28, 0x29, 0x2A, 0x2A, 0x2B,
+0x2C, 0x2C, 0x2D, 0x2D, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x2F,
+0x2F, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1E, 0x1B, 0x19, 0x16,
+0x13, 0x10, 0x0C, 0x05, 0xF5, 0xF1, 0xEE, 0xEC, 0xEA, 0xE9, 0xE7, 0xE6, 0xE5, 0xE4, 0xE3, 0xE2,
+0xE2, 0xE1, 0xE0, 0xE0, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDC, 0xDA, 0xD8, 0xD7, 0xD5,
+0xD4, 0xD3, 0xD2, 0xD1, 0xD0, 0xCF, 0xCE, 0xCE, 0xCD, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0,
+0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDC, 0xDC, 0xDD,
+0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0,
+0xE1, 0xE1, 0xE2, 0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE7,
+0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE7, 0xE5, 0xE3, 0xE2, 0xE0, 0xDF, 0xDD, 0xDC, 0xDB, 0xDA,
+0xD9, 0xD8, 0xD8, 0xD7, 0xD6, 0xD6, 0xD5, 0xD5, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD1, 0xD2, 0xD3, 0xD5, 0xD6, 0xD8, 0xD9, 0xDA, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE3, 0xE4, 0xE5,
+0xE7, 0xE8, 0xEA, 0xEB, 0xED, 0xEE, 0xF0, 0xF2, 0xF4, 0xF6, 0xF9, 0x04, 0x08, 0x0A, 0x0C, 0x0D,
+0x11, 0x15, 0x19, 0x1C, 0x1E, 0x20, 0x22, 0x24, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D,
+0x2E, 0x2F, 0x2F, 0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E,
+0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28,
+0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x19, 0x18, 0x17,
+0x16, 0x15, 0x13, 0x12, 0x11, 0x0F, 0x0E, 0x0C, 0x0A, 0x08, 0x05, 0xFC, 0xF9, 0xF7, 0xF5, 0xF4,
+0xF3, 0xF0, 0xED, 0xEA, 0xE8, 0xE6, 0xE4, 0xE2, 0xE0, 0xDF, 0xDE, 0xDC, 0xDB, 0xDA, 0xD9, 0xD9,
+0xD8, 0xD7, 0xD6, 0xD6, 0xD5, 0xD5, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD2, 0xD3, 0xD4, 0xD5, 0xD5,
+0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0,
+0xE0, 0xE0, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4, 0xE6, 0xE9, 0xEB, 0xEF,
+0xF3, 0xFD, 0x0B, 0x0F, 0x12, 0x15, 0x17, 0x19, 0x1A, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x21,
+0x22, 0x23, 0x23, 0x24, 0x24, 0x25, 0x25, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20,
+0x1F, 0x1E, 0x1D, 0x1C, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x13, 0x12, 0x11, 0x0F, 0x0E, 0x0C,
+0x0B, 0x09, 0x06, 0xFD, 0xF8, 0xF6, 0xF5, 0xF3, 0xF2, 0xF1, 0xF0, 0xEF, 0xEC, 0xEA, 0xE8, 0xE6,
+0xE5, 0xE4, 0xE2, 0xE1, 0xE0, 0xDF, 0xDE, 0xDD, 0xDC, 0xDB, 0xDA, 0xDA, 0xD9, 0xD8, 0xD8, 0xD7,
+0xD7, 0xD6, 0xD6, 0xD5, 0xD5, 0xD5, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD4, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7, 0xD8, 0xD9, 0xD9, 0xDA, 0xDB,
+0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE1, 0xE2, 0xE2, 0xE3,
+0xE5, 0xE7, 0xE9, 0xEC, 0xEE, 0xF2, 0xF7, 0x07, 0x0C, 0x0F, 0x12, 0x14, 0x16, 0x17, 0x18, 0x1A,
+0x1B, 0x1B, 0x1C, 0x1D, 0x1D, 0x1E, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22,
+0x22, 0x22, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
+0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1B, 0x1A, 0x19,
+0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x0F, 0x0E, 0x0D, 0x0B, 0x09, 0x07, 0x04, 0xFA,
+0xF8, 0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xF0, 0xEF, 0xEE, 0xEE, 0xED, 0xEC, 0xEA, 0xE9, 0xE7,
+0xE6, 0xE5, 0xE4, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC,
+0xDB, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9,
+0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF,
+0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9,
+0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEA,
+0xEA, 0xE9, 0xE8, 0xE7, 0xE7, 0xE6, 0xE5, 0xE4, 0xE4, 0xE3, 0xE3, 0xE2, 0xE2, 0xE1, 0xE1, 0xE0,
+0xE0, 0xE0, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC,
+0xDC, 0xDC, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xDA,
+0xDA, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xDF, 0xE0, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2,
+0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xEA, 0xEB, 0xED,
+0xEF, 0xF1, 0xF4, 0xF8, 0x04, 0x09, 0x0C, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+0x18, 0x19, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F,
+0x20, 0x20, 0x20, 0x20, 0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21,
+0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x1F,
+0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1C, 0x1C, 0x1B, 0x1B,
+0x1A, 0x1A, 0x19, 0x19, 0x18, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x14, 0x14, 0x13, 0x13, 0x12,
+0x12, 0x11, 0x11, 0x10, 0x10, 0x0F, 0x0F, 0x0E, 0x0D, 0x0C, 0x0A, 0x08, 0x02, 0xF8, 0xF5, 0xF3,
+0xF2, 0xF0, 0xEF, 0xEE, 0xED, 0xEC, 0xEB, 0xEA, 0xE9, 0xE9, 0xE8, 0xE8, 0xE7, 0xE7, 0xE6, 0xE6,
+0xE5, 0xE5, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8,
+0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xED, 0xEE, 0xF0, 0xF1, 0xF2, 0xF4, 0xF6, 0xF8, 0xFC, 0x05, 0x07,
+0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x15,
+0x15, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18,
+0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x14, 0x14, 0x13, 0x13,
+0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B,
+0x0B, 0x0A, 0x09, 0x08, 0x06, 0xFD, 0xF9, 0xF7, 0xF5, 0xF4, 0xF2, 0xF1, 0xF1, 0xF0, 0xEF, 0xEE,
+0xEE, 0xED, 0xEC, 0xEC, 0xEB, 0xEB, 0xEA, 0xEA, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE7, 0xE7, 0xE7,
+0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3,
+0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE1, 0xE1, 0xE1, 0xE1,
+0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4,
+0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8,
+0xE8, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF4,
+0xF5, 0xF6, 0xF8, 0xFA, 0x02, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F,
+0x0F, 0x0F, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11,
+0x11, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0B,
+0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x06, 0x05, 0x03, 0xFD, 0xFA,
+0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 0xF4, 0xF4, 0xF3, 0xF3, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1, 0xF0, 0xF0,
+0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF3,
+0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5,
+0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF3, 0xF3,
+0xF3, 0xF3, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2,
+0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5,
+0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFC, 0xFE, 0x01,
+0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07,
+0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08,
+0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07,
+0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x51, 0x60, 0x50,
+0xDF, 0xA9, 0xA0, 0xB3, 0x29, 0x57, 0x5E, 0x47, 0xD0, 0xA8, 0xA2, 0xB7, 0x2B, 0x56, 0x5D, 0x49,
+0xDA, 0xAC, 0xA2, 0xB1, 0xF3, 0x4D, 0x5C, 0x52, 0x26, 0xB9, 0xA5, 0xA9, 0xC5, 0x36, 0x55, 0x59,
+0x47, 0xE1, 0xB2, 0xA5, 0xAE, 0xD1, 0x3F, 0x56, 0x57, 0x41, 0xDA, 0xB2, 0xA7, 0xB0, 0xD3, 0x3D,
+0x54, 0x56, 0x43, 0xE5, 0xB6, 0xA9, 0xAE, 0xCA, 0x32, 0x4F, 0x55, 0x49, 0x21, 0xC0, 0xAD, 0xAC,
+0xBE, 0x16, 0x46, 0x53, 0x4F, 0x37, 0xD4, 0xB5, 0xAC, 0xB4, 0xD3, 0x36, 0x4D, 0x51, 0x45, 0x1B,
+0xC2, 0xB0, 0xB0, 0xC1, 0x14, 0x42, 0x4F, 0x4C, 0x37, 0xD9, 0xB9, 0xB0, 0xB7, 0xD2, 0x31, 0x49,
+0x4E, 0x43, 0x1F, 0xC7, 0xB4, 0xB4, 0xC4, 0x13, 0x3F, 0x4B, 0x48, 0x32, 0xD7, 0xBB, 0xB4, 0xBD,
+0xDD, 0x35, 0x47, 0x49, 0x39, 0xEB, 0xC2, 0xB6, 0xBC, 0xD4, 0x2D, 0x44, 0x47, 0x3A, 0x00, 0xC5,
+0xB9, 0xBD, 0xD5, 0x2D, 0x42, 0x45, 0x37, 0xEB, 0xC4, 0xBA, 0xC2, 0xE1, 0x32, 0x42, 0x41, 0x2D,
+0xD7, 0xC0, 0xBC, 0xCC, 0x1E, 0x3D, 0x43, 0x38, 0xF3, 0xC5, 0xBC, 0xC5, 0xF1, 0x38, 0x43, 0x3C,
+0x17, 0xC8, 0xBC, 0xC3, 0xED, 0x38, 0x43, 0x3A, 0x09, 0xC5, 0xBC, 0xC8, 0x1B, 0x3D, 0x43, 0x32,
+0xD9, 0xBF, 0xBF, 0xDA, 0x33, 0x43, 0x3C, 0x09, 0xC4, 0xBC, 0xCE, 0x2A, 0x42, 0x3E, 0x1A, 0xC6,
+0xBC, 0xCD, 0x29, 0x42, 0x3E, 0x12, 0xC4, 0xBD, 0xD4, 0x32, 0x43, 0x37, 0xDC, 0xBE, 0xC2, 0x09,
+0x3D, 0x41, 0x22, 0xC7, 0xBD, 0xD4, 0x33, 0x43, 0x32, 0xD1, 0xBC, 0xCA, 0x29, 0x42, 0x38, 0xDA,
+0xBD, 0xC6, 0x25, 0x42, 0x39, 0xDB, 0xBD, 0xC6, 0x27, 0x42, 0x37, 0xD5, 0xBD, 0xCB, 0x2E, 0x43,
+0x31, 0xCD, 0xBC, 0xD3, 0x36, 0x42, 0x23, 0xC5, 0xBE, 0xEA, 0x3E, 0x3E, 0xEC, 0xBF, 0xC5, 0x24,
+0x42, 0x36, 0xD2, 0xBD, 0xD0, 0x33, 0x42, 0x27, 0xC6, 0xBE, 0xE3, 0x3C, 0x3F, 0xF5, 0xC0, 0xC3,
+0x1F, 0x41, 0x38, 0xD7, 0xBD, 0xCC, 0x2E, 0x42, 0x2F, 0xCD, 0xBD, 0xD3, 0x35, 0x42, 0x28, 0xC8,
+0xBD, 0xD8, 0x38, 0x41, 0x25, 0xC7, 0xBD, 0xD9, 0x37, 0x42, 0x28, 0xCA, 0xBD, 0xD1, 0x31, 0x42,
+0x32, 0xD3, 0xBD, 0xC7, 0x22, 0x40, 0x3C, 0xF2, 0xC2, 0xBF, 0xDC, 0x36, 0x42, 0x31, 0xD4, 0xBE,
+0xC4, 0xF6, 0x3B, 0x41, 0x2B, 0xD0, 0xBE, 0xC5, 0xF6, 0x3B, 0x41, 0x2F, 0xD6, 0xBF, 0xC1, 0xDE,
+0x33, 0x42, 0x3A, 0x00, 0xC6, 0xBD, 0xC9, 0x18, 0x3C, 0x41, 0x32, 0xDF, 0xC2, 0xBE, 0xCD, 0x1E,
+0x3C, 0x41, 0x33, 0xE4, 0xC4, 0xBD, 0xC8, 0xF1, 0x36, 0x42, 0x3B, 0x1F, 0xCF, 0xBF, 0xC0, 0xD1,
+0x20, 0x3B, 0x41, 0x38, 0x15, 0xCC, 0xBF, 0xC0, 0xD1, 0x1E, 0x3A, 0x41, 0x3B, 0x21, 0xD3, 0xC1,
+0xBE, 0xC8, 0xE9, 0x31, 0x3F, 0x40, 0x33, 0xF7, 0xCB, 0xBF, 0xBF, 0xCD, 0x08, 0x34, 0x40, 0x40,
+0x32, 0xF5, 0xCC, 0xBF, 0xBF, 0xCA, 0xEA, 0x30, 0x3E, 0x41, 0x38, 0x1E, 0xD4, 0xC3, 0xBE, 0xC4,
+0xD7, 0x21, 0x39, 0x41, 0x3E, 0x30, 0xEE, 0xCC, 0xC0, 0xBF, 0xC8, 0xE1, 0x2A, 0x3C, 0x41, 0x3C,
+0x2B, 0xE4, 0xC9, 0xBF, 0xBF, 0xCA, 0xE5, 0x2C, 0x3C, 0x41, 0x3C, 0x2A, 0xE3, 0xC9, 0xBF, 0xBF,
+0xCA, 0xE5, 0x2C, 0x3C, 0x41, 0x3C, 0x2B, 0xE5, 0xCA, 0xBF, 0xBF, 0xC9, 0xE4, 0x2B, 0x3C, 0x41,
+0x3C, 0x2C, 0xE5, 0xCA, 0xBF, 0xC0, 0xCA, 0xE5, 0x2C, 0x3C, 0x41, 0x3B, 0x29, 0xE0, 0xC8, 0xBF,
+0xC1, 0xCE, 0xF8, 0x31, 0x3E, 0x40, 0x38, 0x20, 0xD6, 0xC4, 0xBF, 0xC4, 0xD6, 0x21, 0x38, 0x40,
+0x3D, 0x2F, 0xE9, 0xCA, 0xC0, 0xC1, 0xCE, 0x0C, 0x33, 0x3F, 0x3F, 0x33, 0x0C, 0xCE, 0xC0, 0xC0,
+0xCC, 0x07, 0x33, 0x3F, 0x3F, 0x31, 0xEF, 0xCB, 0xC0, 0xC2, 0xD3, 0x1E, 0x38, 0x40, 0x3B, 0x26,
+0xD8, 0xC3, 0xBF, 0xC9, 0xEF, 0x32, 0x3F, 0x3E, 0x2C, 0xDF, 0xC5, 0xBF, 0xC8, 0xEC, 0x32, 0x3F,
+0x3D, 0x29, 0xD9, 0xC3, 0xC0, 0xCD, 0x18, 0x38, 0x40, 0x37, 0x14, 0xCC, 0xBF, 0xC5, 0xE1, 0x30,
+0x3F, 0x3C, 0x24, 0xD2, 0xC1, 0xC3, 0xDB, 0x2D, 0x3E, 0x3C, 0x24, 0xD1, 0xC0, 0xC4, 0xE0, 0x31,
+0x3F, 0x3A, 0x18, 0xCB, 0xBF, 0xC8, 0x0E, 0x38, 0x3F, 0x32, 0xE0, 0xC3, 0xC1, 0xD7, 0x2C, 0x3E,
+0x3B, 0x1A, 0xCB, 0xC0, 0xCB, 0x1A, 0x3B, 0x3E, 0x2A, 0xD4, 0xC1, 0xC5, 0xED, 0x36, 0x3F, 0x31,
+0xDC, 0xC2, 0xC3, 0xDF, 0x32, 0x3F, 0x35, 0xE7, 0xC5, 0xC1, 0xD7, 0x2D, 0x3F, 0x38, 0x09, 0xC7,
+0xC0, 0xD1, 0x26, 0x3D, 0x3B, 0x1D, 0xCC, 0xC0, 0xCA, 0x18, 0x3A, 0x3E, 0x2A, 0xD5, 0xC1, 0xC4,
+0xE3, 0x33, 0x3F, 0x35, 0xED, 0xC6, 0xC0, 0xCF, 0x1F, 0x3B, 0x3E, 0x2B, 0xD7, 0xC2, 0xC3, 0xD8,
+0x2B, 0x3D, 0x3C, 0x24, 0xD3, 0xC1, 0xC3, 0xD9, 0x2A, 0x3D, 0x3C, 0x29, 0xD9, 0xC3, 0xC1, 0xCF,
+0x1A, 0x38, 0x3F, 0x35, 0x0F, 0xCC, 0xC1, 0xC4, 0xD8, 0x25, 0x3A, 0x3E, 0x33, 0x0B, 0xCD, 0xC1,
+0xC3, 0xD2, 0x1B, 0x37, 0x3E, 0x39, 0x25, 0xDA, 0xC6, 0xC1, 0xC6, 0xDA, 0x23, 0x38, 0x3E, 0x39,
+0x26, 0xDE, 0xC8, 0xC1, 0xC4, 0xD1, 0x0C, 0x31, 0x3D, 0x3E, 0x34, 0x1C, 0xD7, 0xC6, 0xC1, 0xC4,
+0xD0, 0xF3, 0x2E, 0x3B, 0x3E, 0x39, 0x29, 0xE8, 0xCE, 0xC3, 0xC1, 0xC6, 0xD4, 0x0E, 0x2F, 0x3B,
+0x3E, 0x3A, 0x2D, 0x0B, 0xD4, 0xC6, 0xC1, 0xC3, 0xCB, 0xDD, 0x1E, 0x33, 0x3C, 0x3E, 0x39, 0x2D,
+0x0F, 0xD6, 0xC8, 0xC2, 0xC2, 0xC8, 0xD5, 0xF9, 0x2B, 0x38, 0x3D, 0x3D, 0x36, 0x28, 0xF2, 0xD4,
+0xC7, 0xC2, 0xC2, 0xC7, 0xD3, 0xEC, 0x26, 0x35, 0x3C, 0x3E, 0x3A, 0x30, 0x1D, 0xE0, 0xCE, 0xC5,
+0xC1, 0xC3, 0xCA, 0xD7, 0x06, 0x29, 0x36, 0x3C, 0x3D, 0x3A, 0x30, 0x1E, 0xE1, 0xCF, 0xC6, 0xC2,
+0xC3, 0xC8, 0xD4, 0xEC, 0x25, 0x33, 0x3B, 0x3D, 0x3B, 0x34, 0x26, 0xF1, 0xD5, 0xC9, 0xC3, 0xC2,
+0xC5, 0xCE, 0xDE, 0x18, 0x2D, 0x38, 0x3D, 0x3D, 0x38, 0x2E, 0x1B, 0xDF, 0xCE, 0xC6, 0xC2, 0xC3,
+0xC9, 0xD5, 0xF1, 0x26, 0x34, 0x3B, 0x3D, 0x3B, 0x33, 0x24, 0xEC, 0xD3, 0xC8, 0xC3, 0xC2, 0xC7,
+0xD1, 0xE7, 0x22, 0x32, 0x3A, 0x3D, 0x3B, 0x34, 0x26, 0xEE, 0xD4, 0xC8, 0xC3, 0xC3, 0xC8, 0xD4,
+0xEF, 0x26, 0x34, 0x3B, 0x3D, 0x39, 0x30, 0x1C, 0xDF, 0xCD, 0xC5, 0xC2, 0xC5, 0xCF, 0xE2, 0x20,
+0x32, 0x3A, 0x3D, 0x3A, 0x30, 0x1C, 0xDE, 0xCD, 0xC4, 0xC2, 0xC7, 0xD2, 0xF0, 0x28, 0x36, 0x3C,
+0x3C, 0x35, 0x26, 0xEB, 0xD1, 0xC6, 0xC3, 0xC6, 0xD1, 0xEA, 0x27, 0x36, 0x3C, 0x3B, 0x33, 0x22,
+0xE1, 0xCD, 0xC4, 0xC3, 0xCA, 0xDA, 0x1A, 0x31, 0x3A, 0x3C, 0x37, 0x27, 0xE9, 0xD0, 0xC5, 0xC3,
+0xC9, 0xDA, 0x1C, 0x32, 0x3B, 0x3C, 0x34, 0x21, 0xDE, 0xCB, 0xC3, 0xC5, 0xCF, 0xE9, 0x29, 0x38,
+0x3C, 0x38, 0x2A, 0xED, 0xD0, 0xC5, 0xC4, 0xCC, 0xE1, 0x24, 0x36, 0x3C, 0x39, 0x2C, 0xF2, 0xD1,
+0xC5, 0xC4, 0xCB, 0xE0, 0x24, 0x36, 0x3C, 0x38, 0x2B, 0xED, 0xCF, 0xC5, 0xC4, 0xCD, 0xE3, 0x26,
+0x37, 0x3C, 0x38, 0x29, 0xE9, 0xCF, 0xC5, 0xC4, 0xCD, 0xE4, 0x26, 0x36, 0x3C, 0x38, 0x2A, 0xEE,
+0xD0, 0xC5, 0xC4, 0xCB, 0xDD, 0x1F, 0x33, 0x3B, 0x3A, 0x30, 0x18, 0xD8, 0xC9, 0xC4, 0xC6, 0xD1,
+0xEB, 0x28, 0x36, 0x3B, 0x39, 0x2E, 0x13, 0xD7, 0xC9, 0xC4, 0xC5, 0xCE, 0xE1, 0x20, 0x32, 0x3A,
+0x3B, 0x35, 0x26, 0xEC, 0xD3, 0xC8, 0xC4, 0xC6, 0xCD, 0xDE, 0x19, 0x2E, 0x38, 0x3B, 0x38, 0x30,
+0x1E, 0xE3, 0xD0, 0xC7, 0xC4, 0xC5, 0xCC, 0xD8, 0xF5, 0x27, 0x34, 0x3A, 0x3B, 0x37, 0x2E, 0x1E,
+0xE6, 0xD3, 0xCA, 0xC5, 0xC4, 0xC7, 0xCE, 0xDB, 0x05, 0x26, 0x32, 0x39, 0x3B, 0x39, 0x34, 0x2A,
+0x18, 0xE3, 0xD3, 0xCA, 0xC6, 0xC4, 0xC6, 0xCA, 0xD2, 0xDF, 0x0E, 0x26, 0x31, 0x37, 0x3A, 0x3A,
+0x37, 0x31, 0x27, 0x15, 0xE3, 0xD5, 0xCC, 0xC7, 0xC5, 0xC5, 0xC7, 0xCC, 0xD3, 0xDE, 0xF7, 0x21,
+0x2D, 0x34, 0x39, 0x3A, 0x3A, 0x37, 0x31, 0x29, 0x1C, 0xED, 0xDB, 0xD1, 0xCB, 0xC7, 0xC5, 0xC5,
+0xC7, 0xCA, 0xD0, 0xD9, 0xE6, 0x15, 0x25, 0x2E, 0x35, 0x38, 0x3A, 0x3A, 0x38, 0x34, 0x2E, 0x24,
+0x15, 0xE8, 0xDA, 0xD1, 0xCB, 0xC7, 0xC5, 0xC5, 0xC6, 0xC9, 0xCD, 0xD4, 0xDD, 0xEE, 0x1A, 0x26,
+0x2F, 0x34, 0x38, 0x3A, 0x3A, 0x38, 0x35, 0x30, 0x29, 0x1F, 0x09, 0xE2, 0xD7, 0xD0, 0xCB, 0xC7,
+0xC6, 0xC5, 0xC7, 0xC9, 0xCD, 0xD4, 0xDD, 0xEC, 0x17, 0x25, 0x2D, 0x33, 0x37, 0x39, 0x3A, 0x39,
+0x37, 0x33, 0x2D, 0x24, 0x18, 0xEC, 0xDD, 0xD4, 0xCE, 0xC9, 0xC7, 0xC6, 0xC6, 0xC8, 0xCB, 0xD1,
+0xD9, 0xE4, 0x0E, 0x20, 0x2A, 0x30, 0x35, 0x38, 0x39, 0x39, 0x37, 0x34, 0x2F, 0x27, 0x1C, 0xF3,
+0xDF, 0xD5, 0xCE, 0xCA, 0xC7, 0xC6, 0xC6, 0xC8, 0xCD, 0xD3, 0xDC, 0xEB, 0x18, 0x25, 0x2D, 0x33,
+0x37, 0x39, 0x39, 0x38, 0x35, 0x30, 0x28, 0x1C, 0xF3, 0xDF, 0xD4, 0xCE, 0xC9, 0xC7, 0xC6, 0xC7,
+0xCB, 0xD0, 0xD9, 0xE6, 0x14, 0x24, 0x2D, 0x33, 0x37, 0x39, 0x39, 0x37, 0x33, 0x2C, 0x23, 0x11,
+0xE4, 0xD7, 0xCF, 0xCA, 0xC7, 0xC6, 0xC8, 0xCC, 0xD2, 0xDC, 0xF0, 0x1D, 0x29, 0x30, 0x35, 0x38,
+0x38, 0x37, 0x33, 0x2C, 0x21, 0x0B, 0xE1, 0xD4, 0xCD, 0xC9, 0xC7, 0xC7, 0xCA, 0xD0, 0xD9, 0xEA,
+0x1A, 0x27, 0x30, 0x35, 0x38, 0x38, 0x36, 0x31, 0x29, 0x1C, 0xEE, 0xDB, 0xD1, 0xCB, 0xC8, 0xC7,
+0xC9, 0xCD, 0xD5, 0xE3, 0x13, 0x24, 0x2E, 0x34, 0x37, 0x38, 0x36, 0x32, 0x2A, 0x1D, 0xEE, 0xDB,
+0xD1, 0xCB, 0xC8, 0xC7, 0xC9, 0xCD, 0xD5, 0xE1, 0x0E, 0x23, 0x2D, 0x33, 0x37, 0x38, 0x36, 0x32,
+0x2B, 0x20, 0x00, 0xDF, 0xD4, 0xCD, 0xC9, 0xC7, 0xC8, 0xCB, 0xD0, 0xD8, 0xE5, 0x12, 0x24, 0x2D,
+0x33, 0x37, 0x38, 0x37, 0x33, 0x2E, 0x25, 0x17, 0xEA, 0xDB, 0xD2, 0xCD, 0xC9, 0xC8, 0xC8, 0xCA,
+0xCD, 0xD3, 0xDB, 0xE7, 0x12, 0x22, 0x2B, 0x31, 0x35, 0x37, 0x37, 0x36, 0x33, 0x2E, 0x27, 0x1C,
+0x00, 0xE3, 0xD9, 0xD2, 0xCD, 0xCA, 0xC8, 0xC8, 0xC8, 0xCA, 0xCD, 0xD1, 0xD6, 0xDD, 0xE8, 0x0C,
+0x1E, 0x27, 0x2E, 0x32, 0x35, 0x37, 0x37, 0x36, 0x35, 0x32, 0x2E, 0x29, 0x22, 0x18, 0xF7, 0xE5,
+0xDC, 0xD6, 0xD1, 0xCE, 0xCB, 0xC9, 0xC8, 0xC8, 0xC8, 0xC9, 0xCB, 0xCD, 0xD0, 0xD4, 0xD8, 0xDE,
+0xE5, 0xF0, 0x13, 0x1E, 0x25, 0x2B, 0x2F, 0x32, 0x34, 0x36, 0x37, 0x37, 0x36, 0x35, 0x33, 0x31,
+0x2E, 0x2A, 0x25, 0x1F, 0x17, 0x08, 0xEA, 0xE2, 0xDC, 0xD7, 0xD3, 0xD0, 0xCE, 0xCC, 0xCA, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0xCB, 0xCD, 0xCF, 0xD1, 0xD4, 0xD7, 0xDB, 0xE0, 0xE6, 0xEE, 0x0C,
+0x18, 0x1F, 0x25, 0x29, 0x2D, 0x2F, 0x32, 0x33, 0x35, 0x36, 0x36, 0x36, 0x36, 0x35, 0x34, 0x33,
+0x31, 0x2E, 0x2C, 0x28, 0x25, 0x20, 0x1A, 0x12, 0xF6, 0xEA, 0xE3, 0xDE, 0xD9, 0xD6, 0xD3, 0xD0,
+0xCE, 0xCD, 0xCB, 0xCA, 0xCA, 0xC9, 0xC9, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCF, 0xD1, 0xD3, 0xD6,
+0xD9, 0xDD, 0xE2, 0xE8, 0xF2, 0x0F, 0x18, 0x1E, 0x23, 0x27, 0x2A, 0x2D, 0x2F, 0x31, 0x33, 0x34,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x33, 0x31, 0x30, 0x2D, 0x2B, 0x28, 0x24, 0x1F, 0x1A, 0x11,
+0xF5, 0xE9, 0xE3, 0xDE, 0xD9, 0xD6, 0xD3, 0xD0, 0xCE, 0xCD, 0xCC, 0xCB, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCB, 0xCD, 0xCE, 0xD0, 0xD3, 0xD6, 0xDA, 0xDE, 0xE4, 0xEC, 0x09, 0x15, 0x1C, 0x21, 0x26, 0x29,
+0x2C, 0x2F, 0x31, 0x32, 0x33, 0x34, 0x35, 0x35, 0x35, 0x34, 0x33, 0x32, 0x30, 0x2D, 0x2A, 0x27,
+0x23, 0x1D, 0x16, 0x08, 0xEC, 0xE4, 0xDE, 0xD9, 0xD5, 0xD2, 0xD0, 0xCE, 0xCC, 0xCB, 0xCB, 0xCA,
+0xCB, 0xCC, 0xCD, 0xCF, 0xD1, 0xD5, 0xD9, 0xDD, 0xE4, 0xED, 0x0D, 0x18, 0x1E, 0x24, 0x28, 0x2B,
+0x2E, 0x30, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x33, 0x31, 0x2F, 0x2C, 0x29, 0x25, 0x1F, 0x18,
+0x0D, 0xEE, 0xE4, 0xDE, 0xD9, 0xD5, 0xD2, 0xCF, 0xCE, 0xCC, 0xCB, 0xCB, 0xCB, 0xCC, 0xCD, 0xCF,
+0xD1, 0xD4, 0xD7, 0xDC, 0xE1, 0xE8, 0xF6, 0x13, 0x1C, 0x22, 0x26, 0x2A, 0x2D, 0x2F, 0x31, 0x33,
+0x33, 0x34, 0x34, 0x33, 0x32, 0x31, 0x2F, 0x2C, 0x29, 0x26, 0x22, 0x1C, 0x15, 0x05, 0xEC, 0xE4,
+0xDF, 0xDA, 0xD7, 0xD4, 0xD1, 0xD0, 0xCE, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xCE, 0xCF,
+0xD1, 0xD2, 0xD5, 0xD7, 0xDA, 0xDD, 0xE0, 0xE5, 0xEA, 0xF1, 0x0B, 0x16, 0x1C, 0x21, 0x25, 0x28,
+0x2B, 0x2D, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x31, 0x30, 0x2F, 0x2D,
+0x2C, 0x2A, 0x27, 0x25, 0x22, 0x1F, 0x1C, 0x18, 0x13, 0x0C, 0xF5, 0xED, 0xE8, 0xE4, 0xE1, 0xDE,
+0xDC, 0xDA, 0xD8, 0xD7, 0xD5, 0xD4, 0xD3, 0xD2, 0xD1, 0xD0, 0xCF, 0xCF, 0xCE, 0xCE, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xCF, 0xCF,
+0xCF, 0xD0, 0xD0, 0xD1, 0xD1, 0xD2, 0xD2, 0xD3, 0xD4, 0xD4, 0xD5, 0xD6, 0xD6, 0xD7, 0xD8, 0xD9,
+0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE8, 0xE9,
+0xEB, 0xEC, 0xEE, 0xF1, 0xF3, 0xF7, 0x06, 0x0E, 0x13, 0x17, 0x1A, 0x1C, 0x1E, 0x20, 0x22, 0x24,
+0x25, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2D, 0x2E, 0x2F, 0x2F, 0x30, 0x30, 0x30, 0x31,
+0x31, 0x31, 0x31, 0x31, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x2F,
+0x2F, 0x2E, 0x2E, 0x2D, 0x2C, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22,
+0x20, 0x1F, 0x1D, 0x1B, 0x19, 0x17, 0x15, 0x12, 0x0E, 0x09, 0xF8, 0xF2, 0xEE, 0xEB, 0xE9, 0xE6,
+0xE4, 0xE3, 0xE1, 0xDF, 0xDE, 0xDC, 0xDB, 0xDA, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD4, 0xD3, 0xD3,
+0xD2, 0xD2, 0xD1, 0xD1, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF,
+0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 0xD1, 0xD1, 0xD2, 0xD3, 0xD3, 0xD4, 0xD5, 0xD6, 0xD8, 0xD9, 0xDA,
+0xDC, 0xDD, 0xDF, 0xE1, 0xE3, 0xE6, 0xE9, 0xEC, 0xF1, 0xFA, 0x0B, 0x10, 0x13, 0x16, 0x19, 0x1B,
+0x1D, 0x1F, 0x20, 0x22, 0x23, 0x24, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2B, 0x2C, 0x2D, 0x2D,
+0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2E,
+0x2E, 0x2D, 0x2C, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x26, 0x24, 0x23, 0x21, 0x1F, 0x1D, 0x1B,
+0x19, 0x16, 0x13, 0x0F, 0x0A, 0xF7, 0xF1, 0xED, 0xEA, 0xE7, 0xE5, 0xE3, 0xE1, 0xDF, 0xDD, 0xDC,
+0xDB, 0xDA, 0xD8, 0xD7, 0xD7, 0xD6, 0xD5, 0xD4, 0xD4, 0xD3, 0xD3, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD6, 0xD6,
+0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xDA,
+0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDF, 0xE0, 0xE0, 0xE1, 0xE2, 0xE2,
+0xE3, 0xE4, 0xE5, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEC, 0xED, 0xEE, 0xF0, 0xF2, 0xF4, 0xF7,
+0xFB, 0x05, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x15, 0x16,
+0x17, 0x17, 0x18, 0x18, 0x19, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E,
+0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23, 0x23,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A,
+0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10,
+0x10, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A,
+0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07,
+0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01,
+0x01, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07,
+0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07,
+0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06,
+0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0xCB, 0xCC, 0xCD,
+0xD5, 0xD5, 0xDF, 0x24, 0x24, 0x2D, 0x39, 0x39, 0x24, 0x00, 0x00, 0x39, 0x3D, 0x3D, 0xEF, 0xE8,
+0xE8, 0xD6, 0xD6, 0xD6, 0xD9, 0xD9, 0xD9, 0xC1, 0xC1, 0xC1, 0xB1, 0xB1, 0xB1, 0xB8, 0xB8, 0xB8,
+0xCA, 0xCA, 0xCA, 0xB2, 0xB2, 0xB2, 0xB8, 0xB8, 0xB8, 0xDF, 0xDF, 0xDE, 0xD1, 0xD1, 0xD7, 0xE8,
+0xE8, 0xCA, 0xC2, 0xC2, 0xC8, 0xC9, 0xC9, 0xB9, 0xB9, 0xB9, 0xB4, 0xB4, 0xB4, 0xAE, 0xAE, 0xAE,
+0xE0, 0xE0, 0xE0, 0xDA, 0xDA, 0xDA, 0xB7, 0xB7, 0xBB, 0xE0, 0xE0, 0xCB, 0xC5, 0xC5, 0xE5, 0xE9,
+0xE9, 0xC3, 0xC3, 0xC3, 0x16, 0x16, 0x16, 0x42, 0x42, 0x42, 0x38, 0x38, 0x38, 0xE0, 0xE0, 0xE0,
+0xD5, 0xD5, 0xF3, 0x2C, 0x2C, 0x26, 0x25, 0x25, 0x3B, 0x3B, 0x3B, 0x38, 0x38, 0x38, 0xC9, 0xC9,
+0xC9, 0x2A, 0x2A, 0x2A, 0x1E, 0x1E, 0x1E, 0xEF, 0xEF, 0xED, 0xD8, 0xD8, 0xE8, 0x1E, 0x1E, 0x3C,
+0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0xDB, 0xDB, 0xDB, 0xBF, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xB5, 0xB5,
+0xBD, 0xD4, 0xD4, 0xD2, 0xD2, 0xD2, 0xC7, 0xC7, 0xC7, 0x23, 0x23, 0x23, 0xD2, 0xD2, 0xD2, 0xE5,
+0xE5, 0xDD, 0xC8, 0xC8, 0xD4, 0xD7, 0xD7, 0xD9, 0xD9, 0xD9, 0x15, 0x15, 0x15, 0xC2, 0xC2, 0xC2,
+0xC0, 0xC0, 0xC7, 0xD3, 0xD3, 0x2A, 0x2A, 0x2A, 0xD3, 0xD3, 0xD3, 0xDF, 0xDF, 0xDF, 0x35, 0x35,
+0x36, 0x3B, 0x3B, 0x28, 0x25, 0x25, 0xDA, 0xDA, 0xDA, 0xCB, 0xCB, 0xCB, 0xB9, 0xB9, 0xBC, 0xCB,
+0xCB, 0xC0, 0xBF, 0xBF, 0xB8, 0xB8, 0xB8, 0xB6, 0xB6, 0xB6, 0xD4, 0xD4, 0xC0, 0xB6, 0xB6, 0xDD,
+0xDD, 0xDD, 0xD6, 0xD6, 0xD7, 0xE3, 0xE3, 0xF2, 0x30, 0x30, 0xDC, 0xD9, 0xD9, 0xC6, 0xC6, 0xC6,
+0x14, 0x14, 0x19, 0x2C, 0x2C, 0x35, 0x37, 0x37, 0x34, 0x34, 0x34, 0x1E, 0x1E, 0x19, 0xD9, 0xD9,
+0x41, 0x46, 0x46, 0x2B, 0x2B, 0x2B, 0x39, 0x39, 0x36, 0x2B, 0x2B, 0xD2, 0xD2, 0xD2, 0xD4, 0xD4,
+0xD4, 0xDA, 0xDA, 0xE0, 0x13, 0x13, 0x1A, 0x27, 0x27, 0x27, 0xF1, 0xF1, 0xF1, 0x32, 0x32, 0x32,
+0x3A, 0x3A, 0x3A, 0x17, 0x17, 0x15, 0xE5, 0xE5, 0xF3, 0x2D, 0x2D, 0x2E, 0x2F, 0x2F, 0x22, 0x17,
+0x17, 0xF1, 0xEC, 0xEC, 0xF1, 0xF1, 0xF1, 0xD4, 0xD4, 0xD4, 0x29, 0x29, 0x29, 0x38, 0x38, 0x38,
+0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x34, 0x34, 0x33, 0x30, 0x30, 0x36, 0x3B,
+0x3B, 0x28, 0x22, 0x22, 0x33, 0x33, 0x33, 0x1A, 0x1A, 0x1A, 0x0E, 0x0E, 0x0E, 0x26, 0x26, 0x26,
+0xE2, 0xE2, 0xE2, 0x29, 0x29, 0x2C, 0x38, 0x38, 0x2D, 0x29, 0x29, 0x2B, 0x2B, 0x2B, 0x2D, 0x2D,
+0x2D, 0x1F, 0x1F, 0x1F, 0xCF, 0xCF, 0xCF, 0xD2, 0xD2, 0xD2, 0xF1, 0xF1, 0xF1, 0x36, 0x36, 0x35,
+0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x31, 0x38, 0x38, 0x43, 0x43, 0x43, 0x13, 0x13, 0x13, 0x00, 0x00,
+0x00, 0x17, 0x17, 0x17, 0x1F, 0x1F, 0x1F, 0x28, 0x28, 0x2D, 0x39, 0x39, 0x23, 0x17, 0x17, 0xE5,
+0xE5, 0xE5, 0x22, 0x22, 0x22, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x3C, 0x3C, 0x35, 0x26, 0x26,
+0xDC, 0xD8, 0xD8, 0xCF, 0xCF, 0xCF, 0xE8, 0xE8, 0xE8, 0xD6, 0xD6, 0xD6, 0xE8, 0xE8, 0xE6, 0xE2,
+0xE2, 0xCE, 0xCB, 0xCB, 0x3E, 0x3E, 0x3E, 0x30, 0x30, 0x2F, 0x43, 0x43, 0x43, 0x31, 0x31, 0x34,
+0x3C, 0x3C, 0x39, 0x37, 0x37, 0x1F, 0x1F, 0x1F, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x26, 0x1F, 0x1F,
+0x2F, 0x2F, 0x2F, 0x2B, 0x2B, 0x2B, 0xD6, 0xD6, 0xD7, 0xE5, 0xE5, 0xDE, 0xDB, 0xDB, 0xD1, 0xD1,
+0xD1, 0x31, 0x31, 0x31, 0x1A, 0x1A, 0xEE, 0xD1, 0xD1, 0xCC, 0xCB, 0xCB, 0xE5, 0xE5, 0xE5, 0xEC,
+0xEC, 0xE3, 0xCD, 0xCD, 0xDD, 0xE2, 0xE2, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBE, 0xD8, 0xD8, 0xD5,
+0xD4, 0xD4, 0x1A, 0x1A, 0x1A, 0x21, 0x21, 0x24, 0x2E, 0x2E, 0x00, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+0x17, 0x17, 0xF3, 0xD4, 0xD4, 0x22, 0x27, 0x27, 0x25, 0x25, 0x25, 0x2C, 0x2C, 0x2C, 0x27, 0x27,
+0x2B, 0x2E, 0x3E, 0x3E, 0x36, 0x1F, 0x1F, 0x19, 0x13, 0x13, 0xF8, 0xF2, 0xF2, 0xE4, 0xE3, 0xE3,
+0x11, 0x13, 0x13, 0x1A, 0x1A, 0x1A, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0xDE, 0xDE, 0xDE, 0x0D,
+0x0D, 0x0D, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xC7, 0xC7, 0xC8, 0xCD, 0xCD, 0xC3, 0xBC, 0xBC,
+0xCB, 0xD3, 0xD3, 0xD6, 0xD6, 0xD6, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDA, 0xDA, 0xDA, 0xCA,
+0xCA, 0xCA, 0xCC, 0xCC, 0xCD, 0xD4, 0xD4, 0xD3, 0xD1, 0xD1, 0xE0, 0xE5, 0xE5, 0x1C, 0x1C, 0x1C,
+0x0D, 0x0D, 0x0D, 0x31, 0x31, 0x31, 0xEC, 0xEC, 0xEC, 0x37, 0x37, 0x37, 0x0D, 0x0D, 0x0D, 0x38,
+0x38, 0x2C, 0xC3, 0xC3, 0xC4, 0xC6, 0xC6, 0xD3, 0xD6, 0xD6, 0xDC, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C,
+0x2E, 0x2E, 0x2E, 0x2A, 0x2A, 0x2A, 0x27, 0x27, 0x27, 0x2A, 0x2A, 0x23, 0xF2, 0xF2, 0x11, 0x16,
+0x16, 0x32, 0x32, 0x32, 0x29, 0x29, 0x29, 0x2C, 0x2C, 0x2C, 0x23, 0x23, 0x23, 0x3B, 0x3B, 0x32,
+0x0D, 0x0D, 0xE4, 0xDE, 0xDE, 0xCF, 0xCF, 0xCF, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x2A, 0x2A,
+0x28, 0x1F, 0x1F, 0xE7, 0xDC, 0xDC, 0xE9, 0xE9, 0xE9, 0xE3, 0xE3, 0xE3, 0x16, 0x16, 0x16, 0xDE,
+0xDE, 0xDC, 0xD2, 0xD2, 0xD0, 0xCD, 0xCD, 0xDF, 0xE6, 0xE6, 0xDA, 0xDA, 0xDA, 0xDE, 0xDE, 0xDE,
+0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xCC, 0xCC, 0xCC, 0xCA, 0xCA, 0xCA, 0xE9, 0xE9, 0xDD, 0xCC, 0xCC,
+0xD8, 0xDA, 0xDA, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xBF, 0xBF, 0xC3, 0xC6, 0xC6, 0xC7, 0xC7,
+0xC7, 0xC8, 0xC8, 0xC8, 0xCC, 0xCC, 0xC9, 0xC4, 0xC4, 0x27, 0x27, 0x27, 0x19, 0x19, 0x19, 0x2F,
+0x2F, 0x2D, 0x29, 0x29, 0xD6, 0xD3, 0xD3, 0xC8, 0xC8, 0xC8, 0x25, 0x25, 0x0C, 0xD3, 0xD3, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x2D, 0x2D, 0x30, 0x37, 0x37, 0x3F, 0x40, 0x40, 0x35, 0x35, 0x35,
+0x2A, 0x2A, 0x2D, 0x38, 0x38, 0x2D, 0x28, 0x28, 0x16, 0x16, 0x16, 0x16, 0x19, 0x34, 0x34, 0x30,
+0x19, 0x19, 0x2B, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3B, 0x38, 0x38, 0xDC, 0xD8,
+0xD8, 0x19, 0x19, 0x19, 0x21, 0x21, 0x21, 0xF2, 0xF2, 0xF2, 0x27, 0x27, 0x27, 0x1F, 0x1F, 0x1F,
+0xE3, 0xE3, 0xE3, 0xC5, 0xC5, 0xC5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC6, 0xC6, 0xC6, 0xBD, 0xBD,
+0xBD, 0xDC, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC5, 0xC5, 0xC5, 0xC9, 0xC9, 0xCC,
+0xD7, 0xD7, 0xD4, 0xCF, 0xCF, 0xDF, 0xF2, 0xF2, 0xD7, 0xD2, 0xD2, 0xEE, 0xF2, 0xF2, 0xBD, 0xBD,
+0xBD, 0xC9, 0xC9, 0xC9, 0xDA, 0xDA, 0xDA, 0x28, 0x28, 0x28, 0xD3, 0xD3, 0xD4, 0xDA, 0xDA, 0xE1,
+0x0D, 0x0D, 0xD9, 0xCC, 0xCC, 0x1D, 0x28, 0x28, 0x2E, 0x2E, 0x2E, 0xE3, 0xE3, 0xE3, 0xD8, 0xD8,
+0xD8, 0xE3, 0xE3, 0xE3, 0x2E, 0x2E, 0x1E, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xBD, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBE, 0xCA, 0xCA, 0xCA, 0xC8, 0xC8, 0xC8, 0xE1, 0xE1, 0xF4, 0x28, 0x28, 0x30, 0x32, 0x32,
+0x2B, 0x2B, 0x2B, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3, 0x21, 0x21, 0x26, 0x2D, 0x2D, 0x27, 0x25,
+0x25, 0x30, 0x31, 0x31, 0xCB, 0xCB, 0xCB, 0xCE, 0xCE, 0xCE, 0xCD, 0xCD, 0xCD, 0xE1, 0xE1, 0xDD,
+0xD5, 0xD5, 0xD0, 0xCD, 0xCD, 0xC7, 0xC7, 0xC7, 0xBD, 0xBE, 0xBE, 0xD9, 0xD9, 0xD9, 0xC2, 0xC2,
+0xE1, 0xE1, 0xE1, 0xD9, 0xD9, 0xD9, 0xE1, 0xE1, 0xD6, 0xD1, 0xD1, 0x2B, 0x2B, 0x2B, 0xDA, 0xDA,
+0xDA, 0xED, 0xED, 0xE7, 0xDE, 0xDE, 0xE2, 0xE3, 0xE3, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x2B, 0x37,
+0x37, 0x2C, 0x28, 0x28, 0xDC, 0xDC, 0xDC, 0xCE, 0xCE, 0xD0, 0xD7, 0xD7, 0xCE, 0xCC, 0xCC, 0x12,
+0x12, 0x12, 0x20, 0x20, 0x1E, 0x12, 0x12, 0xD6, 0xCF, 0xCF, 0x20, 0x20, 0x20, 0xC4, 0xC4, 0xC4,
+0xC3, 0xC3, 0xCA, 0xD5, 0xD5, 0xE9, 0xE9, 0xE9, 0xC0, 0xC0, 0xC0, 0xC6, 0xC6, 0xC9, 0xCE, 0xCE,
+0xE9, 0xED, 0xED, 0xC8, 0xD7, 0xC8, 0xC8, 0xC8, 0xC7, 0xC7, 0xC7, 0xCD, 0xCD, 0xCD, 0xBE, 0xBE,
+0xBE, 0xF2, 0xF2, 0xF2, 0xCE, 0xCE, 0xCE, 0xDD, 0xDD, 0xDD, 0x24, 0x24, 0x1B, 0xC5, 0xC5, 0xC1,
+0xBE, 0xBE, 0xCA, 0xE6, 0xE6, 0xE4, 0xE3, 0xE3, 0x2A, 0x2F, 0x2F, 0x24, 0x24, 0x24, 0x20, 0x20,
+0x20, 0x16, 0x16, 0x16, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x37, 0x3A, 0x3F, 0x3F, 0x34,
+0x26, 0x26, 0x31, 0x33, 0x33, 0x07, 0xF2, 0xF2, 0x0D, 0x0D, 0x0D, 0x32, 0x32, 0x32, 0x36, 0x36,
+0x36, 0x12, 0x12, 0x12, 0xD9, 0xD9, 0xD9, 0x2E, 0x2E, 0x2C, 0x19, 0x19, 0xF4, 0xD7, 0xD7, 0xDC,
+0xE1, 0xE1, 0xD6, 0xD3, 0xD3, 0xCB, 0xCB, 0xCB, 0xCD, 0xCD, 0xCD, 0xBF, 0xBF, 0xBF, 0x20, 0x20,
+0x20, 0xF2, 0xF2, 0xEB, 0xD6, 0xD6, 0xDB, 0xE6, 0xE6, 0xE2, 0xE1, 0xE1, 0xF7, 0x00, 0x00, 0xBF,
+0xBF, 0xBF, 0xDD, 0xDD, 0xDD, 0xD6, 0xD6, 0xD5, 0xD3, 0xD3, 0xDF, 0x1C, 0x1C, 0x23, 0x26, 0x26,
+0xCC, 0xCC, 0xCC, 0xED, 0xED, 0xED, 0xBF, 0xBF, 0xBF, 0xC6, 0xC6, 0xE9, 0x41, 0x41, 0x3C, 0x34,
+0x34, 0x39, 0x3A, 0x3A, 0x41, 0x41, 0x41, 0x2F, 0x2F, 0x2F, 0x3E, 0x3E, 0x3E, 0x2F, 0x2F, 0x31,
+0x38, 0x38, 0x22, 0xDF, 0xDF, 0xD3, 0xD1, 0xD1, 0xCF, 0xCF, 0xCF, 0xC7, 0xC7, 0xC7, 0xD6, 0xD6,
+0xD7, 0x00, 0x00, 0xE9, 0xDD, 0xDD, 0xDA, 0xD9, 0xDA, 0xDD, 0xDD, 0xD6, 0xD4, 0xD4, 0xD3, 0xD3,
+0xD3, 0xC7, 0xC7, 0xC7, 0xE1, 0xE1, 0xD0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xCA, 0xCA, 0xCA, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF, 0xC4,
+0xC6, 0xC6, 0xCF, 0xCF, 0xCF, 0x19, 0x19, 0x22, 0x2F, 0x2F, 0x08, 0xDB, 0xDB, 0xE9, 0xE9, 0xE9,
+0xD4, 0xD4, 0xD4, 0xCA, 0xCA, 0xD2, 0xDD, 0xDD, 0xEA, 0xED, 0xED, 0xD0, 0xD0, 0xD0, 0xE1, 0xE1,
+0xF7, 0x24, 0x24, 0x0C, 0xF2, 0xF2, 0xD6, 0xD6, 0xD6, 0xCB, 0xCB, 0xC6, 0xBF, 0xBF, 0xBF, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0x3E, 0x3D, 0x3D, 0x34, 0x34, 0x34, 0x40, 0x40, 0x40, 0x38, 0x38, 0x38,
+0x34, 0x34, 0x37, 0x40, 0x40, 0x37, 0xF2, 0xF2, 0x1D, 0x29, 0x29, 0xF6, 0xDD, 0xDD, 0x1E, 0x22,
+0x22, 0xE1, 0xE1, 0xE1, 0xED, 0xED, 0xED, 0x16, 0x16, 0x16, 0xED, 0xED, 0xED, 0x27, 0x27, 0x25,
+0xF2, 0xF2, 0xEC, 0xE4, 0xE4, 0xE0, 0xDD, 0xDD, 0xE1, 0xE4, 0xE4, 0xEB, 0xED, 0xED, 0xCF, 0xCE,
+0xCE, 0xD3, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xBF, 0xBF, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC0, 0xC0, 0xC5, 0xC9, 0xC9, 0xC6, 0xC6, 0xC6, 0xBF, 0xBF,
+0xBF, 0xD3, 0xD3, 0xD3, 0xD8, 0xD8, 0xD8, 0xDB, 0xDB, 0xDD, 0x12, 0x12, 0xEB, 0xD5, 0xD5, 0xDF,
+0xF2, 0xF2, 0xDB, 0xD8, 0xD8, 0x24, 0x24, 0x24, 0x2A, 0x2A, 0x2A, 0x1E, 0x1E, 0x1E, 0x27, 0x27,
+0x1E, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE9, 0xEA, 0xEA, 0x24, 0x24, 0x24, 0xED, 0xED, 0xED, 0x1B,
+0x1B, 0xF4, 0xCE, 0xCE, 0xCC, 0xC9, 0xC9, 0xCB, 0xCD, 0xCD, 0xD9, 0xDB, 0xDB, 0xCF, 0xCF, 0xCF,
+0x15, 0x15, 0x15, 0xCD, 0xCD, 0xCF, 0x27, 0x27, 0x30, 0x40, 0x40, 0x37, 0x2D, 0x2D, 0x21, 0x1E,
+0x1E, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x12, 0x12, 0x11, 0x0D, 0x0D, 0xEA, 0xDF, 0xDF, 0x09,
+0x15, 0x15, 0x18, 0x18, 0x2A, 0x2C, 0x2C, 0x18, 0x18, 0x18, 0x2E, 0x2E, 0x25, 0xEA, 0xEA, 0xE0,
+0xDB, 0xDB, 0x12, 0x12, 0x12, 0xCE, 0xCE, 0xD8, 0x31, 0x31, 0x2F, 0x2D, 0x2D, 0xCC, 0xCC, 0xCC,
+0xDF, 0xDF, 0xE1, 0xED, 0xED, 0xD6, 0xC8, 0xC8, 0xF2, 0xF2, 0xF2, 0x32, 0x32, 0x2F, 0xD2, 0xD2,
+0xDE, 0x00, 0x00, 0x10, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x0F, 0xE2,
+0xE2, 0xD5, 0xD5, 0xD5, 0x1B, 0x1B, 0x1D, 0x25, 0x25, 0x0F, 0xDF, 0xDF, 0xCE, 0xCE, 0xCE, 0xCD,
+0xCD, 0xCE, 0xD8, 0xD8, 0xDA, 0xDC, 0xDC, 0xD2, 0xD7, 0xDC, 0xD4, 0xD2, 0xD2, 0xCE, 0xCD, 0xCD,
+0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xED, 0xED, 0xED, 0x23, 0x23, 0x23, 0x15,
+0x15, 0x19, 0x2A, 0x2A, 0x30, 0x3A, 0x3A, 0x37, 0x33, 0x33, 0x32, 0x32, 0x32, 0x29, 0x25, 0x25,
+0x2E, 0x2E, 0x2E, 0x21, 0x21, 0x21, 0xE2, 0xE2, 0xE2, 0x2B, 0x2B, 0x2B, 0x21, 0x21, 0x21, 0x2D,
+0x2D, 0x28, 0xDC, 0xDC, 0xE0, 0xED, 0xED, 0x23, 0x36, 0x36, 0x35, 0x34, 0x34, 0x3B, 0x3E, 0x3E,
+0x3E, 0x3D, 0x3D, 0x25, 0x25, 0x25, 0x2A, 0x2A, 0x2A, 0xDA, 0xDA, 0xDA, 0x28, 0x28, 0x28, 0x2F,
+0x2F, 0x2F, 0x31, 0x31, 0x18, 0xCC, 0xCC, 0xC6, 0xC0, 0xC0, 0xDB, 0x0D, 0x0D, 0xDB, 0xDA, 0xDA,
+0xD4, 0xD4, 0xD4, 0xCC, 0xCC, 0xCC, 0xC0, 0xC0, 0xC0, 0xD0, 0xD0, 0xD5, 0xE0, 0xE0, 0xD9, 0xD4,
+0xD4, 0xE1, 0xE7, 0xE7, 0x25, 0x25, 0x25, 0xC9, 0xC9, 0xC9, 0xDC, 0xDC, 0xDB, 0xD4, 0xD4, 0xDD,
+0xF2, 0xF2, 0xDC, 0xD4, 0xD4, 0xC7, 0xC7, 0xC7, 0xD5, 0xD5, 0xD5, 0xD3, 0xD3, 0xD3, 0xCB, 0xCB,
+0xCB, 0xCC, 0xCC, 0xCC, 0xCA, 0xCA, 0xC6, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xD7, 0xD8, 0xD8, 0x00,
+0x00, 0x00, 0xD0, 0xD0, 0xD0, 0xC4, 0xC4, 0xC6, 0xCA, 0xCA, 0xC5, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xD4, 0xD4, 0xD4, 0xDE, 0xDE, 0xDE, 0xE4, 0xE4, 0xDF, 0xD4, 0xD4, 0xD3, 0xD3, 0xCF, 0xCC, 0xCC,
+0xC2, 0xC1, 0xC1, 0xCE, 0xCE, 0xCE, 0xD3, 0xD3, 0xC8, 0xC0, 0xC0, 0xC6, 0xCB, 0xCB, 0xD5, 0xD5,
+0xD5, 0xDC, 0xDC, 0xD1, 0xC1, 0xC1, 0xCF, 0xDA, 0xDA, 0xE2, 0xE2, 0xE2, 0xEE, 0xEE, 0xE4, 0xD7,
+0xD7, 0xEE, 0x21, 0x21, 0x13, 0x11, 0x11, 0x21, 0x21, 0x21, 0xEA, 0xEA, 0x09, 0x1B, 0x1B, 0xDE,
+0xD4, 0xD4, 0x15, 0x15, 0x15, 0xD4, 0xD4, 0xD7, 0xE4, 0xE4, 0xEA, 0xF2, 0xF2, 0xEE, 0xEE, 0xEE,
+0xDC, 0xDC, 0xD9, 0xC8, 0xC8, 0xD1, 0xDC, 0xDC, 0xCD, 0xCD, 0xCD, 0xD9, 0xD9, 0xDF, 0x2E, 0x2E,
+0x1E, 0xEA, 0x1E, 0x2E, 0xEA, 0xEA, 0xEA, 0x2C, 0x2C, 0x2C, 0x18, 0x18, 0x15, 0xD4, 0xD4, 0xD7,
+0xEA, 0xEA, 0xF2, 0x11, 0x11, 0x09, 0xF2, 0xF2, 0x1C, 0x26, 0x26, 0x30, 0x32, 0x32, 0xE6, 0xDE,
+0xDE, 0xDA, 0xDA, 0xDA, 0x33, 0x33, 0x33, 0x2B, 0x2B, 0x2B, 0xCE, 0xCE, 0xCC, 0xC6, 0xC6, 0xCC,
+0xE4, 0xE4, 0xE1, 0xDE, 0xDE, 0xE4, 0xEE, 0xEE, 0x0F, 0x1B, 0x1B, 0xD5, 0xC4, 0xC4, 0xC9, 0xCA,
+0xCA, 0x24, 0x28, 0x28, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x2F, 0x2F, 0x2F, 0x23, 0x23, 0x22,
+0x1B, 0x1B, 0x28, 0x3C, 0x3C, 0x37, 0x32, 0x32, 0x1D, 0xDE, 0xDE, 0xEE, 0x0C, 0x0C, 0xCE, 0xCB,
+0xCB, 0x15, 0x15, 0x15, 0xF3, 0xF3, 0xF3, 0xE0, 0xE0, 0xDD, 0xCD, 0xCD, 0xD1, 0xD7, 0xD7, 0xF6,
+0x26, 0x26, 0x31, 0x35, 0x35, 0xF7, 0xEE, 0xEE, 0xCC, 0xCC, 0xCC, 0x24, 0x24, 0x24, 0x1D, 0x1D,
+0x25, 0x30, 0x30, 0x2D, 0x29, 0x29, 0xDA, 0xCF, 0xCF, 0xCE, 0xCE, 0xCE, 0xDB, 0xDB, 0xDB, 0x11,
+0x11, 0x16, 0x35, 0x35, 0x33, 0x2E, 0x2E, 0x2F, 0x30, 0x30, 0x2D, 0x2A, 0x2A, 0x10, 0xF3, 0xF3,
+0x1F, 0x1F, 0x1F, 0xDC, 0xDC, 0xDC, 0xC5, 0xC5, 0xC7, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD8, 0xE0,
+0xE0, 0x10, 0x15, 0x15, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xF8, 0x37, 0x37, 0x34, 0x30, 0x30, 0x27,
+0x1D, 0x1D, 0x27, 0x29, 0x29, 0x30, 0x30, 0x24, 0x24, 0x21, 0xCF, 0xCF, 0xD2, 0xD5, 0xD5, 0xD0,
+0xCE, 0xCE, 0xCA, 0xCA, 0xCA, 0xCD, 0xCD, 0xCD, 0xCC, 0xCC, 0xCF, 0xD2, 0xD2, 0xD8, 0xD8, 0xD8,
+0xC5, 0xC5, 0xC9, 0xD0, 0xD0, 0xDA, 0xEA, 0xEA, 0xDD, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 0xE2, 0xE2,
+0xCC, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0x11, 0x11, 0x11, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x1D,
+0x1D, 0xE6, 0xE5, 0xE5, 0xE0, 0xE0, 0xE5, 0x22, 0x22, 0xF0, 0xD8, 0xD8, 0xE5, 0xE7, 0xE7, 0x0C,
+0x0C, 0x06, 0xE5, 0xE5, 0xD4, 0xC9, 0xC9, 0xE4, 0xF3, 0xF3, 0x26, 0x26, 0x1A, 0xF3, 0x26, 0x26,
+0x26, 0x3A, 0x3A, 0x3A, 0x3B, 0x3B, 0x38, 0x2D, 0x2D, 0x30, 0x34, 0x34, 0x34, 0x34, 0x34, 0x2B,
+0x1F, 0x1F, 0x2D, 0x32, 0x32, 0x2C, 0x2A, 0x2A, 0x11, 0x11, 0x11, 0xD8, 0xD8, 0xD8, 0xEE, 0xEE,
+0xEE, 0xD9, 0xD9, 0xD9, 0xD5, 0xD5, 0xD0, 0xC1, 0xC1, 0xC5, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD2,
+0xCD, 0xCD, 0xCF, 0xD1, 0xD1, 0xF1, 0x20, 0x20, 0x0F, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0x26, 0x26, 0x26, 0x1C, 0x1C, 0x1C, 0xD0, 0xD0, 0xCE, 0xC8, 0xC8, 0xDE, 0x29, 0x29, 0x20,
+0x11, 0x11, 0x25, 0x2E, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2D, 0x2D, 0x2D, 0x18, 0x18,
+0x19, 0x24, 0x24, 0x25, 0x29, 0x29, 0x2D, 0x31, 0x31, 0x2E, 0x2B, 0x2B, 0x2D, 0x2E, 0x2E, 0x2B,
+0x2B, 0x2B, 0x3D, 0x3D, 0x3D, 0xEE, 0xEE, 0x17, 0x2E, 0x2E, 0x25, 0x17, 0x17, 0x23, 0x27, 0x27,
+0x1A, 0x17, 0x17, 0x1E, 0x1E, 0x1E, 0xE1, 0xE1, 0xE1, 0x1E, 0x1E, 0x1C, 0xEE, 0xEE, 0xDB, 0xCA,
+0xCA, 0xD3, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0x2B, 0x2F, 0x2F, 0xF3, 0xF3, 0xF3, 0x1E, 0x1E, 0x1D,
+0xEA, 0xEA, 0xE3, 0xDA, 0xDA, 0xEE, 0x1E, 0x1E, 0xDE, 0xD0, 0xD0, 0xE3, 0xE3, 0xE3, 0xEB, 0xEB,
+0xEB, 0x1A, 0x1A, 0x10, 0xDF, 0xDF, 0xE0, 0xE1, 0xE1, 0xD4, 0xCE, 0xCE, 0xD7, 0xD7, 0xD7, 0x0C,
+0x0C, 0xD4, 0xD4, 0xD5, 0xD7, 0xD7, 0xCF, 0xCC, 0xCC, 0xD3, 0xD3, 0xD3, 0xCE, 0xCE, 0xD7, 0x14,
+0x14, 0x13, 0x11, 0x11, 0xE7, 0xE5, 0xE5, 0xDD, 0xDD, 0xE8, 0x30, 0x30, 0x32, 0x34, 0x34, 0x3D,
+0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x20, 0x20, 0x2A, 0x38, 0x38, 0x31, 0x28, 0x28, 0x1F, 0x1C, 0x1C,
+0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x36, 0x3D, 0x3D, 0x33, 0x2C, 0x2C, 0x38, 0x38, 0x38, 0x3D, 0x3D,
+0x33, 0x17, 0x17, 0xE7, 0xDA, 0xDA, 0x2F, 0x2F, 0x2F, 0x33, 0x33, 0x31, 0x2F, 0x2F, 0x1F, 0xF3,
+0xF3, 0xE8, 0xE8, 0xE8, 0x20, 0x20, 0x11, 0xE8, 0x20, 0x20, 0x20, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0x0C, 0x0C, 0x0D, 0x11, 0x11, 0xEC, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0x09, 0x2F, 0x2F, 0x2D,
+0x2C, 0x2C, 0x1C, 0x00, 0x00, 0x18, 0x1A, 0x1A, 0xF0, 0xEE, 0xEE, 0x20, 0x20, 0x20, 0xD8, 0xD8,
+0xD8, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xD7, 0xD7, 0xD6, 0xD3, 0xD3, 0xDA, 0x00, 0x00, 0xED,
+0xE5, 0xE5, 0xE6, 0xE8, 0xE8, 0x13, 0x22, 0x22, 0x0F, 0xEB, 0xEB, 0x23, 0x28, 0x28, 0xE8, 0xE8,
+0xE8, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0xE5, 0xE5, 0xEA, 0x1A, 0x1A, 0xE5, 0xD1, 0xD1, 0xDE,
+0x0C, 0x0C, 0x13, 0x17, 0x17, 0xEA, 0xE5, 0xE5, 0xDD, 0xDD, 0xDD, 0xD1, 0xD1, 0xD1, 0xEB, 0xEB,
+0xE1, 0xCF, 0xCF, 0xD8, 0xE3, 0xE3, 0xDF, 0xDC, 0xDC, 0xEA, 0x00, 0x00, 0xD1, 0xD1, 0xD1, 0x1A,
+0x1A, 0x1A, 0xDF, 0xDF, 0xE0, 0xE5, 0xE5, 0xD9, 0xCD, 0xCD, 0xCE, 0xCE, 0xCE, 0xD9, 0xE8, 0xE8,
+0xDC, 0xD9, 0xD9, 0xCA, 0xCA, 0xCA, 0x29, 0x29, 0x29, 0x33, 0x33, 0x30, 0x11, 0x11, 0x1A, 0x22,
+0x22, 0xE3, 0xCD, 0xCD, 0xD1, 0xD3, 0xD3, 0xC3, 0xC3, 0xC3, 0xD2, 0xD2, 0xD2, 0xC3, 0xC3, 0xC3,
+0xC5, 0xC5, 0xC7, 0xC9, 0xC9, 0xCC, 0xCF, 0xCF, 0xFC, 0x22, 0x22, 0xE5, 0xE5, 0xE5, 0xEE, 0xEE,
+0xEC, 0xE5, 0xE5, 0xF3, 0x14, 0x14, 0xE9, 0xDC, 0xDC, 0xD6, 0xD5, 0xDA, 0xDA, 0xE8, 0x37, 0x37,
+0x34, 0x31, 0x31, 0x1D, 0x00, 0x00, 0x2D, 0x2D, 0x2A, 0xD2, 0xD2, 0xD1, 0xD0, 0xD0, 0xCD, 0xCA,
+0xCA, 0xC7, 0xC7, 0xC7, 0xE5, 0xE5, 0xE3, 0xDC, 0xDC, 0xCB, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE1,
+0xE1, 0xE1, 0x1C, 0x1C, 0xF5, 0xD9, 0xD9, 0xDE, 0xE3, 0xE3, 0x1A, 0x1E, 0x1E, 0xDA, 0xDA, 0xE1,
+0x17, 0x17, 0xF6, 0xE6, 0xE6, 0x1F, 0x26, 0x26, 0x30, 0x30, 0x2E, 0x20, 0x20, 0xE9, 0xD5, 0xD5,
+0xDC, 0xDF, 0xDF, 0x17, 0x17, 0x14, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xC6, 0xC3, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC5, 0xD2, 0xD2, 0xCB, 0xC5, 0xC5, 0xD1, 0xE1, 0xE1, 0xE0, 0xDF,
+0xDF, 0x04, 0x11, 0x11, 0xDF, 0xDF, 0xDF, 0xD5, 0xD5, 0xD5, 0x17, 0x17, 0x17, 0xDF, 0xDF, 0xDE,
+0xD1, 0xD1, 0xD8, 0x26, 0x26, 0x29, 0x2F, 0x2F, 0x1F, 0xE1, 0xE1, 0xED, 0x11, 0x11, 0x2B, 0x3A,
+0x3A, 0x35, 0x30, 0x30, 0x33, 0x35, 0x35, 0x31, 0x2F, 0x2F, 0x24, 0x23, 0x23, 0x3C, 0x3C, 0x3C,
+0x29, 0x29, 0x29, 0x1C, 0x1C, 0x17, 0xDE, 0xDE, 0xD6, 0xCA, 0xCA, 0xCE, 0xD4, 0xD4, 0xD1, 0xCE,
+0xCE, 0xE8, 0x27, 0x27, 0x29, 0x2A, 0x2A, 0x1F, 0x1F, 0x1F, 0x27, 0x27, 0x27, 0xF3, 0xF3, 0x0C,
+0x23, 0x23, 0x0F, 0xDE, 0xDE, 0xD6, 0xD0, 0xD0, 0xD2, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xC4, 0xC4,
+0xC4, 0xD6, 0xD6, 0xD4, 0xC7, 0xC7, 0xCF, 0xDC, 0xDC, 0xD3, 0xCB, 0xCB, 0xD2, 0xDB, 0xDB, 0xD4,
+0xD0, 0xD0, 0xD4, 0xD5, 0xD5, 0xD9, 0xD9, 0xD9, 0xE2, 0xE2, 0xE2, 0xEB, 0xEB, 0xEC, 0xEF, 0xEF,
+0xD3, 0xC5, 0xC5, 0xC4, 0xC4, 0xC4, 0xCB, 0xD3, 0xD3, 0xED, 0x0C, 0x0C, 0xD5, 0xD5, 0xD5, 0xDB,
+0xDB, 0xD5, 0xC4, 0xC4, 0xC5, 0xC6, 0xC6, 0xC8, 0xCA, 0xCA, 0xD4, 0xDC, 0xDC, 0xCC, 0xCB, 0xCB,
+0xCE, 0xCE, 0xCE, 0xCD, 0xCD, 0xD6, 0xE8, 0xE8, 0xEB, 0xEF, 0xEF, 0xE5, 0xE2, 0xE2, 0x00, 0x00,
+0x00, 0x27, 0x27, 0x21, 0xE8, 0xEF, 0x00, 0x00, 0x18, 0x19, 0x19, 0x2B, 0x2B, 0x1D, 0xD7, 0xD7,
+0xD2, 0xCE, 0xCE, 0xCB, 0xC9, 0xC9, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC9, 0xCE, 0xCE, 0xCF, 0xD1,
+0xD1, 0xCE, 0xCD, 0xCD, 0x21, 0x21, 0x21, 0x21, 0x21, 0xF1, 0xD9, 0xD9, 0xD6, 0xD3, 0xD3, 0x19,
+0x19, 0x19, 0xEF, 0xEF, 0xE6, 0xDC, 0xDC, 0xD9, 0xD5, 0xD5, 0xC4, 0xC4, 0xC4, 0xCC, 0xCC, 0xCA,
+0xC4, 0xC4, 0xC8, 0xCC, 0xCC, 0xF3, 0x17, 0x17, 0xDB, 0xDB, 0xDF, 0xEB, 0xEB, 0xEA, 0xE8, 0xE8,
+0x22, 0x25, 0x25, 0xE4, 0xE4, 0xF8, 0x1D, 0x1D, 0x2E, 0x3A, 0x2E, 0x1D, 0x1D, 0x2E, 0x3A, 0x3A,
+0x2E, 0x1B, 0x1B, 0x13, 0x0C, 0x0C, 0xF6, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x3B,
+0x3B, 0x3B, 0x2E, 0x2E, 0x2D, 0x22, 0x22, 0x21, 0x1B, 0x1B, 0x1D, 0x21, 0x21, 0x36, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x37, 0x24, 0x24, 0x28, 0x2C, 0x2C, 0x31, 0x35, 0x35, 0x28, 0x1D, 0x1D, 0x1A,
+0x19, 0x19, 0x23, 0x24, 0x24, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xCF, 0xCF,
+0xD6, 0xE0, 0xE0, 0xEA, 0x0C, 0x0C, 0x12, 0x16, 0x16, 0xEC, 0xE0, 0xE0, 0xDA, 0xD8, 0xD8, 0xDB,
+0xDB, 0xDB, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xDB, 0xD2, 0xD2, 0xD0, 0xCE, 0xCE, 0xD1, 0xD4, 0xD4,
+0xD2, 0xD1, 0xD1, 0xDE, 0xE0, 0xE0, 0xC5, 0xC5, 0xC5, 0x00, 0x00, 0x0E, 0x16, 0x16, 0x08, 0xEB,
+0xEB, 0xF1, 0x00, 0x00, 0x2A, 0x3A, 0x3A, 0x35, 0x32, 0x32, 0x3A, 0x3A, 0x3A, 0x38, 0x38, 0x38,
+0x22, 0x22, 0x1D, 0xE6, 0xE6, 0x16, 0x2E, 0x2E, 0x28, 0x21, 0x21, 0x30, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x35, 0x34, 0x34, 0x3A, 0x3A, 0x3A, 0x00, 0x00, 0xE5, 0xD6, 0xD6, 0xDA, 0xDF, 0xDF, 0xF3,
+0x1D, 0x1D, 0x0C, 0xF3, 0xF3, 0x19, 0x19, 0x19, 0x31, 0x31, 0x2D, 0x1B, 0x1B, 0xEF, 0xDD, 0xDD,
+0xD8, 0xD3, 0xD4, 0xE3, 0xEC, 0xEC, 0x1F, 0x1F, 0x1B, 0xCA, 0xCA, 0xD3, 0xE4, 0xE4, 0xD5, 0xD5,
+0xDF, 0xDF, 0xE7, 0x36, 0x36, 0x2E, 0x25, 0x25, 0x2A, 0x2F, 0x2F, 0x1B, 0x13, 0x13, 0x31, 0x31,
+0x33, 0x3A, 0x3A, 0x34, 0x2E, 0x2E, 0x30, 0x33, 0x33, 0x2C, 0x2B, 0x2B, 0x1D, 0x1D, 0x28, 0x38,
+0x38, 0x30, 0x26, 0x26, 0x2D, 0x30, 0x30, 0x2E, 0x2E, 0x2C, 0xEF, 0xEF, 0x10, 0x1B, 0x1B, 0x00,
+0xE4, 0xE4, 0x12, 0x13, 0x13, 0xE4, 0xE4, 0x08, 0x1D, 0x1D, 0x1C, 0x1B, 0x1B, 0xF2, 0xEC, 0xEC,
+0x25, 0x25, 0x27, 0x29, 0x29, 0x20, 0x13, 0x13, 0x1F, 0x20, 0x20, 0x33, 0x33, 0x2E, 0x29, 0x29,
+0x2E, 0x32, 0x32, 0x10, 0x1F, 0x2E, 0x32, 0x32, 0x26, 0x10, 0x10, 0xEF, 0xE4, 0xE4, 0xE9, 0xEF,
+0xEF, 0xE5, 0xE0, 0xE0, 0x25, 0x29, 0x29, 0x00, 0xF3, 0xF3, 0xE6, 0xE6, 0xE6, 0x2C, 0x2C, 0x2C,
+0x20, 0x20, 0x20, 0x2D, 0x2D, 0x2B, 0x19, 0x19, 0xF9, 0xD5, 0xD5, 0xD7, 0xDA, 0xDA, 0xE1, 0xEC,
+0xEC, 0x13, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E,
+0x2D, 0x2D, 0x2D, 0x37, 0x37, 0x37, 0x23, 0x23, 0x25, 0x2D, 0x2D, 0x20, 0xE1, 0xE1, 0xE1, 0xE1,
+0xE1, 0xE4, 0xE9, 0xE9, 0xE5, 0xE2, 0xE2, 0x12, 0x1D, 0x1D, 0x0D, 0x0C, 0x0C, 0x2C, 0x2C, 0x2B,
+0x1E, 0x1E, 0x13, 0xE1, 0xE1, 0xF7, 0x1D, 0x1D, 0xEF, 0xDC, 0xDC, 0xE5, 0x00, 0x00, 0xDF, 0xDA,
+0xDA, 0xE4, 0xE4, 0xE4, 0x10, 0x10, 0x13, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0xE4, 0xE4, 0xDE,
+0xD9, 0xD9, 0xEF, 0x20, 0x20, 0x14, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x20, 0x20, 0x20, 0xF4, 0xF4,
+0xDE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xD4, 0x00, 0x00, 0xDD, 0xD1, 0xD1, 0xE2, 0xEC, 0xEC, 0xE5,
+0xE5, 0xE5, 0xDB, 0xDB, 0xD8, 0xD1, 0xD1, 0xC9, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xDB, 0xDB, 0xDC, 0xE1, 0xE1, 0xEF, 0x16, 0x16, 0x1A, 0x1E, 0x1E, 0xDE, 0xD3,
+0xD3, 0xD9, 0xD9, 0xD8, 0xCA, 0xCA, 0xCC, 0xCE, 0xEA, 0x13, 0x13, 0x32, 0x32, 0x32, 0x30, 0x30,
+0x32, 0x34, 0x34, 0x2A, 0x1C, 0x1C, 0xE5, 0xDE, 0xDE, 0xD6, 0xD6, 0xDA, 0xEF, 0xEF, 0x16, 0x21,
+0x21, 0x21, 0x20, 0x20, 0x27, 0x28, 0x28, 0x28, 0x28, 0x22, 0x10, 0x10, 0x15, 0x18, 0x18, 0xEE,
+0xE1, 0xE1, 0xDF, 0xDF, 0xDC, 0xD1, 0xD1, 0xCB, 0xC6, 0xC6, 0xC8, 0xC9, 0xC9, 0xDB, 0xDC, 0xDB,
+0xD4, 0xD4, 0xD0, 0xCB, 0xCB, 0xCA, 0xC9, 0xC9, 0xC7, 0xC7, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xCA, 0xDC, 0xDC, 0xD1, 0xD1, 0xD2, 0xD3, 0xD3, 0xD7, 0xDC, 0xDC, 0xE5, 0xEC, 0xEC, 0xE4, 0xDC,
+0xDC, 0xEC, 0xEC, 0xED, 0xEF, 0xEF, 0xE2, 0xD6, 0xD6, 0xD2, 0xCF, 0xCF, 0xDA, 0xEC, 0xEC, 0x10,
+0x1C, 0x1C, 0xEE, 0xDB, 0xDB, 0xF1, 0x20, 0x20, 0x0B, 0xE3, 0xE3, 0xDB, 0xD5, 0xD5, 0xD3, 0xD2,
+0xD2, 0xDC, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD0, 0xD0, 0xD0, 0x20, 0x20, 0x20, 0x24, 0x24, 0x1C,
+0xD6, 0xD6, 0xD8, 0xDC, 0xDC, 0xD2, 0xCB, 0xCB, 0xC6, 0xC6, 0xC6, 0xD2, 0xF4, 0xF4, 0xDE, 0xD2,
+0xD2, 0xD1, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xCD, 0xCD, 0xCD, 0xD8, 0xD8, 0xDE, 0x20, 0x20, 0x20,
+0x21, 0x21, 0x10, 0xE5, 0xE5, 0xDB, 0xD4, 0xD4, 0xDF, 0xEC, 0xEC, 0x16, 0x1A, 0x1A, 0x2C, 0x2C,
+0x2C, 0x27, 0x27, 0x1A, 0xE3, 0xE3, 0xD8, 0xD0, 0xD0, 0xE0, 0x13, 0x13, 0xEE, 0xE1, 0xE1, 0xE9,
+0x00, 0x00, 0x0A, 0x0B, 0x0B, 0xD4, 0xD3, 0xD3, 0xD5, 0xD5, 0xD6, 0x10, 0x10, 0x18, 0x22, 0x22,
+0x28, 0x2D, 0x2D, 0x28, 0x22, 0x22, 0x23, 0x24, 0x24, 0x1F, 0x1A, 0x1A, 0x23, 0x24, 0x24, 0x30,
+0x30, 0x28, 0xD3, 0xD3, 0xCB, 0xC7, 0xC7, 0xD4, 0xEF, 0xEF, 0xDA, 0xCF, 0xCF, 0x0A, 0x28, 0x28,
+0x31, 0x31, 0x31, 0x22, 0x22, 0x19, 0xE5, 0xE5, 0xD6, 0xCB, 0xCB, 0xCE, 0xD1, 0xD1, 0xE2, 0x13,
+0x13, 0xED, 0xEC, 0xEC, 0xE7, 0xE7, 0xDF, 0xD7, 0xD7, 0xD4, 0xD2, 0xD2, 0xD3, 0xD4, 0xD4, 0x17,
+0x21, 0x21, 0xE3, 0xE3, 0xEA, 0x13, 0x13, 0x10, 0x0B, 0x0B, 0xEA, 0xE0, 0xE0, 0xDC, 0xDA, 0xDA,
+0xD1, 0xD1, 0xD0, 0xCC, 0xCC, 0xD9, 0xF4, 0xF4, 0x13, 0x1C, 0x1C, 0xED, 0xE5, 0xE5, 0xF4, 0xF4,
+0xF4, 0xF4, 0xF4, 0xDC, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD6, 0xD6, 0xD8, 0xDE, 0xDE, 0xEE, 0x18,
+0x18, 0xE1, 0xD0, 0xD0, 0xCF, 0xCF, 0xD3, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26,
+0x26, 0x27, 0x2B, 0x2B, 0x33, 0x38, 0x38, 0x31, 0x26, 0x26, 0x38, 0x38, 0x35, 0xF4, 0xF4, 0x08,
+0x0F, 0x0F, 0x2C, 0x38, 0x38, 0x2B, 0x2B, 0xF8, 0x11, 0x38, 0x38, 0x2B, 0x2B, 0x12, 0xC8, 0xC8,
+0xCB, 0xCE, 0xCE, 0xD0, 0xD1, 0xD1, 0xD0, 0xCF, 0xCF, 0xCD, 0xCB, 0xCB, 0xCC, 0xCE, 0xCE, 0xCB,
+0xC7, 0xC7, 0xD0, 0xDA, 0xDA, 0xE2, 0xF0, 0xF0, 0xEB, 0xEA, 0xEA, 0x03, 0x0B, 0x0B, 0xD4, 0xD2,
+0xD2, 0x0F, 0x0F, 0x0F, 0xE7, 0xE7, 0xE4, 0xD8, 0xD8, 0xD7, 0xD7, 0xD7, 0xEB, 0x1F, 0x1F, 0x23,
+0x27, 0x27, 0x25, 0x23, 0x23, 0x19, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x14, 0x18, 0x18, 0xCD, 0xCB,
+0xCB, 0xE5, 0xE5, 0xED, 0x22, 0x22, 0x18, 0xEA, 0xEA, 0x00, 0x15, 0x15, 0xE9, 0xDA, 0xDA, 0xD7,
+0xD4, 0xD4, 0xD0, 0xCD, 0xCD, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xD0, 0x22, 0x22, 0x24, 0x26, 0x26,
+0x25, 0x25, 0x25, 0x1D, 0x13, 0x13, 0x0D, 0x00, 0x00, 0x08, 0x0B, 0x0B, 0x06, 0x00, 0x00, 0xDD,
+0xDC, 0xDC, 0xDA, 0xDA, 0xDB, 0xDC, 0xDC, 0x1B, 0x32, 0x32, 0x31, 0x30, 0x30, 0x21, 0xF0, 0xF0,
+0x00, 0x0F, 0x0F, 0x2C, 0x33, 0x33, 0x26, 0x26, 0x23, 0xD0, 0xD0, 0xD2, 0xD6, 0xD6, 0xD5, 0xD4,
+0xD4, 0xCF, 0xCB, 0xCB, 0xD4, 0xE0, 0xE0, 0xE5, 0xE8, 0xE8, 0x1D, 0x1D, 0x1C, 0x15, 0x15, 0x14,
+0x12, 0x12, 0x15, 0x17, 0x17, 0xE8, 0xD8, 0xD8, 0xDF, 0xE2, 0xE2, 0xDD, 0xDD, 0xE3, 0x12, 0x12,
+0x14, 0x15, 0x15, 0x1D, 0x23, 0x23, 0x11, 0xE8, 0xE8, 0xE6, 0xE6, 0xE7, 0x1D, 0x1D, 0x15, 0x00,
+0x00, 0x1B, 0x26, 0x26, 0x19, 0xF0, 0xF0, 0xDF, 0xDD, 0xDF, 0xF4, 0xF4, 0xE7, 0xDF, 0xDF, 0xD9,
+0xD5, 0xD5, 0xCE, 0xCA, 0xCA, 0xC8, 0xC8, 0xD2, 0x27, 0x27, 0x2D, 0x33, 0x33, 0x2B, 0x20, 0x20,
+0x06, 0xED, 0xED, 0x1D, 0x1D, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x21, 0x22, 0x22, 0x20, 0x20,
+0x1B, 0x12, 0x12, 0x11, 0x0F, 0x0F, 0xDD, 0xD4, 0xD4, 0xE8, 0xE8, 0x16, 0x29, 0x29, 0x21, 0x15,
+0x15, 0xF4, 0xEA, 0xEA, 0x1D, 0x1D, 0x1B, 0x19, 0x19, 0x1F, 0x24, 0x24, 0x0E, 0xF4, 0xF0, 0xE0,
+0xE0, 0xD4, 0xCC, 0xCC, 0xD4, 0xDF, 0xDF, 0xD5, 0xCD, 0xCD, 0xD3, 0xDA, 0xDA, 0xD8, 0xD7, 0xD7,
+0xDC, 0xE2, 0xE2, 0xDB, 0xD5, 0xD5, 0xD8, 0xDB, 0xDB, 0xCE, 0xC8, 0xC8, 0xCB, 0xCC, 0xCC, 0xD0,
+0xD0, 0xD0, 0xC8, 0xC8, 0xC8, 0xCA, 0xCA, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xE7, 0x31, 0x31,
+0x25, 0x12, 0x12, 0x15, 0x17, 0x17, 0xF4, 0xE4, 0xE4, 0xE8, 0xED, 0xED, 0xE7, 0xE4, 0xE4, 0x2F,
+0x35, 0x35, 0x30, 0x30, 0x2F, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x21, 0x15, 0x15, 0x14, 0x12, 0x12,
+0x21, 0x2B, 0x2B, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xD2, 0xD2, 0xD9, 0xE6,
+0xE6, 0xE7, 0xE8, 0xE8, 0x14, 0x23, 0x23, 0x25, 0x26, 0x26, 0x27, 0x28, 0x28, 0x14, 0xE1, 0xE1,
+0xE0, 0xDF, 0xDF, 0x29, 0x2B, 0x2A, 0x20, 0x20, 0x1F, 0x1E, 0x1E, 0x26, 0x2D, 0x2D, 0x2F, 0x30,
+0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x36, 0x36, 0x36, 0x2E, 0x2C, 0x2B, 0x27, 0x27, 0x29,
+0x2B, 0x2B, 0x2F, 0x33, 0x33, 0x24, 0xF4, 0xF4, 0x08, 0x0F, 0x0F, 0xE5, 0xDF, 0xDF, 0xDF, 0xDF,
+0xE6, 0x22, 0x22, 0x20, 0x1E, 0x1E, 0x2E, 0x36, 0x36, 0x35, 0x30, 0x30, 0x2E, 0x2D, 0x2D, 0x2E,
+0x2E, 0x2E, 0x2D, 0x2D, 0x30, 0x34, 0x34, 0x2F, 0x2B, 0x2B, 0x29, 0x27, 0x27, 0x06, 0xE8, 0xE8,
+0x21, 0x21, 0x1C, 0xE4, 0xE4, 0xF7, 0x19, 0x19, 0x27, 0x30, 0x30, 0x1B, 0x0B, 0x0B, 0x17, 0x17,
+0x1F, 0x26, 0x26, 0x1A, 0xF0, 0xF0, 0x0B, 0x15, 0x15, 0xF1, 0xED, 0xF4, 0x22, 0x22, 0x28, 0x2D,
+0x2D, 0x30, 0x33, 0x33, 0xE6, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xCA, 0xCA, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xCB, 0xCB, 0xD2, 0xDB, 0xDB, 0xD9, 0xD8, 0xD8,
+0xD7, 0xD7, 0xD6, 0xD5, 0xD5, 0xCF, 0xCA, 0xCA, 0xC9, 0xC9, 0xC9, 0xCC, 0xCC, 0xCB, 0xCA, 0xCA,
+0x13, 0x36, 0x36, 0x30, 0x30, 0x34, 0x36, 0x36, 0x32, 0x2C, 0x2C, 0x25, 0x1B, 0x1B, 0x1D, 0x23,
+0x23, 0x2B, 0x34, 0x34, 0x35, 0x36, 0x36, 0x16, 0xD0, 0xD0, 0xD3, 0xD7, 0xD7, 0xDA, 0xDD, 0xDD,
+0xDE, 0xDE, 0xDE, 0xE3, 0xE8, 0xE8, 0x12, 0x21, 0x21, 0x27, 0x2D, 0x2D, 0x2A, 0x27, 0x27, 0x10,
+0xEB, 0xEB, 0x0F, 0x12, 0x12, 0xE0, 0xE0, 0xDE, 0xD2, 0xD2, 0xE0, 0x1F, 0x1F, 0x20, 0x21, 0x21,
+0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x20, 0x1C, 0x1C, 0x21, 0x26, 0x26, 0xDD, 0xCD, 0xCD, 0xD9,
+0xDC, 0xDC, 0xCA, 0xCA, 0xCF, 0xDB, 0xDB, 0xD3, 0xCC, 0xCC, 0xCB, 0xCA, 0xCA, 0xD6, 0xE8, 0xE8,
+0x19, 0x28, 0x28, 0x23, 0x1F, 0x1F, 0x13, 0x0B, 0x0B, 0xE7, 0xE6, 0xE8, 0x1A, 0x1A, 0x1B, 0x1E,
+0x1E, 0x21, 0x24, 0x24, 0x00, 0xDB, 0xDB, 0xDD, 0xE0, 0xE0, 0xE8, 0x00, 0x00, 0xE7, 0xDE, 0xDE,
+0xF8, 0x19, 0x19, 0xE3, 0xE0, 0xE1, 0x14, 0x14, 0x05, 0xE3, 0xE3, 0x10, 0x23, 0x23, 0x2B, 0x32,
+0x32, 0x29, 0x1E, 0x1E, 0x21, 0x23, 0x23, 0xDE, 0xD4, 0xD4, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF4,
+0x1A, 0x1A, 0x24, 0x2C, 0x2C, 0x33, 0x35, 0x35, 0x32, 0x2E, 0x2E, 0x2C, 0x2C, 0x2E, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x2E, 0x2E, 0xE9, 0xD2, 0xD2, 0xE5, 0xE5, 0xEB, 0x18,
+0x18, 0x08, 0xE9, 0xE9, 0x00, 0x16, 0x16, 0x17, 0x18, 0x18, 0x1D, 0x20, 0x20, 0x09, 0xEB, 0xEB,
+0x1C, 0x1C, 0x0B, 0xE7, 0xE7, 0x13, 0x23, 0x23, 0x34, 0x35, 0x33, 0x22, 0x22, 0x25, 0x29, 0x29,
+0x2B, 0x2C, 0x2C, 0x2E, 0x2F, 0x2F, 0xEB, 0xE7, 0xE9, 0xED, 0xED, 0xF7, 0x0F, 0x0F, 0x1E, 0x27,
+0x27, 0x1B, 0x14, 0x0D, 0xE7, 0xE7, 0x17, 0x27, 0x27, 0x1D, 0x00, 0x00, 0x19, 0x1D, 0x1D, 0x18,
+0x18, 0x0F, 0xF0, 0xF0, 0xE3, 0xDB, 0xDB, 0xDF, 0xE2, 0xE2, 0xE2, 0xE2, 0xDB, 0xD6, 0xD6, 0xD4,
+0xD3, 0xD3, 0xDA, 0xDC, 0xDC, 0xDB, 0xDB, 0xF0, 0x1F, 0x1F, 0x12, 0xEB, 0xEB, 0xF1, 0xF5, 0x0F,
+0x25, 0x25, 0x1C, 0x0A, 0x0A, 0xE9, 0xDF, 0xDF, 0xDF, 0xE0, 0xE2, 0xE2, 0xDC, 0xD7, 0xD7, 0xDD,
+0xE5, 0xE5, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xEA, 0x0A, 0x0A, 0x0F, 0x12, 0x12, 0xE7, 0xE2,
+0xE2, 0xD4, 0xD2, 0xD3, 0xDF, 0xDF, 0xE3, 0x16, 0x16, 0x1D, 0x26, 0x26, 0x1A, 0xF1, 0xF1, 0x07,
+0x12, 0x12, 0x18, 0x1D, 0x1D, 0x20, 0x23, 0x23, 0x1D, 0x16, 0x16, 0x17, 0x18, 0x18, 0x1C, 0x1D,
+0x1D, 0xEB, 0xE9, 0xEA, 0xEE, 0xEE, 0x15, 0x27, 0x27, 0x1C, 0xF5, 0xF5, 0x19, 0x24, 0x24, 0x18,
+0xF1, 0xF1, 0x0D, 0x16, 0x16, 0x27, 0x2F, 0x2F, 0x2D, 0x2C, 0x2C, 0xE3, 0xE0, 0xE4, 0x1C, 0x1C,
+0x1E, 0x25, 0x25, 0x11, 0xE2, 0xE2, 0xE8, 0xF1, 0xF1, 0x19, 0x25, 0x25, 0x0E, 0xDF, 0xDF, 0xE1,
+0xE3, 0xE3, 0xE4, 0xE5, 0xE5, 0xDE, 0xDB, 0xDB, 0xD0, 0xD0, 0xD3, 0xE1, 0xE1, 0xE9, 0x00, 0x00,
+0xE2, 0xD7, 0xD7, 0xDA, 0xDD, 0xDD, 0xD6, 0xD1, 0xD1, 0xDC, 0xF1, 0xF1, 0xE0, 0xDE, 0xDF, 0xE4,
+0xE4, 0xE0, 0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xE7, 0x0A, 0x0A, 0xEC, 0xE4, 0xE4, 0xDB, 0xD7, 0xD7,
+0xD2, 0xD2, 0xD4, 0xD7, 0xD7, 0xDF, 0xEB, 0xEB, 0x0E, 0x1B, 0x1B, 0x22, 0x28, 0x28, 0x19, 0x0A,
+0x0A, 0x28, 0x29, 0x28, 0x23, 0x23, 0x1B, 0x0E, 0x0E, 0x11, 0x14, 0x14, 0xE7, 0xD9, 0xD9, 0xD5,
+0xD2, 0xD2, 0xE0, 0xF1, 0xF1, 0xE3, 0xE2, 0xE3, 0xE4, 0xE4, 0xDE, 0xD9, 0xD9, 0xD4, 0xD3, 0xD5,
+0xD9, 0xD9, 0xD4, 0xD0, 0xD0, 0xD0, 0xCF, 0xCF, 0xCE, 0xCD, 0xCD, 0xD8, 0xD8, 0xDB, 0xDF, 0xDF,
+0xDC, 0xD9, 0xD9, 0xDC, 0xDF, 0xDF, 0xCF, 0xCB, 0xCD, 0xD2, 0xD2, 0xD6, 0xDB, 0xDB, 0xE6, 0x0E,
+0x0E, 0xE7, 0xDF, 0xE0, 0xE2, 0xE2, 0xE7, 0xEE, 0xEE, 0xD5, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xD3,
+0xD3, 0xD5, 0xD6, 0xD6, 0xDA, 0xDD, 0xDD, 0xDB, 0xDB, 0xDE, 0xE9, 0xE9, 0xDC, 0xD4, 0xD4, 0xCF,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xD4, 0xD4, 0xD9, 0xDE, 0xDE, 0xF1, 0x1B, 0x1B, 0x1E, 0x21, 0x1F,
+0x0A, 0x0A, 0xE1, 0xE1, 0xE3, 0xE5, 0xE5, 0x18, 0x28, 0x28, 0x28, 0x27, 0x27, 0x23, 0x1D, 0x1D,
+0xF8, 0xE1, 0xE1, 0xE8, 0xF5, 0xF5, 0x1B, 0x26, 0x26, 0x1F, 0x14, 0x14, 0x1A, 0x1D, 0x1D, 0x10,
+0x0A, 0x0C, 0x19, 0x19, 0x1E, 0x28, 0x28, 0x26, 0x22, 0x22, 0xE6, 0xD0, 0xD0, 0xD3, 0xD7, 0xD7,
+0xD6, 0xD6, 0xD6, 0xD8, 0xDA, 0xDA, 0xD2, 0xCC, 0xCC, 0xCE, 0xD0, 0xD0, 0xD9, 0xDB, 0xDB, 0xDD,
+0xDD, 0xE8, 0x19, 0x19, 0x1F, 0x24, 0x24, 0x23, 0x22, 0x22, 0x22, 0x23, 0x23, 0x11, 0xE4, 0xE4,
+0xDD, 0xD8, 0xD8, 0xE5, 0x11, 0x11, 0x1D, 0x23, 0x23, 0xE6, 0xDC, 0xDD, 0xE8, 0xE9, 0xE4, 0xDA,
+0xDA, 0xD9, 0xD9, 0xD9, 0xE8, 0x18, 0x18, 0x18, 0x19, 0x19, 0x16, 0x11, 0x11, 0xE3, 0xD6, 0xD6,
+0xD9, 0xDC, 0xDC, 0xD8, 0xD7, 0xDB, 0x1F, 0x1F, 0x10, 0xE4, 0xE4, 0xF5, 0x18, 0x18, 0x15, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE5, 0xDF, 0xDE, 0xDC, 0xDC, 0xD9, 0xD5, 0xD5, 0xDD,
+0xE9, 0xE9, 0xEE, 0xF5, 0xF5, 0x12, 0x1B, 0x1B, 0xF3, 0xE3, 0xE4, 0x06, 0x0A, 0xEE, 0xE4, 0xE4,
+0xE3, 0xE1, 0xE1, 0xE6, 0xEC, 0xEC, 0xDE, 0xD5, 0xD5, 0xF5, 0x28, 0x28, 0x20, 0x1C, 0x1A, 0xDD,
+0xDB, 0xE0, 0xE9, 0xE9, 0xDB, 0xD2, 0xD2, 0xDC, 0xEC, 0xEC, 0xE4, 0xDF, 0xDF, 0xDC, 0xDA, 0xDA,
+0xD6, 0xD5, 0xD8, 0xE8, 0xE8, 0xDF, 0xD8, 0xD8, 0xD3, 0xD2, 0xE2, 0x1E, 0x1E, 0x1F, 0x20, 0x20,
+0x22, 0x24, 0x24, 0x24, 0x25, 0x1C, 0xD4, 0xD4, 0xD0, 0xCC, 0xCC, 0xD4, 0xDE, 0xDE, 0xDC, 0xDA,
+0xDA, 0xDA, 0xDA, 0xD5, 0xD1, 0xD1, 0xD9, 0xE3, 0xE3, 0xDE, 0xD9, 0xD9, 0xD8, 0xD7, 0xD2, 0xCE,
+0xCE, 0xD0, 0xD2, 0xD2, 0xDD, 0xF1, 0xEE, 0xD7, 0xD5, 0xD5, 0xD5, 0xD5, 0xDE, 0xEA, 0xEA, 0xE0,
+0xD8, 0xD8, 0x25, 0x2F, 0x2C, 0x21, 0x21, 0x13, 0xEA, 0xEA, 0xF0, 0x00, 0x00, 0xF2, 0xEE, 0xF0,
+0x00, 0x00, 0xE8, 0xDF, 0xDF, 0xF0, 0x19, 0x19, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDE, 0xD5, 0xD5, 0xDF, 0xF1, 0xF1, 0xE0, 0xD9, 0xD9, 0xE2, 0xE5, 0xE7, 0x20, 0x23, 0x25, 0x28,
+0x28, 0x19, 0xE3, 0xE3, 0x0C, 0x20, 0x20, 0x1D, 0x1A, 0x1A, 0x1C, 0x1D, 0x1D, 0x22, 0x25, 0x25,
+0x27, 0x28, 0x28, 0x22, 0x1A, 0x1A, 0x1F, 0x23, 0x23, 0x24, 0x24, 0x23, 0x15, 0x13, 0x17, 0x1D,
+0x1D, 0x19, 0x13, 0x13, 0xF5, 0xE8, 0xE8, 0xE5, 0xE2, 0xE2, 0xE4, 0xE6, 0xE6, 0xF5, 0x15, 0x15,
+0xE6, 0xD8, 0xD8, 0xDE, 0xE6, 0xE6, 0xDC, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xE0, 0xE0, 0xD9, 0xCF,
+0xCF, 0xD6, 0xDF, 0xDF, 0xDC, 0xDA, 0xDA, 0xD3, 0xCE, 0xCE, 0xCD, 0xCD, 0xCD, 0xCE, 0xCF, 0xCF,
+0xCD, 0xCD, 0xCD, 0xD1, 0xD6, 0xD6, 0xD8, 0xD8, 0xDB, 0xE2, 0xE2, 0xD7, 0xCF, 0xCF, 0xD2, 0xD5,
+0xD5, 0xD7, 0xD9, 0xD9, 0xDC, 0xE1, 0xE1, 0x00, 0x1E, 0x1E, 0xF1, 0xEA, 0x08, 0x21, 0x21, 0x21,
+0x22, 0x22, 0x21, 0x20, 0x20, 0x18, 0x0A, 0x0A, 0xEA, 0xE1, 0xE1, 0xDE, 0xDC, 0xDB, 0xD5, 0xD5,
+0x00, 0x2A, 0x2A, 0x20, 0x0E, 0x0E, 0x1F, 0x29, 0x29, 0x1F, 0x0E, 0x0E, 0x11, 0x13, 0x13, 0x07,
+0xF5, 0x09, 0x20, 0x21, 0x1D, 0x17, 0x17, 0x19, 0x1C, 0x1C, 0xF3, 0xDF, 0xDF, 0xE4, 0xEA, 0xEA,
+0xE5, 0xE1, 0xE1, 0xE2, 0xE2, 0xDD, 0xD0, 0xD0, 0xDE, 0x0A, 0x0A, 0xEA, 0xE1, 0xE1, 0xE3, 0xE5,
+0xE3, 0xE2, 0xE2, 0x13, 0x26, 0x26, 0x20, 0x1A, 0x16, 0xEA, 0xEA, 0xDF, 0xD7, 0xD7, 0xF0, 0x23,
+0x23, 0x1C, 0x10, 0x10, 0xE7, 0xE4, 0xF5, 0x18, 0x18, 0xEF, 0xDE, 0xDE, 0xDD, 0xDC, 0xDC, 0xE6,
+0xEC, 0xEF, 0xF5, 0xF5, 0xED, 0xE8, 0xE8, 0x0A, 0x1A, 0x1A, 0xE9, 0xE0, 0xEA, 0x0E, 0x0E, 0x1F,
+0x29, 0x29, 0x25, 0x21, 0x21, 0x14, 0xEC, 0xEC, 0xEC, 0xEC, 0xE8, 0xE5, 0xE5, 0xE4, 0xE2, 0xE2,
+0xF1, 0x17, 0x16, 0x06, 0xF5, 0x16, 0x1F, 0x1F, 0x28, 0x2F, 0x2F, 0x26, 0x18, 0x18, 0x2B, 0x30,
+0x2B, 0x25, 0x25, 0x21, 0x21, 0x25, 0x21, 0x1D, 0x1D, 0x28, 0x30, 0x30, 0x2D, 0x2B, 0x2B, 0x23,
+0x1D, 0x1D, 0x1D, 0x1D, 0x1B, 0x0F, 0x0E, 0x09, 0xF5, 0xF5, 0xEA, 0xE4, 0xE4, 0xE2, 0xE0, 0xE0,
+0xF5, 0x1D, 0x1D, 0x21, 0x25, 0x25, 0x2D, 0x31, 0x31, 0x31, 0x31, 0x31, 0x28, 0x17, 0x17, 0x12,
+0x0E, 0x10, 0x23, 0x26, 0x28, 0x2C, 0x2C, 0x21, 0x10, 0x10, 0x15, 0x18, 0x18, 0x07, 0xE8, 0xE8,
+0x0A, 0x1A, 0x1A, 0x17, 0x15, 0x15, 0x0A, 0xEF, 0xEF, 0xF2, 0xF5, 0xF5, 0xE5, 0xDC, 0xDC, 0x20,
+0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2D, 0x23, 0x23, 0x1B, 0x0D, 0x0D,
+0x13, 0x16, 0x16, 0xEC, 0xDE, 0xDE, 0xE4, 0xEC, 0xEC, 0x00, 0x13, 0x13, 0xDF, 0xD8, 0xD8, 0xD9,
+0xD9, 0xD3, 0xCE, 0xCE, 0xD4, 0xDD, 0xDD, 0xD5, 0xCE, 0xCE, 0xD4, 0xDC, 0xDC, 0xD1, 0xCE, 0xCE,
+0xCE, 0xCE, 0xCE, 0xD1, 0xD3, 0xD2, 0xD1, 0xD1, 0xDA, 0xE5, 0xE5, 0xE3, 0xE1, 0xE1, 0xF0, 0x16,
+0x16, 0x13, 0x0D, 0x0D, 0x11, 0x13, 0xF3, 0xDE, 0xDE, 0x0F, 0x26, 0x26, 0x1C, 0x00, 0x00, 0xF3,
+0xEF, 0xEF, 0x15, 0x20, 0x20, 0x0F, 0xE5, 0xE5, 0x12, 0x20, 0x1A, 0xDA, 0xD4, 0xD6, 0xDA, 0xDA,
+0xE2, 0xEF, 0xEF, 0xDD, 0xD3, 0xD3, 0xDF, 0xF5, 0xF5, 0xE9, 0xE1, 0xE1, 0xE4, 0xE7, 0xEA, 0xF9,
+0x00, 0xDC, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xD4, 0xDB, 0xDB, 0xDB,
+0xDB, 0xD3, 0xCF, 0xCF, 0xCF, 0xD2, 0xD2, 0xE3, 0x19, 0x19, 0x12, 0x00, 0xF9, 0xF3, 0xF2, 0x14,
+0x1F, 0x1F, 0xF2, 0xDC, 0xDC, 0xE3, 0xED, 0xF1, 0x18, 0x1C, 0x1D, 0x1D, 0x1D, 0xED, 0xD9, 0xD9,
+0xDA, 0xDA, 0xDB, 0xE8, 0xEF, 0xF2, 0xF5, 0xF5, 0xEA, 0xE3, 0xE3, 0xF0, 0x14, 0x14, 0x07, 0xED,
+0xE6, 0xDA, 0xD9, 0xF2, 0x22, 0x22, 0x24, 0x27, 0x27, 0x28, 0x29, 0x29, 0x2A, 0x2B, 0x29, 0x27,
+0x27, 0x2C, 0x30, 0x30, 0x28, 0x1E, 0x1F, 0x20, 0x21, 0x07, 0xDF, 0xDF, 0xDF, 0xDE, 0xDF, 0xDF,
+0xDE, 0xDE, 0xDA, 0xD6, 0xD6, 0xD7, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA, 0xD5, 0xD1, 0xD1, 0xD5, 0xD9,
+0xD9, 0xD3, 0xCF, 0xCF, 0xD0, 0xD1, 0xD2, 0xDF, 0xE6, 0xE8, 0xF1, 0xF2, 0x0D, 0x18, 0x18, 0x00,
+0xE7, 0xE7, 0xF6, 0x14, 0x14, 0xF8, 0xE9, 0xE9, 0xEC, 0xEF, 0xEF, 0xE8, 0xE3, 0xE3, 0x00, 0x1C,
+0x1C, 0x16, 0x10, 0x10, 0x09, 0x00, 0xF6, 0xEA, 0xE7, 0xE9, 0xEC, 0xED, 0xEC, 0xEB, 0xEB, 0x0F,
+0x1C, 0x1C, 0x09, 0xE6, 0xE6, 0xE9, 0xED, 0xED, 0xF8, 0x10, 0x10, 0x07, 0xF2, 0xF2, 0xE9, 0xE3,
+0xE3, 0xE1, 0xDF, 0xDF, 0xE8, 0xF2, 0xF3, 0x06, 0x09, 0x10, 0x18, 0x18, 0x0D, 0xEF, 0xEF, 0x0D,
+0x18, 0x18, 0x1E, 0x23, 0x23, 0x13, 0xE6, 0xE6, 0xE0, 0xDB, 0xDB, 0xD2, 0xD0, 0xD0, 0xD6, 0xDD,
+0xDD, 0xDD, 0xDD, 0xDE, 0xDF, 0xDF, 0xE8, 0x09, 0x09, 0xF2, 0xEB, 0xEB, 0xDF, 0xD7, 0xD7, 0xD3,
+0xD0, 0xD1, 0xDE, 0xE5, 0xDF, 0xD9, 0xD9, 0xE2, 0xEF, 0xEF, 0xF4, 0x00, 0x00, 0x17, 0x20, 0x20,
+0x1C, 0x17, 0x17, 0x0E, 0xF2, 0xF2, 0xF2, 0xF2, 0x08, 0x16, 0x17, 0x1B, 0x1E, 0x1E, 0x09, 0xE3,
+0xE3, 0xEA, 0xF6, 0xF6, 0x11, 0x19, 0x19, 0x00, 0xE6, 0xE6, 0xEF, 0x00, 0xF3, 0xEC, 0xEB, 0xDC,
+0xD2, 0xD2, 0xD8, 0xE0, 0xE0, 0xD7, 0xD1, 0xD1, 0xD2, 0xD3, 0xD3, 0xDA, 0xE1, 0xE1, 0xE0, 0xE0,
+0xDD, 0xDB, 0xDA, 0xD9, 0xD9, 0xD8, 0xD7, 0xD7, 0xD3, 0xD0, 0xD0, 0xE5, 0x1B, 0x15, 0xF2, 0xF2,
+0xE5, 0xDD, 0xDD, 0xE1, 0xE6, 0xE6, 0xE2, 0xDE, 0xDC, 0xD9, 0xD8, 0xDF, 0xE8, 0xE8, 0xDD, 0xD5,
+0xD5, 0xE4, 0x16, 0x09, 0xE5, 0xE4, 0xE9, 0xF2, 0xF2, 0x07, 0x10, 0x10, 0x07, 0xF2, 0xF2, 0xEB,
+0xE8, 0xEC, 0xF2, 0xF2, 0xED, 0xE9, 0xE9, 0x0E, 0x1D, 0x1D, 0x1E, 0x1F, 0x1D, 0x17, 0x16, 0x0D,
+0xF2, 0xF2, 0xEC, 0xE8, 0xE8, 0xF6, 0x14, 0x15, 0x1B, 0x1D, 0x28, 0x2F, 0x2F, 0x28, 0x1C, 0x1C,
+0x1C, 0x1B, 0x1D, 0x26, 0x29, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x19, 0xF2, 0xF2, 0x15,
+0x20, 0x20, 0x24, 0x26, 0x27, 0x2A, 0x2B, 0x26, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1F, 0x23, 0x23,
+0x26, 0x29, 0x29, 0x2D, 0x2E, 0x2E, 0x2B, 0x25, 0x25, 0x1B, 0x00, 0x00, 0xF6, 0xF2, 0xF2, 0xE9,
+0xE3, 0xE3, 0xE4, 0xE4, 0xE6, 0xED, 0xF0, 0xE7, 0xDE, 0xDD, 0xE5, 0xF0, 0xF0, 0x12, 0x1C, 0x1C,
+0x14, 0xF6, 0xF6, 0x16, 0x20, 0x20, 0xF0, 0xDA, 0xDA, 0xE0, 0xE8, 0xE8, 0xED, 0xF6, 0xF6, 0xEA,
+0xE3, 0xE3, 0xE0, 0xDD, 0xDD, 0xDF, 0xDF, 0xDC, 0xD3, 0xD1, 0xD1, 0xD3, 0xD3, 0xE5, 0x1B, 0x1B,
+0x1D, 0x1E, 0x1E, 0xEB, 0xD7, 0xD7, 0xE1, 0xF6, 0xF6, 0xF2, 0xF0, 0xF0, 0xEE, 0xED, 0xED, 0xEA,
+0xE8, 0xE9, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE9, 0xE8, 0xE8, 0xEB, 0xED, 0xED, 0xE1, 0xD9, 0xD9,
+0xDA, 0xDC, 0xDC, 0xDD, 0xDE, 0xDA, 0xD3, 0xD1, 0xD6, 0xDC, 0xDC, 0xD9, 0xD7, 0xD7, 0xE0, 0xF0,
+0xF0, 0x09, 0x13, 0x13, 0xF4, 0xE7, 0xE7, 0xE6, 0xE5, 0xE8, 0xF0, 0xF6, 0xE9, 0xE1, 0xE1, 0xE2,
+0xE4, 0xE4, 0xE2, 0xE0, 0xE0, 0xE6, 0xF0, 0xF0, 0x12, 0x1D, 0x1D, 0x16, 0x09, 0xF7, 0xDE, 0xD5,
+0xD9, 0xDE, 0xDF, 0xE4, 0xEC, 0xEC, 0xF6, 0x0F, 0x0F, 0x16, 0x1B, 0x1B, 0xF9, 0xE3, 0xE3, 0xE7,
+0xEC, 0xED, 0xEF, 0xF0, 0xEA, 0xE6, 0xE6, 0xE5, 0xE4, 0xE4, 0xEF, 0x0F, 0xEB, 0xE0, 0xE0, 0xED,
+0x13, 0x0E, 0xF4, 0xF2, 0x13, 0x1D, 0x1D, 0x18, 0x11, 0x11, 0xEC, 0xE0, 0xE5, 0x10, 0x19, 0x13,
+0x09, 0x09, 0x13, 0x19, 0x19, 0x1A, 0x1B, 0x1D, 0x22, 0x25, 0x1C, 0x0D, 0x0D, 0x09, 0x00, 0x00,
+0xF2, 0xEE, 0xEE, 0xEC, 0xEA, 0x06, 0x20, 0x25, 0x20, 0x19, 0x19, 0x0F, 0xF0, 0xF0, 0xF9, 0x0D,
+0x0E, 0x18, 0x1D, 0x23, 0x29, 0x29, 0x22, 0x19, 0x19, 0x21, 0x27, 0x27, 0x0B, 0xDA, 0xE1, 0xEE,
+0xEE, 0xE3, 0xDC, 0xDC, 0xDB, 0xD9, 0xD9, 0xD5, 0xD2, 0xD6, 0xDB, 0xDB, 0xDC, 0xDD, 0xDD, 0xE5,
+0xF3, 0xF3, 0xE5, 0xE5, 0xF3, 0xF3, 0x11, 0x1A, 0x1A, 0x14, 0x09, 0x09, 0x09, 0x09, 0xF7, 0xED,
+0xEA, 0xE9, 0xE8, 0xE7, 0xEF, 0x09, 0x09, 0xE7, 0xDD, 0xDD, 0xDE, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE,
+0xE5, 0xEE, 0xEE, 0xF6, 0x0C, 0x0C, 0x17, 0x1E, 0x1E, 0x1F, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1F,
+0x1F, 0x23, 0x28, 0x2A, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x25, 0x00, 0x00, 0x1D, 0x27, 0x27,
+0x21, 0x19, 0x19, 0x1D, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1D, 0x1B, 0x1B, 0x20, 0x23, 0x23, 0x26,
+0x28, 0x24, 0x16, 0xF6, 0xE7, 0xDE, 0xDD, 0xE3, 0xEC, 0xEC, 0xF4, 0x0C, 0x0C, 0x00, 0xF3, 0xF3,
+0xEE, 0xEA, 0xEA, 0xDE, 0xD6, 0xD6, 0xD9, 0xDB, 0xDB, 0xDD, 0xDE, 0xE0, 0xE4, 0xE5, 0xEA, 0xF3,
+0xF3, 0xE5, 0xDD, 0xDD, 0xE3, 0xEA, 0xEA, 0x0E, 0x1B, 0x1B, 0x18, 0x13, 0x17, 0x22, 0x29, 0x22,
+0x17, 0x13, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x19, 0x19, 0x11, 0xF6, 0xF6, 0xE6, 0xDD,
+0xDD, 0xE1, 0xE6, 0xE5, 0xE3, 0xE1, 0xE8, 0x08, 0x0F, 0x0E, 0x0C, 0x0C, 0x1B, 0x24, 0x24, 0x23,
+0x21, 0x21, 0x19, 0x09, 0x09, 0xE8, 0xDF, 0xDF, 0xE3, 0xE8, 0xE3, 0xDF, 0xDE, 0x13, 0x29, 0x29,
+0x20, 0x11, 0x11, 0x12, 0x13, 0x13, 0x18, 0x1C, 0x1C, 0x1E, 0x20, 0x20, 0x1F, 0x1E, 0x20, 0x21,
+0x21, 0x1B, 0x13, 0x13, 0x14, 0x16, 0x18, 0x1A, 0x19, 0x16, 0x13, 0x19, 0x1D, 0x1D, 0xEA, 0xD7,
+0xD7, 0xDC, 0xE3, 0xE2, 0xDE, 0xDA, 0xE0, 0xE8, 0xE9, 0x09, 0x19, 0x19, 0x17, 0x14, 0x14, 0x17,
+0x19, 0x15, 0x0D, 0xF6, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0xEF, 0xDC, 0xDC, 0xDF, 0xE3, 0xE7,
+0xEC, 0xEE, 0xEB, 0xE9, 0xE9, 0xF2, 0x0C, 0x0C, 0x13, 0x17, 0x12, 0xF1, 0xE6, 0xEA, 0xEE, 0xEE,
+0xDF, 0xD5, 0xD5, 0xD8, 0xDC, 0xDF, 0xEE, 0x17, 0x1C, 0x20, 0x20, 0x23, 0x25, 0x25, 0x22, 0x1F,
+0x1D, 0x11, 0xEE, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0xF6, 0x0B, 0x0F, 0x0C, 0xF6, 0xF6,
+0x14, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x20, 0x20, 0x23, 0x26, 0x26, 0x09, 0xDB, 0xDA, 0xD5,
+0xD3, 0xD6, 0xE1, 0xEE, 0xF0, 0xF2, 0xF3, 0xE5, 0xDD, 0xDD, 0xDE, 0xE0, 0xE0, 0xE9, 0x09, 0x09,
+0x13, 0x18, 0x18, 0x00, 0xE7, 0xE7, 0xE5, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xDB, 0xD5, 0xD5, 0xDD,
+0xE7, 0xE7, 0xEF, 0x0C, 0x09, 0xF3, 0xED, 0xF0, 0xF9, 0x09, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+0x0F, 0x11, 0x11, 0x0D, 0x09, 0x09, 0x19, 0x22, 0x22, 0x25, 0x27, 0x27, 0x21, 0x1B, 0x1B, 0x15,
+0x0C, 0x15, 0x25, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x25, 0x25, 0x21, 0x1C, 0x1C, 0x11, 0xEE, 0xEE,
+0xF9, 0x0E, 0x0E, 0x00, 0xF1, 0xF1, 0xE9, 0xE3, 0xEC, 0x19, 0x25, 0x21, 0x1C, 0x1A, 0x23, 0x29,
+0x29, 0x2A, 0x2B, 0x2B, 0x19, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xEE, 0x11, 0x11, 0x11, 0x12, 0xF5,
+0xE6, 0xE1, 0xDE, 0xDB, 0xDB, 0xE1, 0xE7, 0xE7, 0xEA, 0xED, 0xED, 0x12, 0x1E, 0x1E, 0x15, 0xF6,
+0xF6, 0x15, 0x1D, 0x1E, 0x20, 0x22, 0x16, 0xF0, 0xE5, 0xE7, 0xEA, 0xEA, 0x0A, 0x19, 0x19, 0x1F,
+0x23, 0x23, 0x06, 0xDC, 0xDC, 0xE3, 0xED, 0xE7, 0xE0, 0xD9, 0xDF, 0xE6, 0xE8, 0xE5, 0xE2, 0xE2,
+0xE0, 0xDE, 0xDE, 0xE3, 0xE8, 0xE8, 0xE2, 0xDD, 0xDF, 0xE4, 0xEB, 0xE5, 0xE1, 0xE1, 0xE3, 0xE5,
+0xE8, 0xEB, 0xEB, 0xF2, 0x08, 0xF6, 0xEF, 0xEB, 0xE8, 0xE5, 0xE5, 0xE6, 0xE7, 0xE7, 0xEB, 0xF1,
+0xF1, 0xF2, 0xF3, 0x13, 0x1C, 0x1C, 0x18, 0x14, 0x14, 0x19, 0x1D, 0x1D, 0x18, 0x12, 0x14, 0x17,
+0x1A, 0x0D, 0xEB, 0xEB, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1A, 0x0E, 0xF5, 0xED, 0xEA, 0x00,
+0x15, 0x15, 0x0C, 0xF1, 0xF1, 0xEE, 0xEB, 0xF7, 0x12, 0x19, 0x14, 0x0E, 0x0E, 0x08, 0xF7, 0xF7,
+0x1C, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x22, 0x21, 0x21, 0x24, 0x27, 0x23, 0x1E, 0x18,
+0x17, 0x16, 0x16, 0x1D, 0x21, 0x21, 0x1D, 0x18, 0x1D, 0x21, 0x21, 0x20, 0x1F, 0x22, 0x25, 0x28,
+0x1C, 0x08, 0xF1, 0xEB, 0xE6, 0xE6, 0xEB, 0xF3, 0xF3, 0xE7, 0xDF, 0xDF, 0xEC, 0x14, 0x14, 0x0F,
+0x08, 0x08, 0x00, 0xF7, 0xF7, 0xEB, 0xE4, 0xE4, 0xE0, 0xDD, 0xDD, 0xDA, 0xD8, 0xD8, 0xD8, 0xD7,
+0xD9, 0xDF, 0xE9, 0xF7, 0x18, 0x22, 0x1D, 0x17, 0x13, 0x18, 0x1B, 0x1C, 0x20, 0x24, 0x24, 0x0C,
+0xDE, 0xDE, 0xE7, 0x00, 0x00, 0xE5, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xF5, 0x22, 0x22, 0x1E, 0x1A,
+0x19, 0x0E, 0xED, 0xF6, 0x0F, 0x15, 0x17, 0x19, 0x1A, 0x1E, 0x21, 0x21, 0x1B, 0x13, 0x13, 0x16,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x17, 0x17, 0x0F, 0xF3, 0xF0, 0xED, 0xE9, 0x11, 0x1B, 0x1F,
+0x13, 0xED, 0xED, 0xF7, 0x0E, 0x0E, 0x10, 0x12, 0x12, 0xE9, 0xDD, 0xDD, 0xDC, 0xDC, 0xD9, 0xD6,
+0xD5, 0xD5, 0xD7, 0xDA, 0xE1, 0xE9, 0xEA, 0xE7, 0xE3, 0xE3, 0xDD, 0xD8, 0xD8, 0xDF, 0xE7, 0xE7,
+0xD7, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD8, 0xD9, 0xDA, 0xDB, 0xE0, 0xE6, 0xE7, 0xE4, 0xE2,
+0xE2, 0xDC, 0xD7, 0xD7, 0xDB, 0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE4, 0xE9, 0xEF, 0x08,
+0x13, 0x13, 0x0D, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x10, 0x17, 0x17, 0x1A, 0x1C, 0x0E, 0xEC, 0xE2,
+0xE0, 0xDF, 0xDF, 0xE0, 0xE2, 0xE2, 0xDD, 0xD9, 0xD9, 0xDB, 0xE2, 0xE6, 0xE9, 0xDB, 0xD6, 0xD6,
+0xD6, 0xD6, 0xD6, 0xDD, 0xF1, 0x0F, 0x17, 0x1C, 0x1F, 0x21, 0x21, 0x1D, 0x18, 0x18, 0x18, 0x17,
+0x17, 0x1A, 0x1C, 0x18, 0x14, 0x0E, 0xEF, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8,
+0xE8, 0xE4, 0xE2, 0xE1, 0xDE, 0xDB, 0xDB, 0xDE, 0xE2, 0xE2, 0xF7, 0x1B, 0x14, 0x09, 0xEF, 0x0F,
+0x19, 0x19, 0x1D, 0x20, 0x20, 0x1E, 0x1C, 0x1A, 0x18, 0x16, 0x17, 0x18, 0x18, 0x1C, 0x20, 0x20,
+0x15, 0xF1, 0xF0, 0xEF, 0xEE, 0xE6, 0xE0, 0xE0, 0xDC, 0xD8, 0xD8, 0xDA, 0xDB, 0xDD, 0xDF, 0xE0,
+0xDE, 0xDF, 0xDC, 0xDE, 0xE0, 0xE9, 0xF2, 0x0B, 0xEF, 0xE8, 0xE7, 0xEA, 0xEE, 0xEE, 0xF5, 0x0B,
+0x0B, 0xEC, 0xE3, 0xE3, 0xDD, 0xD7, 0xD7, 0xDA, 0xDD, 0xDD, 0xE5, 0xF1, 0xF1, 0xE6, 0xDF, 0xDF,
+0xDF, 0xDF, 0xDF, 0xE3, 0xE8, 0xE9, 0xEB, 0xEF, 0xF2, 0xF5, 0x08, 0x13, 0x18, 0x1D, 0x1A, 0x18,
+0x17, 0x1A, 0x1C, 0x1D, 0x20, 0x24, 0x24, 0x22, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x19, 0x11, 0x11,
+0x19, 0x1F, 0x1F, 0x1A, 0x14, 0x14, 0x00, 0xEB, 0xED, 0xF1, 0x08, 0x0F, 0x11, 0x14, 0xF7, 0xEB,
+0xE8, 0xE3, 0xDF, 0xDF, 0xE8, 0x08, 0x08, 0xEC, 0xE3, 0xE3, 0xE0, 0xDC, 0xDC, 0xE0, 0xE5, 0xE5,
+0xE6, 0xE7, 0xE6, 0xE5, 0xE3, 0xE1, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xF2, 0x1B,
+0x1B, 0x10, 0xF0, 0xF0, 0x1C, 0x28, 0x27, 0x26, 0x23, 0x20, 0x1F, 0x1D, 0x20, 0x22, 0x23, 0x23,
+0x24, 0x24, 0x1E, 0x16, 0x16, 0xF3, 0xE3, 0xE3, 0xE8, 0xEE, 0xEE, 0xEC, 0xEB, 0xEC, 0xF0, 0xF7,
+0xF4, 0xF2, 0xF0, 0xF1, 0xF1, 0xF2, 0xE8, 0xE1, 0xE1, 0xE9, 0xF7, 0xF7, 0x0D, 0x14, 0x14, 0x15,
+0x16, 0x15, 0x0F, 0xF7, 0x0B, 0x0F, 0x12, 0xEE, 0xE3, 0xE2, 0xE5, 0xE8, 0xE8, 0xEB, 0xEE, 0xEE,
+0xF9, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0xF2, 0xE9, 0xE9, 0xF5, 0x12, 0x12, 0x0E, 0x08,
+0x08, 0x12, 0x17, 0x13, 0x0C, 0x0A, 0x15, 0x15, 0x1B, 0x1F, 0x1F, 0x1D, 0x1B, 0x1C, 0x1D, 0x1E,
+0x19, 0x12, 0x12, 0xF4, 0xE8, 0xE8, 0xF1, 0x0D, 0x0D, 0x14, 0x18, 0x0C, 0xF2, 0xE9, 0x1D, 0x28,
+0x28, 0x28, 0x25, 0x25, 0x26, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x26, 0x26, 0x22,
+0x1E, 0x1E, 0x1D, 0x1B, 0xFA, 0xE9, 0xE0, 0xE3, 0xE7, 0xE7, 0xF9, 0x17, 0x17, 0xF4, 0xE4, 0xED,
+0xF4, 0x14, 0xF9, 0xEA, 0xEA, 0xEB, 0xED, 0xED, 0xE8, 0xE4, 0xE6, 0xE7, 0xE9, 0x09, 0x19, 0x19,
+0x18, 0x17, 0x17, 0x16, 0x15, 0x0E, 0x0A, 0xF7, 0xF9, 0x00, 0x0F, 0x08, 0xF7, 0xF8, 0xF9, 0x00,
+0x0B, 0x0D, 0x11, 0x11, 0x12, 0x12, 0x1F, 0x26, 0x27, 0x23, 0x1C, 0x1C, 0x1E, 0x20, 0x20, 0x1E,
+0x1C, 0x1C, 0x13, 0xF7, 0xF7, 0x11, 0x18, 0x18, 0x13, 0x0D, 0x0D, 0x13, 0x18, 0x18, 0x13, 0x0B,
+0x0B, 0xEC, 0xE3, 0xE3, 0xF7, 0x1A, 0x1A, 0x1C, 0x1E, 0x1A, 0x18, 0x0F, 0x15, 0x16, 0x1A, 0x17,
+0x16, 0x15, 0x12, 0x0F, 0x0F, 0x15, 0x19, 0x19, 0x0C, 0xEC, 0xEC, 0xEA, 0xE8, 0xE8, 0xE8, 0xE7,
+0xE7, 0xF6, 0x15, 0x14, 0x13, 0x11, 0x10, 0x0F, 0x0D, 0x0C, 0x0B, 0x0B, 0x11, 0x15, 0x16, 0x11,
+0x0B, 0x0B, 0x17, 0x1E, 0x1E, 0x1B, 0x18, 0x18, 0x1B, 0x1D, 0x1D, 0x15, 0xF7, 0xFA, 0x00, 0x08,
+0x12, 0x15, 0x18, 0x0D, 0xEF, 0xEF, 0xF4, 0x08, 0x08, 0xE5, 0xDB, 0xDB, 0xE3, 0xEF, 0xEF, 0xF4,
+0x08, 0x08, 0xE9, 0xE0, 0xE3, 0xEF, 0x17, 0x0D, 0xFC, 0xEB, 0xEC, 0xED, 0xED, 0xEA, 0xE7, 0xE7,
+0xE5, 0xE2, 0xE2, 0xE1, 0xE0, 0xE0, 0xE8, 0xF7, 0xF7, 0xEB, 0xE5, 0xE6, 0xE8, 0xED, 0x09, 0x10,
+0x18, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x1B, 0x1B, 0x15, 0x0B, 0x0B, 0x12, 0x18, 0x19,
+0x1B, 0x1E, 0x1C, 0x1B, 0x19, 0x14, 0x0D, 0x0D, 0x0E, 0x0F, 0x0F, 0xF4, 0xEB, 0xEB, 0x10, 0x1D,
+0x1D, 0x1C, 0x1B, 0x15, 0x0F, 0x0B, 0x12, 0x16, 0x16, 0x09, 0xEC, 0xEC, 0xF6, 0x0F, 0x05, 0xF2,
+0xEA, 0xE5, 0xE5, 0xF3, 0x15, 0x15, 0x16, 0x17, 0x13, 0x10, 0xF7, 0xE9, 0xE4, 0xE1, 0xE4, 0xE7,
+0xE7, 0xE6, 0xE6, 0xE6, 0xE1, 0xDD, 0xDF, 0xE0, 0xE4, 0xE7, 0xE9, 0xEA, 0xE9, 0xE9, 0xE9, 0xF8,
+0x14, 0x11, 0xF2, 0xE5, 0xE3, 0xE2, 0xE0, 0xE3, 0xE5, 0xE5, 0xE8, 0xEB, 0xEB, 0xF1, 0x00, 0xF1,
+0xEF, 0xEA, 0xE9, 0xE9, 0xE9, 0xF5, 0x12, 0x12, 0x18, 0x1C, 0x1E, 0x1E, 0x20, 0x17, 0x00, 0x00,
+0xEE, 0xE8, 0xE8, 0xE6, 0xE5, 0xE9, 0xEA, 0xEF, 0xF2, 0xF8, 0xF8, 0xEE, 0xE9, 0xEA, 0xF2, 0x0E,
+0xF2, 0xEE, 0xE9, 0xE6, 0xEE, 0xF1, 0xF2, 0xE9, 0xE9, 0xE6, 0xE4, 0xE4, 0xE7, 0xEB, 0xEB, 0xEB,
+0xEA, 0xEA, 0x14, 0x22, 0x22, 0x1F, 0x1B, 0x17, 0xF8, 0xE3, 0xE3, 0xE4, 0xE5, 0xEF, 0xF5, 0x16,
+0xF6, 0xF0, 0xE6, 0xEA, 0xEB, 0xEE, 0xE6, 0xE2, 0xE1, 0xE5, 0xEA, 0xEA, 0xE3, 0xDD, 0xDD, 0xE5,
+0xF5, 0xF5, 0x0C, 0x14, 0x14, 0x11, 0x0C, 0x0C, 0x09, 0x00, 0x00, 0x19, 0x23, 0x23, 0x22, 0x22,
+0x22, 0x21, 0x20, 0x19, 0x17, 0x0A, 0x17, 0x1B, 0x1F, 0x1C, 0x18, 0x18, 0x15, 0x13, 0x13, 0x15,
+0x18, 0x18, 0x0D, 0xEF, 0xEF, 0xE6, 0xE0, 0xE0, 0xE2, 0xE3, 0xE3, 0xE2, 0xE2, 0xE4, 0xE5, 0xE6,
+0xEB, 0xEF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF6, 0x07, 0x07, 0xEA, 0xE2, 0xE2, 0xE4, 0xE6, 0xE8, 0xED,
+0xF8, 0xF8, 0xF8, 0xF8, 0xE8, 0xE6, 0xE0, 0xE6, 0xEC, 0xEF, 0xEA, 0xE6, 0xE6, 0xED, 0x00, 0x00,
+0xFA, 0xF8, 0xF8, 0xEE, 0xE8, 0xE8, 0xEB, 0xEE, 0xED, 0xE9, 0xE5, 0xE9, 0xEA, 0xF3, 0xF4, 0xF4,
+0xF5, 0xF2, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0x0C, 0x17, 0x17, 0x1E, 0x24, 0x24, 0x21, 0x1C, 0x18,
+0x16, 0x0A, 0x13, 0x17, 0x19, 0x16, 0x12, 0x12, 0x1B, 0x22, 0x22, 0x24, 0x25, 0x25, 0x21, 0x1B,
+0x1E, 0x20, 0x25, 0x23, 0x23, 0x22, 0x21, 0x20, 0x20, 0x1E, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x17,
+0x12, 0x1A, 0x1B, 0x21, 0x10, 0xEA, 0xE5, 0xEC, 0x00, 0x00, 0x12, 0x19, 0x19, 0x18, 0x16, 0x11,
+0x0E, 0xF3, 0x0E, 0x14, 0x16, 0xFA, 0xE8, 0xE8, 0xE4, 0xE0, 0xE0, 0xEA, 0x0C, 0x15, 0x16, 0x1D,
+0x1D, 0x1D, 0x1D, 0x21, 0x25, 0x25, 0x0C, 0xDE, 0xDE, 0xE0, 0xE2, 0xE5, 0xE6, 0xE8, 0xE8, 0xE9,
+0xE9, 0x15, 0x23, 0x23, 0x1E, 0x18, 0x1A, 0x1B, 0x1D, 0x23, 0x24, 0x24, 0x16, 0xE3, 0xE3, 0xE9,
+0xF1, 0xE9, 0xE8, 0xE2, 0xE8, 0xF0, 0xF1, 0x11, 0x1B, 0x1B, 0x17, 0x12, 0x11, 0x11, 0x11, 0x17,
+0x1B, 0x1B, 0x12, 0xF3, 0xF3, 0x13, 0x1C, 0x15, 0x12, 0x00, 0x11, 0x17, 0x17, 0x16, 0x0F, 0x0E,
+0x11, 0x17, 0x17, 0x16, 0x14, 0x14, 0x18, 0x1C, 0x1C, 0x1B, 0x19, 0x19, 0x1C, 0x1F, 0x1E, 0x1A,
+0x14, 0x14, 0x14, 0x13, 0x15, 0x16, 0x19, 0x17, 0x16, 0x12, 0xEF, 0xED, 0xE3, 0xE3, 0xE2, 0xE2,
+0xE5, 0xE7, 0xE8, 0xEB, 0xEE, 0xEE, 0xEA, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE5, 0xE4, 0xE4, 0xE6,
+0xE7, 0xE7, 0x0A, 0x1B, 0x1B, 0x18, 0x16, 0x16, 0x18, 0x19, 0x15, 0x12, 0x00, 0x10, 0x11, 0x16,
+0x15, 0x15, 0x15, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x21, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1D, 0x1D, 0x20, 0x23, 0x23,
+0x1A, 0x0C, 0x0C, 0x19, 0x20, 0x20, 0x16, 0xF3, 0xFA, 0x12, 0x1B, 0x14, 0x0D, 0xEB, 0xEB, 0xEB,
+0xEA, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x23, 0x23, 0x20, 0x1C, 0x1C, 0x1B, 0x1A, 0x1A,
+0x0E, 0xEE, 0xF1, 0x0B, 0x16, 0x14, 0x13, 0x0F, 0x14, 0x16, 0x18, 0x14, 0x10, 0x0F, 0x16, 0x1B,
+0x1B, 0x1D, 0x1F, 0x1F, 0x1C, 0x1A, 0x19, 0x18, 0x16, 0x15, 0x14, 0x11, 0x14, 0x15, 0x15, 0x15,
+0x15, 0x15, 0x10, 0x07, 0x07, 0x15, 0x1D, 0x1D, 0x1E, 0x1F, 0x1C, 0x1C, 0x18, 0x18, 0x19, 0x19,
+0xF8, 0xE5, 0xE5, 0xE2, 0xDF, 0xDF, 0xE4, 0xEA, 0xED, 0xF3, 0x0F, 0x07, 0x05, 0xF3, 0x0D, 0x15,
+0x15, 0x0C, 0xF2, 0xF2, 0x0A, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x15, 0x0E, 0x05, 0xF5, 0x0C,
+0x12, 0x12, 0xEE, 0xE2, 0xE2, 0xE2, 0xE2, 0xE5, 0xE5, 0xE7, 0xE9, 0xEB, 0xEC, 0xF0, 0xF8, 0xF8,
+0xF0, 0xEB, 0xEC, 0xEE, 0xF2, 0x11, 0x15, 0x1B, 0xEF, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDD, 0xDE,
+0xDD, 0xDD, 0xDC, 0xE2, 0xE8, 0xE8, 0xF2, 0x0F, 0x0F, 0x0D, 0x0B, 0x0B, 0x0A, 0x09, 0xE9, 0xE0,
+0xE0, 0xE5, 0xED, 0xED, 0xEC, 0xEB, 0xF0, 0xF1, 0x00, 0xF0, 0xEB, 0xEB, 0xEB, 0xEB, 0xED, 0xF0,
+0x00, 0x13, 0x16, 0x1A, 0x10, 0xF2, 0xF2, 0xED, 0xEA, 0xEA, 0xF1, 0x07, 0x07, 0x0C, 0x10, 0x0F,
+0xFA, 0xEE, 0xEF, 0xF2, 0xF8, 0xED, 0xEA, 0xE2, 0xE5, 0xE6, 0xEC, 0xE7, 0xE7, 0xE3, 0xDF, 0xDE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xDD, 0xDD, 0xDD, 0xE0, 0xE5, 0xE5, 0xE5, 0xE4, 0xE4, 0xE8, 0xEC, 0xEC, 0xEC, 0xEB, 0xEC, 0xEC,
+0xEC, 0xE9, 0xE9, 0xE7, 0xF2, 0x08, 0x11, 0x00, 0xEF, 0xEE, 0xE7, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+0xE7, 0xEE, 0xEE, 0xFA, 0x10, 0x0C, 0xF8, 0xED, 0xE7, 0xE6, 0xE1, 0xEB, 0xEF, 0x0E, 0x11, 0x12,
+0x13, 0xED, 0xE1, 0xE1, 0xE6, 0xEC, 0xEC, 0xEB, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xED, 0xF0, 0xF0,
+0xF0, 0xF1, 0xED, 0xED, 0xEA, 0xEF, 0xF0, 0xF8, 0xE9, 0xE4, 0xE2, 0xE3, 0xE5, 0xE5, 0xE5, 0xE6,
+0xE6, 0xE7, 0xE9, 0xE9, 0x07, 0x18, 0x18, 0x18, 0x18, 0x1A, 0x1B, 0x1E, 0x1C, 0x1C, 0x1A, 0x11,
+0x09, 0xF2, 0xF2, 0xF2, 0xF2, 0x0F, 0x18, 0x18, 0x17, 0x15, 0x15, 0x10, 0x07, 0x09, 0x0B, 0x0E,
+0x14, 0x15, 0x18, 0x1B, 0x1C, 0x1D, 0x17, 0x0E, 0x0E, 0x05, 0xF2, 0xF2, 0xEB, 0xE6, 0xE7, 0xE7,
+0xE8, 0xEA, 0xEA, 0xED, 0xF5, 0x0A, 0x0D, 0xE9, 0xDF, 0xDF, 0xE1, 0xE4, 0xE4, 0xEA, 0xF1, 0x09,
+0x0D, 0x17, 0x16, 0x16, 0x16, 0x10, 0x08, 0x00, 0x09, 0x0D, 0x0D, 0xF9, 0xF0, 0xEF, 0xEE, 0xEC,
+0xE7, 0xE7, 0xE4, 0xE9, 0xEF, 0xF0, 0xEE, 0xED, 0xED, 0xFA, 0x11, 0x10, 0x0F, 0x0D, 0xED, 0xEA,
+0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xDF, 0xDE, 0xE0, 0xE1, 0xEC, 0xEE, 0xF0, 0xF1, 0xEE,
+0xEC, 0xEC, 0xED, 0xEE, 0xED, 0xED, 0xED, 0xE5, 0xE3, 0xE0, 0xE3, 0xE8, 0xE8, 0xE2, 0xDE, 0xE2,
+0xEA, 0x14, 0x18, 0x19, 0x1B, 0x0C, 0xE9, 0xE9, 0xE9, 0xE9, 0xEE, 0xF2, 0x0C, 0x13, 0x15, 0x18,
+0x13, 0x09, 0x09, 0x0E, 0x11, 0xEE, 0xEC, 0xE0, 0xDE, 0xDE, 0xDE, 0xDE, 0xE2, 0xE2, 0xE1, 0xE0,
+0xE5, 0xE6, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF3, 0x00, 0x00, 0xEA, 0xE2, 0xE2,
+0xE7, 0xED, 0xED, 0xEB, 0xEA, 0xEA, 0xEC, 0xEE, 0xF0, 0x0F, 0x1B, 0x1A, 0x19, 0x17, 0x18, 0x19,
+0x1B, 0x1D, 0x1D, 0x20, 0x19, 0x19, 0x0E, 0x04, 0xF8, 0xF3, 0x12, 0x19, 0x1C, 0x17, 0x10, 0x10,
+0x12, 0x14, 0x14, 0x12, 0x10, 0x10, 0x13, 0x15, 0x15, 0x17, 0x19, 0x19, 0x1B, 0x1D, 0x1C, 0x1B,
+0x19, 0x0C, 0x0C, 0xEB, 0xEC, 0xED, 0xED, 0xEF, 0xF0, 0xF0, 0xF9, 0x0C, 0x0C, 0xF0, 0xE8, 0xE8,
+0xE5, 0xE2, 0xE3, 0xE7, 0xEE, 0xF2, 0xF4, 0x09, 0x10, 0x11, 0x16, 0x16, 0x16, 0x16, 0xF2, 0xEB,
+0xE4, 0xE2, 0xE1, 0xE1, 0xE6, 0xEC, 0xEC, 0xE8, 0xE4, 0xE4, 0xEE, 0x10, 0x10, 0x14, 0x18, 0x17,
+0x16, 0x14, 0x12, 0x0F, 0x00, 0xEB, 0xEB, 0xE4, 0xE6, 0xE6, 0xE8, 0xED, 0xF2, 0xF5, 0xEA, 0xE4,
+0xE4, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xEE, 0xF9, 0xEF, 0xEB, 0xE5, 0xEB, 0xEB, 0xF6, 0x0E,
+0x12, 0x15, 0x0C, 0xF2, 0xF2, 0xF1, 0xF0, 0xF0, 0x04, 0x10, 0x12, 0x15, 0x19, 0x14, 0x14, 0x0C,
+0x0F, 0x11, 0x12, 0xF2, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xEA, 0xF1, 0xF1, 0xF0, 0xF0, 0xEC, 0xEC,
+0xE9, 0xEB, 0xED, 0xEE, 0xE8, 0xE3, 0xE3, 0xE6, 0xE8, 0xE8, 0xE6, 0xE4, 0xE4, 0xE1, 0xE0, 0xE0,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE2, 0xE4, 0xE7, 0xEC, 0xF7, 0xFD, 0x06, 0x0C, 0x0D, 0x0D, 0x0E,
+0xF8, 0xEE, 0xEE, 0xED, 0xEB, 0xEB, 0xE4, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x0E, 0x1D, 0x1C, 0x1B,
+0x1B, 0x16, 0x10, 0x0F, 0x0F, 0x0D, 0x08, 0x08, 0xF9, 0x12, 0x18, 0x19, 0x11, 0xF5, 0xF2, 0xED,
+0xE8, 0xE8, 0xE8, 0xE8, 0xEC, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xEE, 0xEC, 0x08, 0x08, 0x16, 0x18,
+0x1A, 0x1A, 0x15, 0x0E, 0x12, 0x16, 0x1C, 0x13, 0x13, 0xF5, 0xF0, 0xEC, 0xEC, 0xEE, 0xEF, 0xEE,
+0xEE, 0xEC, 0xEC, 0xEC, 0xEB, 0xE9, 0xE7, 0xE7, 0xF8, 0x17, 0x16, 0x15, 0x13, 0x13, 0x13, 0x16,
+0x19, 0x19, 0x18, 0x17, 0x17, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1A, 0x12, 0x11, 0x11, 0x0F,
+0x13, 0x13, 0x17, 0x11, 0x11, 0x06, 0xEF, 0xED, 0xE8, 0xE6, 0xE4, 0xE4, 0xEE, 0x0D, 0x0F, 0x11,
+0x12, 0x12, 0x11, 0x10, 0x10, 0x17, 0x1D, 0x1D, 0x16, 0x08, 0x07, 0xF8, 0xF2, 0xEF, 0xEC, 0xE7,
+0xE9, 0xEA, 0xEC, 0xED, 0xED, 0xEE, 0xF5, 0xFA, 0x0A, 0x00, 0xF6, 0xF5, 0xF7, 0xF9, 0xF9, 0xEE,
+0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xEC, 0xEC, 0xEB, 0xEE, 0xEE, 0xF2, 0x08, 0x08, 0x11,
+0x12, 0x12, 0x13, 0x0B, 0xF9, 0xF4, 0xF5, 0xF7, 0xF7, 0x0F, 0x16, 0x16, 0xF4, 0xE5, 0xE5, 0xE4,
+0xE4, 0xE5, 0xF0, 0x13, 0x11, 0x10, 0x0C, 0x12, 0x12, 0x15, 0x15, 0x15, 0x15, 0x0B, 0xF8, 0xF0,
+0xF7, 0x0A, 0x0A, 0xEF, 0xE7, 0xE7, 0xEA, 0xEE, 0xEE, 0xEB, 0xE8, 0xE7, 0xE6, 0xE3, 0xE4, 0xE4,
+0xE5, 0xEB, 0xEC, 0xF5, 0x04, 0x09, 0x0B, 0x0F, 0x12, 0x12, 0x0F, 0x0B, 0x0B, 0x11, 0x15, 0x0A,
+0xF5, 0xE6, 0xEC, 0xEC, 0xF4, 0xF8, 0xFB, 0x06, 0xFB, 0xF7, 0xF7, 0xE9, 0xE2, 0xE2, 0xE5, 0xEA,
+0xF3, 0x07, 0x16, 0x18, 0x18, 0x1A, 0x12, 0x0D, 0xF5, 0x0A, 0x0F, 0x10, 0x16, 0x1B, 0x1B, 0x1A,
+0x1A, 0x1A, 0x1B, 0x1D, 0x1D, 0x1D, 0x1D, 0x10, 0x10, 0xED, 0xEA, 0xE9, 0xE7, 0xF0, 0x0C, 0x0C,
+0xF7, 0xEF, 0xF2, 0xF2, 0xF5, 0xFB, 0x08, 0x08, 0x10, 0x15, 0x15, 0x12, 0x0E, 0x06, 0x06, 0xF3,
+0xEE, 0xEC, 0xEA, 0xEE, 0xF3, 0xF3, 0xF0, 0xED, 0xF6, 0x09, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16,
+0x16, 0x18, 0x19, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x12, 0x0D, 0x0B, 0xF8, 0xF1, 0xF2, 0xF4,
+0xF7, 0x0E, 0x0E, 0x15, 0x0E, 0xFA, 0xF7, 0x0B, 0x11, 0x0C, 0xFB, 0xED, 0xF4, 0xF4, 0x09, 0x0B,
+0x0C, 0x0C, 0x10, 0x13, 0x12, 0x0B, 0xF3, 0xF7, 0xF7, 0x05, 0xF3, 0xF0, 0xEE, 0xF2, 0xFA, 0xFA,
+0x09, 0x0E, 0x09, 0x08, 0xF6, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 0xF3, 0xEF, 0xEC, 0xEC,
+0xF3, 0x09, 0x09, 0xED, 0xE5, 0xE5, 0xE6, 0xE7, 0xE7, 0xE8, 0xEA, 0xEC, 0xEF, 0xF7, 0xED, 0xEC,
+0xE6, 0xEC, 0xEC, 0xF4, 0xF5, 0xF5, 0xF6, 0xF5, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xEF, 0xEC, 0xEC,
+0x00, 0x13, 0x13, 0x0C, 0xF5, 0xF5, 0xF1, 0xEE, 0xEE, 0xEB, 0xE8, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA,
+0xE9, 0x0A, 0x0A, 0x19, 0x16, 0x14, 0x12, 0x07, 0xF2, 0xF1, 0xF0, 0xEF, 0xEF, 0xF3, 0xFA, 0xFA,
+0x00, 0x05, 0x05, 0x0A, 0x0D, 0x0B, 0xFA, 0xF1, 0x03, 0x0C, 0x16, 0x12, 0x12, 0x0D, 0xED, 0xED,
+0xE4, 0xE4, 0xE4, 0xE5, 0xE8, 0xEA, 0xEC, 0xE8, 0xE5, 0xE5, 0xEC, 0x00, 0x00, 0x07, 0x0A, 0x0A,
+0xFB, 0xF4, 0xF4, 0xF4, 0xF5, 0xF6, 0xF6, 0xF8, 0x0A, 0x0A, 0x10, 0xF5, 0xF1, 0xEA, 0xEB, 0xEC,
+0xEC, 0xEF, 0xF3, 0xF3, 0xED, 0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEA, 0xE9, 0xF5, 0xF5, 0x12, 0x0F,
+0x0F, 0x0C, 0x00, 0xF3, 0xF3, 0x05, 0x0E, 0x0E, 0xF5, 0xEB, 0xEB, 0xEB, 0xEA, 0xF2, 0xF2, 0x0B,
+0x08, 0x08, 0x00, 0x05, 0x07, 0x07, 0xF5, 0xEF, 0xEF, 0xEE, 0xEC, 0xEC, 0xEB, 0xEA, 0xEA, 0xEB,
+0xEB, 0xEB, 0xEB, 0xEA, 0xED, 0xED, 0xF0, 0xF1, 0xF1, 0xF1, 0xEF, 0xED, 0xED, 0xEF, 0xF2, 0xF1,
+0xEE, 0xEA, 0xEE, 0xEF, 0xF6, 0xF2, 0xF2, 0xEF, 0xED, 0xEC, 0xED, 0xED, 0xF0, 0xEC, 0xEC, 0xE9,
+0xEE, 0xF6, 0xF8, 0xED, 0xE7, 0xE8, 0xEC, 0xF1, 0xF4, 0xF4, 0xFA, 0xF8, 0xF7, 0xF6, 0xF4, 0xF2,
+0xF2, 0xF1, 0xF0, 0xF3, 0xF3, 0xF8, 0xEE, 0xED, 0xE8, 0xEE, 0xF6, 0xF6, 0xF1, 0xEE, 0xEE, 0xED,
+0xED, 0xED, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xEF, 0xF1, 0xF5, 0xFA, 0xFB, 0x07, 0xF1,
+0xEB, 0xEB, 0xF0, 0x00, 0xF9, 0xF6, 0xF3, 0xF9, 0xF9, 0x09, 0xF7, 0xF3, 0xF1, 0x0E, 0x18, 0x17,
+0x17, 0x16, 0x12, 0x12, 0x0D, 0x0F, 0x0F, 0x10, 0x0F, 0x0E, 0x0D, 0x0D, 0x0D, 0x0F, 0x0F, 0x11,
+0x11, 0x11, 0x10, 0x10, 0x0F, 0x12, 0x13, 0x16, 0x14, 0x14, 0x12, 0x10, 0x10, 0x0D, 0x0F, 0x0F,
+0x10, 0x12, 0x12, 0x14, 0x15, 0x15, 0x15, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x16, 0x15, 0x12, 0x0C, 0x06, 0xF6, 0xEE, 0xEC, 0xEC, 0xEB, 0xF5, 0xF5,
+0x10, 0x12, 0x12, 0x13, 0x0F, 0x0C, 0x08, 0x0D, 0x11, 0x11, 0x0C, 0x00, 0x00, 0x0C, 0x11, 0x11,
+0x0F, 0x0C, 0x0C, 0x0B, 0x08, 0x0C, 0x0E, 0x11, 0x11, 0x11, 0x12, 0x0D, 0x0D, 0x00, 0xFC, 0xFC,
+0xFA, 0x0A, 0x0B, 0x0F, 0x0A, 0x05, 0xFA, 0xF9, 0xF8, 0xF8, 0xFA, 0x00, 0x00, 0x0E, 0x14, 0x14,
+0x15, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x12, 0x12, 0x0E, 0x08, 0x07, 0xF7, 0xF5, 0xF4,
+0xF4, 0xF1, 0xEF, 0xEF, 0xF2, 0xF6, 0xF6, 0xEE, 0xE9, 0xE8, 0xE7, 0xE6, 0xE9, 0xE9, 0xED, 0xEF,
+0xEF, 0xF2, 0xEF, 0xEE, 0xEC, 0xF4, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x13,
+0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0xF3, 0xEB, 0xEB, 0xEC, 0xED, 0xED, 0xF1, 0xF8, 0xF9, 0xFC,
+0x05, 0x0E, 0x0F, 0x14, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x13, 0x10, 0x0E, 0x0D, 0x11, 0x15, 0x15,
+0x11, 0x0B, 0x09, 0xFA, 0xF2, 0xFA, 0xFC, 0x0C, 0x07, 0x07, 0xF9, 0xFC, 0x01, 0x05, 0x03, 0x00,
+0x00, 0xF5, 0xF1, 0xF1, 0xED, 0xE9, 0xE9, 0xEA, 0xEA, 0xEC, 0xEF, 0xED, 0xED, 0xEB, 0xED, 0xED,
+0xEF, 0xF3, 0x00, 0x00, 0xF2, 0xED, 0xED, 0xED, 0xEE, 0xEC, 0xEC, 0xEA, 0xE9, 0xE9, 0xE8, 0xE7,
+0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0xE9, 0xEC, 0xEB, 0xEB, 0xEA, 0xE9, 0xE8, 0xE8, 0xEA, 0xEF, 0xEF,
+0xEF, 0xF0, 0xF6, 0x02, 0x08, 0xF2, 0xEB, 0xEB, 0xEC, 0xED, 0xF1, 0xF1, 0xF6, 0x03, 0x05, 0x0A,
+0x0B, 0x0B, 0x0B, 0x0A, 0x08, 0xF9, 0xF5, 0xF0, 0xF1, 0xF1, 0xF2, 0xF0, 0xEF, 0xEF, 0xEF, 0xEE,
+0xF0, 0xF1, 0xF5, 0xF5, 0xF5, 0xF5, 0xF0, 0xEE, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xED, 0xEC,
+0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 0xED, 0xF2, 0xF2, 0x00, 0xF3, 0xF1, 0xEE,
+0xF8, 0x0A, 0x0E, 0x08, 0xF6, 0xF7, 0xF3, 0xF1, 0xF1, 0xEE, 0xEC, 0xEC, 0xED, 0xEF, 0xF0, 0xF3,
+0xFB, 0xF1, 0xEF, 0xEA, 0xEC, 0xEC, 0xED, 0xF2, 0xF2, 0x00, 0xFC, 0xFC, 0xFB, 0xF3, 0xF0, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF5, 0x04, 0x04, 0x05, 0x06, 0x09, 0x0B,
+0x0D, 0x0A, 0x09, 0xFB, 0xF2, 0xF2, 0xEE, 0xEF, 0xEF, 0xF0, 0xF2, 0xF3, 0xF5, 0xF2, 0xF1, 0xF0,
+0xF2, 0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0, 0xED, 0xED, 0xF1, 0xF8, 0xF9, 0x00, 0x07, 0x05, 0x05,
+0x00, 0x0C, 0x0C, 0x11, 0x0B, 0x0B, 0xF8, 0x00, 0x05, 0x07, 0xF6, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1,
+0xF2, 0xF4, 0xF8, 0x05, 0x0D, 0x10, 0x10, 0x13, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x13, 0x15,
+0x15, 0x13, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x0B, 0x0B, 0xF3, 0xF7, 0xF8, 0x00, 0x08,
+0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0D, 0x0E, 0x0D, 0x0D, 0x0C, 0x0A, 0x0A, 0x08,
+0x06, 0x06, 0x00, 0x06, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0C, 0x0D, 0x0D, 0x09, 0x00, 0x06, 0x08,
+0x0B, 0x08, 0x08, 0x04, 0x09, 0x09, 0x0C, 0x0B, 0x0A, 0x09, 0x0D, 0x0F, 0x0F, 0x0D, 0x09, 0x05,
+0xF9, 0xF9, 0xF8, 0xF7, 0xF2, 0xF2, 0xEE, 0xF2, 0xF4, 0xFB, 0x00, 0x04, 0x04, 0xF2, 0xED, 0xED,
+0xED, 0xED, 0xEC, 0xEC, 0xEB, 0xEE, 0xF0, 0xF1, 0xF5, 0x00, 0xF4, 0xF3, 0xEF, 0xF0, 0xF0, 0xF2,
+0xF1, 0xF0, 0xEF, 0x04, 0x10, 0x10, 0x10, 0x0F, 0x0C, 0x0C, 0x08, 0xFA, 0xF6, 0xF4, 0xEF, 0xEC,
+0xEC, 0xED, 0xEE, 0xF2, 0xF2, 0xF8, 0x04, 0x04, 0x08, 0xFB, 0xF5, 0xF5, 0xF4, 0xF3, 0xF6, 0xF6,
+0xFA, 0xF6, 0xF6, 0xF3, 0xF2, 0xF1, 0xF1, 0xEF, 0xED, 0xF1, 0xF3, 0x06, 0xF5, 0xF5, 0xF0, 0xF1,
+0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF4, 0xF6, 0xF6, 0xF5, 0xF4, 0xF4, 0xF5, 0xF7,
+0xF6, 0xF5, 0xF4, 0xF3, 0xF3, 0xF2, 0xF5, 0xF5, 0xF9, 0x0A, 0x0A, 0x0F, 0x10, 0x10, 0x11, 0x0E,
+0x0E, 0x09, 0x09, 0x09, 0x09, 0x07, 0x06, 0x05, 0x0A, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+0x0A, 0x08, 0xFB, 0xF7, 0xF7, 0xF5, 0xF8, 0xF8, 0x04, 0x00, 0x00, 0xFB, 0xF4, 0xF4, 0xEF, 0xEF,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF1, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0A,
+0x0A, 0x08, 0x06, 0xF8, 0xF4, 0xEE, 0xF0, 0xF0, 0xF2, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xEE, 0xF0,
+0xF1, 0xF3, 0xF2, 0xF2, 0xF2, 0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 0xF2, 0xF3, 0xF3, 0xF3,
+0xF1, 0xF1, 0xEF, 0xF3, 0xF3, 0xF7, 0xF9, 0xF9, 0xFA, 0xF7, 0xF5, 0xF5, 0xFB, 0x09, 0x09, 0xFC,
+0xF5, 0xF9, 0x09, 0x0F, 0x10, 0x10, 0x10, 0x0B, 0x0B, 0xF9, 0xFA, 0xFA, 0xFC, 0x08, 0x0B, 0x0C,
+0x0B, 0x0A, 0x0A, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x08, 0x08, 0x03, 0xFA, 0xFA, 0xF7, 0xFA, 0xFA,
+0x03, 0xF9, 0xF8, 0xF6, 0x07, 0x0D, 0x0D, 0x07, 0xF7, 0xF8, 0xFC, 0x06, 0x08, 0x08, 0x0A, 0x0A,
+0x0A, 0x09, 0x09, 0x09, 0x09, 0xF7, 0xF2, 0xF1, 0xF0, 0xF0, 0xF0, 0xF5, 0x06, 0x06, 0x06, 0x06,
+0x06, 0x06, 0x04, 0x08, 0x08, 0x0B, 0x0A, 0x0A, 0x09, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x05,
+0xF1, 0xF1, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1,
+0xF0, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF, 0xF5, 0xF5, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C,
+0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x0F, 0x0E, 0x0D, 0x0B, 0x0D, 0x0F, 0x0F, 0x0B, 0x04, 0xFE,
+0xFD, 0xFA, 0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0C, 0xFB, 0xF2, 0xF4, 0xF4, 0xF7, 0xF3, 0xF3, 0xF1,
+0xF3, 0xF5, 0xF7, 0xF9, 0x00, 0x04, 0x05, 0x07, 0x09, 0x09, 0x0A, 0x03, 0xF9, 0xF6, 0xF9, 0xF6,
+0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF8, 0xF8, 0xFC, 0x03, 0x03, 0x06, 0xFB, 0xFB, 0xF7,
+0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF5, 0xF4, 0xF4, 0xF4, 0xF6, 0xF8, 0xF8, 0xF6, 0xF5, 0xF5, 0xF5,
+0xF6, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF7, 0xF7, 0xFC, 0xFB, 0xFB, 0xFA, 0x04, 0x04, 0x08,
+0xFD, 0xFB, 0xF6, 0xFD, 0x05, 0x08, 0x08, 0x09, 0x09, 0x05, 0xFA, 0xFA, 0xF6, 0xF3, 0xF3, 0xF5,
+0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0x00, 0xF7, 0xF7, 0xF4, 0xF6, 0xF6, 0xF9, 0xF7, 0xF7, 0xF5,
+0xF4, 0xF4, 0xF4, 0x04, 0x08, 0x0C, 0x0B, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x0D, 0x0A, 0x0B, 0x0B,
+0x0D, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x08, 0x08, 0x05, 0xF9, 0xF8, 0xF5, 0xF9, 0x04, 0x06,
+0xF9, 0xF5, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xFC, 0x07, 0x07, 0x07,
+0x07, 0xF9, 0xF5, 0xF4, 0xF5, 0xF5, 0xF6, 0xFA, 0x07, 0x06, 0x06, 0x05, 0xF8, 0xF8, 0xF4, 0xF3,
+0xF3, 0xF2, 0xF3, 0xF3, 0xF5, 0xF5, 0xF4, 0xF4, 0xFA, 0x08, 0x08, 0x03, 0xF8, 0xF9, 0xFE, 0x07,
+0x04, 0x03, 0xFA, 0x05, 0x05, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x08,
+0x03, 0x04, 0x04, 0x05, 0x04, 0x04, 0x03, 0x06, 0x06, 0x08, 0xFA, 0xF8, 0xF5, 0xF4, 0xF4, 0xF4,
+0xF6, 0xF8, 0xF8, 0xF8, 0xFE, 0xFE, 0x06, 0x08, 0x08, 0x09, 0x05, 0xFA, 0xF9, 0x03, 0x08, 0x08,
+0x08, 0x09, 0x09, 0x09, 0x0A, 0x08, 0x07, 0x05, 0x06, 0x07, 0x04, 0x03, 0xFA, 0xFA, 0xFA, 0xFA,
+0xFB, 0xFB, 0xFC, 0xF9, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB,
+0xFB, 0xFA, 0xF9, 0xFA, 0xFA, 0xFC, 0xF9, 0xF9, 0xF7, 0xF7, 0xF7, 0xF7, 0xF9, 0xFC, 0xFB, 0xF9,
+0xF6, 0xF9, 0xF9, 0xFC, 0xFA, 0xFA, 0xF8, 0xFA, 0xFB, 0xFC, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9,
+0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF7, 0xF8, 0xF6, 0xF6,
+0xF5, 0xF8, 0xF8, 0x03, 0x02, 0x02, 0x00, 0xFB, 0xFB, 0xF9, 0xFB, 0xFB, 0xFD, 0x06, 0x07, 0x08,
+0x08, 0x07, 0x07, 0x05, 0x01, 0x01, 0x05, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05,
+0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x01, 0x01, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFB,
+0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0xFC, 0xFB, 0xFB,
+0xFA, 0xFC, 0xFC, 0x03, 0x02, 0x02, 0x02, 0xFD, 0xFD, 0xFB, 0x01, 0x01, 0x04, 0x04, 0x04, 0x03,
+0x03, 0x03, 0x03, 0x00, 0xFC, 0xFC, 0xFC, 0xFD, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03,
+0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFC, 0x01, 0x01, 0xFF, 0xFE, 0xFD,
+0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0xFE, 0xFD, 0xFD, 0xFC, 0xFC,
+0xFC, 0x00, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0xFE, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0xFF, 0xFF, 0xFF};
@@ -0,0 +1,12 @@
+//Generated by assetpack_build from ../Manifest/asteroids.txt - do not edit
+
+#ifndef __ASTEROIDSIDS_H
+#define __ASTEROIDSIDS_H
+
+#define ASSET_ID_WAVENEMYEXPLODE		0xBAF55D08
+#define ASSET_ID_WAVLEVELUP		0xB5EC0B94
+#define ASSET_ID_WAVPLAYEREXPLODE		0xE18775D9
+#define ASSET_ID_WAVPLAYERSHOOT		0x5E5F3193
+#define ASSET_ID_WAVTHRUSTER		0xBD9C26A4
+
+#endif
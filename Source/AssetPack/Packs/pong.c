@@ -0,0 +1,9591 @@
+//Generated by assetpack_build from ../Manifest/pong.txt - do not edit
+//Asset pack linked into the .assetpack flash section,
+//open it with AssetPack_OpenLinked()
+
+#include <stdint.h>
+
+__attribute__((section(".assetpack"), aligned(4), used))
+const uint8_t _appong[153304] =
+{
+0x41, 0x50, 0x41, 0x4B, 0x01, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+0xD8, 0x56, 0x02, 0x00, 0x60, 0x4F, 0x20, 0xF9, 0x94, 0x01, 0x00, 0x00, 0x63, 0x73, 0x01, 0x00,
+0x03, 0x00, 0xA7, 0x9B, 0x44, 0xAC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFD, 0x2C, 0x0A,
+0x94, 0x01, 0x00, 0x00, 0x63, 0x73, 0x01, 0x00, 0x03, 0x00, 0xA7, 0x9B, 0x44, 0xAC, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x94, 0x0B, 0xEC, 0xB5, 0xF8, 0x74, 0x01, 0x00, 0x95, 0xA6, 0x00, 0x00,
+0x03, 0x00, 0x49, 0xC0, 0x44, 0xAC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x2D, 0xDE, 0x49,
+0x90, 0x1B, 0x02, 0x00, 0xA1, 0x1D, 0x00, 0x00, 0x03, 0x00, 0x57, 0xCA, 0x44, 0xAC, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7C, 0x8F, 0x22, 0xE0, 0x90, 0x1B, 0x02, 0x00, 0xA1, 0x1D, 0x00, 0x00,
+0x03, 0x00, 0x57, 0xCA, 0x44, 0xAC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x3B, 0xD1,
+0x34, 0x39, 0x02, 0x00, 0xA1, 0x1D, 0x00, 0x00, 0x03, 0x00, 0xA9, 0xE0, 0x44, 0xAC, 0x08, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x80, 0xBE, 0xBE, 0xD5, 0xD5, 0xDB, 0xDB, 0xD4, 0xD4, 0xBB, 0xBB, 0x56,
+0x56, 0x32, 0x32, 0x25, 0x25, 0x26, 0x26, 0x36, 0x36, 0x61, 0x61, 0xC0, 0xC0, 0xD6, 0xD6, 0xDB,
+0xDB, 0xD3, 0xD3, 0xB9, 0xB9, 0x52, 0x52, 0x31, 0x31, 0x25, 0x25, 0x27, 0x27, 0x37, 0x37, 0x67,
+0x67, 0xC2, 0xC2, 0xD7, 0xD7, 0xDB, 0xDB, 0xD2, 0xD2, 0xB6, 0xB6, 0x4F, 0x4F, 0x30, 0x30, 0x24,
+0x24, 0x27, 0x27, 0x38, 0x38, 0x67, 0x67, 0xC2, 0xC2, 0xD6, 0xD6, 0xDB, 0xDB, 0xD2, 0xD2, 0xB7,
+0xB7, 0x51, 0x51, 0x30, 0x30, 0x25, 0x25, 0x27, 0x27, 0x38, 0x38, 0x67, 0x67, 0xC2, 0xC2, 0xD6,
+0xD6, 0xDB, 0xDB, 0xD2, 0xD2, 0xB7, 0xB7, 0x51, 0x51, 0x31, 0x31, 0x25, 0x25, 0x27, 0x27, 0x38,
+0x38, 0x67, 0x67, 0xC2, 0xC2, 0xD6, 0xD6, 0xDB, 0xDB, 0xD2, 0xD2, 0xB7, 0xB7, 0x51, 0x51, 0x31,
+0x31, 0x36, 0x36, 0x5D, 0x5D, 0xBD, 0xBD, 0xD2, 0xD2, 0xD7, 0xD7, 0xCE, 0xCE, 0xB5, 0xB5, 0x55,
+0x55, 0x37, 0x37, 0x2C, 0x2C, 0x30, 0x30, 0x40, 0x40, 0x74, 0x74, 0xBC, 0xBC, 0xCD, 0xCD, 0xCE,
+0xCE, 0xC4, 0xC4, 0xA9, 0xA9, 0x53, 0x53, 0x3B, 0x3B, 0x35, 0x35, 0x3A, 0x3A, 0x4C, 0x4C, 0x93,
+0x93, 0xB7, 0xB7, 0xC1, 0xC1, 0xC2, 0xC2, 0xB6, 0xB6, 0x9E, 0x9E, 0x56, 0x56, 0x46, 0x46, 0x41,
+0x41, 0x47, 0x47, 0x56, 0x56, 0x96, 0x96, 0xAF, 0xAF, 0xB8, 0xB8, 0xB5, 0xB5, 0xAC, 0xAC, 0x96,
+0x96, 0x5D, 0x5D, 0x51, 0x51, 0x51, 0x51, 0x55, 0x55, 0x61, 0x61, 0x93, 0x93, 0xA3, 0xA3, 0xA5,
+0xA5, 0xA4, 0xA4, 0x9D, 0x9D, 0x89, 0x89, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x6A, 0x6A, 0x78,
+0x78, 0x85, 0x85, 0x6F, 0x6F, 0x6C, 0x6C, 0x6C, 0x6C, 0x6A, 0x6A, 0x7A, 0x7A, 0x9A, 0x9A, 0xA1,
+0xA1, 0xA3, 0xA3, 0xA3, 0xA3, 0x96, 0x96, 0x66, 0x66, 0x58, 0x58, 0x53, 0x53, 0x51, 0x51, 0x5B,
+0x5B, 0x8D, 0x8D, 0xA9, 0xA9, 0xB4, 0xB4, 0xB8, 0xB8, 0xB1, 0xB1, 0x9E, 0x9E, 0x5A, 0x5A, 0x48,
+0x48, 0x40, 0x40, 0x44, 0x44, 0x51, 0x51, 0x93, 0x93, 0xB3, 0xB3, 0xC2, 0xC2, 0xC3, 0xC3, 0xBB,
+0xBB, 0xA2, 0xA2, 0x54, 0x54, 0x3D, 0x3D, 0x37, 0x37, 0x39, 0x39, 0x4B, 0x4B, 0x98, 0x98, 0xBE,
+0xBE, 0xCB, 0xCB, 0xCD, 0xCD, 0xC2, 0xC2, 0xA5, 0xA5, 0x4B, 0x4B, 0x35, 0x35, 0x2D, 0x2D, 0x32,
+0x32, 0x46, 0x46, 0xA0, 0xA0, 0xC5, 0xC5, 0xD4, 0xD4, 0xD5, 0xD5, 0xC8, 0xC8, 0xA5, 0xA5, 0x45,
+0x45, 0x2C, 0x2C, 0x26, 0x26, 0x2C, 0x2C, 0x42, 0x42, 0xA5, 0xA5, 0xCD, 0xCD, 0xDB, 0xDB, 0xDB,
+0xDB, 0xCD, 0xCD, 0xA6, 0xA6, 0x3E, 0x3E, 0x26, 0x26, 0x24, 0x24, 0x26, 0x26, 0x3F, 0x3F, 0xAC,
+0xAC, 0xD2, 0xD2, 0xDB, 0xDB, 0xDB, 0xDB, 0xD2, 0xD2, 0xA6, 0xA6, 0x3A, 0x3A, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x3B, 0x3B, 0xAC, 0xAC, 0xD5, 0xD5, 0xDB, 0xDB, 0xDB, 0xDB, 0xD6, 0xD6, 0xAA,
+0xAA, 0x38, 0x38, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x37, 0x37, 0xAC, 0xAC, 0xDA, 0xDA, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDA, 0xDA, 0xAE, 0xAE, 0x35, 0x35, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x33,
+0x33, 0xAD, 0xAD, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xB0, 0xB0, 0x34, 0x34, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x31, 0x31, 0xAC, 0xAC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xB4, 0xB4, 0x32, 0x32, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2C, 0x2C, 0xAA, 0xAA, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xBA, 0xBA, 0x35, 0x35, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x28, 0x28, 0x9F, 0x9F, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xC1, 0xC1, 0x39,
+0x39, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x7B, 0x7B, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xC7, 0xC7, 0x3C, 0x3C, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x64,
+0x64, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xCB, 0xCB, 0x42, 0x42, 0x24, 0x24, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x56, 0x56, 0xD8, 0xD8, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xD1,
+0xD1, 0x47, 0x47, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x4A, 0x4A, 0xD1, 0xD1, 0xDB,
+0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xD7, 0xD7, 0x58, 0x58, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+0x24, 0x3F, 0x3F, 0xC8, 0xC8, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x8D, 0x8D, 0x24,
+0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x36, 0x36, 0xC0, 0xC0, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+0xDB, 0xDB, 0xDB, 0xA6, 0xA6, 0x29, 0x29, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x30, 0x30, 0xB4,
+0xB4, 0xDB, 0xDB, 0xDB, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xB5, 0xB5, 0x30, 0x30, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x2A, 0x2A, 0xA4, 0xA4, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xC0,
+0xC0, 0x3D, 0x3D, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x61, 0x61, 0xD3, 0xD3, 0xDA,
+0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xCA, 0xCA, 0x4D, 0x4D, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x4C, 0x4C, 0xC9, 0xC9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xD0, 0xD0, 0x60, 0x60, 0x29,
+0x29, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x43, 0x43, 0xBD, 0xBD, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xD3, 0xD3, 0x9D, 0x9D, 0x32, 0x32, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x3B, 0x3B, 0xAF,
+0xAF, 0xD7, 0xD7, 0xDA, 0xDA, 0xDA, 0xDA, 0xD6, 0xD6, 0xAD, 0xAD, 0x3E, 0x3E, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x36, 0x36, 0x90, 0x90, 0xCB, 0xCB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD7, 0xD7, 0xBA,
+0xBA, 0x4F, 0x4F, 0x2D, 0x2D, 0x25, 0x25, 0x25, 0x25, 0x32, 0x32, 0x59, 0x59, 0xBF, 0xBF, 0xD6,
+0xD6, 0xDA, 0xDA, 0xD6, 0xD6, 0xC1, 0xC1, 0x63, 0x63, 0x38, 0x38, 0x29, 0x29, 0x27, 0x27, 0x31,
+0x31, 0x4F, 0x4F, 0xB0, 0xB0, 0xCB, 0xCB, 0xD5, 0xD5, 0xD3, 0xD3, 0xC2, 0xC2, 0x99, 0x99, 0x44,
+0x44, 0x32, 0x32, 0x2D, 0x2D, 0x35, 0x35, 0x49, 0x49, 0xA0, 0xA0, 0xC0, 0xC0, 0xCD, 0xCD, 0xCC,
+0xCC, 0xC1, 0xC1, 0xA5, 0xA5, 0x52, 0x52, 0x3C, 0x3C, 0x37, 0x37, 0x3A, 0x3A, 0x4A, 0x4A, 0x72,
+0x72, 0xB2, 0xB2, 0xC0, 0xC0, 0xC3, 0xC3, 0xBB, 0xBB, 0xAA, 0xAA, 0x64, 0x64, 0x4C, 0x4C, 0x42,
+0x42, 0x44, 0x44, 0x4D, 0x4D, 0x62, 0x62, 0xA2, 0xA2, 0xB2, 0xB2, 0xB6, 0xB6, 0xB3, 0xB3, 0xA9,
+0xA9, 0x88, 0x88, 0x5B, 0x5B, 0x52, 0x52, 0x50, 0x50, 0x55, 0x55, 0x64, 0x64, 0x92, 0x92, 0xA0,
+0xA0, 0xA6, 0xA6, 0xA5, 0xA5, 0x9C, 0x9C, 0x90, 0x90, 0x6E, 0x6E, 0x67, 0x67, 0x65, 0x65, 0x6D,
+0x6D, 0x72, 0x72, 0x81, 0x81, 0x77, 0x77, 0x73, 0x73, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x8D,
+0x8D, 0x99, 0x99, 0xA3, 0xA3, 0xA4, 0xA4, 0xA2, 0xA2, 0x93, 0x93, 0x66, 0x66, 0x57, 0x57, 0x52,
+0x52, 0x51, 0x51, 0x5A, 0x5A, 0x75, 0x75, 0xA5, 0xA5, 0xB0, 0xB0, 0xB5, 0xB5, 0xB1, 0xB1, 0xA4,
+0xA4, 0x68, 0x68, 0x51, 0x51, 0x45, 0x45, 0x44, 0x44, 0x4C, 0x4C, 0x5F, 0x5F, 0xA4, 0xA4, 0xB9,
+0xB9, 0xC0, 0xC0, 0xBF, 0xBF, 0xB4, 0xB4, 0x95, 0x95, 0x4E, 0x4E, 0x3E, 0x3E, 0x3A, 0x3A, 0x3D,
+0x3D, 0x4E, 0x4E, 0x99, 0x99, 0xBA, 0xBA, 0xC7, 0xC7, 0xCB, 0xCB, 0xC2, 0xC2, 0xAB, 0xAB, 0x55,
+0x55, 0x3C, 0x3C, 0x30, 0x30, 0x32, 0x32, 0x3E, 0x3E, 0x60, 0x60, 0xB6, 0xB6, 0xCC, 0xCC, 0xD3,
+0xD3, 0xCF, 0xCF, 0xBD, 0xBD, 0x6C, 0x6C, 0x3D, 0x3D, 0x2C, 0x2C, 0x28, 0x28, 0x31, 0x31, 0x4A,
+0x4A, 0xAC, 0xAC, 0xCB, 0xCB, 0xD9, 0xD9, 0xD9, 0xD9, 0xCC, 0xCC, 0xAA, 0xAA, 0x46, 0x46, 0x2B,
+0x2B, 0x25, 0x25, 0x25, 0x25, 0x37, 0x37, 0x6A, 0x6A, 0xC6, 0xC6, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xC2, 0xC2, 0x59, 0x59, 0x30, 0x30, 0x25, 0x25, 0x25, 0x25, 0x28, 0x28, 0x47, 0x47, 0xB7,
+0xB7, 0xD7, 0xD7, 0xDA, 0xDA, 0xDA, 0xDA, 0xD3, 0xD3, 0xA8, 0xA8, 0x3B, 0x3B, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x32, 0x32, 0x8F, 0x8F, 0xD0, 0xD0, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xC4,
+0xC4, 0x4E, 0x4E, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x48, 0x48, 0xC1, 0xC1, 0xDA,
+0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xD7, 0xD7, 0xA3, 0xA3, 0x30, 0x30, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x2E, 0x2E, 0x9D, 0x9D, 0xD7, 0xD7, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xC8, 0xC8, 0x4B,
+0x4B, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x43, 0x43, 0xC3, 0xC3, 0xDA, 0xDA, 0xDA,
+0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xAB, 0xAB, 0x2F, 0x2F, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29,
+0x29, 0x99, 0x99, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xCC, 0xCC, 0x4B, 0x4B, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0xC5, 0xC5, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xDA, 0xDA, 0xAC, 0xAC, 0x2E, 0x2E, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x7B,
+0x7B, 0xD9, 0xD9, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xD2, 0xD2, 0x53, 0x53, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x37, 0x37, 0xBF, 0xBF, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+0xDA, 0xB9, 0xB9, 0x35, 0x35, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x58, 0x58, 0xD5,
+0xD5, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xD8, 0xD8, 0x62, 0x62, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x26, 0x31, 0x31, 0xB3, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xC3,
+0xC3, 0x3D, 0x3D, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x49, 0x49, 0xCE, 0xCE, 0xD9,
+0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA1, 0xA1, 0x2A, 0x2A, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x29, 0x29, 0x9A, 0x9A, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xCF, 0xCF, 0x4E,
+0x4E, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x3B, 0x3B, 0xBD, 0xBD, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xB9, 0xB9, 0x39, 0x39, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+0x26, 0x53, 0x53, 0xCF, 0xCF, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD7, 0xD7, 0x8C, 0x8C, 0x2B,
+0x2B, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x31, 0x31, 0xA5, 0xA5, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD9, 0xD9, 0xC7, 0xC7, 0x4C, 0x4C, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x41,
+0x41, 0xBB, 0xBB, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xB5, 0xB5, 0x3E, 0x3E, 0x26,
+0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x29, 0x55, 0x55, 0xC7, 0xC7, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xD1, 0xD1, 0x98, 0x98, 0x34, 0x34, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x36, 0x36, 0x96,
+0x96, 0xCE, 0xCE, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xC3, 0xC3, 0x58, 0x58, 0x2F, 0x2F, 0x26,
+0x26, 0x26, 0x26, 0x27, 0x27, 0x45, 0x45, 0xAF, 0xAF, 0xD1, 0xD1, 0xD9, 0xD9, 0xD9, 0xD9, 0xD2,
+0xD2, 0xB4, 0xB4, 0x4B, 0x4B, 0x2D, 0x2D, 0x26, 0x26, 0x26, 0x26, 0x31, 0x31, 0x52, 0x52, 0xB7,
+0xB7, 0xD1, 0xD1, 0xD9, 0xD9, 0xD8, 0xD8, 0xC9, 0xC9, 0xA4, 0xA4, 0x46, 0x46, 0x30, 0x30, 0x28,
+0x28, 0x2B, 0x2B, 0x3C, 0x3C, 0x64, 0x64, 0xBB, 0xBB, 0xCE, 0xCE, 0xD4, 0xD4, 0xCE, 0xCE, 0xBE,
+0xBE, 0x87, 0x87, 0x44, 0x44, 0x33, 0x33, 0x2F, 0x2F, 0x35, 0x35, 0x49, 0x49, 0x94, 0x94, 0xBB,
+0xBB, 0xC9, 0xC9, 0xCC, 0xCC, 0xC4, 0xC4, 0xB1, 0xB1, 0x64, 0x64, 0x45, 0x45, 0x39, 0x39, 0x39,
+0x39, 0x40, 0x40, 0x54, 0x54, 0x9F, 0x9F, 0xB8, 0xB8, 0xC1, 0xC1, 0xC2, 0xC2, 0xBA, 0xBA, 0xA5,
+0xA5, 0x5E, 0x5E, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x4C, 0x4C, 0x5F, 0x5F, 0xA0, 0xA0, 0xB1,
+0xB1, 0xB8, 0xB8, 0xB5, 0xB5, 0xAD, 0xAD, 0x98, 0x98, 0x61, 0x61, 0x52, 0x52, 0x4F, 0x4F, 0x50,
+0x50, 0x5B, 0x5B, 0x6C, 0x6C, 0x9B, 0x9B, 0xA5, 0xA5, 0xA8, 0xA8, 0xA3, 0xA3, 0x9D, 0x9D, 0x8D,
+0x8D, 0x6A, 0x6A, 0x63, 0x63, 0x66, 0x66, 0x67, 0x67, 0x6C, 0x6C, 0x7B, 0x7B, 0x8A, 0x8A, 0x74,
+0x74, 0x72, 0x72, 0x72, 0x72, 0x6E, 0x6E, 0x7B, 0x7B, 0x96, 0x96, 0x9C, 0x9C, 0x9F, 0x9F, 0xA1,
+0xA1, 0x99, 0x99, 0x77, 0x77, 0x61, 0x61, 0x59, 0x59, 0x53, 0x53, 0x58, 0x58, 0x60, 0x60, 0x8D,
+0x8D, 0xA2, 0xA2, 0xAE, 0xAE, 0xB0, 0xB0, 0xAE, 0xAE, 0xA3, 0xA3, 0x6E, 0x6E, 0x54, 0x54, 0x4A,
+0x4A, 0x46, 0x46, 0x4B, 0x4B, 0x59, 0x59, 0x97, 0x97, 0xB0, 0xB0, 0xBD, 0xBD, 0xBE, 0xBE, 0xB9,
+0xB9, 0xA9, 0xA9, 0x64, 0x64, 0x48, 0x48, 0x3E, 0x3E, 0x3C, 0x3C, 0x42, 0x42, 0x55, 0x55, 0xA1,
+0xA1, 0xBB, 0xBB, 0xC6, 0xC6, 0xC8, 0xC8, 0xC0, 0xC0, 0xAB, 0xAB, 0x5A, 0x5A, 0x40, 0x40, 0x34,
+0x34, 0x33, 0x33, 0x3B, 0x3B, 0x53, 0x53, 0xA9, 0xA9, 0xC4, 0xC4, 0xCF, 0xCF, 0xD0, 0xD0, 0xC6,
+0xC6, 0xAC, 0xAC, 0x51, 0x51, 0x37, 0x37, 0x2B, 0x2B, 0x2C, 0x2C, 0x38, 0x38, 0x54, 0x54, 0xB0,
+0xB0, 0xCC, 0xCC, 0xD6, 0xD6, 0xD5, 0xD5, 0xC9, 0xC9, 0xAC, 0xAC, 0x4B, 0x4B, 0x31, 0x31, 0x26,
+0x26, 0x26, 0x26, 0x33, 0x33, 0x53, 0x53, 0xB7, 0xB7, 0xD1, 0xD1, 0xD9, 0xD9, 0xD9, 0xD9, 0xCE,
+0xCE, 0xAC, 0xAC, 0x46, 0x46, 0x2A, 0x2A, 0x26, 0x26, 0x26, 0x26, 0x2F, 0x2F, 0x53, 0x53, 0xBD,
+0xBD, 0xD7, 0xD7, 0xD9, 0xD9, 0xD9, 0xD9, 0xD1, 0xD1, 0xAB, 0xAB, 0x40, 0x40, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x26, 0x2D, 0x2D, 0x54, 0x54, 0xC2, 0xC2, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD3,
+0xD3, 0xA8, 0xA8, 0x3B, 0x3B, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2B, 0x2B, 0x55, 0x55, 0xC4,
+0xC4, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD5, 0xD5, 0xAC, 0xAC, 0x39, 0x39, 0x26, 0x26, 0x26,
+0x26, 0x26, 0x26, 0x27, 0x27, 0x54, 0x54, 0xC7, 0xC7, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+0xD9, 0xAD, 0xAD, 0x37, 0x37, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x52, 0x52, 0xC9,
+0xC9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xAE, 0xAE, 0x36, 0x36, 0x26, 0x26, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x4F, 0x4F, 0xCA, 0xCA, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xAF, 0xAF, 0x35, 0x35, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x4C, 0x4C, 0xCA,
+0xCA, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xB5, 0xB5, 0x37, 0x37, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x47, 0x47, 0xC6, 0xC6, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xBB, 0xBB, 0x39, 0x39, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x42, 0x42, 0xC4,
+0xC4, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC0, 0xC0, 0x3C, 0x3C, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x3E, 0x3E, 0xC1, 0xC1, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xC3, 0xC3, 0x42, 0x42, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x38, 0x38, 0xBB,
+0xBB, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xCA, 0xCA, 0x4A, 0x4A, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x32, 0x32, 0xB2, 0xB2, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xCF, 0xCF, 0x54, 0x54, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2D, 0x2D, 0xA2,
+0xA2, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD5, 0xD5, 0x64, 0x64, 0x27, 0x27, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x29, 0x84, 0x84, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0x98, 0x98, 0x2C, 0x2C, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x5A,
+0x5A, 0xCF, 0xCF, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xAF, 0xAF, 0x34, 0x34, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x4B, 0x4B, 0xC5, 0xC5, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xBA, 0xBA, 0x3E, 0x3E, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x41,
+0x41, 0xBA, 0xBA, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC2, 0xC2, 0x4C, 0x4C, 0x27,
+0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x39, 0x39, 0xAD, 0xAD, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xC8, 0xC8, 0x5D, 0x5D, 0x2C, 0x2C, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x33,
+0x33, 0x96, 0x96, 0xCE, 0xCE, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xCE, 0xCE, 0x9B, 0x9B, 0x38,
+0x38, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2F, 0x2F, 0x58, 0x58, 0xC2, 0xC2, 0xD8, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xD2, 0xD2, 0xAD, 0xAD, 0x44, 0x44, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x2D,
+0x2D, 0x4C, 0x4C, 0xB5, 0xB5, 0xD2, 0xD2, 0xD8, 0xD8, 0xD8, 0xD8, 0xD2, 0xD2, 0xB6, 0xB6, 0x52,
+0x52, 0x32, 0x32, 0x27, 0x27, 0x27, 0x27, 0x2C, 0x2C, 0x43, 0x43, 0xA2, 0xA2, 0xC8, 0xC8, 0xD7,
+0xD7, 0xD8, 0xD8, 0xD3, 0xD3, 0xBF, 0xBF, 0x69, 0x69, 0x3D, 0x3D, 0x2C, 0x2C, 0x27, 0x27, 0x2C,
+0x2C, 0x3F, 0x3F, 0x6A, 0x6A, 0xBB, 0xBB, 0xCE, 0xCE, 0xD5, 0xD5, 0xD0, 0xD0, 0xC2, 0xC2, 0x9E,
+0x9E, 0x4B, 0x4B, 0x36, 0x36, 0x2F, 0x2F, 0x31, 0x31, 0x3E, 0x3E, 0x59, 0x59, 0xAD, 0xAD, 0xC3,
+0xC3, 0xCC, 0xCC, 0xCA, 0xCA, 0xC1, 0xC1, 0xAA, 0xAA, 0x5A, 0x5A, 0x42, 0x42, 0x39, 0x39, 0x38,
+0x38, 0x3F, 0x3F, 0x54, 0x54, 0x9D, 0x9D, 0xB7, 0xB7, 0xC2, 0xC2, 0xC4, 0xC4, 0xBC, 0xBC, 0xAD,
+0xAD, 0x6C, 0x6C, 0x4E, 0x4E, 0x41, 0x41, 0x3F, 0x3F, 0x43, 0x43, 0x52, 0x52, 0x73, 0x73, 0xAB,
+0xAB, 0xB7, 0xB7, 0xBC, 0xBC, 0xB7, 0xB7, 0xAD, 0xAD, 0x96, 0x96, 0x5B, 0x5B, 0x4D, 0x4D, 0x4B,
+0x4B, 0x4C, 0x4C, 0x54, 0x54, 0x67, 0x67, 0x9C, 0x9C, 0xA8, 0xA8, 0xAE, 0xAE, 0xAE, 0xAE, 0xA6,
+0xA6, 0x99, 0x99, 0x6C, 0x6C, 0x5F, 0x5F, 0x59, 0x59, 0x5C, 0x5C, 0x5F, 0x5F, 0x6B, 0x6B, 0x8A,
+0x8A, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x90, 0x90, 0x8C, 0x8C, 0x81, 0x81, 0x88, 0x88, 0x8B,
+0x8B, 0x95, 0x95, 0x95, 0x95, 0x91, 0x91, 0x89, 0x89, 0x6C, 0x6C, 0x61, 0x61, 0x5F, 0x5F, 0x60,
+0x60, 0x62, 0x62, 0x6E, 0x6E, 0x97, 0x97, 0xA2, 0xA2, 0xA6, 0xA6, 0xAA, 0xAA, 0xA4, 0xA4, 0x99,
+0x99, 0x6A, 0x6A, 0x5A, 0x5A, 0x51, 0x51, 0x50, 0x50, 0x52, 0x52, 0x5E, 0x5E, 0x91, 0x91, 0xA9,
+0xA9, 0xB3, 0xB3, 0xB7, 0xB7, 0xB4, 0xB4, 0xA9, 0xA9, 0x87, 0x87, 0x56, 0x56, 0x47, 0x47, 0x43,
+0x43, 0x45, 0x45, 0x4E, 0x4E, 0x67, 0x67, 0xA9, 0xA9, 0xBA, 0xBA, 0xC0, 0xC0, 0xC1, 0xC1, 0xB8,
+0xB8, 0xA3, 0xA3, 0x5A, 0x5A, 0x45, 0x45, 0x3A, 0x3A, 0x39, 0x39, 0x40, 0x40, 0x53, 0x53, 0x9F,
+0x9F, 0xBC, 0xBC, 0xC8, 0xC8, 0xCC, 0xCC, 0xC5, 0xC5, 0xB4, 0xB4, 0x6C, 0x6C, 0x46, 0x46, 0x35,
+0x35, 0x31, 0x31, 0x35, 0x35, 0x43, 0x43, 0x66, 0x66, 0xB6, 0xB6, 0xC9, 0xC9, 0xD0, 0xD0, 0xCF,
+0xCF, 0xC3, 0xC3, 0xA6, 0xA6, 0x4F, 0x4F, 0x37, 0x37, 0x2B, 0x2B, 0x2B, 0x2B, 0x34, 0x34, 0x4B,
+0x4B, 0xA6, 0xA6, 0xC7, 0xC7, 0xD5, 0xD5, 0xD7, 0xD7, 0xD1, 0xD1, 0xBE, 0xBE, 0x68, 0x68, 0x3C,
+0x3C, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x39, 0x39, 0x62, 0x62, 0xBF, 0xBF, 0xD5, 0xD5, 0xD7,
+0xD7, 0xD7, 0xD7, 0xCE, 0xCE, 0xAD, 0xAD, 0x48, 0x48, 0x2D, 0x2D, 0x28, 0x28, 0x28, 0x28, 0x2A,
+0x2A, 0x44, 0x44, 0xA9, 0xA9, 0xCF, 0xCF, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xC6, 0xC6, 0x6B,
+0x6B, 0x36, 0x36, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x31, 0x31, 0x5A, 0x5A, 0xC2, 0xC2, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xB6, 0xB6, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x3B, 0x3B, 0xA6, 0xA6, 0xD3, 0xD3, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xCF,
+0xCF, 0x94, 0x94, 0x34, 0x34, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4E, 0x4E, 0xC2,
+0xC2, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xC0, 0xC0, 0x4C, 0x4C, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x32, 0x32, 0x97, 0x97, 0xD3, 0xD3, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xA9, 0xA9, 0x37, 0x37, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x40,
+0x40, 0xBA, 0xBA, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xCD, 0xCD, 0x5D, 0x5D, 0x29,
+0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x58, 0x58, 0xCD, 0xCD, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xBD, 0xBD, 0x41, 0x41, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x33, 0x33, 0xA8, 0xA8, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xA4,
+0xA4, 0x31, 0x31, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x41, 0x41, 0xC0, 0xC0, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xCD, 0xCD, 0x59, 0x59, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x5A, 0x5A, 0xCE, 0xCE, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xBF, 0xBF, 0x42, 0x42, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2F, 0x2F, 0xA5,
+0xA5, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xA9, 0xA9, 0x32, 0x32, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x3E, 0x3E, 0xBA, 0xBA, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD2, 0xD2, 0x67, 0x67, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x4F, 0x4F, 0xC9, 0xC9, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xC6, 0xC6, 0x4A,
+0x4A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2B, 0x2B, 0x6E, 0x6E, 0xD2, 0xD2, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xB8, 0xB8, 0x3C, 0x3C, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x35, 0x35, 0xAA, 0xAA, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xA3, 0xA3, 0x33, 0x33, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x40, 0x40, 0xB8,
+0xB8, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xCF, 0xCF, 0x68, 0x68, 0x2E, 0x2E, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4C, 0x4C, 0xC2, 0xC2, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD7, 0xD7, 0xC5, 0xC5, 0x56, 0x56, 0x2A, 0x2A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2C,
+0x2C, 0x5B, 0x5B, 0xC7, 0xC7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xBD, 0xBD, 0x4C,
+0x4C, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x33, 0x33, 0x80, 0x80, 0xCB, 0xCB, 0xD7,
+0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD5, 0xD5, 0xB3, 0xB3, 0x46, 0x46, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x3A, 0x3A, 0x9F, 0x9F, 0xCC, 0xCC, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xCF,
+0xCF, 0xAB, 0xAB, 0x43, 0x43, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x42, 0x42, 0xA5,
+0xA5, 0xCB, 0xCB, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xC9, 0xC9, 0xA1, 0xA1, 0x41, 0x41, 0x2B,
+0x2B, 0x28, 0x28, 0x28, 0x28, 0x2D, 0x2D, 0x48, 0x48, 0xA9, 0xA9, 0xCA, 0xCA, 0xD7, 0xD7, 0xD7,
+0xD7, 0xD5, 0xD5, 0xC4, 0xC4, 0x96, 0x96, 0x42, 0x42, 0x2D, 0x2D, 0x28, 0x28, 0x28, 0x28, 0x34,
+0x34, 0x4E, 0x4E, 0xAB, 0xAB, 0xC8, 0xC8, 0xD5, 0xD5, 0xD7, 0xD7, 0xD0, 0xD0, 0xBE, 0xBE, 0x80,
+0x80, 0x43, 0x43, 0x32, 0x32, 0x2B, 0x2B, 0x2D, 0x2D, 0x3A, 0x3A, 0x54, 0x54, 0xAC, 0xAC, 0xC4,
+0xC4, 0xCF, 0xCF, 0xD0, 0xD0, 0xC9, 0xC9, 0xB6, 0xB6, 0x71, 0x71, 0x46, 0x46, 0x37, 0x37, 0x32,
+0x32, 0x36, 0x36, 0x41, 0x41, 0x5A, 0x5A, 0xAA, 0xAA, 0xBF, 0xBF, 0xC8, 0xC8, 0xC9, 0xC9, 0xC2,
+0xC2, 0xB0, 0xB0, 0x6E, 0x6E, 0x4B, 0x4B, 0x3D, 0x3D, 0x38, 0x38, 0x3C, 0x3C, 0x47, 0x47, 0x60,
+0x60, 0xA7, 0xA7, 0xBA, 0xBA, 0xC1, 0xC1, 0xC2, 0xC2, 0xBA, 0xBA, 0xAB, 0xAB, 0x6D, 0x6D, 0x50,
+0x50, 0x44, 0x44, 0x42, 0x42, 0x44, 0x44, 0x4E, 0x4E, 0x65, 0x65, 0xA1, 0xA1, 0xB0, 0xB0, 0xB7,
+0xB7, 0xB7, 0xB7, 0xB0, 0xB0, 0xA3, 0xA3, 0x70, 0x70, 0x59, 0x59, 0x50, 0x50, 0x4F, 0x4F, 0x51,
+0x51, 0x5B, 0x5B, 0x6B, 0x6B, 0x9A, 0x9A, 0xA4, 0xA4, 0xA9, 0xA9, 0xA7, 0xA7, 0xA3, 0xA3, 0x9A,
+0x9A, 0x75, 0x75, 0x63, 0x63, 0x5F, 0x5F, 0x5D, 0x5D, 0x5E, 0x5E, 0x67, 0x67, 0x71, 0x71, 0x8F,
+0x8F, 0x96, 0x96, 0x9A, 0x9A, 0x94, 0x94, 0x93, 0x93, 0x88, 0x88, 0x7C, 0x7C, 0x76, 0x76, 0x8B,
+0x8B, 0x8C, 0x8C, 0x94, 0x94, 0x91, 0x91, 0x8A, 0x8A, 0x71, 0x71, 0x69, 0x69, 0x61, 0x61, 0x61,
+0x61, 0x63, 0x63, 0x67, 0x67, 0x86, 0x86, 0x9C, 0x9C, 0xA4, 0xA4, 0xA7, 0xA7, 0xA9, 0xA9, 0xA3,
+0xA3, 0x96, 0x96, 0x67, 0x67, 0x59, 0x59, 0x50, 0x50, 0x4F, 0x4F, 0x51, 0x51, 0x5C, 0x5C, 0x7C,
+0x7C, 0xA5, 0xA5, 0xB1, 0xB1, 0xB7, 0xB7, 0xB6, 0xB6, 0xAE, 0xAE, 0x9E, 0x9E, 0x62, 0x62, 0x4E,
+0x4E, 0x46, 0x46, 0x44, 0x44, 0x47, 0x47, 0x53, 0x53, 0x73, 0x73, 0xAA, 0xAA, 0xB8, 0xB8, 0xC0,
+0xC0, 0xBF, 0xBF, 0xB8, 0xB8, 0xA5, 0xA5, 0x61, 0x61, 0x49, 0x49, 0x3F, 0x3F, 0x3A, 0x3A, 0x3F,
+0x3F, 0x4B, 0x4B, 0x6A, 0x6A, 0xAD, 0xAD, 0xC0, 0xC0, 0xC7, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xAD,
+0xAD, 0x61, 0x61, 0x45, 0x45, 0x38, 0x38, 0x32, 0x32, 0x36, 0x36, 0x43, 0x43, 0x60, 0x60, 0xAF,
+0xAF, 0xC5, 0xC5, 0xCE, 0xCE, 0xD0, 0xD0, 0xC8, 0xC8, 0xB5, 0xB5, 0x66, 0x66, 0x42, 0x42, 0x32,
+0x32, 0x2C, 0x2C, 0x2F, 0x2F, 0x3B, 0x3B, 0x56, 0x56, 0xAF, 0xAF, 0xC7, 0xC7, 0xD3, 0xD3, 0xD6,
+0xD6, 0xCE, 0xCE, 0xBD, 0xBD, 0x80, 0x80, 0x42, 0x42, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x29, 0x34,
+0x34, 0x4E, 0x4E, 0xAB, 0xAB, 0xC9, 0xC9, 0xD6, 0xD6, 0xD6, 0xD6, 0xD5, 0xD5, 0xC4, 0xC4, 0x9C,
+0x9C, 0x42, 0x42, 0x2D, 0x2D, 0x29, 0x29, 0x29, 0x29, 0x2D, 0x2D, 0x44, 0x44, 0xA3, 0xA3, 0xC9,
+0xC9, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xCD, 0xCD, 0xAB, 0xAB, 0x46, 0x46, 0x2C, 0x2C, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x3B, 0x3B, 0x8E, 0x8E, 0xC7, 0xC7, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+0xD6, 0xD4, 0xD4, 0xB7, 0xB7, 0x4E, 0x4E, 0x2E, 0x2E, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x33,
+0x33, 0x5D, 0x5D, 0xC3, 0xC3, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xC1, 0xC1, 0x5A,
+0x5A, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2A, 0x2A, 0x4D, 0x4D, 0xBB, 0xBB, 0xD6,
+0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xCC, 0xCC, 0x93, 0x93, 0x34, 0x34, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x40, 0x40, 0xAD, 0xAD, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+0xD6, 0xD6, 0xD6, 0xAE, 0xAE, 0x3E, 0x3E, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x33,
+0x33, 0x90, 0x90, 0xCF, 0xCF, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xBE, 0xBE, 0x4B,
+0x4B, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x57, 0x57, 0xC7, 0xC7, 0xD6,
+0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xCB, 0xCB, 0x62, 0x62, 0x2B, 0x2B, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x43, 0x43, 0xB9, 0xB9, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+0xD6, 0xD6, 0xD6, 0xA6, 0xA6, 0x36, 0x36, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x33,
+0x33, 0x9F, 0x9F, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xBD, 0xBD, 0x45,
+0x45, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x59, 0x59, 0xCA, 0xCA, 0xD6,
+0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xCD, 0xCD, 0x61, 0x61, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x40, 0x40, 0xB8, 0xB8, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+0xD6, 0xD6, 0xD6, 0xAC, 0xAC, 0x37, 0x37, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2F,
+0x2F, 0x91, 0x91, 0xD3, 0xD3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xC3, 0xC3, 0x4D,
+0x4D, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x4D, 0x4D, 0xC3, 0xC3, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD3, 0xD3, 0x97, 0x97, 0x30, 0x30, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0x37, 0xA9, 0xA9, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xBB, 0xBB, 0x44, 0x44, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+0x2A, 0x54, 0x54, 0xC8, 0xC8, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xCE, 0xCE, 0x6F,
+0x6F, 0x2E, 0x2E, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3C, 0x3C, 0xAF, 0xAF, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0x41, 0x41, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2C, 0x2C, 0x5B, 0x5B, 0xC8, 0xC8, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xCA, 0xCA, 0x67, 0x67, 0x30, 0x30, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+0x2A, 0x3D, 0x3D, 0xAD, 0xAD, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6,
+0xB6, 0x45, 0x45, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2E, 0x2E, 0x59, 0x59, 0xC3,
+0xC3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xCA, 0xCA, 0x70, 0x70, 0x35, 0x35, 0x2A,
+0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3E, 0x3E, 0xA7, 0xA7, 0xCF, 0xCF, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0x4D, 0x4D, 0x2C, 0x2C, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2F, 0x2F, 0x54, 0x54, 0xBA, 0xBA, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xC9,
+0xC9, 0x9B, 0x9B, 0x3E, 0x3E, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3D, 0x3D, 0x93,
+0x93, 0xC6, 0xC6, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD3, 0xD3, 0xB9, 0xB9, 0x5A, 0x5A, 0x36,
+0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x32, 0x32, 0x4F, 0x4F, 0xAE, 0xAE, 0xCB, 0xCB, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xC7, 0xC7, 0xA7, 0xA7, 0x4B, 0x4B, 0x33, 0x33, 0x2A, 0x2A, 0x2A,
+0x2A, 0x2C, 0x2C, 0x3D, 0x3D, 0x62, 0x62, 0xB8, 0xB8, 0xCD, 0xCD, 0xD5, 0xD5, 0xD5, 0xD5, 0xCF,
+0xCF, 0xBB, 0xBB, 0x80, 0x80, 0x44, 0x44, 0x32, 0x32, 0x2A, 0x2A, 0x2C, 0x2C, 0x35, 0x35, 0x49,
+0x49, 0x9B, 0x9B, 0xBE, 0xBE, 0xCD, 0xCD, 0xD2, 0xD2, 0xD0, 0xD0, 0xC5, 0xC5, 0xAE, 0xAE, 0x5B,
+0x5B, 0x40, 0x40, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x40, 0x40, 0x59, 0x59, 0xA7, 0xA7, 0xBE,
+0xBE, 0xC9, 0xC9, 0xCB, 0xCB, 0xC6, 0xC6, 0xBA, 0xBA, 0x9E, 0x9E, 0x55, 0x55, 0x42, 0x42, 0x38,
+0x38, 0x36, 0x36, 0x3D, 0x3D, 0x4A, 0x4A, 0x68, 0x68, 0xAC, 0xAC, 0xBD, 0xBD, 0xC4, 0xC4, 0xC5,
+0xC5, 0xBD, 0xBD, 0xB0, 0xB0, 0x8D, 0x8D, 0x52, 0x52, 0x44, 0x44, 0x3F, 0x3F, 0x3F, 0x3F, 0x45,
+0x45, 0x55, 0x55, 0x8F, 0x8F, 0xAC, 0xAC, 0xB9, 0xB9, 0xBD, 0xBD, 0xBB, 0xBB, 0xB4, 0xB4, 0xA3,
+0xA3, 0x6A, 0x6A, 0x53, 0x53, 0x4A, 0x4A, 0x46, 0x46, 0x4A, 0x4A, 0x51, 0x51, 0x60, 0x60, 0x98,
+0x98, 0xA8, 0xA8, 0xAF, 0xAF, 0xB1, 0xB1, 0xAF, 0xAF, 0xA6, 0xA6, 0x98, 0x98, 0x68, 0x68, 0x5B,
+0x5B, 0x53, 0x53, 0x53, 0x53, 0x55, 0x55, 0x5E, 0x5E, 0x6C, 0x6C, 0x96, 0x96, 0xA0, 0xA0, 0xA6,
+0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0x9B, 0x9B, 0x8C, 0x8C, 0x6C, 0x6C, 0x66, 0x66, 0x63, 0x63, 0x62,
+0x62, 0x68, 0x68, 0x6D, 0x6D, 0x79, 0x79, 0x8C, 0x8C, 0x91, 0x91, 0x8C, 0x8C, 0x8C, 0x8C, 0x74,
+0x74, 0x77, 0x77, 0x7D, 0x7D, 0x8D, 0x8D, 0x92, 0x92, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x93,
+0x93, 0x7A, 0x7A, 0x68, 0x68, 0x5F, 0x5F, 0x5C, 0x5C, 0x59, 0x59, 0x5D, 0x5D, 0x64, 0x64, 0x8C,
+0x8C, 0x9D, 0x9D, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xA7, 0xA7, 0x9C, 0x9C, 0x6F, 0x6F, 0x5C,
+0x5C, 0x51, 0x51, 0x4E, 0x4E, 0x4F, 0x4F, 0x54, 0x54, 0x61, 0x61, 0x95, 0x95, 0xA9, 0xA9, 0xB2,
+0xB2, 0xB7, 0xB7, 0xB5, 0xB5, 0xAF, 0xAF, 0x9F, 0x9F, 0x66, 0x66, 0x51, 0x51, 0x48, 0x48, 0x43,
+0x43, 0x45, 0x45, 0x4E, 0x4E, 0x5F, 0x5F, 0x9E, 0x9E, 0xB3, 0xB3, 0xBC, 0xBC, 0xBF, 0xBF, 0xBD,
+0xBD, 0xB3, 0xB3, 0x9F, 0x9F, 0x5C, 0x5C, 0x49, 0x49, 0x3D, 0x3D, 0x3B, 0x3B, 0x3D, 0x3D, 0x48,
+0x48, 0x5F, 0x5F, 0xA6, 0xA6, 0xBA, 0xBA, 0xC5, 0xC5, 0xC7, 0xC7, 0xC4, 0xC4, 0xB9, 0xB9, 0xA0,
+0xA0, 0x55, 0x55, 0x41, 0x41, 0x38, 0x38, 0x34, 0x34, 0x39, 0x39, 0x45, 0x45, 0x60, 0x60, 0xAC,
+0xAC, 0xC1, 0xC1, 0xCB, 0xCB, 0xCE, 0xCE, 0xC9, 0xC9, 0xBB, 0xBB, 0x9D, 0x9D, 0x4F, 0x4F, 0x3A,
+0x3A, 0x31, 0x31, 0x2F, 0x2F, 0x34, 0x34, 0x43, 0x43, 0x65, 0x65, 0xB3, 0xB3, 0xC7, 0xC7, 0xD2,
+0xD2, 0xD3, 0xD3, 0xCD, 0xCD, 0xBD, 0xBD, 0x99, 0x99, 0x48, 0x48, 0x34, 0x34, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2F, 0x2F, 0x40, 0x40, 0x65, 0x65, 0xB9, 0xB9, 0xCD, 0xCD, 0xD4, 0xD4, 0xD4, 0xD4, 0xD1,
+0xD1, 0xC0, 0xC0, 0x98, 0x98, 0x45, 0x45, 0x30, 0x30, 0x2B, 0x2B, 0x2B, 0x2B, 0x2C, 0x2C, 0x3E,
+0x3E, 0x6A, 0x6A, 0xBC, 0xBC, 0xD2, 0xD2, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC2, 0xC2, 0x92,
+0x92, 0x41, 0x41, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3C, 0x3C, 0x6D, 0x6D, 0xC1,
+0xC1, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC3, 0xC3, 0x8E, 0x8E, 0x3C, 0x3C, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3A, 0x3A, 0x6C, 0x6C, 0xC2, 0xC2, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC7, 0xC7, 0x93, 0x93, 0x3C, 0x3C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x37, 0x37, 0x6B, 0x6B, 0xC4, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xC9, 0xC9, 0x98, 0x98, 0x3A, 0x3A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x35,
+0x35, 0x67, 0x67, 0xC6, 0xC6, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xCB, 0xCB, 0x9B,
+0x9B, 0x3A, 0x3A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x31, 0x31, 0x5F, 0x5F, 0xC4,
+0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD0, 0xD0, 0xA3, 0xA3, 0x3B, 0x3B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2D, 0x2D, 0x57, 0x57, 0xC3, 0xC3, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xAB, 0xAB, 0x3D, 0x3D, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x52, 0x52, 0xC0, 0xC0, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xB1, 0xB1, 0x41, 0x41, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x4A, 0x4A, 0xBB, 0xBB, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xBA,
+0xBA, 0x47, 0x47, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x42, 0x42, 0xB5,
+0xB5, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC0, 0xC0, 0x4F, 0x4F, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3C, 0x3C, 0xAC, 0xAC, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC7, 0xC7, 0x5B, 0x5B, 0x2C, 0x2C, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x34, 0x34, 0x9A, 0x9A, 0xD1, 0xD1, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xCF, 0xCF, 0x7F, 0x7F, 0x31, 0x31, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2D, 0x2D, 0x5E, 0x5E, 0xC7, 0xC7, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xB6, 0xB6, 0x45, 0x45, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3C,
+0x3C, 0xAC, 0xAC, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xCE, 0xCE, 0x90,
+0x90, 0x34, 0x34, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x4F, 0x4F, 0xC0,
+0xC0, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC0, 0xC0, 0x4F, 0x4F, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x34, 0x34, 0x90, 0x90, 0xCD, 0xCD, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xAB, 0xAB, 0x3D, 0x3D, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x40, 0x40, 0xAF, 0xAF, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xCA, 0xCA, 0x80, 0x80, 0x34, 0x34, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+0x2B, 0x2B, 0x2B, 0x2C, 0x2C, 0x51, 0x51, 0xBE, 0xBE, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+0xD4, 0xD4, 0xD4, 0xBD, 0xBD, 0x53, 0x53, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+0x2C, 0x36, 0x36, 0x70, 0x70, 0xC8, 0xC8, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2,
+0xD2, 0xAD, 0xAD, 0x45, 0x45, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x40,
+0x40, 0xA4, 0xA4, 0xCD, 0xCD, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xCA, 0xCA, 0x9C,
+0x9C, 0x3E, 0x3E, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2D, 0x2D, 0x4C, 0x4C, 0xB2,
+0xB2, 0xD1, 0xD1, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xC1, 0xC1, 0x64, 0x64, 0x38,
+0x38, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x35, 0x35, 0x5B, 0x5B, 0xBA, 0xBA, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD1, 0xD1, 0xB7, 0xB7, 0x56, 0x56, 0x35, 0x35, 0x2C,
+0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x3C, 0x3C, 0x6D, 0x6D, 0xBE, 0xBE, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xCB, 0xCB, 0xAE, 0xAE, 0x4F, 0x4F, 0x34, 0x34, 0x2C, 0x2C, 0x2C,
+0x2C, 0x2C, 0x2C, 0x2F, 0x2F, 0x44, 0x44, 0x98, 0x98, 0xC0, 0xC0, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+0xD3, 0xD3, 0xD3, 0xC4, 0xC4, 0xA3, 0xA3, 0x4A, 0x4A, 0x34, 0x34, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+0x2C, 0x35, 0x35, 0x4C, 0x4C, 0xA3, 0xA3, 0xC2, 0xC2, 0xD1, 0xD1, 0xD3, 0xD3, 0xD3, 0xD3, 0xCE,
+0xCE, 0xBD, 0xBD, 0x97, 0x97, 0x48, 0x48, 0x36, 0x36, 0x2C, 0x2C, 0x2C, 0x2C, 0x2F, 0x2F, 0x3B,
+0x3B, 0x53, 0x53, 0xA7, 0xA7, 0xC0, 0xC0, 0xCE, 0xCE, 0xD3, 0xD3, 0xD1, 0xD1, 0xC8, 0xC8, 0xB6,
+0xB6, 0x80, 0x80, 0x49, 0x49, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x42, 0x5B,
+0x5B, 0xA9, 0xA9, 0xBE, 0xBE, 0xC9, 0xC9, 0xCE, 0xCE, 0xCB, 0xCB, 0xC2, 0xC2, 0xB0, 0xB0, 0x6B,
+0x6B, 0x4A, 0x4A, 0x3C, 0x3C, 0x35, 0x35, 0x35, 0x35, 0x3A, 0x3A, 0x47, 0x47, 0x60, 0x60, 0xA7,
+0xA7, 0xBA, 0xBA, 0xC4, 0xC4, 0xC8, 0xC8, 0xC4, 0xC4, 0xBC, 0xBC, 0xAB, 0xAB, 0x6B, 0x6B, 0x4E,
+0x4E, 0x42, 0x42, 0x3C, 0x3C, 0x3C, 0x3C, 0x41, 0x41, 0x4D, 0x4D, 0x65, 0x65, 0xA5, 0xA5, 0xB5,
+0xB5, 0xBE, 0xBE, 0xC0, 0xC0, 0xBD, 0xBD, 0xB5, 0xB5, 0xA5, 0xA5, 0x6A, 0x6A, 0x52, 0x52, 0x48,
+0x48, 0x43, 0x43, 0x45, 0x45, 0x49, 0x49, 0x54, 0x54, 0x6B, 0x6B, 0xA2, 0xA2, 0xAE, 0xAE, 0xB6,
+0xB6, 0xB8, 0xB8, 0xB5, 0xB5, 0xAE, 0xAE, 0x9F, 0x9F, 0x6C, 0x6C, 0x57, 0x57, 0x4F, 0x4F, 0x4C,
+0x4C, 0x4E, 0x4E, 0x52, 0x52, 0x5B, 0x5B, 0x6E, 0x6E, 0x9C, 0x9C, 0xA6, 0xA6, 0xAC, 0xAC, 0xAE,
+0xAE, 0xAA, 0xAA, 0xA4, 0xA4, 0x98, 0x98, 0x70, 0x70, 0x61, 0x61, 0x5B, 0x5B, 0x58, 0x58, 0x5A,
+0x5A, 0x5D, 0x5D, 0x64, 0x64, 0x73, 0x73, 0x94, 0x94, 0x9A, 0x9A, 0x9E, 0x9E, 0x9F, 0x9F, 0x9B,
+0x9B, 0x97, 0x97, 0x8E, 0x8E, 0x77, 0x77, 0x6E, 0x6E, 0x6E, 0x6E, 0x6C, 0x6C, 0x74, 0x74, 0x75,
+0x75, 0x76, 0x76, 0x83, 0x83, 0x7B, 0x7B, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x6B, 0x6B, 0x6D,
+0x6D, 0x70, 0x70, 0x88, 0x88, 0x93, 0x93, 0x9B, 0x9B, 0x9D, 0x9D, 0xA0, 0xA0, 0x9E, 0x9E, 0x98,
+0x98, 0x8E, 0x8E, 0x6B, 0x6B, 0x60, 0x60, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x5D, 0x5D, 0x65,
+0x65, 0x8C, 0x8C, 0x9E, 0x9E, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xAB, 0xAB, 0xA3, 0xA3, 0x95,
+0x95, 0x65, 0x65, 0x56, 0x56, 0x4F, 0x4F, 0x4D, 0x4D, 0x4C, 0x4C, 0x52, 0x52, 0x5D, 0x5D, 0x8A,
+0x8A, 0xA4, 0xA4, 0xB0, 0xB0, 0xB5, 0xB5, 0xB7, 0xB7, 0xB4, 0xB4, 0xAB, 0xAB, 0x9B, 0x9B, 0x63,
+0x63, 0x51, 0x51, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x4A, 0x4A, 0x55, 0x55, 0x74, 0x74, 0xA8,
+0xA8, 0xB6, 0xB6, 0xBD, 0xBD, 0xC0, 0xC0, 0xBD, 0xBD, 0xB4, 0xB4, 0xA3, 0xA3, 0x63, 0x63, 0x4D,
+0x4D, 0x41, 0x41, 0x3D, 0x3D, 0x3C, 0x3C, 0x42, 0x42, 0x4E, 0x4E, 0x6A, 0x6A, 0xAA, 0xAA, 0xBB,
+0xBB, 0xC4, 0xC4, 0xC7, 0xC7, 0xC5, 0xC5, 0xBB, 0xBB, 0xAA, 0xAA, 0x65, 0x65, 0x4A, 0x4A, 0x3D,
+0x3D, 0x37, 0x37, 0x36, 0x36, 0x3B, 0x3B, 0x47, 0x47, 0x61, 0x61, 0xA9, 0xA9, 0xBD, 0xBD, 0xC8,
+0xC8, 0xCD, 0xCD, 0xCB, 0xCB, 0xC2, 0xC2, 0xB2, 0xB2, 0x71, 0x71, 0x4A, 0x4A, 0x3A, 0x3A, 0x32,
+0x32, 0x2F, 0x2F, 0x34, 0x34, 0x3F, 0x3F, 0x57, 0x57, 0xA6, 0xA6, 0xBF, 0xBF, 0xCC, 0xCC, 0xD2,
+0xD2, 0xD1, 0xD1, 0xC9, 0xC9, 0xBA, 0xBA, 0x95, 0x95, 0x4B, 0x4B, 0x38, 0x38, 0x2E, 0x2E, 0x2D,
+0x2D, 0x2E, 0x2E, 0x38, 0x38, 0x4E, 0x4E, 0xA0, 0xA0, 0xBE, 0xBE, 0xCD, 0xCD, 0xD2, 0xD2, 0xD2,
+0xD2, 0xCF, 0xCF, 0xC1, 0xC1, 0xA4, 0xA4, 0x50, 0x50, 0x38, 0x38, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x31, 0x31, 0x44, 0x44, 0x80, 0x80, 0xBB, 0xBB, 0xCE, 0xCE, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xCA, 0xCA, 0xB1, 0xB1, 0x59, 0x59, 0x3A, 0x3A, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x3B, 0x3B, 0x5E, 0x5E, 0xB6, 0xB6, 0xCE, 0xCE, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1,
+0xD1, 0xBC, 0xBC, 0x69, 0x69, 0x3D, 0x3D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x33,
+0x33, 0x4F, 0x4F, 0xAD, 0xAD, 0xCB, 0xCB, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC6,
+0xC6, 0xA1, 0xA1, 0x44, 0x44, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x42,
+0x42, 0x9A, 0x9A, 0xC6, 0xC6, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xCF, 0xCF, 0xB3,
+0xB3, 0x4F, 0x4F, 0x30, 0x30, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x37, 0x37, 0x5F,
+0x5F, 0xBE, 0xBE, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC0, 0xC0, 0x62,
+0x62, 0x36, 0x36, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x4B, 0x4B, 0xB1,
+0xB1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xCC, 0xCC, 0xA3, 0xA3, 0x40,
+0x40, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x3B, 0x3B, 0x98, 0x98, 0xC9,
+0xC9, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB9, 0xB9, 0x4F, 0x4F, 0x2E,
+0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2F, 0x2F, 0x55, 0x55, 0xBC, 0xBC, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC8, 0xC8, 0x8F, 0x8F, 0x39, 0x39, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x3F, 0x3F, 0xA5, 0xA5, 0xCF, 0xCF, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB4, 0xB4, 0x4A, 0x4A, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x31, 0x31, 0x5A, 0x5A, 0xC2, 0xC2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC7, 0xC7, 0x6D, 0x6D, 0x34, 0x34, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x41, 0x41, 0xAB, 0xAB, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB3, 0xB3, 0x46, 0x46, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x30, 0x30, 0x5D, 0x5D, 0xC3, 0xC3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC8, 0xC8, 0x6A, 0x6A, 0x35, 0x35, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x3F, 0x3F, 0xAA, 0xAA, 0xD1, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB5, 0xB5, 0x4B, 0x4B, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x56, 0x56, 0xBE, 0xBE, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xCB, 0xCB, 0x99, 0x99, 0x39, 0x39, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x3B, 0x3B, 0x99, 0x99, 0xCC, 0xCC, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xBE, 0xBE, 0x55, 0x55, 0x2E, 0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x2D, 0x2D, 0x4A, 0x4A, 0xB4, 0xB4, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xD2, 0xD2, 0xAD, 0xAD, 0x43, 0x43, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x32, 0x32, 0x60, 0x60, 0xC2, 0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xC7, 0xC7, 0x75, 0x75, 0x38, 0x38, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+0x2D, 0x3E, 0x3E, 0x9F, 0x9F, 0xCC, 0xCC, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+0xD2, 0xBA, 0xBA, 0x55, 0x55, 0x30, 0x30, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+0x2E, 0x4A, 0x4A, 0xB2, 0xB2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xCF,
+0xCF, 0xAD, 0xAD, 0x47, 0x47, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x33,
+0x33, 0x5A, 0x5A, 0xBD, 0xBD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xC7,
+0xC7, 0x99, 0x99, 0x3F, 0x3F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x3C,
+0x3C, 0x80, 0x80, 0xC2, 0xC2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xBF,
+0xBF, 0x68, 0x68, 0x3A, 0x3A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x45,
+0x45, 0xA1, 0xA1, 0xC7, 0xC7, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0, 0xB6,
+0xB6, 0x58, 0x58, 0x36, 0x36, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x32, 0x32, 0x4D,
+0x4D, 0xAC, 0xAC, 0xC9, 0xC9, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xCA, 0xCA, 0xAD,
+0xAD, 0x50, 0x50, 0x35, 0x35, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x38, 0x38, 0x57,
+0x57, 0xB1, 0xB1, 0xCB, 0xCB, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xC3, 0xC3, 0xA2,
+0xA2, 0x4C, 0x4C, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x3E, 0x3E, 0x5F,
+0x5F, 0xB4, 0xB4, 0xCB, 0xCB, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0, 0xBE, 0xBE, 0x9B,
+0x9B, 0x49, 0x49, 0x35, 0x35, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x32, 0x32, 0x43, 0x43, 0x69,
+0x69, 0xB6, 0xB6, 0xC8, 0xC8, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xCA, 0xCA, 0xB9, 0xB9, 0x90,
+0x90, 0x4A, 0x4A, 0x37, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x36, 0x36, 0x48, 0x48, 0x73,
+0x73, 0xB4, 0xB4, 0xC7, 0xC7, 0xCF, 0xCF, 0xD1, 0xD1, 0xD0, 0xD0, 0xC6, 0xC6, 0xB5, 0xB5, 0x89,
+0x89, 0x4B, 0x4B, 0x39, 0x39, 0x31, 0x31, 0x2E, 0x2E, 0x32, 0x32, 0x3B, 0x3B, 0x4C, 0x4C, 0x89,
+0x89, 0xB4, 0xB4, 0xC3, 0xC3, 0xCB, 0xCB, 0xCE, 0xCE, 0xCA, 0xCA, 0xC1, 0xC1, 0xB0, 0xB0, 0x75,
+0x75, 0x4D, 0x4D, 0x3F, 0x3F, 0x36, 0x36, 0x35, 0x35, 0x38, 0x38, 0x41, 0x41, 0x51, 0x51, 0x8D,
+0x8D, 0xAF, 0xAF, 0xBE, 0xBE, 0xC6, 0xC6, 0xC7, 0xC7, 0xC5, 0xC5, 0xBC, 0xBC, 0xAC, 0xAC, 0x71,
+0x71, 0x51, 0x51, 0x43, 0x43, 0x3C, 0x3C, 0x3A, 0x3A, 0x3D, 0x3D, 0x46, 0x46, 0x55, 0x55, 0x8C,
+0x8C, 0xAC, 0xAC, 0xBA, 0xBA, 0xC0, 0xC0, 0xC2, 0xC2, 0xBF, 0xBF, 0xB7, 0xB7, 0xA8, 0xA8, 0x73,
+0x73, 0x55, 0x55, 0x49, 0x49, 0x42, 0x42, 0x40, 0x40, 0x44, 0x44, 0x4B, 0x4B, 0x59, 0x59, 0x8B,
+0x8B, 0xA8, 0xA8, 0xB3, 0xB3, 0xB9, 0xB9, 0xBA, 0xBA, 0xB7, 0xB7, 0xB1, 0xB1, 0xA3, 0xA3, 0x77,
+0x77, 0x5B, 0x5B, 0x4F, 0x4F, 0x49, 0x49, 0x48, 0x48, 0x4A, 0x4A, 0x51, 0x51, 0x5D, 0x5D, 0x86,
+0x86, 0xA2, 0xA2, 0xAD, 0xAD, 0xB1, 0xB1, 0xB3, 0xB3, 0xB1, 0xB1, 0xAB, 0xAB, 0xA0, 0xA0, 0x85,
+0x85, 0x60, 0x60, 0x56, 0x56, 0x52, 0x52, 0x50, 0x50, 0x53, 0x53, 0x58, 0x58, 0x62, 0x62, 0x78,
+0x78, 0x9B, 0x9B, 0xA2, 0xA2, 0xA7, 0xA7, 0xA8, 0xA8, 0xA5, 0xA5, 0xA1, 0xA1, 0x98, 0x98, 0x88,
+0x88, 0x69, 0x69, 0x63, 0x63, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x61, 0x61, 0x6A, 0x6A, 0x76,
+0x76, 0x91, 0x91, 0x98, 0x98, 0x9C, 0x9C, 0x9A, 0x9A, 0x9A, 0x9A, 0x94, 0x94, 0x90, 0x90, 0x87,
+0x87, 0x74, 0x74, 0x6F, 0x6F, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x7B, 0x7B, 0x7B, 0x7B, 0x84,
+0x84, 0x78, 0x78, 0x76, 0x76, 0x6E, 0x6E, 0x69, 0x69, 0x65, 0x65, 0x67, 0x67, 0x6C, 0x6C, 0x73,
+0x73, 0x8F, 0x8F, 0x99, 0x99, 0x9E, 0x9E, 0xA0, 0xA0, 0xA2, 0xA2, 0xA0, 0xA0, 0x9C, 0x9C, 0x90,
+0x90, 0x6D, 0x6D, 0x61, 0x61, 0x5C, 0x5C, 0x57, 0x57, 0x57, 0x57, 0x5A, 0x5A, 0x5F, 0x5F, 0x6B,
+0x6B, 0x93, 0x93, 0xA1, 0xA1, 0xA8, 0xA8, 0xAD, 0xAD, 0xAD, 0xAD, 0xAB, 0xAB, 0xA4, 0xA4, 0x98,
+0x98, 0x6B, 0x6B, 0x5C, 0x5C, 0x52, 0x52, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x57, 0x57, 0x62,
+0x62, 0x93, 0x93, 0xA5, 0xA5, 0xB0, 0xB0, 0xB5, 0xB5, 0xB7, 0xB7, 0xB4, 0xB4, 0xAD, 0xAD, 0xA1,
+0xA1, 0x6E, 0x6E, 0x57, 0x57, 0x4C, 0x4C, 0x47, 0x47, 0x45, 0x45, 0x47, 0x47, 0x4D, 0x4D, 0x5A,
+0x5A, 0x8B, 0x8B, 0xA7, 0xA7, 0xB4, 0xB4, 0xBB, 0xBB, 0xBD, 0xBD, 0xBB, 0xBB, 0xB6, 0xB6, 0xA9,
+0xA9, 0x8C, 0x8C, 0x58, 0x58, 0x4A, 0x4A, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x46, 0x46, 0x53,
+0x53, 0x6B, 0x6B, 0xA7, 0xA7, 0xB7, 0xB7, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0xBD, 0xBD, 0xB2,
+0xB2, 0x9A, 0x9A, 0x59, 0x59, 0x47, 0x47, 0x3D, 0x3D, 0x38, 0x38, 0x39, 0x39, 0x3E, 0x3E, 0x49,
+0x49, 0x5F, 0x5F, 0xA2, 0xA2, 0xB7, 0xB7, 0xC3, 0xC3, 0xC8, 0xC8, 0xC9, 0xC9, 0xC5, 0xC5, 0xBA,
+0xBA, 0xA6, 0xA6, 0x61, 0x61, 0x48, 0x48, 0x3B, 0x3B, 0x35, 0x35, 0x34, 0x34, 0x37, 0x37, 0x41,
+0x41, 0x53, 0x53, 0x99, 0x99, 0xB6, 0xB6, 0xC4, 0xC4, 0xCC, 0xCC, 0xCE, 0xCE, 0xCB, 0xCB, 0xC1,
+0xC1, 0xB1, 0xB1, 0x6F, 0x6F, 0x4B, 0x4B, 0x3A, 0x3A, 0x32, 0x32, 0x2F, 0x2F, 0x31, 0x31, 0x38,
+0x38, 0x49, 0x49, 0x6D, 0x6D, 0xB2, 0xB2, 0xC5, 0xC5, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA,
+0xCA, 0xBB, 0xBB, 0x9F, 0x9F, 0x51, 0x51, 0x3B, 0x3B, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x31,
+0x31, 0x3F, 0x3F, 0x58, 0x58, 0xAA, 0xAA, 0xC2, 0xC2, 0xCF, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xC5, 0xC5, 0xAE, 0xAE, 0x5B, 0x5B, 0x3F, 0x3F, 0x30, 0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x36, 0x36, 0x4B, 0x4B, 0x99, 0x99, 0xBD, 0xBD, 0xCE, 0xCE, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xCD, 0xCD, 0xBA, 0xBA, 0x8E, 0x8E, 0x46, 0x46, 0x32, 0x32, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x3E, 0x3E, 0x60, 0x60, 0xB4, 0xB4, 0xCB, 0xCB, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xD0, 0xD0, 0xC6, 0xC6, 0xAA, 0xAA, 0x52, 0x52, 0x37, 0x37, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x34, 0x34, 0x4D, 0x4D, 0xA5, 0xA5, 0xC5, 0xC5, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xBC, 0xBC, 0x6A, 0x6A, 0x3F, 0x3F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x3C, 0x3C, 0x64, 0x64, 0xBA, 0xBA, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xC9, 0xC9, 0xA9, 0xA9, 0x4D, 0x4D, 0x32, 0x32, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x31, 0x31, 0x4A, 0x4A, 0xA8, 0xA8, 0xC9, 0xC9, 0xD0, 0xD0, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xBE, 0xBE, 0x69, 0x69, 0x3C, 0x3C, 0x2F, 0x2F, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x39, 0x39, 0x61, 0x61, 0xBB, 0xBB, 0xD0, 0xD0, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xCD, 0xCD, 0xB0, 0xB0, 0x4E, 0x4E, 0x30, 0x30, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x45, 0x45, 0xA4, 0xA4, 0xC8, 0xC8, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xC3, 0xC3, 0x89, 0x89, 0x3E, 0x3E, 0x2F,
+0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x33, 0x33, 0x54, 0x54, 0xB7, 0xB7, 0xD0,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xB9, 0xB9, 0x56, 0x56, 0x33,
+0x33, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x3C, 0x3C, 0x8E, 0x8E, 0xC4,
+0xC4, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xCB, 0xCB, 0xA7, 0xA7, 0x44,
+0x44, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x47, 0x47, 0xAA,
+0xAA, 0xCD, 0xCD, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xC4, 0xC4, 0x75,
+0x75, 0x3B, 0x3B, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x32, 0x32, 0x54,
+0x54, 0xB9, 0xB9, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xBA,
+0xBA, 0x55, 0x55, 0x32, 0x32, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x39,
+0x39, 0x71, 0x71, 0xC3, 0xC3, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xAF, 0xAF, 0x49, 0x49, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x41, 0x41, 0xA3, 0xA3, 0xCB, 0xCB, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xC9, 0xC9, 0x9C, 0x9C, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x4B, 0x4B, 0xB1, 0xB1, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xC3, 0xC3, 0x6A, 0x6A, 0x39, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x32, 0x32, 0x56, 0x56, 0xB9, 0xB9, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xBC, 0xBC, 0x59, 0x59, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x64, 0x64, 0xC0, 0xC0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xB4, 0xB4, 0x51, 0x51, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3B, 0x3B, 0x7C, 0x7C, 0xC4, 0xC4, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xAE, 0xAE, 0x4B, 0x4B, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x40, 0x40, 0x9A, 0x9A, 0xC7, 0xC7, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCC, 0xCC, 0xA9, 0xA9, 0x47, 0x47, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x43, 0x43, 0x9F, 0x9F, 0xC8,
+0xC8, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC9, 0xC9, 0xA5, 0xA5, 0x45,
+0x45, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0xA5,
+0xA5, 0xC8, 0xC8, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC7, 0xC7, 0xA2,
+0xA2, 0x45, 0x45, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x47,
+0x47, 0xA4, 0xA4, 0xC7, 0xC7, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC6,
+0xC6, 0x9F, 0x9F, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x48, 0x48, 0xA4, 0xA4, 0xC6, 0xC6, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xC5, 0xC5, 0xA0, 0xA0, 0x48, 0x48, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x31, 0x31, 0x48, 0x48, 0x9F, 0x9F, 0xC3, 0xC3, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xC5, 0xC5, 0xA4, 0xA4, 0x4B, 0x4B, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x31, 0x31, 0x48, 0x48, 0x9A, 0x9A, 0xC0, 0xC0, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC4, 0xC4, 0xA7, 0xA7, 0x4F, 0x4F, 0x37, 0x37, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32, 0x46, 0x46, 0x90, 0x90, 0xBB, 0xBB, 0xCE, 0xCE, 0xCF,
+0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC5, 0xC5, 0xAB, 0xAB, 0x55, 0x55, 0x3B, 0x3B, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32, 0x44, 0x44, 0x6F, 0x6F, 0xB6, 0xB6, 0xCA,
+0xCA, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC5, 0xC5, 0xAE, 0xAE, 0x5D, 0x5D, 0x40,
+0x40, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x43, 0x43, 0x62, 0x62, 0xB0,
+0xB0, 0xC4, 0xC4, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xC5, 0xC5, 0xB2, 0xB2, 0x69,
+0x69, 0x46, 0x46, 0x36, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0x34, 0x42, 0x42, 0x5B,
+0x5B, 0xA8, 0xA8, 0xBE, 0xBE, 0xCB, 0xCB, 0xCF, 0xCF, 0xCF, 0xCF, 0xCE, 0xCE, 0xC5, 0xC5, 0xB4,
+0xB4, 0x8C, 0x8C, 0x4D, 0x4D, 0x3C, 0x3C, 0x32, 0x32, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x41,
+0x41, 0x55, 0x55, 0x9D, 0x9D, 0xB8, 0xB8, 0xC5, 0xC5, 0xCD, 0xCD, 0xCF, 0xCF, 0xCC, 0xCC, 0xC5,
+0xC5, 0xB7, 0xB7, 0x9C, 0x9C, 0x57, 0x57, 0x43, 0x43, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x37,
+0x37, 0x41, 0x41, 0x51, 0x51, 0x8D, 0x8D, 0xB0, 0xB0, 0xBF, 0xBF, 0xC7, 0xC7, 0xCB, 0xCB, 0xC9,
+0xC9, 0xC3, 0xC3, 0xB7, 0xB7, 0xA4, 0xA4, 0x60, 0x60, 0x4A, 0x4A, 0x3E, 0x3E, 0x38, 0x38, 0x36,
+0x36, 0x39, 0x39, 0x41, 0x41, 0x4E, 0x4E, 0x67, 0x67, 0xA7, 0xA7, 0xB8, 0xB8, 0xC1, 0xC1, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC1, 0xC1, 0xB8, 0xB8, 0xA9, 0xA9, 0x70, 0x70, 0x53, 0x53, 0x46, 0x46, 0x3E,
+0x3E, 0x3C, 0x3C, 0x3D, 0x3D, 0x43, 0x43, 0x4D, 0x4D, 0x60, 0x60, 0x9C, 0x9C, 0xB0, 0xB0, 0xB9,
+0xB9, 0xBF, 0xBF, 0xC0, 0xC0, 0xBD, 0xBD, 0xB7, 0xB7, 0xAB, 0xAB, 0x94, 0x94, 0x5C, 0x5C, 0x4E,
+0x4E, 0x45, 0x45, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4E, 0x4E, 0x5B, 0x5B, 0x8A, 0x8A, 0xA6,
+0xA6, 0xB2, 0xB2, 0xB8, 0xB8, 0xBA, 0xBA, 0xB9, 0xB9, 0xB4, 0xB4, 0xAC, 0xAC, 0x9C, 0x9C, 0x68,
+0x68, 0x58, 0x58, 0x4E, 0x4E, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x50, 0x50, 0x5A, 0x5A, 0x6C,
+0x6C, 0x9B, 0x9B, 0xA9, 0xA9, 0xAF, 0xAF, 0xB3, 0xB3, 0xB3, 0xB3, 0xAF, 0xAF, 0xAA, 0xAA, 0x9F,
+0x9F, 0x84, 0x84, 0x60, 0x60, 0x57, 0x57, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x54, 0x54, 0x5B,
+0x5B, 0x66, 0x66, 0x8E, 0x8E, 0x9E, 0x9E, 0xA7, 0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xA9, 0xA9, 0xA5,
+0xA5, 0x9E, 0x9E, 0x91, 0x91, 0x6C, 0x6C, 0x63, 0x63, 0x5C, 0x5C, 0x59, 0x59, 0x5A, 0x5A, 0x5C,
+0x5C, 0x61, 0x61, 0x68, 0x68, 0x76, 0x76, 0x93, 0x93, 0x9B, 0x9B, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0,
+0xA0, 0x9D, 0x9D, 0x99, 0x99, 0x91, 0x91, 0x7A, 0x7A, 0x6C, 0x6C, 0x69, 0x69, 0x65, 0x65, 0x67,
+0x67, 0x67, 0x67, 0x6A, 0x6A, 0x70, 0x70, 0x75, 0x75, 0x85, 0x85, 0x8B, 0x8B, 0x8E, 0x8E, 0x89,
+0x89, 0x8A, 0x8A, 0x76, 0x76, 0x77, 0x77, 0x79, 0x79, 0x79, 0x79, 0x87, 0x87, 0x8E, 0x8E, 0x91,
+0x91, 0x93, 0x93, 0x97, 0x97, 0x95, 0x95, 0x96, 0x96, 0x91, 0x91, 0x87, 0x87, 0x6F, 0x6F, 0x69,
+0x69, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x62, 0x62, 0x66, 0x66, 0x6B, 0x6B, 0x85, 0x85, 0x94,
+0x94, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3, 0xA3, 0xA4, 0xA4, 0xA1, 0xA1, 0x9E, 0x9E, 0x94, 0x94, 0x72,
+0x72, 0x64, 0x64, 0x5D, 0x5D, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x59, 0x59, 0x60, 0x60, 0x6B,
+0x6B, 0x93, 0x93, 0xA1, 0xA1, 0xA8, 0xA8, 0xAC, 0xAC, 0xAE, 0xAE, 0xAD, 0xAD, 0xAA, 0xAA, 0xA1,
+0xA1, 0x91, 0x91, 0x66, 0x66, 0x5A, 0x5A, 0x52, 0x52, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x55,
+0x55, 0x5E, 0x5E, 0x73, 0x73, 0x9E, 0x9E, 0xAA, 0xAA, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB2,
+0xB2, 0xAD, 0xAD, 0xA1, 0xA1, 0x76, 0x76, 0x5C, 0x5C, 0x50, 0x50, 0x49, 0x49, 0x47, 0x47, 0x46,
+0x46, 0x4A, 0x4A, 0x52, 0x52, 0x5F, 0x5F, 0x93, 0x93, 0xA8, 0xA8, 0xB3, 0xB3, 0xB9, 0xB9, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB7, 0xB7, 0xAE, 0xAE, 0x9D, 0x9D, 0x65, 0x65, 0x53, 0x53, 0x48, 0x48, 0x42,
+0x42, 0x41, 0x41, 0x42, 0x42, 0x48, 0x48, 0x51, 0x51, 0x65, 0x65, 0xA0, 0xA0, 0xB1, 0xB1, 0xBA,
+0xBA, 0xC0, 0xC0, 0xC2, 0xC2, 0xBF, 0xBF, 0xB9, 0xB9, 0xAD, 0xAD, 0x96, 0x96, 0x5B, 0x5B, 0x4A,
+0x4A, 0x41, 0x41, 0x3C, 0x3C, 0x3B, 0x3B, 0x3E, 0x3E, 0x46, 0x46, 0x52, 0x52, 0x71, 0x71, 0xA9,
+0xA9, 0xB9, 0xB9, 0xC1, 0xC1, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3, 0xC3, 0xBA, 0xBA, 0xAB, 0xAB, 0x75,
+0x75, 0x52, 0x52, 0x43, 0x43, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x37, 0x3C, 0x3C, 0x45, 0x45, 0x56,
+0x56, 0x96, 0x96, 0xB1, 0xB1, 0xBF, 0xBF, 0xC7, 0xC7, 0xCB, 0xCB, 0xCA, 0xCA, 0xC5, 0xC5, 0xBA,
+0xBA, 0xA8, 0xA8, 0x64, 0x64, 0x4A, 0x4A, 0x3D, 0x3D, 0x35, 0x35, 0x32, 0x32, 0x33, 0x33, 0x3A,
+0x3A, 0x45, 0x45, 0x5A, 0x5A, 0xA0, 0xA0, 0xB8, 0xB8, 0xC5, 0xC5, 0xCD, 0xCD, 0xCE, 0xCE, 0xCD,
+0xCD, 0xC6, 0xC6, 0xB9, 0xB9, 0xA3, 0xA3, 0x5A, 0x5A, 0x44, 0x44, 0x37, 0x37, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x38, 0x38, 0x46, 0x46, 0x60, 0x60, 0xA9, 0xA9, 0xBE, 0xBE, 0xCA, 0xCA, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC7, 0xC7, 0xB9, 0xB9, 0x9C, 0x9C, 0x52, 0x52, 0x3E, 0x3E, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x37, 0x37, 0x47, 0x47, 0x67, 0x67, 0xB0, 0xB0, 0xC3,
+0xC3, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC7, 0xC7, 0xB8, 0xB8, 0x94, 0x94, 0x4D,
+0x4D, 0x3A, 0x3A, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x37, 0x37, 0x49, 0x49, 0x70,
+0x70, 0xB5, 0xB5, 0xC7, 0xC7, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC9, 0xC9, 0xB6,
+0xB6, 0x76, 0x76, 0x48, 0x48, 0x36, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36,
+0x36, 0x48, 0x48, 0x8C, 0x8C, 0xB8, 0xB8, 0xCA, 0xCA, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xC9, 0xC9, 0xB5, 0xB5, 0x6E, 0x6E, 0x45, 0x45, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x35, 0x35, 0x48, 0x48, 0x94, 0x94, 0xBB, 0xBB, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCB, 0xCB, 0xB6, 0xB6, 0x6A, 0x6A, 0x42, 0x42, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x33, 0x48, 0x48, 0x97, 0x97, 0xBD, 0xBD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCC, 0xCC, 0xB7, 0xB7, 0x68, 0x68, 0x41,
+0x41, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x47, 0x47, 0x95,
+0x95, 0xBE, 0xBE, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xB9,
+0xB9, 0x69, 0x69, 0x41, 0x41, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x45, 0x45, 0x92, 0x92, 0xBE, 0xBE, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xBB, 0xBB, 0x6D, 0x6D, 0x41, 0x41, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x41, 0x41, 0x84, 0x84, 0xBE, 0xBE, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBF, 0xBF, 0x91, 0x91, 0x43, 0x43, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3E, 0x3E, 0x6A, 0x6A, 0xBB, 0xBB, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC2, 0xC2, 0x9C, 0x9C, 0x45,
+0x45, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3B, 0x3B, 0x60,
+0x60, 0xB8, 0xB8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC7,
+0xC7, 0xA5, 0xA5, 0x49, 0x49, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x36, 0x36, 0x55, 0x55, 0xB2, 0xB2, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCB, 0xCB, 0xAE, 0xAE, 0x51, 0x51, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x4B, 0x4B, 0xA9, 0xA9, 0xC8, 0xC8, 0xCD, 0xCD, 0xCD,
+0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xB7, 0xB7, 0x5D, 0x5D, 0x39, 0x39, 0x32,
+0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x44, 0x44, 0x9C, 0x9C, 0xC3,
+0xC3, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC0, 0xC0, 0x75,
+0x75, 0x3F, 0x3F, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3C,
+0x3C, 0x64, 0x64, 0xBB, 0xBB, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+0xCD, 0xC7, 0xC7, 0xA4, 0xA4, 0x49, 0x49, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+0x32, 0x32, 0x32, 0x34, 0x34, 0x52, 0x52, 0xB0, 0xB0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xB4, 0xB4, 0x58, 0x58, 0x36, 0x36, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x45, 0x45, 0x9E, 0x9E, 0xC4, 0xC4, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0xC0, 0x81, 0x81, 0x3F,
+0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3A, 0x3A, 0x5F,
+0x5F, 0xB9, 0xB9, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCA,
+0xCA, 0xAA, 0xAA, 0x4E, 0x4E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x4C, 0x4C, 0xA9, 0xA9, 0xC8, 0xC8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xBA, 0xBA, 0x65, 0x65, 0x3C, 0x3C, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x3D, 0x69, 0x69, 0xBB, 0xBB, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0xC7, 0xA7, 0xA7, 0x4B, 0x4B, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x4D, 0x4D, 0xAA,
+0xAA, 0xC8, 0xC8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xB9,
+0xB9, 0x66, 0x66, 0x3D, 0x3D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x3E, 0x3E, 0x67, 0x67, 0xB9, 0xB9, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xC7, 0xC7, 0xA9, 0xA9, 0x4E, 0x4E, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x4C, 0x4C, 0xA3, 0xA3, 0xC4, 0xC4, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xBD, 0xBD, 0x85, 0x85, 0x43, 0x43, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x3B, 0x5B, 0x5B, 0xB3,
+0xB3, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC9, 0xC9, 0xB1,
+0xB1, 0x59, 0x59, 0x3A, 0x3A, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x45, 0x45, 0x8C, 0x8C, 0xBC, 0xBC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xC2, 0xC2, 0xA1, 0xA1, 0x4D, 0x4D, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x4F, 0x4F, 0xA5, 0xA5, 0xC2, 0xC2, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xB9, 0xB9, 0x75, 0x75, 0x45, 0x45, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3E, 0x5B, 0x5B, 0xAE,
+0xAE, 0xC6, 0xC6, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0xC7, 0xB1,
+0xB1, 0x5F, 0x5F, 0x41, 0x41, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x45, 0x45, 0x6B, 0x6B, 0xB6, 0xB6, 0xC9, 0xC9, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xC2, 0xC2, 0xA9, 0xA9, 0x57, 0x57, 0x3D, 0x3D, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x4B, 0x4B, 0x92, 0x92, 0xB9, 0xB9, 0xCA, 0xCA, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xBC, 0xBC, 0x9F, 0x9F, 0x52, 0x52, 0x3C,
+0x3C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x3D, 0x51, 0x51, 0x9E,
+0x9E, 0xBA, 0xBA, 0xCA, 0xCA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0xC8, 0xB7,
+0xB7, 0x97, 0x97, 0x4F, 0x4F, 0x3C, 0x3C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34,
+0x34, 0x40, 0x40, 0x57, 0x57, 0xA2, 0xA2, 0xBB, 0xBB, 0xC9, 0xC9, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+0xCB, 0xCB, 0xCB, 0xC4, 0xC4, 0xB3, 0xB3, 0x85, 0x85, 0x4E, 0x4E, 0x3C, 0x3C, 0x34, 0x34, 0x34,
+0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x37, 0x44, 0x44, 0x5A, 0x5A, 0xA4, 0xA4, 0xBA, 0xBA, 0xC7,
+0xC7, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xC1, 0xC1, 0xB0, 0xB0, 0x77, 0x77, 0x4E,
+0x4E, 0x3E, 0x3E, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3A, 0x3A, 0x47, 0x47, 0x5E,
+0x5E, 0xA5, 0xA5, 0xBA, 0xBA, 0xC5, 0xC5, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xC8, 0xC8, 0xBE,
+0xBE, 0xAD, 0xAD, 0x73, 0x73, 0x4F, 0x4F, 0x40, 0x40, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x36,
+0x36, 0x3D, 0x3D, 0x4A, 0x4A, 0x60, 0x60, 0xA3, 0xA3, 0xB7, 0xB7, 0xC3, 0xC3, 0xC9, 0xC9, 0xCB,
+0xCB, 0xCA, 0xCA, 0xC5, 0xC5, 0xBB, 0xBB, 0xAB, 0xAB, 0x71, 0x71, 0x52, 0x52, 0x43, 0x43, 0x3A,
+0x3A, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x40, 0x40, 0x4C, 0x4C, 0x62, 0x62, 0xA1, 0xA1, 0xB3,
+0xB3, 0xBF, 0xBF, 0xC5, 0xC5, 0xC7, 0xC7, 0xC6, 0xC6, 0xC1, 0xC1, 0xB8, 0xB8, 0xA9, 0xA9, 0x78,
+0x78, 0x55, 0x55, 0x47, 0x47, 0x3F, 0x3F, 0x3A, 0x3A, 0x3A, 0x3A, 0x3D, 0x3D, 0x43, 0x43, 0x4E,
+0x4E, 0x62, 0x62, 0x9D, 0x9D, 0xB0, 0xB0, 0xBA, 0xBA, 0xC1, 0xC1, 0xC3, 0xC3, 0xC2, 0xC2, 0xBE,
+0xBE, 0xB5, 0xB5, 0xA8, 0xA8, 0x85, 0x85, 0x58, 0x58, 0x4A, 0x4A, 0x43, 0x43, 0x3F, 0x3F, 0x3E,
+0x3E, 0x40, 0x40, 0x46, 0x46, 0x50, 0x50, 0x60, 0x60, 0x99, 0x99, 0xAB, 0xAB, 0xB6, 0xB6, 0xBD,
+0xBD, 0xC0, 0xC0, 0xBF, 0xBF, 0xBC, 0xBC, 0xB4, 0xB4, 0xA8, 0xA8, 0x8C, 0x8C, 0x5A, 0x5A, 0x4C,
+0x4C, 0x44, 0x44, 0x40, 0x40, 0x3F, 0x3F, 0x41, 0x41, 0x46, 0x46, 0x51, 0x51, 0x62, 0x62, 0x9C,
+0x9C, 0xAE, 0xAE, 0xB9, 0xB9, 0xBF, 0xBF, 0xC2, 0xC2, 0xC1, 0xC1, 0xBD, 0xBD, 0xB5, 0xB5, 0xA7,
+0xA7, 0x79, 0x79, 0x57, 0x57, 0x4A, 0x4A, 0x42, 0x42, 0x3E, 0x3E, 0x3D, 0x3D, 0x3F, 0x3F, 0x45,
+0x45, 0x50, 0x50, 0x63, 0x63, 0x9E, 0x9E, 0xB0, 0xB0, 0xBB, 0xBB, 0xC1, 0xC1, 0xC3, 0xC3, 0xC2,
+0xC2, 0xBE, 0xBE, 0xB5, 0xB5, 0xA7, 0xA7, 0x72, 0x72, 0x55, 0x55, 0x48, 0x48, 0x40, 0x40, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3E, 0x3E, 0x45, 0x45, 0x50, 0x50, 0x64, 0x64, 0xA0, 0xA0, 0xB1, 0xB1, 0xBC,
+0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB6, 0xB6, 0xA7, 0xA7, 0x72, 0x72, 0x55,
+0x55, 0x47, 0x47, 0x3F, 0x3F, 0x3B, 0x3B, 0x3A, 0x3A, 0x3D, 0x3D, 0x44, 0x44, 0x4F, 0x4F, 0x63,
+0x63, 0xA0, 0xA0, 0xB2, 0xB2, 0xBD, 0xBD, 0xC3, 0xC3, 0xC5, 0xC5, 0xC4, 0xC4, 0xC0, 0xC0, 0xB7,
+0xB7, 0xA9, 0xA9, 0x73, 0x73, 0x54, 0x54, 0x46, 0x46, 0x3E, 0x3E, 0x3A, 0x3A, 0x39, 0x39, 0x3C,
+0x3C, 0x42, 0x42, 0x4D, 0x4D, 0x61, 0x61, 0x9F, 0x9F, 0xB3, 0xB3, 0xBE, 0xBE, 0xC4, 0xC4, 0xC7,
+0xC7, 0xC6, 0xC6, 0xC2, 0xC2, 0xB9, 0xB9, 0xAB, 0xAB, 0x85, 0x85, 0x55, 0x55, 0x46, 0x46, 0x3D,
+0x3D, 0x39, 0x39, 0x38, 0x38, 0x3A, 0x3A, 0x40, 0x40, 0x4B, 0x4B, 0x5F, 0x5F, 0x9E, 0x9E, 0xB3,
+0xB3, 0xBE, 0xBE, 0xC5, 0xC5, 0xC8, 0xC8, 0xC8, 0xC8, 0xC3, 0xC3, 0xBB, 0xBB, 0xAD, 0xAD, 0x8F,
+0x8F, 0x56, 0x56, 0x46, 0x46, 0x3D, 0x3D, 0x37, 0x37, 0x36, 0x36, 0x38, 0x38, 0x3E, 0x3E, 0x49,
+0x49, 0x5B, 0x5B, 0x9A, 0x9A, 0xB2, 0xB2, 0xBE, 0xBE, 0xC6, 0xC6, 0xC9, 0xC9, 0xC9, 0xC9, 0xC5,
+0xC5, 0xBD, 0xBD, 0xB0, 0xB0, 0x96, 0x96, 0x58, 0x58, 0x47, 0x47, 0x3C, 0x3C, 0x36, 0x36, 0x34,
+0x34, 0x36, 0x36, 0x3B, 0x3B, 0x45, 0x45, 0x56, 0x56, 0x92, 0x92, 0xAF, 0xAF, 0xBD, 0xBD, 0xC6,
+0xC6, 0xCA, 0xCA, 0xCB, 0xCB, 0xC8, 0xC8, 0xC1, 0xC1, 0xB4, 0xB4, 0x9F, 0x9F, 0x5D, 0x5D, 0x49,
+0x49, 0x3D, 0x3D, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x39, 0x39, 0x42, 0x42, 0x51, 0x51, 0x75,
+0x75, 0xAC, 0xAC, 0xBC, 0xBC, 0xC6, 0xC6, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC4, 0xC4, 0xB9,
+0xB9, 0xA6, 0xA6, 0x63, 0x63, 0x4B, 0x4B, 0x3E, 0x3E, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x37,
+0x37, 0x3E, 0x3E, 0x4C, 0x4C, 0x65, 0x65, 0xA7, 0xA7, 0xBA, 0xBA, 0xC5, 0xC5, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xC7, 0xC7, 0xBD, 0xBD, 0xAC, 0xAC, 0x70, 0x70, 0x4F, 0x4F, 0x40, 0x40, 0x37,
+0x37, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3A, 0x3A, 0x46, 0x46, 0x5A, 0x5A, 0x9F, 0x9F, 0xB6,
+0xB6, 0xC3, 0xC3, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC2, 0xC2, 0xB4, 0xB4, 0x99,
+0x99, 0x56, 0x56, 0x44, 0x44, 0x39, 0x39, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x37, 0x41,
+0x41, 0x52, 0x52, 0x8F, 0x8F, 0xB1, 0xB1, 0xC0, 0xC0, 0xC9, 0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xC6, 0xC6, 0xBA, 0xBA, 0xA5, 0xA5, 0x60, 0x60, 0x48, 0x48, 0x3B, 0x3B, 0x35, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x3C, 0x3C, 0x4A, 0x4A, 0x64, 0x64, 0xA9, 0xA9, 0xBC, 0xBC, 0xC7,
+0xC7, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC0, 0xC0, 0xAF, 0xAF, 0x77, 0x77, 0x4F,
+0x4F, 0x3E, 0x3E, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x37, 0x42, 0x42, 0x56,
+0x56, 0x9C, 0x9C, 0xB6, 0xB6, 0xC4, 0xC4, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC6,
+0xC6, 0xB9, 0xB9, 0xA2, 0xA2, 0x5A, 0x5A, 0x44, 0x44, 0x38, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x3C, 0x3C, 0x4B, 0x4B, 0x6A, 0x6A, 0xAD, 0xAD, 0xBF, 0xBF, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC0, 0xC0, 0xAF, 0xAF, 0x6E, 0x6E, 0x4C, 0x4C, 0x3C,
+0x3C, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x42, 0x42, 0x56, 0x56, 0x9E,
+0x9E, 0xB8, 0xB8, 0xC6, 0xC6, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC7, 0xC7, 0xB9,
+0xB9, 0xA1, 0xA1, 0x58, 0x58, 0x43, 0x43, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+0x35, 0x3A, 0x3A, 0x4A, 0x4A, 0x69, 0x69, 0xAE, 0xAE, 0xC0, 0xC0, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC2, 0xC2, 0xB1, 0xB1, 0x76, 0x76, 0x4D, 0x4D, 0x3C, 0x3C, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x53, 0x53, 0x9A, 0x9A, 0xB7,
+0xB7, 0xC6, 0xC6, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC9, 0xC9, 0xBC, 0xBC, 0xA7,
+0xA7, 0x5C, 0x5C, 0x44, 0x44, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37,
+0x37, 0x45, 0x45, 0x5E, 0x5E, 0xA8, 0xA8, 0xBE, 0xBE, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xC6, 0xC6, 0xB7, 0xB7, 0x98, 0x98, 0x51, 0x51, 0x3E, 0x3E, 0x35, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3B, 0x3B, 0x4C, 0x4C, 0x79, 0x79, 0xB3, 0xB3, 0xC4,
+0xC4, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC2, 0xC2, 0xAF, 0xAF, 0x6A,
+0x6A, 0x49, 0x49, 0x39, 0x39, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3F,
+0x3F, 0x54, 0x54, 0x9E, 0x9E, 0xB9, 0xB9, 0xC8, 0xC8, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+0xCA, 0xCA, 0xCA, 0xBE, 0xBE, 0xA8, 0xA8, 0x5B, 0x5B, 0x43, 0x43, 0x35, 0x35, 0x35, 0x35, 0x35,
+0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x43, 0x43, 0x5B, 0x5B, 0xA8, 0xA8, 0xBE, 0xBE, 0xCA,
+0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC9, 0xC9, 0xBA, 0xBA, 0x9F, 0x9F, 0x53,
+0x53, 0x3E, 0x3E, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x47,
+0x47, 0x66, 0x66, 0xAF, 0xAF, 0xC3, 0xC3, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC7, 0xC7, 0xB6, 0xB6, 0x92, 0x92, 0x4D, 0x4D, 0x3B, 0x3B, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x4B, 0x4B, 0x7A, 0x7A, 0xB4, 0xB4, 0xC6, 0xC6, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC5, 0xC5, 0xB3, 0xB3, 0x70, 0x70, 0x49,
+0x49, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3A, 0x3A, 0x4D,
+0x4D, 0x94, 0x94, 0xB7, 0xB7, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC4, 0xC4, 0xB0, 0xB0, 0x67, 0x67, 0x46, 0x46, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x3B, 0x3B, 0x4F, 0x4F, 0x9A, 0x9A, 0xBA, 0xBA, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC4, 0xC4, 0xAF, 0xAF, 0x63, 0x63, 0x44,
+0x44, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3C, 0x3C, 0x51,
+0x51, 0x9E, 0x9E, 0xBB, 0xBB, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC3, 0xC3, 0xAE, 0xAE, 0x61, 0x61, 0x43, 0x43, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x3B, 0x3B, 0x51, 0x51, 0x9E, 0x9E, 0xBC, 0xBC, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC4, 0xC4, 0xAF, 0xAF, 0x61, 0x61, 0x43,
+0x43, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3A, 0x3A, 0x4F,
+0x4F, 0x9C, 0x9C, 0xBB, 0xBB, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC6, 0xC6, 0xB1, 0xB1, 0x66, 0x66, 0x45, 0x45, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x4D, 0x4D, 0x97, 0x97, 0xBA, 0xBA, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC7, 0xC7, 0xB4, 0xB4, 0x6C, 0x6C, 0x47,
+0x47, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x49,
+0x49, 0x8A, 0x8A, 0xB7, 0xB7, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xB7, 0xB7, 0x8C, 0x8C, 0x49, 0x49, 0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x45, 0x45, 0x67, 0x67, 0xB2, 0xB2, 0xC7, 0xC7, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xBC, 0xBC, 0x9D, 0x9D, 0x4F,
+0x4F, 0x3A, 0x3A, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x41,
+0x41, 0x5D, 0x5D, 0xAD, 0xAD, 0xC4, 0xC4, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC1, 0xC1, 0xA7, 0xA7, 0x56, 0x56, 0x3D, 0x3D, 0x36, 0x36, 0x36, 0x36, 0x36,
+0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3C, 0x3C, 0x53, 0x53, 0xA4, 0xA4, 0xC0, 0xC0, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC5, 0xC5, 0xB0, 0xB0, 0x61,
+0x61, 0x42, 0x42, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37,
+0x37, 0x4A, 0x4A, 0x92, 0x92, 0xB9, 0xB9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xB9, 0xB9, 0x90, 0x90, 0x4A, 0x4A, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x42, 0x61, 0x61, 0xB0, 0xB0, 0xC6,
+0xC6, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC1, 0xC1, 0xA6,
+0xA6, 0x54, 0x54, 0x3C, 0x3C, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x3B, 0x3B, 0x52, 0x52, 0xA3, 0xA3, 0xC0, 0xC0, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB3, 0xB3, 0x67, 0x67, 0x44, 0x44, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x46, 0x46, 0x6F, 0x6F, 0xB6,
+0xB6, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xBE,
+0xBE, 0x9F, 0x9F, 0x4F, 0x4F, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x3C, 0x3C, 0x55, 0x55, 0xA6, 0xA6, 0xC1, 0xC1, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB3, 0xB3, 0x65, 0x65, 0x43, 0x43, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x46, 0x46, 0x6F,
+0x6F, 0xB6, 0xB6, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xBF, 0xBF, 0xA2, 0xA2, 0x51, 0x51, 0x3A, 0x3A, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x3A, 0x3A, 0x52, 0x52, 0xA4, 0xA4, 0xC0, 0xC0, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB6, 0xB6, 0x6E, 0x6E, 0x46,
+0x46, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42,
+0x42, 0x61, 0x61, 0xB1, 0xB1, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC4, 0xC4, 0xAB, 0xAB, 0x59, 0x59, 0x3E, 0x3E, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x49, 0x49, 0x92, 0x92, 0xBA, 0xBA, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xBE, 0xBE, 0x9E,
+0x9E, 0x4E, 0x4E, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x3B, 0x3B, 0x53, 0x53, 0xA5, 0xA5, 0xC1, 0xC1, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB7, 0xB7, 0x72, 0x72, 0x47, 0x47, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3F, 0x3F, 0x5C, 0x5C, 0xAE,
+0xAE, 0xC5, 0xC5, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC7,
+0xC7, 0xB0, 0xB0, 0x61, 0x61, 0x41, 0x41, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x67, 0x67, 0xB4, 0xB4, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC4, 0xC4, 0xAB, 0xAB, 0x59, 0x59, 0x3E,
+0x3E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x47,
+0x47, 0x7B, 0x7B, 0xB8, 0xB8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC1, 0xC1, 0xA6, 0xA6, 0x54, 0x54, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x4A, 0x4A, 0x95, 0x95, 0xBB, 0xBB, 0xC8,
+0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC7, 0xC7, 0xC7, 0xC7, 0xBF, 0xBF, 0xA2,
+0xA2, 0x50, 0x50, 0x3A, 0x3A, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x4C, 0x4C, 0x9A, 0x9A, 0xBC, 0xBC, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xBE, 0xBE, 0xA0, 0xA0, 0x50, 0x50, 0x39, 0x39, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x4C, 0x4C, 0x9A,
+0x9A, 0xBC, 0xBC, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xBF, 0xBF, 0xA1, 0xA1, 0x50, 0x50, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x4B, 0x4B, 0x98, 0x98, 0xBB, 0xBB, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xA4, 0xA4, 0x52,
+0x52, 0x3A, 0x3A, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x4A, 0x4A, 0x93, 0x93, 0xBA, 0xBA, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC2, 0xC2, 0xA7, 0xA7, 0x55, 0x55, 0x3C, 0x3C, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x47, 0x47, 0x74, 0x74, 0xB7,
+0xB7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC4,
+0xC4, 0xAC, 0xAC, 0x5B, 0x5B, 0x3F, 0x3F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x42, 0x42, 0x63, 0x63, 0xB2, 0xB2, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB2, 0xB2, 0x65, 0x65, 0x43,
+0x43, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3E,
+0x3E, 0x59, 0x59, 0xAB, 0xAB, 0xC3, 0xC3, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB9, 0xB9, 0x8F, 0x8F, 0x49, 0x49, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3A, 0x3A, 0x50, 0x50, 0x9F, 0x9F, 0xBE,
+0xBE, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xBF,
+0xBF, 0xA3, 0xA3, 0x52, 0x52, 0x3B, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x47, 0x47, 0x74, 0x74, 0xB6, 0xB6, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC5, 0xC5, 0xAF, 0xAF, 0x5F, 0x5F, 0x41,
+0x41, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3F,
+0x3F, 0x5B, 0x5B, 0xAB, 0xAB, 0xC3, 0xC3, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB9, 0xB9, 0x92, 0x92, 0x4B, 0x4B, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x4D, 0x4D, 0x97, 0x97, 0xBA,
+0xBA, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC3,
+0xC3, 0xAA, 0xAA, 0x59, 0x59, 0x3F, 0x3F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+0x38, 0x38, 0x38, 0x38, 0x38, 0x41, 0x41, 0x5F, 0x5F, 0xAE, 0xAE, 0xC5, 0xC5, 0xC7, 0xC7, 0xC7,
+0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xB8, 0xB8, 0x8F, 0x8F, 0x4A,
+0x4A, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x4D, 0x4D, 0x99, 0x99, 0xBB, 0xBB, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC2, 0xC2, 0xAA, 0xAA, 0x5B, 0x5B, 0x40, 0x40, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x40, 0x40, 0x5C, 0x5C, 0xAC,
+0xAC, 0xC3, 0xC3, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xBA, 0xBA, 0x98, 0x98, 0x4D, 0x4D, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x49, 0x49, 0x82, 0x82, 0xB6, 0xB6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB1, 0xB1, 0x66,
+0x66, 0x45, 0x45, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x3C, 0x3C, 0x52, 0x52, 0xA1, 0xA1, 0xBD, 0xBD, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC0, 0xC0, 0xA7, 0xA7, 0x58, 0x58, 0x3F, 0x3F, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x5D,
+0x5D, 0xAC, 0xAC, 0xC2, 0xC2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xBB, 0xBB, 0x9C, 0x9C, 0x50, 0x50, 0x3B, 0x3B, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x47, 0x47, 0x6B, 0x6B, 0xB2, 0xB2, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB6,
+0xB6, 0x8F, 0x8F, 0x4B, 0x4B, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x4B, 0x4B, 0x8B, 0x8B, 0xB6, 0xB6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB2, 0xB2, 0x6B, 0x6B, 0x47,
+0x47, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A,
+0x3A, 0x4E, 0x4E, 0x97, 0x97, 0xB9, 0xB9, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC4, 0xC4, 0xB0, 0xB0, 0x65, 0x65, 0x46, 0x46, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3C, 0x3C, 0x50, 0x50, 0x9B,
+0x9B, 0xBA, 0xBA, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC3, 0xC3, 0xAE, 0xAE, 0x63, 0x63, 0x45, 0x45, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3C, 0x3C, 0x51, 0x51, 0x9C, 0x9C, 0xBA, 0xBA, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3, 0xC3, 0xAE,
+0xAE, 0x63, 0x63, 0x45, 0x45, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+0x39, 0x39, 0x39, 0x3C, 0x3C, 0x50, 0x50, 0x9A, 0x9A, 0xB9, 0xB9, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3, 0xC3, 0xAF, 0xAF, 0x67, 0x67, 0x47,
+0x47, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3B,
+0x3B, 0x4F, 0x4F, 0x96, 0x96, 0xB7, 0xB7, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB2, 0xB2, 0x6E, 0x6E, 0x4A, 0x4A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x4B, 0x4B, 0x84,
+0x84, 0xB4, 0xB4, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xB5, 0xB5, 0x8F, 0x8F, 0x4D, 0x4D, 0x3B, 0x3B, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x48, 0x48, 0x67, 0x67, 0xAF, 0xAF, 0xC2,
+0xC2, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB9,
+0xB9, 0x9D, 0x9D, 0x53, 0x53, 0x3E, 0x3E, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x43, 0x43, 0x5C, 0x5C, 0xA8, 0xA8, 0xBE, 0xBE, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xBE, 0xBE, 0xA7, 0xA7, 0x5C,
+0x5C, 0x44, 0x44, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3F, 0x3F, 0x53, 0x53, 0x9D, 0x9D, 0xB9, 0xB9, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC2, 0xC2, 0xB0, 0xB0, 0x6B, 0x6B, 0x4A, 0x4A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x4B,
+0x4B, 0x72, 0x72, 0xB1, 0xB1, 0xC3, 0xC3, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB7, 0xB7, 0x9A, 0x9A, 0x53, 0x53, 0x3F, 0x3F, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x44, 0x44, 0x5C, 0x5C, 0xA6,
+0xA6, 0xBC, 0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xBE, 0xBE, 0xAA, 0xAA, 0x62, 0x62, 0x47, 0x47, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3D, 0x3D, 0x50, 0x50, 0x91, 0x91, 0xB3, 0xB3, 0xC4,
+0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB5,
+0xB5, 0x96, 0x96, 0x52, 0x52, 0x3F, 0x3F, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x45, 0x45, 0x5D, 0x5D, 0xA6, 0xA6, 0xBC, 0xBC, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xBE, 0xBE, 0xAA, 0xAA, 0x63,
+0x63, 0x48, 0x48, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+0x3A, 0x3D, 0x3D, 0x4E, 0x4E, 0x84, 0x84, 0xB1, 0xB1, 0xC2, 0xC2, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB6, 0xB6, 0x9C, 0x9C, 0x55, 0x55, 0x42,
+0x42, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x43,
+0x43, 0x58, 0x58, 0x9F, 0x9F, 0xB8, 0xB8, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC0, 0xC0, 0xAF, 0xAF, 0x72, 0x72, 0x4E, 0x4E, 0x3D, 0x3D, 0x3A,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3B, 0x3B, 0x49, 0x49, 0x64,
+0x64, 0xAA, 0xAA, 0xBD, 0xBD, 0xC5, 0xC5, 0xC5, 0xC5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xA7, 0xA7, 0x60, 0x60, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x50, 0x50, 0x85, 0x85, 0xB0,
+0xB0, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB6, 0xB6, 0x9E, 0x9E, 0x59, 0x59, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x55, 0x55, 0x98, 0x98, 0xB4, 0xB4, 0xC2,
+0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB3,
+0xB3, 0x95, 0x95, 0x54, 0x54, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x5A, 0x5A, 0x9E, 0x9E, 0xB6, 0xB6, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB0, 0xB0, 0x8C,
+0x8C, 0x52, 0x52, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x5D, 0x5D, 0xA1, 0xA1, 0xB7, 0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xAD, 0xAD, 0x77, 0x77, 0x51,
+0x51, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x49, 0x49, 0x5F, 0x5F, 0xA3, 0xA3, 0xB7, 0xB7, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAD, 0xAD, 0x77, 0x77, 0x51, 0x51, 0x42,
+0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x49,
+0x49, 0x5E, 0x5E, 0xA1, 0xA1, 0xB6, 0xB6, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAD, 0xAD, 0x84, 0x84, 0x52, 0x52, 0x42, 0x42, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x49, 0x49, 0x5D,
+0x5D, 0x9F, 0x9F, 0xB5, 0xB5, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAE, 0xAE, 0x8F, 0x8F, 0x55, 0x55, 0x44, 0x44, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x47, 0x47, 0x5A, 0x5A, 0x9A,
+0x9A, 0xB2, 0xB2, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBF, 0xBF, 0xB1, 0xB1, 0x98, 0x98, 0x58, 0x58, 0x47, 0x47, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x46, 0x46, 0x57, 0x57, 0x93, 0x93, 0xAF,
+0xAF, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0,
+0xC0, 0xB3, 0xB3, 0x9E, 0x9E, 0x5E, 0x5E, 0x4A, 0x4A, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x53, 0x53, 0x74, 0x74, 0xAA, 0xAA, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB6,
+0xB6, 0xA4, 0xA4, 0x66, 0x66, 0x4F, 0x4F, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4E, 0x4E, 0x65, 0x65, 0xA4, 0xA4, 0xB5, 0xB5, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB9, 0xB9, 0xAA,
+0xAA, 0x7B, 0x7B, 0x55, 0x55, 0x46, 0x46, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4A, 0x4A, 0x5C, 0x5C, 0x99, 0x99, 0xB0, 0xB0, 0xBD, 0xBD, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB0, 0xB0, 0x9B,
+0x9B, 0x5D, 0x5D, 0x4B, 0x4B, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x46, 0x46, 0x54, 0x54, 0x72, 0x72, 0xA8, 0xA8, 0xB7, 0xB7, 0xC1, 0xC1, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB6, 0xB6, 0xA6, 0xA6, 0x6B,
+0x6B, 0x52, 0x52, 0x45, 0x45, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x42, 0x42, 0x4D, 0x4D, 0x60, 0x60, 0x9D, 0x9D, 0xB0, 0xB0, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBB, 0xBB, 0xAE, 0xAE, 0x98, 0x98, 0x5C,
+0x5C, 0x4B, 0x4B, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E,
+0x3E, 0x47, 0x47, 0x55, 0x55, 0x72, 0x72, 0xA7, 0xA7, 0xB6, 0xB6, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB5, 0xB5, 0xA6, 0xA6, 0x6F, 0x6F, 0x54,
+0x54, 0x47, 0x47, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42,
+0x42, 0x4D, 0x4D, 0x5E, 0x5E, 0x98, 0x98, 0xAD, 0xAD, 0xB9, 0xB9, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBB, 0xBB, 0xAF, 0xAF, 0x9D, 0x9D, 0x62, 0x62, 0x4F,
+0x4F, 0x44, 0x44, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x46,
+0x46, 0x52, 0x52, 0x67, 0x67, 0xA1, 0xA1, 0xB1, 0xB1, 0xBC, 0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB6, 0xB6, 0xAA, 0xAA, 0x92, 0x92, 0x5B, 0x5B, 0x4C,
+0x4C, 0x43, 0x43, 0x3C, 0x3C, 0x3B, 0x3B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x41, 0x41, 0x4A,
+0x4A, 0x58, 0x58, 0x76, 0x76, 0xA6, 0xA6, 0xB4, 0xB4, 0xBD, 0xBD, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xBC, 0xBC, 0xB3, 0xB3, 0xA5, 0xA5, 0x74, 0x74, 0x57, 0x57, 0x4A,
+0x4A, 0x42, 0x42, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x44, 0x44, 0x4D,
+0x4D, 0x5C, 0x5C, 0x91, 0x91, 0xA9, 0xA9, 0xB5, 0xB5, 0xBD, 0xBD, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xC0, 0xC0, 0xBA, 0xBA, 0xB0, 0xB0, 0xA0, 0xA0, 0x6B, 0x6B, 0x55, 0x55, 0x49,
+0x49, 0x41, 0x41, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0x3F, 0x46, 0x46, 0x50,
+0x50, 0x60, 0x60, 0x96, 0x96, 0xAA, 0xAA, 0xB6, 0xB6, 0xBD, 0xBD, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC3, 0xC3, 0xBF, 0xBF, 0xB8, 0xB8, 0xAE, 0xAE, 0x9D, 0x9D, 0x67, 0x67, 0x54, 0x54, 0x49,
+0x49, 0x42, 0x42, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x41, 0x41, 0x48, 0x48, 0x52,
+0x52, 0x62, 0x62, 0x99, 0x99, 0xAB, 0xAB, 0xB6, 0xB6, 0xBD, 0xBD, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC1, 0xC1, 0xBD, 0xBD, 0xB6, 0xB6, 0xAC, 0xAC, 0x9B, 0x9B, 0x65, 0x65, 0x54, 0x54, 0x4A,
+0x4A, 0x42, 0x42, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3E, 0x3E, 0x42, 0x42, 0x49, 0x49, 0x53,
+0x53, 0x64, 0x64, 0x99, 0x99, 0xAA, 0xAA, 0xB5, 0xB5, 0xBC, 0xBC, 0xC0, 0xC0, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC0, 0xC0, 0xBC, 0xBC, 0xB5, 0xB5, 0xAB, 0xAB, 0x9B, 0x9B, 0x66, 0x66, 0x55, 0x55, 0x4B,
+0x4B, 0x44, 0x44, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x4A, 0x4A, 0x54,
+0x54, 0x64, 0x64, 0x98, 0x98, 0xA9, 0xA9, 0xB4, 0xB4, 0xBA, 0xBA, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1,
+0xC1, 0xBF, 0xBF, 0xBB, 0xBB, 0xB5, 0xB5, 0xAB, 0xAB, 0x9B, 0x9B, 0x68, 0x68, 0x56, 0x56, 0x4C,
+0x4C, 0x45, 0x45, 0x41, 0x41, 0x3E, 0x3E, 0x3E, 0x3E, 0x40, 0x40, 0x44, 0x44, 0x4A, 0x4A, 0x54,
+0x54, 0x62, 0x62, 0x95, 0x95, 0xA7, 0xA7, 0xB2, 0xB2, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0, 0xC0, 0xC0,
+0xC0, 0xBE, 0xBE, 0xBB, 0xBB, 0xB4, 0xB4, 0xAB, 0xAB, 0x9D, 0x9D, 0x6C, 0x6C, 0x59, 0x59, 0x4E,
+0x4E, 0x47, 0x47, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x41, 0x41, 0x44, 0x44, 0x4A, 0x4A, 0x53,
+0x53, 0x60, 0x60, 0x8F, 0x8F, 0xA4, 0xA4, 0xAF, 0xAF, 0xB7, 0xB7, 0xBB, 0xBB, 0xBE, 0xBE, 0xBF,
+0xBF, 0xBD, 0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xAC, 0xAC, 0xA0, 0xA0, 0x74, 0x74, 0x5C, 0x5C, 0x51,
+0x51, 0x49, 0x49, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x45, 0x45, 0x4A, 0x4A, 0x52,
+0x52, 0x5D, 0x5D, 0x77, 0x77, 0xA0, 0xA0, 0xAC, 0xAC, 0xB4, 0xB4, 0xB9, 0xB9, 0xBC, 0xBC, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA3, 0xA3, 0x8E, 0x8E, 0x61, 0x61, 0x54,
+0x54, 0x4C, 0x4C, 0x47, 0x47, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x50,
+0x50, 0x5A, 0x5A, 0x6C, 0x6C, 0x9B, 0x9B, 0xA8, 0xA8, 0xB1, 0xB1, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBA, 0xBA, 0xB6, 0xB6, 0xAF, 0xAF, 0xA6, 0xA6, 0x96, 0x96, 0x67, 0x67, 0x59,
+0x59, 0x4F, 0x4F, 0x49, 0x49, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x45, 0x45, 0x49, 0x49, 0x4F,
+0x4F, 0x57, 0x57, 0x65, 0x65, 0x93, 0x93, 0xA4, 0xA4, 0xAD, 0xAD, 0xB4, 0xB4, 0xB8, 0xB8, 0xBA,
+0xBA, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xA9, 0xA9, 0x9D, 0x9D, 0x72, 0x72, 0x5E,
+0x5E, 0x54, 0x54, 0x4D, 0x4D, 0x48, 0x48, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4E,
+0x4E, 0x55, 0x55, 0x5F, 0x5F, 0x76, 0x76, 0x9E, 0x9E, 0xA9, 0xA9, 0xB0, 0xB0, 0xB5, 0xB5, 0xB8,
+0xB8, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB2, 0xB2, 0xAB, 0xAB, 0xA2, 0xA2, 0x91, 0x91, 0x65,
+0x65, 0x59, 0x59, 0x51, 0x51, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x4C,
+0x4C, 0x52, 0x52, 0x5B, 0x5B, 0x68, 0x68, 0x95, 0x95, 0xA3, 0xA3, 0xAC, 0xAC, 0xB2, 0xB2, 0xB5,
+0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6, 0xB6, 0xB3, 0xB3, 0xAE, 0xAE, 0xA6, 0xA6, 0x9A, 0x9A, 0x71,
+0x71, 0x5F, 0x5F, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4C,
+0x4C, 0x50, 0x50, 0x57, 0x57, 0x61, 0x61, 0x76, 0x76, 0x9C, 0x9C, 0xA7, 0xA7, 0xAE, 0xAE, 0xB2,
+0xB2, 0xB5, 0xB5, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xAF, 0xAF, 0xA9, 0xA9, 0xA1, 0xA1, 0x92,
+0x92, 0x68, 0x68, 0x5B, 0x5B, 0x54, 0x54, 0x4E, 0x4E, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B,
+0x4B, 0x4F, 0x4F, 0x54, 0x54, 0x5C, 0x5C, 0x68, 0x68, 0x91, 0x91, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE,
+0xAE, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB1, 0xB1, 0xAC, 0xAC, 0xA5, 0xA5, 0x9C,
+0x9C, 0x7C, 0x7C, 0x63, 0x63, 0x59, 0x59, 0x53, 0x53, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4C,
+0x4C, 0x4E, 0x4E, 0x52, 0x52, 0x58, 0x58, 0x60, 0x60, 0x6F, 0x6F, 0x97, 0x97, 0xA2, 0xA2, 0xA9,
+0xA9, 0xAE, 0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9, 0xA9, 0xA2,
+0xA2, 0x96, 0x96, 0x6F, 0x6F, 0x61, 0x61, 0x58, 0x58, 0x53, 0x53, 0x4F, 0x4F, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x55, 0x55, 0x5B, 0x5B, 0x64, 0x64, 0x79, 0x79, 0x9A, 0x9A, 0xA3,
+0xA3, 0xA9, 0xA9, 0xAE, 0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAC, 0xAC, 0xA6,
+0xA6, 0x9E, 0x9E, 0x91, 0x91, 0x6B, 0x6B, 0x5F, 0x5F, 0x58, 0x58, 0x54, 0x54, 0x50, 0x50, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5E, 0x5E, 0x68, 0x68, 0x8B, 0x8B, 0x9B,
+0x9B, 0xA3, 0xA3, 0xA9, 0xA9, 0xAD, 0xAD, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xA9,
+0xA9, 0xA3, 0xA3, 0x9B, 0x9B, 0x8D, 0x8D, 0x69, 0x69, 0x5F, 0x5F, 0x59, 0x59, 0x55, 0x55, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x55, 0x55, 0x5A, 0x5A, 0x61, 0x61, 0x6B, 0x6B, 0x8E,
+0x8E, 0x9B, 0x9B, 0xA3, 0xA3, 0xA8, 0xA8, 0xAB, 0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB,
+0xAB, 0xA7, 0xA7, 0xA1, 0xA1, 0x99, 0x99, 0x89, 0x89, 0x69, 0x69, 0x60, 0x60, 0x5A, 0x5A, 0x56,
+0x56, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x57, 0x57, 0x5C, 0x5C, 0x63, 0x63, 0x6D,
+0x6D, 0x90, 0x90, 0x9B, 0x9B, 0xA2, 0xA2, 0xA6, 0xA6, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xA8, 0xA8, 0xA5, 0xA5, 0x9F, 0x9F, 0x97, 0x97, 0x86, 0x86, 0x69, 0x69, 0x61, 0x61, 0x5B,
+0x5B, 0x58, 0x58, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5E, 0x5E, 0x64,
+0x64, 0x6E, 0x6E, 0x8F, 0x8F, 0x9A, 0x9A, 0xA0, 0xA0, 0xA5, 0xA5, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA6, 0xA6, 0xA3, 0xA3, 0x9E, 0x9E, 0x96, 0x96, 0x86, 0x86, 0x6A, 0x6A, 0x62,
+0x62, 0x5D, 0x5D, 0x5A, 0x5A, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5F,
+0x5F, 0x65, 0x65, 0x6F, 0x6F, 0x8E, 0x8E, 0x98, 0x98, 0x9F, 0x9F, 0xA3, 0xA3, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA4, 0xA4, 0xA1, 0xA1, 0x9C, 0x9C, 0x95, 0x95, 0x87, 0x87, 0x6C,
+0x6C, 0x64, 0x64, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x5B, 0x5B, 0x5D,
+0x5D, 0x61, 0x61, 0x66, 0x66, 0x6F, 0x6F, 0x8C, 0x8C, 0x96, 0x96, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0x9F, 0x9F, 0x9B, 0x9B, 0x95, 0x95, 0x8A,
+0x8A, 0x6F, 0x6F, 0x68, 0x68, 0x63, 0x63, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x60, 0x60, 0x63, 0x63, 0x68, 0x68, 0x6F, 0x6F, 0x87, 0x87, 0x93, 0x93, 0x99, 0x99, 0x9C,
+0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9E, 0x9E, 0x9C, 0x9C, 0x99, 0x99, 0x94,
+0x94, 0x8C, 0x8C, 0x73, 0x73, 0x6C, 0x6C, 0x67, 0x67, 0x64, 0x64, 0x62, 0x62, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x63, 0x63, 0x66, 0x66, 0x69, 0x69, 0x6F, 0x6F, 0x7A, 0x7A, 0x8E, 0x8E, 0x94,
+0x94, 0x97, 0x97, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x96,
+0x96, 0x92, 0x92, 0x8C, 0x8C, 0x78, 0x78, 0x70, 0x70, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x6A, 0x6A, 0x6F, 0x6F, 0x76, 0x76, 0x8A,
+0x8A, 0x90, 0x90, 0x93, 0x93, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x94, 0x94, 0x91, 0x91, 0x8D, 0x8D, 0x85, 0x85, 0x74, 0x74, 0x70, 0x70, 0x6D, 0x6D, 0x6A,
+0x6A, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x75,
+0x75, 0x84, 0x84, 0x8B, 0x8B, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x93,
+0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x87, 0x87, 0x79, 0x79, 0x73, 0x73, 0x70,
+0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x71, 0x71, 0x73,
+0x73, 0x76, 0x76, 0x7A, 0x7A, 0x86, 0x86, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E,
+0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8A, 0x8A, 0x88, 0x88, 0x87, 0x87, 0x82, 0x82, 0x79,
+0x79, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78,
+0x78, 0x79, 0x79, 0x7B, 0x7B, 0x7C, 0x7C, 0x81, 0x81, 0x82, 0x82, 0x80, 0x80, 0x7C, 0x7C, 0x7B,
+0x7B, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x77, 0x77, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C,
+0x7C, 0x82, 0x82, 0x85, 0x85, 0x87, 0x87, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x88, 0x88, 0x85, 0x85, 0x7A, 0x7A, 0x76, 0x76, 0x73,
+0x73, 0x72, 0x72, 0x70, 0x70, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73,
+0x73, 0x76, 0x76, 0x7A, 0x7A, 0x87, 0x87, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x92,
+0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8B, 0x8B, 0x84, 0x84, 0x75,
+0x75, 0x71, 0x71, 0x6E, 0x6E, 0x6D, 0x6D, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6D, 0x6D, 0x70, 0x70, 0x74, 0x74, 0x81, 0x81, 0x8B, 0x8B, 0x90, 0x90, 0x93, 0x93, 0x95,
+0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8B,
+0x8B, 0x7A, 0x7A, 0x72, 0x72, 0x6E, 0x6E, 0x6B, 0x6B, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65,
+0x65, 0x66, 0x66, 0x67, 0x67, 0x6A, 0x6A, 0x6D, 0x6D, 0x73, 0x73, 0x87, 0x87, 0x8F, 0x8F, 0x94,
+0x94, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x97,
+0x97, 0x93, 0x93, 0x8C, 0x8C, 0x76, 0x76, 0x6E, 0x6E, 0x69, 0x69, 0x65, 0x65, 0x63, 0x63, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x67, 0x67, 0x6B, 0x6B, 0x72, 0x72, 0x8A,
+0x8A, 0x93, 0x93, 0x98, 0x98, 0x9C, 0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9D, 0x9D, 0x9A, 0x9A, 0x95, 0x95, 0x8D, 0x8D, 0x73, 0x73, 0x6B, 0x6B, 0x65, 0x65, 0x61,
+0x61, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x61, 0x61, 0x64, 0x64, 0x69,
+0x69, 0x72, 0x72, 0x8D, 0x8D, 0x96, 0x96, 0x9B, 0x9B, 0x9E, 0x9E, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0x9F, 0x9F, 0x9C, 0x9C, 0x96, 0x96, 0x8E, 0x8E, 0x72, 0x72, 0x69,
+0x69, 0x63, 0x63, 0x5F, 0x5F, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E,
+0x5E, 0x62, 0x62, 0x68, 0x68, 0x71, 0x71, 0x8D, 0x8D, 0x96, 0x96, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3,
+0xA3, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA1, 0xA1, 0x9E, 0x9E, 0x98, 0x98, 0x8F,
+0x8F, 0x72, 0x72, 0x68, 0x68, 0x62, 0x62, 0x5D, 0x5D, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x5A, 0x5A, 0x5D, 0x5D, 0x61, 0x61, 0x66, 0x66, 0x6F, 0x6F, 0x8D, 0x8D, 0x97, 0x97, 0x9E,
+0x9E, 0xA2, 0xA2, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA4, 0xA4, 0xA0,
+0xA0, 0x9A, 0x9A, 0x91, 0x91, 0x72, 0x72, 0x67, 0x67, 0x61, 0x61, 0x5C, 0x5C, 0x59, 0x59, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5B, 0x5B, 0x5E, 0x5E, 0x64, 0x64, 0x6D, 0x6D, 0x8B,
+0x8B, 0x98, 0x98, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xA9, 0xA9, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA2, 0xA2, 0x9C, 0x9C, 0x94, 0x94, 0x75, 0x75, 0x68, 0x68, 0x60, 0x60, 0x5B,
+0x5B, 0x58, 0x58, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x5B, 0x5B, 0x61,
+0x61, 0x69, 0x69, 0x85, 0x85, 0x97, 0x97, 0x9F, 0x9F, 0xA5, 0xA5, 0xA8, 0xA8, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xA9, 0xA9, 0xA5, 0xA5, 0xA0, 0xA0, 0x98, 0x98, 0x87, 0x87, 0x69,
+0x69, 0x60, 0x60, 0x5A, 0x5A, 0x56, 0x56, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x52, 0x52, 0x54,
+0x54, 0x58, 0x58, 0x5D, 0x5D, 0x65, 0x65, 0x73, 0x73, 0x95, 0x95, 0x9F, 0x9F, 0xA5, 0xA5, 0xAA,
+0xAA, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xAE, 0xAE, 0xAC, 0xAC, 0xA9, 0xA9, 0xA4, 0xA4, 0x9C,
+0x9C, 0x90, 0x90, 0x6C, 0x6C, 0x61, 0x61, 0x5A, 0x5A, 0x55, 0x55, 0x52, 0x52, 0x50, 0x50, 0x4F,
+0x4F, 0x50, 0x50, 0x51, 0x51, 0x55, 0x55, 0x5A, 0x5A, 0x61, 0x61, 0x6C, 0x6C, 0x91, 0x91, 0x9D,
+0x9D, 0xA5, 0xA5, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAC,
+0xAC, 0xA7, 0xA7, 0xA1, 0xA1, 0x97, 0x97, 0x74, 0x74, 0x64, 0x64, 0x5B, 0x5B, 0x56, 0x56, 0x51,
+0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5C, 0x5C, 0x65,
+0x65, 0x79, 0x79, 0x99, 0x99, 0xA2, 0xA2, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAB, 0xAB, 0xA5, 0xA5, 0x9D, 0x9D, 0x8E, 0x8E, 0x69, 0x69, 0x5E,
+0x5E, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4D, 0x4D, 0x4F, 0x4F, 0x53,
+0x53, 0x58, 0x58, 0x5F, 0x5F, 0x6B, 0x6B, 0x92, 0x92, 0x9F, 0x9F, 0xA7, 0xA7, 0xAC, 0xAC, 0xB0,
+0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA3, 0xA3, 0x98,
+0x98, 0x73, 0x73, 0x62, 0x62, 0x59, 0x59, 0x53, 0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x59, 0x59, 0x62, 0x62, 0x74, 0x74, 0x99, 0x99, 0xA4,
+0xA4, 0xAB, 0xAB, 0xB0, 0xB0, 0xB3, 0xB3, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB2, 0xB2, 0xAE,
+0xAE, 0xA9, 0xA9, 0xA0, 0xA0, 0x93, 0x93, 0x6A, 0x6A, 0x5E, 0x5E, 0x55, 0x55, 0x50, 0x50, 0x4C,
+0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x53, 0x53, 0x5B, 0x5B, 0x66,
+0x66, 0x8D, 0x8D, 0x9E, 0x9E, 0xA8, 0xA8, 0xAE, 0xAE, 0xB3, 0xB3, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF, 0xAF, 0xA8, 0xA8, 0x9E, 0x9E, 0x8C, 0x8C, 0x65, 0x65, 0x5A,
+0x5A, 0x52, 0x52, 0x4D, 0x4D, 0x49, 0x49, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4E,
+0x4E, 0x54, 0x54, 0x5C, 0x5C, 0x6A, 0x6A, 0x95, 0x95, 0xA2, 0xA2, 0xAB, 0xAB, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA7, 0xA7, 0x9C,
+0x9C, 0x77, 0x77, 0x61, 0x61, 0x57, 0x57, 0x50, 0x50, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x46,
+0x46, 0x47, 0x47, 0x4A, 0x4A, 0x4E, 0x4E, 0x54, 0x54, 0x5D, 0x5D, 0x6D, 0x6D, 0x98, 0x98, 0xA5,
+0xA5, 0xAD, 0xAD, 0xB3, 0xB3, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4,
+0xB4, 0xAE, 0xAE, 0xA6, 0xA6, 0x9B, 0x9B, 0x70, 0x70, 0x5F, 0x5F, 0x55, 0x55, 0x4E, 0x4E, 0x49,
+0x49, 0x46, 0x46, 0x45, 0x45, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x54, 0x54, 0x5E,
+0x5E, 0x6F, 0x6F, 0x9A, 0x9A, 0xA7, 0xA7, 0xAF, 0xAF, 0xB5, 0xB5, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xB9, 0xB9, 0xB5, 0xB5, 0xAF, 0xAF, 0xA7, 0xA7, 0x9A, 0x9A, 0x6E, 0x6E, 0x5D,
+0x5D, 0x53, 0x53, 0x4C, 0x4C, 0x48, 0x48, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x47,
+0x47, 0x4C, 0x4C, 0x53, 0x53, 0x5D, 0x5D, 0x6F, 0x6F, 0x9B, 0x9B, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6,
+0xB6, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB6, 0xB6, 0xB0, 0xB0, 0xA8,
+0xA8, 0x9B, 0x9B, 0x6F, 0x6F, 0x5C, 0x5C, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x43, 0x43, 0x41,
+0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4B, 0x4B, 0x52, 0x52, 0x5C, 0x5C, 0x6E, 0x6E, 0x9B,
+0x9B, 0xA8, 0xA8, 0xB0, 0xB0, 0xB7, 0xB7, 0xBB, 0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBB,
+0xBB, 0xB8, 0xB8, 0xB2, 0xB2, 0xAA, 0xAA, 0x9D, 0x9D, 0x72, 0x72, 0x5D, 0x5D, 0x52, 0x52, 0x4B,
+0x4B, 0x46, 0x46, 0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x50,
+0x50, 0x5A, 0x5A, 0x6A, 0x6A, 0x99, 0x99, 0xA7, 0xA7, 0xB0, 0xB0, 0xB7, 0xB7, 0xBB, 0xBB, 0xBE,
+0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAC, 0xAC, 0xA0, 0xA0, 0x81,
+0x81, 0x5F, 0x5F, 0x53, 0x53, 0x4B, 0x4B, 0x46, 0x46, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x40,
+0x40, 0x43, 0x43, 0x47, 0x47, 0x4D, 0x4D, 0x56, 0x56, 0x64, 0x64, 0x94, 0x94, 0xA5, 0xA5, 0xB0,
+0xB0, 0xB7, 0xB7, 0xBC, 0xBC, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBB, 0xBB, 0xB6,
+0xB6, 0xAF, 0xAF, 0xA4, 0xA4, 0x92, 0x92, 0x63, 0x63, 0x55, 0x55, 0x4C, 0x4C, 0x46, 0x46, 0x41,
+0x41, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x41, 0x41, 0x44, 0x44, 0x4A, 0x4A, 0x53, 0x53, 0x5F,
+0x5F, 0x8A, 0x8A, 0xA2, 0xA2, 0xAE, 0xAE, 0xB6, 0xB6, 0xBC, 0xBC, 0xBF, 0xBF, 0xC1, 0xC1, 0xC2,
+0xC2, 0xC1, 0xC1, 0xBE, 0xBE, 0xB9, 0xB9, 0xB3, 0xB3, 0xA9, 0xA9, 0x9A, 0x9A, 0x69, 0x69, 0x58,
+0x58, 0x4E, 0x4E, 0x46, 0x46, 0x41, 0x41, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x42,
+0x42, 0x47, 0x47, 0x4F, 0x4F, 0x59, 0x59, 0x6D, 0x6D, 0x9D, 0x9D, 0xAB, 0xAB, 0xB4, 0xB4, 0xBB,
+0xBB, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xBC, 0xBC, 0xB6, 0xB6, 0xAE,
+0xAE, 0xA2, 0xA2, 0x7F, 0x7F, 0x5D, 0x5D, 0x51, 0x51, 0x48, 0x48, 0x42, 0x42, 0x3F, 0x3F, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x4A, 0x4A, 0x53, 0x53, 0x61, 0x61, 0x92,
+0x92, 0xA6, 0xA6, 0xB1, 0xB1, 0xB9, 0xB9, 0xBE, 0xBE, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBF, 0xBF, 0xBB, 0xBB, 0xB3, 0xB3, 0xA9, 0xA9, 0x99, 0x99, 0x66, 0x66, 0x56, 0x56, 0x4C,
+0x4C, 0x44, 0x44, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40, 0x40, 0x45,
+0x45, 0x4D, 0x4D, 0x58, 0x58, 0x6B, 0x6B, 0x9E, 0x9E, 0xAC, 0xAC, 0xB6, 0xB6, 0xBC, 0xBC, 0xC1,
+0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xB9, 0xB9, 0xB1, 0xB1, 0xA4,
+0xA4, 0x8C, 0x8C, 0x5D, 0x5D, 0x50, 0x50, 0x47, 0x47, 0x41, 0x41, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x41, 0x41, 0x47, 0x47, 0x50, 0x50, 0x5E, 0x5E, 0x8D, 0x8D, 0xA5,
+0xA5, 0xB1, 0xB1, 0xBA, 0xBA, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBE, 0xBE, 0xB7, 0xB7, 0xAD, 0xAD, 0x9F, 0x9F, 0x6C, 0x6C, 0x58, 0x58, 0x4C, 0x4C, 0x44,
+0x44, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42, 0x42, 0x49,
+0x49, 0x53, 0x53, 0x63, 0x63, 0x97, 0x97, 0xA9, 0xA9, 0xB4, 0xB4, 0xBC, 0xBC, 0xC1, 0xC1, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBD, 0xBD, 0xB5, 0xB5, 0xAA, 0xAA, 0x99,
+0x99, 0x64, 0x64, 0x54, 0x54, 0x49, 0x49, 0x42, 0x42, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x4A, 0x4A, 0x55, 0x55, 0x68, 0x68, 0x9D, 0x9D, 0xAD,
+0xAD, 0xB7, 0xB7, 0xBE, 0xBE, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBC, 0xBC, 0xB4, 0xB4, 0xA9, 0xA9, 0x95, 0x95, 0x60, 0x60, 0x51, 0x51, 0x47, 0x47, 0x40,
+0x40, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x4B,
+0x4B, 0x57, 0x57, 0x6C, 0x6C, 0xA0, 0xA0, 0xAF, 0xAF, 0xB9, 0xB9, 0xC0, 0xC0, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBC, 0xBC, 0xB4, 0xB4, 0xA8, 0xA8, 0x91,
+0x91, 0x5E, 0x5E, 0x4F, 0x4F, 0x45, 0x45, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x4B, 0x4B, 0x58, 0x58, 0x6F, 0x6F, 0xA2, 0xA2, 0xB0,
+0xB0, 0xBA, 0xBA, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBD, 0xBD, 0xB4, 0xB4, 0xA7, 0xA7, 0x90, 0x90, 0x5D, 0x5D, 0x4E, 0x4E, 0x45, 0x45, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42, 0x42, 0x4A,
+0x4A, 0x57, 0x57, 0x6D, 0x6D, 0xA2, 0xA2, 0xB0, 0xB0, 0xBA, 0xBA, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBE, 0xBE, 0xB5, 0xB5, 0xA9, 0xA9, 0x94,
+0x94, 0x5E, 0x5E, 0x4F, 0x4F, 0x45, 0x45, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40, 0x40, 0x49, 0x49, 0x55, 0x55, 0x6A, 0x6A, 0xA0, 0xA0, 0xB0,
+0xB0, 0xBA, 0xBA, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBF, 0xBF, 0xB7, 0xB7, 0xAC, 0xAC, 0x98, 0x98, 0x60, 0x60, 0x50, 0x50, 0x45, 0x45, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x46,
+0x46, 0x51, 0x51, 0x63, 0x63, 0x9B, 0x9B, 0xAD, 0xAD, 0xB9, 0xB9, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBA, 0xBA, 0xAF, 0xAF, 0x9F,
+0x9F, 0x67, 0x67, 0x53, 0x53, 0x47, 0x47, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x4D, 0x4D, 0x5C, 0x5C, 0x93, 0x93, 0xAA,
+0xAA, 0xB7, 0xB7, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xBE, 0xBE, 0xB4, 0xB4, 0xA6, 0xA6, 0x77, 0x77, 0x58, 0x58, 0x4A, 0x4A, 0x41,
+0x41, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40,
+0x40, 0x49, 0x49, 0x56, 0x56, 0x6F, 0x6F, 0xA4, 0xA4, 0xB3, 0xB3, 0xBD, 0xBD, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xB9, 0xB9, 0xAD,
+0xAD, 0x99, 0x99, 0x60, 0x60, 0x4F, 0x4F, 0x44, 0x44, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x44, 0x44, 0x4E, 0x4E, 0x5F, 0x5F, 0x99,
+0x99, 0xAD, 0xAD, 0xB9, 0xB9, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBE, 0xBE, 0xB4, 0xB4, 0xA5, 0xA5, 0x72, 0x72, 0x56, 0x56, 0x49,
+0x49, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3F, 0x3F, 0x48, 0x48, 0x55, 0x55, 0x6E, 0x6E, 0xA4, 0xA4, 0xB4, 0xB4, 0xBE, 0xBE, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBB,
+0xBB, 0xAF, 0xAF, 0x9C, 0x9C, 0x61, 0x61, 0x4F, 0x4F, 0x44, 0x44, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x41, 0x41, 0x4B, 0x4B, 0x5B,
+0x5B, 0x92, 0x92, 0xAB, 0xAB, 0xB8, 0xB8, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xB8, 0xB8, 0xAA, 0xAA, 0x91, 0x91, 0x5A,
+0x5A, 0x4B, 0x4B, 0x40, 0x40, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x4F, 0x4F, 0x61, 0x61, 0x9C, 0x9C, 0xAF, 0xAF, 0xBB,
+0xBB, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC0, 0xC0, 0xB6, 0xB6, 0xA7, 0xA7, 0x74, 0x74, 0x56, 0x56, 0x48, 0x48, 0x3E, 0x3E, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x45,
+0x45, 0x51, 0x51, 0x67, 0x67, 0xA2, 0xA2, 0xB2, 0xB2, 0xBD, 0xBD, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xB4, 0xB4, 0xA4,
+0xA4, 0x6B, 0x6B, 0x53, 0x53, 0x46, 0x46, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x45, 0x45, 0x52, 0x52, 0x69, 0x69, 0xA3,
+0xA3, 0xB4, 0xB4, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xB4, 0xB4, 0xA3, 0xA3, 0x69, 0x69, 0x52, 0x52, 0x45,
+0x45, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x45, 0x45, 0x52, 0x52, 0x6A, 0x6A, 0xA4, 0xA4, 0xB4, 0xB4, 0xBF, 0xBF, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF,
+0xBF, 0xB4, 0xB4, 0xA4, 0xA4, 0x69, 0x69, 0x52, 0x52, 0x45, 0x45, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x44, 0x44, 0x51,
+0x51, 0x67, 0x67, 0xA2, 0xA2, 0xB3, 0xB3, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xB6, 0xB6, 0xA7, 0xA7, 0x70,
+0x70, 0x54, 0x54, 0x46, 0x46, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42, 0x42, 0x4E, 0x4E, 0x62, 0x62, 0x9F, 0x9F, 0xB2,
+0xB2, 0xBE, 0xBE, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xB9, 0xB9, 0xAB, 0xAB, 0x8D, 0x8D, 0x57, 0x57, 0x48, 0x48, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3F, 0x3F, 0x4A, 0x4A, 0x5B, 0x5B, 0x95, 0x95, 0xAE, 0xAE, 0xBB, 0xBB, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBD,
+0xBD, 0xB0, 0xB0, 0x9C, 0x9C, 0x5F, 0x5F, 0x4C, 0x4C, 0x41, 0x41, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x45, 0x45, 0x54,
+0x54, 0x71, 0x71, 0xA8, 0xA8, 0xB7, 0xB7, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xB6, 0xB6, 0xA6, 0xA6, 0x6B,
+0x6B, 0x52, 0x52, 0x44, 0x44, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40, 0x40, 0x4C, 0x4C, 0x5F, 0x5F, 0x9C, 0x9C, 0xB1,
+0xB1, 0xBD, 0xBD, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBC, 0xBC, 0xAF, 0xAF, 0x99, 0x99, 0x5C, 0x5C, 0x4A, 0x4A, 0x3F,
+0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x45, 0x45, 0x53, 0x53, 0x71, 0x71, 0xA8, 0xA8, 0xB8, 0xB8, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xB8, 0xB8, 0xA8, 0xA8, 0x70, 0x70, 0x53, 0x53, 0x45, 0x45, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x49,
+0x49, 0x5A, 0x5A, 0x96, 0x96, 0xAE, 0xAE, 0xBC, 0xBC, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xB4, 0xB4, 0xA1,
+0xA1, 0x63, 0x63, 0x4E, 0x4E, 0x41, 0x41, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40, 0x40, 0x4D, 0x4D, 0x61, 0x61, 0x9F,
+0x9F, 0xB3, 0xB3, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBD, 0xBD, 0xB0, 0xB0, 0x9B, 0x9B, 0x5D, 0x5D, 0x4B,
+0x4B, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42, 0x42, 0x4F, 0x4F, 0x66, 0x66, 0xA3, 0xA3, 0xB5, 0xB5, 0xC1,
+0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xBC, 0xBC, 0xAF, 0xAF, 0x97, 0x97, 0x5A, 0x5A, 0x49, 0x49, 0x3E, 0x3E, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x43, 0x43, 0x51, 0x51, 0x6A, 0x6A, 0xA6, 0xA6, 0xB7, 0xB7, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBC,
+0xBC, 0xAE, 0xAE, 0x95, 0x95, 0x59, 0x59, 0x48, 0x48, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42, 0x42, 0x50,
+0x50, 0x68, 0x68, 0xA5, 0xA5, 0xB6, 0xB6, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBD, 0xBD, 0xB0, 0xB0, 0x98,
+0x98, 0x5B, 0x5B, 0x49, 0x49, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x41, 0x41, 0x4E, 0x4E, 0x65, 0x65, 0xA3,
+0xA3, 0xB5, 0xB5, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xB2, 0xB2, 0x9D, 0x9D, 0x5E, 0x5E, 0x4B,
+0x4B, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x4B, 0x4B, 0x5E, 0x5E, 0x9D, 0x9D, 0xB2, 0xB2, 0xBF,
+0xBF, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xB6, 0xB6, 0xA4, 0xA4, 0x67, 0x67, 0x4F, 0x4F, 0x42, 0x42, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x47, 0x47, 0x57, 0x57, 0x90, 0x90, 0xAD, 0xAD, 0xBB, 0xBB, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBB, 0xBB, 0xAC, 0xAC, 0x8B, 0x8B, 0x56, 0x56, 0x46, 0x46, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x42,
+0x42, 0x4F, 0x4F, 0x67, 0x67, 0xA5, 0xA5, 0xB6, 0xB6, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xB4,
+0xB4, 0xA0, 0xA0, 0x60, 0x60, 0x4C, 0x4C, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x48, 0x48, 0x59,
+0x59, 0x94, 0x94, 0xAE, 0xAE, 0xBC, 0xBC, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBB, 0xBB, 0xAD, 0xAD, 0x8F,
+0x8F, 0x56, 0x56, 0x46, 0x46, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x40, 0x40, 0x4D, 0x4D, 0x63, 0x63, 0xA2,
+0xA2, 0xB5, 0xB5, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xB7, 0xB7, 0xA5, 0xA5, 0x68, 0x68, 0x50,
+0x50, 0x42, 0x42, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x43, 0x43, 0x52, 0x52, 0x6E, 0x6E, 0xA8, 0xA8, 0xB9,
+0xB9, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xB3, 0xB3, 0xA0, 0xA0, 0x60, 0x60, 0x4C, 0x4C, 0x3F,
+0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x45, 0x45, 0x55, 0x55, 0x8B, 0x8B, 0xAC, 0xAC, 0xBB, 0xBB, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xB1, 0xB1, 0x9B, 0x9B, 0x5D, 0x5D, 0x4A, 0x4A, 0x3E, 0x3E, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x47, 0x47, 0x57, 0x57, 0x92, 0x92, 0xAE, 0xAE, 0xBC, 0xBC, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xBE, 0xBE, 0xB1, 0xB1, 0x9A, 0x9A, 0x5B, 0x5B, 0x49, 0x49, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x46, 0x46, 0x57, 0x57, 0x90, 0x90, 0xAD, 0xAD, 0xBC, 0xBC, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF,
+0xBF, 0xB2, 0xB2, 0x9C, 0x9C, 0x5E, 0x5E, 0x4B, 0x4B, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x45,
+0x45, 0x54, 0x54, 0x7C, 0x7C, 0xAB, 0xAB, 0xBA, 0xBA, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xB5,
+0xB5, 0xA2, 0xA2, 0x63, 0x63, 0x4D, 0x4D, 0x40, 0x40, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x42, 0x42, 0x50,
+0x50, 0x6A, 0x6A, 0xA6, 0xA6, 0xB7, 0xB7, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB8, 0xB8, 0xA8,
+0xA8, 0x6E, 0x6E, 0x52, 0x52, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x4B, 0x4B, 0x5E,
+0x5E, 0x9D, 0x9D, 0xB2, 0xB2, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBD, 0xBD, 0xAF, 0xAF, 0x97,
+0x97, 0x5A, 0x5A, 0x48, 0x48, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x45, 0x45, 0x54, 0x54, 0x7D,
+0x7D, 0xAB, 0xAB, 0xBA, 0xBA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB7, 0xB7, 0xA5, 0xA5, 0x69,
+0x69, 0x50, 0x50, 0x42, 0x42, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x4B, 0x4B, 0x5F, 0x5F, 0x9E,
+0x9E, 0xB3, 0xB3, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBE, 0xBE, 0xB0, 0xB0, 0x9A, 0x9A, 0x5C,
+0x5C, 0x49, 0x49, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x43, 0x43, 0x51, 0x51, 0x6B, 0x6B, 0xA7,
+0xA7, 0xB8, 0xB8, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBA, 0xBA, 0xAB, 0xAB, 0x8A, 0x8A, 0x55,
+0x55, 0x46, 0x46, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x46, 0x46, 0x56, 0x56, 0x8C, 0x8C, 0xAC,
+0xAC, 0xBB, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB8, 0xB8, 0xA7, 0xA7, 0x6D, 0x6D, 0x52,
+0x52, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x48, 0x48, 0x58, 0x58, 0x94, 0x94, 0xAE,
+0xAE, 0xBC, 0xBC, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB7, 0xB7, 0xA6, 0xA6, 0x6A, 0x6A, 0x51,
+0x51, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x48, 0x48, 0x59, 0x59, 0x95, 0x95, 0xAE,
+0xAE, 0xBC, 0xBC, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB7, 0xB7, 0xA6, 0xA6, 0x6B, 0x6B, 0x51,
+0x51, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x47, 0x47, 0x57, 0x57, 0x90, 0x90, 0xAD,
+0xAD, 0xBB, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB9, 0xB9, 0xA9, 0xA9, 0x75, 0x75, 0x54,
+0x54, 0x45, 0x45, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x45, 0x45, 0x54, 0x54, 0x73, 0x73, 0xA9,
+0xA9, 0xB9, 0xB9, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBC, 0xBC, 0xAD, 0xAD, 0x93, 0x93, 0x59,
+0x59, 0x48, 0x48, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x41, 0x41, 0x4E, 0x4E, 0x64, 0x64, 0xA2,
+0xA2, 0xB4, 0xB4, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xB3, 0xB3, 0xA0, 0xA0, 0x62,
+0x62, 0x4E, 0x4E, 0x41, 0x41, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x48, 0x48, 0x59, 0x59, 0x93,
+0x93, 0xAD, 0xAD, 0xBB, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBA, 0xBA, 0xAB, 0xAB, 0x8B,
+0x8B, 0x56, 0x56, 0x47, 0x47, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x42, 0x42, 0x4F, 0x4F, 0x65,
+0x65, 0xA3, 0xA3, 0xB4, 0xB4, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xB4, 0xB4, 0xA2,
+0xA2, 0x65, 0x65, 0x4F, 0x4F, 0x42, 0x42, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x46, 0x46, 0x55,
+0x55, 0x82, 0x82, 0xAA, 0xAA, 0xB9, 0xB9, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBD, 0xBD, 0xB0,
+0xB0, 0x9A, 0x9A, 0x5D, 0x5D, 0x4B, 0x4B, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x4A,
+0x4A, 0x5B, 0x5B, 0x96, 0x96, 0xAE, 0xAE, 0xBC, 0xBC, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBA,
+0xBA, 0xAC, 0xAC, 0x91, 0x91, 0x59, 0x59, 0x49, 0x49, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x40,
+0x40, 0x4C, 0x4C, 0x5E, 0x5E, 0x9B, 0x9B, 0xB0, 0xB0, 0xBD, 0xBD, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xB9, 0xB9, 0xAB, 0xAB, 0x8E, 0x8E, 0x57, 0x57, 0x48, 0x48, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x40, 0x40, 0x4C, 0x4C, 0x5E, 0x5E, 0x9A, 0x9A, 0xB0, 0xB0, 0xBD, 0xBD, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xBA, 0xBA, 0xAC, 0xAC, 0x91, 0x91, 0x59, 0x59, 0x49, 0x49, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x4A, 0x4A, 0x5B, 0x5B, 0x96, 0x96, 0xAD, 0xAD, 0xBB, 0xBB, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBC, 0xBC, 0xAF, 0xAF, 0x99, 0x99, 0x5D, 0x5D, 0x4C, 0x4C, 0x40,
+0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x47, 0x47, 0x56, 0x56, 0x83, 0x83, 0xA9, 0xA9, 0xB8,
+0xB8, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBF, 0xBF, 0xB3, 0xB3, 0xA2, 0xA2, 0x66, 0x66, 0x50,
+0x50, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x44, 0x44, 0x51, 0x51, 0x65, 0x65, 0xA1,
+0xA1, 0xB3, 0xB3, 0xBE, 0xBE, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB8, 0xB8, 0xAA, 0xAA, 0x8D,
+0x8D, 0x58, 0x58, 0x49, 0x49, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x4A, 0x4A, 0x5A,
+0x5A, 0x91, 0x91, 0xAB, 0xAB, 0xB9, 0xB9, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBE, 0xBE, 0xB2,
+0xB2, 0xA1, 0xA1, 0x66, 0x66, 0x51, 0x51, 0x44, 0x44, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x43,
+0x43, 0x4F, 0x4F, 0x63, 0x63, 0x9E, 0x9E, 0xB0, 0xB0, 0xBC, 0xBC, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xBA, 0xBA, 0xAE, 0xAE, 0x98, 0x98, 0x5D, 0x5D, 0x4C, 0x4C, 0x41, 0x41, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x46, 0x46, 0x53, 0x53, 0x6B, 0x6B, 0xA4, 0xA4, 0xB4, 0xB4, 0xBF, 0xBF, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB8, 0xB8, 0xAA, 0xAA, 0x8E, 0x8E, 0x59, 0x59, 0x4A, 0x4A, 0x3F,
+0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x48, 0x48, 0x56, 0x56, 0x74, 0x74, 0xA7, 0xA7, 0xB6,
+0xB6, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xB6, 0xB6, 0xA8, 0xA8, 0x85, 0x85, 0x57,
+0x57, 0x49, 0x49, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x49, 0x49, 0x57, 0x57, 0x83,
+0x83, 0xA8, 0xA8, 0xB6, 0xB6, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xB6, 0xB6, 0xA8,
+0xA8, 0x84, 0x84, 0x58, 0x58, 0x49, 0x49, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x49,
+0x49, 0x57, 0x57, 0x75, 0x75, 0xA6, 0xA6, 0xB5, 0xB5, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xB7, 0xB7, 0xAA, 0xAA, 0x90, 0x90, 0x5A, 0x5A, 0x4B, 0x4B, 0x41, 0x41, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x47, 0x47, 0x54, 0x54, 0x6B, 0x6B, 0xA3, 0xA3, 0xB2, 0xB2, 0xBD, 0xBD, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB9, 0xB9, 0xAD, 0xAD, 0x99, 0x99, 0x60, 0x60, 0x4E, 0x4E, 0x43,
+0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x44, 0x44, 0x4F, 0x4F, 0x61, 0x61, 0x9B, 0x9B, 0xAE,
+0xAE, 0xBA, 0xBA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBD, 0xBD, 0xB2, 0xB2, 0xA3, 0xA3, 0x6C,
+0x6C, 0x55, 0x55, 0x48, 0x48, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x40, 0x40, 0x4A, 0x4A, 0x58,
+0x58, 0x78, 0x78, 0xA6, 0xA6, 0xB4, 0xB4, 0xBE, 0xBE, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB8,
+0xB8, 0xAC, 0xAC, 0x97, 0x97, 0x5F, 0x5F, 0x4F, 0x4F, 0x44, 0x44, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x44, 0x44, 0x4F, 0x4F, 0x60, 0x60, 0x98, 0x98, 0xAB, 0xAB, 0xB8, 0xB8, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xBE, 0xBE, 0xB4, 0xB4, 0xA6, 0xA6, 0x86, 0x86, 0x59, 0x59, 0x4B, 0x4B, 0x41,
+0x41, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x47, 0x47, 0x53, 0x53, 0x65, 0x65, 0x9D, 0x9D, 0xAF,
+0xAF, 0xBA, 0xBA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBC, 0xBC, 0xB2, 0xB2, 0xA3, 0xA3, 0x6E,
+0x6E, 0x56, 0x56, 0x4A, 0x4A, 0x40, 0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x48, 0x48, 0x54,
+0x54, 0x69, 0x69, 0xA0, 0xA0, 0xB0, 0xB0, 0xBB, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBB,
+0xBB, 0xB1, 0xB1, 0xA1, 0xA1, 0x6C, 0x6C, 0x56, 0x56, 0x49, 0x49, 0x40, 0x40, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x40, 0x40, 0x49, 0x49, 0x55, 0x55, 0x69, 0x69, 0xA0, 0xA0, 0xB0, 0xB0, 0xBA, 0xBA, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBB, 0xBB, 0xB1, 0xB1, 0xA2, 0xA2, 0x6F, 0x6F, 0x57, 0x57, 0x4A,
+0x4A, 0x41, 0x41, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x48, 0x48, 0x53, 0x53, 0x66, 0x66, 0x9D,
+0x9D, 0xAE, 0xAE, 0xB8, 0xB8, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBC, 0xBC, 0xB3, 0xB3, 0xA5,
+0xA5, 0x86, 0x86, 0x5A, 0x5A, 0x4D, 0x4D, 0x43, 0x43, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x46,
+0x46, 0x50, 0x50, 0x60, 0x60, 0x96, 0x96, 0xAA, 0xAA, 0xB6, 0xB6, 0xBE, 0xBE, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xBE, 0xBE, 0xB6, 0xB6, 0xAA, 0xAA, 0x96, 0x96, 0x61, 0x61, 0x51, 0x51, 0x46, 0x46, 0x3F,
+0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x43, 0x43, 0x4D, 0x4D, 0x5A, 0x5A, 0x76, 0x76, 0xA4, 0xA4, 0xB1,
+0xB1, 0xBB, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB9, 0xB9, 0xAF, 0xAF, 0xA0, 0xA0, 0x6D,
+0x6D, 0x57, 0x57, 0x4B, 0x4B, 0x42, 0x42, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x40, 0x40, 0x48, 0x48, 0x53,
+0x53, 0x63, 0x63, 0x99, 0x99, 0xAB, 0xAB, 0xB6, 0xB6, 0xBE, 0xBE, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBD,
+0xBD, 0xB5, 0xB5, 0xA9, 0xA9, 0x97, 0x97, 0x62, 0x62, 0x52, 0x52, 0x48, 0x48, 0x40, 0x40, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3E, 0x3E, 0x43, 0x43, 0x4C, 0x4C, 0x58, 0x58, 0x6E, 0x6E, 0xA0, 0xA0, 0xAE, 0xAE, 0xB8,
+0xB8, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBA, 0xBA, 0xB2, 0xB2, 0xA5, 0xA5, 0x8D, 0x8D, 0x5D,
+0x5D, 0x50, 0x50, 0x46, 0x46, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x45, 0x45, 0x4E, 0x4E, 0x5B,
+0x5B, 0x76, 0x76, 0xA3, 0xA3, 0xB0, 0xB0, 0xB9, 0xB9, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xB9,
+0xB9, 0xB0, 0xB0, 0xA3, 0xA3, 0x7A, 0x7A, 0x5C, 0x5C, 0x4F, 0x4F, 0x46, 0x46, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x46, 0x46, 0x4F, 0x4F, 0x5C, 0x5C, 0x85, 0x85, 0xA3, 0xA3, 0xB0, 0xB0, 0xB9,
+0xB9, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xB9, 0xB9, 0xB0, 0xB0, 0xA3, 0xA3, 0x7A, 0x7A, 0x5C,
+0x5C, 0x4F, 0x4F, 0x46, 0x46, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x46, 0x46, 0x4F, 0x4F, 0x5C,
+0x5C, 0x77, 0x77, 0xA2, 0xA2, 0xAF, 0xAF, 0xB8, 0xB8, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xB9,
+0xB9, 0xB0, 0xB0, 0xA4, 0xA4, 0x8C, 0x8C, 0x5E, 0x5E, 0x51, 0x51, 0x48, 0x48, 0x41, 0x41, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x45, 0x45, 0x4E, 0x4E, 0x59, 0x59, 0x6D, 0x6D, 0x9E, 0x9E, 0xAC, 0xAC, 0xB6,
+0xB6, 0xBD, 0xBD, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBA, 0xBA, 0xB2, 0xB2, 0xA8, 0xA8, 0x97, 0x97, 0x65,
+0x65, 0x55, 0x55, 0x4B, 0x4B, 0x43, 0x43, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x44, 0x44, 0x4B, 0x4B, 0x55,
+0x55, 0x64, 0x64, 0x96, 0x96, 0xA7, 0xA7, 0xB2, 0xB2, 0xBA, 0xBA, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBC,
+0xBC, 0xB5, 0xB5, 0xAC, 0xAC, 0x9F, 0x9F, 0x70, 0x70, 0x5B, 0x5B, 0x4F, 0x4F, 0x47, 0x47, 0x41,
+0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x48, 0x48, 0x50, 0x50, 0x5C, 0x5C, 0x73, 0x73, 0xA0, 0xA0, 0xAD,
+0xAD, 0xB6, 0xB6, 0xBC, 0xBC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xB9, 0xB9, 0xB1, 0xB1, 0xA7, 0xA7, 0x96,
+0x96, 0x64, 0x64, 0x56, 0x56, 0x4C, 0x4C, 0x45, 0x45, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x44, 0x44, 0x4B,
+0x4B, 0x55, 0x55, 0x62, 0x62, 0x92, 0x92, 0xA5, 0xA5, 0xB0, 0xB0, 0xB8, 0xB8, 0xBE, 0xBE, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xBD, 0xBD, 0xB6, 0xB6, 0xAE, 0xAE, 0xA2, 0xA2, 0x8C, 0x8C, 0x60, 0x60, 0x54, 0x54, 0x4B,
+0x4B, 0x44, 0x44, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x46, 0x46, 0x4E, 0x4E, 0x57, 0x57, 0x66, 0x66, 0x97,
+0x97, 0xA7, 0xA7, 0xB1, 0xB1, 0xB8, 0xB8, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBB, 0xBB, 0xB5, 0xB5, 0xAC,
+0xAC, 0xA0, 0xA0, 0x7A, 0x7A, 0x5E, 0x5E, 0x53, 0x53, 0x4A, 0x4A, 0x44, 0x44, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x42,
+0x42, 0x47, 0x47, 0x4F, 0x4F, 0x59, 0x59, 0x68, 0x68, 0x98, 0x98, 0xA7, 0xA7, 0xB1, 0xB1, 0xB8,
+0xB8, 0xBD, 0xBD, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBA, 0xBA, 0xB4, 0xB4, 0xAC, 0xAC, 0xA0, 0xA0, 0x7A, 0x7A, 0x5F,
+0x5F, 0x53, 0x53, 0x4B, 0x4B, 0x44, 0x44, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x42, 0x42, 0x47, 0x47, 0x4F, 0x4F, 0x58,
+0x58, 0x67, 0x67, 0x96, 0x96, 0xA6, 0xA6, 0xAF, 0xAF, 0xB6, 0xB6, 0xBC, 0xBC, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBA,
+0xBA, 0xB4, 0xB4, 0xAC, 0xAC, 0xA1, 0xA1, 0x8D, 0x8D, 0x62, 0x62, 0x56, 0x56, 0x4D, 0x4D, 0x46,
+0x46, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x42, 0x42, 0x47, 0x47, 0x4E, 0x4E, 0x56, 0x56, 0x63, 0x63, 0x8F, 0x8F, 0xA2,
+0xA2, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBB, 0xBB, 0xB6, 0xB6, 0xAE, 0xAE, 0xA5,
+0xA5, 0x95, 0x95, 0x67, 0x67, 0x59, 0x59, 0x50, 0x50, 0x49, 0x49, 0x43, 0x43, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x46,
+0x46, 0x4C, 0x4C, 0x53, 0x53, 0x5E, 0x5E, 0x72, 0x72, 0x9C, 0x9C, 0xA8, 0xA8, 0xB1, 0xB1, 0xB7,
+0xB7, 0xBC, 0xBC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xBD, 0xBD, 0xB8, 0xB8, 0xB1, 0xB1, 0xA9, 0xA9, 0x9D, 0x9D, 0x74, 0x74, 0x5F,
+0x5F, 0x54, 0x54, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x59,
+0x59, 0x66, 0x66, 0x91, 0x91, 0xA2, 0xA2, 0xAC, 0xAC, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBE, 0xBE, 0xBA,
+0xBA, 0xB4, 0xB4, 0xAD, 0xAD, 0xA4, 0xA4, 0x96, 0x96, 0x69, 0x69, 0x5B, 0x5B, 0x52, 0x52, 0x4B,
+0x4B, 0x45, 0x45, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x42, 0x42, 0x46, 0x46, 0x4C, 0x4C, 0x53, 0x53, 0x5D, 0x5D, 0x6D, 0x6D, 0x98,
+0x98, 0xA5, 0xA5, 0xAE, 0xAE, 0xB5, 0xB5, 0xBA, 0xBA, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBC, 0xBC, 0xB8, 0xB8, 0xB2, 0xB2, 0xAB,
+0xAB, 0xA1, 0xA1, 0x8F, 0x8F, 0x65, 0x65, 0x59, 0x59, 0x50, 0x50, 0x4A, 0x4A, 0x45, 0x45, 0x42,
+0x42, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x44,
+0x44, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x5F, 0x5F, 0x72, 0x72, 0x9B, 0x9B, 0xA6, 0xA6, 0xAE,
+0xAE, 0xB5, 0xB5, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xBE, 0xBE, 0xBB, 0xBB, 0xB6, 0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0x9F, 0x9F, 0x8C,
+0x8C, 0x64, 0x64, 0x59, 0x59, 0x51, 0x51, 0x4B, 0x4B, 0x46, 0x46, 0x42, 0x42, 0x40, 0x40, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x45, 0x45, 0x49, 0x49, 0x4F,
+0x4F, 0x56, 0x56, 0x60, 0x60, 0x72, 0x72, 0x9A, 0x9A, 0xA6, 0xA6, 0xAE, 0xAE, 0xB4, 0xB4, 0xB9,
+0xB9, 0xBC, 0xBC, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD,
+0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xB0, 0xB0, 0xA9, 0xA9, 0x9F, 0x9F, 0x8D, 0x8D, 0x65, 0x65, 0x5A,
+0x5A, 0x52, 0x52, 0x4C, 0x4C, 0x47, 0x47, 0x44, 0x44, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4F, 0x4F, 0x56, 0x56, 0x5F,
+0x5F, 0x6F, 0x6F, 0x98, 0x98, 0xA4, 0xA4, 0xAC, 0xAC, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB, 0xBB, 0xBD,
+0xBD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD, 0xBD, 0xBA, 0xBA, 0xB6,
+0xB6, 0xB0, 0xB0, 0xAA, 0xAA, 0xA1, 0xA1, 0x93, 0x93, 0x69, 0x69, 0x5D, 0x5D, 0x54, 0x54, 0x4E,
+0x4E, 0x49, 0x49, 0x45, 0x45, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40,
+0x40, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4E, 0x4E, 0x54, 0x54, 0x5D, 0x5D, 0x69, 0x69, 0x92,
+0x92, 0xA0, 0xA0, 0xA9, 0xA9, 0xB0, 0xB0, 0xB5, 0xB5, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAC,
+0xAC, 0xA4, 0xA4, 0x99, 0x99, 0x72, 0x72, 0x61, 0x61, 0x58, 0x58, 0x51, 0x51, 0x4C, 0x4C, 0x48,
+0x48, 0x45, 0x45, 0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x45,
+0x45, 0x48, 0x48, 0x4D, 0x4D, 0x52, 0x52, 0x59, 0x59, 0x63, 0x63, 0x79, 0x79, 0x9A, 0x9A, 0xA5,
+0xA5, 0xAC, 0xAC, 0xB1, 0xB1, 0xB6, 0xB6, 0xB9, 0xB9, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA7, 0xA7, 0x9F,
+0x9F, 0x90, 0x90, 0x69, 0x69, 0x5D, 0x5D, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x47, 0x47, 0x44,
+0x44, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x45, 0x45, 0x47, 0x47, 0x4B,
+0x4B, 0x50, 0x50, 0x56, 0x56, 0x5D, 0x5D, 0x69, 0x69, 0x90, 0x90, 0x9E, 0x9E, 0xA7, 0xA7, 0xAD,
+0xAD, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB8, 0xB8, 0xB5, 0xB5, 0xB1, 0xB1, 0xAB, 0xAB, 0xA4, 0xA4, 0x9A, 0x9A, 0x83,
+0x83, 0x65, 0x65, 0x5B, 0x5B, 0x54, 0x54, 0x4F, 0x4F, 0x4B, 0x4B, 0x47, 0x47, 0x45, 0x45, 0x43,
+0x43, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x52,
+0x52, 0x58, 0x58, 0x60, 0x60, 0x6D, 0x6D, 0x94, 0x94, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE, 0xAE, 0xB2,
+0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB9,
+0xB9, 0xB7, 0xB7, 0xB3, 0xB3, 0xAF, 0xAF, 0xA9, 0xA9, 0xA2, 0xA2, 0x98, 0x98, 0x76, 0x76, 0x64,
+0x64, 0x5B, 0x5B, 0x54, 0x54, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4B, 0x4B, 0x4F, 0x4F, 0x53, 0x53, 0x5A,
+0x5A, 0x62, 0x62, 0x6F, 0x6F, 0x95, 0x95, 0xA0, 0xA0, 0xA7, 0xA7, 0xAD, 0xAD, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9, 0xB9, 0xB8, 0xB8, 0xB5,
+0xB5, 0xB2, 0xB2, 0xAE, 0xAE, 0xA8, 0xA8, 0xA1, 0xA1, 0x98, 0x98, 0x76, 0x76, 0x65, 0x65, 0x5C,
+0x5C, 0x56, 0x56, 0x51, 0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x45,
+0x45, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x54, 0x54, 0x5A, 0x5A, 0x62,
+0x62, 0x6D, 0x6D, 0x92, 0x92, 0x9E, 0x9E, 0xA5, 0xA5, 0xAB, 0xAB, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6,
+0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB4, 0xB4, 0xB1,
+0xB1, 0xAE, 0xAE, 0xA9, 0xA9, 0xA2, 0xA2, 0x99, 0x99, 0x87, 0x87, 0x67, 0x67, 0x5E, 0x5E, 0x57,
+0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x47,
+0x47, 0x48, 0x48, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x54, 0x54, 0x59, 0x59, 0x60, 0x60, 0x6A,
+0x6A, 0x8D, 0x8D, 0x9B, 0x9B, 0xA3, 0xA3, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB6,
+0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE,
+0xAE, 0xA9, 0xA9, 0xA4, 0xA4, 0x9C, 0x9C, 0x90, 0x90, 0x6D, 0x6D, 0x62, 0x62, 0x5B, 0x5B, 0x55,
+0x55, 0x51, 0x51, 0x4D, 0x4D, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49,
+0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x66, 0x66, 0x75,
+0x75, 0x96, 0x96, 0x9F, 0x9F, 0xA5, 0xA5, 0xAB, 0xAB, 0xAE, 0xAE, 0xB1, 0xB1, 0xB4, 0xB4, 0xB5,
+0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA,
+0xAA, 0xA6, 0xA6, 0x9F, 0x9F, 0x97, 0x97, 0x7A, 0x7A, 0x68, 0x68, 0x5F, 0x5F, 0x59, 0x59, 0x54,
+0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4B,
+0x4B, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5B, 0x5B, 0x61, 0x61, 0x6B, 0x6B, 0x8B,
+0x8B, 0x99, 0x99, 0xA1, 0xA1, 0xA6, 0xA6, 0xAB, 0xAB, 0xAE, 0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4,
+0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA8,
+0xA8, 0xA3, 0xA3, 0x9C, 0x9C, 0x92, 0x92, 0x71, 0x71, 0x65, 0x65, 0x5E, 0x5E, 0x58, 0x58, 0x54,
+0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C,
+0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x54, 0x54, 0x58, 0x58, 0x5D, 0x5D, 0x64, 0x64, 0x6E, 0x6E, 0x8F,
+0x8F, 0x9A, 0x9A, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xB0, 0xB0, 0xAD, 0xAD, 0xAA, 0xAA, 0xA6,
+0xA6, 0xA1, 0xA1, 0x9A, 0x9A, 0x90, 0x90, 0x6F, 0x6F, 0x65, 0x65, 0x5E, 0x5E, 0x59, 0x59, 0x55,
+0x55, 0x52, 0x52, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E,
+0x4E, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x5A, 0x5A, 0x5F, 0x5F, 0x65, 0x65, 0x70, 0x70, 0x90,
+0x90, 0x9A, 0x9A, 0xA1, 0xA1, 0xA5, 0xA5, 0xA9, 0xA9, 0xAC, 0xAC, 0xAF, 0xAF, 0xB0, 0xB0, 0xB1,
+0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAE, 0xAE, 0xAC, 0xAC, 0xA9, 0xA9, 0xA5,
+0xA5, 0xA0, 0xA0, 0x99, 0x99, 0x8F, 0x8F, 0x70, 0x70, 0x66, 0x66, 0x5F, 0x5F, 0x5A, 0x5A, 0x57,
+0x57, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50,
+0x50, 0x51, 0x51, 0x54, 0x54, 0x57, 0x57, 0x5A, 0x5A, 0x5F, 0x5F, 0x65, 0x65, 0x6F, 0x6F, 0x8D,
+0x8D, 0x98, 0x98, 0x9F, 0x9F, 0xA4, 0xA4, 0xA7, 0xA7, 0xAB, 0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF,
+0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAD, 0xAD, 0xAB, 0xAB, 0xA8, 0xA8, 0xA4,
+0xA4, 0xA0, 0xA0, 0x9A, 0x9A, 0x91, 0x91, 0x74, 0x74, 0x69, 0x69, 0x62, 0x62, 0x5D, 0x5D, 0x59,
+0x59, 0x56, 0x56, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51,
+0x51, 0x52, 0x52, 0x54, 0x54, 0x57, 0x57, 0x5B, 0x5B, 0x5F, 0x5F, 0x64, 0x64, 0x6C, 0x6C, 0x86,
+0x86, 0x95, 0x95, 0x9C, 0x9C, 0xA1, 0xA1, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5,
+0xA5, 0xA1, 0xA1, 0x9B, 0x9B, 0x94, 0x94, 0x86, 0x86, 0x6C, 0x6C, 0x65, 0x65, 0x60, 0x60, 0x5C,
+0x5C, 0x58, 0x58, 0x56, 0x56, 0x54, 0x54, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x52,
+0x52, 0x53, 0x53, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5E, 0x5E, 0x63, 0x63, 0x69, 0x69, 0x73,
+0x73, 0x8F, 0x8F, 0x98, 0x98, 0x9D, 0x9D, 0xA2, 0xA2, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA, 0xAA, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5,
+0xA5, 0xA1, 0xA1, 0x9D, 0x9D, 0x98, 0x98, 0x90, 0x90, 0x74, 0x74, 0x6A, 0x6A, 0x63, 0x63, 0x5F,
+0x5F, 0x5B, 0x5B, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5D, 0x5D, 0x61, 0x61, 0x66, 0x66, 0x6D,
+0x6D, 0x81, 0x81, 0x92, 0x92, 0x99, 0x99, 0x9E, 0x9E, 0xA1, 0xA1, 0xA4, 0xA4, 0xA7, 0xA7, 0xA9,
+0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7, 0xA7, 0xA5,
+0xA5, 0xA2, 0xA2, 0x9F, 0x9F, 0x9A, 0x9A, 0x94, 0x94, 0x8B, 0x8B, 0x71, 0x71, 0x69, 0x69, 0x63,
+0x63, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x58, 0x58, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55,
+0x55, 0x56, 0x56, 0x56, 0x56, 0x58, 0x58, 0x5A, 0x5A, 0x5C, 0x5C, 0x5F, 0x5F, 0x63, 0x63, 0x68,
+0x68, 0x6F, 0x6F, 0x88, 0x88, 0x93, 0x93, 0x99, 0x99, 0x9D, 0x9D, 0xA0, 0xA0, 0xA3, 0xA3, 0xA5,
+0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA5,
+0xA5, 0xA3, 0xA3, 0xA0, 0xA0, 0x9D, 0x9D, 0x98, 0x98, 0x93, 0x93, 0x89, 0x89, 0x70, 0x70, 0x69,
+0x69, 0x64, 0x64, 0x61, 0x61, 0x5E, 0x5E, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x65,
+0x65, 0x6A, 0x6A, 0x70, 0x70, 0x88, 0x88, 0x92, 0x92, 0x98, 0x98, 0x9B, 0x9B, 0x9F, 0x9F, 0xA1,
+0xA1, 0xA3, 0xA3, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F, 0x9F, 0x9B, 0x9B, 0x97, 0x97, 0x92, 0x92, 0x8A, 0x8A, 0x72,
+0x72, 0x6B, 0x6B, 0x67, 0x67, 0x63, 0x63, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x62,
+0x62, 0x66, 0x66, 0x6A, 0x6A, 0x70, 0x70, 0x83, 0x83, 0x90, 0x90, 0x95, 0x95, 0x99, 0x99, 0x9C,
+0x9C, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA1, 0xA1, 0xA0, 0xA0, 0x9D, 0x9D, 0x9B, 0x9B, 0x97, 0x97, 0x93, 0x93, 0x8C,
+0x8C, 0x76, 0x76, 0x6E, 0x6E, 0x69, 0x69, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5F, 0x5F, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61,
+0x61, 0x63, 0x63, 0x66, 0x66, 0x6A, 0x6A, 0x6F, 0x6F, 0x76, 0x76, 0x8C, 0x8C, 0x92, 0x92, 0x96,
+0x96, 0x99, 0x99, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A, 0x9A, 0x97, 0x97, 0x93,
+0x93, 0x8E, 0x8E, 0x85, 0x85, 0x72, 0x72, 0x6D, 0x6D, 0x69, 0x69, 0x66, 0x66, 0x64, 0x64, 0x62,
+0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61,
+0x61, 0x62, 0x62, 0x64, 0x64, 0x67, 0x67, 0x6A, 0x6A, 0x6D, 0x6D, 0x73, 0x73, 0x84, 0x84, 0x8E,
+0x8E, 0x92, 0x92, 0x96, 0x96, 0x98, 0x98, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x97,
+0x97, 0x94, 0x94, 0x90, 0x90, 0x8B, 0x8B, 0x79, 0x79, 0x71, 0x71, 0x6D, 0x6D, 0x6A, 0x6A, 0x68,
+0x68, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x67, 0x67, 0x6A, 0x6A, 0x6D, 0x6D, 0x70, 0x70, 0x75,
+0x75, 0x87, 0x87, 0x8D, 0x8D, 0x91, 0x91, 0x94, 0x94, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98,
+0x98, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8E, 0x8E, 0x89, 0x89, 0x78, 0x78, 0x72, 0x72, 0x6F,
+0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F,
+0x6F, 0x72, 0x72, 0x77, 0x77, 0x87, 0x87, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x95,
+0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96,
+0x96, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x87, 0x87, 0x79,
+0x79, 0x74, 0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D,
+0x6D, 0x6F, 0x6F, 0x71, 0x71, 0x74, 0x74, 0x78, 0x78, 0x85, 0x85, 0x8A, 0x8A, 0x8C, 0x8C, 0x8F,
+0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A,
+0x8A, 0x87, 0x87, 0x7C, 0x7C, 0x77, 0x77, 0x75, 0x75, 0x73, 0x73, 0x71, 0x71, 0x70, 0x70, 0x6F,
+0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F,
+0x6F, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x74, 0x74, 0x76, 0x76, 0x78, 0x78, 0x7E, 0x7E, 0x86,
+0x86, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A,
+0x8A, 0x88, 0x88, 0x87, 0x87, 0x85, 0x85, 0x82, 0x82, 0x7B, 0x7B, 0x79, 0x79, 0x78, 0x78, 0x77,
+0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B,
+0x7B, 0x7D, 0x7D, 0x82, 0x82, 0x83, 0x83, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A,
+0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7C, 0x7C, 0x81, 0x81, 0x84,
+0x84, 0x86, 0x86, 0x87, 0x87, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A,
+0x8A, 0x88, 0x88, 0x87, 0x87, 0x85, 0x85, 0x82, 0x82, 0x7A, 0x7A, 0x78, 0x78, 0x76, 0x76, 0x74,
+0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x77,
+0x77, 0x7A, 0x7A, 0x84, 0x84, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F,
+0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91,
+0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8B, 0x8B, 0x88, 0x88, 0x83, 0x83, 0x78,
+0x78, 0x74, 0x74, 0x72, 0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E,
+0x6E, 0x70, 0x70, 0x72, 0x72, 0x74, 0x74, 0x78, 0x78, 0x85, 0x85, 0x8A, 0x8A, 0x8D, 0x8D, 0x8F,
+0x8F, 0x91, 0x91, 0x92, 0x92, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8E,
+0x8E, 0x8A, 0x8A, 0x84, 0x84, 0x76, 0x76, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A,
+0x6A, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67,
+0x67, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x76, 0x76, 0x85,
+0x85, 0x8B, 0x8B, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x97,
+0x97, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8D, 0x8D, 0x88, 0x88, 0x77, 0x77, 0x71, 0x71, 0x6E,
+0x6E, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x69, 0x69, 0x6B,
+0x6B, 0x6E, 0x6E, 0x72, 0x72, 0x7A, 0x7A, 0x8B, 0x8B, 0x90, 0x90, 0x93, 0x93, 0x96, 0x96, 0x98,
+0x98, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x94, 0x94, 0x91, 0x91, 0x8C,
+0x8C, 0x7D, 0x7D, 0x72, 0x72, 0x6E, 0x6E, 0x6A, 0x6A, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x65, 0x65, 0x67, 0x67, 0x6A, 0x6A, 0x6E, 0x6E, 0x73, 0x73, 0x86, 0x86, 0x8E,
+0x8E, 0x93, 0x93, 0x96, 0x96, 0x99, 0x99, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A,
+0x9A, 0x98, 0x98, 0x95, 0x95, 0x91, 0x91, 0x8B, 0x8B, 0x77, 0x77, 0x70, 0x70, 0x6B, 0x6B, 0x68,
+0x68, 0x65, 0x65, 0x62, 0x62, 0x61, 0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x66, 0x66, 0x6A,
+0x6A, 0x6E, 0x6E, 0x74, 0x74, 0x89, 0x89, 0x90, 0x90, 0x95, 0x95, 0x98, 0x98, 0x9B, 0x9B, 0x9D,
+0x9D, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9C, 0x9C, 0x99, 0x99, 0x96, 0x96, 0x92, 0x92, 0x8B,
+0x8B, 0x75, 0x75, 0x6E, 0x6E, 0x69, 0x69, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5F, 0x5F, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E,
+0x5E, 0x5F, 0x5F, 0x62, 0x62, 0x65, 0x65, 0x68, 0x68, 0x6D, 0x6D, 0x73, 0x73, 0x8A, 0x8A, 0x91,
+0x91, 0x96, 0x96, 0x9A, 0x9A, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1, 0xA1, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA2, 0xA2, 0xA1, 0xA1, 0x9E,
+0x9E, 0x9C, 0x9C, 0x98, 0x98, 0x93, 0x93, 0x8D, 0x8D, 0x76, 0x76, 0x6D, 0x6D, 0x68, 0x68, 0x64,
+0x64, 0x61, 0x61, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F, 0x5F, 0x62, 0x62, 0x66,
+0x66, 0x6A, 0x6A, 0x71, 0x71, 0x88, 0x88, 0x91, 0x91, 0x97, 0x97, 0x9B, 0x9B, 0x9E, 0x9E, 0xA1,
+0xA1, 0xA3, 0xA3, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9E, 0x9E, 0x9A, 0x9A, 0x96, 0x96, 0x90,
+0x90, 0x7D, 0x7D, 0x6F, 0x6F, 0x69, 0x69, 0x64, 0x64, 0x61, 0x61, 0x5E, 0x5E, 0x5B, 0x5B, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x59,
+0x59, 0x5A, 0x5A, 0x5D, 0x5D, 0x5F, 0x5F, 0x63, 0x63, 0x67, 0x67, 0x6D, 0x6D, 0x77, 0x77, 0x8F,
+0x8F, 0x96, 0x96, 0x9A, 0x9A, 0x9E, 0x9E, 0xA1, 0xA1, 0xA4, 0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9,
+0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA7, 0xA7, 0xA6, 0xA6, 0xA4,
+0xA4, 0xA1, 0xA1, 0x9E, 0x9E, 0x9A, 0x9A, 0x95, 0x95, 0x8D, 0x8D, 0x73, 0x73, 0x6A, 0x6A, 0x65,
+0x65, 0x61, 0x61, 0x5E, 0x5E, 0x5B, 0x5B, 0x58, 0x58, 0x57, 0x57, 0x55, 0x55, 0x55, 0x55, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5C, 0x5C, 0x5F,
+0x5F, 0x63, 0x63, 0x68, 0x68, 0x6F, 0x6F, 0x86, 0x86, 0x92, 0x92, 0x99, 0x99, 0x9D, 0x9D, 0xA1,
+0xA1, 0xA4, 0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7, 0xA7, 0xA5, 0xA5, 0xA2, 0xA2, 0x9E, 0x9E, 0x9A,
+0x9A, 0x94, 0x94, 0x8A, 0x8A, 0x70, 0x70, 0x68, 0x68, 0x63, 0x63, 0x5F, 0x5F, 0x5C, 0x5C, 0x59,
+0x59, 0x57, 0x57, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54,
+0x54, 0x55, 0x55, 0x56, 0x56, 0x59, 0x59, 0x5B, 0x5B, 0x5F, 0x5F, 0x63, 0x63, 0x68, 0x68, 0x70,
+0x70, 0x8A, 0x8A, 0x94, 0x94, 0x9A, 0x9A, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA,
+0xAA, 0xA8, 0xA8, 0xA6, 0xA6, 0xA3, 0xA3, 0x9F, 0x9F, 0x9A, 0x9A, 0x94, 0x94, 0x89, 0x89, 0x6F,
+0x6F, 0x67, 0x67, 0x62, 0x62, 0x5E, 0x5E, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x53, 0x53, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x55, 0x55, 0x57,
+0x57, 0x5A, 0x5A, 0x5D, 0x5D, 0x61, 0x61, 0x67, 0x67, 0x6E, 0x6E, 0x88, 0x88, 0x94, 0x94, 0x9B,
+0x9B, 0xA0, 0xA0, 0xA3, 0xA3, 0xA7, 0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5,
+0xA5, 0xA1, 0xA1, 0x9C, 0x9C, 0x96, 0x96, 0x8C, 0x8C, 0x70, 0x70, 0x67, 0x67, 0x62, 0x62, 0x5D,
+0x5D, 0x59, 0x59, 0x56, 0x56, 0x54, 0x54, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x55, 0x55, 0x58, 0x58, 0x5B, 0x5B, 0x5F,
+0x5F, 0x64, 0x64, 0x6B, 0x6B, 0x7A, 0x7A, 0x93, 0x93, 0x9A, 0x9A, 0xA0, 0xA0, 0xA4, 0xA4, 0xA7,
+0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA7, 0xA7, 0xA4, 0xA4, 0x9F, 0x9F, 0x9A,
+0x9A, 0x92, 0x92, 0x76, 0x76, 0x6A, 0x6A, 0x63, 0x63, 0x5E, 0x5E, 0x5A, 0x5A, 0x56, 0x56, 0x54,
+0x54, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F,
+0x4F, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x58, 0x58, 0x5C, 0x5C, 0x60, 0x60, 0x66, 0x66, 0x6F,
+0x6F, 0x8D, 0x8D, 0x97, 0x97, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAF,
+0xAF, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF,
+0xAF, 0xAD, 0xAD, 0xAA, 0xAA, 0xA7, 0xA7, 0xA3, 0xA3, 0x9E, 0x9E, 0x97, 0x97, 0x8E, 0x8E, 0x6F,
+0x6F, 0x66, 0x66, 0x60, 0x60, 0x5B, 0x5B, 0x57, 0x57, 0x54, 0x54, 0x51, 0x51, 0x4F, 0x4F, 0x4E,
+0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x52,
+0x52, 0x54, 0x54, 0x58, 0x58, 0x5C, 0x5C, 0x61, 0x61, 0x68, 0x68, 0x73, 0x73, 0x91, 0x91, 0x9A,
+0x9A, 0xA0, 0xA0, 0xA5, 0xA5, 0xA9, 0xA9, 0xAC, 0xAC, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB2, 0xB0, 0xB0, 0xAE, 0xAE, 0xAB,
+0xAB, 0xA8, 0xA8, 0xA3, 0xA3, 0x9E, 0x9E, 0x97, 0x97, 0x8B, 0x8B, 0x6D, 0x6D, 0x64, 0x64, 0x5E,
+0x5E, 0x59, 0x59, 0x55, 0x55, 0x52, 0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4A, 0x4A, 0x4B, 0x4B, 0x4B, 0x4B, 0x4D, 0x4D, 0x4E, 0x4E, 0x51, 0x51, 0x53, 0x53, 0x57,
+0x57, 0x5B, 0x5B, 0x60, 0x60, 0x67, 0x67, 0x73, 0x73, 0x92, 0x92, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6,
+0xA6, 0xAA, 0xAA, 0xAD, 0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB1, 0xB1, 0xAF, 0xAF, 0xAC, 0xAC, 0xA9, 0xA9, 0xA5,
+0xA5, 0x9F, 0x9F, 0x98, 0x98, 0x8D, 0x8D, 0x6E, 0x6E, 0x64, 0x64, 0x5E, 0x5E, 0x59, 0x59, 0x55,
+0x55, 0x52, 0x52, 0x4F, 0x4F, 0x4D, 0x4D, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x55, 0x55, 0x59, 0x59, 0x5F,
+0x5F, 0x65, 0x65, 0x6F, 0x6F, 0x90, 0x90, 0x9A, 0x9A, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9B,
+0x9B, 0x92, 0x92, 0x72, 0x72, 0x66, 0x66, 0x5F, 0x5F, 0x59, 0x59, 0x55, 0x55, 0x51, 0x51, 0x4E,
+0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49,
+0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x53, 0x53, 0x56, 0x56, 0x5B, 0x5B, 0x61, 0x61, 0x6A,
+0x6A, 0x87, 0x87, 0x97, 0x97, 0x9F, 0x9F, 0xA5, 0xA5, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB3,
+0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5,
+0xB5, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA6, 0xA6, 0xA0, 0xA0, 0x98, 0x98, 0x8A,
+0x8A, 0x6B, 0x6B, 0x62, 0x62, 0x5B, 0x5B, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A,
+0x4A, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x4A,
+0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x64, 0x64, 0x6E, 0x6E, 0x8F,
+0x8F, 0x9B, 0x9B, 0xA2, 0xA2, 0xA7, 0xA7, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6,
+0xB6, 0xB8, 0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB4,
+0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA5, 0xA5, 0x9F, 0x9F, 0x96, 0x96, 0x7C, 0x7C, 0x68,
+0x68, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x51, 0x51, 0x4D, 0x4D, 0x4B, 0x4B, 0x49, 0x49, 0x47,
+0x47, 0x46, 0x46, 0x46, 0x46, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4C,
+0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x64, 0x64, 0x6F, 0x6F, 0x91, 0x91, 0x9C,
+0x9C, 0xA3, 0xA3, 0xA8, 0xA8, 0xAD, 0xAD, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9,
+0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2,
+0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0x9F, 0x9F, 0x97, 0x97, 0x7C, 0x7C, 0x68, 0x68, 0x5F,
+0x5F, 0x59, 0x59, 0x54, 0x54, 0x50, 0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x45,
+0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x47, 0x47, 0x48, 0x48, 0x4B, 0x4B, 0x4E,
+0x4E, 0x51, 0x51, 0x56, 0x56, 0x5B, 0x5B, 0x62, 0x62, 0x6D, 0x6D, 0x8F, 0x8F, 0x9B, 0x9B, 0xA3,
+0xA3, 0xA8, 0xA8, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB7, 0xB7, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB0,
+0xB0, 0xAC, 0xAC, 0xA8, 0xA8, 0xA2, 0xA2, 0x9A, 0x9A, 0x8C, 0x8C, 0x6A, 0x6A, 0x60, 0x60, 0x5A,
+0x5A, 0x54, 0x54, 0x50, 0x50, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x44, 0x44, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4C, 0x4C, 0x4F,
+0x4F, 0x53, 0x53, 0x58, 0x58, 0x5F, 0x5F, 0x68, 0x68, 0x86, 0x86, 0x98, 0x98, 0xA1, 0xA1, 0xA7,
+0xA7, 0xAC, 0xAC, 0xB0, 0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF,
+0xAF, 0xAB, 0xAB, 0xA5, 0xA5, 0x9E, 0x9E, 0x94, 0x94, 0x72, 0x72, 0x64, 0x64, 0x5C, 0x5C, 0x56,
+0x56, 0x51, 0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x45, 0x45, 0x46, 0x46, 0x49, 0x49, 0x4C, 0x4C, 0x50,
+0x50, 0x54, 0x54, 0x5A, 0x5A, 0x61, 0x61, 0x6D, 0x6D, 0x91, 0x91, 0x9C, 0x9C, 0xA4, 0xA4, 0xAA,
+0xAA, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF,
+0xAF, 0xAA, 0xAA, 0xA4, 0xA4, 0x9D, 0x9D, 0x91, 0x91, 0x6D, 0x6D, 0x61, 0x61, 0x5A, 0x5A, 0x54,
+0x54, 0x4F, 0x4F, 0x4C, 0x4C, 0x48, 0x48, 0x46, 0x46, 0x44, 0x44, 0x42, 0x42, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x44, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4C, 0x4C, 0x50,
+0x50, 0x54, 0x54, 0x5A, 0x5A, 0x62, 0x62, 0x6E, 0x6E, 0x93, 0x93, 0x9E, 0x9E, 0xA6, 0xA6, 0xAB,
+0xAB, 0xB0, 0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB4, 0xB4, 0xB0,
+0xB0, 0xAB, 0xAB, 0xA5, 0xA5, 0x9D, 0x9D, 0x91, 0x91, 0x6C, 0x6C, 0x61, 0x61, 0x59, 0x59, 0x53,
+0x53, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4E,
+0x4E, 0x53, 0x53, 0x59, 0x59, 0x61, 0x61, 0x6C, 0x6C, 0x91, 0x91, 0x9D, 0x9D, 0xA5, 0xA5, 0xAB,
+0xAB, 0xB0, 0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB5, 0xB5, 0xB1,
+0xB1, 0xAD, 0xAD, 0xA7, 0xA7, 0xA0, 0xA0, 0x95, 0x95, 0x71, 0x71, 0x63, 0x63, 0x5B, 0x5B, 0x54,
+0x54, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x45, 0x45, 0x48, 0x48, 0x4C,
+0x4C, 0x51, 0x51, 0x56, 0x56, 0x5D, 0x5D, 0x67, 0x67, 0x87, 0x87, 0x9A, 0x9A, 0xA3, 0xA3, 0xAA,
+0xAA, 0xAF, 0xAF, 0xB4, 0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4,
+0xB4, 0xB0, 0xB0, 0xAB, 0xAB, 0xA4, 0xA4, 0x9B, 0x9B, 0x8C, 0x8C, 0x68, 0x68, 0x5E, 0x5E, 0x57,
+0x57, 0x51, 0x51, 0x4C, 0x4C, 0x49, 0x49, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x49,
+0x49, 0x4D, 0x4D, 0x52, 0x52, 0x58, 0x58, 0x60, 0x60, 0x6C, 0x6C, 0x91, 0x91, 0x9E, 0x9E, 0xA6,
+0xA6, 0xAC, 0xAC, 0xB1, 0xB1, 0xB5, 0xB5, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8,
+0xB8, 0xB4, 0xB4, 0xAF, 0xAF, 0xAA, 0xAA, 0xA3, 0xA3, 0x99, 0x99, 0x79, 0x79, 0x65, 0x65, 0x5C,
+0x5C, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x47, 0x47, 0x44, 0x44, 0x42, 0x42, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x46,
+0x46, 0x49, 0x49, 0x4D, 0x4D, 0x52, 0x52, 0x58, 0x58, 0x61, 0x61, 0x6E, 0x6E, 0x94, 0x94, 0xA0,
+0xA0, 0xA8, 0xA8, 0xAE, 0xAE, 0xB2, 0xB2, 0xB6, 0xB6, 0xBA, 0xBA, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBB,
+0xBB, 0xB8, 0xB8, 0xB4, 0xB4, 0xB0, 0xB0, 0xAA, 0xAA, 0xA3, 0xA3, 0x99, 0x99, 0x7A, 0x7A, 0x65,
+0x65, 0x5B, 0x5B, 0x54, 0x54, 0x4F, 0x4F, 0x4A, 0x4A, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42,
+0x42, 0x44, 0x44, 0x48, 0x48, 0x4C, 0x4C, 0x51, 0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6B, 0x6B, 0x92,
+0x92, 0x9F, 0x9F, 0xA7, 0xA7, 0xAD, 0xAD, 0xB2, 0xB2, 0xB7, 0xB7, 0xBA, 0xBA, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBD, 0xBD, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAC, 0xAC, 0xA6, 0xA6, 0x9D, 0x9D, 0x8D,
+0x8D, 0x68, 0x68, 0x5D, 0x5D, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x47, 0x47, 0x43, 0x43, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4A, 0x4A, 0x4F, 0x4F, 0x54, 0x54, 0x5C, 0x5C, 0x66,
+0x66, 0x87, 0x87, 0x9B, 0x9B, 0xA4, 0xA4, 0xAB, 0xAB, 0xB1, 0xB1, 0xB6, 0xB6, 0xB9, 0xB9, 0xBD,
+0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB8, 0xB8, 0xB4, 0xB4, 0xB0, 0xB0, 0xA9, 0xA9, 0xA2,
+0xA2, 0x97, 0x97, 0x71, 0x71, 0x62, 0x62, 0x59, 0x59, 0x52, 0x52, 0x4D, 0x4D, 0x48, 0x48, 0x44,
+0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x47, 0x47, 0x4B, 0x4B, 0x50, 0x50, 0x56,
+0x56, 0x5F, 0x5F, 0x6A, 0x6A, 0x92, 0x92, 0x9F, 0x9F, 0xA8, 0xA8, 0xAE, 0xAE, 0xB3, 0xB3, 0xB8,
+0xB8, 0xBB, 0xBB, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB8, 0xB8, 0xB4, 0xB4, 0xAF,
+0xAF, 0xA8, 0xA8, 0xA0, 0xA0, 0x93, 0x93, 0x6B, 0x6B, 0x5F, 0x5F, 0x56, 0x56, 0x50, 0x50, 0x4B,
+0x4B, 0x47, 0x47, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x47, 0x47, 0x4B,
+0x4B, 0x50, 0x50, 0x57, 0x57, 0x5F, 0x5F, 0x6C, 0x6C, 0x94, 0x94, 0xA0, 0xA0, 0xA9, 0xA9, 0xAF,
+0xAF, 0xB4, 0xB4, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB9,
+0xB9, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9, 0xA9, 0xA0, 0xA0, 0x94, 0x94, 0x6C, 0x6C, 0x5F, 0x5F, 0x56,
+0x56, 0x50, 0x50, 0x4B, 0x4B, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42,
+0x42, 0x45, 0x45, 0x4A, 0x4A, 0x4F, 0x4F, 0x55, 0x55, 0x5D, 0x5D, 0x69, 0x69, 0x91, 0x91, 0x9F,
+0x9F, 0xA8, 0xA8, 0xAF, 0xAF, 0xB4, 0xB4, 0xB8, 0xB8, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBA, 0xBA, 0xB6, 0xB6, 0xB2, 0xB2, 0xAB, 0xAB, 0xA4, 0xA4, 0x99, 0x99, 0x73,
+0x73, 0x62, 0x62, 0x59, 0x59, 0x51, 0x51, 0x4C, 0x4C, 0x47, 0x47, 0x43, 0x43, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x47, 0x47, 0x4C, 0x4C, 0x52, 0x52, 0x59, 0x59, 0x63,
+0x63, 0x75, 0x75, 0x9A, 0x9A, 0xA4, 0xA4, 0xAC, 0xAC, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB, 0xBB, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xB9, 0xB9, 0xB5, 0xB5, 0xAF, 0xAF, 0xA9,
+0xA9, 0xA0, 0xA0, 0x92, 0x92, 0x6A, 0x6A, 0x5D, 0x5D, 0x55, 0x55, 0x4F, 0x4F, 0x49, 0x49, 0x45,
+0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44, 0x44, 0x48, 0x48, 0x4D,
+0x4D, 0x53, 0x53, 0x5B, 0x5B, 0x66, 0x66, 0x8C, 0x8C, 0x9D, 0x9D, 0xA7, 0xA7, 0xAE, 0xAE, 0xB4,
+0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xB9,
+0xB9, 0xB4, 0xB4, 0xAF, 0xAF, 0xA8, 0xA8, 0x9F, 0x9F, 0x8F, 0x8F, 0x67, 0x67, 0x5C, 0x5C, 0x54,
+0x54, 0x4D, 0x4D, 0x48, 0x48, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x43, 0x43, 0x48, 0x48, 0x4D, 0x4D, 0x53, 0x53, 0x5B, 0x5B, 0x66, 0x66, 0x8D, 0x8D, 0x9E,
+0x9E, 0xA7, 0xA7, 0xAE, 0xAE, 0xB4, 0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBA, 0xBA, 0xB6, 0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0xA0, 0xA0, 0x92,
+0x92, 0x69, 0x69, 0x5D, 0x5D, 0x54, 0x54, 0x4E, 0x4E, 0x48, 0x48, 0x44, 0x44, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x46, 0x46, 0x4B, 0x4B, 0x51, 0x51, 0x58,
+0x58, 0x62, 0x62, 0x75, 0x75, 0x9A, 0x9A, 0xA5, 0xA5, 0xAD, 0xAD, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC,
+0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB8, 0xB8, 0xB3,
+0xB3, 0xAD, 0xAD, 0xA5, 0xA5, 0x9A, 0x9A, 0x73, 0x73, 0x61, 0x61, 0x57, 0x57, 0x50, 0x50, 0x4A,
+0x4A, 0x45, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43,
+0x43, 0x48, 0x48, 0x4D, 0x4D, 0x54, 0x54, 0x5C, 0x5C, 0x68, 0x68, 0x91, 0x91, 0xA0, 0xA0, 0xA9,
+0xA9, 0xB0, 0xB0, 0xB6, 0xB6, 0xBA, 0xBA, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB1, 0xB1, 0xAB, 0xAB, 0xA2, 0xA2, 0x95, 0x95, 0x6B,
+0x6B, 0x5E, 0x5E, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x4E, 0x4E, 0x54, 0x54, 0x5D,
+0x5D, 0x6A, 0x6A, 0x94, 0x94, 0xA2, 0xA2, 0xAA, 0xAA, 0xB1, 0xB1, 0xB7, 0xB7, 0xBB, 0xBB, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB7, 0xB7, 0xB2,
+0xB2, 0xAB, 0xAB, 0xA2, 0xA2, 0x95, 0x95, 0x6B, 0x6B, 0x5D, 0x5D, 0x54, 0x54, 0x4E, 0x4E, 0x48,
+0x48, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42,
+0x42, 0x47, 0x47, 0x4C, 0x4C, 0x53, 0x53, 0x5B, 0x5B, 0x67, 0x67, 0x91, 0x91, 0xA0, 0xA0, 0xAA,
+0xAA, 0xB1, 0xB1, 0xB6, 0xB6, 0xBB, 0xBB, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAD, 0xAD, 0xA5, 0xA5, 0x9A, 0x9A, 0x73,
+0x73, 0x61, 0x61, 0x57, 0x57, 0x4F, 0x4F, 0x49, 0x49, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x57,
+0x57, 0x61, 0x61, 0x75, 0x75, 0x9B, 0x9B, 0xA6, 0xA6, 0xAE, 0xAE, 0xB4, 0xB4, 0xB9, 0xB9, 0xBE,
+0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xB7,
+0xB7, 0xB2, 0xB2, 0xAB, 0xAB, 0xA2, 0xA2, 0x93, 0x93, 0x69, 0x69, 0x5C, 0x5C, 0x53, 0x53, 0x4D,
+0x4D, 0x47, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x45, 0x45, 0x4B, 0x4B, 0x51, 0x51, 0x59, 0x59, 0x64, 0x64, 0x8B, 0x8B, 0x9E,
+0x9E, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xB7, 0xB7, 0xB1, 0xB1, 0xAA, 0xAA, 0xA1,
+0xA1, 0x91, 0x91, 0x67, 0x67, 0x5B, 0x5B, 0x52, 0x52, 0x4C, 0x4C, 0x46, 0x46, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4A,
+0x4A, 0x50, 0x50, 0x58, 0x58, 0x63, 0x63, 0x88, 0x88, 0x9E, 0x9E, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6,
+0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xB8, 0xB8, 0xB3, 0xB3, 0xAC, 0xAC, 0xA3, 0xA3, 0x95, 0x95, 0x6B, 0x6B, 0x5D,
+0x5D, 0x54, 0x54, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x5F,
+0x5F, 0x6F, 0x6F, 0x99, 0x99, 0xA5, 0xA5, 0xAD, 0xAD, 0xB4, 0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBB, 0xBB, 0xB6,
+0xB6, 0xB0, 0xB0, 0xA8, 0xA8, 0x9D, 0x9D, 0x84, 0x84, 0x62, 0x62, 0x58, 0x58, 0x50, 0x50, 0x49,
+0x49, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x45, 0x45, 0x4A, 0x4A, 0x50, 0x50, 0x58, 0x58, 0x64, 0x64, 0x89, 0x89, 0x9E,
+0x9E, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6,
+0xA6, 0x9B, 0x9B, 0x72, 0x72, 0x60, 0x60, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x43, 0x43, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44,
+0x44, 0x4A, 0x4A, 0x50, 0x50, 0x58, 0x58, 0x64, 0x64, 0x8A, 0x8A, 0x9E, 0x9E, 0xA9, 0xA9, 0xB0,
+0xB0, 0xB7, 0xB7, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBB, 0xBB, 0xB6, 0xB6, 0xAF, 0xAF, 0xA7, 0xA7, 0x9C, 0x9C, 0x78,
+0x78, 0x61, 0x61, 0x57, 0x57, 0x4F, 0x4F, 0x49, 0x49, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x48, 0x48, 0x4E,
+0x4E, 0x56, 0x56, 0x60, 0x60, 0x72, 0x72, 0x9B, 0x9B, 0xA6, 0xA6, 0xAF, 0xAF, 0xB5, 0xB5, 0xBA,
+0xBA, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2, 0xB2, 0xAB, 0xAB, 0xA2, 0xA2, 0x93, 0x93, 0x68, 0x68, 0x5B,
+0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4A, 0x4A, 0x51, 0x51, 0x59,
+0x59, 0x65, 0x65, 0x8F, 0x8F, 0xA0, 0xA0, 0xAA, 0xAA, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC,
+0xBC, 0xB7, 0xB7, 0xB1, 0xB1, 0xA9, 0xA9, 0x9F, 0x9F, 0x8C, 0x8C, 0x64, 0x64, 0x58, 0x58, 0x50,
+0x50, 0x4A, 0x4A, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4B, 0x4B, 0x51, 0x51, 0x5A, 0x5A, 0x67,
+0x67, 0x91, 0x91, 0xA1, 0xA1, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB8,
+0xB8, 0xB1, 0xB1, 0xAA, 0xAA, 0xA0, 0xA0, 0x8E, 0x8E, 0x65, 0x65, 0x59, 0x59, 0x51, 0x51, 0x4A,
+0x4A, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x58, 0x58, 0x63, 0x63, 0x89,
+0x89, 0x9E, 0x9E, 0xA9, 0xA9, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBA, 0xBA, 0xB4,
+0xB4, 0xAD, 0xAD, 0xA5, 0xA5, 0x98, 0x98, 0x6D, 0x6D, 0x5D, 0x5D, 0x54, 0x54, 0x4C, 0x4C, 0x46,
+0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x46, 0x4C, 0x4C, 0x53, 0x53, 0x5C, 0x5C, 0x6A, 0x6A, 0x96,
+0x96, 0xA3, 0xA3, 0xAC, 0xAC, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB9, 0xB9, 0xB3,
+0xB3, 0xAC, 0xAC, 0xA2, 0xA2, 0x93, 0x93, 0x68, 0x68, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x45,
+0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x46, 0x4C, 0x4C, 0x53, 0x53, 0x5D, 0x5D, 0x6B, 0x6B, 0x97,
+0x97, 0xA4, 0xA4, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB9, 0xB9, 0xB3,
+0xB3, 0xAC, 0xAC, 0xA3, 0xA3, 0x94, 0x94, 0x69, 0x69, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x45,
+0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4A, 0x4A, 0x51, 0x51, 0x5A, 0x5A, 0x67, 0x67, 0x92,
+0x92, 0xA1, 0xA1, 0xAB, 0xAB, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBB, 0xBB, 0xB6,
+0xB6, 0xAF, 0xAF, 0xA7, 0xA7, 0x9C, 0x9C, 0x74, 0x74, 0x60, 0x60, 0x56, 0x56, 0x4E, 0x4E, 0x48,
+0x48, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47, 0x47, 0x4D, 0x4D, 0x55, 0x55, 0x5F, 0x5F, 0x70,
+0x70, 0x9A, 0x9A, 0xA6, 0xA6, 0xAE, 0xAE, 0xB5, 0xB5, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBA,
+0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA5, 0xA5, 0x98, 0x98, 0x6D, 0x6D, 0x5D, 0x5D, 0x54, 0x54, 0x4C,
+0x4C, 0x46, 0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47, 0x47, 0x4D, 0x4D, 0x55, 0x55, 0x5F,
+0x5F, 0x71, 0x71, 0x9B, 0x9B, 0xA6, 0xA6, 0xAF, 0xAF, 0xB6, 0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBB, 0xBB, 0xB5, 0xB5, 0xAF, 0xAF, 0xA6, 0xA6, 0x9A, 0x9A, 0x70, 0x70, 0x5F, 0x5F, 0x55,
+0x55, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x46, 0x4B, 0x4B, 0x53,
+0x53, 0x5C, 0x5C, 0x69, 0x69, 0x95, 0x95, 0xA3, 0xA3, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2, 0xB2, 0xAA, 0xAA, 0xA1, 0xA1, 0x8F, 0x8F, 0x65,
+0x65, 0x59, 0x59, 0x51, 0x51, 0x4A, 0x4A, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47,
+0x47, 0x4E, 0x4E, 0x55, 0x55, 0x60, 0x60, 0x73, 0x73, 0x9B, 0x9B, 0xA7, 0xA7, 0xAF, 0xAF, 0xB6,
+0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB7, 0xB7, 0xB1, 0xB1, 0xA9, 0xA9, 0x9E,
+0x9E, 0x89, 0x89, 0x63, 0x63, 0x58, 0x58, 0x4F, 0x4F, 0x49, 0x49, 0x43, 0x43, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x47, 0x47, 0x4E, 0x4E, 0x55, 0x55, 0x5F, 0x5F, 0x72, 0x72, 0x9B, 0x9B, 0xA7,
+0xA7, 0xAF, 0xAF, 0xB6, 0xB6, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2,
+0xB2, 0xAB, 0xAB, 0xA1, 0xA1, 0x90, 0x90, 0x65, 0x65, 0x59, 0x59, 0x51, 0x51, 0x4A, 0x4A, 0x44,
+0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x4B, 0x4B, 0x52, 0x52, 0x5B, 0x5B, 0x69,
+0x69, 0x94, 0x94, 0xA3, 0xA3, 0xAC, 0xAC, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBB, 0xBB, 0xB6, 0xB6, 0xAF, 0xAF, 0xA7, 0xA7, 0x9B, 0x9B, 0x72, 0x72, 0x5F, 0x5F, 0x55,
+0x55, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47, 0x47, 0x4D,
+0x4D, 0x54, 0x54, 0x5E, 0x5E, 0x6F, 0x6F, 0x99, 0x99, 0xA5, 0xA5, 0xAE, 0xAE, 0xB5, 0xB5, 0xBB,
+0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBB, 0xBB, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6, 0xA6, 0x9A,
+0x9A, 0x70, 0x70, 0x5F, 0x5F, 0x55, 0x55, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x46, 0x46, 0x4C, 0x4C, 0x54, 0x54, 0x5D, 0x5D, 0x6C, 0x6C, 0x97, 0x97, 0xA4,
+0xA4, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xB7,
+0xB7, 0xB1, 0xB1, 0xA9, 0xA9, 0x9E, 0x9E, 0x88, 0x88, 0x63, 0x63, 0x58, 0x58, 0x4F, 0x4F, 0x49,
+0x49, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x58,
+0x58, 0x63, 0x63, 0x89, 0x89, 0x9E, 0x9E, 0xA9, 0xA9, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6, 0xA6, 0x9A, 0x9A, 0x70,
+0x70, 0x5F, 0x5F, 0x55, 0x55, 0x4D, 0x4D, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x44, 0x44, 0x4A, 0x4A, 0x51, 0x51, 0x59, 0x59, 0x65, 0x65, 0x8E, 0x8E, 0xA0, 0xA0, 0xAA,
+0xAA, 0xB1, 0xB1, 0xB8, 0xB8, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB5,
+0xB5, 0xAF, 0xAF, 0xA6, 0xA6, 0x9B, 0x9B, 0x72, 0x72, 0x60, 0x60, 0x56, 0x56, 0x4E, 0x4E, 0x48,
+0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x4F, 0x4F, 0x57,
+0x57, 0x61, 0x61, 0x79, 0x79, 0x9D, 0x9D, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB8, 0xB8, 0xB2, 0xB2, 0xAA, 0xAA, 0xA0, 0xA0, 0x90,
+0x90, 0x66, 0x66, 0x5A, 0x5A, 0x51, 0x51, 0x4A, 0x4A, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x45, 0x45, 0x4B, 0x4B, 0x51, 0x51, 0x5A, 0x5A, 0x67, 0x67, 0x91, 0x91, 0xA1,
+0xA1, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xB7, 0xB7, 0xB1, 0xB1, 0xA9, 0xA9, 0x9E, 0x9E, 0x8B, 0x8B, 0x64, 0x64, 0x58, 0x58, 0x50,
+0x50, 0x4A, 0x4A, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x4A,
+0x4A, 0x51, 0x51, 0x5A, 0x5A, 0x66, 0x66, 0x8F, 0x8F, 0xA0, 0xA0, 0xAA, 0xAA, 0xB1, 0xB1, 0xB8,
+0xB8, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB8, 0xB8, 0xB2, 0xB2, 0xAB,
+0xAB, 0xA1, 0xA1, 0x92, 0x92, 0x68, 0x68, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x5F,
+0x5F, 0x71, 0x71, 0x9A, 0x9A, 0xA6, 0xA6, 0xAE, 0xAE, 0xB5, 0xB5, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB6, 0xB6, 0xB0, 0xB0, 0xA8, 0xA8, 0x9D, 0x9D, 0x87,
+0x87, 0x63, 0x63, 0x58, 0x58, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x49, 0x49, 0x4F, 0x4F, 0x57, 0x57, 0x61, 0x61, 0x75, 0x75, 0x9B,
+0x9B, 0xA7, 0xA7, 0xAF, 0xAF, 0xB5, 0xB5, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xB6, 0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0x9F, 0x9F, 0x8C, 0x8C, 0x64, 0x64, 0x59,
+0x59, 0x51, 0x51, 0x4A, 0x4A, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x47, 0x47, 0x4D, 0x4D, 0x54, 0x54, 0x5E, 0x5E, 0x6D, 0x6D, 0x97, 0x97, 0xA4, 0xA4, 0xAD,
+0xAD, 0xB3, 0xB3, 0xB9, 0xB9, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB9,
+0xB9, 0xB3, 0xB3, 0xAC, 0xAC, 0xA4, 0xA4, 0x97, 0x97, 0x6D, 0x6D, 0x5E, 0x5E, 0x55, 0x55, 0x4D,
+0x4D, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x49,
+0x49, 0x4F, 0x4F, 0x57, 0x57, 0x61, 0x61, 0x76, 0x76, 0x9B, 0x9B, 0xA6, 0xA6, 0xAE, 0xAE, 0xB5,
+0xB5, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB9, 0xB9, 0xB3,
+0xB3, 0xAC, 0xAC, 0xA3, 0xA3, 0x96, 0x96, 0x6B, 0x6B, 0x5D, 0x5D, 0x54, 0x54, 0x4D, 0x4D, 0x47,
+0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x49, 0x49, 0x4F,
+0x4F, 0x56, 0x56, 0x60, 0x60, 0x70, 0x70, 0x99, 0x99, 0xA5, 0xA5, 0xAD, 0xAD, 0xB4, 0xB4, 0xB9,
+0xB9, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE,
+0xAE, 0xA6, 0xA6, 0x9B, 0x9B, 0x76, 0x76, 0x62, 0x62, 0x57, 0x57, 0x50, 0x50, 0x49, 0x49, 0x44,
+0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x46, 0x46, 0x4B, 0x4B, 0x52,
+0x52, 0x5A, 0x5A, 0x66, 0x66, 0x8D, 0x8D, 0x9F, 0x9F, 0xA9, 0xA9, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB9, 0xB9, 0xB3, 0xB3, 0xAD,
+0xAD, 0xA4, 0xA4, 0x98, 0x98, 0x6F, 0x6F, 0x5F, 0x5F, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x46, 0x46, 0x4B, 0x4B, 0x52,
+0x52, 0x5A, 0x5A, 0x66, 0x66, 0x8D, 0x8D, 0x9F, 0x9F, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBA, 0xBA, 0xB4, 0xB4, 0xAE,
+0xAE, 0xA6, 0xA6, 0x9B, 0x9B, 0x76, 0x76, 0x62, 0x62, 0x58, 0x58, 0x50, 0x50, 0x4A, 0x4A, 0x45,
+0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x49, 0x49, 0x4F,
+0x4F, 0x57, 0x57, 0x60, 0x60, 0x6F, 0x6F, 0x98, 0x98, 0xA4, 0xA4, 0xAC, 0xAC, 0xB3, 0xB3, 0xB9,
+0xB9, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB8, 0xB8, 0xB2,
+0xB2, 0xAB, 0xAB, 0xA3, 0xA3, 0x96, 0x96, 0x6D, 0x6D, 0x5E, 0x5E, 0x55, 0x55, 0x4E, 0x4E, 0x48,
+0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x4A,
+0x4A, 0x50, 0x50, 0x57, 0x57, 0x61, 0x61, 0x72, 0x72, 0x99, 0x99, 0xA5, 0xA5, 0xAD, 0xAD, 0xB3,
+0xB3, 0xB9, 0xB9, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB8,
+0xB8, 0xB3, 0xB3, 0xAC, 0xAC, 0xA4, 0xA4, 0x98, 0x98, 0x70, 0x70, 0x60, 0x60, 0x57, 0x57, 0x4F,
+0x4F, 0x49, 0x49, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x48, 0x48, 0x4E, 0x4E, 0x54, 0x54, 0x5D, 0x5D, 0x6A, 0x6A, 0x94, 0x94, 0xA1, 0xA1, 0xAA,
+0xAA, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB6, 0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0xA0, 0xA0, 0x90, 0x90, 0x68, 0x68, 0x5C,
+0x5C, 0x53, 0x53, 0x4D, 0x4D, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x56, 0x56, 0x5F, 0x5F, 0x6E, 0x6E, 0x97,
+0x97, 0xA3, 0xA3, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB6, 0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0xA0, 0xA0, 0x91,
+0x91, 0x68, 0x68, 0x5C, 0x5C, 0x54, 0x54, 0x4D, 0x4D, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x4E, 0x4E, 0x54, 0x54, 0x5D,
+0x5D, 0x69, 0x69, 0x92, 0x92, 0xA0, 0xA0, 0xA9, 0xA9, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB8, 0xB8, 0xB3, 0xB3, 0xAC,
+0xAC, 0xA5, 0xA5, 0x9A, 0x9A, 0x75, 0x75, 0x62, 0x62, 0x58, 0x58, 0x51, 0x51, 0x4B, 0x4B, 0x46,
+0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x4A,
+0x4A, 0x50, 0x50, 0x56, 0x56, 0x5F, 0x5F, 0x6E, 0x6E, 0x96, 0x96, 0xA2, 0xA2, 0xAB, 0xAB, 0xB1,
+0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xB8, 0xB8, 0xB2, 0xB2, 0xAC, 0xAC, 0xA4, 0xA4, 0x9A, 0x9A, 0x74, 0x74, 0x62, 0x62, 0x58,
+0x58, 0x51, 0x51, 0x4B, 0x4B, 0x46, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x4E, 0x4E, 0x55, 0x55, 0x5D, 0x5D, 0x69, 0x69, 0x91,
+0x91, 0xA0, 0xA0, 0xA9, 0xA9, 0xAF, 0xAF, 0xB5, 0xB5, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB5, 0xB5, 0xAF, 0xAF, 0xA8, 0xA8, 0x9F,
+0x9F, 0x91, 0x91, 0x69, 0x69, 0x5D, 0x5D, 0x55, 0x55, 0x4E, 0x4E, 0x49, 0x49, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x46, 0x4A, 0x4A, 0x50,
+0x50, 0x57, 0x57, 0x60, 0x60, 0x6F, 0x6F, 0x96, 0x96, 0xA2, 0xA2, 0xAA, 0xAA, 0xB1, 0xB1, 0xB6,
+0xB6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9,
+0xB9, 0xB5, 0xB5, 0xAF, 0xAF, 0xA8, 0xA8, 0x9F, 0x9F, 0x91, 0x91, 0x69, 0x69, 0x5D, 0x5D, 0x55,
+0x55, 0x4E, 0x4E, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x45, 0x45, 0x4A, 0x4A, 0x4F, 0x4F, 0x55, 0x55, 0x5E, 0x5E, 0x6A, 0x6A, 0x91,
+0x91, 0x9F, 0x9F, 0xA8, 0xA8, 0xAF, 0xAF, 0xB5, 0xB5, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB7, 0xB7, 0xB2, 0xB2, 0xAB, 0xAB, 0xA4,
+0xA4, 0x99, 0x99, 0x75, 0x75, 0x63, 0x63, 0x59, 0x59, 0x52, 0x52, 0x4C, 0x4C, 0x47, 0x47, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x46, 0x4B,
+0x4B, 0x51, 0x51, 0x58, 0x58, 0x60, 0x60, 0x6E, 0x6E, 0x96, 0x96, 0xA2, 0xA2, 0xAA, 0xAA, 0xB0,
+0xB0, 0xB5, 0xB5, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB, 0xAB, 0xA3, 0xA3, 0x99, 0x99, 0x75, 0x75, 0x63,
+0x63, 0x59, 0x59, 0x52, 0x52, 0x4C, 0x4C, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x4A, 0x4A, 0x4F, 0x4F, 0x56, 0x56, 0x5E,
+0x5E, 0x6A, 0x6A, 0x91, 0x91, 0x9F, 0x9F, 0xA8, 0xA8, 0xAE, 0xAE, 0xB4, 0xB4, 0xB9, 0xB9, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4,
+0xB4, 0xAE, 0xAE, 0xA7, 0xA7, 0x9F, 0x9F, 0x91, 0x91, 0x6A, 0x6A, 0x5E, 0x5E, 0x56, 0x56, 0x4F,
+0x4F, 0x4A, 0x4A, 0x46, 0x46, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x47, 0x47, 0x4C, 0x4C, 0x51, 0x51, 0x58, 0x58, 0x61, 0x61, 0x6E, 0x6E, 0x95,
+0x95, 0xA1, 0xA1, 0xA9, 0xA9, 0xAF, 0xAF, 0xB5, 0xB5, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xB3, 0xB3, 0xAE, 0xAE, 0xA7,
+0xA7, 0x9F, 0x9F, 0x91, 0x91, 0x6A, 0x6A, 0x5F, 0x5F, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x46,
+0x46, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46,
+0x46, 0x4B, 0x4B, 0x50, 0x50, 0x56, 0x56, 0x5E, 0x5E, 0x69, 0x69, 0x8F, 0x8F, 0x9E, 0x9E, 0xA6,
+0xA6, 0xAD, 0xAD, 0xB3, 0xB3, 0xB7, 0xB7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB, 0xAB, 0xA4, 0xA4, 0x9A,
+0x9A, 0x7C, 0x7C, 0x65, 0x65, 0x5B, 0x5B, 0x54, 0x54, 0x4E, 0x4E, 0x49, 0x49, 0x45, 0x45, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x4C,
+0x4C, 0x51, 0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6C, 0x6C, 0x93, 0x93, 0x9F, 0x9F, 0xA7, 0xA7, 0xAE,
+0xAE, 0xB3, 0xB3, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB, 0xAB, 0xA4, 0xA4, 0x9B, 0x9B, 0x89,
+0x89, 0x66, 0x66, 0x5C, 0x5C, 0x55, 0x55, 0x4F, 0x4F, 0x4A, 0x4A, 0x46, 0x46, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x46, 0x4A, 0x4A, 0x4F,
+0x4F, 0x55, 0x55, 0x5C, 0x5C, 0x66, 0x66, 0x88, 0x88, 0x9B, 0x9B, 0xA4, 0xA4, 0xAB, 0xAB, 0xB1,
+0xB1, 0xB6, 0xB6, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9, 0xA9, 0xA1, 0xA1, 0x96, 0x96, 0x72,
+0x72, 0x63, 0x63, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x49, 0x49, 0x45, 0x45, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x4B, 0x4B, 0x50,
+0x50, 0x56, 0x56, 0x5D, 0x5D, 0x68, 0x68, 0x8B, 0x8B, 0x9C, 0x9C, 0xA5, 0xA5, 0xAB, 0xAB, 0xB1,
+0xB1, 0xB6, 0xB6, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xB9, 0xB9, 0xB4, 0xB4, 0xAF, 0xAF, 0xAA, 0xAA, 0xA2, 0xA2, 0x99, 0x99, 0x77,
+0x77, 0x65, 0x65, 0x5C, 0x5C, 0x55, 0x55, 0x4F, 0x4F, 0x4A, 0x4A, 0x46, 0x46, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x49, 0x49, 0x4E,
+0x4E, 0x53, 0x53, 0x5A, 0x5A, 0x62, 0x62, 0x71, 0x71, 0x96, 0x96, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE,
+0xAE, 0xB3, 0xB3, 0xB7, 0xB7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA8, 0xA8, 0xA0, 0xA0, 0x95,
+0x95, 0x70, 0x70, 0x62, 0x62, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x49, 0x49, 0x45, 0x45, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x46, 0x4A,
+0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x5A, 0x5A, 0x62, 0x62, 0x70, 0x70, 0x95, 0x95, 0xA0, 0xA0, 0xA7,
+0xA7, 0xAE, 0xAE, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4, 0xB4, 0xAF, 0xAF, 0xAA, 0xAA, 0xA3,
+0xA3, 0x99, 0x99, 0x86, 0x86, 0x66, 0x66, 0x5D, 0x5D, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x47,
+0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x47, 0x47, 0x4B, 0x4B, 0x50, 0x50, 0x56, 0x56, 0x5D, 0x5D, 0x66, 0x66, 0x83, 0x83, 0x99,
+0x99, 0xA2, 0xA2, 0xA9, 0xA9, 0xAF, 0xAF, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE,
+0xAE, 0xA9, 0xA9, 0xA2, 0xA2, 0x99, 0x99, 0x7B, 0x7B, 0x66, 0x66, 0x5D, 0x5D, 0x56, 0x56, 0x50,
+0x50, 0x4C, 0x4C, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x4B, 0x4B, 0x50, 0x50, 0x55, 0x55, 0x5B, 0x5B, 0x64,
+0x64, 0x73, 0x73, 0x96, 0x96, 0xA0, 0xA0, 0xA7, 0xA7, 0xAD, 0xAD, 0xB2, 0xB2, 0xB6, 0xB6, 0xBA,
+0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9,
+0xB9, 0xB5, 0xB5, 0xB1, 0xB1, 0xAB, 0xAB, 0xA5, 0xA5, 0x9E, 0x9E, 0x92, 0x92, 0x6D, 0x6D, 0x61,
+0x61, 0x5A, 0x5A, 0x54, 0x54, 0x4E, 0x4E, 0x4A, 0x4A, 0x46, 0x46, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x48, 0x48, 0x4C, 0x4C, 0x51,
+0x51, 0x56, 0x56, 0x5D, 0x5D, 0x66, 0x66, 0x7C, 0x7C, 0x98, 0x98, 0xA1, 0xA1, 0xA8, 0xA8, 0xAE,
+0xAE, 0xB2, 0xB2, 0xB7, 0xB7, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0xB9, 0xB5, 0xB5, 0xB1, 0xB1, 0xAC, 0xAC, 0xA6, 0xA6, 0x9E,
+0x9E, 0x93, 0x93, 0x6F, 0x6F, 0x63, 0x63, 0x5B, 0x5B, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x47,
+0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x47, 0x47, 0x4B, 0x4B, 0x4F, 0x4F, 0x54, 0x54, 0x5A, 0x5A, 0x62, 0x62, 0x6E, 0x6E, 0x92,
+0x92, 0x9E, 0x9E, 0xA5, 0xA5, 0xAB, 0xAB, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3,
+0xB3, 0xAF, 0xAF, 0xAA, 0xAA, 0xA4, 0xA4, 0x9C, 0x9C, 0x8F, 0x8F, 0x6B, 0x6B, 0x61, 0x61, 0x59,
+0x59, 0x54, 0x54, 0x4F, 0x4F, 0x4B, 0x4B, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x48, 0x48, 0x4B, 0x4B, 0x50, 0x50, 0x54,
+0x54, 0x5A, 0x5A, 0x62, 0x62, 0x6D, 0x6D, 0x91, 0x91, 0x9D, 0x9D, 0xA4, 0xA4, 0xAA, 0xAA, 0xAF,
+0xAF, 0xB4, 0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB8, 0xB8, 0xB4, 0xB4, 0xB0, 0xB0, 0xAB, 0xAB, 0xA6, 0xA6, 0x9F,
+0x9F, 0x95, 0x95, 0x72, 0x72, 0x64, 0x64, 0x5C, 0x5C, 0x56, 0x56, 0x51, 0x51, 0x4D, 0x4D, 0x49,
+0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x51, 0x51, 0x57, 0x57, 0x5D, 0x5D, 0x65, 0x65, 0x74,
+0x74, 0x95, 0x95, 0x9F, 0x9F, 0xA6, 0xA6, 0xAB, 0xAB, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB7,
+0xB7, 0xB4, 0xB4, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5, 0xA5, 0x9E, 0x9E, 0x94, 0x94, 0x72, 0x72, 0x65,
+0x65, 0x5D, 0x5D, 0x57, 0x57, 0x51, 0x51, 0x4D, 0x4D, 0x49, 0x49, 0x46, 0x46, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x49, 0x49, 0x4C,
+0x4C, 0x50, 0x50, 0x55, 0x55, 0x5B, 0x5B, 0x63, 0x63, 0x6E, 0x6E, 0x91, 0x91, 0x9C, 0x9C, 0xA3,
+0xA3, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB6, 0xB6, 0xB2, 0xB2, 0xAD,
+0xAD, 0xA9, 0xA9, 0xA3, 0xA3, 0x9B, 0x9B, 0x8E, 0x8E, 0x6C, 0x6C, 0x62, 0x62, 0x5B, 0x5B, 0x55,
+0x55, 0x50, 0x50, 0x4C, 0x4C, 0x49, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x51, 0x51, 0x56,
+0x56, 0x5C, 0x5C, 0x63, 0x63, 0x6F, 0x6F, 0x91, 0x91, 0x9C, 0x9C, 0xA3, 0xA3, 0xA9, 0xA9, 0xAE,
+0xAE, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB6, 0xB6, 0xB2, 0xB2, 0xAE, 0xAE, 0xAA, 0xAA, 0xA4,
+0xA4, 0x9D, 0x9D, 0x93, 0x93, 0x71, 0x71, 0x65, 0x65, 0x5D, 0x5D, 0x57, 0x57, 0x52, 0x52, 0x4E,
+0x4E, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x48, 0x48, 0x4B, 0x4B, 0x4F, 0x4F, 0x53, 0x53, 0x59, 0x59, 0x5F,
+0x5F, 0x67, 0x67, 0x77, 0x77, 0x96, 0x96, 0x9F, 0x9F, 0xA5, 0xA5, 0xAA, 0xAA, 0xAF, 0xAF, 0xB3,
+0xB3, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xB2, 0xB2, 0xAE, 0xAE, 0xA9, 0xA9, 0xA3, 0xA3, 0x9C,
+0x9C, 0x92, 0x92, 0x70, 0x70, 0x65, 0x65, 0x5D, 0x5D, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4B,
+0x4B, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x48, 0x48, 0x4B, 0x4B, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x65,
+0x65, 0x71, 0x71, 0x92, 0x92, 0x9C, 0x9C, 0xA3, 0xA3, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB, 0xAB, 0xA6, 0xA6, 0xA1, 0xA1, 0x99,
+0x99, 0x8B, 0x8B, 0x6B, 0x6B, 0x62, 0x62, 0x5B, 0x5B, 0x56, 0x56, 0x51, 0x51, 0x4D, 0x4D, 0x4A,
+0x4A, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x46, 0x46, 0x48, 0x48, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x65,
+0x65, 0x71, 0x71, 0x92, 0x92, 0x9C, 0x9C, 0xA3, 0xA3, 0xA8, 0xA8, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4,
+0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xB7, 0xB7, 0xB4, 0xB4, 0xB0, 0xB0, 0xAC, 0xAC, 0xA8, 0xA8, 0xA2, 0xA2, 0x9B,
+0x9B, 0x91, 0x91, 0x70, 0x70, 0x65, 0x65, 0x5D, 0x5D, 0x58, 0x58, 0x53, 0x53, 0x4F, 0x4F, 0x4C,
+0x4C, 0x49, 0x49, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x51, 0x51, 0x55, 0x55, 0x5A, 0x5A, 0x61,
+0x61, 0x69, 0x69, 0x7E, 0x7E, 0x96, 0x96, 0x9E, 0x9E, 0xA4, 0xA4, 0xA9, 0xA9, 0xAE, 0xAE, 0xB1,
+0xB1, 0xB5, 0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB6, 0xB6, 0xB3, 0xB3, 0xB0, 0xB0, 0xAC, 0xAC, 0xA7, 0xA7, 0xA2,
+0xA2, 0x9B, 0x9B, 0x91, 0x91, 0x70, 0x70, 0x65, 0x65, 0x5E, 0x5E, 0x58, 0x58, 0x54, 0x54, 0x50,
+0x50, 0x4C, 0x4C, 0x49, 0x49, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x54, 0x54, 0x59,
+0x59, 0x5F, 0x5F, 0x66, 0x66, 0x71, 0x71, 0x91, 0x91, 0x9B, 0x9B, 0xA2, 0xA2, 0xA7, 0xA7, 0xAC,
+0xAC, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAE, 0xAE, 0xAA,
+0xAA, 0xA5, 0xA5, 0xA0, 0xA0, 0x98, 0x98, 0x8C, 0x8C, 0x6C, 0x6C, 0x63, 0x63, 0x5D, 0x5D, 0x58,
+0x58, 0x53, 0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x51,
+0x51, 0x54, 0x54, 0x59, 0x59, 0x5E, 0x5E, 0x65, 0x65, 0x70, 0x70, 0x90, 0x90, 0x9A, 0x9A, 0xA1,
+0xA1, 0xA6, 0xA6, 0xAB, 0xAB, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5, 0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xB2,
+0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9C, 0x9C, 0x93, 0x93, 0x74, 0x74, 0x68,
+0x68, 0x60, 0x60, 0x5B, 0x5B, 0x56, 0x56, 0x52, 0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x46,
+0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x48,
+0x48, 0x4B, 0x4B, 0x4E, 0x4E, 0x52, 0x52, 0x56, 0x56, 0x5A, 0x5A, 0x60, 0x60, 0x67, 0x67, 0x72,
+0x72, 0x91, 0x91, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5,
+0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA7, 0xA7, 0xA3, 0xA3, 0x9D,
+0x9D, 0x95, 0x95, 0x7C, 0x7C, 0x6A, 0x6A, 0x62, 0x62, 0x5C, 0x5C, 0x57, 0x57, 0x53, 0x53, 0x50,
+0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x54, 0x54, 0x58,
+0x58, 0x5D, 0x5D, 0x63, 0x63, 0x6B, 0x6B, 0x87, 0x87, 0x96, 0x96, 0x9D, 0x9D, 0xA3, 0xA3, 0xA8,
+0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE,
+0xAE, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9C, 0x9C, 0x94, 0x94, 0x79, 0x79, 0x6A, 0x6A, 0x62,
+0x62, 0x5C, 0x5C, 0x58, 0x58, 0x54, 0x54, 0x50, 0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46,
+0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A,
+0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5C, 0x5C, 0x61, 0x61, 0x69, 0x69, 0x75,
+0x75, 0x92, 0x92, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAD, 0xAD, 0xB1, 0xB1, 0xB3,
+0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9, 0xA9, 0xA5, 0xA5, 0xA0,
+0xA0, 0x9A, 0x9A, 0x90, 0x90, 0x72, 0x72, 0x68, 0x68, 0x61, 0x61, 0x5C, 0x5C, 0x57, 0x57, 0x53,
+0x53, 0x50, 0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x48, 0x48, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x54,
+0x54, 0x57, 0x57, 0x5C, 0x5C, 0x61, 0x61, 0x68, 0x68, 0x73, 0x73, 0x90, 0x90, 0x99, 0x99, 0xA0,
+0xA0, 0xA4, 0xA4, 0xA9, 0xA9, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3,
+0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA6, 0xA6, 0xA2, 0xA2, 0x9C, 0x9C, 0x95, 0x95, 0x88,
+0x88, 0x6D, 0x6D, 0x64, 0x64, 0x5F, 0x5F, 0x5A, 0x5A, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4D,
+0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x47, 0x47, 0x49, 0x49, 0x4C, 0x4C, 0x4E, 0x4E, 0x51, 0x51, 0x55, 0x55, 0x58, 0x58, 0x5D,
+0x5D, 0x62, 0x62, 0x69, 0x69, 0x75, 0x75, 0x91, 0x91, 0x9A, 0x9A, 0xA0, 0xA0, 0xA4, 0xA4, 0xA8,
+0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE,
+0xAE, 0xAB, 0xAB, 0xA7, 0xA7, 0xA3, 0xA3, 0x9E, 0x9E, 0x97, 0x97, 0x8E, 0x8E, 0x70, 0x70, 0x67,
+0x67, 0x61, 0x61, 0x5C, 0x5C, 0x58, 0x58, 0x54, 0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x49,
+0x49, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x49,
+0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x56, 0x56, 0x5A, 0x5A, 0x5F, 0x5F, 0x64,
+0x64, 0x6C, 0x6C, 0x84, 0x84, 0x94, 0x94, 0x9B, 0x9B, 0xA1, 0xA1, 0xA5, 0xA5, 0xA9, 0xA9, 0xAC,
+0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xAA,
+0xAA, 0xA7, 0xA7, 0xA3, 0xA3, 0x9E, 0x9E, 0x98, 0x98, 0x8F, 0x8F, 0x72, 0x72, 0x68, 0x68, 0x62,
+0x62, 0x5D, 0x5D, 0x59, 0x59, 0x55, 0x55, 0x52, 0x52, 0x4F, 0x4F, 0x4D, 0x4D, 0x4A, 0x4A, 0x48,
+0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x4B,
+0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x55, 0x55, 0x59, 0x59, 0x5D, 0x5D, 0x62, 0x62, 0x68,
+0x68, 0x71, 0x71, 0x8E, 0x8E, 0x97, 0x97, 0x9D, 0x9D, 0xA2, 0xA2, 0xA6, 0xA6, 0xAA, 0xAA, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAD, 0xAD, 0xA9,
+0xA9, 0xA6, 0xA6, 0xA2, 0xA2, 0x9D, 0x9D, 0x97, 0x97, 0x8E, 0x8E, 0x72, 0x72, 0x68, 0x68, 0x62,
+0x62, 0x5D, 0x5D, 0x59, 0x59, 0x56, 0x56, 0x53, 0x53, 0x50, 0x50, 0x4D, 0x4D, 0x4B, 0x4B, 0x49,
+0x49, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4B,
+0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x55, 0x55, 0x58, 0x58, 0x5C, 0x5C, 0x60, 0x60, 0x66,
+0x66, 0x6E, 0x6E, 0x87, 0x87, 0x94, 0x94, 0x9B, 0x9B, 0xA0, 0xA0, 0xA4, 0xA4, 0xA8, 0xA8, 0xAB,
+0xAB, 0xAE, 0xAE, 0xB0, 0xB0, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAE, 0xAE, 0xAB,
+0xAB, 0xA8, 0xA8, 0xA4, 0xA4, 0xA0, 0xA0, 0x9B, 0x9B, 0x95, 0x95, 0x8A, 0x8A, 0x6F, 0x6F, 0x67,
+0x67, 0x61, 0x61, 0x5D, 0x5D, 0x59, 0x59, 0x56, 0x56, 0x53, 0x53, 0x50, 0x50, 0x4E, 0x4E, 0x4C,
+0x4C, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x48, 0x48, 0x49,
+0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x58, 0x58, 0x5C, 0x5C, 0x60,
+0x60, 0x65, 0x65, 0x6C, 0x6C, 0x7C, 0x7C, 0x92, 0x92, 0x99, 0x99, 0x9E, 0x9E, 0xA3, 0xA3, 0xA6,
+0xA6, 0xAA, 0xAA, 0xAD, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5, 0xB5, 0xB7, 0xB7, 0xB8,
+0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB3, 0xB3, 0xB1, 0xB1, 0xAF,
+0xAF, 0xAC, 0xAC, 0xA9, 0xA9, 0xA6, 0xA6, 0xA2, 0xA2, 0x9E, 0x9E, 0x99, 0x99, 0x91, 0x91, 0x79,
+0x79, 0x6C, 0x6C, 0x65, 0x65, 0x60, 0x60, 0x5C, 0x5C, 0x58, 0x58, 0x55, 0x55, 0x53, 0x53, 0x50,
+0x50, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47,
+0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x53, 0x53, 0x56, 0x56, 0x59,
+0x59, 0x5C, 0x5C, 0x60, 0x60, 0x65, 0x65, 0x6C, 0x6C, 0x7A, 0x7A, 0x91, 0x91, 0x99, 0x99, 0x9E,
+0x9E, 0xA2, 0xA2, 0xA6, 0xA6, 0xA9, 0xA9, 0xAC, 0xAC, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4,
+0xB4, 0xB6, 0xB6, 0xB7, 0xB7, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3,
+0xB3, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD, 0xAD, 0xAA, 0xAA, 0xA7, 0xA7, 0xA3, 0xA3, 0xA0, 0xA0, 0x9B,
+0x9B, 0x95, 0x95, 0x8C, 0x8C, 0x71, 0x71, 0x69, 0x69, 0x63, 0x63, 0x5F, 0x5F, 0x5B, 0x5B, 0x58,
+0x58, 0x55, 0x55, 0x52, 0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x47,
+0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x51,
+0x51, 0x54, 0x54, 0x57, 0x57, 0x5A, 0x5A, 0x5D, 0x5D, 0x61, 0x61, 0x66, 0x66, 0x6D, 0x6D, 0x7D,
+0x7D, 0x92, 0x92, 0x98, 0x98, 0x9D, 0x9D, 0xA1, 0xA1, 0xA5, 0xA5, 0xA8, 0xA8, 0xAB, 0xAB, 0xAD,
+0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB4, 0xB4, 0xB3, 0xB3, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD, 0xAD, 0xAA, 0xAA, 0xA7,
+0xA7, 0xA4, 0xA4, 0xA1, 0xA1, 0x9C, 0x9C, 0x97, 0x97, 0x90, 0x90, 0x76, 0x76, 0x6C, 0x6C, 0x66,
+0x66, 0x61, 0x61, 0x5D, 0x5D, 0x59, 0x59, 0x57, 0x57, 0x54, 0x54, 0x52, 0x52, 0x4F, 0x4F, 0x4D,
+0x4D, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x4B,
+0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x53, 0x53, 0x55, 0x55, 0x58, 0x58, 0x5B, 0x5B, 0x5F,
+0x5F, 0x63, 0x63, 0x68, 0x68, 0x6F, 0x6F, 0x87, 0x87, 0x93, 0x93, 0x99, 0x99, 0x9E, 0x9E, 0xA2,
+0xA2, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA, 0xAA, 0xAD, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4,
+0xB4, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB4, 0xB4, 0xB2, 0xB2, 0xB0,
+0xB0, 0xAF, 0xAF, 0xAC, 0xAC, 0xAA, 0xAA, 0xA7, 0xA7, 0xA4, 0xA4, 0xA1, 0xA1, 0x9D, 0x9D, 0x98,
+0x98, 0x92, 0x92, 0x85, 0x85, 0x6E, 0x6E, 0x68, 0x68, 0x63, 0x63, 0x5F, 0x5F, 0x5B, 0x5B, 0x58,
+0x58, 0x56, 0x56, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4F, 0x4D, 0x4D, 0x4C, 0x4C, 0x4A, 0x4A, 0x49,
+0x49, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x52,
+0x52, 0x54, 0x54, 0x57, 0x57, 0x59, 0x59, 0x5C, 0x5C, 0x60, 0x60, 0x64, 0x64, 0x6A, 0x6A, 0x71,
+0x71, 0x8B, 0x8B, 0x94, 0x94, 0x99, 0x99, 0x9E, 0x9E, 0xA2, 0xA2, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA,
+0xAA, 0xAC, 0xAC, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xB2, 0xB2, 0xB0, 0xB0, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA,
+0xAA, 0xA7, 0xA7, 0xA4, 0xA4, 0xA1, 0xA1, 0x9D, 0x9D, 0x99, 0x99, 0x93, 0x93, 0x8A, 0x8A, 0x71,
+0x71, 0x6A, 0x6A, 0x64, 0x64, 0x60, 0x60, 0x5D, 0x5D, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x52,
+0x52, 0x50, 0x50, 0x4F, 0x4F, 0x4D, 0x4D, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x47,
+0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x4A,
+0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x58,
+0x58, 0x5B, 0x5B, 0x5E, 0x5E, 0x62, 0x62, 0x66, 0x66, 0x6C, 0x6C, 0x75, 0x75, 0x8E, 0x8E, 0x95,
+0x95, 0x9A, 0x9A, 0x9E, 0x9E, 0xA2, 0xA2, 0xA5, 0xA5, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE,
+0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8,
+0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA7, 0xA7, 0xA4,
+0xA4, 0xA1, 0xA1, 0x9D, 0x9D, 0x99, 0x99, 0x94, 0x94, 0x8C, 0x8C, 0x73, 0x73, 0x6B, 0x6B, 0x66,
+0x66, 0x62, 0x62, 0x5E, 0x5E, 0x5B, 0x5B, 0x58, 0x58, 0x56, 0x56, 0x54, 0x54, 0x52, 0x52, 0x50,
+0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x47,
+0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C,
+0x4C, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5D,
+0x5D, 0x60, 0x60, 0x64, 0x64, 0x69, 0x69, 0x6F, 0x6F, 0x7E, 0x7E, 0x90, 0x90, 0x96, 0x96, 0x9B,
+0x9B, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE, 0xAE, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB3, 0xB3, 0xB5, 0xB5, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2,
+0xB2, 0xB0, 0xB0, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA6, 0xA6, 0xA4, 0xA4, 0xA1,
+0xA1, 0x9D, 0x9D, 0x99, 0x99, 0x94, 0x94, 0x8D, 0x8D, 0x75, 0x75, 0x6C, 0x6C, 0x67, 0x67, 0x63,
+0x63, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F,
+0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x48,
+0x48, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+0x47, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4E,
+0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x55, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5C, 0x5C, 0x5F,
+0x5F, 0x62, 0x62, 0x66, 0x66, 0x6B, 0x6B, 0x72, 0x72, 0x8A, 0x8A, 0x92, 0x92, 0x98, 0x98, 0x9C,
+0x9C, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA7, 0xA7, 0xAA, 0xAA, 0xAB, 0xAB, 0xAD, 0xAD, 0xAF,
+0xAF, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7,
+0xB7, 0xB7, 0xB7, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1,
+0xB1, 0xAF, 0xAF, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA8, 0xA8, 0xA6, 0xA6, 0xA3, 0xA3, 0xA0,
+0xA0, 0x9D, 0x9D, 0x99, 0x99, 0x95, 0x95, 0x8E, 0x8E, 0x77, 0x77, 0x6E, 0x6E, 0x68, 0x68, 0x64,
+0x64, 0x60, 0x60, 0x5D, 0x5D, 0x5B, 0x5B, 0x58, 0x58, 0x56, 0x56, 0x54, 0x54, 0x52, 0x52, 0x51,
+0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x49,
+0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E,
+0x4E, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x59, 0x59, 0x5B, 0x5B, 0x5E,
+0x5E, 0x61, 0x61, 0x64, 0x64, 0x68, 0x68, 0x6E, 0x6E, 0x77, 0x77, 0x8E, 0x8E, 0x94, 0x94, 0x99,
+0x99, 0x9D, 0x9D, 0xA0, 0xA0, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7, 0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xAD,
+0xAD, 0xAE, 0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1,
+0xB1, 0xB0, 0xB0, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA7, 0xA7, 0xA5, 0xA5, 0xA3,
+0xA3, 0xA0, 0xA0, 0x9D, 0x9D, 0x99, 0x99, 0x95, 0x95, 0x8E, 0x8E, 0x7A, 0x7A, 0x6F, 0x6F, 0x69,
+0x69, 0x65, 0x65, 0x62, 0x62, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x54,
+0x54, 0x52, 0x52, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D,
+0x4D, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x58, 0x58, 0x5A,
+0x5A, 0x5D, 0x5D, 0x60, 0x60, 0x63, 0x63, 0x66, 0x66, 0x6B, 0x6B, 0x71, 0x71, 0x86, 0x86, 0x90,
+0x90, 0x95, 0x95, 0x9A, 0x9A, 0x9D, 0x9D, 0xA0, 0xA0, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7, 0xA7, 0xA9,
+0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB3,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2,
+0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAD, 0xAD, 0xAC, 0xAC, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7,
+0xA7, 0xA4, 0xA4, 0xA2, 0xA2, 0x9F, 0x9F, 0x9D, 0x9D, 0x99, 0x99, 0x95, 0x95, 0x8F, 0x8F, 0x83,
+0x83, 0x70, 0x70, 0x6B, 0x6B, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5D, 0x5D, 0x5B, 0x5B, 0x59,
+0x59, 0x57, 0x57, 0x55, 0x55, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x54, 0x54, 0x56,
+0x56, 0x58, 0x58, 0x5A, 0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x64, 0x64, 0x68, 0x68, 0x6D,
+0x6D, 0x74, 0x74, 0x8A, 0x8A, 0x91, 0x91, 0x96, 0x96, 0x9A, 0x9A, 0x9D, 0x9D, 0xA0, 0xA0, 0xA2,
+0xA2, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xAA, 0xAA, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF,
+0xAF, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0x9F, 0x9F, 0x9C, 0x9C, 0x99,
+0x99, 0x95, 0x95, 0x90, 0x90, 0x88, 0x88, 0x73, 0x73, 0x6C, 0x6C, 0x68, 0x68, 0x64, 0x64, 0x61,
+0x61, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x58, 0x58, 0x57, 0x57, 0x55, 0x55, 0x54, 0x54, 0x52,
+0x52, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C,
+0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x52,
+0x52, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x60,
+0x60, 0x63, 0x63, 0x66, 0x66, 0x6A, 0x6A, 0x6F, 0x6F, 0x76, 0x76, 0x8B, 0x8B, 0x92, 0x92, 0x96,
+0x96, 0x9A, 0x9A, 0x9D, 0x9D, 0xA0, 0xA0, 0xA2, 0xA2, 0xA4, 0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9,
+0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF,
+0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7, 0xA7, 0xA6, 0xA6, 0xA4,
+0xA4, 0xA2, 0xA2, 0x9F, 0x9F, 0x9D, 0x9D, 0x9A, 0x9A, 0x96, 0x96, 0x92, 0x92, 0x8B, 0x8B, 0x76,
+0x76, 0x6F, 0x6F, 0x6A, 0x6A, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5A,
+0x5A, 0x58, 0x58, 0x57, 0x57, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x57,
+0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F, 0x5F, 0x61, 0x61, 0x64, 0x64, 0x67, 0x67, 0x6B,
+0x6B, 0x70, 0x70, 0x78, 0x78, 0x8C, 0x8C, 0x92, 0x92, 0x96, 0x96, 0x9A, 0x9A, 0x9D, 0x9D, 0x9F,
+0x9F, 0xA1, 0xA1, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA7, 0xA7, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D,
+0x9D, 0x9A, 0x9A, 0x97, 0x97, 0x93, 0x93, 0x8E, 0x8E, 0x82, 0x82, 0x71, 0x71, 0x6C, 0x6C, 0x68,
+0x68, 0x65, 0x65, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5A, 0x5A, 0x58, 0x58, 0x57,
+0x57, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51,
+0x51, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5C,
+0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x62, 0x62, 0x65, 0x65, 0x68, 0x68, 0x6C, 0x6C, 0x71, 0x71, 0x7A,
+0x7A, 0x8C, 0x8C, 0x92, 0x92, 0x96, 0x96, 0x99, 0x99, 0x9C, 0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA2,
+0xA2, 0xA4, 0xA4, 0xA6, 0xA6, 0xA7, 0xA7, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x98,
+0x98, 0x94, 0x94, 0x90, 0x90, 0x89, 0x89, 0x76, 0x76, 0x6F, 0x6F, 0x6B, 0x6B, 0x67, 0x67, 0x64,
+0x64, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x57, 0x57, 0x56,
+0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F,
+0x5F, 0x61, 0x61, 0x63, 0x63, 0x66, 0x66, 0x69, 0x69, 0x6C, 0x6C, 0x71, 0x71, 0x79, 0x79, 0x8C,
+0x8C, 0x91, 0x91, 0x95, 0x95, 0x98, 0x98, 0x9B, 0x9B, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1, 0xA1, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9B, 0x9B, 0x99, 0x99, 0x96,
+0x96, 0x92, 0x92, 0x8E, 0x8E, 0x85, 0x85, 0x73, 0x73, 0x6E, 0x6E, 0x6A, 0x6A, 0x67, 0x67, 0x64,
+0x64, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x57,
+0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x5F,
+0x5F, 0x61, 0x61, 0x63, 0x63, 0x66, 0x66, 0x69, 0x69, 0x6C, 0x6C, 0x70, 0x70, 0x77, 0x77, 0x8A,
+0x8A, 0x90, 0x90, 0x94, 0x94, 0x97, 0x97, 0x99, 0x99, 0x9C, 0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA3, 0xA3, 0xA4, 0xA4, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA2, 0xA2, 0xA0, 0xA0, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A, 0x9A, 0x97,
+0x97, 0x94, 0x94, 0x91, 0x91, 0x8C, 0x8C, 0x7C, 0x7C, 0x72, 0x72, 0x6E, 0x6E, 0x6A, 0x6A, 0x67,
+0x67, 0x65, 0x65, 0x63, 0x63, 0x61, 0x61, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x5E,
+0x5E, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x66, 0x66, 0x68, 0x68, 0x6B, 0x6B, 0x6F, 0x6F, 0x74,
+0x74, 0x85, 0x85, 0x8D, 0x8D, 0x91, 0x91, 0x95, 0x95, 0x98, 0x98, 0x9A, 0x9A, 0x9C, 0x9C, 0x9E,
+0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA6, 0xA6, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9B,
+0x9B, 0x99, 0x99, 0x97, 0x97, 0x94, 0x94, 0x90, 0x90, 0x8B, 0x8B, 0x7C, 0x7C, 0x73, 0x73, 0x6E,
+0x6E, 0x6B, 0x6B, 0x68, 0x68, 0x66, 0x66, 0x64, 0x64, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55,
+0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55,
+0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x68, 0x68, 0x6A,
+0x6A, 0x6D, 0x6D, 0x71, 0x71, 0x77, 0x77, 0x89, 0x89, 0x8E, 0x8E, 0x92, 0x92, 0x95, 0x95, 0x98,
+0x98, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F,
+0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x90, 0x90, 0x8C,
+0x8C, 0x85, 0x85, 0x75, 0x75, 0x70, 0x70, 0x6C, 0x6C, 0x6A, 0x6A, 0x67, 0x67, 0x65, 0x65, 0x63,
+0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61, 0x61, 0x63,
+0x63, 0x65, 0x65, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x72, 0x72, 0x79, 0x79, 0x89,
+0x89, 0x8E, 0x8E, 0x92, 0x92, 0x94, 0x94, 0x97, 0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A, 0x9A, 0x98,
+0x98, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8E, 0x8E, 0x89, 0x89, 0x79, 0x79, 0x72, 0x72, 0x6F,
+0x6F, 0x6C, 0x6C, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x62, 0x62, 0x61, 0x61, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58,
+0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57,
+0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x66, 0x66, 0x67, 0x67, 0x6A,
+0x6A, 0x6C, 0x6C, 0x6F, 0x6F, 0x72, 0x72, 0x78, 0x78, 0x88, 0x88, 0x8D, 0x8D, 0x91, 0x91, 0x93,
+0x93, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0,
+0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x95, 0x95, 0x93,
+0x93, 0x90, 0x90, 0x8C, 0x8C, 0x87, 0x87, 0x77, 0x77, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A,
+0x6A, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60,
+0x60, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E,
+0x6E, 0x71, 0x71, 0x75, 0x75, 0x83, 0x83, 0x8B, 0x8B, 0x8E, 0x8E, 0x91, 0x91, 0x94, 0x94, 0x96,
+0x96, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x90,
+0x90, 0x8C, 0x8C, 0x88, 0x88, 0x79, 0x79, 0x73, 0x73, 0x70, 0x70, 0x6D, 0x6D, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70,
+0x70, 0x73, 0x73, 0x77, 0x77, 0x85, 0x85, 0x8B, 0x8B, 0x8E, 0x8E, 0x91, 0x91, 0x93, 0x93, 0x95,
+0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x90,
+0x90, 0x8D, 0x8D, 0x8A, 0x8A, 0x82, 0x82, 0x76, 0x76, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B,
+0x6B, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63,
+0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E,
+0x6E, 0x70, 0x70, 0x73, 0x73, 0x77, 0x77, 0x84, 0x84, 0x8A, 0x8A, 0x8D, 0x8D, 0x90, 0x90, 0x92,
+0x92, 0x94, 0x94, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x93,
+0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x7C, 0x7C, 0x76, 0x76, 0x72, 0x72, 0x70,
+0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64,
+0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6B,
+0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x72, 0x72, 0x75, 0x75, 0x7A, 0x7A, 0x87, 0x87, 0x8B,
+0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98,
+0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x95, 0x95, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x89, 0x89, 0x83,
+0x83, 0x77, 0x77, 0x74, 0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62,
+0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67,
+0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F, 0x6F, 0x71, 0x71, 0x73,
+0x73, 0x76, 0x76, 0x7B, 0x7B, 0x87, 0x87, 0x8A, 0x8A, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99,
+0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x90,
+0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x87, 0x87, 0x7C, 0x7C, 0x77, 0x77, 0x74, 0x74, 0x72,
+0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68,
+0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63,
+0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x76, 0x76, 0x79, 0x79, 0x84,
+0x84, 0x88, 0x88, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x93,
+0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95,
+0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8D, 0x8D, 0x8C,
+0x8C, 0x8A, 0x8A, 0x87, 0x87, 0x7E, 0x7E, 0x78, 0x78, 0x75, 0x75, 0x73, 0x73, 0x71, 0x71, 0x70,
+0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68,
+0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68,
+0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F,
+0x6F, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x74, 0x74, 0x77, 0x77, 0x7A, 0x7A, 0x84, 0x84, 0x88,
+0x88, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97,
+0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8A,
+0x8A, 0x88, 0x88, 0x85, 0x85, 0x7B, 0x7B, 0x78, 0x78, 0x76, 0x76, 0x74, 0x74, 0x72, 0x72, 0x71,
+0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A,
+0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A,
+0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x70,
+0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x77, 0x77, 0x79, 0x79, 0x7D, 0x7D, 0x86,
+0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8D, 0x8D, 0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x90,
+0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92,
+0x92, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B,
+0x8B, 0x89, 0x89, 0x88, 0x88, 0x85, 0x85, 0x7E, 0x7E, 0x79, 0x79, 0x77, 0x77, 0x76, 0x76, 0x74,
+0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x70,
+0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x78, 0x78, 0x7A,
+0x7A, 0x7D, 0x7D, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91,
+0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90,
+0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x86, 0x86, 0x84, 0x84, 0x7D, 0x7D, 0x7A,
+0x7A, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x72,
+0x72, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71,
+0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
+0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7B, 0x7B, 0x81, 0x81, 0x84, 0x84, 0x86, 0x86, 0x87,
+0x87, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x86,
+0x86, 0x85, 0x85, 0x84, 0x84, 0x82, 0x82, 0x7C, 0x7C, 0x7B, 0x7B, 0x79, 0x79, 0x78, 0x78, 0x78,
+0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76,
+0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B,
+0x7B, 0x7C, 0x7C, 0x7E, 0x7E, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86,
+0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82,
+0x82, 0x81, 0x81, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D,
+0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C,
+0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C,
+0x7C, 0x7E, 0x7E, 0x81, 0x81, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85,
+0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x84,
+0x84, 0x83, 0x83, 0x81, 0x81, 0x7D, 0x7D, 0x7B, 0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x78,
+0x78, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74,
+0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79,
+0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7D, 0x7D, 0x83, 0x83, 0x84, 0x84, 0x86, 0x86, 0x87, 0x87, 0x88,
+0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x89,
+0x89, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x84, 0x84, 0x7E, 0x7E, 0x7B, 0x7B, 0x79, 0x79, 0x78,
+0x78, 0x77, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x72,
+0x72, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F,
+0x6F, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x74,
+0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x79, 0x79, 0x7B, 0x7B, 0x81, 0x81, 0x85,
+0x85, 0x86, 0x86, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x86,
+0x86, 0x83, 0x83, 0x7B, 0x7B, 0x79, 0x79, 0x77, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73,
+0x73, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E,
+0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74,
+0x74, 0x76, 0x76, 0x77, 0x77, 0x79, 0x79, 0x7C, 0x7C, 0x84, 0x84, 0x86, 0x86, 0x88, 0x88, 0x8A,
+0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x90,
+0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x88, 0x88, 0x85, 0x85, 0x7D,
+0x7D, 0x79, 0x79, 0x77, 0x77, 0x75, 0x75, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70,
+0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x74,
+0x74, 0x75, 0x75, 0x77, 0x77, 0x7A, 0x7A, 0x82, 0x82, 0x86, 0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B,
+0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x93,
+0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96,
+0x96, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90,
+0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x87, 0x87, 0x84,
+0x84, 0x7A, 0x7A, 0x77, 0x77, 0x75, 0x75, 0x74, 0x74, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x6F,
+0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x71,
+0x71, 0x72, 0x72, 0x74, 0x74, 0x75, 0x75, 0x78, 0x78, 0x7B, 0x7B, 0x85, 0x85, 0x88, 0x88, 0x8A,
+0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93,
+0x93, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98,
+0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94,
+0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8B,
+0x8B, 0x89, 0x89, 0x86, 0x86, 0x7D, 0x7D, 0x78, 0x78, 0x75, 0x75, 0x74, 0x74, 0x72, 0x72, 0x71,
+0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66,
+0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x74, 0x74, 0x76, 0x76, 0x78,
+0x78, 0x82, 0x82, 0x87, 0x87, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91,
+0x91, 0x92, 0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99,
+0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92,
+0x92, 0x91, 0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8D, 0x8D, 0x8B, 0x8B, 0x88, 0x88, 0x85, 0x85, 0x7A,
+0x7A, 0x76, 0x76, 0x74, 0x74, 0x72, 0x72, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C,
+0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x65,
+0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,
+0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66,
+0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D,
+0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x74, 0x74, 0x76, 0x76, 0x79, 0x79, 0x85, 0x85, 0x88,
+0x88, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x95,
+0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99,
+0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92,
+0x92, 0x90, 0x90, 0x8F, 0x8F, 0x8D, 0x8D, 0x8B, 0x8B, 0x88, 0x88, 0x84, 0x84, 0x79, 0x79, 0x75,
+0x75, 0x73, 0x73, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63,
+0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D,
+0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x76, 0x76, 0x7A, 0x7A, 0x85, 0x85, 0x89,
+0x89, 0x8C, 0x8C, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x94, 0x94, 0x95, 0x95, 0x96,
+0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94,
+0x94, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8E, 0x8E, 0x8B, 0x8B, 0x89, 0x89, 0x84, 0x84, 0x78,
+0x78, 0x75, 0x75, 0x72, 0x72, 0x70, 0x70, 0x6F, 0x6F, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x63,
+0x63, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69,
+0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x75, 0x75, 0x79,
+0x79, 0x85, 0x85, 0x89, 0x89, 0x8C, 0x8C, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94,
+0x94, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98,
+0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8D,
+0x8D, 0x8A, 0x8A, 0x86, 0x86, 0x7A, 0x7A, 0x75, 0x75, 0x73, 0x73, 0x71, 0x71, 0x6F, 0x6F, 0x6D,
+0x6D, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64,
+0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64,
+0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6D,
+0x6D, 0x6F, 0x6F, 0x71, 0x71, 0x73, 0x73, 0x76, 0x76, 0x7C, 0x7C, 0x88, 0x88, 0x8B, 0x8B, 0x8D,
+0x8D, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99,
+0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x96,
+0x96, 0x95, 0x95, 0x94, 0x94, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x89, 0x89, 0x84,
+0x84, 0x78, 0x78, 0x74, 0x74, 0x72, 0x72, 0x6F, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64,
+0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x6E,
+0x6E, 0x70, 0x70, 0x73, 0x73, 0x76, 0x76, 0x7C, 0x7C, 0x88, 0x88, 0x8C, 0x8C, 0x8E, 0x8E, 0x90,
+0x90, 0x92, 0x92, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x97,
+0x97, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8D, 0x8D, 0x8A, 0x8A, 0x86,
+0x86, 0x79, 0x79, 0x74, 0x74, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6C, 0x6C, 0x6A, 0x6A, 0x69,
+0x69, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60,
+0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x71, 0x71, 0x74, 0x74, 0x79, 0x79, 0x86, 0x86, 0x8A, 0x8A, 0x8D,
+0x8D, 0x90, 0x90, 0x92, 0x92, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8F,
+0x8F, 0x8D, 0x8D, 0x8A, 0x8A, 0x84, 0x84, 0x77, 0x77, 0x73, 0x73, 0x71, 0x71, 0x6E, 0x6E, 0x6C,
+0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59,
+0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65,
+0x65, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x71, 0x71, 0x74,
+0x74, 0x78, 0x78, 0x86, 0x86, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x95,
+0x95, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0,
+0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x98,
+0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8B, 0x8B, 0x86,
+0x86, 0x78, 0x78, 0x74, 0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x68,
+0x68, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59,
+0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x67,
+0x67, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x75, 0x75, 0x7B,
+0x7B, 0x88, 0x88, 0x8C, 0x8C, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x98,
+0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x99,
+0x99, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x8B, 0x8B, 0x87,
+0x87, 0x79, 0x79, 0x74, 0x74, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x67,
+0x67, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64,
+0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x73,
+0x73, 0x77, 0x77, 0x85, 0x85, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x93, 0x93, 0x94, 0x94, 0x96,
+0x96, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91,
+0x91, 0x8E, 0x8E, 0x8B, 0x8B, 0x86, 0x86, 0x78, 0x78, 0x73, 0x73, 0x70, 0x70, 0x6E, 0x6E, 0x6C,
+0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56,
+0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F,
+0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x69,
+0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x75, 0x75, 0x7E, 0x7E, 0x89, 0x89, 0x8D,
+0x8D, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B,
+0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x8A,
+0x8A, 0x84, 0x84, 0x76, 0x76, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x68,
+0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F,
+0x5F, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A,
+0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x79, 0x79, 0x88, 0x88, 0x8C, 0x8C, 0x8F,
+0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8E,
+0x8E, 0x8A, 0x8A, 0x82, 0x82, 0x75, 0x75, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x69,
+0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57,
+0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66,
+0x66, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x77, 0x77, 0x85,
+0x85, 0x8B, 0x8B, 0x8E, 0x8E, 0x91, 0x91, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x99, 0x99, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9,
+0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x97,
+0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8E, 0x8E, 0x8A, 0x8A, 0x7D, 0x7D, 0x75, 0x75, 0x71,
+0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55,
+0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58,
+0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E,
+0x5E, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69,
+0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x70, 0x70, 0x74, 0x74, 0x7A, 0x7A, 0x88, 0x88, 0x8D, 0x8D, 0x90,
+0x90, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1,
+0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x95,
+0x95, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x8B, 0x8B, 0x85, 0x85, 0x76, 0x76, 0x72, 0x72, 0x6F,
+0x6F, 0x6D, 0x6D, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54,
+0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
+0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x68,
+0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x70, 0x70, 0x74, 0x74, 0x7A, 0x7A, 0x89, 0x89, 0x8D,
+0x8D, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A,
+0x9A, 0x99, 0x99, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x89, 0x89, 0x7B,
+0x7B, 0x74, 0x74, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x64,
+0x64, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55,
+0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61,
+0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6D, 0x6D, 0x6F,
+0x6F, 0x72, 0x72, 0x77, 0x77, 0x86, 0x86, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96,
+0x96, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97,
+0x97, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x8A, 0x8A, 0x7E, 0x7E, 0x75, 0x75, 0x71,
+0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62,
+0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61,
+0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6D, 0x6D, 0x6F,
+0x6F, 0x72, 0x72, 0x77, 0x77, 0x86, 0x86, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96,
+0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA,
+0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A,
+0x9A, 0x99, 0x99, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x89, 0x89, 0x7B,
+0x7B, 0x74, 0x74, 0x70, 0x70, 0x6E, 0x6E, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x64,
+0x64, 0x63, 0x63, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54,
+0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56,
+0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67,
+0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x74, 0x74, 0x79, 0x79, 0x89, 0x89, 0x8D,
+0x8D, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96,
+0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8C, 0x8C, 0x87, 0x87, 0x77, 0x77, 0x72, 0x72, 0x6F,
+0x6F, 0x6D, 0x6D, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58,
+0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56,
+0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x68,
+0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x75, 0x75, 0x83, 0x83, 0x8B, 0x8B, 0x8E,
+0x8E, 0x91, 0x91, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA,
+0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x99,
+0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8E, 0x8E, 0x8A, 0x8A, 0x82, 0x82, 0x75,
+0x75, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x64, 0x64, 0x63,
+0x63, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A,
+0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53,
+0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53,
+0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62,
+0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F, 0x6F, 0x72,
+0x72, 0x77, 0x77, 0x87, 0x87, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x95, 0x95, 0x96, 0x96, 0x98,
+0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x95,
+0x95, 0x93, 0x93, 0x91, 0x91, 0x8D, 0x8D, 0x89, 0x89, 0x7A, 0x7A, 0x74, 0x74, 0x70, 0x70, 0x6D,
+0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x62, 0x62, 0x61, 0x61, 0x60,
+0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53,
+0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6D, 0x6D, 0x6F, 0x6F, 0x73,
+0x73, 0x78, 0x78, 0x87, 0x87, 0x8D, 0x8D, 0x90, 0x90, 0x92, 0x92, 0x95, 0x95, 0x97, 0x97, 0x99,
+0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x99,
+0x99, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x89, 0x89, 0x7B, 0x7B, 0x74,
+0x74, 0x70, 0x70, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50,
+0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x55,
+0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x68,
+0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x72, 0x72, 0x76, 0x76, 0x85, 0x85, 0x8B, 0x8B, 0x8F,
+0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x98, 0x98, 0x97,
+0x97, 0x95, 0x95, 0x92, 0x92, 0x8F, 0x8F, 0x8C, 0x8C, 0x87, 0x87, 0x77, 0x77, 0x72, 0x72, 0x6F,
+0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x60,
+0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58,
+0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x50,
+0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66,
+0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F, 0x6F, 0x72, 0x72, 0x76, 0x76, 0x86, 0x86, 0x8C,
+0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x89,
+0x89, 0x79, 0x79, 0x74, 0x74, 0x70, 0x70, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x65,
+0x65, 0x64, 0x64, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54,
+0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56,
+0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A,
+0x6A, 0x6D, 0x6D, 0x6F, 0x6F, 0x73, 0x73, 0x78, 0x78, 0x87, 0x87, 0x8C, 0x8C, 0x90, 0x90, 0x92,
+0x92, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0,
+0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C,
+0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8E, 0x8E, 0x8A,
+0x8A, 0x81, 0x81, 0x75, 0x75, 0x71, 0x71, 0x6E, 0x6E, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x64, 0x64, 0x63, 0x63, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54,
+0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F,
+0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54,
+0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65,
+0x65, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x73, 0x73, 0x79, 0x79, 0x88,
+0x88, 0x8D, 0x8D, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA,
+0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x98,
+0x98, 0x97, 0x97, 0x95, 0x95, 0x92, 0x92, 0x90, 0x90, 0x8C, 0x8C, 0x87, 0x87, 0x78, 0x78, 0x73,
+0x73, 0x6F, 0x6F, 0x6D, 0x6D, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x62,
+0x62, 0x61, 0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54,
+0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65,
+0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6D, 0x6D, 0x6F, 0x6F, 0x73, 0x73, 0x77, 0x77, 0x87,
+0x87, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8C,
+0x8C, 0x87, 0x87, 0x77, 0x77, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6A, 0x6A, 0x68, 0x68, 0x67,
+0x67, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55,
+0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56,
+0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x69,
+0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x73, 0x73, 0x79, 0x79, 0x88, 0x88, 0x8D, 0x8D, 0x90,
+0x90, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x96, 0x96, 0x93, 0x93, 0x91, 0x91, 0x8E,
+0x8E, 0x8A, 0x8A, 0x83, 0x83, 0x75, 0x75, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x68,
+0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56,
+0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50,
+0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A,
+0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x63,
+0x63, 0x64, 0x64, 0x66, 0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x75,
+0x75, 0x7E, 0x7E, 0x8A, 0x8A, 0x8E, 0x8E, 0x91, 0x91, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x99,
+0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF,
+0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9A, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x89,
+0x89, 0x7A, 0x7A, 0x74, 0x74, 0x70, 0x70, 0x6E, 0x6E, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55,
+0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52,
+0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58,
+0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61,
+0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F,
+0x6F, 0x72, 0x72, 0x76, 0x76, 0x83, 0x83, 0x8B, 0x8B, 0x8E, 0x8E, 0x91, 0x91, 0x93, 0x93, 0x95,
+0x95, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x97,
+0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x89, 0x89, 0x7B, 0x7B, 0x74, 0x74, 0x71,
+0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62,
+0x62, 0x61, 0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52,
+0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58,
+0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61,
+0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6E,
+0x6E, 0x70, 0x70, 0x74, 0x74, 0x7A, 0x7A, 0x89, 0x89, 0x8D, 0x8D, 0x90, 0x90, 0x92, 0x92, 0x94,
+0x94, 0x96, 0x96, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8C,
+0x8C, 0x87, 0x87, 0x78, 0x78, 0x73, 0x73, 0x70, 0x70, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67,
+0x67, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56,
+0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x51,
+0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70,
+0x70, 0x73, 0x73, 0x78, 0x78, 0x87, 0x87, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96,
+0x96, 0x97, 0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F,
+0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97, 0x97, 0x96, 0x96, 0x94,
+0x94, 0x91, 0x91, 0x8F, 0x8F, 0x8B, 0x8B, 0x86, 0x86, 0x77, 0x77, 0x73, 0x73, 0x70, 0x70, 0x6D,
+0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64,
+0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F, 0x6F, 0x71, 0x71, 0x75,
+0x75, 0x7C, 0x7C, 0x89, 0x89, 0x8D, 0x8D, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98,
+0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9,
+0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x97,
+0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x7A, 0x7A, 0x74,
+0x74, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x64,
+0x64, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x55,
+0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56,
+0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67,
+0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x79, 0x79, 0x88,
+0x88, 0x8C, 0x8C, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A,
+0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B,
+0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x90, 0x90, 0x8D, 0x8D, 0x89,
+0x89, 0x81, 0x81, 0x76, 0x76, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67,
+0x67, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57,
+0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52,
+0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58,
+0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F,
+0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69,
+0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x76, 0x76, 0x84, 0x84, 0x8A, 0x8A, 0x8E,
+0x8E, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x91,
+0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x7A, 0x7A, 0x75, 0x75, 0x71, 0x71, 0x6F, 0x6F, 0x6C,
+0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59,
+0x59, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60,
+0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x69, 0x6B,
+0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x75, 0x75, 0x7D, 0x7D, 0x89, 0x89, 0x8D, 0x8D, 0x8F,
+0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x98,
+0x98, 0x96, 0x96, 0x94, 0x94, 0x93, 0x93, 0x90, 0x90, 0x8E, 0x8E, 0x8B, 0x8B, 0x86, 0x86, 0x78,
+0x78, 0x73, 0x73, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57,
+0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54,
+0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60,
+0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6B,
+0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x78, 0x78, 0x86, 0x86, 0x8B, 0x8B, 0x8E,
+0x8E, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95, 0x93,
+0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x7A, 0x7A, 0x75, 0x75, 0x72, 0x72, 0x6F,
+0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63,
+0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55,
+0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53,
+0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58,
+0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x66, 0x67,
+0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x73, 0x73, 0x77, 0x77, 0x83,
+0x83, 0x8A, 0x8A, 0x8D, 0x8D, 0x8F, 0x8F, 0x92, 0x92, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x98,
+0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x92,
+0x92, 0x8F, 0x8F, 0x8D, 0x8D, 0x8A, 0x8A, 0x84, 0x84, 0x77, 0x77, 0x73, 0x73, 0x70, 0x70, 0x6E,
+0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63,
+0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56,
+0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55,
+0x55, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x73, 0x73, 0x77, 0x77, 0x84, 0x84, 0x8A, 0x8A, 0x8D, 0x8D, 0x8F,
+0x8F, 0x91, 0x91, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x95,
+0x95, 0x94, 0x94, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8B, 0x8B, 0x87, 0x87, 0x79, 0x79, 0x75,
+0x75, 0x72, 0x72, 0x6F, 0x6F, 0x6D, 0x6D, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58,
+0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56,
+0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x73, 0x73, 0x76, 0x76, 0x7C, 0x7C, 0x88, 0x88, 0x8C, 0x8C, 0x8E,
+0x8E, 0x91, 0x91, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x94, 0x94, 0x92,
+0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8B, 0x8B, 0x88, 0x88, 0x7B, 0x7B, 0x76, 0x76, 0x73, 0x73, 0x70,
+0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x64,
+0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54,
+0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F,
+0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66,
+0x66, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F, 0x6F, 0x72, 0x72, 0x74,
+0x74, 0x78, 0x78, 0x85, 0x85, 0x8A, 0x8A, 0x8D, 0x8D, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93, 0x94,
+0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9,
+0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8D, 0x8D, 0x8B, 0x8B, 0x87, 0x87, 0x7A,
+0x7A, 0x75, 0x75, 0x72, 0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x68,
+0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60,
+0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x55,
+0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65,
+0x65, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x70,
+0x70, 0x73, 0x73, 0x76, 0x76, 0x7B, 0x7B, 0x87, 0x87, 0x8B, 0x8B, 0x8D, 0x8D, 0x90, 0x90, 0x91,
+0x91, 0x93, 0x93, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x95, 0x95, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x89, 0x89, 0x83,
+0x83, 0x77, 0x77, 0x74, 0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57,
+0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55,
+0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59,
+0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F,
+0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66,
+0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x71,
+0x71, 0x73, 0x73, 0x77, 0x77, 0x7C, 0x7C, 0x88, 0x88, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x91,
+0x91, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95,
+0x95, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x85, 0x85, 0x79,
+0x79, 0x75, 0x75, 0x72, 0x72, 0x70, 0x70, 0x6F, 0x6F, 0x6D, 0x6D, 0x6C, 0x6C, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57,
+0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60,
+0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67,
+0x67, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x71, 0x71, 0x73,
+0x73, 0x76, 0x76, 0x7A, 0x7A, 0x86, 0x86, 0x8A, 0x8A, 0x8C, 0x8C, 0x8F, 0x8F, 0x90, 0x90, 0x92,
+0x92, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x93,
+0x93, 0x92, 0x92, 0x90, 0x90, 0x8F, 0x8F, 0x8D, 0x8D, 0x8A, 0x8A, 0x87, 0x87, 0x7B, 0x7B, 0x76,
+0x76, 0x74, 0x74, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61,
+0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68,
+0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F, 0x6F, 0x71, 0x71, 0x73,
+0x73, 0x76, 0x76, 0x7A, 0x7A, 0x86, 0x86, 0x89, 0x89, 0x8C, 0x8C, 0x8E, 0x8E, 0x90, 0x90, 0x91,
+0x91, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94,
+0x94, 0x93, 0x93, 0x91, 0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x86, 0x86, 0x7B,
+0x7B, 0x76, 0x76, 0x74, 0x74, 0x72, 0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6A,
+0x6A, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63,
+0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59,
+0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60,
+0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x66,
+0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F,
+0x6F, 0x71, 0x71, 0x73, 0x73, 0x75, 0x75, 0x78, 0x78, 0x82, 0x82, 0x88, 0x88, 0x8B, 0x8B, 0x8D,
+0x8D, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97,
+0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97,
+0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8E,
+0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x86, 0x86, 0x7C, 0x7C, 0x77, 0x77, 0x74, 0x74, 0x72, 0x72, 0x70,
+0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x67,
+0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x61,
+0x61, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59,
+0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x62,
+0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68,
+0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x70, 0x70, 0x72,
+0x72, 0x74, 0x74, 0x76, 0x76, 0x7A, 0x7A, 0x85, 0x85, 0x89, 0x89, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F,
+0x8F, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x98,
+0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8F,
+0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x87, 0x87, 0x7E, 0x7E, 0x78, 0x78, 0x75, 0x75, 0x73,
+0x73, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63,
+0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A,
+0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x60,
+0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x75, 0x75, 0x77, 0x77, 0x7B,
+0x7B, 0x86, 0x86, 0x89, 0x89, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97,
+0x97, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8F,
+0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x88, 0x88, 0x85, 0x85, 0x7A, 0x7A, 0x77, 0x77, 0x74,
+0x74, 0x73, 0x73, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A,
+0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60,
+0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63,
+0x63, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68,
+0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x70,
+0x70, 0x71, 0x71, 0x73, 0x73, 0x74, 0x74, 0x76, 0x76, 0x79, 0x79, 0x84, 0x84, 0x88, 0x88, 0x8A,
+0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94,
+0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F,
+0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98,
+0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91,
+0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x86, 0x86, 0x7D,
+0x7D, 0x78, 0x78, 0x76, 0x76, 0x74, 0x74, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67,
+0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62,
+0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F,
+0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63,
+0x63, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x68,
+0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F,
+0x6F, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x75, 0x75, 0x77, 0x77, 0x7A, 0x7A, 0x84, 0x84, 0x88,
+0x88, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x91, 0x91, 0x92, 0x92, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98,
+0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97,
+0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90,
+0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x87, 0x87, 0x83, 0x83, 0x7A,
+0x7A, 0x77, 0x77, 0x75, 0x75, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E,
+0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x67,
+0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x63,
+0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61,
+0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x71,
+0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x76, 0x76, 0x79, 0x79, 0x7D, 0x7D, 0x86, 0x86, 0x88,
+0x88, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
+0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96,
+0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F,
+0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8A, 0x8A, 0x89, 0x89, 0x87, 0x87, 0x83, 0x83, 0x7A,
+0x7A, 0x77, 0x77, 0x75, 0x75, 0x74, 0x74, 0x73, 0x73, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69,
+0x69, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61,
+0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x69,
+0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F,
+0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x76, 0x76, 0x78, 0x78, 0x7B,
+0x7B, 0x84, 0x84, 0x87, 0x87, 0x89, 0x89, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F,
+0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95,
+0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97,
+0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92,
+0x92, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B,
+0x8B, 0x8A, 0x8A, 0x88, 0x88, 0x86, 0x86, 0x82, 0x82, 0x7A, 0x7A, 0x78, 0x78, 0x76, 0x76, 0x74,
+0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68,
+0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69,
+0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x77,
+0x77, 0x78, 0x78, 0x7B, 0x7B, 0x84, 0x84, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C,
+0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x93,
+0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97,
+0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99,
+0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x91,
+0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A,
+0x8A, 0x88, 0x88, 0x86, 0x86, 0x83, 0x83, 0x7B, 0x7B, 0x78, 0x78, 0x77, 0x77, 0x75, 0x75, 0x74,
+0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69,
+0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67,
+0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x70,
+0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x78,
+0x78, 0x7A, 0x7A, 0x7E, 0x7E, 0x85, 0x85, 0x87, 0x87, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C,
+0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92,
+0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96,
+0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94,
+0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x90,
+0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89,
+0x89, 0x88, 0x88, 0x86, 0x86, 0x84, 0x84, 0x7C, 0x7C, 0x79, 0x79, 0x77, 0x77, 0x76, 0x76, 0x75,
+0x75, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67,
+0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x73,
+0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x78, 0x78, 0x79, 0x79, 0x7B, 0x7B, 0x83, 0x83, 0x86,
+0x86, 0x87, 0x87, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92,
+0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96,
+0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A,
+0x8A, 0x89, 0x89, 0x87, 0x87, 0x86, 0x86, 0x84, 0x84, 0x7D, 0x7D, 0x7A, 0x7A, 0x78, 0x78, 0x77,
+0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x71,
+0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x72,
+0x72, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x7A,
+0x7A, 0x7C, 0x7C, 0x83, 0x83, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x90,
+0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x87, 0x85,
+0x85, 0x84, 0x84, 0x7D, 0x7D, 0x7B, 0x7B, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x75,
+0x75, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x70,
+0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71,
+0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x75,
+0x75, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7B, 0x7B, 0x7E, 0x7E, 0x84,
+0x84, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F,
+0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A,
+0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x84, 0x84, 0x82,
+0x82, 0x7C, 0x7C, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x75,
+0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x71,
+0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76,
+0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7D, 0x7D, 0x82,
+0x82, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86,
+0x86, 0x85, 0x85, 0x84, 0x84, 0x82, 0x82, 0x7D, 0x7D, 0x7B, 0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x78,
+0x78, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74,
+0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76,
+0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C,
+0x7C, 0x7D, 0x7D, 0x82, 0x82, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87,
+0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86,
+0x86, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x81, 0x81, 0x7D, 0x7D, 0x7B, 0x7B, 0x7B,
+0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x84,
+0x84, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x84,
+0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x80, 0x80, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B,
+0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C,
+0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7F, 0x7F, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84,
+0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C,
+0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E,
+0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x81, 0x81, 0x82, 0x82, 0x84, 0x84, 0x85,
+0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x87, 0x87, 0x7D, 0x7D, 0x78, 0x78, 0x75, 0x75, 0x73,
+0x73, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68,
+0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x6A,
+0x6A, 0x6E, 0x6E, 0x73, 0x73, 0x85, 0x85, 0x8E, 0x8E, 0x92, 0x92, 0x96, 0x96, 0x99, 0x99, 0x9C,
+0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0xA0, 0x9D,
+0x9D, 0x9A, 0x9A, 0x96, 0x96, 0x90, 0x90, 0x85, 0x85, 0x70, 0x70, 0x6A, 0x6A, 0x66, 0x66, 0x62,
+0x62, 0x5F, 0x5F, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x5B, 0x5B, 0x5E, 0x5E, 0x61, 0x61, 0x66, 0x66, 0x6C, 0x6C, 0x76, 0x76, 0x8F, 0x8F, 0x97,
+0x97, 0x9C, 0x9C, 0xA0, 0xA0, 0xA4, 0xA4, 0xA7, 0xA7, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xA9, 0xA9, 0xA6, 0xA6, 0xA2, 0xA2, 0x9D, 0x9D, 0x97, 0x97, 0x8E,
+0x8E, 0x72, 0x72, 0x68, 0x68, 0x62, 0x62, 0x5D, 0x5D, 0x59, 0x59, 0x55, 0x55, 0x52, 0x52, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x52, 0x52, 0x56, 0x56, 0x5A,
+0x5A, 0x5F, 0x5F, 0x65, 0x65, 0x6E, 0x6E, 0x8D, 0x8D, 0x98, 0x98, 0x9F, 0x9F, 0xA4, 0xA4, 0xA9,
+0xA9, 0xAC, 0xAC, 0xB0, 0xB0, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3,
+0xB3, 0xB0, 0xB0, 0xAC, 0xAC, 0xA8, 0xA8, 0xA3, 0xA3, 0x9D, 0x9D, 0x94, 0x94, 0x77, 0x77, 0x67,
+0x67, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x51, 0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x49, 0x49, 0x49,
+0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x49, 0x49, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5A,
+0x5A, 0x61, 0x61, 0x6A, 0x6A, 0x8B, 0x8B, 0x99, 0x99, 0xA1, 0xA1, 0xA7, 0xA7, 0xAC, 0xAC, 0xB1,
+0xB1, 0xB5, 0xB5, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8,
+0xB8, 0xB5, 0xB5, 0xB1, 0xB1, 0xAC, 0xAC, 0xA7, 0xA7, 0xA0, 0xA0, 0x97, 0x97, 0x76, 0x76, 0x66,
+0x66, 0x5D, 0x5D, 0x56, 0x56, 0x51, 0x51, 0x4D, 0x4D, 0x49, 0x49, 0x45, 0x45, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4E, 0x4E, 0x53,
+0x53, 0x59, 0x59, 0x60, 0x60, 0x6C, 0x6C, 0x90, 0x90, 0x9D, 0x9D, 0xA5, 0xA5, 0xAC, 0xAC, 0xB1,
+0xB1, 0xB6, 0xB6, 0xBA, 0xBA, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB2, 0xB2, 0xAD, 0xAD, 0xA6, 0xA6, 0x9E, 0x9E, 0x90,
+0x90, 0x6A, 0x6A, 0x5F, 0x5F, 0x57, 0x57, 0x50, 0x50, 0x4B, 0x4B, 0x47, 0x47, 0x43, 0x43, 0x3F,
+0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x42, 0x42, 0x46,
+0x46, 0x4A, 0x4A, 0x50, 0x50, 0x56, 0x56, 0x5E, 0x5E, 0x6A, 0x6A, 0x90, 0x90, 0x9E, 0x9E, 0xA7,
+0xA7, 0xAD, 0xAD, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC, 0xBC, 0xC0, 0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBE, 0xBE, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB,
+0xAB, 0xA4, 0xA4, 0x9A, 0x9A, 0x7C, 0x7C, 0x65, 0x65, 0x5B, 0x5B, 0x54, 0x54, 0x4E, 0x4E, 0x49,
+0x49, 0x45, 0x45, 0x41, 0x41, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x3F, 0x3F, 0x43, 0x43, 0x47, 0x47, 0x4B, 0x4B, 0x50, 0x50, 0x57, 0x57, 0x5F, 0x5F, 0x6A,
+0x6A, 0x90, 0x90, 0x9D, 0x9D, 0xA6, 0xA6, 0xAD, 0xAD, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB, 0xBB, 0xBE,
+0xBE, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBE, 0xBE, 0xBA,
+0xBA, 0xB6, 0xB6, 0xB2, 0xB2, 0xAC, 0xAC, 0xA6, 0xA6, 0x9D, 0x9D, 0x90, 0x90, 0x6A, 0x6A, 0x5F,
+0x5F, 0x57, 0x57, 0x51, 0x51, 0x4C, 0x4C, 0x48, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3E, 0x3E, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4E,
+0x4E, 0x54, 0x54, 0x5A, 0x5A, 0x63, 0x63, 0x71, 0x71, 0x96, 0x96, 0xA1, 0xA1, 0xA8, 0xA8, 0xAE,
+0xAE, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC, 0xBC, 0xBF, 0xBF, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB5, 0xB5, 0xB0, 0xB0, 0xAA, 0xAA, 0xA4,
+0xA4, 0x9B, 0x9B, 0x89, 0x89, 0x67, 0x67, 0x5D, 0x5D, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x47,
+0x47, 0x43, 0x43, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x40,
+0x40, 0x43, 0x43, 0x47, 0x47, 0x4B, 0x4B, 0x50, 0x50, 0x55, 0x55, 0x5C, 0x5C, 0x66, 0x66, 0x7D,
+0x7D, 0x99, 0x99, 0xA3, 0xA3, 0xAA, 0xAA, 0xAF, 0xAF, 0xB4, 0xB4, 0xB8, 0xB8, 0xBC, 0xBC, 0xBF,
+0xBF, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBF, 0xBF, 0xBC, 0xBC, 0xB8,
+0xB8, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9, 0xA9, 0xA2, 0xA2, 0x97, 0x97, 0x74, 0x74, 0x64, 0x64, 0x5B,
+0x5B, 0x54, 0x54, 0x4F, 0x4F, 0x4A, 0x4A, 0x46, 0x46, 0x42, 0x42, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x41, 0x41, 0x44, 0x44, 0x48, 0x48, 0x4D, 0x4D, 0x52,
+0x52, 0x58, 0x58, 0x60, 0x60, 0x6C, 0x6C, 0x91, 0x91, 0x9E, 0x9E, 0xA6, 0xA6, 0xAC, 0xAC, 0xB2,
+0xB2, 0xB6, 0xB6, 0xBA, 0xBA, 0xBE, 0xBE, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3,
+0xC3, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB5, 0xB5, 0xB1, 0xB1, 0xAB, 0xAB, 0xA4, 0xA4, 0x9B,
+0x9B, 0x8B, 0x8B, 0x68, 0x68, 0x5E, 0x5E, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x47, 0x47, 0x43,
+0x43, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x44,
+0x44, 0x48, 0x48, 0x4C, 0x4C, 0x52, 0x52, 0x58, 0x58, 0x61, 0x61, 0x6D, 0x6D, 0x93, 0x93, 0x9F,
+0x9F, 0xA7, 0xA7, 0xAD, 0xAD, 0xB3, 0xB3, 0xB7, 0xB7, 0xBB, 0xBB, 0xBF, 0xBF, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBF, 0xBF, 0xBC, 0xBC, 0xB8, 0xB8, 0xB4, 0xB4, 0xAE,
+0xAE, 0xA8, 0xA8, 0xA0, 0xA0, 0x95, 0x95, 0x70, 0x70, 0x62, 0x62, 0x59, 0x59, 0x52, 0x52, 0x4D,
+0x4D, 0x48, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x40, 0x40, 0x43, 0x43, 0x47, 0x47, 0x4C, 0x4C, 0x51, 0x51, 0x58, 0x58, 0x60, 0x60, 0x6E,
+0x6E, 0x94, 0x94, 0xA0, 0xA0, 0xA8, 0xA8, 0xAF, 0xAF, 0xB4, 0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0,
+0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBF, 0xBF, 0xBB, 0xBB, 0xB6,
+0xB6, 0xB1, 0xB1, 0xAB, 0xAB, 0xA4, 0xA4, 0x9A, 0x9A, 0x7A, 0x7A, 0x64, 0x64, 0x5B, 0x5B, 0x53,
+0x53, 0x4D, 0x4D, 0x48, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x40, 0x40, 0x44, 0x44, 0x48, 0x48, 0x4D, 0x4D, 0x53, 0x53, 0x5B, 0x5B, 0x64,
+0x64, 0x85, 0x85, 0x9B, 0x9B, 0xA5, 0xA5, 0xAC, 0xAC, 0xB2, 0xB2, 0xB7, 0xB7, 0xBC, 0xBC, 0xC0,
+0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBF, 0xBF, 0xBB, 0xBB, 0xB7,
+0xB7, 0xB2, 0xB2, 0xAB, 0xAB, 0xA4, 0xA4, 0x99, 0x99, 0x73, 0x73, 0x62, 0x62, 0x58, 0x58, 0x51,
+0x51, 0x4B, 0x4B, 0x46, 0x46, 0x42, 0x42, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x42, 0x42, 0x46, 0x46, 0x4C, 0x4C, 0x52, 0x52, 0x59, 0x59, 0x64, 0x64, 0x7C,
+0x7C, 0x9C, 0x9C, 0xA6, 0xA6, 0xAE, 0xAE, 0xB4, 0xB4, 0xB9, 0xB9, 0xBE, 0xBE, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE, 0xBE, 0xB9, 0xB9, 0xB4, 0xB4, 0xAD,
+0xAD, 0xA6, 0xA6, 0x9A, 0x9A, 0x75, 0x75, 0x62, 0x62, 0x58, 0x58, 0x50, 0x50, 0x4A, 0x4A, 0x45,
+0x45, 0x40, 0x40, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x40, 0x40, 0x44,
+0x44, 0x49, 0x49, 0x50, 0x50, 0x58, 0x58, 0x62, 0x62, 0x79, 0x79, 0x9C, 0x9C, 0xA7, 0xA7, 0xAF,
+0xAF, 0xB5, 0xB5, 0xBB, 0xBB, 0xBF, 0xBF, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC0, 0xC0, 0xBB, 0xBB, 0xB6, 0xB6, 0xB0, 0xB0, 0xA8, 0xA8, 0x9D, 0x9D, 0x7E, 0x7E, 0x62,
+0x62, 0x57, 0x57, 0x4F, 0x4F, 0x49, 0x49, 0x43, 0x43, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x42, 0x42, 0x47, 0x47, 0x4E, 0x4E, 0x56, 0x56, 0x60, 0x60, 0x75,
+0x75, 0x9C, 0x9C, 0xA8, 0xA8, 0xB0, 0xB0, 0xB7, 0xB7, 0xBC, 0xBC, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBD, 0xBD, 0xB8, 0xB8, 0xB1, 0xB1, 0xA9, 0xA9, 0x9E,
+0x9E, 0x7A, 0x7A, 0x61, 0x61, 0x56, 0x56, 0x4D, 0x4D, 0x47, 0x47, 0x41, 0x41, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41, 0x41, 0x46, 0x46, 0x4D, 0x4D, 0x56, 0x56, 0x61,
+0x61, 0x88, 0x88, 0xA0, 0xA0, 0xAA, 0xAA, 0xB3, 0xB3, 0xBA, 0xBA, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB8, 0xB8, 0xB1, 0xB1, 0xA8, 0xA8, 0x9A,
+0x9A, 0x6D, 0x6D, 0x5C, 0x5C, 0x52, 0x52, 0x49, 0x49, 0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41, 0x41, 0x48, 0x48, 0x50, 0x50, 0x5A, 0x5A, 0x69, 0x69, 0x98,
+0x98, 0xA7, 0xA7, 0xB1, 0xB1, 0xB8, 0xB8, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC2, 0xC2, 0xBC, 0xBC, 0xB5, 0xB5, 0xAD, 0xAD, 0xA1, 0xA1, 0x88, 0x88, 0x5F, 0x5F, 0x53,
+0x53, 0x4A, 0x4A, 0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x45,
+0x45, 0x4D, 0x4D, 0x56, 0x56, 0x65, 0x65, 0x95, 0x95, 0xA6, 0xA6, 0xB1, 0xB1, 0xB9, 0xB9, 0xBF,
+0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB7, 0xB7, 0xAE, 0xAE, 0xA2,
+0xA2, 0x88, 0x88, 0x5E, 0x5E, 0x52, 0x52, 0x49, 0x49, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x44, 0x44, 0x4D, 0x4D, 0x57, 0x57, 0x68, 0x68, 0x9A, 0x9A, 0xAA, 0xAA, 0xB4,
+0xB4, 0xBC, 0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB5, 0xB5, 0xAC,
+0xAC, 0x9D, 0x9D, 0x6C, 0x6C, 0x59, 0x59, 0x4E, 0x4E, 0x45, 0x45, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x47, 0x47, 0x51, 0x51, 0x5E, 0x5E, 0x8B, 0x8B, 0xA4, 0xA4, 0xB0, 0xB0, 0xB9,
+0xB9, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBA, 0xBA, 0xB0, 0xB0, 0xA3, 0xA3, 0x88,
+0x88, 0x5D, 0x5D, 0x50, 0x50, 0x46, 0x46, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x44, 0x44, 0x4E,
+0x4E, 0x5A, 0x5A, 0x73, 0x73, 0xA1, 0xA1, 0xAF, 0xAF, 0xB8, 0xB8, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2,
+0xC2, 0xBB, 0xBB, 0xB1, 0xB1, 0xA5, 0xA5, 0x8C, 0x8C, 0x5D, 0x5D, 0x50, 0x50, 0x46, 0x46, 0x3E,
+0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x44, 0x44, 0x4D, 0x4D, 0x5A, 0x5A, 0x74, 0x74, 0xA3, 0xA3, 0xB0, 0xB0, 0xBA,
+0xBA, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBA, 0xBA, 0xB0, 0xB0, 0xA3, 0xA3, 0x78, 0x78, 0x5B, 0x5B, 0x4E,
+0x4E, 0x44, 0x44, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x45, 0x45, 0x4F, 0x4F, 0x5D, 0x5D, 0x8F, 0x8F, 0xA6, 0xA6, 0xB2,
+0xB2, 0xBB, 0xBB, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB8, 0xB8, 0xAD, 0xAD, 0x9E, 0x9E, 0x6A, 0x6A, 0x57, 0x57, 0x4B,
+0x4B, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x40, 0x40, 0x48, 0x48, 0x53, 0x53, 0x62, 0x62, 0x97, 0x97, 0xA9, 0xA9, 0xB5, 0xB5, 0xBD,
+0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBC,
+0xBC, 0xB4, 0xB4, 0xA8, 0xA8, 0x96, 0x96, 0x63, 0x63, 0x53, 0x53, 0x49, 0x49, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x44, 0x44, 0x4C, 0x4C, 0x57,
+0x57, 0x6A, 0x6A, 0x9C, 0x9C, 0xAB, 0xAB, 0xB6, 0xB6, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB9, 0xB9, 0xB0, 0xB0, 0xA4, 0xA4, 0x8C, 0x8C, 0x5F,
+0x5F, 0x52, 0x52, 0x49, 0x49, 0x42, 0x42, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41,
+0x41, 0x47, 0x47, 0x50, 0x50, 0x5B, 0x5B, 0x71, 0x71, 0x9E, 0x9E, 0xAC, 0xAC, 0xB5, 0xB5, 0xBC,
+0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB5, 0xB5, 0xAC, 0xAC, 0xA0,
+0xA0, 0x84, 0x84, 0x5F, 0x5F, 0x54, 0x54, 0x4B, 0x4B, 0x44, 0x44, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x40,
+0x40, 0x45, 0x45, 0x4B, 0x4B, 0x52, 0x52, 0x5D, 0x5D, 0x70, 0x70, 0x9C, 0x9C, 0xA8, 0xA8, 0xB1,
+0xB1, 0xB8, 0xB8, 0xBD, 0xBD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2, 0xB2, 0xAA, 0xAA, 0xA0,
+0xA0, 0x8C, 0x8C, 0x64, 0x64, 0x58, 0x58, 0x50, 0x50, 0x4A, 0x4A, 0x46, 0x46, 0x42, 0x42, 0x40,
+0x40, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x49,
+0x49, 0x4E, 0x4E, 0x55, 0x55, 0x5D, 0x5D, 0x6A, 0x6A, 0x94, 0x94, 0xA1, 0xA1, 0xAA, 0xAA, 0xB0,
+0xB0, 0xB5, 0xB5, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC,
+0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA8, 0xA8, 0xA0, 0xA0, 0x95, 0x95, 0x6F,
+0x6F, 0x62, 0x62, 0x5A, 0x5A, 0x54, 0x54, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x48,
+0x48, 0x48, 0x48, 0x49, 0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x58, 0x58, 0x5E,
+0x5E, 0x66, 0x66, 0x74, 0x74, 0x95, 0x95, 0x9E, 0x9E, 0xA4, 0xA4, 0xA9, 0xA9, 0xAC, 0xAC, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAE, 0xAE, 0xAB, 0xAB, 0xA8,
+0xA8, 0xA4, 0xA4, 0x9F, 0x9F, 0x98, 0x98, 0x8E, 0x8E, 0x70, 0x70, 0x68, 0x68, 0x62, 0x62, 0x5E,
+0x5E, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5C,
+0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x63, 0x63, 0x68, 0x68, 0x6D, 0x6D, 0x76, 0x76, 0x8D, 0x8D, 0x93,
+0x93, 0x97, 0x97, 0x9A, 0x9A, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9C, 0x9C, 0x99, 0x99, 0x98, 0x98, 0x95, 0x95, 0x91, 0x91, 0x8D, 0x8D, 0x88, 0x88, 0x7C,
+0x7C, 0x77, 0x77, 0x77, 0x77, 0x79, 0x79, 0x7B, 0x7B, 0x89, 0x89, 0x8D, 0x8D, 0x8F, 0x8F, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8B,
+0x8B, 0x81, 0x81, 0x73, 0x73, 0x6F, 0x6F, 0x6B, 0x6B, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x61,
+0x61, 0x61, 0x61, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x68,
+0x68, 0x6F, 0x6F, 0x88, 0x88, 0x94, 0x94, 0x9B, 0x9B, 0xA0, 0xA0, 0xA5, 0xA5, 0xA8, 0xA8, 0xAB,
+0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA5, 0xA5, 0xA1,
+0xA1, 0x99, 0x99, 0x8D, 0x8D, 0x6C, 0x6C, 0x62, 0x62, 0x5B, 0x5B, 0x56, 0x56, 0x52, 0x52, 0x4F,
+0x4F, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x59,
+0x59, 0x60, 0x60, 0x6D, 0x6D, 0x94, 0x94, 0xA1, 0xA1, 0xA9, 0xA9, 0xB0, 0xB0, 0xB5, 0xB5, 0xB8,
+0xB8, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB,
+0xAB, 0xA2, 0xA2, 0x92, 0x92, 0x66, 0x66, 0x59, 0x59, 0x50, 0x50, 0x4A, 0x4A, 0x45, 0x45, 0x42,
+0x42, 0x3F, 0x3F, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x43, 0x43, 0x47, 0x47, 0x4D, 0x4D, 0x55,
+0x55, 0x62, 0x62, 0x8F, 0x8F, 0xA3, 0xA3, 0xAF, 0xAF, 0xB7, 0xB7, 0xBD, 0xBD, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBF, 0xBF, 0xB9, 0xB9, 0xB1, 0xB1, 0xA5,
+0xA5, 0x8D, 0x8D, 0x5E, 0x5E, 0x50, 0x50, 0x47, 0x47, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x44, 0x44, 0x4D, 0x4D, 0x5A, 0x5A, 0x7A,
+0x7A, 0xA6, 0xA6, 0xB3, 0xB3, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB2, 0xB2, 0xA2, 0xA2, 0x69, 0x69, 0x53,
+0x53, 0x46, 0x46, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x46, 0x46, 0x54, 0x54, 0x73, 0x73, 0xA8, 0xA8, 0xB8, 0xB8, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBE, 0xBE, 0xB1, 0xB1, 0x99, 0x99, 0x5B, 0x5B, 0x48, 0x48, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x50,
+0x50, 0x6E, 0x6E, 0xAB, 0xAB, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAB, 0xAB, 0x6D, 0x6D, 0x4E,
+0x4E, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x4D, 0x4D, 0x6B, 0x6B, 0xAB, 0xAB, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8,
+0xB8, 0xA1, 0xA1, 0x5B, 0x5B, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0x64, 0x64, 0xA9, 0xA9, 0xBD,
+0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB3, 0xB3, 0x92, 0x92, 0x51, 0x51, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x5A, 0x5A, 0xA2,
+0xA2, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB0, 0xB0, 0x71, 0x71, 0x4D, 0x4D, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4F, 0x4F, 0x8B,
+0x8B, 0xB1, 0xB1, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xAF, 0xAF, 0x71, 0x71, 0x4E, 0x4E, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x5A, 0x5A, 0x9F,
+0x9F, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xB1, 0xB1, 0x94, 0x94, 0x54, 0x54, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4B, 0x4B, 0x61, 0x61, 0xA2, 0xA2, 0xB6,
+0xB6, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB6,
+0xB6, 0xA3, 0xA3, 0x65, 0x65, 0x4E, 0x4E, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x4D, 0x4D, 0x5F, 0x5F, 0x9A, 0x9A, 0xAE, 0xAE, 0xB9, 0xB9, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB8, 0xB8, 0xAC, 0xAC, 0x9A, 0x9A, 0x62,
+0x62, 0x52, 0x52, 0x49, 0x49, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x44, 0x44, 0x48, 0x48, 0x50,
+0x50, 0x5C, 0x5C, 0x77, 0x77, 0xA1, 0xA1, 0xAD, 0xAD, 0xB4, 0xB4, 0xB8, 0xB8, 0xB9, 0xB9, 0xB7,
+0xB7, 0xB4, 0xB4, 0xAE, 0xAE, 0xA5, 0xA5, 0x98, 0x98, 0x6B, 0x6B, 0x5D, 0x5D, 0x56, 0x56, 0x51,
+0x51, 0x50, 0x50, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x67, 0x67, 0x88, 0x88, 0x99,
+0x99, 0xA0, 0xA0, 0xA4, 0xA4, 0xA6, 0xA6, 0xA6, 0xA6, 0xA4, 0xA4, 0xA0, 0xA0, 0x9A, 0x9A, 0x93,
+0x93, 0x86, 0x86, 0x70, 0x70, 0x6C, 0x6C, 0x6B, 0x6B, 0x6C, 0x6C, 0x71, 0x71, 0x78, 0x78, 0x84,
+0x84, 0x8A, 0x8A, 0x89, 0x89, 0x84, 0x84, 0x74, 0x74, 0x6D, 0x6D, 0x69, 0x69, 0x64, 0x64, 0x65,
+0x65, 0x63, 0x63, 0x63, 0x63, 0x65, 0x65, 0x6A, 0x6A, 0x7B, 0x7B, 0x96, 0x96, 0x9F, 0x9F, 0xA6,
+0xA6, 0xAA, 0xAA, 0xAC, 0xAC, 0xAC, 0xAC, 0xA9, 0xA9, 0xA4, 0xA4, 0x9A, 0x9A, 0x72, 0x72, 0x60,
+0x60, 0x56, 0x56, 0x50, 0x50, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x50, 0x50, 0x59, 0x59, 0x68,
+0x68, 0x9A, 0x9A, 0xAA, 0xAA, 0xB4, 0xB4, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBA, 0xBA, 0xB1,
+0xB1, 0xA5, 0xA5, 0x74, 0x74, 0x57, 0x57, 0x4A, 0x4A, 0x42, 0x42, 0x3D, 0x3D, 0x3C, 0x3C, 0x3F,
+0x3F, 0x45, 0x45, 0x51, 0x51, 0x67, 0x67, 0xA5, 0xA5, 0xB6, 0xB6, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB6, 0xB6, 0xA3, 0xA3, 0x60, 0x60, 0x4A, 0x4A, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x57, 0x57, 0x9D, 0x9D, 0xB8, 0xB8, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xAB, 0xAB, 0x61, 0x61, 0x46,
+0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x58, 0x58, 0xA7,
+0xA7, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xA2,
+0xA2, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48,
+0x48, 0x8F, 0x8F, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xAC, 0xAC, 0x57, 0x57, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x46, 0x46, 0x8E, 0x8E, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0xA5, 0xA5, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x52, 0x52, 0xAA, 0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB4, 0xB4, 0x5E, 0x5E, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0xA1, 0xA1, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB3, 0xB3, 0x5F, 0x5F, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x53, 0x53, 0xA8, 0xA8, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC0, 0xC0, 0xA4, 0xA4, 0x52, 0x52, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x49, 0x49, 0x83, 0x83, 0xB5, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF,
+0xBF, 0xA9, 0xA9, 0x5E, 0x5E, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x4C,
+0x4C, 0x70, 0x70, 0xAE, 0xAE, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB7, 0xB7, 0xA3,
+0xA3, 0x60, 0x60, 0x4C, 0x4C, 0x43, 0x43, 0x3F, 0x3F, 0x42, 0x42, 0x4A, 0x4A, 0x58, 0x58, 0x90,
+0x90, 0xAA, 0xAA, 0xB5, 0xB5, 0xB9, 0xB9, 0xB8, 0xB8, 0xB2, 0xB2, 0xA6, 0xA6, 0x8F, 0x8F, 0x5F,
+0x5F, 0x55, 0x55, 0x50, 0x50, 0x50, 0x50, 0x55, 0x55, 0x5D, 0x5D, 0x6D, 0x6D, 0x98, 0x98, 0xA2,
+0xA2, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0xA3, 0x9B, 0x9B, 0x8F, 0x8F, 0x70, 0x70, 0x6A, 0x6A, 0x6C,
+0x6C, 0x70, 0x70, 0x76, 0x76, 0x87, 0x87, 0x88, 0x88, 0x76, 0x76, 0x6F, 0x6F, 0x68, 0x68, 0x66,
+0x66, 0x65, 0x65, 0x66, 0x66, 0x6F, 0x6F, 0x93, 0x93, 0xA0, 0xA0, 0xA7, 0xA7, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA3, 0xA3, 0x95, 0x95, 0x64, 0x64, 0x56, 0x56, 0x4E, 0x4E, 0x4D, 0x4D, 0x4F, 0x4F, 0x58,
+0x58, 0x6F, 0x6F, 0xA4, 0xA4, 0xB2, 0xB2, 0xBB, 0xBB, 0xBC, 0xBC, 0xB7, 0xB7, 0xAA, 0xAA, 0x72,
+0x72, 0x51, 0x51, 0x44, 0x44, 0x3D, 0x3D, 0x3E, 0x3E, 0x45, 0x45, 0x59, 0x59, 0xA0, 0xA0, 0xB8,
+0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x9E, 0x9E, 0x52, 0x52, 0x3E, 0x3E, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C, 0x4C, 0x98, 0x98, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xA5, 0xA5, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48,
+0x48, 0x9E, 0x9E, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0x9D, 0x9D, 0x46,
+0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x50, 0x50, 0xB1, 0xB1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x5D, 0x5D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x91, 0x91, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9B,
+0x9B, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x5D, 0x5D, 0xBC, 0xBC, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA7, 0xA7, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x5A, 0x5A, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA1,
+0xA1, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x69, 0x69, 0xBF, 0xBF, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0x6F, 0x6F, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x49, 0x49, 0xA4, 0xA4, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAC, 0xAC, 0x53,
+0x53, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x66, 0x66, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x69, 0x69, 0x47, 0x47, 0x3C, 0x3C, 0x3C, 0x3C, 0x45, 0x45, 0x5B,
+0x5B, 0xA5, 0xA5, 0xB8, 0xB8, 0xC0, 0xC0, 0xBC, 0xBC, 0xAE, 0xAE, 0x83, 0x83, 0x52, 0x52, 0x47,
+0x47, 0x47, 0x47, 0x4E, 0x4E, 0x61, 0x61, 0x9D, 0x9D, 0xAC, 0xAC, 0xB2, 0xB2, 0xAE, 0xAE, 0xA3,
+0xA3, 0x7C, 0x7C, 0x5F, 0x5F, 0x59, 0x59, 0x5A, 0x5A, 0x5F, 0x5F, 0x6D, 0x6D, 0x94, 0x94, 0x9B,
+0x9B, 0x9A, 0x9A, 0x93, 0x93, 0x8A, 0x8A, 0x82, 0x82, 0x8B, 0x8B, 0x98, 0x98, 0x9B, 0x9B, 0x9A,
+0x9A, 0x8B, 0x8B, 0x66, 0x66, 0x5B, 0x5B, 0x56, 0x56, 0x5B, 0x5B, 0x66, 0x66, 0x9A, 0x9A, 0xAB,
+0xAB, 0xB1, 0xB1, 0xB0, 0xB0, 0xA5, 0xA5, 0x6A, 0x6A, 0x51, 0x51, 0x47, 0x47, 0x46, 0x46, 0x50,
+0x50, 0x75, 0x75, 0xAF, 0xAF, 0xBD, 0xBD, 0xC0, 0xC0, 0xB6, 0xB6, 0x9A, 0x9A, 0x51, 0x51, 0x3F,
+0x3F, 0x3B, 0x3B, 0x42, 0x42, 0x5B, 0x5B, 0xAD, 0xAD, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD,
+0xAD, 0x53, 0x53, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0xAB, 0xAB, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB6, 0xB6, 0x56, 0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x47, 0x47, 0xAA,
+0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x47, 0x47, 0xB1, 0xB1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x4A, 0x4A, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4D, 0x4D, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9,
+0xA9, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x6A, 0x6A, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0x61, 0x61, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0xB2, 0xB2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x6E,
+0x6E, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0x55, 0x55, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x53, 0x53, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0x75, 0x75, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x4C, 0x4C, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0x97, 0x97, 0x44,
+0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0xA7, 0xA7, 0xC1, 0xC1, 0xC4, 0xC4, 0xBB, 0xBB, 0x96,
+0x96, 0x4C, 0x4C, 0x3F, 0x3F, 0x42, 0x42, 0x55, 0x55, 0xA2, 0xA2, 0xB9, 0xB9, 0xBC, 0xBC, 0xB1,
+0xB1, 0x8D, 0x8D, 0x52, 0x52, 0x49, 0x49, 0x4F, 0x4F, 0x61, 0x61, 0x9E, 0x9E, 0xAB, 0xAB, 0xAB,
+0xAB, 0x9F, 0x9F, 0x74, 0x74, 0x62, 0x62, 0x5D, 0x5D, 0x62, 0x62, 0x72, 0x72, 0x92, 0x92, 0x93,
+0x93, 0x8A, 0x8A, 0x77, 0x77, 0x8A, 0x8A, 0x96, 0x96, 0x9F, 0x9F, 0x9C, 0x9C, 0x77, 0x77, 0x5E,
+0x5E, 0x56, 0x56, 0x58, 0x58, 0x6C, 0x6C, 0xA3, 0xA3, 0xAF, 0xAF, 0xB0, 0xB0, 0xA1, 0xA1, 0x5E,
+0x5E, 0x4A, 0x4A, 0x47, 0x47, 0x54, 0x54, 0x9A, 0x9A, 0xB6, 0xB6, 0xBE, 0xBE, 0xB6, 0xB6, 0x87,
+0x87, 0x49, 0x49, 0x3D, 0x3D, 0x43, 0x43, 0x61, 0x61, 0xB6, 0xB6, 0xC4, 0xC4, 0xC3, 0xC3, 0xAA,
+0xAA, 0x4D, 0x4D, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C, 0x4C, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC,
+0xBC, 0x59, 0x59, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x9F, 0x9F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x6E, 0x6E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x6C, 0x6C, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xA0, 0xA0, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x5F, 0x5F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xA5, 0xA5, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x58, 0x58, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xA8, 0xA8, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x5F, 0x5F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x9C, 0x9C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x70, 0x70, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x6A, 0x6A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xA4, 0xA4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0xB3, 0xB3, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6,
+0xB6, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x55, 0x55, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0x98,
+0x98, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x9B, 0x9B, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x56,
+0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x52, 0x52, 0xB4, 0xB4, 0xC4, 0xC4, 0xC1, 0xC1, 0x9C, 0x9C, 0x47,
+0x47, 0x3B, 0x3B, 0x46, 0x46, 0x94, 0x94, 0xBA, 0xBA, 0xBE, 0xBE, 0xAD, 0xAD, 0x5C, 0x5C, 0x46,
+0x46, 0x48, 0x48, 0x60, 0x60, 0xAB, 0xAB, 0xB6, 0xB6, 0xAD, 0xAD, 0x7D, 0x7D, 0x54, 0x54, 0x51,
+0x51, 0x5D, 0x5D, 0x97, 0x97, 0xA6, 0xA6, 0xA4, 0xA4, 0x92, 0x92, 0x69, 0x69, 0x66, 0x66, 0x6E,
+0x6E, 0x7D, 0x7D, 0x8D, 0x8D, 0x77, 0x77, 0x73, 0x73, 0x91, 0x91, 0x9D, 0x9D, 0x9F, 0x9F, 0x90,
+0x90, 0x5F, 0x5F, 0x55, 0x55, 0x5B, 0x5B, 0x93, 0x93, 0xAF, 0xAF, 0xB2, 0xB2, 0xA0, 0xA0, 0x56,
+0x56, 0x47, 0x47, 0x4E, 0x4E, 0x8F, 0x8F, 0xB6, 0xB6, 0xBB, 0xBB, 0xAA, 0xAA, 0x54, 0x54, 0x3F,
+0x3F, 0x43, 0x43, 0x6D, 0x6D, 0xBC, 0xBC, 0xC4, 0xC4, 0xB3, 0xB3, 0x52, 0x52, 0x3B, 0x3B, 0x3B,
+0x3B, 0x64, 0x64, 0xC0, 0xC0, 0xC4, 0xC4, 0xB8, 0xB8, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x67,
+0x67, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x6B, 0x6B, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x9A, 0x9A, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB5, 0xB5, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xAD, 0xAD, 0xC4, 0xC4, 0xC4, 0xC4, 0xA8,
+0xA8, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0x64, 0x64, 0x3B,
+0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B,
+0x3B, 0x6D, 0x6D, 0xC4, 0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xB7,
+0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0x70, 0x70, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C, 0x4C, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0xA3, 0xA3, 0xC4, 0xC4, 0xC4, 0xC4, 0xA3,
+0xA3, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0xC0, 0xC0, 0xC4, 0xC4, 0xC1, 0xC1, 0x4E, 0x4E, 0x3B,
+0x3B, 0x3B, 0x3B, 0xA1, 0xA1, 0xC4, 0xC4, 0xC4, 0xC4, 0x9A, 0x9A, 0x3B, 0x3B, 0x3B, 0x3B, 0x52,
+0x52, 0xBD, 0xBD, 0xC4, 0xC4, 0xB6, 0xB6, 0x4D, 0x4D, 0x3B, 0x3B, 0x43, 0x43, 0xA4, 0xA4, 0xC3,
+0xC3, 0xBE, 0xBE, 0x6B, 0x6B, 0x40, 0x40, 0x40, 0x40, 0x68, 0x68, 0xBA, 0xBA, 0xBE, 0xBE, 0xA3,
+0xA3, 0x4D, 0x4D, 0x43, 0x43, 0x59, 0x59, 0xA9, 0xA9, 0xB4, 0xB4, 0xA7, 0xA7, 0x5F, 0x5F, 0x50,
+0x50, 0x57, 0x57, 0x9A, 0x9A, 0xAC, 0xAC, 0xA6, 0xA6, 0x70, 0x70, 0x5E, 0x5E, 0x62, 0x62, 0x7E,
+0x7E, 0x9A, 0x9A, 0x97, 0x97, 0x87, 0x87, 0x74, 0x74, 0x89, 0x89, 0x88, 0x88, 0x6C, 0x6C, 0x65,
+0x65, 0x71, 0x71, 0x9B, 0x9B, 0xA2, 0xA2, 0x97, 0x97, 0x60, 0x60, 0x56, 0x56, 0x61, 0x61, 0xA2,
+0xA2, 0xB0, 0xB0, 0xA5, 0xA5, 0x5C, 0x5C, 0x4A, 0x4A, 0x54, 0x54, 0xA5, 0xA5, 0xBA, 0xBA, 0xB1,
+0xB1, 0x5A, 0x5A, 0x43, 0x43, 0x4B, 0x4B, 0xA4, 0xA4, 0xC0, 0xC0, 0xB8, 0xB8, 0x5D, 0x5D, 0x3C,
+0x3C, 0x44, 0x44, 0xA4, 0xA4, 0xC4, 0xC4, 0xBF, 0xBF, 0x5C, 0x5C, 0x3B, 0x3B, 0x3D, 0x3D, 0xA2,
+0xA2, 0xC4, 0xC4, 0xC3, 0xC3, 0x5C, 0x5C, 0x3B, 0x3B, 0x3B, 0x3B, 0xA4, 0xA4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x5A, 0x5A, 0x3B, 0x3B, 0x3B, 0x3B, 0xA6, 0xA6, 0xC4, 0xC4, 0xC4, 0xC4, 0x58, 0x58, 0x3B,
+0x3B, 0x3B, 0x3B, 0xAD, 0xAD, 0xC4, 0xC4, 0xC4, 0xC4, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0xB3,
+0xB3, 0xC4, 0xC4, 0xC4, 0xC4, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4,
+0xC4, 0x3F, 0x3F, 0x3B, 0x3B, 0x40, 0x40, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4A, 0x4A, 0xC4, 0xC4, 0xC4, 0xC4, 0xAE, 0xAE, 0x3B, 0x3B, 0x3B, 0x3B, 0x5A, 0x5A, 0xC4,
+0xC4, 0xC4, 0xC4, 0x84, 0x84, 0x3B, 0x3B, 0x3B, 0x3B, 0xA0, 0xA0, 0xC4, 0xC4, 0xC4, 0xC4, 0x51,
+0x51, 0x3B, 0x3B, 0x3B, 0x3B, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0x3F, 0x3F, 0x3B, 0x3B, 0x41,
+0x41, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3, 0xB3, 0x3B, 0x3B, 0x3B, 0x3B, 0x5B, 0x5B, 0xC4, 0xC4, 0xC4,
+0xC4, 0x6F, 0x6F, 0x3B, 0x3B, 0x3B, 0x3B, 0xA8, 0xA8, 0xC4, 0xC4, 0xC4, 0xC4, 0x49, 0x49, 0x3B,
+0x3B, 0x40, 0x40, 0xC3, 0xC3, 0xC4, 0xC4, 0xB3, 0xB3, 0x3B, 0x3B, 0x3B, 0x3B, 0x5E, 0x5E, 0xC4,
+0xC4, 0xC4, 0xC4, 0x68, 0x68, 0x3B, 0x3B, 0x3B, 0x3B, 0xAE, 0xAE, 0xC4, 0xC4, 0xBD, 0xBD, 0x44,
+0x44, 0x3B, 0x3B, 0x50, 0x50, 0xC2, 0xC2, 0xC4, 0xC4, 0x9B, 0x9B, 0x3B, 0x3B, 0x3B, 0x3B, 0x9C,
+0x9C, 0xC4, 0xC4, 0xBD, 0xBD, 0x54, 0x54, 0x3B, 0x3B, 0x4F, 0x4F, 0xB6, 0xB6, 0xC2, 0xC2, 0x9E,
+0x9E, 0x42, 0x42, 0x42, 0x42, 0x95, 0x95, 0xBD, 0xBD, 0xB5, 0xB5, 0x5A, 0x5A, 0x44, 0x44, 0x55,
+0x55, 0xAC, 0xAC, 0xB7, 0xB7, 0x9C, 0x9C, 0x4F, 0x4F, 0x50, 0x50, 0x90, 0x90, 0xAD, 0xAD, 0xA7,
+0xA7, 0x60, 0x60, 0x53, 0x53, 0x64, 0x64, 0xA1, 0xA1, 0xA4, 0xA4, 0x8C, 0x8C, 0x61, 0x61, 0x65,
+0x65, 0x8C, 0x8C, 0x9C, 0x9C, 0x94, 0x94, 0x6E, 0x6E, 0x6C, 0x6C, 0x78, 0x78, 0x77, 0x77, 0x8A,
+0x8A, 0x85, 0x85, 0x92, 0x92, 0x93, 0x93, 0x6C, 0x6C, 0x60, 0x60, 0x6B, 0x6B, 0x9F, 0x9F, 0xA5,
+0xA5, 0x83, 0x83, 0x59, 0x59, 0x5C, 0x5C, 0x9B, 0x9B, 0xAC, 0xAC, 0x9E, 0x9E, 0x56, 0x56, 0x52,
+0x52, 0x87, 0x87, 0xB1, 0xB1, 0xAC, 0xAC, 0x5C, 0x5C, 0x48, 0x48, 0x5B, 0x5B, 0xB2, 0xB2, 0xB9,
+0xB9, 0x82, 0x82, 0x44, 0x44, 0x4C, 0x4C, 0xA9, 0xA9, 0xBF, 0xBF, 0xA7, 0xA7, 0x48, 0x48, 0x43,
+0x43, 0x96, 0x96, 0xC2, 0xC2, 0xB5, 0xB5, 0x4B, 0x4B, 0x3B, 0x3B, 0x5D, 0x5D, 0xC2, 0xC2, 0xC3,
+0xC3, 0x5A, 0x5A, 0x3B, 0x3B, 0x47, 0x47, 0xBD, 0xBD, 0xC4, 0xC4, 0x99, 0x99, 0x3B, 0x3B, 0x3D,
+0x3D, 0xB2, 0xB2, 0xC4, 0xC4, 0xB0, 0xB0, 0x3B, 0x3B, 0x3B, 0x3B, 0xA1, 0xA1, 0xC4, 0xC4, 0xBF,
+0xBF, 0x3F, 0x3F, 0x3B, 0x3B, 0x5F, 0x5F, 0xC4, 0xC4, 0xC4, 0xC4, 0x49, 0x49, 0x3B, 0x3B, 0x4E,
+0x4E, 0xC4, 0xC4, 0xC4, 0xC4, 0x57, 0x57, 0x3B, 0x3B, 0x3F, 0x3F, 0xC4, 0xC4, 0xC4, 0xC4, 0x91,
+0x91, 0x3B, 0x3B, 0x3B, 0x3B, 0xBF, 0xBF, 0xC4, 0xC4, 0xAC, 0xAC, 0x3B, 0x3B, 0x3B, 0x3B, 0xB9,
+0xB9, 0xC4, 0xC4, 0xB4, 0xB4, 0x3B, 0x3B, 0x3B, 0x3B, 0xAE, 0xAE, 0xC4, 0xC4, 0xBF, 0xBF, 0x3B,
+0x3B, 0x3B, 0x3B, 0x9C, 0x9C, 0xC4, 0xC4, 0xC4, 0xC4, 0x3B, 0x3B, 0x3B, 0x3B, 0x7A, 0x7A, 0xC4,
+0xC4, 0xC4, 0xC4, 0x3B, 0x3B, 0x3B, 0x3B, 0x62, 0x62, 0xC4, 0xC4, 0xC4, 0xC4, 0x3D, 0x3D, 0x3B,
+0x3B, 0x58, 0x58, 0xC4, 0xC4, 0xC4, 0xC4, 0x41, 0x41, 0x3B, 0x3B, 0x50, 0x50, 0xC4, 0xC4, 0xC4,
+0xC4, 0x44, 0x44, 0x3B, 0x3B, 0x51, 0x51, 0xC4, 0xC4, 0xC4, 0xC4, 0x44, 0x44, 0x3B, 0x3B, 0x51,
+0x51, 0xC4, 0xC4, 0xC4, 0xC4, 0x45, 0x45, 0x3B, 0x3B, 0x51, 0x51, 0xC4, 0xC4, 0xC4, 0xC4, 0x43,
+0x43, 0x3B, 0x3B, 0x55, 0x55, 0xC4, 0xC4, 0xC4, 0xC4, 0x44, 0x44, 0x3B, 0x3B, 0x56, 0x56, 0xC4,
+0xC4, 0xC4, 0xC4, 0x42, 0x42, 0x3B, 0x3B, 0x60, 0x60, 0xC4, 0xC4, 0xC4, 0xC4, 0x3D, 0x3D, 0x3B,
+0x3B, 0x89, 0x89, 0xC4, 0xC4, 0xC0, 0xC0, 0x3C, 0x3C, 0x3B, 0x3B, 0x9B, 0x9B, 0xC4, 0xC4, 0xBA,
+0xBA, 0x3B, 0x3B, 0x3B, 0x3B, 0xA3, 0xA3, 0xC4, 0xC4, 0xB5, 0xB5, 0x3B, 0x3B, 0x3B, 0x3B, 0xB1,
+0xB1, 0xC4, 0xC4, 0xA4, 0xA4, 0x3B, 0x3B, 0x40, 0x40, 0xB7, 0xB7, 0xC4, 0xC4, 0x8E, 0x8E, 0x3B,
+0x3B, 0x48, 0x48, 0xBA, 0xBA, 0xC3, 0xC3, 0x64, 0x64, 0x3B, 0x3B, 0x52, 0x52, 0xBD, 0xBD, 0xBE,
+0xBE, 0x57, 0x57, 0x3D, 0x3D, 0x5E, 0x5E, 0xBC, 0xBC, 0xB6, 0xB6, 0x52, 0x52, 0x44, 0x44, 0x88,
+0x88, 0xB9, 0xB9, 0xA9, 0xA9, 0x50, 0x50, 0x4C, 0x4C, 0x9C, 0x9C, 0xB7, 0xB7, 0x9B, 0x9B, 0x4E,
+0x4E, 0x54, 0x54, 0xA4, 0xA4, 0xAF, 0xAF, 0x78, 0x78, 0x53, 0x53, 0x60, 0x60, 0xA3, 0xA3, 0xA5,
+0xA5, 0x6B, 0x6B, 0x5C, 0x5C, 0x6D, 0x6D, 0xA2, 0xA2, 0x9D, 0x9D, 0x64, 0x64, 0x60, 0x60, 0x8B,
+0x8B, 0x9A, 0x9A, 0x8E, 0x8E, 0x6F, 0x6F, 0x75, 0x75, 0x79, 0x79, 0x6F, 0x6F, 0x7D, 0x7D, 0x99,
+0x99, 0x94, 0x94, 0x64, 0x64, 0x60, 0x60, 0x95, 0x95, 0xA6, 0xA6, 0x8E, 0x8E, 0x5B, 0x5B, 0x60,
+0x60, 0xA1, 0xA1, 0xA9, 0xA9, 0x6B, 0x6B, 0x54, 0x54, 0x68, 0x68, 0xAA, 0xAA, 0xA6, 0xA6, 0x5A,
+0x5A, 0x50, 0x50, 0x95, 0x95, 0xB4, 0xB4, 0x9F, 0x9F, 0x4C, 0x4C, 0x53, 0x53, 0xAA, 0xAA, 0xB6,
+0xB6, 0x67, 0x67, 0x45, 0x45, 0x5D, 0x5D, 0xB9, 0xB9, 0xB4, 0xB4, 0x50, 0x50, 0x41, 0x41, 0x98,
+0x98, 0xC2, 0xC2, 0xA9, 0xA9, 0x42, 0x42, 0x47, 0x47, 0xB3, 0xB3, 0xBF, 0xBF, 0x61, 0x61, 0x3D,
+0x3D, 0x5D, 0x5D, 0xC2, 0xC2, 0xB8, 0xB8, 0x45, 0x45, 0x3B, 0x3B, 0xA9, 0xA9, 0xC4, 0xC4, 0x9E,
+0x9E, 0x3B, 0x3B, 0x46, 0x46, 0xC2, 0xC2, 0xC4, 0xC4, 0x4E, 0x4E, 0x3B, 0x3B, 0x76, 0x76, 0xC4,
+0xC4, 0xB5, 0xB5, 0x3B, 0x3B, 0x3B, 0x3B, 0xBA, 0xBA, 0xC4, 0xC4, 0x62, 0x62, 0x3B, 0x3B, 0xBF,
+0xBF, 0xC4, 0xC4, 0xBB, 0xBB, 0x62, 0x62, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xB0, 0xB0, 0x94,
+0x94, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x7C, 0x7C, 0x9B, 0x9B, 0xC4, 0xC4, 0xC4, 0xC4, 0xA5,
+0xA5, 0x48, 0x48, 0x8C, 0x8C, 0xC4, 0xC4, 0xB4, 0xB4, 0x40, 0x40, 0x3B, 0x3B, 0x8F, 0x8F, 0xAD,
+0xAD, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x76, 0x76, 0x57, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0x45,
+0x45, 0x76, 0x76, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x8E, 0x8E, 0x75, 0x75, 0x3B, 0x3B, 0x3B,
+0x3B, 0x61, 0x61, 0xBA, 0xBA, 0x8E, 0x8E, 0x3E, 0x3E, 0xB8, 0xB8, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB4,
+0xB4, 0xA9, 0xA9, 0x95, 0x95, 0x61, 0x61, 0x52, 0x52, 0x47, 0x47, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x46,
+0x46, 0x51, 0x51, 0x5F, 0x5F, 0x90, 0x90, 0xA6, 0xA6, 0xB2, 0xB2, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD,
+0xBD, 0xB4, 0xB4, 0xA9, 0xA9, 0x97, 0x97, 0x64, 0x64, 0x53, 0x53, 0x49, 0x49, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x42, 0x42, 0x4A, 0x4A, 0x55, 0x55, 0x64, 0x64, 0x98, 0x98, 0xA9, 0xA9, 0xB4, 0xB4, 0xBC,
+0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB6, 0xB6, 0xAC, 0xAC, 0x9F, 0x9F, 0x6E, 0x6E, 0x5A, 0x5A, 0x4E,
+0x4E, 0x46, 0x46, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x43, 0x43, 0x4B, 0x4B, 0x55, 0x55, 0x64, 0x64, 0x95,
+0x95, 0xA6, 0xA6, 0xB1, 0xB1, 0xB9, 0xB9, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBB, 0xBB, 0xB3, 0xB3, 0xA9,
+0xA9, 0x9A, 0x9A, 0x6A, 0x6A, 0x59, 0x59, 0x4E, 0x4E, 0x46, 0x46, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41,
+0x41, 0x48, 0x48, 0x51, 0x51, 0x5C, 0x5C, 0x71, 0x71, 0x9E, 0x9E, 0xAA, 0xAA, 0xB4, 0xB4, 0xBB,
+0xBB, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBA, 0xBA, 0xB3, 0xB3, 0xAA, 0xAA, 0x9E, 0x9E, 0x73, 0x73, 0x5E,
+0x5E, 0x52, 0x52, 0x4A, 0x4A, 0x43, 0x43, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x44, 0x44, 0x4A, 0x4A, 0x53,
+0x53, 0x5E, 0x5E, 0x72, 0x72, 0x9D, 0x9D, 0xA9, 0xA9, 0xB2, 0xB2, 0xB9, 0xB9, 0xBE, 0xBE, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2,
+0xC2, 0xBC, 0xBC, 0xB7, 0xB7, 0xAF, 0xAF, 0xA6, 0xA6, 0x98, 0x98, 0x6A, 0x6A, 0x5B, 0x5B, 0x51,
+0x51, 0x4A, 0x4A, 0x44, 0x44, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x44, 0x44, 0x4A, 0x4A, 0x51, 0x51, 0x5A,
+0x5A, 0x67, 0x67, 0x94, 0x94, 0xA3, 0xA3, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBF, 0xBF, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0,
+0xC0, 0xBB, 0xBB, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6, 0xA6, 0x9A, 0x9A, 0x70, 0x70, 0x5F, 0x5F, 0x55,
+0x55, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x42, 0x42, 0x47, 0x47, 0x4C, 0x4C, 0x54,
+0x54, 0x5D, 0x5D, 0x6A, 0x6A, 0x95, 0x95, 0xA3, 0xA3, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD,
+0xBD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3,
+0xC3, 0xC0, 0xC0, 0xBB, 0xBB, 0xB6, 0xB6, 0xB1, 0xB1, 0xAA, 0xAA, 0xA1, 0xA1, 0x92, 0x92, 0x69,
+0x69, 0x5C, 0x5C, 0x54, 0x54, 0x4D, 0x4D, 0x48, 0x48, 0x43, 0x43, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x43, 0x43, 0x47,
+0x47, 0x4D, 0x4D, 0x53, 0x53, 0x5B, 0x5B, 0x66, 0x66, 0x8D, 0x8D, 0x9E, 0x9E, 0xA7, 0xA7, 0xAE,
+0xAE, 0xB4, 0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0, 0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAF, 0xAF, 0xA8,
+0xA8, 0x9F, 0x9F, 0x91, 0x91, 0x6A, 0x6A, 0x5E, 0x5E, 0x56, 0x56, 0x4F, 0x4F, 0x4A, 0x4A, 0x46,
+0x46, 0x42, 0x42, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x47, 0x47, 0x4B, 0x4B, 0x51, 0x51, 0x57, 0x57, 0x60, 0x60, 0x6C,
+0x6C, 0x94, 0x94, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE, 0xAE, 0xB3, 0xB3, 0xB8, 0xB8, 0xBB, 0xBB, 0xBF,
+0xBF, 0xC1, 0xC1, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBF, 0xBF, 0xBB,
+0xBB, 0xB8, 0xB8, 0xB3, 0xB3, 0xAE, 0xAE, 0xA9, 0xA9, 0xA1, 0xA1, 0x96, 0x96, 0x71, 0x71, 0x63,
+0x63, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x49, 0x49, 0x45, 0x45, 0x42, 0x42, 0x3F, 0x3F, 0x3D,
+0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x40, 0x40, 0x42, 0x42, 0x46, 0x46, 0x4A,
+0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x5A, 0x5A, 0x62, 0x62, 0x6F, 0x6F, 0x94, 0x94, 0x9F, 0x9F, 0xA6,
+0xA6, 0xAD, 0xAD, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBC, 0xBC, 0xBF, 0xBF, 0xC1, 0xC1, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0xC2, 0xC2, 0xC0, 0xC0, 0xBD, 0xBD, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAF,
+0xAF, 0xAA, 0xAA, 0xA3, 0xA3, 0x9B, 0x9B, 0x8C, 0x8C, 0x6A, 0x6A, 0x5F, 0x5F, 0x58, 0x58, 0x53,
+0x53, 0x4E, 0x4E, 0x4A, 0x4A, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x3F, 0x3F, 0x3D, 0x3D, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x3E, 0x3E, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x48, 0x48, 0x4C, 0x4C, 0x50, 0x50, 0x55,
+0x55, 0x5B, 0x5B, 0x63, 0x63, 0x6F, 0x6F, 0x92, 0x92, 0x9D, 0x9D, 0xA5, 0xA5, 0xAA, 0xAA, 0xAF,
+0xAF, 0xB3, 0xB3, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xC0, 0xC0, 0xC2, 0xC2, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC2, 0xC2, 0xC0,
+0xC0, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5,
+0xA5, 0x9E, 0x9E, 0x95, 0x95, 0x73, 0x73, 0x65, 0x65, 0x5D, 0x5D, 0x57, 0x57, 0x52, 0x52, 0x4E,
+0x4E, 0x4A, 0x4A, 0x47, 0x47, 0x44, 0x44, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3D, 0x3D, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x40,
+0x40, 0x42, 0x42, 0x44, 0x44, 0x47, 0x47, 0x4A, 0x4A, 0x4E, 0x4E, 0x52, 0x52, 0x57, 0x57, 0x5D,
+0x5D, 0x64, 0x64, 0x70, 0x70, 0x92, 0x92, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2,
+0xB2, 0xB5, 0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD,
+0xBD, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0xA0,
+0xA0, 0x98, 0x98, 0x89, 0x89, 0x6A, 0x6A, 0x61, 0x61, 0x5B, 0x5B, 0x55, 0x55, 0x51, 0x51, 0x4D,
+0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x41, 0x43,
+0x43, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x59, 0x59, 0x60,
+0x60, 0x68, 0x68, 0x77, 0x77, 0x95, 0x95, 0x9E, 0x9E, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1,
+0xB1, 0xB4, 0xB4, 0xB7, 0xB7, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF, 0xBF, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB,
+0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAE, 0xAE, 0xAA, 0xAA, 0xA5, 0xA5, 0x9F,
+0x9F, 0x98, 0x98, 0x8B, 0x8B, 0x6B, 0x6B, 0x62, 0x62, 0x5C, 0x5C, 0x57, 0x57, 0x53, 0x53, 0x4F,
+0x4F, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x40,
+0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x44,
+0x44, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x51, 0x51, 0x54, 0x54, 0x59, 0x59, 0x5E,
+0x5E, 0x65, 0x65, 0x70, 0x70, 0x91, 0x91, 0x9B, 0x9B, 0xA1, 0xA1, 0xA7, 0xA7, 0xAB, 0xAB, 0xAF,
+0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB,
+0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2,
+0xA2, 0x9B, 0x9B, 0x92, 0x92, 0x73, 0x73, 0x67, 0x67, 0x60, 0x60, 0x5A, 0x5A, 0x56, 0x56, 0x52,
+0x52, 0x4E, 0x4E, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x42,
+0x42, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44,
+0x44, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5C,
+0x5C, 0x61, 0x61, 0x69, 0x69, 0x79, 0x79, 0x94, 0x94, 0x9D, 0x9D, 0xA3, 0xA3, 0xA7, 0xA7, 0xAC,
+0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB,
+0xBB, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9, 0xA9, 0xA5,
+0xA5, 0xA0, 0xA0, 0x99, 0x99, 0x8E, 0x8E, 0x6F, 0x6F, 0x65, 0x65, 0x5F, 0x5F, 0x59, 0x59, 0x55,
+0x55, 0x52, 0x52, 0x4E, 0x4E, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x46, 0x46, 0x44, 0x44, 0x43,
+0x43, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x44,
+0x44, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x51, 0x51, 0x54, 0x54, 0x59,
+0x59, 0x5D, 0x5D, 0x64, 0x64, 0x6C, 0x6C, 0x8A, 0x8A, 0x97, 0x97, 0x9E, 0x9E, 0xA4, 0xA4, 0xA8,
+0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB,
+0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB7, 0xB7, 0xB4, 0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA8,
+0xA8, 0xA3, 0xA3, 0x9D, 0x9D, 0x96, 0x96, 0x87, 0x87, 0x6B, 0x6B, 0x63, 0x63, 0x5D, 0x5D, 0x58,
+0x58, 0x54, 0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x44,
+0x44, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x44,
+0x44, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x56,
+0x56, 0x5B, 0x5B, 0x60, 0x60, 0x67, 0x67, 0x72, 0x72, 0x91, 0x91, 0x9A, 0x9A, 0xA1, 0xA1, 0xA6,
+0xA6, 0xAA, 0xAA, 0xAE, 0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9,
+0xA9, 0xA5, 0xA5, 0xA0, 0xA0, 0x99, 0x99, 0x8F, 0x8F, 0x70, 0x70, 0x66, 0x66, 0x5F, 0x5F, 0x5A,
+0x5A, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x44,
+0x44, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43,
+0x43, 0x44, 0x44, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x55,
+0x55, 0x5A, 0x5A, 0x5F, 0x5F, 0x65, 0x65, 0x6F, 0x6F, 0x8F, 0x8F, 0x9A, 0x9A, 0xA0, 0xA0, 0xA5,
+0xA5, 0xAA, 0xAA, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xB1, 0xB1, 0xAD, 0xAD, 0xA9,
+0xA9, 0xA5, 0xA5, 0xA0, 0xA0, 0x99, 0x99, 0x8E, 0x8E, 0x6E, 0x6E, 0x65, 0x65, 0x5E, 0x5E, 0x59,
+0x59, 0x55, 0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x44,
+0x44, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x43,
+0x43, 0x44, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x57,
+0x57, 0x5B, 0x5B, 0x61, 0x61, 0x69, 0x69, 0x7C, 0x7C, 0x95, 0x95, 0x9D, 0x9D, 0xA3, 0xA3, 0xA8,
+0xA8, 0xAC, 0xAC, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB, 0xBB, 0xBD,
+0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA7,
+0xA7, 0xA1, 0xA1, 0x9A, 0x9A, 0x90, 0x90, 0x6F, 0x6F, 0x65, 0x65, 0x5E, 0x5E, 0x59, 0x59, 0x54,
+0x54, 0x50, 0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x44, 0x44, 0x43, 0x43, 0x42,
+0x42, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x44,
+0x44, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5C,
+0x5C, 0x63, 0x63, 0x6C, 0x6C, 0x8C, 0x8C, 0x99, 0x99, 0xA0, 0xA0, 0xA6, 0xA6, 0xAB, 0xAB, 0xAF,
+0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF,
+0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB,
+0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xB1, 0xB1, 0xAD, 0xAD, 0xA8, 0xA8, 0xA3, 0xA3, 0x9C,
+0x9C, 0x93, 0x93, 0x72, 0x72, 0x66, 0x66, 0x5E, 0x5E, 0x58, 0x58, 0x54, 0x54, 0x50, 0x50, 0x4C,
+0x4C, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x44, 0x44, 0x46,
+0x46, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x65, 0x65, 0x72,
+0x72, 0x93, 0x93, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5, 0xB5, 0xB8,
+0xB8, 0xBA, 0xBA, 0xBD, 0xBD, 0xBE, 0xBE, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB5,
+0xB5, 0xB2, 0xB2, 0xAE, 0xAE, 0xAA, 0xAA, 0xA4, 0xA4, 0x9D, 0x9D, 0x93, 0x93, 0x71, 0x71, 0x65,
+0x65, 0x5D, 0x5D, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x43,
+0x43, 0x41, 0x41, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E,
+0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4C, 0x4C, 0x50,
+0x50, 0x55, 0x55, 0x5A, 0x5A, 0x61, 0x61, 0x6C, 0x6C, 0x8E, 0x8E, 0x9B, 0x9B, 0xA3, 0xA3, 0xA9,
+0xA9, 0xAE, 0xAE, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xC0, 0xC0, 0xC1,
+0xC1, 0xC2, 0xC2, 0xC3, 0xC3, 0xC4, 0xC4, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xC0,
+0xC0, 0xBF, 0xBF, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAF, 0xAF, 0xAA, 0xAA, 0xA4,
+0xA4, 0x9C, 0x9C, 0x8F, 0x8F, 0x6C, 0x6C, 0x61, 0x61, 0x5A, 0x5A, 0x54, 0x54, 0x4F, 0x4F, 0x4B,
+0x4B, 0x47, 0x47, 0x44, 0x44, 0x42, 0x42, 0x40, 0x40, 0x3E, 0x3E, 0x3D, 0x3D, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x41, 0x41, 0x44,
+0x44, 0x47, 0x47, 0x4A, 0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x59, 0x59, 0x60, 0x60, 0x6B, 0x6B, 0x8F,
+0x8F, 0x9D, 0x9D, 0xA5, 0xA5, 0xAB, 0xAB, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xBC, 0xBC, 0xBE,
+0xBE, 0xC1, 0xC1, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBF, 0xBF, 0xBD, 0xBD, 0xBA, 0xBA, 0xB6, 0xB6, 0xB2,
+0xB2, 0xAD, 0xAD, 0xA7, 0xA7, 0xA0, 0xA0, 0x94, 0x94, 0x6F, 0x6F, 0x62, 0x62, 0x5A, 0x5A, 0x53,
+0x53, 0x4E, 0x4E, 0x4A, 0x4A, 0x46, 0x46, 0x43, 0x43, 0x40, 0x40, 0x3E, 0x3E, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3E,
+0x3E, 0x40, 0x40, 0x43, 0x43, 0x46, 0x46, 0x4A, 0x4A, 0x4E, 0x4E, 0x54, 0x54, 0x5B, 0x5B, 0x63,
+0x63, 0x75, 0x75, 0x98, 0x98, 0xA3, 0xA3, 0xAA, 0xAA, 0xB0, 0xB0, 0xB5, 0xB5, 0xB9, 0xB9, 0xBD,
+0xBD, 0xC0, 0xC0, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBF, 0xBF, 0xBB, 0xBB, 0xB8,
+0xB8, 0xB3, 0xB3, 0xAE, 0xAE, 0xA7, 0xA7, 0x9E, 0x9E, 0x90, 0x90, 0x6A, 0x6A, 0x5E, 0x5E, 0x56,
+0x56, 0x50, 0x50, 0x4A, 0x4A, 0x46, 0x46, 0x42, 0x42, 0x3F, 0x3F, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x41, 0x41, 0x44, 0x44, 0x48, 0x48, 0x4D, 0x4D, 0x53, 0x53, 0x5A, 0x5A, 0x64,
+0x64, 0x7B, 0x7B, 0x9B, 0x9B, 0xA5, 0xA5, 0xAC, 0xAC, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC, 0xBC, 0xC0,
+0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE, 0xBE, 0xBB, 0xBB, 0xB6,
+0xB6, 0xB0, 0xB0, 0xA9, 0xA9, 0xA0, 0xA0, 0x93, 0x93, 0x6A, 0x6A, 0x5D, 0x5D, 0x54, 0x54, 0x4E,
+0x4E, 0x48, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x40, 0x40, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x56, 0x56, 0x5F, 0x5F, 0x70, 0x70, 0x98,
+0x98, 0xA5, 0xA5, 0xAD, 0xAD, 0xB4, 0xB4, 0xB9, 0xB9, 0xBE, 0xBE, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBF, 0xBF, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6,
+0xA6, 0x9B, 0x9B, 0x73, 0x73, 0x60, 0x60, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x43, 0x43, 0x3E,
+0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x44, 0x44, 0x49,
+0x49, 0x50, 0x50, 0x58, 0x58, 0x64, 0x64, 0x8F, 0x8F, 0xA1, 0xA1, 0xAB, 0xAB, 0xB3, 0xB3, 0xB9,
+0xB9, 0xBE, 0xBE, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0,
+0xC0, 0xBB, 0xBB, 0xB6, 0xB6, 0xAE, 0xAE, 0xA5, 0xA5, 0x97, 0x97, 0x6A, 0x6A, 0x5B, 0x5B, 0x51,
+0x51, 0x49, 0x49, 0x44, 0x44, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x42, 0x42, 0x48, 0x48, 0x4F, 0x4F, 0x58, 0x58, 0x66, 0x66, 0x94, 0x94, 0xA4,
+0xA4, 0xAE, 0xAE, 0xB6, 0xB6, 0xBD, 0xBD, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB8, 0xB8, 0xB0, 0xB0, 0xA6, 0xA6, 0x98, 0x98, 0x67,
+0x67, 0x58, 0x58, 0x4F, 0x4F, 0x47, 0x47, 0x41, 0x41, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x45, 0x45, 0x4C, 0x4C, 0x56, 0x56, 0x63, 0x63, 0x93,
+0x93, 0xA5, 0xA5, 0xB0, 0xB0, 0xB8, 0xB8, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBC, 0xBC, 0xB5, 0xB5, 0xAB, 0xAB, 0x9E, 0x9E, 0x6D,
+0x6D, 0x5A, 0x5A, 0x4F, 0x4F, 0x46, 0x46, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x47, 0x47, 0x4F, 0x4F, 0x5B, 0x5B, 0x72, 0x72, 0xA0,
+0xA0, 0xAD, 0xAD, 0xB7, 0xB7, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBB, 0xBB, 0xB3, 0xB3, 0xA7, 0xA7, 0x94, 0x94, 0x62, 0x62, 0x53,
+0x53, 0x48, 0x48, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x47, 0x47, 0x51, 0x51, 0x5F, 0x5F, 0x92, 0x92, 0xA7, 0xA7, 0xB3, 0xB3, 0xBC,
+0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBC,
+0xBC, 0xB3, 0xB3, 0xA7, 0xA7, 0x8F, 0x8F, 0x5E, 0x5E, 0x4F, 0x4F, 0x45, 0x45, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x45, 0x45, 0x4F, 0x4F, 0x5E,
+0x5E, 0x91, 0x91, 0xA8, 0xA8, 0xB5, 0xB5, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB7, 0xB7, 0xAB, 0xAB, 0x97, 0x97, 0x61, 0x61, 0x50,
+0x50, 0x45, 0x45, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F,
+0x3F, 0x49, 0x49, 0x55, 0x55, 0x6C, 0x6C, 0xA2, 0xA2, 0xB1, 0xB1, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB5, 0xB5, 0xA7, 0xA7, 0x80,
+0x80, 0x58, 0x58, 0x4A, 0x4A, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x48, 0x48, 0x56, 0x56, 0x72, 0x72, 0xA5, 0xA5, 0xB4, 0xB4, 0xBF, 0xBF, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB7, 0xB7, 0xAA, 0xAA, 0x8F,
+0x8F, 0x5A, 0x5A, 0x4A, 0x4A, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x4F, 0x4F, 0x63, 0x63, 0x9E, 0x9E, 0xB1, 0xB1, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB4, 0xB4, 0xA3, 0xA3, 0x68, 0x68, 0x52,
+0x52, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x50,
+0x50, 0x66, 0x66, 0xA2, 0xA2, 0xB3, 0xB3, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC2, 0xC2, 0xB7, 0xB7, 0xA8, 0xA8, 0x74, 0x74, 0x55, 0x55, 0x46, 0x46, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x48, 0x48, 0x58, 0x58, 0x90, 0x90, 0xAC, 0xAC, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB6, 0xB6, 0xA6, 0xA6, 0x6B,
+0x6B, 0x51, 0x51, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x53,
+0x53, 0x70, 0x70, 0xA8, 0xA8, 0xB8, 0xB8, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xB0, 0xB0, 0x9A, 0x9A, 0x5D, 0x5D, 0x4A, 0x4A, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x45, 0x45, 0x54, 0x54, 0x77, 0x77, 0xAA, 0xAA, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xB5, 0xB5, 0xA3, 0xA3, 0x65, 0x65, 0x4E, 0x4E, 0x41, 0x41, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x49, 0x49, 0x5A, 0x5A, 0x97, 0x97, 0xAF, 0xAF, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC2, 0xC2, 0xB6, 0xB6, 0xA5, 0xA5, 0x69, 0x69, 0x50, 0x50, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x50, 0x50, 0x67, 0x67, 0xA4, 0xA4, 0xB5, 0xB5, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0,
+0xC0, 0xB5, 0xB5, 0xA4, 0xA4, 0x69, 0x69, 0x51, 0x51, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4B,
+0x4B, 0x5C, 0x5C, 0x97, 0x97, 0xAD, 0xAD, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB2, 0xB2, 0xA0,
+0xA0, 0x66, 0x66, 0x51, 0x51, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x48, 0x48, 0x55, 0x55, 0x71, 0x71, 0xA5,
+0xA5, 0xB4, 0xB4, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBA, 0xBA, 0xAE, 0xAE, 0x9C, 0x9C, 0x62, 0x62, 0x50, 0x50, 0x45,
+0x45, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F,
+0x3F, 0x47, 0x47, 0x52, 0x52, 0x64, 0x64, 0x9C, 0x9C, 0xAE, 0xAE, 0xB8, 0xB8, 0xC0, 0xC0, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB5, 0xB5, 0xAA,
+0xAA, 0x96, 0x96, 0x61, 0x61, 0x51, 0x51, 0x48, 0x48, 0x41, 0x41, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x47, 0x47, 0x50, 0x50, 0x5E, 0x5E, 0x8D, 0x8D, 0xA5,
+0xA5, 0xB1, 0xB1, 0xB9, 0xB9, 0xBF, 0xBF, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE,
+0xBE, 0xB9, 0xB9, 0xB1, 0xB1, 0xA6, 0xA6, 0x93, 0x93, 0x62, 0x62, 0x54, 0x54, 0x4C, 0x4C, 0x46,
+0x46, 0x42, 0x42, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x5A,
+0x5A, 0x6A, 0x6A, 0x99, 0x99, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBB, 0xBB, 0xB8, 0xB8, 0xB3, 0xB3, 0xAC, 0xAC, 0xA2, 0xA2, 0x93, 0x93, 0x67, 0x67, 0x5A,
+0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x52,
+0x52, 0x59, 0x59, 0x63, 0x63, 0x79, 0x79, 0x9B, 0x9B, 0xA4, 0xA4, 0xAB, 0xAB, 0xAF, 0xAF, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAC, 0xAC, 0xA6, 0xA6, 0x9F, 0x9F, 0x93, 0x93, 0x6E,
+0x6E, 0x63, 0x63, 0x5C, 0x5C, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x5A,
+0x5A, 0x5E, 0x5E, 0x64, 0x64, 0x6C, 0x6C, 0x8A, 0x8A, 0x96, 0x96, 0x9D, 0x9D, 0xA1, 0xA1, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA0, 0xA0, 0x9C, 0x9C, 0x97, 0x97, 0x90, 0x90, 0x7B,
+0x7B, 0x6F, 0x6F, 0x6C, 0x6C, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D,
+0x6D, 0x70, 0x70, 0x73, 0x73, 0x77, 0x77, 0x83, 0x83, 0x87, 0x87, 0x89, 0x89, 0x87, 0x87, 0x85,
+0x85, 0x78, 0x78, 0x76, 0x76, 0x78, 0x78, 0x73, 0x73, 0x72, 0x72, 0x73, 0x73, 0x77, 0x77, 0x89,
+0x89, 0x8F, 0x8F, 0x95, 0x95, 0x99, 0x99, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C,
+0x9C, 0x99, 0x99, 0x93, 0x93, 0x86, 0x86, 0x6E, 0x6E, 0x66, 0x66, 0x61, 0x61, 0x5D, 0x5D, 0x5B,
+0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5F, 0x5F, 0x64, 0x64, 0x6E, 0x6E, 0x92, 0x92, 0x9D,
+0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAC, 0xAC, 0xA8, 0xA8, 0xA2,
+0xA2, 0x96, 0x96, 0x6F, 0x6F, 0x60, 0x60, 0x57, 0x57, 0x51, 0x51, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4E, 0x4E, 0x52, 0x52, 0x59, 0x59, 0x65, 0x65, 0x91, 0x91, 0xA3, 0xA3, 0xAD, 0xAD, 0xB4,
+0xB4, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xB7, 0xB7, 0xB2, 0xB2, 0xA9, 0xA9, 0x9B, 0x9B, 0x69,
+0x69, 0x58, 0x58, 0x4D, 0x4D, 0x47, 0x47, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x46, 0x46, 0x4D,
+0x4D, 0x57, 0x57, 0x6B, 0x6B, 0xA0, 0xA0, 0xAF, 0xAF, 0xB9, 0xB9, 0xBF, 0xBF, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC0, 0xC0, 0xBB, 0xBB, 0xB2, 0xB2, 0xA4, 0xA4, 0x6E, 0x6E, 0x55, 0x55, 0x49, 0x49, 0x40,
+0x40, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x46, 0x46, 0x52, 0x52, 0x6A, 0x6A, 0xA5,
+0xA5, 0xB5, 0xB5, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB3,
+0xB3, 0x9F, 0x9F, 0x5F, 0x5F, 0x4B, 0x4B, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x49, 0x49, 0x5D, 0x5D, 0xA0, 0xA0, 0xB6, 0xB6, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xA4, 0xA4, 0x5E, 0x5E, 0x47, 0x47, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x63, 0x63, 0xA9,
+0xA9, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3,
+0xB3, 0x8B, 0x8B, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x41, 0x41, 0x58, 0x58, 0xA5, 0xA5, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB4, 0xB4, 0x75, 0x75, 0x49, 0x49, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x64, 0x64, 0xB0, 0xB0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xA6, 0xA6, 0x54, 0x54, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x58, 0x58, 0xAC,
+0xAC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xA5,
+0xA5, 0x51, 0x51, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42,
+0x42, 0x68, 0x68, 0xB6, 0xB6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB7, 0xB7, 0x6A, 0x6A, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x59, 0x59, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x6F, 0x6F, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x61, 0x61, 0xB3, 0xB3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x56, 0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0xA3, 0xA3, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3, 0xB3, 0x62, 0x62, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0xA1, 0xA1, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x5A, 0x5A, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x5D, 0x5D, 0xAE, 0xAE, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x8F, 0x8F, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x55, 0x55, 0xA2, 0xA2, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB6, 0xB6, 0x96, 0x96, 0x51, 0x51, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45,
+0x45, 0x5A, 0x5A, 0xA2, 0xA2, 0xB8, 0xB8, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAC,
+0xAC, 0x71, 0x71, 0x50, 0x50, 0x44, 0x44, 0x3E, 0x3E, 0x3E, 0x3E, 0x44, 0x44, 0x51, 0x51, 0x6D,
+0x6D, 0xA8, 0xA8, 0xB7, 0xB7, 0xBE, 0xBE, 0xBE, 0xBE, 0xB9, 0xB9, 0xAE, 0xAE, 0x99, 0x99, 0x5E,
+0x5E, 0x4F, 0x4F, 0x48, 0x48, 0x47, 0x47, 0x4B, 0x4B, 0x54, 0x54, 0x65, 0x65, 0x9B, 0x9B, 0xAC,
+0xAC, 0xB3, 0xB3, 0xB4, 0xB4, 0xB0, 0xB0, 0xA8, 0xA8, 0x97, 0x97, 0x67, 0x67, 0x5A, 0x5A, 0x54,
+0x54, 0x54, 0x54, 0x57, 0x57, 0x5F, 0x5F, 0x6D, 0x6D, 0x96, 0x96, 0x9F, 0x9F, 0xA3, 0xA3, 0xA4,
+0xA4, 0xA0, 0xA0, 0x99, 0x99, 0x8B, 0x8B, 0x6F, 0x6F, 0x6A, 0x6A, 0x6B, 0x6B, 0x6E, 0x6E, 0x71,
+0x71, 0x79, 0x79, 0x81, 0x81, 0x79, 0x79, 0x70, 0x70, 0x6B, 0x6B, 0x68, 0x68, 0x67, 0x67, 0x6E,
+0x6E, 0x8A, 0x8A, 0x99, 0x99, 0xA0, 0xA0, 0xA3, 0xA3, 0xA4, 0xA4, 0x9F, 0x9F, 0x93, 0x93, 0x69,
+0x69, 0x5C, 0x5C, 0x56, 0x56, 0x53, 0x53, 0x55, 0x55, 0x5E, 0x5E, 0x7A, 0x7A, 0xA3, 0xA3, 0xAD,
+0xAD, 0xB4, 0xB4, 0xB3, 0xB3, 0xAC, 0xAC, 0x9C, 0x9C, 0x62, 0x62, 0x51, 0x51, 0x48, 0x48, 0x46,
+0x46, 0x4A, 0x4A, 0x56, 0x56, 0x8C, 0x8C, 0xAC, 0xAC, 0xBB, 0xBB, 0xC0, 0xC0, 0xBE, 0xBE, 0xB3,
+0xB3, 0x9A, 0x9A, 0x57, 0x57, 0x45, 0x45, 0x3D, 0x3D, 0x3D, 0x3D, 0x44, 0x44, 0x57, 0x57, 0xA1,
+0xA1, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB2, 0xB2, 0x6B, 0x6B, 0x47, 0x47, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x77, 0x77, 0xB7, 0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBD, 0xBD, 0x9B, 0x9B, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x63,
+0x63, 0xB6, 0xB6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xA0, 0xA0, 0x48, 0x48, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x62, 0x62, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0x91, 0x91, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x98,
+0x98, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x58, 0x58, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x51, 0x51, 0xB6, 0xB6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x9C, 0x9C, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0xA9, 0xA9, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9, 0xA9, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0xA1, 0xA1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA8, 0xA8, 0x43,
+0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0xA8, 0xA8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0x9B, 0x9B, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x50, 0x50, 0xB7,
+0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x58, 0x58, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x8D, 0x8D, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9B, 0x9B, 0x42,
+0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x59, 0x59, 0xB6, 0xB6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xAA, 0xAA, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x54, 0x54, 0xAD, 0xAD, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xAB, 0xAB, 0x54, 0x54, 0x3E, 0x3E, 0x3B, 0x3B, 0x40, 0x40, 0x57,
+0x57, 0xA8, 0xA8, 0xBE, 0xBE, 0xC3, 0xC3, 0xBC, 0xBC, 0xA4, 0xA4, 0x57, 0x57, 0x44, 0x44, 0x40,
+0x40, 0x4A, 0x4A, 0x61, 0x61, 0xA8, 0xA8, 0xB7, 0xB7, 0xB8, 0xB8, 0xAF, 0xAF, 0x96, 0x96, 0x5A,
+0x5A, 0x4F, 0x4F, 0x4E, 0x4E, 0x58, 0x58, 0x74, 0x74, 0xA2, 0xA2, 0xAD, 0xAD, 0xAB, 0xAB, 0xA0,
+0xA0, 0x71, 0x71, 0x5F, 0x5F, 0x5B, 0x5B, 0x5F, 0x5F, 0x6B, 0x6B, 0x90, 0x90, 0x98, 0x98, 0x98,
+0x98, 0x8E, 0x8E, 0x84, 0x84, 0x88, 0x88, 0x91, 0x91, 0x97, 0x97, 0x90, 0x90, 0x83, 0x83, 0x69,
+0x69, 0x62, 0x62, 0x61, 0x61, 0x68, 0x68, 0x92, 0x92, 0xA2, 0xA2, 0xAA, 0xAA, 0xA7, 0xA7, 0x96,
+0x96, 0x5E, 0x5E, 0x50, 0x50, 0x4E, 0x4E, 0x57, 0x57, 0x90, 0x90, 0xAE, 0xAE, 0xB7, 0xB7, 0xB4,
+0xB4, 0xA0, 0xA0, 0x59, 0x59, 0x46, 0x46, 0x43, 0x43, 0x4D, 0x4D, 0x8E, 0x8E, 0xB7, 0xB7, 0xC2,
+0xC2, 0xBF, 0xBF, 0xA7, 0xA7, 0x52, 0x52, 0x3C, 0x3C, 0x3B, 0x3B, 0x48, 0x48, 0x97, 0x97, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xA5, 0xA5, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0xA8,
+0xA8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x90, 0x90, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x54,
+0x54, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x97, 0x97, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA4, 0xA4, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4E, 0x4E, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0x49, 0x49, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0xAF, 0xAF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x58, 0x58, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x96, 0x96, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x94, 0x94, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x64, 0x64, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9D, 0x9D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x65, 0x65, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x97, 0x97, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x72, 0x72, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x67, 0x67, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0xA3, 0xA3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0x54, 0x54, 0x3B, 0x3B, 0x3B,
+0x3B, 0x46, 0x46, 0xB2, 0xB2, 0xC4, 0xC4, 0xC4, 0xC4, 0xAF, 0xAF, 0x46, 0x46, 0x3B, 0x3B, 0x3B,
+0x3B, 0x5F, 0x5F, 0xBE, 0xBE, 0xC4, 0xC4, 0xC0, 0xC0, 0x6F, 0x6F, 0x40, 0x40, 0x3B, 0x3B, 0x49,
+0x49, 0xA3, 0xA3, 0xC0, 0xC0, 0xC0, 0xC0, 0xAA, 0xAA, 0x52, 0x52, 0x40, 0x40, 0x45, 0x45, 0x65,
+0x65, 0xB3, 0xB3, 0xBC, 0xBC, 0xB1, 0xB1, 0x6B, 0x6B, 0x4C, 0x4C, 0x4B, 0x4B, 0x5C, 0x5C, 0xA0,
+0xA0, 0xAE, 0xAE, 0xAA, 0xAA, 0x92, 0x92, 0x5F, 0x5F, 0x57, 0x57, 0x61, 0x61, 0x8F, 0x8F, 0x9F,
+0x9F, 0x9D, 0x9D, 0x90, 0x90, 0x70, 0x70, 0x71, 0x71, 0x7B, 0x7B, 0x7C, 0x7C, 0x6D, 0x6D, 0x66,
+0x66, 0x6A, 0x6A, 0x95, 0x95, 0xA2, 0xA2, 0xA3, 0xA3, 0x8C, 0x8C, 0x5D, 0x5D, 0x55, 0x55, 0x5D,
+0x5D, 0x9A, 0x9A, 0xB1, 0xB1, 0xB1, 0xB1, 0x96, 0x96, 0x50, 0x50, 0x47, 0x47, 0x53, 0x53, 0xA4,
+0xA4, 0xBC, 0xBC, 0xBB, 0xBB, 0x97, 0x97, 0x47, 0x47, 0x3F, 0x3F, 0x50, 0x50, 0xAD, 0xAD, 0xC4,
+0xC4, 0xBE, 0xBE, 0x73, 0x73, 0x3E, 0x3E, 0x3B, 0x3B, 0x50, 0x50, 0xB8, 0xB8, 0xC4, 0xC4, 0xC1,
+0xC1, 0x5D, 0x5D, 0x3B, 0x3B, 0x3B, 0x3B, 0x5C, 0x5C, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0x48,
+0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x9E, 0x9E, 0xC4, 0xC4, 0xC4, 0xC4, 0xAB, 0xAB, 0x3B, 0x3B, 0x3B,
+0x3B, 0x40, 0x40, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0x58, 0x58, 0x3B, 0x3B, 0x3B, 0x3B, 0x60,
+0x60, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xB9, 0xB9, 0xC4,
+0xC4, 0xC4, 0xC4, 0x5B, 0x5B, 0x3B, 0x3B, 0x3B, 0x3B, 0x65, 0x65, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2,
+0xB2, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0x46, 0x46, 0x3B,
+0x3B, 0x3B, 0x3B, 0xAB, 0xAB, 0xC4, 0xC4, 0xC4, 0xC4, 0x62, 0x62, 0x3B, 0x3B, 0x3B, 0x3B, 0x67,
+0x67, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9, 0xA9, 0x3B, 0x3B, 0x3B, 0x3B, 0x4F, 0x4F, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB6, 0xB6, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0xC1, 0xC1, 0xC4, 0xC4, 0xB9, 0xB9, 0x42,
+0x42, 0x3B, 0x3B, 0x47, 0x47, 0xB9, 0xB9, 0xC4, 0xC4, 0xB8, 0xB8, 0x49, 0x49, 0x3B, 0x3B, 0x48,
+0x48, 0xB2, 0xB2, 0xC4, 0xC4, 0xB4, 0xB4, 0x4D, 0x4D, 0x3B, 0x3B, 0x4D, 0x4D, 0xB0, 0xB0, 0xC1,
+0xC1, 0xAE, 0xAE, 0x52, 0x52, 0x43, 0x43, 0x56, 0x56, 0xAC, 0xAC, 0xB8, 0xB8, 0xA3, 0xA3, 0x57,
+0x57, 0x4F, 0x4F, 0x62, 0x62, 0xA6, 0xA6, 0xAE, 0xAE, 0x97, 0x97, 0x5D, 0x5D, 0x5D, 0x5D, 0x73,
+0x73, 0x9D, 0x9D, 0x9A, 0x9A, 0x83, 0x83, 0x6E, 0x6E, 0x78, 0x78, 0x78, 0x78, 0x67, 0x67, 0x65,
+0x65, 0x91, 0x91, 0xA4, 0xA4, 0xA0, 0xA0, 0x66, 0x66, 0x56, 0x56, 0x5E, 0x5E, 0xA5, 0xA5, 0xB2,
+0xB2, 0x9F, 0x9F, 0x52, 0x52, 0x49, 0x49, 0x66, 0x66, 0xB8, 0xB8, 0xBA, 0xBA, 0x6B, 0x6B, 0x40,
+0x40, 0x45, 0x45, 0xA6, 0xA6, 0xC3, 0xC3, 0xB4, 0xB4, 0x4B, 0x4B, 0x3B, 0x3B, 0x56, 0x56, 0xBF,
+0xBF, 0xC4, 0xC4, 0x94, 0x94, 0x3B, 0x3B, 0x3B, 0x3B, 0xA8, 0xA8, 0xC4, 0xC4, 0xBF, 0xBF, 0x44,
+0x44, 0x3B, 0x3B, 0x4D, 0x4D, 0xC4, 0xC4, 0xC4, 0xC4, 0x78, 0x78, 0x3B, 0x3B, 0x3B, 0x3B, 0xB5,
+0xB5, 0xC4, 0xC4, 0xBD, 0xBD, 0x3B, 0x3B, 0x3B, 0x3B, 0x5E, 0x5E, 0xC4, 0xC4, 0xC4, 0xC4, 0x4D,
+0x4D, 0x3B, 0x3B, 0x3D, 0x3D, 0xC4, 0xC4, 0xC4, 0xC4, 0x9F, 0x9F, 0x3B, 0x3B, 0x3B, 0x3B, 0xB7,
+0xB7, 0xC4, 0xC4, 0xBF, 0xBF, 0x3B, 0x3B, 0x3B, 0x3B, 0x7C, 0x7C, 0xC4, 0xC4, 0xC4, 0xC4, 0x40,
+0x40, 0x3B, 0x3B, 0x4B, 0x4B, 0xC4, 0xC4, 0xC4, 0xC4, 0x52, 0x52, 0x3B, 0x3B, 0x3C, 0x3C, 0xC4,
+0xC4, 0xC4, 0xC4, 0x76, 0x76, 0x3B, 0x3B, 0x3B, 0x3B, 0xC2, 0xC2, 0xC4, 0xC4, 0xA7, 0xA7, 0x3B,
+0x3B, 0x3B, 0x3B, 0xB8, 0xB8, 0xC4, 0xC4, 0xAE, 0xAE, 0x3B, 0x3B, 0x3B, 0x3B, 0xB2, 0xB2, 0xC4,
+0xC4, 0xB4, 0xB4, 0x3B, 0x3B, 0x3B, 0x3B, 0xAA, 0xAA, 0xC4, 0xC4, 0xB3, 0xB3, 0x3B, 0x3B, 0x3B,
+0x3B, 0xA5, 0xA5, 0xC4, 0xC4, 0xAF, 0xAF, 0x3E, 0x3E, 0x3D, 0x3D, 0xA6, 0xA6, 0xC4, 0xC4, 0xA9,
+0xA9, 0x41, 0x41, 0x42, 0x42, 0xA7, 0xA7, 0xC0, 0xC0, 0xA0, 0xA0, 0x48, 0x48, 0x4D, 0x4D, 0xA7,
+0xA7, 0xB7, 0xB7, 0x94, 0x94, 0x4A, 0x4A, 0x55, 0x55, 0xA8, 0xA8, 0xB0, 0xB0, 0x72, 0x72, 0x57,
+0x57, 0x64, 0x64, 0xA0, 0xA0, 0x9F, 0x9F, 0x6F, 0x6F, 0x66, 0x66, 0x74, 0x74, 0x8A, 0x8A, 0x74,
+0x74, 0x95, 0x95, 0x9F, 0x9F, 0x76, 0x76, 0x5F, 0x5F, 0x67, 0x67, 0xA2, 0xA2, 0xA6, 0xA6, 0x64,
+0x64, 0x51, 0x51, 0x6B, 0x6B, 0xB5, 0xB5, 0xAA, 0xAA, 0x4F, 0x4F, 0x48, 0x48, 0xA1, 0xA1, 0xBE,
+0xBE, 0x9F, 0x9F, 0x42, 0x42, 0x4C, 0x4C, 0xB6, 0xB6, 0xC0, 0xC0, 0x5B, 0x5B, 0x3B, 0x3B, 0x5E,
+0x5E, 0xC4, 0xC4, 0xB9, 0xB9, 0x41, 0x41, 0x3B, 0x3B, 0xAA, 0xAA, 0xC4, 0xC4, 0xA2, 0xA2, 0x3B,
+0x3B, 0x44, 0x44, 0xC4, 0xC4, 0xC4, 0xC4, 0x46, 0x46, 0x3B, 0x3B, 0x99, 0x99, 0xC4, 0xC4, 0xB3,
+0xB3, 0x3B, 0x3B, 0x3B, 0x3B, 0xC4, 0xC4, 0xC4, 0xC4, 0x49, 0x49, 0x3B, 0x3B, 0x76, 0x76, 0xC4,
+0xC4, 0xB9, 0xB9, 0x3B, 0x3B, 0x3B, 0x3B, 0xC4, 0xC4, 0xC4, 0xC4, 0x46, 0x46, 0x3B, 0x3B, 0x95,
+0x95, 0xC4, 0xC4, 0xB4, 0xB4, 0x3B, 0x3B, 0x3B, 0x3B, 0xC4, 0xC4, 0xC4, 0xC4, 0x3E, 0x3E, 0x3B,
+0x3B, 0xAA, 0xAA, 0xC4, 0xC4, 0x9A, 0x9A, 0x3B, 0x3B, 0x47, 0x47, 0xC4, 0xC4, 0xC4, 0xC4, 0x3B,
+0x3B, 0x3B, 0x3B, 0xC3, 0xC3, 0xC4, 0xC4, 0x4D, 0x4D, 0x3B, 0x3B, 0x97, 0x97, 0xC4, 0xC4, 0xAA,
+0xAA, 0x3B, 0x3B, 0x46, 0x46, 0xC4, 0xC4, 0xC4, 0xC4, 0x3B, 0x3B, 0x3B, 0x3B, 0xC2, 0xC2, 0xC4,
+0xC4, 0x4A, 0x4A, 0x3B, 0x3B, 0xA7, 0xA7, 0xC4, 0xC4, 0x88, 0x88, 0x3B, 0x3B, 0x59, 0x59, 0xC4,
+0xC4, 0xB1, 0xB1, 0x3B, 0x3B, 0x47, 0x47, 0xC3, 0xC3, 0xBD, 0xBD, 0x42, 0x42, 0x42, 0x42, 0xB5,
+0xB5, 0xBD, 0xBD, 0x53, 0x53, 0x43, 0x43, 0xA4, 0xA4, 0xBC, 0xBC, 0x63, 0x63, 0x45, 0x45, 0x90,
+0x90, 0xB7, 0xB7, 0x8B, 0x8B, 0x4C, 0x4C, 0x6D, 0x6D, 0xAD, 0xAD, 0x95, 0x95, 0x5A, 0x5A, 0x6A,
+0x6A, 0xA2, 0xA2, 0x95, 0x95, 0x64, 0x64, 0x6E, 0x6E, 0x91, 0x91, 0x88, 0x88, 0x8C, 0x8C, 0x90,
+0x90, 0x66, 0x66, 0x69, 0x69, 0x9C, 0x9C, 0x9F, 0x9F, 0x5F, 0x5F, 0x5D, 0x5D, 0xA3, 0xA3, 0xA7,
+0xA7, 0x59, 0x59, 0x54, 0x54, 0xA8, 0xA8, 0xB0, 0xB0, 0x55, 0x55, 0x4A, 0x4A, 0xAF, 0xAF, 0xBA,
+0xBA, 0x4E, 0x4E, 0x48, 0x48, 0xB3, 0xB3, 0xBA, 0xBA, 0x4A, 0x4A, 0x43, 0x43, 0xB7, 0xB7, 0xBE,
+0xBE, 0x46, 0x46, 0x3F, 0x3F, 0xBB, 0xBB, 0xC2, 0xC2, 0x41, 0x41, 0x3B, 0x3B, 0xC1, 0xC1, 0xC4,
+0xC4, 0x3B, 0x3B, 0x3E, 0x3E, 0xC4, 0xC4, 0xC1, 0xC1, 0x3B, 0x3B, 0x3F, 0x3F, 0xC4, 0xC4, 0xBF,
+0xBF, 0x3B, 0x3B, 0x42, 0x42, 0xC4, 0xC4, 0xBB, 0xBB, 0x3B, 0x3B, 0x4C, 0x4C, 0xC4, 0xC4, 0xAB,
+0xAB, 0x3B, 0x3B, 0x67, 0x67, 0xC4, 0xC4, 0x6A, 0x6A, 0x3B, 0x3B, 0xA5, 0xA5, 0xC4, 0xC4, 0x4F,
+0x4F, 0x3B, 0x3B, 0xB8, 0xB8, 0xC4, 0xC4, 0x3D, 0x3D, 0x3B, 0x3B, 0xC4, 0xC4, 0xC4, 0xC4, 0x3B,
+0x3B, 0x3B, 0x3B, 0xC4, 0xC4, 0xBF, 0xBF, 0x3B, 0x3B, 0x4A, 0x4A, 0xC4, 0xC4, 0xA7, 0xA7, 0x3B,
+0x3B, 0x86, 0x86, 0xC4, 0xC4, 0x53, 0x53, 0x3B, 0x3B, 0xBC, 0xBC, 0xC4, 0xC4, 0x3B, 0x3B, 0x3B,
+0x3B, 0xC4, 0xC4, 0xC3, 0xC3, 0x3B, 0x3B, 0x67, 0x67, 0xC4, 0xC4, 0xC4, 0xC4, 0x93, 0x93, 0xB2,
+0xB2, 0xC4, 0xC4, 0xC4, 0xC4, 0x8B, 0x8B, 0xC0, 0xC0, 0xC4, 0xC4, 0xB6, 0xB6, 0x59, 0x59, 0xBF,
+0xBF, 0xC4, 0xC4, 0x52, 0x52, 0x48, 0x48, 0xB7, 0xB7, 0xA4, 0xA4, 0x3B, 0x3B, 0x3E, 0x3E, 0xA3,
+0xA3, 0x45, 0x45, 0x3B, 0x3B, 0x42, 0x42, 0x6C, 0x6C, 0x3B, 0x3B, 0x3B, 0x3B, 0x57, 0x57, 0x5E,
+0x5E, 0x3B, 0x3B, 0x47, 0x47, 0x9C, 0x9C, 0xAD, 0xAD, 0xB8, 0xB8, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB6, 0xB6, 0xAB, 0xAB, 0x99, 0x99, 0x62, 0x62, 0x52, 0x52, 0x47,
+0x47, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x48, 0x48, 0x54, 0x54, 0x65,
+0x65, 0x9B, 0x9B, 0xAC, 0xAC, 0xB7, 0xB7, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF,
+0xBF, 0xB7, 0xB7, 0xAC, 0xAC, 0x9C, 0x9C, 0x66, 0x66, 0x54, 0x54, 0x49, 0x49, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x47, 0x47, 0x51, 0x51, 0x60, 0x60, 0x94, 0x94, 0xA9,
+0xA9, 0xB4, 0xB4, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB9, 0xB9, 0xAF,
+0xAF, 0xA1, 0xA1, 0x70, 0x70, 0x59, 0x59, 0x4D, 0x4D, 0x44, 0x44, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x44, 0x44, 0x4D, 0x4D, 0x5A, 0x5A, 0x72, 0x72, 0xA2, 0xA2, 0xAF, 0xAF, 0xB9,
+0xB9, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBC, 0xBC, 0xB4, 0xB4, 0xA9, 0xA9, 0x97,
+0x97, 0x63, 0x63, 0x54, 0x54, 0x49, 0x49, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40,
+0x40, 0x47, 0x47, 0x51, 0x51, 0x5F, 0x5F, 0x8F, 0x8F, 0xA5, 0xA5, 0xB1, 0xB1, 0xBA, 0xBA, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBB, 0xBB, 0xB2, 0xB2, 0xA7, 0xA7, 0x93, 0x93, 0x62,
+0x62, 0x53, 0x53, 0x49, 0x49, 0x42, 0x42, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x48,
+0x48, 0x51, 0x51, 0x5E, 0x5E, 0x8B, 0x8B, 0xA3, 0xA3, 0xAF, 0xAF, 0xB8, 0xB8, 0xBF, 0xBF, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBB, 0xBB, 0xB4, 0xB4, 0xAA, 0xAA, 0x9A, 0x9A, 0x69, 0x69, 0x58,
+0x58, 0x4D, 0x4D, 0x45, 0x45, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x45, 0x45, 0x4D,
+0x4D, 0x57, 0x57, 0x68, 0x68, 0x99, 0x99, 0xA8, 0xA8, 0xB2, 0xB2, 0xBA, 0xBA, 0xC0, 0xC0, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB8, 0xB8, 0xB0, 0xB0, 0xA6, 0xA6, 0x94, 0x94, 0x64, 0x64, 0x56,
+0x56, 0x4C, 0x4C, 0x45, 0x45, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41, 0x41, 0x47, 0x47, 0x4F,
+0x4F, 0x59, 0x59, 0x69, 0x69, 0x99, 0x99, 0xA8, 0xA8, 0xB1, 0xB1, 0xB9, 0xB9, 0xBE, 0xBE, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB8, 0xB8, 0xB1, 0xB1, 0xA8, 0xA8, 0x99, 0x99, 0x6B, 0x6B, 0x5A,
+0x5A, 0x50, 0x50, 0x48, 0x48, 0x42, 0x42, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x40, 0x40, 0x45, 0x45, 0x4B,
+0x4B, 0x54, 0x54, 0x5F, 0x5F, 0x7D, 0x7D, 0x9F, 0x9F, 0xAB, 0xAB, 0xB3, 0xB3, 0xBA, 0xBA, 0xBF,
+0xBF, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBC, 0xBC, 0xB6, 0xB6, 0xAF, 0xAF, 0xA5, 0xA5, 0x95, 0x95, 0x68,
+0x68, 0x5A, 0x5A, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x46,
+0x46, 0x4C, 0x4C, 0x54, 0x54, 0x5F, 0x5F, 0x72, 0x72, 0x9C, 0x9C, 0xA8, 0xA8, 0xB0, 0xB0, 0xB7,
+0xB7, 0xBC, 0xBC, 0xC0, 0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBC, 0xBC, 0xB7, 0xB7, 0xB0, 0xB0, 0xA8, 0xA8, 0x9D,
+0x9D, 0x78, 0x78, 0x61, 0x61, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x43, 0x43, 0x40, 0x40, 0x3D,
+0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x40,
+0x40, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x57, 0x57, 0x62, 0x62, 0x86, 0x86, 0x9E, 0x9E, 0xA8,
+0xA8, 0xAF, 0xAF, 0xB5, 0xB5, 0xBA, 0xBA, 0xBE, 0xBE, 0xC1, 0xC1, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBE, 0xBE, 0xBA, 0xBA, 0xB5, 0xB5, 0xAF,
+0xAF, 0xA8, 0xA8, 0x9E, 0x9E, 0x8A, 0x8A, 0x64, 0x64, 0x59, 0x59, 0x51, 0x51, 0x4B, 0x4B, 0x46,
+0x46, 0x43, 0x43, 0x3F, 0x3F, 0x3D, 0x3D, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3D,
+0x3D, 0x3E, 0x3E, 0x41, 0x41, 0x45, 0x45, 0x49, 0x49, 0x4E, 0x4E, 0x55, 0x55, 0x5E, 0x5E, 0x6B,
+0x6B, 0x94, 0x94, 0xA1, 0xA1, 0xAA, 0xAA, 0xB0, 0xB0, 0xB6, 0xB6, 0xB9, 0xB9, 0xBD, 0xBD, 0xBF,
+0xBF, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBE, 0xBE, 0xBB,
+0xBB, 0xB7, 0xB7, 0xB2, 0xB2, 0xAC, 0xAC, 0xA5, 0xA5, 0x9B, 0x9B, 0x79, 0x79, 0x64, 0x64, 0x5A,
+0x5A, 0x53, 0x53, 0x4D, 0x4D, 0x48, 0x48, 0x45, 0x45, 0x42, 0x42, 0x40, 0x40, 0x3E, 0x3E, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4A, 0x4A, 0x4F,
+0x4F, 0x55, 0x55, 0x5D, 0x5D, 0x68, 0x68, 0x8F, 0x8F, 0x9D, 0x9D, 0xA6, 0xA6, 0xAD, 0xAD, 0xB2,
+0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+0xBF, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA8, 0xA8, 0xA0,
+0xA0, 0x94, 0x94, 0x6E, 0x6E, 0x61, 0x61, 0x59, 0x59, 0x52, 0x52, 0x4E, 0x4E, 0x4A, 0x4A, 0x46,
+0x46, 0x44, 0x44, 0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x44,
+0x44, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x52, 0x52, 0x58, 0x58, 0x5F, 0x5F, 0x6A, 0x6A, 0x8E,
+0x8E, 0x9C, 0x9C, 0xA4, 0xA4, 0xAA, 0xAA, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA,
+0xBA, 0xBC, 0xBC, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB, 0xBB, 0xBA, 0xBA, 0xB7, 0xB7, 0xB5,
+0xB5, 0xB1, 0xB1, 0xAD, 0xAD, 0xA8, 0xA8, 0xA1, 0xA1, 0x98, 0x98, 0x7C, 0x7C, 0x67, 0x67, 0x5E,
+0x5E, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x44,
+0x44, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x51,
+0x51, 0x55, 0x55, 0x5B, 0x5B, 0x62, 0x62, 0x6E, 0x6E, 0x91, 0x91, 0x9C, 0x9C, 0xA3, 0xA3, 0xA9,
+0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6,
+0xA6, 0xA0, 0xA0, 0x99, 0x99, 0x8B, 0x8B, 0x6B, 0x6B, 0x61, 0x61, 0x5B, 0x5B, 0x56, 0x56, 0x52,
+0x52, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+0x47, 0x48, 0x48, 0x49, 0x49, 0x4C, 0x4C, 0x4E, 0x4E, 0x51, 0x51, 0x55, 0x55, 0x5A, 0x5A, 0x60,
+0x60, 0x68, 0x68, 0x75, 0x75, 0x94, 0x94, 0x9D, 0x9D, 0xA3, 0xA3, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB3, 0xB3, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA8, 0xA8, 0xA4, 0xA4, 0x9F, 0x9F, 0x97,
+0x97, 0x8B, 0x8B, 0x6D, 0x6D, 0x64, 0x64, 0x5E, 0x5E, 0x59, 0x59, 0x55, 0x55, 0x52, 0x52, 0x4F,
+0x4F, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4B, 0x4B, 0x4D,
+0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x53, 0x53, 0x56, 0x56, 0x5A, 0x5A, 0x5F, 0x5F, 0x66, 0x66, 0x6F,
+0x6F, 0x8D, 0x8D, 0x97, 0x97, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE,
+0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xAF,
+0xAF, 0xAE, 0xAE, 0xAB, 0xAB, 0xA8, 0xA8, 0xA5, 0xA5, 0xA1, 0xA1, 0x9B, 0x9B, 0x95, 0x95, 0x88,
+0x88, 0x6D, 0x6D, 0x65, 0x65, 0x60, 0x60, 0x5C, 0x5C, 0x58, 0x58, 0x55, 0x55, 0x53, 0x53, 0x51,
+0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x51,
+0x51, 0x53, 0x53, 0x56, 0x56, 0x59, 0x59, 0x5C, 0x5C, 0x60, 0x60, 0x66, 0x66, 0x6D, 0x6D, 0x86,
+0x86, 0x93, 0x93, 0x9A, 0x9A, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA, 0xAA, 0xAB,
+0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB,
+0xAB, 0xA9, 0xA9, 0xA7, 0xA7, 0xA4, 0xA4, 0xA0, 0xA0, 0x9D, 0x9D, 0x98, 0x98, 0x90, 0x90, 0x78,
+0x78, 0x6C, 0x6C, 0x66, 0x66, 0x61, 0x61, 0x5E, 0x5E, 0x5A, 0x5A, 0x58, 0x58, 0x56, 0x56, 0x54,
+0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x57, 0x57, 0x59, 0x59, 0x5C, 0x5C, 0x5F, 0x5F, 0x63, 0x63, 0x67, 0x67, 0x6E, 0x6E, 0x7B,
+0x7B, 0x90, 0x90, 0x97, 0x97, 0x9B, 0x9B, 0x9F, 0x9F, 0xA2, 0xA2, 0xA4, 0xA4, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0x9F, 0x9F, 0x9C, 0x9C, 0x98, 0x98, 0x92, 0x92, 0x8A,
+0x8A, 0x72, 0x72, 0x6B, 0x6B, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5D, 0x5D, 0x5B, 0x5B, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58,
+0x58, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x60, 0x60, 0x63, 0x63, 0x66, 0x66, 0x6A, 0x6A, 0x70,
+0x70, 0x82, 0x82, 0x8F, 0x8F, 0x94, 0x94, 0x98, 0x98, 0x9C, 0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA0, 0xA0, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A, 0x9A, 0x96, 0x96, 0x92,
+0x92, 0x8C, 0x8C, 0x78, 0x78, 0x6F, 0x6F, 0x6B, 0x6B, 0x67, 0x67, 0x64, 0x64, 0x62, 0x62, 0x60,
+0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x67, 0x67, 0x6A,
+0x6A, 0x6E, 0x6E, 0x74, 0x74, 0x88, 0x88, 0x8F, 0x8F, 0x93, 0x93, 0x96, 0x96, 0x99, 0x99, 0x9B,
+0x9B, 0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x98, 0x98, 0x96,
+0x96, 0x93, 0x93, 0x90, 0x90, 0x8B, 0x8B, 0x7A, 0x7A, 0x72, 0x72, 0x6E, 0x6E, 0x6B, 0x6B, 0x68,
+0x68, 0x66, 0x66, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x67,
+0x67, 0x69, 0x69, 0x6C, 0x6C, 0x70, 0x70, 0x74, 0x74, 0x7B, 0x7B, 0x8A, 0x8A, 0x8F, 0x8F, 0x91,
+0x91, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x95, 0x95, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x79, 0x79, 0x74,
+0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x67,
+0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68,
+0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x73, 0x73, 0x76, 0x76, 0x7B,
+0x7B, 0x87, 0x87, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94,
+0x94, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A,
+0x8A, 0x87, 0x87, 0x7D, 0x7D, 0x78, 0x78, 0x75, 0x75, 0x73, 0x73, 0x71, 0x71, 0x70, 0x70, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74,
+0x74, 0x76, 0x76, 0x77, 0x77, 0x7A, 0x7A, 0x82, 0x82, 0x86, 0x86, 0x88, 0x88, 0x89, 0x89, 0x8A,
+0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89,
+0x89, 0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x7E, 0x7E, 0x7B, 0x7B, 0x7A,
+0x7A, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x84, 0x84, 0x84,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7E,
+0x7E, 0x7B, 0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x74, 0x74, 0x73,
+0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x71,
+0x71, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x78,
+0x78, 0x7A, 0x7A, 0x7E, 0x7E, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8B, 0x8B, 0x8A, 0x8A, 0x87, 0x87, 0x84, 0x84, 0x7A, 0x7A, 0x77, 0x77, 0x75, 0x75, 0x73,
+0x73, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E,
+0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x74, 0x74, 0x76, 0x76, 0x79, 0x79, 0x84, 0x84, 0x89,
+0x89, 0x8B, 0x8B, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94,
+0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x95,
+0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x88,
+0x88, 0x82, 0x82, 0x77, 0x77, 0x74, 0x74, 0x71, 0x71, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6B,
+0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F,
+0x6F, 0x72, 0x72, 0x75, 0x75, 0x79, 0x79, 0x87, 0x87, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94,
+0x94, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C, 0x8C, 0x89, 0x89, 0x7C, 0x7C, 0x75, 0x75, 0x71,
+0x71, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66,
+0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67,
+0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x7A,
+0x7A, 0x88, 0x88, 0x8D, 0x8D, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x95, 0x95, 0x97, 0x97, 0x98,
+0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x93, 0x93, 0x90,
+0x90, 0x8D, 0x8D, 0x89, 0x89, 0x79, 0x79, 0x73, 0x73, 0x70, 0x70, 0x6D, 0x6D, 0x6B, 0x6B, 0x69,
+0x69, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63,
+0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x6A,
+0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x7C, 0x7C, 0x8A, 0x8A, 0x8E, 0x8E, 0x91,
+0x91, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A,
+0x9A, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x87, 0x87, 0x77,
+0x77, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x64,
+0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64,
+0x64, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71,
+0x71, 0x76, 0x76, 0x87, 0x87, 0x8C, 0x8C, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x98,
+0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x94,
+0x94, 0x91, 0x91, 0x8E, 0x8E, 0x8A, 0x8A, 0x7B, 0x7B, 0x74, 0x74, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A,
+0x6A, 0x68, 0x68, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67,
+0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x75, 0x75, 0x82, 0x82, 0x8B, 0x8B, 0x8F,
+0x8F, 0x92, 0x92, 0x95, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8B, 0x8B, 0x7C,
+0x7C, 0x74, 0x74, 0x70, 0x70, 0x6D, 0x6D, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65,
+0x65, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x71,
+0x71, 0x75, 0x75, 0x85, 0x85, 0x8C, 0x8C, 0x8F, 0x8F, 0x93, 0x93, 0x95, 0x95, 0x97, 0x97, 0x99,
+0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x93,
+0x93, 0x90, 0x90, 0x8D, 0x8D, 0x88, 0x88, 0x77, 0x77, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A,
+0x6A, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63,
+0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x6A,
+0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x7D, 0x7D, 0x8A, 0x8A, 0x8F, 0x8F, 0x91,
+0x91, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98,
+0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x90, 0x90, 0x8C, 0x8C, 0x87, 0x87, 0x78, 0x78, 0x73,
+0x73, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67,
+0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x77, 0x77, 0x86,
+0x86, 0x8C, 0x8C, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99,
+0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99,
+0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x90, 0x90, 0x8C, 0x8C, 0x88,
+0x88, 0x7A, 0x7A, 0x75, 0x75, 0x71, 0x71, 0x6F, 0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A, 0x6A, 0x69,
+0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x67, 0x67, 0x68,
+0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x73,
+0x73, 0x78, 0x78, 0x86, 0x86, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x95,
+0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x93, 0x93, 0x91, 0x91, 0x8F, 0x8F, 0x8C,
+0x8C, 0x89, 0x89, 0x84, 0x84, 0x78, 0x78, 0x74, 0x74, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D,
+0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6B,
+0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x71, 0x71, 0x73,
+0x73, 0x75, 0x75, 0x79, 0x79, 0x85, 0x85, 0x89, 0x89, 0x8C, 0x8C, 0x8E, 0x8E, 0x8F, 0x8F, 0x91,
+0x91, 0x92, 0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95,
+0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8D, 0x8D, 0x8C,
+0x8C, 0x89, 0x89, 0x86, 0x86, 0x7C, 0x7C, 0x77, 0x77, 0x75, 0x75, 0x73, 0x73, 0x72, 0x72, 0x72,
+0x72, 0x71, 0x71, 0x70, 0x70, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x72, 0x72, 0x71, 0x71, 0x72,
+0x72, 0x72, 0x72, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x75, 0x75, 0x76,
+0x76, 0x77, 0x77, 0x7A, 0x7A, 0x83, 0x83, 0x86, 0x86, 0x88, 0x88, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C,
+0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x88, 0x88, 0x86,
+0x86, 0x85, 0x85, 0x82, 0x82, 0x7C, 0x7C, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7B,
+0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x89, 0x89, 0x89,
+0x89, 0x88, 0x88, 0x89, 0x89, 0x86, 0x86, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x83, 0x83, 0x83,
+0x83, 0x82, 0x82, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7A, 0x7A, 0x7B, 0x7B, 0x7A,
+0x7A, 0x78, 0x78, 0x7B, 0x7B, 0x85, 0x85, 0x7C, 0x7C, 0x85, 0x85, 0x85, 0x85, 0x7B, 0x7B, 0x7A,
+0x7A, 0x7A, 0x7A, 0x77, 0x77, 0x78, 0x78, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x7A,
+0x7A, 0x7E, 0x7E, 0x86, 0x86, 0x87, 0x87, 0x89, 0x89, 0x8B, 0x8B, 0x8C, 0x8C, 0x8E, 0x8E, 0x8F,
+0x8F, 0x8F, 0x8F, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92,
+0x92, 0x91, 0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x89, 0x89, 0x87, 0x87, 0x7D,
+0x7D, 0x78, 0x78, 0x75, 0x75, 0x73, 0x73, 0x72, 0x72, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x6E, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F,
+0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x75, 0x75, 0x79, 0x79, 0x86, 0x86, 0x8A,
+0x8A, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98,
+0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94,
+0x94, 0x92, 0x92, 0x90, 0x90, 0x8D, 0x8D, 0x89, 0x89, 0x7B, 0x7B, 0x75, 0x75, 0x71, 0x71, 0x6F,
+0x6F, 0x6D, 0x6D, 0x6B, 0x6B, 0x6A, 0x6A, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x67,
+0x67, 0x66, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E,
+0x6E, 0x71, 0x71, 0x75, 0x75, 0x83, 0x83, 0x8B, 0x8B, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x98,
+0x98, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x93, 0x93, 0x90, 0x90, 0x8A,
+0x8A, 0x79, 0x79, 0x72, 0x72, 0x6D, 0x6D, 0x6A, 0x6A, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x63,
+0x63, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63,
+0x63, 0x65, 0x65, 0x67, 0x67, 0x6A, 0x6A, 0x6D, 0x6D, 0x71, 0x71, 0x79, 0x79, 0x8C, 0x8C, 0x92,
+0x92, 0x96, 0x96, 0x99, 0x99, 0x9C, 0x9C, 0x9D, 0x9D, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x99,
+0x99, 0x95, 0x95, 0x91, 0x91, 0x8A, 0x8A, 0x74, 0x74, 0x6E, 0x6E, 0x69, 0x69, 0x66, 0x66, 0x63,
+0x63, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x63, 0x63, 0x65, 0x65, 0x69, 0x69, 0x6D, 0x6D, 0x75,
+0x75, 0x8D, 0x8D, 0x93, 0x93, 0x98, 0x98, 0x9C, 0x9C, 0x9F, 0x9F, 0xA2, 0xA2, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1,
+0xA1, 0x9E, 0x9E, 0x9A, 0x9A, 0x96, 0x96, 0x90, 0x90, 0x83, 0x83, 0x6F, 0x6F, 0x69, 0x69, 0x65,
+0x65, 0x61, 0x61, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x59, 0x59, 0x59, 0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F, 0x5F, 0x62, 0x62, 0x66, 0x66, 0x6B,
+0x6B, 0x74, 0x74, 0x8E, 0x8E, 0x96, 0x96, 0x9B, 0x9B, 0xA0, 0xA0, 0xA3, 0xA3, 0xA6, 0xA6, 0xA8,
+0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0xA6,
+0xA6, 0xA3, 0xA3, 0xA0, 0xA0, 0x9B, 0x9B, 0x96, 0x96, 0x8D, 0x8D, 0x72, 0x72, 0x69, 0x69, 0x63,
+0x63, 0x5F, 0x5F, 0x5C, 0x5C, 0x59, 0x59, 0x57, 0x57, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5F, 0x5F, 0x63, 0x63, 0x6A,
+0x6A, 0x76, 0x76, 0x91, 0x91, 0x99, 0x99, 0x9F, 0x9F, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC,
+0xAC, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA8,
+0xA8, 0xA4, 0xA4, 0x9F, 0x9F, 0x9A, 0x9A, 0x91, 0x91, 0x74, 0x74, 0x69, 0x69, 0x62, 0x62, 0x5D,
+0x5D, 0x59, 0x59, 0x56, 0x56, 0x53, 0x53, 0x52, 0x52, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x52, 0x52, 0x54, 0x54, 0x56, 0x56, 0x59, 0x59, 0x5D, 0x5D, 0x63, 0x63, 0x6A, 0x6A, 0x85,
+0x85, 0x96, 0x96, 0x9E, 0x9E, 0xA3, 0xA3, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB1, 0xB1, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAC, 0xAC, 0xA8, 0xA8, 0xA4,
+0xA4, 0x9E, 0x9E, 0x95, 0x95, 0x78, 0x78, 0x68, 0x68, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x52,
+0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4F, 0x4F, 0x51,
+0x51, 0x54, 0x54, 0x57, 0x57, 0x5C, 0x5C, 0x63, 0x63, 0x6E, 0x6E, 0x91, 0x91, 0x9C, 0x9C, 0xA3,
+0xA3, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB4, 0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA7, 0xA7, 0xA0, 0xA0, 0x97, 0x97, 0x76,
+0x76, 0x66, 0x66, 0x5D, 0x5D, 0x57, 0x57, 0x52, 0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x49,
+0x49, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x57, 0x57, 0x5E,
+0x5E, 0x67, 0x67, 0x88, 0x88, 0x9A, 0x9A, 0xA3, 0xA3, 0xA9, 0xA9, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6,
+0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xAE,
+0xAE, 0xA8, 0xA8, 0xA1, 0xA1, 0x97, 0x97, 0x72, 0x72, 0x63, 0x63, 0x5A, 0x5A, 0x54, 0x54, 0x4F,
+0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A,
+0x4A, 0x4E, 0x4E, 0x52, 0x52, 0x58, 0x58, 0x61, 0x61, 0x70, 0x70, 0x97, 0x97, 0xA2, 0xA2, 0xAA,
+0xAA, 0xB0, 0xB0, 0xB5, 0xB5, 0xB8, 0xB8, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB,
+0xBB, 0xB8, 0xB8, 0xB5, 0xB5, 0xB1, 0xB1, 0xAA, 0xAA, 0xA2, 0xA2, 0x96, 0x96, 0x6D, 0x6D, 0x5F,
+0x5F, 0x56, 0x56, 0x4F, 0x4F, 0x4A, 0x4A, 0x47, 0x47, 0x44, 0x44, 0x43, 0x43, 0x42, 0x42, 0x43,
+0x43, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4E, 0x4E, 0x54, 0x54, 0x5C, 0x5C, 0x69, 0x69, 0x93,
+0x93, 0xA2, 0xA2, 0xAB, 0xAB, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB, 0xBB, 0xBD, 0xBD, 0xBF, 0xBF, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBD, 0xBD, 0xBB, 0xBB, 0xB7, 0xB7, 0xB2, 0xB2, 0xAB, 0xAB, 0xA2, 0xA2, 0x93,
+0x93, 0x68, 0x68, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x40,
+0x40, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4F, 0x4F, 0x57, 0x57, 0x62,
+0x62, 0x8C, 0x8C, 0xA0, 0xA0, 0xAB, 0xAB, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0, 0xC0, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAC, 0xAC, 0xA1,
+0xA1, 0x8E, 0x8E, 0x62, 0x62, 0x56, 0x56, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x3F, 0x3F, 0x3D,
+0x3D, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x41, 0x41, 0x45, 0x45, 0x4B, 0x4B, 0x52, 0x52, 0x5D,
+0x5D, 0x73, 0x73, 0x9E, 0x9E, 0xAB, 0xAB, 0xB4, 0xB4, 0xBA, 0xBA, 0xBF, 0xBF, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBB, 0xBB, 0xB5, 0xB5, 0xAC, 0xAC, 0xA0,
+0xA0, 0x75, 0x75, 0x5D, 0x5D, 0x51, 0x51, 0x49, 0x49, 0x42, 0x42, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x46, 0x46, 0x4E, 0x4E, 0x58, 0x58, 0x69,
+0x69, 0x9B, 0x9B, 0xAA, 0xAA, 0xB4, 0xB4, 0xBC, 0xBC, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBD, 0xBD, 0xB6, 0xB6, 0xAC, 0xAC, 0x9E, 0x9E, 0x6B,
+0x6B, 0x58, 0x58, 0x4D, 0x4D, 0x44, 0x44, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41, 0x41, 0x48, 0x48, 0x52, 0x52, 0x60, 0x60, 0x94, 0x94, 0xA8,
+0xA8, 0xB4, 0xB4, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB7, 0xB7, 0xAD, 0xAD, 0x9D, 0x9D, 0x67, 0x67, 0x54, 0x54, 0x49,
+0x49, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x42, 0x42, 0x4B, 0x4B, 0x58, 0x58, 0x70, 0x70, 0xA3, 0xA3, 0xB2, 0xB2, 0xBC, 0xBC, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB9,
+0xB9, 0xAF, 0xAF, 0x9D, 0x9D, 0x65, 0x65, 0x52, 0x52, 0x46, 0x46, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x43, 0x43, 0x4E, 0x4E, 0x5E,
+0x5E, 0x97, 0x97, 0xAC, 0xAC, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB3, 0xB3, 0xA1, 0xA1, 0x67, 0x67, 0x52,
+0x52, 0x45, 0x45, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x4F, 0x4F, 0x64, 0x64, 0xA0, 0xA0, 0xB3, 0xB3, 0xBE, 0xBE, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB8,
+0xB8, 0xA9, 0xA9, 0x77, 0x77, 0x55, 0x55, 0x46, 0x46, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x51, 0x51, 0x69, 0x69, 0xA6,
+0xA6, 0xB7, 0xB7, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB2, 0xB2, 0x9D, 0x9D, 0x5D, 0x5D, 0x4A, 0x4A, 0x3E, 0x3E, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4E,
+0x4E, 0x67, 0x67, 0xA6, 0xA6, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xAE, 0xAE, 0x8F, 0x8F, 0x54, 0x54, 0x44,
+0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x47, 0x47, 0x5B, 0x5B, 0x9D, 0x9D, 0xB5, 0xB5, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xAF, 0xAF, 0x8C, 0x8C, 0x52,
+0x52, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x4C, 0x4C, 0x6A, 0x6A, 0xAB, 0xAB, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB5, 0xB5, 0x9B, 0x9B, 0x56,
+0x56, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x4C, 0x4C, 0x6D, 0x6D, 0xAD, 0xAD, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xAD, 0xAD, 0x6A, 0x6A, 0x4B,
+0x4B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x48, 0x48, 0x63, 0x63, 0xAB, 0xAB, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xAA, 0xAA, 0x62, 0x62, 0x47, 0x47, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x50,
+0x50, 0x95, 0x95, 0xB5, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x74, 0x74, 0x4B, 0x4B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x50, 0x50, 0x99, 0x99, 0xB8,
+0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0,
+0xC0, 0xAB, 0xAB, 0x5E, 0x5E, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x47, 0x47, 0x68, 0x68, 0xB1, 0xB1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xAB, 0xAB, 0x5E, 0x5E, 0x42,
+0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C,
+0x4C, 0x94, 0x94, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x94, 0x94, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x47, 0x47, 0x70, 0x70, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x8D, 0x8D, 0x4A,
+0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E,
+0x4E, 0x9D, 0x9D, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xA7, 0xA7, 0x56, 0x56, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0x93, 0x93, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xA2, 0xA2, 0x51, 0x51, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x52, 0x52, 0xA5, 0xA5, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x64,
+0x64, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C,
+0x4C, 0x9B, 0x9B, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB2, 0xB2, 0x62, 0x62, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x53, 0x53, 0xA7, 0xA7, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xA0, 0xA0, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0x98, 0x98, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xA5, 0xA5, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0x9D, 0x9D, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x94, 0x94, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x62, 0x62, 0xB1, 0xB1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xA4, 0xA4, 0x54, 0x54, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x5D, 0x5D, 0xAD, 0xAD, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xA0, 0xA0, 0x51, 0x51, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x6F, 0x6F, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB1, 0xB1, 0x68, 0x68, 0x47, 0x47, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x5B, 0x5B, 0xA8, 0xA8, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB5, 0xB5, 0x88, 0x88, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x5B, 0x5B, 0xA7, 0xA7, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xB0, 0xB0, 0x6D, 0x6D, 0x4B, 0x4B, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x4A, 0x4A, 0x6A, 0x6A, 0xAE, 0xAE, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8,
+0xB8, 0xA1, 0xA1, 0x59, 0x59, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x46, 0x46, 0x5B,
+0x5B, 0xA0, 0xA0, 0xB8, 0xB8, 0xC2, 0xC2, 0xC4, 0xC4, 0xC3, 0xC3, 0xB9, 0xB9, 0xA6, 0xA6, 0x61,
+0x61, 0x4B, 0x4B, 0x40, 0x40, 0x3C, 0x3C, 0x3F, 0x3F, 0x48, 0x48, 0x5B, 0x5B, 0x9D, 0x9D, 0xB3,
+0xB3, 0xBE, 0xBE, 0xC1, 0xC1, 0xBE, 0xBE, 0xB5, 0xB5, 0xA1, 0xA1, 0x60, 0x60, 0x4C, 0x4C, 0x44,
+0x44, 0x41, 0x41, 0x44, 0x44, 0x4E, 0x4E, 0x63, 0x63, 0xA1, 0xA1, 0xB2, 0xB2, 0xBB, 0xBB, 0xBD,
+0xBD, 0xB8, 0xB8, 0xAD, 0xAD, 0x93, 0x93, 0x5A, 0x5A, 0x4B, 0x4B, 0x46, 0x46, 0x46, 0x46, 0x4C,
+0x4C, 0x5A, 0x5A, 0x8F, 0x8F, 0xA9, 0xA9, 0xB3, 0xB3, 0xB7, 0xB7, 0xB5, 0xB5, 0xAD, 0xAD, 0x9C,
+0x9C, 0x66, 0x66, 0x54, 0x54, 0x4D, 0x4D, 0x4C, 0x4C, 0x50, 0x50, 0x5A, 0x5A, 0x72, 0x72, 0xA1,
+0xA1, 0xAD, 0xAD, 0xB1, 0xB1, 0xB0, 0xB0, 0xA9, 0xA9, 0x9B, 0x9B, 0x6B, 0x6B, 0x5B, 0x5B, 0x54,
+0x54, 0x53, 0x53, 0x57, 0x57, 0x60, 0x60, 0x77, 0x77, 0x9E, 0x9E, 0xA6, 0xA6, 0xA9, 0xA9, 0xA6,
+0xA6, 0xA0, 0xA0, 0x93, 0x93, 0x6B, 0x6B, 0x61, 0x61, 0x5E, 0x5E, 0x60, 0x60, 0x64, 0x64, 0x6C,
+0x6C, 0x8D, 0x8D, 0x98, 0x98, 0x9C, 0x9C, 0x9E, 0x9E, 0x9A, 0x9A, 0x93, 0x93, 0x7B, 0x7B, 0x6F,
+0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x6D, 0x6D, 0x72, 0x72, 0x79, 0x79, 0x89, 0x89, 0x8A, 0x8A, 0x87,
+0x87, 0x8E, 0x8E, 0x89, 0x89, 0x82, 0x82, 0x88, 0x88, 0x8E, 0x8E, 0x92, 0x92, 0x92, 0x92, 0x91,
+0x91, 0x8A, 0x8A, 0x72, 0x72, 0x6A, 0x6A, 0x66, 0x66, 0x64, 0x64, 0x66, 0x66, 0x70, 0x70, 0x92,
+0x92, 0x9D, 0x9D, 0xA1, 0xA1, 0xA1, 0xA1, 0x9D, 0x9D, 0x90, 0x90, 0x69, 0x69, 0x5E, 0x5E, 0x59,
+0x59, 0x59, 0x59, 0x5F, 0x5F, 0x6E, 0x6E, 0x9B, 0x9B, 0xA7, 0xA7, 0xAE, 0xAE, 0xAD, 0xAD, 0xA3,
+0xA3, 0x8A, 0x8A, 0x5E, 0x5E, 0x54, 0x54, 0x50, 0x50, 0x52, 0x52, 0x5D, 0x5D, 0x8E, 0x8E, 0xA8,
+0xA8, 0xB2, 0xB2, 0xB4, 0xB4, 0xAF, 0xAF, 0xA1, 0xA1, 0x65, 0x65, 0x51, 0x51, 0x49, 0x49, 0x49,
+0x49, 0x53, 0x53, 0x69, 0x69, 0xA5, 0xA5, 0xB4, 0xB4, 0xB9, 0xB9, 0xB6, 0xB6, 0xA9, 0xA9, 0x71,
+0x71, 0x51, 0x51, 0x46, 0x46, 0x44, 0x44, 0x4A, 0x4A, 0x5D, 0x5D, 0xA2, 0xA2, 0xB6, 0xB6, 0xBF,
+0xBF, 0xBC, 0xBC, 0xB0, 0xB0, 0x82, 0x82, 0x4F, 0x4F, 0x42, 0x42, 0x3F, 0x3F, 0x45, 0x45, 0x5A,
+0x5A, 0xA5, 0xA5, 0xBC, 0xBC, 0xC4, 0xC4, 0xC1, 0xC1, 0xB3, 0xB3, 0x6E, 0x6E, 0x49, 0x49, 0x3B,
+0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x61, 0x61, 0xB0, 0xB0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC2, 0xC2, 0xAD,
+0xAD, 0x5A, 0x5A, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0x94, 0x94, 0xBD, 0xBD, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0x95, 0x95, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x5C,
+0x5C, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x50, 0x50, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB4, 0xB4, 0x55,
+0x55, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4A, 0x4A, 0xAB, 0xAB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB5, 0xB5, 0x52, 0x52, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0xB0, 0xB0, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB0, 0xB0, 0x49, 0x49, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x58,
+0x58, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9B, 0x9B, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x9B, 0x9B, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x4F, 0x4F, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x55, 0x55, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x74,
+0x74, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0xB2, 0xB2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xA4, 0xA4, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0xAB, 0xAB, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xAB, 0xAB, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xA9, 0xA9, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA6, 0xA6, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0xB4,
+0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x7C, 0x7C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x50,
+0x50, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0x4E, 0x4E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x97, 0x97, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA7, 0xA7, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4B, 0x4B, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0xA8, 0xA8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x68, 0x68, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x88, 0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x99, 0x99, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x5F, 0x5F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA5, 0xA5, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x5D, 0x5D, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9F, 0x9F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x67, 0x67, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x8B, 0x8B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x9E, 0x9E, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0x58, 0x58, 0x3B, 0x3B, 0x3B,
+0x3B, 0x48, 0x48, 0xAF, 0xAF, 0xC4, 0xC4, 0xC4, 0xC4, 0xAE, 0xAE, 0x49, 0x49, 0x3B, 0x3B, 0x3B,
+0x3B, 0x61, 0x61, 0xBD, 0xBD, 0xC4, 0xC4, 0xBE, 0xBE, 0x6A, 0x6A, 0x3E, 0x3E, 0x3B, 0x3B, 0x49,
+0x49, 0xA7, 0xA7, 0xC3, 0xC3, 0xC4, 0xC4, 0xAA, 0xAA, 0x4E, 0x4E, 0x3D, 0x3D, 0x42, 0x42, 0x6F,
+0x6F, 0xBA, 0xBA, 0xC2, 0xC2, 0xB3, 0xB3, 0x5E, 0x5E, 0x42, 0x42, 0x41, 0x41, 0x59, 0x59, 0xAE,
+0xAE, 0xBD, 0xBD, 0xB6, 0xB6, 0x8B, 0x8B, 0x4C, 0x4C, 0x47, 0x47, 0x56, 0x56, 0xA4, 0xA4, 0xB8,
+0xB8, 0xB4, 0xB4, 0x96, 0x96, 0x52, 0x52, 0x4A, 0x4A, 0x56, 0x56, 0x9A, 0x9A, 0xAF, 0xAF, 0xAE,
+0xAE, 0x99, 0x99, 0x5B, 0x5B, 0x55, 0x55, 0x5E, 0x5E, 0x94, 0x94, 0xA6, 0xA6, 0xA8, 0xA8, 0x92,
+0x92, 0x62, 0x62, 0x5C, 0x5C, 0x64, 0x64, 0x92, 0x92, 0x9E, 0x9E, 0x98, 0x98, 0x89, 0x89, 0x6D,
+0x6D, 0x6E, 0x6E, 0x75, 0x75, 0x79, 0x79, 0x82, 0x82, 0x76, 0x76, 0x82, 0x82, 0x88, 0x88, 0x8F,
+0x8F, 0x88, 0x88, 0x71, 0x71, 0x69, 0x69, 0x6B, 0x6B, 0x91, 0x91, 0xA0, 0xA0, 0x9F, 0x9F, 0x8A,
+0x8A, 0x5E, 0x5E, 0x59, 0x59, 0x64, 0x64, 0xA1, 0xA1, 0xAD, 0xAD, 0xA2, 0xA2, 0x66, 0x66, 0x51,
+0x51, 0x53, 0x53, 0x86, 0x86, 0xAF, 0xAF, 0xB3, 0xB3, 0x9D, 0x9D, 0x53, 0x53, 0x49, 0x49, 0x58,
+0x58, 0xA7, 0xA7, 0xB9, 0xB9, 0xB1, 0xB1, 0x61, 0x61, 0x45, 0x45, 0x4A, 0x4A, 0x8E, 0x8E, 0xB8,
+0xB8, 0xBA, 0xBA, 0x9A, 0x9A, 0x49, 0x49, 0x41, 0x41, 0x58, 0x58, 0xB5, 0xB5, 0xC3, 0xC3, 0xB0,
+0xB0, 0x4E, 0x4E, 0x3B, 0x3B, 0x47, 0x47, 0xAC, 0xAC, 0xC4, 0xC4, 0xBC, 0xBC, 0x59, 0x59, 0x3B,
+0x3B, 0x3E, 0x3E, 0x9F, 0x9F, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0x6F, 0x3B, 0x3B, 0x3B, 0x3B, 0x75,
+0x75, 0xC4, 0xC4, 0xC4, 0xC4, 0x9B, 0x9B, 0x3B, 0x3B, 0x3B, 0x3B, 0x66, 0x66, 0xC4, 0xC4, 0xC4,
+0xC4, 0x9F, 0x9F, 0x3B, 0x3B, 0x3B, 0x3B, 0x61, 0x61, 0xC4, 0xC4, 0xC4, 0xC4, 0xA0, 0xA0, 0x3B,
+0x3B, 0x3B, 0x3B, 0x65, 0x65, 0xC4, 0xC4, 0xC4, 0xC4, 0x97, 0x97, 0x3B, 0x3B, 0x3B, 0x3B, 0x98,
+0x98, 0xC4, 0xC4, 0xC4, 0xC4, 0x5E, 0x5E, 0x3B, 0x3B, 0x3B, 0x3B, 0xAD, 0xAD, 0xC4, 0xC4, 0xC4,
+0xC4, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0xBF, 0xBF, 0xC4, 0xC4, 0xBF, 0xBF, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4D, 0x4D, 0xC4, 0xC4, 0xC4, 0xC4, 0xA3, 0xA3, 0x3B, 0x3B, 0x3B, 0x3B, 0x9B, 0x9B, 0xC4,
+0xC4, 0xC4, 0xC4, 0x4E, 0x4E, 0x3B, 0x3B, 0x3B, 0x3B, 0xC1, 0xC1, 0xC4, 0xC4, 0xBA, 0xBA, 0x3B,
+0x3B, 0x3B, 0x3B, 0x5E, 0x5E, 0xC4, 0xC4, 0xC4, 0xC4, 0x57, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0xBE,
+0xBE, 0xC4, 0xC4, 0xBE, 0xBE, 0x3B, 0x3B, 0x3B, 0x3B, 0x5E, 0x5E, 0xC4, 0xC4, 0xC4, 0xC4, 0x4E,
+0x4E, 0x3B, 0x3B, 0x3C, 0x3C, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9, 0xA9, 0x3B, 0x3B, 0x3B, 0x3B, 0xAA,
+0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0x3B, 0x3B, 0x3B, 0x3B, 0x5A, 0x5A, 0xC4, 0xC4, 0xC4, 0xC4, 0x4D,
+0x4D, 0x3B, 0x3B, 0x43, 0x43, 0xC4, 0xC4, 0xC4, 0xC4, 0x77, 0x77, 0x3B, 0x3B, 0x3B, 0x3B, 0xBD,
+0xBD, 0xC4, 0xC4, 0xAB, 0xAB, 0x3B, 0x3B, 0x3B, 0x3B, 0xB4, 0xB4, 0xC4, 0xC4, 0xB3, 0xB3, 0x3B,
+0x3B, 0x3B, 0x3B, 0xA7, 0xA7, 0xC4, 0xC4, 0xB8, 0xB8, 0x3C, 0x3C, 0x3B, 0x3B, 0x9E, 0x9E, 0xC4,
+0xC4, 0xB9, 0xB9, 0x40, 0x40, 0x3B, 0x3B, 0x99, 0x99, 0xC4, 0xC4, 0xB4, 0xB4, 0x3E, 0x3E, 0x3B,
+0x3B, 0xA1, 0xA1, 0xC4, 0xC4, 0xB0, 0xB0, 0x41, 0x41, 0x3D, 0x3D, 0xA5, 0xA5, 0xC4, 0xC4, 0xA9,
+0xA9, 0x42, 0x42, 0x46, 0x46, 0xAB, 0xAB, 0xBF, 0xBF, 0x97, 0x97, 0x41, 0x41, 0x4C, 0x4C, 0xB0,
+0xB0, 0xBA, 0xBA, 0x6C, 0x6C, 0x46, 0x46, 0x59, 0x59, 0xB1, 0xB1, 0xB2, 0xB2, 0x5F, 0x5F, 0x4C,
+0x4C, 0x69, 0x69, 0xB1, 0xB1, 0xA7, 0xA7, 0x59, 0x59, 0x50, 0x50, 0x98, 0x98, 0xAF, 0xAF, 0x96,
+0x96, 0x58, 0x58, 0x5F, 0x5F, 0x9D, 0x9D, 0xA1, 0xA1, 0x70, 0x70, 0x61, 0x61, 0x70, 0x70, 0x91,
+0x91, 0x89, 0x89, 0x88, 0x88, 0x91, 0x91, 0x74, 0x74, 0x6F, 0x6F, 0x77, 0x77, 0x98, 0x98, 0x93,
+0x93, 0x66, 0x66, 0x63, 0x63, 0x97, 0x97, 0xA4, 0xA4, 0x74, 0x74, 0x56, 0x56, 0x66, 0x66, 0xAD,
+0xAD, 0xA6, 0xA6, 0x54, 0x54, 0x4F, 0x4F, 0xA3, 0xA3, 0xB3, 0xB3, 0x6B, 0x6B, 0x48, 0x48, 0x64,
+0x64, 0xBA, 0xBA, 0xAB, 0xAB, 0x47, 0x47, 0x49, 0x49, 0xB2, 0xB2, 0xBE, 0xBE, 0x59, 0x59, 0x3D,
+0x3D, 0x95, 0x95, 0xC4, 0xC4, 0xA1, 0xA1, 0x3B, 0x3B, 0x51, 0x51, 0xC2, 0xC2, 0xBA, 0xBA, 0x42,
+0x42, 0x3E, 0x3E, 0xB8, 0xB8, 0xC4, 0xC4, 0x51, 0x51, 0x3B, 0x3B, 0x9E, 0x9E, 0xC4, 0xC4, 0x98,
+0x98, 0x3B, 0x3B, 0x55, 0x55, 0xC4, 0xC4, 0xB6, 0xB6, 0x3B, 0x3B, 0x42, 0x42, 0xC4, 0xC4, 0xC4,
+0xC4, 0x3B, 0x3B, 0x3B, 0x3B, 0xC3, 0xC3, 0xC4, 0xC4, 0x42, 0x42, 0x3B, 0x3B, 0xB6, 0xB6, 0xBE,
+0xBE, 0x53, 0x53, 0x56, 0x56, 0xC4, 0xC4, 0xC4, 0xC4, 0xA4, 0xA4, 0x79, 0x79, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBA, 0xBA, 0x93, 0x93, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x60, 0x60, 0xBB, 0xBB, 0xBA,
+0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB1, 0xB1, 0xAD,
+0xAD, 0xA8, 0xA8, 0xA1, 0xA1, 0x97, 0x97, 0x77, 0x77, 0x66, 0x66, 0x5D, 0x5D, 0x57, 0x57, 0x52,
+0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47,
+0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x51, 0x51, 0x56, 0x56, 0x5B, 0x5B, 0x63, 0x63, 0x70,
+0x70, 0x94, 0x94, 0x9E, 0x9E, 0xA6, 0xA6, 0xAC, 0xAC, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8,
+0xB8, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF,
+0xAF, 0xAB, 0xAB, 0xA5, 0xA5, 0x9E, 0x9E, 0x93, 0x93, 0x6F, 0x6F, 0x63, 0x63, 0x5B, 0x5B, 0x55,
+0x55, 0x51, 0x51, 0x4D, 0x4D, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x48,
+0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5A, 0x5A, 0x61, 0x61, 0x6C,
+0x6C, 0x90, 0x90, 0x9C, 0x9C, 0xA4, 0xA4, 0xAA, 0xAA, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7,
+0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAE,
+0xAE, 0xAA, 0xAA, 0xA4, 0xA4, 0x9C, 0x9C, 0x91, 0x91, 0x6D, 0x6D, 0x62, 0x62, 0x5B, 0x5B, 0x55,
+0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49,
+0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x54, 0x54, 0x58, 0x58, 0x5F, 0x5F, 0x67, 0x67, 0x7F,
+0x7F, 0x98, 0x98, 0xA1, 0xA1, 0xA7, 0xA7, 0xAC, 0xAC, 0xB0, 0xB0, 0xB3, 0xB3, 0xB5, 0xB5, 0xB7,
+0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9,
+0xA9, 0xA3, 0xA3, 0x9C, 0x9C, 0x8F, 0x8F, 0x6C, 0x6C, 0x61, 0x61, 0x5A, 0x5A, 0x55, 0x55, 0x51,
+0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4C,
+0x4C, 0x4E, 0x4E, 0x51, 0x51, 0x55, 0x55, 0x5B, 0x5B, 0x62, 0x62, 0x6D, 0x6D, 0x90, 0x90, 0x9C,
+0x9C, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA4, 0xA4, 0x9D,
+0x9D, 0x93, 0x93, 0x70, 0x70, 0x64, 0x64, 0x5C, 0x5C, 0x57, 0x57, 0x52, 0x52, 0x4F, 0x4F, 0x4C,
+0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4F, 0x4F, 0x52,
+0x52, 0x56, 0x56, 0x5C, 0x5C, 0x63, 0x63, 0x6F, 0x6F, 0x92, 0x92, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9,
+0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB4,
+0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA7, 0xA7, 0xA1, 0xA1, 0x99, 0x99, 0x8A, 0x8A, 0x6A,
+0x6A, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A,
+0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5B, 0x5B, 0x61,
+0x61, 0x6B, 0x6B, 0x8D, 0x8D, 0x9B, 0x9B, 0xA3, 0xA3, 0xA8, 0xA8, 0xAD, 0xAD, 0xB0, 0xB0, 0xB3,
+0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC,
+0xAC, 0xA7, 0xA7, 0xA1, 0xA1, 0x98, 0x98, 0x88, 0x88, 0x69, 0x69, 0x60, 0x60, 0x59, 0x59, 0x54,
+0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E,
+0x4E, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x64, 0x64, 0x71, 0x71, 0x93, 0x93, 0x9D,
+0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9, 0xA9, 0xA3, 0xA3, 0x9C, 0x9C, 0x91,
+0x91, 0x6F, 0x6F, 0x63, 0x63, 0x5C, 0x5C, 0x57, 0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4D, 0x4D, 0x4C,
+0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5B,
+0x5B, 0x62, 0x62, 0x6D, 0x6D, 0x90, 0x90, 0x9B, 0x9B, 0xA3, 0xA3, 0xA8, 0xA8, 0xAD, 0xAD, 0xB0,
+0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD,
+0xAD, 0xA9, 0xA9, 0xA4, 0xA4, 0x9D, 0x9D, 0x92, 0x92, 0x6F, 0x6F, 0x63, 0x63, 0x5C, 0x5C, 0x57,
+0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4D,
+0x4D, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5C, 0x5C, 0x64, 0x64, 0x70, 0x70, 0x93, 0x93, 0x9D,
+0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA7, 0xA7, 0xA2, 0xA2, 0x99, 0x99, 0x8A,
+0x8A, 0x6A, 0x6A, 0x60, 0x60, 0x59, 0x59, 0x55, 0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B,
+0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x51, 0x51, 0x54, 0x54, 0x59, 0x59, 0x60,
+0x60, 0x69, 0x69, 0x89, 0x89, 0x99, 0x99, 0xA2, 0xA2, 0xA8, 0xA8, 0xAC, 0xAC, 0xB0, 0xB0, 0xB2,
+0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9,
+0xA9, 0xA4, 0xA4, 0x9D, 0x9D, 0x91, 0x91, 0x6E, 0x6E, 0x62, 0x62, 0x5B, 0x5B, 0x56, 0x56, 0x52,
+0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x50,
+0x50, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x67, 0x67, 0x79, 0x79, 0x97, 0x97, 0xA0, 0xA0, 0xA6,
+0xA6, 0xAB, 0xAB, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3,
+0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA5, 0xA5, 0x9D, 0x9D, 0x92, 0x92, 0x6F, 0x6F, 0x63,
+0x63, 0x5B, 0x5B, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A,
+0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x67, 0x67, 0x79,
+0x79, 0x98, 0x98, 0xA1, 0xA1, 0xA7, 0xA7, 0xAC, 0xAC, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5,
+0xB5, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA4, 0xA4, 0x9D,
+0x9D, 0x91, 0x91, 0x6D, 0x6D, 0x62, 0x62, 0x5A, 0x5A, 0x55, 0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4B,
+0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x53, 0x53, 0x58,
+0x58, 0x5F, 0x5F, 0x68, 0x68, 0x89, 0x89, 0x9A, 0x9A, 0xA2, 0xA2, 0xA8, 0xA8, 0xAD, 0xAD, 0xB0,
+0xB0, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE,
+0xAE, 0xA9, 0xA9, 0xA3, 0xA3, 0x9B, 0x9B, 0x8C, 0x8C, 0x69, 0x69, 0x5F, 0x5F, 0x59, 0x59, 0x53,
+0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4C,
+0x4C, 0x4F, 0x4F, 0x54, 0x54, 0x59, 0x59, 0x60, 0x60, 0x6C, 0x6C, 0x90, 0x90, 0x9D, 0x9D, 0xA5,
+0xA5, 0xAB, 0xAB, 0xAF, 0xAF, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6,
+0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAD, 0xAD, 0xA8, 0xA8, 0xA1, 0xA1, 0x98, 0x98, 0x78, 0x78, 0x65,
+0x65, 0x5C, 0x5C, 0x56, 0x56, 0x51, 0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x48,
+0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5B, 0x5B, 0x63, 0x63, 0x72,
+0x72, 0x96, 0x96, 0xA1, 0xA1, 0xA8, 0xA8, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAC, 0xAC, 0xA7, 0xA7, 0x9F,
+0x9F, 0x94, 0x94, 0x6E, 0x6E, 0x61, 0x61, 0x59, 0x59, 0x53, 0x53, 0x4F, 0x4F, 0x4B, 0x4B, 0x49,
+0x49, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x51, 0x51, 0x56,
+0x56, 0x5C, 0x5C, 0x66, 0x66, 0x87, 0x87, 0x9A, 0x9A, 0xA3, 0xA3, 0xAA, 0xAA, 0xAF, 0xAF, 0xB3,
+0xB3, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB0,
+0xB0, 0xAC, 0xAC, 0xA5, 0xA5, 0x9D, 0x9D, 0x8E, 0x8E, 0x69, 0x69, 0x5E, 0x5E, 0x57, 0x57, 0x51,
+0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x49,
+0x49, 0x4C, 0x4C, 0x51, 0x51, 0x56, 0x56, 0x5E, 0x5E, 0x69, 0x69, 0x8F, 0x8F, 0x9D, 0x9D, 0xA6,
+0xA6, 0xAC, 0xAC, 0xB1, 0xB1, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xB9, 0xB9, 0xBA, 0xBA, 0xB9,
+0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5, 0xA5, 0x9B, 0x9B, 0x88, 0x88, 0x66,
+0x66, 0x5C, 0x5C, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4D, 0x4D, 0x51, 0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6C,
+0x6C, 0x93, 0x93, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE, 0xAE, 0xB3, 0xB3, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA,
+0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xB0, 0xB0, 0xAB, 0xAB, 0xA4,
+0xA4, 0x9A, 0x9A, 0x79, 0x79, 0x64, 0x64, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x49, 0x49, 0x46,
+0x46, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x44, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4C, 0x4C, 0x51,
+0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6D, 0x6D, 0x95, 0x95, 0xA1, 0xA1, 0xA9, 0xA9, 0xAF, 0xAF, 0xB4,
+0xB4, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6,
+0xB6, 0xB1, 0xB1, 0xAC, 0xAC, 0xA5, 0xA5, 0x9B, 0x9B, 0x79, 0x79, 0x63, 0x63, 0x59, 0x59, 0x52,
+0x52, 0x4D, 0x4D, 0x49, 0x49, 0x46, 0x46, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x44,
+0x44, 0x47, 0x47, 0x4A, 0x4A, 0x4F, 0x4F, 0x55, 0x55, 0x5E, 0x5E, 0x6A, 0x6A, 0x93, 0x93, 0xA1,
+0xA1, 0xA9, 0xA9, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB3, 0xB3, 0xAE, 0xAE, 0xA7, 0xA7, 0x9E, 0x9E, 0x8B,
+0x8B, 0x65, 0x65, 0x5A, 0x5A, 0x53, 0x53, 0x4D, 0x4D, 0x49, 0x49, 0x45, 0x45, 0x43, 0x43, 0x42,
+0x42, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x45, 0x45, 0x48, 0x48, 0x4C, 0x4C, 0x52, 0x52, 0x5A,
+0x5A, 0x65, 0x65, 0x8A, 0x8A, 0x9E, 0x9E, 0xA7, 0xA7, 0xAF, 0xAF, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB,
+0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB2,
+0xB2, 0xAC, 0xAC, 0xA3, 0xA3, 0x97, 0x97, 0x6E, 0x6E, 0x5F, 0x5F, 0x56, 0x56, 0x4F, 0x4F, 0x4A,
+0x4A, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x45,
+0x45, 0x49, 0x49, 0x4E, 0x4E, 0x54, 0x54, 0x5D, 0x5D, 0x6B, 0x6B, 0x95, 0x95, 0xA2, 0xA2, 0xAB,
+0xAB, 0xB1, 0xB1, 0xB6, 0xB6, 0xBA, 0xBA, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF,
+0xBF, 0xBD, 0xBD, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xAA, 0xAA, 0xA1, 0xA1, 0x91, 0x91, 0x67,
+0x67, 0x5B, 0x5B, 0x53, 0x53, 0x4C, 0x4C, 0x47, 0x47, 0x44, 0x44, 0x41, 0x41, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3E, 0x3E, 0x3F, 0x3F, 0x41, 0x41, 0x44, 0x44, 0x49, 0x49, 0x4E, 0x4E, 0x55, 0x55, 0x5E,
+0x5E, 0x6E, 0x6E, 0x98, 0x98, 0xA5, 0xA5, 0xAD, 0xAD, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC, 0xBC, 0xBF,
+0xBF, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB2,
+0xB2, 0xAB, 0xAB, 0xA1, 0xA1, 0x92, 0x92, 0x67, 0x67, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x46,
+0x46, 0x42, 0x42, 0x40, 0x40, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x40, 0x40, 0x43,
+0x43, 0x47, 0x47, 0x4C, 0x4C, 0x53, 0x53, 0x5C, 0x5C, 0x6A, 0x6A, 0x96, 0x96, 0xA4, 0xA4, 0xAD,
+0xAD, 0xB3, 0xB3, 0xB9, 0xB9, 0xBC, 0xBC, 0xBF, 0xBF, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1,
+0xC1, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAE, 0xAE, 0xA5, 0xA5, 0x99, 0x99, 0x6D,
+0x6D, 0x5D, 0x5D, 0x54, 0x54, 0x4D, 0x4D, 0x47, 0x47, 0x43, 0x43, 0x40, 0x40, 0x3E, 0x3E, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3E, 0x3E, 0x40, 0x40, 0x44, 0x44, 0x48, 0x48, 0x4F, 0x4F, 0x56,
+0x56, 0x61, 0x61, 0x85, 0x85, 0x9E, 0x9E, 0xA9, 0xA9, 0xB1, 0xB1, 0xB7, 0xB7, 0xBB, 0xBB, 0xBF,
+0xBF, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9,
+0xB9, 0xB3, 0xB3, 0xAC, 0xAC, 0xA2, 0xA2, 0x93, 0x93, 0x66, 0x66, 0x59, 0x59, 0x51, 0x51, 0x4A,
+0x4A, 0x45, 0x45, 0x41, 0x41, 0x3E, 0x3E, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x40, 0x40, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x58, 0x58, 0x64, 0x64, 0x8E, 0x8E, 0xA0,
+0xA0, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD, 0xBD, 0xC0, 0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC1, 0xC1, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAC, 0xAC, 0xA3,
+0xA3, 0x92, 0x92, 0x66, 0x66, 0x59, 0x59, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x40, 0x40, 0x3D,
+0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x42, 0x42, 0x47,
+0x47, 0x4D, 0x4D, 0x55, 0x55, 0x61, 0x61, 0x85, 0x85, 0x9F, 0x9F, 0xAA, 0xAA, 0xB2, 0xB2, 0xB8,
+0xB8, 0xBD, 0xBD, 0xC1, 0xC1, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3,
+0xC3, 0xC0, 0xC0, 0xBC, 0xBC, 0xB7, 0xB7, 0xB0, 0xB0, 0xA7, 0xA7, 0x9A, 0x9A, 0x6C, 0x6C, 0x5C,
+0x5C, 0x52, 0x52, 0x4B, 0x4B, 0x45, 0x45, 0x40, 0x40, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x5A,
+0x5A, 0x68, 0x68, 0x96, 0x96, 0xA5, 0xA5, 0xAE, 0xAE, 0xB6, 0xB6, 0xBB, 0xBB, 0xBF, 0xBF, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBB,
+0xBB, 0xB6, 0xB6, 0xAE, 0xAE, 0xA4, 0xA4, 0x95, 0x95, 0x67, 0x67, 0x59, 0x59, 0x50, 0x50, 0x48,
+0x48, 0x43, 0x43, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x43, 0x43, 0x49, 0x49, 0x50, 0x50, 0x5A, 0x5A, 0x69, 0x69, 0x97,
+0x97, 0xA6, 0xA6, 0xAF, 0xAF, 0xB6, 0xB6, 0xBC, 0xBC, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB7, 0xB7, 0xB0,
+0xB0, 0xA6, 0xA6, 0x98, 0x98, 0x6A, 0x6A, 0x5A, 0x5A, 0x50, 0x50, 0x48, 0x48, 0x43, 0x43, 0x3E,
+0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x41, 0x41, 0x46, 0x46, 0x4D, 0x4D, 0x56, 0x56, 0x63, 0x63, 0x8F, 0x8F, 0xA3, 0xA3, 0xAD,
+0xAD, 0xB5, 0xB5, 0xBB, 0xBB, 0xC0, 0xC0, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBB, 0xBB, 0xB4, 0xB4, 0xAC, 0xAC, 0xA1,
+0xA1, 0x8B, 0x8B, 0x61, 0x61, 0x54, 0x54, 0x4C, 0x4C, 0x45, 0x45, 0x40, 0x40, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x42,
+0x42, 0x47, 0x47, 0x4F, 0x4F, 0x58, 0x58, 0x67, 0x67, 0x96, 0x96, 0xA6, 0xA6, 0xB0, 0xB0, 0xB7,
+0xB7, 0xBD, 0xBD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBB, 0xBB, 0xB4, 0xB4, 0xAC, 0xAC, 0xA1, 0xA1, 0x87,
+0x87, 0x60, 0x60, 0x54, 0x54, 0x4B, 0x4B, 0x44, 0x44, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x40, 0x40, 0x46,
+0x46, 0x4D, 0x4D, 0x56, 0x56, 0x65, 0x65, 0x94, 0x94, 0xA5, 0xA5, 0xB0, 0xB0, 0xB7, 0xB7, 0xBD,
+0xBD, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBD, 0xBD, 0xB7, 0xB7, 0xAF, 0xAF, 0xA4, 0xA4, 0x93, 0x93, 0x64,
+0x64, 0x56, 0x56, 0x4D, 0x4D, 0x46, 0x46, 0x40, 0x40, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x43, 0x43, 0x49,
+0x49, 0x51, 0x51, 0x5D, 0x5D, 0x72, 0x72, 0x9E, 0x9E, 0xAB, 0xAB, 0xB4, 0xB4, 0xBB, 0xBB, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB5, 0xB5, 0xAC, 0xAC, 0xA0, 0xA0, 0x7B, 0x7B, 0x5E,
+0x5E, 0x53, 0x53, 0x4A, 0x4A, 0x43, 0x43, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x43, 0x43, 0x4A,
+0x4A, 0x53, 0x53, 0x5F, 0x5F, 0x89, 0x89, 0xA1, 0xA1, 0xAD, 0xAD, 0xB6, 0xB6, 0xBC, 0xBC, 0xC2,
+0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB5, 0xB5, 0xAC, 0xAC, 0xA0, 0xA0, 0x77, 0x77, 0x5D,
+0x5D, 0x52, 0x52, 0x49, 0x49, 0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x42, 0x42, 0x49,
+0x49, 0x51, 0x51, 0x5D, 0x5D, 0x76, 0x76, 0xA0, 0xA0, 0xAC, 0xAC, 0xB5, 0xB5, 0xBC, 0xBC, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB7, 0xB7, 0xAF, 0xAF, 0xA4, 0xA4, 0x90, 0x90, 0x62,
+0x62, 0x54, 0x54, 0x4B, 0x4B, 0x44, 0x44, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x46,
+0x46, 0x4D, 0x4D, 0x58, 0x58, 0x68, 0x68, 0x99, 0x99, 0xA8, 0xA8, 0xB2, 0xB2, 0xBA, 0xBA, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB4, 0xB4, 0xAB, 0xAB, 0x9D, 0x9D, 0x6E,
+0x6E, 0x5B, 0x5B, 0x4F, 0x4F, 0x47, 0x47, 0x41, 0x41, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x41,
+0x41, 0x48, 0x48, 0x50, 0x50, 0x5B, 0x5B, 0x71, 0x71, 0x9F, 0x9F, 0xAC, 0xAC, 0xB5, 0xB5, 0xBC,
+0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBA, 0xBA, 0xB3, 0xB3, 0xA9, 0xA9, 0x9A,
+0x9A, 0x69, 0x69, 0x57, 0x57, 0x4D, 0x4D, 0x45, 0x45, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x41, 0x41, 0x48, 0x48, 0x51, 0x51, 0x5D, 0x5D, 0x77, 0x77, 0xA0, 0xA0, 0xAD, 0xAD, 0xB6,
+0xB6, 0xBD, 0xBD, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBB, 0xBB, 0xB3, 0xB3, 0xA9,
+0xA9, 0x9A, 0x9A, 0x69, 0x69, 0x58, 0x58, 0x4D, 0x4D, 0x45, 0x45, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x47, 0x47, 0x4F, 0x4F, 0x5B, 0x5B, 0x71, 0x71, 0x9F, 0x9F, 0xAC,
+0xAC, 0xB6, 0xB6, 0xBD, 0xBD, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBC, 0xBC, 0xB5,
+0xB5, 0xAB, 0xAB, 0x9E, 0x9E, 0x6D, 0x6D, 0x5A, 0x5A, 0x4E, 0x4E, 0x46, 0x46, 0x40, 0x40, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x45, 0x45, 0x4D, 0x4D, 0x58, 0x58, 0x69, 0x69, 0x9B,
+0x9B, 0xAA, 0xAA, 0xB4, 0xB4, 0xBB, 0xBB, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF,
+0xBF, 0xB8, 0xB8, 0xAF, 0xAF, 0xA3, 0xA3, 0x88, 0x88, 0x5E, 0x5E, 0x51, 0x51, 0x48, 0x48, 0x41,
+0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x42, 0x42, 0x4A, 0x4A, 0x54, 0x54, 0x62,
+0x62, 0x94, 0x94, 0xA6, 0xA6, 0xB2, 0xB2, 0xBA, 0xBA, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xBA, 0xBA, 0xB2, 0xB2, 0xA7, 0xA7, 0x95, 0x95, 0x63, 0x63, 0x54, 0x54, 0x4A,
+0x4A, 0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x47, 0x47, 0x50,
+0x50, 0x5D, 0x5D, 0x80, 0x80, 0xA2, 0xA2, 0xAF, 0xAF, 0xB8, 0xB8, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBD, 0xBD, 0xB5, 0xB5, 0xAB, 0xAB, 0x9C, 0x9C, 0x6A, 0x6A, 0x57,
+0x57, 0x4C, 0x4C, 0x44, 0x44, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x45,
+0x45, 0x4D, 0x4D, 0x59, 0x59, 0x6C, 0x6C, 0x9D, 0x9D, 0xAC, 0xAC, 0xB6, 0xB6, 0xBD, 0xBD, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB7, 0xB7, 0xAE, 0xAE, 0xA1, 0xA1, 0x74,
+0x74, 0x5B, 0x5B, 0x4F, 0x4F, 0x46, 0x46, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x43, 0x43, 0x4B, 0x4B, 0x55, 0x55, 0x65, 0x65, 0x98, 0x98, 0xA9, 0xA9, 0xB4, 0xB4, 0xBC,
+0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB9, 0xB9, 0xB0, 0xB0, 0xA4,
+0xA4, 0x8A, 0x8A, 0x5E, 0x5E, 0x51, 0x51, 0x47, 0x47, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x42, 0x42, 0x4A, 0x4A, 0x54, 0x54, 0x64, 0x64, 0x97, 0x97, 0xA9, 0xA9, 0xB4,
+0xB4, 0xBC, 0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB9, 0xB9, 0xB0,
+0xB0, 0xA3, 0xA3, 0x88, 0x88, 0x5D, 0x5D, 0x50, 0x50, 0x47, 0x47, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x43, 0x43, 0x4B, 0x4B, 0x56, 0x56, 0x67, 0x67, 0x9B, 0x9B, 0xAB,
+0xAB, 0xB6, 0xB6, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB7,
+0xB7, 0xAE, 0xAE, 0x9F, 0x9F, 0x6E, 0x6E, 0x58, 0x58, 0x4D, 0x4D, 0x44, 0x44, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x45, 0x45, 0x4F, 0x4F, 0x5C, 0x5C, 0x79, 0x79, 0xA3,
+0xA3, 0xB0, 0xB0, 0xB9, 0xB9, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBB,
+0xBB, 0xB3, 0xB3, 0xA7, 0xA7, 0x93, 0x93, 0x60, 0x60, 0x52, 0x52, 0x48, 0x48, 0x40, 0x40, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x43, 0x43, 0x4B, 0x4B, 0x57, 0x57, 0x6A, 0x6A, 0x9E,
+0x9E, 0xAD, 0xAD, 0xB7, 0xB7, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBD,
+0xBD, 0xB4, 0xB4, 0xA9, 0xA9, 0x96, 0x96, 0x62, 0x62, 0x53, 0x53, 0x48, 0x48, 0x40, 0x40, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x43, 0x43, 0x4C, 0x4C, 0x57, 0x57, 0x6C, 0x6C, 0x9F,
+0x9F, 0xAE, 0xAE, 0xB8, 0xB8, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBB,
+0xBB, 0xB2, 0xB2, 0xA5, 0xA5, 0x8D, 0x8D, 0x5D, 0x5D, 0x50, 0x50, 0x46, 0x46, 0x3E, 0x3E, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x47, 0x47, 0x51, 0x51, 0x60, 0x60, 0x93, 0x93, 0xA8,
+0xA8, 0xB3, 0xB3, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB5,
+0xB5, 0xA9, 0xA9, 0x97, 0x97, 0x62, 0x62, 0x52, 0x52, 0x48, 0x48, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x46, 0x46, 0x50, 0x50, 0x5E, 0x5E, 0x91, 0x91, 0xA7, 0xA7, 0xB4,
+0xB4, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBC, 0xBC, 0xB3, 0xB3, 0xA7,
+0xA7, 0x90, 0x90, 0x5E, 0x5E, 0x50, 0x50, 0x46, 0x46, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x41, 0x41, 0x4A, 0x4A, 0x55, 0x55, 0x68, 0x68, 0x9E, 0x9E, 0xAE, 0xAE, 0xB8, 0xB8, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB6, 0xB6, 0xAB, 0xAB, 0x99, 0x99, 0x63,
+0x63, 0x52, 0x52, 0x48, 0x48, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x49,
+0x49, 0x55, 0x55, 0x69, 0x69, 0x9E, 0x9E, 0xAE, 0xAE, 0xB8, 0xB8, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB4, 0xB4, 0xA7, 0xA7, 0x91, 0x91, 0x5D, 0x5D, 0x4F, 0x4F, 0x45,
+0x45, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x45, 0x45, 0x4F, 0x4F, 0x5E, 0x5E, 0x92,
+0x92, 0xA8, 0xA8, 0xB5, 0xB5, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB6,
+0xB6, 0xAA, 0xAA, 0x95, 0x95, 0x60, 0x60, 0x50, 0x50, 0x45, 0x45, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x46, 0x46, 0x51, 0x51, 0x62, 0x62, 0x9A, 0x9A, 0xAC, 0xAC, 0xB7, 0xB7, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBB, 0xBB, 0xB1, 0xB1, 0xA2, 0xA2, 0x6C, 0x6C, 0x56,
+0x56, 0x4A, 0x4A, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x44, 0x44, 0x4F, 0x4F, 0x5E,
+0x5E, 0x94, 0x94, 0xA9, 0xA9, 0xB6, 0xB6, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBA,
+0xBA, 0xAF, 0xAF, 0x9F, 0x9F, 0x68, 0x68, 0x54, 0x54, 0x48, 0x48, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x48, 0x48, 0x55, 0x55, 0x69, 0x69, 0xA0, 0xA0, 0xB0, 0xB0, 0xBB, 0xBB, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB2, 0xB2, 0xA4, 0xA4, 0x71, 0x71, 0x57, 0x57, 0x4A,
+0x4A, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x49, 0x49, 0x56, 0x56, 0x6E, 0x6E, 0xA3,
+0xA3, 0xB2, 0xB2, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB9, 0xB9, 0xAD, 0xAD, 0x9A,
+0x9A, 0x61, 0x61, 0x50, 0x50, 0x44, 0x44, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x47, 0x47, 0x53,
+0x53, 0x66, 0x66, 0x9F, 0x9F, 0xB0, 0xB0, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB8,
+0xB8, 0xAB, 0xAB, 0x95, 0x95, 0x5D, 0x5D, 0x4D, 0x4D, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41,
+0x41, 0x4C, 0x4C, 0x5A, 0x5A, 0x91, 0x91, 0xA9, 0xA9, 0xB7, 0xB7, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2,
+0xC2, 0xBA, 0xBA, 0xAE, 0xAE, 0x9A, 0x9A, 0x60, 0x60, 0x4F, 0x4F, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x4E, 0x4E, 0x5F, 0x5F, 0x98, 0x98, 0xAD, 0xAD, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBE, 0xBE, 0xB4, 0xB4, 0xA5, 0xA5, 0x6E, 0x6E, 0x55, 0x55, 0x48, 0x48, 0x3E, 0x3E, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x41, 0x41, 0x4C, 0x4C, 0x5C, 0x5C, 0x94, 0x94, 0xAB, 0xAB, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBD, 0xBD, 0xB2, 0xB2, 0xA0, 0xA0, 0x66, 0x66, 0x51, 0x51, 0x45, 0x45, 0x3C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x46, 0x46, 0x54, 0x54, 0x6C, 0x6C, 0xA4, 0xA4, 0xB4, 0xB4, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xB3, 0xB3, 0xA2, 0xA2, 0x68, 0x68, 0x52, 0x52, 0x45, 0x45, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x49,
+0x49, 0x57, 0x57, 0x89, 0x89, 0xA9, 0xA9, 0xB8, 0xB8, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB9, 0xB9, 0xAB,
+0xAB, 0x91, 0x91, 0x59, 0x59, 0x49, 0x49, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x48, 0x48, 0x56, 0x56, 0x7A,
+0x7A, 0xA9, 0xA9, 0xB8, 0xB8, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB5, 0xB5, 0xA5, 0xA5, 0x6C, 0x6C, 0x53,
+0x53, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x51, 0x51, 0x66, 0x66, 0xA3, 0xA3, 0xB4, 0xB4, 0xBF,
+0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC0, 0xC0, 0xB5, 0xB5, 0xA5, 0xA5, 0x6A, 0x6A, 0x52, 0x52, 0x44, 0x44, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x48,
+0x48, 0x57, 0x57, 0x89, 0x89, 0xAA, 0xAA, 0xB9, 0xB9, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB9, 0xB9, 0xAB, 0xAB, 0x8B,
+0x8B, 0x57, 0x57, 0x47, 0x47, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x47, 0x47, 0x57, 0x57, 0x8C, 0x8C, 0xAC, 0xAC, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0xB6, 0xB6, 0xA5, 0xA5, 0x67, 0x67, 0x50, 0x50, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x50,
+0x50, 0x69, 0x69, 0xA5, 0xA5, 0xB6, 0xB6, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB6, 0xB6, 0xA5, 0xA5, 0x68, 0x68, 0x50,
+0x50, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x46, 0x46, 0x55, 0x55, 0x89, 0x89, 0xAB, 0xAB, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xAD,
+0xAD, 0x90, 0x90, 0x56, 0x56, 0x46, 0x46, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x54, 0x54, 0x77, 0x77, 0xAB, 0xAB, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB9, 0xB9, 0xA8, 0xA8, 0x6D, 0x6D, 0x51, 0x51, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4B, 0x4B, 0x60, 0x60, 0xA1,
+0xA1, 0xB5, 0xB5, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xAC, 0xAC, 0x88, 0x88, 0x54, 0x54, 0x44, 0x44, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4E, 0x4E, 0x66,
+0x66, 0xA5, 0xA5, 0xB8, 0xB8, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB5, 0xB5, 0xA1, 0xA1, 0x60, 0x60, 0x4B, 0x4B, 0x3E, 0x3E, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4A, 0x4A, 0x5E,
+0x5E, 0xA0, 0xA0, 0xB5, 0xB5, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB4, 0xB4, 0x9F, 0x9F, 0x5E, 0x5E, 0x49, 0x49, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4F, 0x4F, 0x6D,
+0x6D, 0xA9, 0xA9, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xA8, 0xA8, 0x6A, 0x6A, 0x4E, 0x4E, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4D, 0x4D, 0x69, 0x69, 0xA8,
+0xA8, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB8, 0xB8, 0xA4, 0xA4, 0x62, 0x62, 0x4B, 0x4B, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x56, 0x56, 0x96, 0x96, 0xB2, 0xB2, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAC,
+0xAC, 0x6F, 0x6F, 0x50, 0x50, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x55, 0x55, 0x94, 0x94, 0xB1, 0xB1, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xA6, 0xA6, 0x64, 0x64, 0x4B,
+0x4B, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x4B,
+0x4B, 0x63, 0x63, 0xA6, 0xA6, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xAD, 0xAD, 0x75, 0x75, 0x50, 0x50, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x4A, 0x4A, 0x62, 0x62, 0xA6, 0xA6, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xA8,
+0xA8, 0x64, 0x64, 0x4A, 0x4A, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x42, 0x42, 0x53, 0x53, 0x90, 0x90, 0xB1, 0xB1, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xAF, 0xAF, 0x7A, 0x7A, 0x50, 0x50, 0x40, 0x40, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x52, 0x52, 0x90, 0x90, 0xB1,
+0xB1, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAB,
+0xAB, 0x68, 0x68, 0x4B, 0x4B, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x46, 0x46, 0x5D, 0x5D, 0xA3, 0xA3, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB3, 0xB3, 0x95, 0x95, 0x53, 0x53, 0x41, 0x41, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x58, 0x58, 0x9E, 0x9E, 0xB7, 0xB7, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB2, 0xB2, 0x8F, 0x8F, 0x50,
+0x50, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x60,
+0x60, 0xA7, 0xA7, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB,
+0xBB, 0xA6, 0xA6, 0x5E, 0x5E, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x57, 0x57, 0x9E, 0x9E, 0xB7, 0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xA8, 0xA8, 0x61, 0x61, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x5A, 0x5A, 0xA3, 0xA3, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x9F, 0x9F, 0x57, 0x57, 0x42, 0x42, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x4D, 0x4D, 0x84, 0x84, 0xB2, 0xB2, 0xC2,
+0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xA9, 0xA9, 0x60, 0x60, 0x46,
+0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x4B, 0x4B, 0x6F, 0x6F, 0xB0,
+0xB0, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xA6, 0xA6, 0x5C,
+0x5C, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x51, 0x51, 0x98,
+0x98, 0xB6, 0xB6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB4, 0xB4, 0x8F,
+0x8F, 0x4E, 0x4E, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x66,
+0x66, 0xAE, 0xAE, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x9D,
+0x9D, 0x54, 0x54, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x47, 0x47, 0x64,
+0x64, 0xAD, 0xAD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x97,
+0x97, 0x50, 0x50, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x4D, 0x4D, 0x8C,
+0x8C, 0xB5, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xAD, 0xAD, 0x62,
+0x62, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x5F, 0x5F, 0xAB,
+0xAB, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3, 0xB3, 0x73, 0x73, 0x4A,
+0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x5B, 0x5B, 0xA9, 0xA9, 0xBF,
+0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x6D, 0x6D, 0x49, 0x49, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x46, 0x46, 0x65, 0x65, 0xAF, 0xAF, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xA8, 0xA8, 0x5A, 0x5A, 0x41, 0x41, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x51, 0x51, 0x9F, 0x9F, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB1, 0xB1, 0x69, 0x69, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4D, 0x4D, 0x92, 0x92, 0xB7, 0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3,
+0xB3, 0x6A, 0x6A, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x4F, 0x4F, 0x9B,
+0x9B, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xAC, 0xAC, 0x5D, 0x5D, 0x42,
+0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x5A, 0x5A, 0xAA, 0xAA, 0xC0, 0xC0, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x98, 0x98, 0x4D, 0x4D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0x9A, 0x9A, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xA5, 0xA5, 0x54, 0x54, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0x93,
+0x93, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xA4, 0xA4, 0x53, 0x53, 0x3D,
+0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4F, 0x4F, 0x9E, 0x9E, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x94, 0x94, 0x4B, 0x4B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40,
+0x40, 0x5A, 0x5A, 0xAC, 0xAC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xAD, 0xAD, 0x5C,
+0x5C, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4C, 0x4C, 0x9A, 0x9A, 0xBC, 0xBC, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6, 0xB6, 0x6E, 0x6E, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x48, 0x48, 0x84, 0x84, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x87,
+0x87, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x90, 0x90, 0xBA, 0xBA, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB5, 0xB5, 0x68, 0x68, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4F, 0x4F, 0xA0, 0xA0, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xA9, 0xA9, 0x54,
+0x54, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x62, 0x62, 0xB3, 0xB3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x6D, 0x6D, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x52,
+0x52, 0xA8, 0xA8, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0x9C, 0x9C, 0x4B, 0x4B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4D, 0x4D, 0xA1, 0xA1, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF,
+0xBF, 0xA0, 0xA0, 0x4C, 0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4D, 0x4D, 0xA1, 0xA1, 0xC0,
+0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0x98, 0x98, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x54, 0x54, 0xAB, 0xAB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6, 0xB6, 0x66, 0x66, 0x41,
+0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x6B, 0x6B, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2,
+0xC2, 0xA5, 0xA5, 0x4E, 0x4E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x52, 0x52, 0xAA, 0xAA, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x5B, 0x5B, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x4A,
+0x4A, 0x9F, 0x9F, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x64, 0x64, 0x40, 0x40, 0x3B,
+0x3B, 0x3B, 0x3B, 0x47, 0x47, 0x9A, 0x9A, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x66,
+0x66, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x49, 0x49, 0x9F, 0x9F, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB4, 0xB4, 0x5A, 0x5A, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x50, 0x50, 0xAA, 0xAA, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9, 0xA9, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x62,
+0x62, 0xB7, 0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x6E, 0x6E, 0x41, 0x41, 0x3B, 0x3B, 0x3B,
+0x3B, 0x4C, 0x4C, 0xA7, 0xA7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA7, 0xA7, 0x4D, 0x4D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x8D, 0x8D, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xB0, 0xB0, 0x54,
+0x54, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x66, 0x66, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xB5,
+0xB5, 0x5A, 0x5A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x64, 0x64, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB4, 0xB4, 0x57, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x69, 0x69, 0xBC, 0xBC, 0xC4,
+0xC4, 0xC4, 0xC4, 0xAF, 0xAF, 0x50, 0x50, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x99, 0x99, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xA1, 0xA1, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0xAC,
+0xAC, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x62, 0x62, 0x3D, 0x3D, 0x3B, 0x3B, 0x3E, 0x3E, 0x69,
+0x69, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xA7, 0xA7, 0x49, 0x49, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E,
+0x4E, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xB7, 0xB7, 0x57, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0x44,
+0x44, 0x9F, 0x9F, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0x6C, 0x6C, 0x3E, 0x3E, 0x3B, 0x3B, 0x40,
+0x40, 0x8E, 0x8E, 0xC1, 0xC1, 0xC4, 0xC4, 0xC1, 0xC1, 0x8E, 0x8E, 0x3F, 0x3F, 0x3B, 0x3B, 0x3E,
+0x3E, 0x6F, 0x6F, 0xC0, 0xC0, 0xC4, 0xC4, 0xC1, 0xC1, 0x90, 0x90, 0x40, 0x40, 0x3B, 0x3B, 0x40,
+0x40, 0x8E, 0x8E, 0xC2, 0xC2, 0xC4, 0xC4, 0xBF, 0xBF, 0x66, 0x66, 0x3C, 0x3C, 0x3B, 0x3B, 0x43,
+0x43, 0xA0, 0xA0, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0x59, 0x59, 0x3B, 0x3B, 0x3B, 0x3B, 0x4B,
+0x4B, 0xB0, 0xB0, 0xC4, 0xC4, 0xC4, 0xC4, 0xAC, 0xAC, 0x48, 0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x60,
+0x60, 0xBD, 0xBD, 0xC4, 0xC4, 0xC1, 0xC1, 0x6E, 0x6E, 0x3D, 0x3D, 0x3B, 0x3B, 0x45, 0x45, 0xA6,
+0xA6, 0xC4, 0xC4, 0xC4, 0xC4, 0xB0, 0xB0, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x64, 0x64, 0xBF,
+0xBF, 0xC4, 0xC4, 0xBD, 0xBD, 0x60, 0x60, 0x3B, 0x3B, 0x3B, 0x3B, 0x4D, 0x4D, 0xB2, 0xB2, 0xC4,
+0xC4, 0xC4, 0xC4, 0x9B, 0x9B, 0x3F, 0x3F, 0x3B, 0x3B, 0x44, 0x44, 0xA8, 0xA8, 0xC4, 0xC4, 0xC4,
+0xC4, 0xAA, 0xAA, 0x46, 0x46, 0x3B, 0x3B, 0x3E, 0x3E, 0x98, 0x98, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2,
+0xB2, 0x49, 0x49, 0x3B, 0x3B, 0x3D, 0x3D, 0x90, 0x90, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x4A,
+0x4A, 0x3B, 0x3B, 0x3D, 0x3D, 0x94, 0x94, 0xC4, 0xC4, 0xC4, 0xC4, 0xAF, 0xAF, 0x47, 0x47, 0x3B,
+0x3B, 0x3E, 0x3E, 0xA0, 0xA0, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9, 0xA9, 0x42, 0x42, 0x3B, 0x3B, 0x44,
+0x44, 0xAD, 0xAD, 0xC4, 0xC4, 0xC4, 0xC4, 0x91, 0x91, 0x3C, 0x3C, 0x3B, 0x3B, 0x4F, 0x4F, 0xB8,
+0xB8, 0xC4, 0xC4, 0xBE, 0xBE, 0x56, 0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x6A, 0x6A, 0xC4, 0xC4, 0xC4,
+0xC4, 0xAF, 0xAF, 0x45, 0x45, 0x3B, 0x3B, 0x45, 0x45, 0xAE, 0xAE, 0xC4, 0xC4, 0xC3, 0xC3, 0x66,
+0x66, 0x3B, 0x3B, 0x3B, 0x3B, 0x66, 0x66, 0xC4, 0xC4, 0xC4, 0xC4, 0xAE, 0xAE, 0x43, 0x43, 0x3B,
+0x3B, 0x48, 0x48, 0xB5, 0xB5, 0xC4, 0xC4, 0xBE, 0xBE, 0x56, 0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x9D,
+0x9D, 0xC4, 0xC4, 0xC4, 0xC4, 0x8F, 0x8F, 0x3B, 0x3B, 0x3B, 0x3B, 0x5C, 0x5C, 0xC2, 0xC2, 0xC4,
+0xC4, 0xAD, 0xAD, 0x41, 0x41, 0x3B, 0x3B, 0x4B, 0x4B, 0xBA, 0xBA, 0xC4, 0xC4, 0xB8, 0xB8, 0x47,
+0x47, 0x3B, 0x3B, 0x46, 0x46, 0xB6, 0xB6, 0xC4, 0xC4, 0xBC, 0xBC, 0x4C, 0x4C, 0x3B, 0x3B, 0x43,
+0x43, 0xB2, 0xB2, 0xC4, 0xC4, 0xBD, 0xBD, 0x4E, 0x4E, 0x3B, 0x3B, 0x43, 0x43, 0xB3, 0xB3, 0xC4,
+0xC4, 0xBB, 0xBB, 0x4A, 0x4A, 0x3B, 0x3B, 0x46, 0x46, 0xB9, 0xB9, 0xC4, 0xC4, 0xB7, 0xB7, 0x45,
+0x45, 0x3B, 0x3B, 0x4D, 0x4D, 0xBE, 0xBE, 0xC4, 0xC4, 0xAE, 0xAE, 0x3F, 0x3F, 0x3B, 0x3B, 0x5D,
+0x5D, 0xC4, 0xC4, 0xC4, 0xC4, 0x97, 0x97, 0x3B, 0x3B, 0x3B, 0x3B, 0x9B, 0x9B, 0xC4, 0xC4, 0xC4,
+0xC4, 0x57, 0x57, 0x3B, 0x3B, 0x41, 0x41, 0xB5, 0xB5, 0xC4, 0xC4, 0xB6, 0xB6, 0x43, 0x43, 0x3B,
+0x3B, 0x58, 0x58, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA6, 0xA6, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC3, 0xC3, 0xBC, 0xBC, 0xB4, 0xB4, 0xA9, 0xA9, 0x99, 0x99, 0x66, 0x66, 0x56, 0x56, 0x4B,
+0x4B, 0x43, 0x43, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4A, 0x4A, 0x55, 0x55, 0x65,
+0x65, 0x98, 0x98, 0xA9, 0xA9, 0xB3, 0xB3, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xB6, 0xB6, 0xAB, 0xAB, 0x9B, 0x9B, 0x68, 0x68, 0x57, 0x57, 0x4B, 0x4B, 0x42, 0x42, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x49, 0x49, 0x54, 0x54, 0x64, 0x64, 0x98, 0x98, 0xA9, 0xA9, 0xB4,
+0xB4, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB6, 0xB6, 0xAB, 0xAB, 0x9A, 0x9A, 0x65,
+0x65, 0x54, 0x54, 0x49, 0x49, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x49, 0x49, 0x56, 0x56, 0x69,
+0x69, 0x9D, 0x9D, 0xAC, 0xAC, 0xB7, 0xB7, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB4, 0xB4, 0xA8,
+0xA8, 0x94, 0x94, 0x60, 0x60, 0x51, 0x51, 0x46, 0x46, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4B, 0x4B, 0x58,
+0x58, 0x6F, 0x6F, 0xA1, 0xA1, 0xB0, 0xB0, 0xBA, 0xBA, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB3, 0xB3, 0xA6,
+0xA6, 0x8B, 0x8B, 0x5C, 0x5C, 0x4D, 0x4D, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x4B, 0x4B, 0x59, 0x59, 0x78,
+0x78, 0xA5, 0xA5, 0xB2, 0xB2, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB3, 0xB3, 0xA6, 0xA6, 0x80, 0x80, 0x5A,
+0x5A, 0x4C, 0x4C, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x49, 0x49, 0x57, 0x57, 0x70, 0x70, 0xA4, 0xA4, 0xB2, 0xB2, 0xBD,
+0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1,
+0xC1, 0xB7, 0xB7, 0xAA, 0xAA, 0x94, 0x94, 0x5E, 0x5E, 0x4E, 0x4E, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x4F, 0x4F, 0x60,
+0x60, 0x99, 0x99, 0xAC, 0xAC, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB5, 0xB5, 0xA6, 0xA6, 0x74, 0x74, 0x57, 0x57, 0x49,
+0x49, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42,
+0x42, 0x4E, 0x4E, 0x5F, 0x5F, 0x98, 0x98, 0xAC, 0xAC, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBA, 0xBA, 0xAE, 0xAE, 0x99, 0x99, 0x60,
+0x60, 0x4E, 0x4E, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x50, 0x50, 0x63, 0x63, 0x9F, 0x9F, 0xB0, 0xB0, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xB0, 0xB0, 0x9D, 0x9D, 0x62,
+0x62, 0x4F, 0x4F, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D,
+0x3D, 0x49, 0x49, 0x57, 0x57, 0x8B, 0x8B, 0xA9, 0xA9, 0xB7, 0xB7, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAF, 0xAF, 0x9A, 0x9A, 0x5F, 0x5F, 0x4D,
+0x4D, 0x41, 0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x51,
+0x51, 0x67, 0x67, 0xA2, 0xA2, 0xB3, 0xB3, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xAD, 0xAD, 0x95, 0x95, 0x5B, 0x5B, 0x4A, 0x4A, 0x3F, 0x3F, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4B, 0x4B, 0x5D, 0x5D, 0x99, 0x99, 0xAF,
+0xAF, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xAA,
+0xAA, 0x8B, 0x8B, 0x57, 0x57, 0x47, 0x47, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x46, 0x46, 0x55, 0x55, 0x77, 0x77, 0xA9, 0xA9, 0xB8, 0xB8, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xAA, 0xAA, 0x78, 0x78, 0x55, 0x55, 0x46, 0x46, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4C, 0x4C, 0x61, 0x61, 0x9F, 0x9F, 0xB3,
+0xB3, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xAA, 0xAA, 0x80,
+0x80, 0x55, 0x55, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x52,
+0x52, 0x6D, 0x6D, 0xA7, 0xA7, 0xB7, 0xB7, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xB0, 0xB0, 0x99, 0x99, 0x5C, 0x5C, 0x49, 0x49, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x43, 0x43, 0x52, 0x52, 0x6E, 0x6E, 0xA8, 0xA8, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xAA, 0xAA, 0x73, 0x73, 0x53, 0x53, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4C, 0x4C, 0x62, 0x62, 0xA1, 0xA1, 0xB5, 0xB5, 0xC1, 0xC1, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xAA, 0xAA, 0x73, 0x73, 0x52, 0x52, 0x43, 0x43, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x50, 0x50, 0x6D, 0x6D, 0xA9, 0xA9, 0xB9, 0xB9, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB2, 0xB2, 0x9B, 0x9B, 0x5B, 0x5B, 0x48, 0x48, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4D, 0x4D, 0x65, 0x65, 0xA5, 0xA5, 0xB7, 0xB7, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB1, 0xB1, 0x99, 0x99, 0x59, 0x59, 0x47, 0x47, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x52, 0x52, 0x73, 0x73, 0xAB, 0xAB, 0xBB, 0xBB, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xA8, 0xA8, 0x6B, 0x6B, 0x50, 0x50, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4C, 0x4C, 0x63, 0x63, 0xA4, 0xA4, 0xB7, 0xB7, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xAB, 0xAB, 0x73, 0x73, 0x51, 0x51, 0x42, 0x42, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x4D, 0x4D, 0x65, 0x65, 0xA5, 0xA5, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB8, 0xB8, 0xA6, 0xA6, 0x65, 0x65, 0x4D, 0x4D, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44,
+0x44, 0x54, 0x54, 0x8C, 0x8C, 0xAE, 0xAE, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xAF,
+0xAF, 0x94, 0x94, 0x56, 0x56, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4E, 0x4E, 0x68,
+0x68, 0xA7, 0xA7, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB3, 0xB3, 0x9B, 0x9B, 0x5A,
+0x5A, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4C, 0x4C, 0x64, 0x64, 0xA5, 0xA5, 0xB7,
+0xB7, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB3, 0xB3, 0x9B, 0x9B, 0x5A, 0x5A, 0x47, 0x47, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4E, 0x4E, 0x69, 0x69, 0xA8, 0xA8, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBE, 0xBE, 0xAF, 0xAF, 0x91, 0x91, 0x55, 0x55, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43,
+0x43, 0x53, 0x53, 0x89, 0x89, 0xAD, 0xAD, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xA9,
+0xA9, 0x69, 0x69, 0x4E, 0x4E, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x5C, 0x5C, 0x9E,
+0x9E, 0xB4, 0xB4, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xB4, 0xB4, 0x9D, 0x9D, 0x5B, 0x5B, 0x47,
+0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0x50, 0x50, 0x70, 0x70, 0xAB, 0xAB, 0xBC, 0xBC, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xA9, 0xA9, 0x6A, 0x6A, 0x4F, 0x4F, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x49, 0x49, 0x5D, 0x5D, 0xA0, 0xA0, 0xB5, 0xB5, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB1,
+0xB1, 0x96, 0x96, 0x57, 0x57, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x54, 0x54, 0x8F,
+0x8F, 0xAF, 0xAF, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB6, 0xB6, 0xA2, 0xA2, 0x61, 0x61, 0x4B,
+0x4B, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4E, 0x4E, 0x67, 0x67, 0xA7, 0xA7, 0xB9, 0xB9, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAB, 0xAB, 0x73, 0x73, 0x51, 0x51, 0x42, 0x42, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x48, 0x48, 0x5B, 0x5B, 0x9C, 0x9C, 0xB3, 0xB3, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB2,
+0xB2, 0x9A, 0x9A, 0x59, 0x59, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x53, 0x53, 0x80,
+0x80, 0xAC, 0xAC, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0xA5, 0xA5, 0x65, 0x65, 0x4D,
+0x4D, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4C, 0x4C, 0x63, 0x63, 0xA4, 0xA4, 0xB7, 0xB7, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAE, 0xAE, 0x8F, 0x8F, 0x55, 0x55, 0x44, 0x44, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x45, 0x45, 0x57, 0x57, 0x94, 0x94, 0xB0, 0xB0, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB6,
+0xB6, 0xA2, 0xA2, 0x61, 0x61, 0x4B, 0x4B, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4D, 0x4D, 0x65,
+0x65, 0xA5, 0xA5, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xAE, 0xAE, 0x8F, 0x8F, 0x55,
+0x55, 0x45, 0x45, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0x54, 0x54, 0x8C, 0x8C, 0xAD, 0xAD, 0xBC,
+0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0xA6, 0xA6, 0x69, 0x69, 0x4F, 0x4F, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x49, 0x49, 0x5C, 0x5C, 0x9D, 0x9D, 0xB2, 0xB2, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1,
+0xC1, 0xB4, 0xB4, 0x9F, 0x9F, 0x5E, 0x5E, 0x4A, 0x4A, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4C,
+0x4C, 0x62, 0x62, 0xA2, 0xA2, 0xB6, 0xB6, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB2, 0xB2, 0x9B,
+0x9B, 0x5B, 0x5B, 0x49, 0x49, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4E, 0x4E, 0x65, 0x65, 0xA4,
+0xA4, 0xB6, 0xB6, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB1, 0xB1, 0x9A, 0x9A, 0x5B, 0x5B, 0x49,
+0x49, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4E, 0x4E, 0x64, 0x64, 0xA4, 0xA4, 0xB6, 0xB6, 0xC2,
+0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB2, 0xB2, 0x9C, 0x9C, 0x5D, 0x5D, 0x4A, 0x4A, 0x3D, 0x3D, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x4C, 0x4C, 0x61, 0x61, 0xA0, 0xA0, 0xB4, 0xB4, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1,
+0xC1, 0xB4, 0xB4, 0xA1, 0xA1, 0x62, 0x62, 0x4D, 0x4D, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x48,
+0x48, 0x5A, 0x5A, 0x98, 0x98, 0xB0, 0xB0, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xA8,
+0xA8, 0x6F, 0x6F, 0x52, 0x52, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x53, 0x53, 0x71,
+0x71, 0xA9, 0xA9, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB0, 0xB0, 0x99, 0x99, 0x5B,
+0x5B, 0x49, 0x49, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4B, 0x4B, 0x5D, 0x5D, 0x9C, 0x9C, 0xB2,
+0xB2, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB8, 0xB8, 0xA8, 0xA8, 0x6F, 0x6F, 0x52, 0x52, 0x44,
+0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x51, 0x51, 0x6A, 0x6A, 0xA6, 0xA6, 0xB7, 0xB7, 0xC2,
+0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xB3, 0xB3, 0xA0, 0xA0, 0x62, 0x62, 0x4D, 0x4D, 0x41, 0x41, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x47, 0x47, 0x57, 0x57, 0x8E, 0x8E, 0xAC, 0xAC, 0xBA, 0xBA, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBC, 0xBC, 0xAF, 0xAF, 0x97, 0x97, 0x5B, 0x5B, 0x49, 0x49, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E,
+0x3E, 0x4A, 0x4A, 0x5C, 0x5C, 0x97, 0x97, 0xAF, 0xAF, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA,
+0xBA, 0xAC, 0xAC, 0x90, 0x90, 0x58, 0x58, 0x48, 0x48, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4C,
+0x4C, 0x5F, 0x5F, 0x9D, 0x9D, 0xB1, 0xB1, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xAA,
+0xAA, 0x88, 0x88, 0x57, 0x57, 0x47, 0x47, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4C, 0x4C, 0x60,
+0x60, 0x9D, 0x9D, 0xB1, 0xB1, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB9, 0xB9, 0xAB, 0xAB, 0x8B,
+0x8B, 0x57, 0x57, 0x48, 0x48, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4C, 0x4C, 0x5E, 0x5E, 0x9B,
+0x9B, 0xB0, 0xB0, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0xAC, 0xAC, 0x92, 0x92, 0x59,
+0x59, 0x49, 0x49, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x4B, 0x4B, 0x5C, 0x5C, 0x98, 0x98, 0xAF,
+0xAF, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0xAD, 0xAD, 0x95, 0x95, 0x5B, 0x5B, 0x4A,
+0x4A, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x49, 0x49, 0x5A, 0x5A, 0x93, 0x93, 0xAC, 0xAC, 0xBA,
+0xBA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xAF, 0xAF, 0x9A, 0x9A, 0x5E, 0x5E, 0x4C, 0x4C, 0x40,
+0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x48, 0x48, 0x57, 0x57, 0x8B, 0x8B, 0xAA, 0xAA, 0xB9, 0xB9, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBD, 0xBD, 0xB1, 0xB1, 0x9E, 0x9E, 0x61, 0x61, 0x4E, 0x4E, 0x42, 0x42, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x47, 0x47, 0x55, 0x55, 0x74, 0x74, 0xA8, 0xA8, 0xB7, 0xB7, 0xC1, 0xC1, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBE, 0xBE, 0xB3, 0xB3, 0xA1, 0xA1, 0x65, 0x65, 0x50, 0x50, 0x43, 0x43, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C,
+0x3C, 0x46, 0x46, 0x54, 0x54, 0x6F, 0x6F, 0xA6, 0xA6, 0xB6, 0xB6, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0xB3, 0xB3, 0xA1, 0xA1, 0x66, 0x66, 0x51, 0x51, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x46,
+0x46, 0x53, 0x53, 0x6C, 0x6C, 0xA5, 0xA5, 0xB5, 0xB5, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB3,
+0xB3, 0xA2, 0xA2, 0x67, 0x67, 0x51, 0x51, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x46, 0x46, 0x53,
+0x53, 0x6D, 0x6D, 0xA5, 0xA5, 0xB5, 0xB5, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB3, 0xB3, 0xA1,
+0xA1, 0x66, 0x66, 0x51, 0x51, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x48, 0x48, 0x56, 0x56, 0x74,
+0x74, 0xA7, 0xA7, 0xB6, 0xB6, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC, 0xBC, 0xB0, 0xB0, 0x9C, 0x9C, 0x61,
+0x61, 0x4E, 0x4E, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x4B, 0x4B, 0x5A, 0x5A, 0x92, 0x92, 0xAB,
+0xAB, 0xB9, 0xB9, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB8, 0xB8, 0xAB, 0xAB, 0x92, 0x92, 0x5A, 0x5A, 0x4A,
+0x4A, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 0x44, 0x50, 0x50, 0x64, 0x64, 0x9F, 0x9F, 0xB1, 0xB1, 0xBC,
+0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB3, 0xB3, 0xA2, 0xA2, 0x69, 0x69, 0x52, 0x52, 0x46, 0x46, 0x3D,
+0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x40, 0x40, 0x4A, 0x4A, 0x58, 0x58, 0x8B, 0x8B, 0xA9, 0xA9, 0xB7, 0xB7, 0xC1, 0xC1, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1,
+0xC1, 0xB7, 0xB7, 0xAA, 0xAA, 0x90, 0x90, 0x5A, 0x5A, 0x4B, 0x4B, 0x40, 0x40, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x46,
+0x46, 0x53, 0x53, 0x6A, 0x6A, 0xA3, 0xA3, 0xB3, 0xB3, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBA, 0xBA, 0xAD,
+0xAD, 0x99, 0x99, 0x5F, 0x5F, 0x4E, 0x4E, 0x42, 0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x45, 0x45, 0x52, 0x52, 0x66,
+0x66, 0xA0, 0xA0, 0xB1, 0xB1, 0xBC, 0xBC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xB9, 0xB9, 0xAD, 0xAD, 0x99, 0x99, 0x5F,
+0x5F, 0x4E, 0x4E, 0x43, 0x43, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x47, 0x47, 0x54, 0x54, 0x6A, 0x6A, 0xA2, 0xA2, 0xB2,
+0xB2, 0xBD, 0xBD, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xB6, 0xB6, 0xA9, 0xA9, 0x8E, 0x8E, 0x5A, 0x5A, 0x4B, 0x4B, 0x41,
+0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x41, 0x41, 0x4B, 0x4B, 0x5A, 0x5A, 0x8D, 0x8D, 0xA9, 0xA9, 0xB6, 0xB6, 0xBF, 0xBF, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBC,
+0xBC, 0xB1, 0xB1, 0xA0, 0xA0, 0x68, 0x68, 0x53, 0x53, 0x46, 0x46, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x46, 0x46, 0x53,
+0x53, 0x67, 0x67, 0xA0, 0xA0, 0xB1, 0xB1, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB4, 0xB4, 0xA6, 0xA6, 0x79,
+0x79, 0x58, 0x58, 0x4A, 0x4A, 0x40, 0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x45, 0x45, 0x51, 0x51, 0x63, 0x63, 0x9C, 0x9C, 0xAE,
+0xAE, 0xBA, 0xBA, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB4, 0xB4, 0xA6, 0xA6, 0x77, 0x77, 0x58, 0x58, 0x4A, 0x4A, 0x41,
+0x41, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F,
+0x3F, 0x47, 0x47, 0x53, 0x53, 0x68, 0x68, 0xA0, 0xA0, 0xB0, 0xB0, 0xBB, 0xBB, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBB, 0xBB, 0xB0,
+0xB0, 0xA0, 0xA0, 0x69, 0x69, 0x54, 0x54, 0x48, 0x48, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x4C, 0x4C, 0x5A, 0x5A, 0x8C,
+0x8C, 0xA8, 0xA8, 0xB5, 0xB5, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB5, 0xB5, 0xA7, 0xA7, 0x8D, 0x8D, 0x5B, 0x5B, 0x4C,
+0x4C, 0x43, 0x43, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x41, 0x41, 0x4A, 0x4A, 0x57, 0x57, 0x6F, 0x6F, 0xA3, 0xA3, 0xB2, 0xB2, 0xBC, 0xBC, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xB5,
+0xB5, 0xA9, 0xA9, 0x91, 0x91, 0x5C, 0x5C, 0x4D, 0x4D, 0x44, 0x44, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x42, 0x42, 0x4B, 0x4B, 0x58, 0x58, 0x75,
+0x75, 0xA5, 0xA5, 0xB3, 0xB3, 0xBC, 0xBC, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBC, 0xBC, 0xB2, 0xB2, 0xA4, 0xA4, 0x74, 0x74, 0x58, 0x58, 0x4B,
+0x4B, 0x42, 0x42, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F,
+0x3F, 0x46, 0x46, 0x50, 0x50, 0x61, 0x61, 0x97, 0x97, 0xAB, 0xAB, 0xB7, 0xB7, 0xBF, 0xBF, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBE, 0xBE, 0xB6, 0xB6, 0xAA,
+0xAA, 0x96, 0x96, 0x60, 0x60, 0x50, 0x50, 0x46, 0x46, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x45, 0x45, 0x4E, 0x4E, 0x5C, 0x5C, 0x8E, 0x8E, 0xA7,
+0xA7, 0xB4, 0xB4, 0xBC, 0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3,
+0xC3, 0xBE, 0xBE, 0xB6, 0xB6, 0xAA, 0xAA, 0x97, 0x97, 0x62, 0x62, 0x52, 0x52, 0x47, 0x47, 0x40,
+0x40, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0x46, 0x46, 0x50,
+0x50, 0x5F, 0x5F, 0x94, 0x94, 0xA9, 0xA9, 0xB5, 0xB5, 0xBC, 0xBC, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBB, 0xBB, 0xB2, 0xB2, 0xA5, 0xA5, 0x89, 0x89, 0x5C,
+0x5C, 0x4E, 0x4E, 0x45, 0x45, 0x3F, 0x3F, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E,
+0x3E, 0x44, 0x44, 0x4C, 0x4C, 0x57, 0x57, 0x6C, 0x6C, 0xA0, 0xA0, 0xAE, 0xAE, 0xB8, 0xB8, 0xBF,
+0xBF, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBC, 0xBC, 0xB4, 0xB4, 0xA9,
+0xA9, 0x96, 0x96, 0x62, 0x62, 0x53, 0x53, 0x49, 0x49, 0x42, 0x42, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x44, 0x44, 0x4B, 0x4B, 0x56, 0x56, 0x69, 0x69, 0x9D, 0x9D, 0xAC,
+0xAC, 0xB6, 0xB6, 0xBD, 0xBD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBB,
+0xBB, 0xB3, 0xB3, 0xA7, 0xA7, 0x93, 0x93, 0x61, 0x61, 0x53, 0x53, 0x49, 0x49, 0x43, 0x43, 0x3E,
+0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3E, 0x3E, 0x41, 0x41, 0x46, 0x46, 0x4F, 0x4F, 0x5B, 0x5B, 0x74,
+0x74, 0xA2, 0xA2, 0xAF, 0xAF, 0xB8, 0xB8, 0xBD, 0xBD, 0xC1, 0xC1, 0xC3, 0xC3, 0xC2, 0xC2, 0xC1,
+0xC1, 0xBD, 0xBD, 0xB7, 0xB7, 0xAD, 0xAD, 0xA0, 0xA0, 0x70, 0x70, 0x5A, 0x5A, 0x4E, 0x4E, 0x46,
+0x46, 0x41, 0x41, 0x3E, 0x3E, 0x3D, 0x3D, 0x3E, 0x3E, 0x41, 0x41, 0x45, 0x45, 0x4C, 0x4C, 0x56,
+0x56, 0x67, 0x67, 0x9A, 0x9A, 0xAA, 0xAA, 0xB4, 0xB4, 0xBB, 0xBB, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC0, 0xC0, 0xBC, 0xBC, 0xB7, 0xB7, 0xAE, 0xAE, 0xA2, 0xA2, 0x85, 0x85, 0x5D, 0x5D, 0x51,
+0x51, 0x49, 0x49, 0x43, 0x43, 0x41, 0x41, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x46, 0x46, 0x4D,
+0x4D, 0x57, 0x57, 0x68, 0x68, 0x9A, 0x9A, 0xA9, 0xA9, 0xB3, 0xB3, 0xB9, 0xB9, 0xBD, 0xBD, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBA, 0xBA, 0xB4, 0xB4, 0xAB, 0xAB, 0x9E, 0x9E, 0x6E, 0x6E, 0x5A,
+0x5A, 0x50, 0x50, 0x48, 0x48, 0x45, 0x45, 0x42, 0x42, 0x41, 0x41, 0x42, 0x42, 0x46, 0x46, 0x4B,
+0x4B, 0x52, 0x52, 0x5E, 0x5E, 0x7B, 0x7B, 0xA1, 0xA1, 0xAD, 0xAD, 0xB4, 0xB4, 0xBA, 0xBA, 0xBD,
+0xBD, 0xBE, 0xBE, 0xBD, 0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA3, 0xA3, 0x8E, 0x8E, 0x61,
+0x61, 0x54, 0x54, 0x4D, 0x4D, 0x47, 0x47, 0x44, 0x44, 0x43, 0x43, 0x44, 0x44, 0x46, 0x46, 0x4B,
+0x4B, 0x52, 0x52, 0x5D, 0x5D, 0x71, 0x71, 0x9D, 0x9D, 0xAA, 0xAA, 0xB2, 0xB2, 0xB7, 0xB7, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4, 0xB4, 0xAC, 0xAC, 0xA1, 0xA1, 0x8C, 0x8C, 0x61,
+0x61, 0x55, 0x55, 0x4E, 0x4E, 0x49, 0x49, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x49, 0x49, 0x4E,
+0x4E, 0x55, 0x55, 0x60, 0x60, 0x87, 0x87, 0xA0, 0xA0, 0xAB, 0xAB, 0xB2, 0xB2, 0xB7, 0xB7, 0xB9,
+0xB9, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5, 0xB5, 0xAF, 0xAF, 0xA7, 0xA7, 0x9B, 0x9B, 0x6F, 0x6F, 0x5D,
+0x5D, 0x53, 0x53, 0x4D, 0x4D, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4D, 0x4D, 0x53,
+0x53, 0x5C, 0x5C, 0x6C, 0x6C, 0x98, 0x98, 0xA5, 0xA5, 0xAE, 0xAE, 0xB3, 0xB3, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB4, 0xB4, 0xAF, 0xAF, 0xA8, 0xA8, 0x9D, 0x9D, 0x77, 0x77, 0x61, 0x61, 0x56,
+0x56, 0x50, 0x50, 0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x55, 0x55, 0x5D,
+0x5D, 0x6C, 0x6C, 0x97, 0x97, 0xA4, 0xA4, 0xAC, 0xAC, 0xB1, 0xB1, 0xB4, 0xB4, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB1, 0xB1, 0xAC, 0xAC, 0xA5, 0xA5, 0x99, 0x99, 0x72, 0x72, 0x61, 0x61, 0x58, 0x58, 0x52,
+0x52, 0x4F, 0x4F, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x53, 0x53, 0x59, 0x59, 0x63, 0x63, 0x79,
+0x79, 0x9B, 0x9B, 0xA4, 0xA4, 0xAB, 0xAB, 0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xAC,
+0xAC, 0xA6, 0xA6, 0x9D, 0x9D, 0x8D, 0x8D, 0x67, 0x67, 0x5C, 0x5C, 0x56, 0x56, 0x52, 0x52, 0x50,
+0x50, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x5A, 0x5A, 0x62, 0x62, 0x71, 0x71, 0x96, 0x96, 0xA1,
+0xA1, 0xA7, 0xA7, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAA, 0xAA, 0xA4, 0xA4, 0x9C,
+0x9C, 0x8D, 0x8D, 0x69, 0x69, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x58, 0x58, 0x5E, 0x5E, 0x66, 0x66, 0x76, 0x76, 0x97, 0x97, 0xA0, 0xA0, 0xA6, 0xA6, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5, 0xA5, 0x9F, 0x9F, 0x96, 0x96, 0x78, 0x78, 0x67,
+0x67, 0x60, 0x60, 0x5B, 0x5B, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x5E, 0x5E, 0x64,
+0x64, 0x6D, 0x6D, 0x8E, 0x8E, 0x99, 0x99, 0x9F, 0x9F, 0xA4, 0xA4, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA3, 0xA3, 0x9E, 0x9E, 0x97, 0x97, 0x8A, 0x8A, 0x6C, 0x6C, 0x64, 0x64, 0x5F, 0x5F, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5F, 0x5F, 0x61, 0x61, 0x67, 0x67, 0x6F, 0x6F, 0x8B, 0x8B, 0x96,
+0x96, 0x9B, 0x9B, 0x9F, 0x9F, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9A, 0x9A, 0x93,
+0x93, 0x87, 0x87, 0x6E, 0x6E, 0x69, 0x69, 0x65, 0x65, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x65,
+0x65, 0x67, 0x67, 0x6C, 0x6C, 0x74, 0x74, 0x8D, 0x8D, 0x94, 0x94, 0x98, 0x98, 0x9B, 0x9B, 0x9D,
+0x9D, 0x9C, 0x9C, 0x99, 0x99, 0x97, 0x97, 0x92, 0x92, 0x8C, 0x8C, 0x77, 0x77, 0x6F, 0x6F, 0x6C,
+0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x75, 0x75, 0x85,
+0x85, 0x8B, 0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8D,
+0x8D, 0x88, 0x88, 0x7C, 0x7C, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x75,
+0x75, 0x86, 0x86, 0x85, 0x85, 0x82, 0x82, 0x7E, 0x7E, 0x7B, 0x7B, 0x85, 0x85, 0x7A, 0x7A, 0x78,
+0x78, 0x77, 0x77, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x79, 0x79, 0x85, 0x85, 0x8B, 0x8B, 0x8E,
+0x8E, 0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x94, 0x94, 0x93, 0x93, 0x90, 0x90, 0x8A, 0x8A, 0x76,
+0x76, 0x6F, 0x6F, 0x6C, 0x6C, 0x6B, 0x6B, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6F,
+0x6F, 0x77, 0x77, 0x8F, 0x8F, 0x96, 0x96, 0x9A, 0x9A, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C,
+0x9C, 0x97, 0x97, 0x90, 0x90, 0x76, 0x76, 0x6C, 0x6C, 0x66, 0x66, 0x62, 0x62, 0x60, 0x60, 0x61,
+0x61, 0x60, 0x60, 0x64, 0x64, 0x69, 0x69, 0x74, 0x74, 0x91, 0x91, 0x99, 0x99, 0x9F, 0x9F, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA2, 0xA2, 0xA0, 0xA0, 0x9B, 0x9B, 0x93, 0x93, 0x73, 0x73, 0x67, 0x67, 0x61,
+0x61, 0x5C, 0x5C, 0x5A, 0x5A, 0x5A, 0x5A, 0x5C, 0x5C, 0x60, 0x60, 0x67, 0x67, 0x77, 0x77, 0x97,
+0x97, 0x9F, 0x9F, 0xA5, 0xA5, 0xA7, 0xA7, 0xA9, 0xA9, 0xA7, 0xA7, 0xA4, 0xA4, 0x9C, 0x9C, 0x8F,
+0x8F, 0x6A, 0x6A, 0x60, 0x60, 0x59, 0x59, 0x55, 0x55, 0x54, 0x54, 0x56, 0x56, 0x59, 0x59, 0x60,
+0x60, 0x6B, 0x6B, 0x93, 0x93, 0x9F, 0x9F, 0xA7, 0xA7, 0xAC, 0xAC, 0xAD, 0xAD, 0xAC, 0xAC, 0xA9,
+0xA9, 0xA3, 0xA3, 0x97, 0x97, 0x6E, 0x6E, 0x5F, 0x5F, 0x57, 0x57, 0x52, 0x52, 0x51, 0x51, 0x51,
+0x51, 0x55, 0x55, 0x5C, 0x5C, 0x67, 0x67, 0x92, 0x92, 0xA1, 0xA1, 0xAA, 0xAA, 0xAF, 0xAF, 0xB2,
+0xB2, 0xB1, 0xB1, 0xAD, 0xAD, 0xA6, 0xA6, 0x99, 0x99, 0x6B, 0x6B, 0x5C, 0x5C, 0x53, 0x53, 0x4E,
+0x4E, 0x4D, 0x4D, 0x4E, 0x4E, 0x52, 0x52, 0x5A, 0x5A, 0x69, 0x69, 0x98, 0x98, 0xA7, 0xA7, 0xB0,
+0xB0, 0xB4, 0xB4, 0xB5, 0xB5, 0xB3, 0xB3, 0xAE, 0xAE, 0xA5, 0xA5, 0x92, 0x92, 0x62, 0x62, 0x55,
+0x55, 0x4E, 0x4E, 0x4A, 0x4A, 0x49, 0x49, 0x4C, 0x4C, 0x52, 0x52, 0x5E, 0x5E, 0x88, 0x88, 0xA3,
+0xA3, 0xAF, 0xAF, 0xB6, 0xB6, 0xB9, 0xB9, 0xB8, 0xB8, 0xB4, 0xB4, 0xAB, 0xAB, 0x9D, 0x9D, 0x68,
+0x68, 0x56, 0x56, 0x4C, 0x4C, 0x47, 0x47, 0x46, 0x46, 0x48, 0x48, 0x4E, 0x4E, 0x59, 0x59, 0x6F,
+0x6F, 0xA2, 0xA2, 0xB0, 0xB0, 0xB8, 0xB8, 0xBC, 0xBC, 0xBB, 0xBB, 0xB7, 0xB7, 0xAF, 0xAF, 0x9F,
+0x9F, 0x67, 0x67, 0x54, 0x54, 0x49, 0x49, 0x44, 0x44, 0x43, 0x43, 0x45, 0x45, 0x4C, 0x4C, 0x57,
+0x57, 0x75, 0x75, 0xA6, 0xA6, 0xB5, 0xB5, 0xBC, 0xBC, 0xBF, 0xBF, 0xBE, 0xBE, 0xB8, 0xB8, 0xAE,
+0xAE, 0x9A, 0x9A, 0x5E, 0x5E, 0x4D, 0x4D, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x44, 0x44, 0x4D,
+0x4D, 0x5E, 0x5E, 0x9B, 0x9B, 0xB0, 0xB0, 0xBB, 0xBB, 0xC1, 0xC1, 0xC2, 0xC2, 0xBE, 0xBE, 0xB6,
+0xB6, 0xA6, 0xA6, 0x6A, 0x6A, 0x51, 0x51, 0x44, 0x44, 0x3E, 0x3E, 0x3C, 0x3C, 0x40, 0x40, 0x47,
+0x47, 0x56, 0x56, 0x90, 0x90, 0xAE, 0xAE, 0xBB, 0xBB, 0xC2, 0xC2, 0xC4, 0xC4, 0xC1, 0xC1, 0xBA,
+0xBA, 0xAB, 0xAB, 0x70, 0x70, 0x51, 0x51, 0x43, 0x43, 0x3C, 0x3C, 0x3B, 0x3B, 0x3D, 0x3D, 0x44,
+0x44, 0x54, 0x54, 0x90, 0x90, 0xAF, 0xAF, 0xBE, 0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA,
+0xBA, 0xA9, 0xA9, 0x68, 0x68, 0x4C, 0x4C, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x46,
+0x46, 0x59, 0x59, 0xA0, 0xA0, 0xB7, 0xB7, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xB7,
+0xB7, 0x9F, 0x9F, 0x57, 0x57, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x4D,
+0x4D, 0x73, 0x73, 0xB0, 0xB0, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0xAA,
+0xAA, 0x61, 0x61, 0x47, 0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x47, 0x47, 0x63,
+0x63, 0xAD, 0xAD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xAD, 0xAD, 0x63,
+0x63, 0x46, 0x46, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x68, 0x68, 0xB1,
+0xB1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0xA8, 0xA8, 0x59, 0x59, 0x40,
+0x40, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4E, 0x4E, 0x9A, 0x9A, 0xBB, 0xBB, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB8, 0xB8, 0x8F, 0x8F, 0x49, 0x49, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x64, 0x64, 0xB2, 0xB2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xA3, 0xA3, 0x50, 0x50, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3E, 0x3E, 0x5B, 0x5B, 0xAF, 0xAF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2,
+0xC2, 0xA5, 0xA5, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x5F,
+0x5F, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0x9B, 0x9B, 0x48,
+0x48, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x43, 0x43, 0x8B, 0x8B, 0xBD, 0xBD, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6, 0xB6, 0x5F, 0x5F, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x53, 0x53, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC1, 0xC1, 0x97, 0x97, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4A,
+0x4A, 0xA5, 0xA5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA2, 0xA2, 0x47,
+0x47, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0xA2, 0xA2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9D, 0x9D, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x4F, 0x4F, 0xAF, 0xAF, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBE,
+0xBE, 0x67, 0x67, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x65, 0x65, 0xBE,
+0xBE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAA, 0xAA, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4B, 0x4B, 0xAE, 0xAE, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB9, 0xB9, 0x58, 0x58, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x42, 0x42, 0x9F,
+0x9F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xBF, 0x63, 0x63, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x40, 0x40, 0xA0, 0xA0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xBE, 0xBE, 0x5E, 0x5E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x45, 0x45, 0xAC,
+0xAC, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB2, 0xB2, 0x4D, 0x4D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x57, 0x57, 0xBB, 0xBB, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0x91, 0x91, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x41, 0x41, 0xA3, 0xA3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB1, 0xB1, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x6C, 0x6C, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x55,
+0x55, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x5F, 0x5F, 0xBF, 0xBF, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBB, 0xBB, 0x56, 0x56, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x61,
+0x61, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6, 0xB6, 0x50, 0x50, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x94, 0x94, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA9,
+0xA9, 0x44, 0x44, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4A, 0x4A, 0xB0, 0xB0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xBE, 0xBE, 0x60, 0x60, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x6D,
+0x6D, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA2, 0xA2, 0x42, 0x42, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x58, 0x58, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAE, 0xAE, 0x4C,
+0x4C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x4F, 0x4F, 0xB0, 0xB0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xB0, 0xB0, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x50, 0x50, 0xB0, 0xB0, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x4E, 0x4E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x56,
+0x56, 0xB4, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA3, 0xA3, 0x4A, 0x4A, 0x3B, 0x3B, 0x3B,
+0x3B, 0x40, 0x40, 0x68, 0x68, 0xB9, 0xB9, 0xC4, 0xC4, 0xC4, 0xC4, 0xBA, 0xBA, 0x6E, 0x6E, 0x42,
+0x42, 0x3B, 0x3B, 0x3B, 0x3B, 0x4D, 0x4D, 0xA0, 0xA0, 0xBF, 0xBF, 0xC4, 0xC4, 0xC1, 0xC1, 0xA9,
+0xA9, 0x53, 0x53, 0x3D, 0x3D, 0x3B, 0x3B, 0x44, 0x44, 0x66, 0x66, 0xB5, 0xB5, 0xC4, 0xC4, 0xC3,
+0xC3, 0xB3, 0xB3, 0x66, 0x66, 0x45, 0x45, 0x3D, 0x3D, 0x42, 0x42, 0x57, 0x57, 0xA8, 0xA8, 0xBD,
+0xBD, 0xC1, 0xC1, 0xB6, 0xB6, 0x94, 0x94, 0x4E, 0x4E, 0x41, 0x41, 0x43, 0x43, 0x54, 0x54, 0x9F,
+0x9F, 0xB8, 0xB8, 0xBD, 0xBD, 0xB6, 0xB6, 0x9B, 0x9B, 0x55, 0x55, 0x47, 0x47, 0x47, 0x47, 0x55,
+0x55, 0x99, 0x99, 0xB2, 0xB2, 0xB8, 0xB8, 0xB1, 0xB1, 0x99, 0x99, 0x58, 0x58, 0x4B, 0x4B, 0x4C,
+0x4C, 0x5A, 0x5A, 0x99, 0x99, 0xAF, 0xAF, 0xB1, 0xB1, 0xAA, 0xAA, 0x92, 0x92, 0x5B, 0x5B, 0x52,
+0x52, 0x54, 0x54, 0x62, 0x62, 0x9A, 0x9A, 0xA9, 0xA9, 0xAB, 0xAB, 0xA2, 0xA2, 0x74, 0x74, 0x5C,
+0x5C, 0x59, 0x59, 0x5D, 0x5D, 0x6E, 0x6E, 0x99, 0x99, 0xA0, 0xA0, 0x9F, 0x9F, 0x94, 0x94, 0x6E,
+0x6E, 0x63, 0x63, 0x67, 0x67, 0x6D, 0x6D, 0x87, 0x87, 0x94, 0x94, 0x96, 0x96, 0x8F, 0x8F, 0x84,
+0x84, 0x76, 0x76, 0x73, 0x73, 0x76, 0x76, 0x89, 0x89, 0x71, 0x71, 0x6A, 0x6A, 0x6E, 0x6E, 0x70,
+0x70, 0x8F, 0x8F, 0x99, 0x99, 0x9A, 0x9A, 0x93, 0x93, 0x70, 0x70, 0x63, 0x63, 0x60, 0x60, 0x65,
+0x65, 0x8C, 0x8C, 0xA1, 0xA1, 0xA6, 0xA6, 0xA3, 0xA3, 0x7A, 0x7A, 0x5C, 0x5C, 0x54, 0x54, 0x59,
+0x59, 0x73, 0x73, 0xA5, 0xA5, 0xAE, 0xAE, 0xAA, 0xAA, 0x92, 0x92, 0x59, 0x59, 0x50, 0x50, 0x54,
+0x54, 0x6B, 0x6B, 0xA8, 0xA8, 0xB2, 0xB2, 0xB0, 0xB0, 0x98, 0x98, 0x55, 0x55, 0x48, 0x48, 0x4C,
+0x4C, 0x66, 0x66, 0xAE, 0xAE, 0xBA, 0xBA, 0xB6, 0xB6, 0x98, 0x98, 0x50, 0x50, 0x42, 0x42, 0x48,
+0x48, 0x6B, 0x6B, 0xB3, 0xB3, 0xBE, 0xBE, 0xB9, 0xB9, 0x90, 0x90, 0x48, 0x48, 0x3E, 0x3E, 0x48,
+0x48, 0x93, 0x93, 0xBC, 0xBC, 0xC4, 0xC4, 0xB5, 0xB5, 0x61, 0x61, 0x3F, 0x3F, 0x3B, 0x3B, 0x4C,
+0x4C, 0xA8, 0xA8, 0xC3, 0xC3, 0xC4, 0xC4, 0xB0, 0xB0, 0x4F, 0x4F, 0x3B, 0x3B, 0x3B, 0x3B, 0x59,
+0x59, 0xBA, 0xBA, 0xC4, 0xC4, 0xC2, 0xC2, 0x90, 0x90, 0x3E, 0x3E, 0x3B, 0x3B, 0x41, 0x41, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xAD, 0xAD, 0x64, 0x64, 0x68, 0x68, 0xB5, 0xB5, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xA6, 0xA6, 0x87, 0x87, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBC,
+0xBC, 0xB7, 0xB7, 0xB1, 0xB1, 0xAA, 0xAA, 0xA1, 0xA1, 0x93, 0x93, 0x69, 0x69, 0x5D, 0x5D, 0x54,
+0x54, 0x4D, 0x4D, 0x48, 0x48, 0x43, 0x43, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3F, 0x43, 0x43, 0x48, 0x48, 0x4D, 0x4D, 0x54, 0x54, 0x5D,
+0x5D, 0x6A, 0x6A, 0x94, 0x94, 0xA1, 0xA1, 0xAA, 0xAA, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xC1,
+0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBC,
+0xBC, 0xB7, 0xB7, 0xB1, 0xB1, 0xA9, 0xA9, 0xA0, 0xA0, 0x90, 0x90, 0x68, 0x68, 0x5B, 0x5B, 0x53,
+0x53, 0x4C, 0x4C, 0x47, 0x47, 0x42, 0x42, 0x3E, 0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x46, 0x46, 0x4B, 0x4B, 0x52, 0x52, 0x5A, 0x5A, 0x66, 0x66, 0x8E,
+0x8E, 0x9F, 0x9F, 0xA9, 0xA9, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xBF, 0xBF, 0xBA, 0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA6,
+0xA6, 0x9B, 0x9B, 0x78, 0x78, 0x62, 0x62, 0x58, 0x58, 0x50, 0x50, 0x4A, 0x4A, 0x44, 0x44, 0x40,
+0x40, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x41, 0x41, 0x46, 0x46, 0x4B, 0x4B, 0x52,
+0x52, 0x5A, 0x5A, 0x66, 0x66, 0x8E, 0x8E, 0x9F, 0x9F, 0xA9, 0xA9, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC,
+0xBC, 0xC0, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC0, 0xC0, 0xBC, 0xBC, 0xB7, 0xB7, 0xB1,
+0xB1, 0xA9, 0xA9, 0xA0, 0xA0, 0x8F, 0x8F, 0x66, 0x66, 0x5A, 0x5A, 0x52, 0x52, 0x4B, 0x4B, 0x46,
+0x46, 0x41, 0x41, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x3E, 0x42, 0x42, 0x47, 0x47, 0x4C, 0x4C, 0x53,
+0x53, 0x5C, 0x5C, 0x69, 0x69, 0x93, 0x93, 0xA2, 0xA2, 0xAB, 0xAB, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD,
+0xBD, 0xC1, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC1, 0xC1, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2, 0xB2, 0xAB, 0xAB, 0xA2,
+0xA2, 0x95, 0x95, 0x6B, 0x6B, 0x5D, 0x5D, 0x54, 0x54, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x3E,
+0x3E, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3F, 0x3F, 0x43, 0x43, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x5F, 0x5F, 0x6F, 0x6F, 0x99,
+0x99, 0xA4, 0xA4, 0xAD, 0xAD, 0xB4, 0xB4, 0xB9, 0xB9, 0xBE, 0xBE, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE, 0xBE, 0xBA,
+0xBA, 0xB4, 0xB4, 0xAD, 0xAD, 0xA5, 0xA5, 0x99, 0x99, 0x70, 0x70, 0x5F, 0x5F, 0x55, 0x55, 0x4E,
+0x4E, 0x48, 0x48, 0x43, 0x43, 0x3F, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x40, 0x40, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x57, 0x57, 0x61,
+0x61, 0x75, 0x75, 0x9B, 0x9B, 0xA6, 0xA6, 0xAE, 0xAE, 0xB5, 0xB5, 0xBA, 0xBA, 0xBF, 0xBF, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0, 0xC0, 0xBB,
+0xBB, 0xB6, 0xB6, 0xB0, 0xB0, 0xA8, 0xA8, 0x9E, 0x9E, 0x8B, 0x8B, 0x64, 0x64, 0x59, 0x59, 0x51,
+0x51, 0x4B, 0x4B, 0x45, 0x45, 0x41, 0x41, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3D, 0x3D, 0x40, 0x40, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x56, 0x56, 0x60, 0x60, 0x71,
+0x71, 0x99, 0x99, 0xA5, 0xA5, 0xAE, 0xAE, 0xB4, 0xB4, 0xBA, 0xBA, 0xBE, 0xBE, 0xC2, 0xC2, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE, 0xBE, 0xBA, 0xBA, 0xB4, 0xB4, 0xAE,
+0xAE, 0xA6, 0xA6, 0x9B, 0x9B, 0x76, 0x76, 0x61, 0x61, 0x57, 0x57, 0x50, 0x50, 0x4A, 0x4A, 0x45,
+0x45, 0x41, 0x41, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x43, 0x43, 0x47,
+0x47, 0x4C, 0x4C, 0x53, 0x53, 0x5B, 0x5B, 0x67, 0x67, 0x8F, 0x8F, 0xA0, 0xA0, 0xA9, 0xA9, 0xB0,
+0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xBF, 0xBF, 0xC2, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0xC2, 0xBE,
+0xBE, 0xBA, 0xBA, 0xB5, 0xB5, 0xB0, 0xB0, 0xA8, 0xA8, 0x9E, 0x9E, 0x8D, 0x8D, 0x66, 0x66, 0x5B,
+0x5B, 0x53, 0x53, 0x4C, 0x4C, 0x47, 0x47, 0x43, 0x43, 0x3F, 0x3F, 0x3D, 0x3D, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x3D, 0x40,
+0x40, 0x43, 0x43, 0x47, 0x47, 0x4C, 0x4C, 0x53, 0x53, 0x5A, 0x5A, 0x65, 0x65, 0x8B, 0x8B, 0x9E,
+0x9E, 0xA8, 0xA8, 0xAF, 0xAF, 0xB5, 0xB5, 0xBA, 0xBA, 0xBE, 0xBE, 0xC1, 0xC1, 0xC3, 0xC3, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC0,
+0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAE, 0xAE, 0xA7, 0xA7, 0x9D, 0x9D, 0x8B, 0x8B, 0x66,
+0x66, 0x5B, 0x5B, 0x53, 0x53, 0x4D, 0x4D, 0x48, 0x48, 0x44, 0x44, 0x41, 0x41, 0x3E, 0x3E, 0x3C,
+0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x3D, 0x3D, 0x40, 0x40, 0x42,
+0x42, 0x45, 0x45, 0x4A, 0x4A, 0x4E, 0x4E, 0x55, 0x55, 0x5C, 0x5C, 0x68, 0x68, 0x90, 0x90, 0x9F,
+0x9F, 0xA8, 0xA8, 0xAF, 0xAF, 0xB4, 0xB4, 0xB9, 0xB9, 0xBC, 0xBC, 0xC0, 0xC0, 0xC2, 0xC2, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC2, 0xC2, 0xC0, 0xC0, 0xBE, 0xBE, 0xBA,
+0xBA, 0xB7, 0xB7, 0xB2, 0xB2, 0xAC, 0xAC, 0xA4, 0xA4, 0x9A, 0x9A, 0x77, 0x77, 0x63, 0x63, 0x5A,
+0x5A, 0x53, 0x53, 0x4D, 0x4D, 0x49, 0x49, 0x45, 0x45, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3E,
+0x3E, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x48, 0x48, 0x4C,
+0x4C, 0x51, 0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6C, 0x6C, 0x93, 0x93, 0xA0, 0xA0, 0xA8, 0xA8, 0xAF,
+0xAF, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB, 0xBB, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9,
+0xA9, 0xA1, 0xA1, 0x97, 0x97, 0x71, 0x71, 0x62, 0x62, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x4A,
+0x4A, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x43,
+0x43, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x59, 0x59, 0x61, 0x61, 0x6E,
+0x6E, 0x94, 0x94, 0xA0, 0xA0, 0xA7, 0xA7, 0xAD, 0xAD, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB,
+0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5,
+0xB5, 0xB2, 0xB2, 0xAD, 0xAD, 0xA7, 0xA7, 0xA0, 0xA0, 0x95, 0x95, 0x72, 0x72, 0x63, 0x63, 0x5B,
+0x5B, 0x55, 0x55, 0x50, 0x50, 0x4C, 0x4C, 0x49, 0x49, 0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x45,
+0x45, 0x46, 0x46, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5B,
+0x5B, 0x62, 0x62, 0x6E, 0x6E, 0x92, 0x92, 0x9D, 0x9D, 0xA5, 0xA5, 0xAA, 0xAA, 0xAF, 0xAF, 0xB3,
+0xB3, 0xB6, 0xB6, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6,
+0xB6, 0xB3, 0xB3, 0xB0, 0xB0, 0xAC, 0xAC, 0xA7, 0xA7, 0xA0, 0xA0, 0x97, 0x97, 0x7B, 0x7B, 0x67,
+0x67, 0x5F, 0x5F, 0x59, 0x59, 0x54, 0x54, 0x50, 0x50, 0x4D, 0x4D, 0x4C, 0x4C, 0x4A, 0x4A, 0x49,
+0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5A,
+0x5A, 0x60, 0x60, 0x69, 0x69, 0x86, 0x86, 0x97, 0x97, 0xA0, 0xA0, 0xA6, 0xA6, 0xAA, 0xAA, 0xAE,
+0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB1,
+0xB1, 0xAF, 0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9B, 0x9B, 0x91, 0x91, 0x71, 0x71, 0x66,
+0x66, 0x5F, 0x5F, 0x5A, 0x5A, 0x56, 0x56, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x59, 0x59, 0x5E, 0x5E, 0x63,
+0x63, 0x6B, 0x6B, 0x88, 0x88, 0x96, 0x96, 0x9D, 0x9D, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAD,
+0xAD, 0xAE, 0xAE, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAD, 0xAD, 0xAB, 0xAB, 0xA8,
+0xA8, 0xA5, 0xA5, 0xA0, 0xA0, 0x9A, 0x9A, 0x92, 0x92, 0x77, 0x77, 0x6A, 0x6A, 0x63, 0x63, 0x5F,
+0x5F, 0x5B, 0x5B, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x55, 0x55, 0x55,
+0x55, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5F, 0x5F, 0x63, 0x63, 0x69, 0x69, 0x72, 0x72, 0x8E,
+0x8E, 0x97, 0x97, 0x9C, 0x9C, 0xA1, 0xA1, 0xA4, 0xA4, 0xA7, 0xA7, 0xA8, 0xA8, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA6, 0xA6, 0xA3, 0xA3, 0xA0, 0xA0, 0x9C, 0x9C, 0x97,
+0x97, 0x8F, 0x8F, 0x76, 0x76, 0x6C, 0x6C, 0x67, 0x67, 0x63, 0x63, 0x60, 0x60, 0x5E, 0x5E, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x63,
+0x63, 0x67, 0x67, 0x6B, 0x6B, 0x72, 0x72, 0x88, 0x88, 0x92, 0x92, 0x97, 0x97, 0x9B, 0x9B, 0x9D,
+0x9D, 0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E,
+0x9E, 0x9C, 0x9C, 0x99, 0x99, 0x95, 0x95, 0x90, 0x90, 0x89, 0x89, 0x74, 0x74, 0x6E, 0x6E, 0x6B,
+0x6B, 0x68, 0x68, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66,
+0x66, 0x68, 0x68, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x75, 0x75, 0x85, 0x85, 0x8C,
+0x8C, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x7C,
+0x7C, 0x76, 0x76, 0x74, 0x74, 0x72, 0x72, 0x75, 0x75, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x7D,
+0x7D, 0x7A, 0x7A, 0x7D, 0x7D, 0x7A, 0x7A, 0x7E, 0x7E, 0x7B, 0x7B, 0x80, 0x80, 0x7C, 0x7C, 0x7D,
+0x7D, 0x81, 0x81, 0x83, 0x83, 0x84, 0x84, 0x7A, 0x7A, 0x7A, 0x7A, 0x78, 0x78, 0x79, 0x79, 0x78,
+0x78, 0x79, 0x79, 0x76, 0x76, 0x75, 0x75, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73, 0x75, 0x75, 0x76,
+0x76, 0x7A, 0x7A, 0x87, 0x87, 0x8B, 0x8B, 0x8F, 0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97,
+0x97, 0x98, 0x98, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F,
+0x8F, 0x8A, 0x8A, 0x79, 0x79, 0x72, 0x72, 0x6E, 0x6E, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x66,
+0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x6A, 0x6A, 0x6D,
+0x6D, 0x72, 0x72, 0x85, 0x85, 0x8F, 0x8F, 0x94, 0x94, 0x99, 0x99, 0x9B, 0x9B, 0x9E, 0x9E, 0xA0,
+0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x99, 0x99, 0x95,
+0x95, 0x8E, 0x8E, 0x78, 0x78, 0x6E, 0x6E, 0x68, 0x68, 0x64, 0x64, 0x61, 0x61, 0x5E, 0x5E, 0x5D,
+0x5D, 0x5C, 0x5C, 0x5D, 0x5D, 0x5C, 0x5C, 0x5D, 0x5D, 0x5F, 0x5F, 0x62, 0x62, 0x65, 0x65, 0x6A,
+0x6A, 0x72, 0x72, 0x8D, 0x8D, 0x96, 0x96, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3, 0xA3, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA6, 0xA6, 0xA3, 0xA3, 0x9F, 0x9F, 0x9A, 0x9A, 0x94,
+0x94, 0x81, 0x81, 0x6C, 0x6C, 0x64, 0x64, 0x5F, 0x5F, 0x5B, 0x5B, 0x59, 0x59, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x58, 0x58, 0x5A, 0x5A, 0x5D, 0x5D, 0x62, 0x62, 0x68, 0x68, 0x73,
+0x73, 0x92, 0x92, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xA9, 0xA9, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xA9, 0xA9, 0xA6, 0xA6, 0xA1, 0xA1, 0x9A, 0x9A, 0x8F, 0x8F, 0x6E,
+0x6E, 0x64, 0x64, 0x5D, 0x5D, 0x58, 0x58, 0x55, 0x55, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x53, 0x53, 0x55, 0x55, 0x58, 0x58, 0x5E, 0x5E, 0x65, 0x65, 0x71, 0x71, 0x93, 0x93, 0x9D,
+0x9D, 0xA4, 0xA4, 0xAA, 0xAA, 0xAD, 0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0,
+0xB0, 0xAC, 0xAC, 0xA8, 0xA8, 0xA2, 0xA2, 0x9A, 0x9A, 0x89, 0x89, 0x68, 0x68, 0x5E, 0x5E, 0x58,
+0x58, 0x53, 0x53, 0x50, 0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x53,
+0x53, 0x58, 0x58, 0x5F, 0x5F, 0x6A, 0x6A, 0x8F, 0x8F, 0x9D, 0x9D, 0xA5, 0xA5, 0xAB, 0xAB, 0xB0,
+0xB0, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5,
+0xA5, 0x9C, 0x9C, 0x8B, 0x8B, 0x67, 0x67, 0x5C, 0x5C, 0x55, 0x55, 0x50, 0x50, 0x4D, 0x4D, 0x4A,
+0x4A, 0x4A, 0x4A, 0x49, 0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x51, 0x51, 0x57, 0x57, 0x5F, 0x5F, 0x6C,
+0x6C, 0x95, 0x95, 0xA2, 0xA2, 0xAA, 0xAA, 0xB0, 0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8,
+0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB1, 0xB1, 0xAB, 0xAB, 0xA3, 0xA3, 0x96, 0x96, 0x6C, 0x6C, 0x5E,
+0x5E, 0x55, 0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x4A,
+0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x5B, 0x5B, 0x68, 0x68, 0x94, 0x94, 0xA2, 0xA2, 0xAB, 0xAB, 0xB2,
+0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB2, 0xB2, 0xAC,
+0xAC, 0xA3, 0xA3, 0x95, 0x95, 0x69, 0x69, 0x5B, 0x5B, 0x52, 0x52, 0x4C, 0x4C, 0x48, 0x48, 0x45,
+0x45, 0x43, 0x43, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4D, 0x4D, 0x54, 0x54, 0x5F, 0x5F, 0x72,
+0x72, 0x9C, 0x9C, 0xA8, 0xA8, 0xB1, 0xB1, 0xB6, 0xB6, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC,
+0xBC, 0xBA, 0xBA, 0xB6, 0xB6, 0xB1, 0xB1, 0xA9, 0xA9, 0x9C, 0x9C, 0x70, 0x70, 0x5D, 0x5D, 0x53,
+0x53, 0x4C, 0x4C, 0x46, 0x46, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4A,
+0x4A, 0x51, 0x51, 0x5B, 0x5B, 0x6D, 0x6D, 0x9B, 0x9B, 0xA9, 0xA9, 0xB2, 0xB2, 0xB8, 0xB8, 0xBC,
+0xBC, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBC, 0xBC, 0xB8, 0xB8, 0xB2, 0xB2, 0xA9, 0xA9, 0x9C,
+0x9C, 0x6B, 0x6B, 0x5A, 0x5A, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x41, 0x41, 0x40, 0x40, 0x41,
+0x41, 0x42, 0x42, 0x45, 0x45, 0x4B, 0x4B, 0x53, 0x53, 0x5F, 0x5F, 0x89, 0x89, 0xA2, 0xA2, 0xAE,
+0xAE, 0xB6, 0xB6, 0xBB, 0xBB, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBC, 0xBC, 0xB6,
+0xB6, 0xAF, 0xAF, 0xA4, 0xA4, 0x8C, 0x8C, 0x5F, 0x5F, 0x52, 0x52, 0x4A, 0x4A, 0x44, 0x44, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x50, 0x50, 0x5B, 0x5B, 0x72,
+0x72, 0xA0, 0xA0, 0xAD, 0xAD, 0xB6, 0xB6, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBD, 0xBD, 0xB8, 0xB8, 0xB0, 0xB0, 0xA5, 0xA5, 0x8E, 0x8E, 0x5E, 0x5E, 0x51, 0x51, 0x49,
+0x49, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x47, 0x47, 0x4F,
+0x4F, 0x5C, 0x5C, 0x84, 0x84, 0xA3, 0xA3, 0xB0, 0xB0, 0xB8, 0xB8, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xB7, 0xB7, 0xAE, 0xAE, 0xA1, 0xA1, 0x6F, 0x6F, 0x59,
+0x59, 0x4D, 0x4D, 0x45, 0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43,
+0x43, 0x4A, 0x4A, 0x54, 0x54, 0x64, 0x64, 0x9A, 0x9A, 0xAB, 0xAB, 0xB6, 0xB6, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBB, 0xBB, 0xB2, 0xB2, 0xA6, 0xA6, 0x8D,
+0x8D, 0x5D, 0x5D, 0x4F, 0x4F, 0x46, 0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+0x42, 0x42, 0x42, 0x48, 0x48, 0x52, 0x52, 0x61, 0x61, 0x97, 0x97, 0xAA, 0xAA, 0xB6, 0xB6, 0xBD,
+0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB3, 0xB3, 0xA7,
+0xA7, 0x8E, 0x8E, 0x5C, 0x5C, 0x4E, 0x4E, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x52, 0x52, 0x64, 0x64, 0x9C, 0x9C, 0xAD, 0xAD, 0xB8,
+0xB8, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBA, 0xBA, 0xB1,
+0xB1, 0xA3, 0xA3, 0x6F, 0x6F, 0x57, 0x57, 0x4B, 0x4B, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4B, 0x4B, 0x58, 0x58, 0x74, 0x74, 0xA4, 0xA4, 0xB2,
+0xB2, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB7,
+0xB7, 0xAB, 0xAB, 0x96, 0x96, 0x5F, 0x5F, 0x4F, 0x4F, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x52, 0x52, 0x64, 0x64, 0x9D, 0x9D, 0xAF,
+0xAF, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA,
+0xBA, 0xAF, 0xAF, 0x9E, 0x9E, 0x65, 0x65, 0x52, 0x52, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x50, 0x50, 0x61, 0x61, 0x9A, 0x9A, 0xAD,
+0xAD, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA,
+0xBA, 0xB0, 0xB0, 0x9F, 0x9F, 0x65, 0x65, 0x52, 0x52, 0x46, 0x46, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x50, 0x50, 0x62, 0x62, 0x9B, 0x9B, 0xAE,
+0xAE, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9,
+0xB9, 0xAE, 0xAE, 0x9C, 0x9C, 0x62, 0x62, 0x50, 0x50, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x53, 0x53, 0x69, 0x69, 0xA2, 0xA2, 0xB1,
+0xB1, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB6,
+0xB6, 0xA9, 0xA9, 0x8F, 0x8F, 0x5A, 0x5A, 0x4B, 0x4B, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4B, 0x4B, 0x59, 0x59, 0x8D, 0x8D, 0xA9, 0xA9, 0xB7,
+0xB7, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB1,
+0xB1, 0xA0, 0xA0, 0x66, 0x66, 0x52, 0x52, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x53, 0x53, 0x68, 0x68, 0xA2, 0xA2, 0xB2, 0xB2, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB5, 0xB5, 0xA7,
+0xA7, 0x78, 0x78, 0x57, 0x57, 0x49, 0x49, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x4E, 0x4E, 0x5F, 0x5F, 0x9A, 0x9A, 0xAE, 0xAE, 0xB9, 0xB9, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xAC, 0xAC, 0x94,
+0x94, 0x5C, 0x5C, 0x4C, 0x4C, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+0x47, 0x47, 0x47, 0x4C, 0x4C, 0x5C, 0x5C, 0x94, 0x94, 0xAB, 0xAB, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xAD, 0xAD, 0x99, 0x99, 0x5F,
+0x5F, 0x4E, 0x4E, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+0x47, 0x4B, 0x4B, 0x59, 0x59, 0x8D, 0x8D, 0xA9, 0xA9, 0xB6, 0xB6, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xAE, 0xAE, 0x9B, 0x9B, 0x61, 0x61, 0x4F,
+0x4F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4B,
+0x4B, 0x59, 0x59, 0x8D, 0x8D, 0xA9, 0xA9, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xAE, 0xAE, 0x9A, 0x9A, 0x5F, 0x5F, 0x4E, 0x4E, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4B, 0x4B, 0x5A,
+0x5A, 0x8F, 0x8F, 0xAA, 0xAA, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xAC, 0xAC, 0x97, 0x97, 0x5D, 0x5D, 0x4E, 0x4E, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4D, 0x4D, 0x5C, 0x5C, 0x95,
+0x95, 0xAB, 0xAB, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xAA, 0xAA, 0x92, 0x92, 0x5B, 0x5B, 0x4C, 0x4C, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4F, 0x4F, 0x60, 0x60, 0x9A, 0x9A, 0xAE,
+0xAE, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB4,
+0xB4, 0xA7, 0xA7, 0x77, 0x77, 0x57, 0x57, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x52, 0x52, 0x67, 0x67, 0xA0, 0xA0, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB2, 0xB2, 0xA2,
+0xA2, 0x69, 0x69, 0x54, 0x54, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x57, 0x57, 0x74, 0x74, 0xA6, 0xA6, 0xB3, 0xB3, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xAD, 0xAD, 0x9A, 0x9A, 0x61,
+0x61, 0x50, 0x50, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+0x4A, 0x4D, 0x4D, 0x5C, 0x5C, 0x93, 0x93, 0xAA, 0xAA, 0xB5, 0xB5, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xA9, 0xA9, 0x8F, 0x8F, 0x5B, 0x5B, 0x4C,
+0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x52,
+0x52, 0x65, 0x65, 0x9E, 0x9E, 0xAF, 0xAF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB1, 0xB1, 0xA2, 0xA2, 0x6C, 0x6C, 0x55, 0x55, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x57, 0x57, 0x72,
+0x72, 0xA5, 0xA5, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB3, 0xB3, 0xAC, 0xAC, 0x99, 0x99, 0x61, 0x61, 0x51, 0x51, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4F, 0x4F, 0x5F, 0x5F, 0x96, 0x96, 0xAB,
+0xAB, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+0xB3, 0xA6, 0xA6, 0x80, 0x80, 0x59, 0x59, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x55, 0x55, 0x69, 0x69, 0xA0, 0xA0, 0xAF, 0xAF, 0xB3,
+0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xAE, 0xAE, 0x9E,
+0x9E, 0x66, 0x66, 0x54, 0x54, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x5B, 0x5B, 0x8C, 0x8C, 0xA7, 0xA7, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA9, 0xA9, 0x92, 0x92, 0x5E,
+0x5E, 0x4F, 0x4F, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x53, 0x53, 0x64, 0x64, 0x9B, 0x9B, 0xAC, 0xAC, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xA2, 0xA2, 0x6E, 0x6E, 0x57, 0x57, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x58,
+0x58, 0x71, 0x71, 0xA3, 0xA3, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xAA, 0xAA, 0x99, 0x99, 0x63, 0x63, 0x53, 0x53, 0x4E, 0x4E, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x51, 0x51, 0x60, 0x60, 0x94,
+0x94, 0xA9, 0xA9, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB0, 0xB0, 0xA5, 0xA5, 0x87, 0x87, 0x5B, 0x5B, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x56, 0x56, 0x69, 0x69, 0x9E, 0x9E, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAC,
+0xAC, 0x9D, 0x9D, 0x68, 0x68, 0x56, 0x56, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x5C, 0x5C, 0x8A, 0x8A, 0xA5, 0xA5, 0xB0, 0xB0, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xA7, 0xA7, 0x93,
+0x93, 0x60, 0x60, 0x52, 0x52, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x54, 0x54, 0x64, 0x64, 0x98, 0x98, 0xA9, 0xA9, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xA0, 0xA0, 0x6F, 0x6F, 0x59,
+0x59, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+0x50, 0x5A, 0x5A, 0x72, 0x72, 0xA1, 0xA1, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xA9, 0xA9, 0x97, 0x97, 0x64, 0x64, 0x54, 0x54, 0x51,
+0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x54, 0x62,
+0x62, 0x95, 0x95, 0xA7, 0xA7, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xA1, 0xA1, 0x76, 0x76, 0x5C, 0x5C, 0x51, 0x51, 0x51, 0x51, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5A, 0x5A, 0x6E, 0x6E, 0x9F,
+0x9F, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xA8, 0xA8, 0x98, 0x98, 0x66, 0x66, 0x56, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x61, 0x61, 0x92, 0x92, 0xA5, 0xA5, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA2,
+0xA2, 0x87, 0x87, 0x5E, 0x5E, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x59, 0x59, 0x6B, 0x6B, 0x9C, 0x9C, 0xAA, 0xAA, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xA8, 0xA8, 0x99, 0x99, 0x68,
+0x68, 0x58, 0x58, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+0x53, 0x54, 0x54, 0x61, 0x61, 0x8F, 0x8F, 0xA4, 0xA4, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xA2, 0xA2, 0x89, 0x89, 0x5F, 0x5F, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5B,
+0x5B, 0x6D, 0x6D, 0x9B, 0x9B, 0xA9, 0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xA7, 0xA7, 0x98, 0x98, 0x68, 0x68, 0x59, 0x59, 0x54, 0x54, 0x54,
+0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x56, 0x63, 0x63, 0x91,
+0x91, 0xA4, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA0, 0xA0, 0x7B, 0x7B, 0x5F, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5D, 0x5D, 0x72, 0x72, 0x9D, 0x9D, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4,
+0xA4, 0x94, 0x94, 0x65, 0x65, 0x58, 0x58, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x56, 0x56, 0x59, 0x59, 0x67, 0x67, 0x95, 0x95, 0xA5, 0xA5, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0x9B, 0x9B, 0x6E,
+0x6E, 0x5C, 0x5C, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+0x56, 0x56, 0x56, 0x62, 0x62, 0x8C, 0x8C, 0xA1, 0xA1, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x9F, 0x9F, 0x87, 0x87, 0x61, 0x61, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x5E,
+0x5E, 0x71, 0x71, 0x9C, 0x9C, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA2, 0xA2, 0x91, 0x91, 0x65, 0x65, 0x59, 0x59, 0x57, 0x57, 0x57,
+0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5C, 0x5C, 0x6A, 0x6A, 0x97,
+0x97, 0xA5, 0xA5, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA4, 0xA4, 0x97, 0x97, 0x6A, 0x6A, 0x5C, 0x5C, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5A, 0x5A, 0x67, 0x67, 0x93, 0x93, 0xA2, 0xA2, 0xA7,
+0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0x99,
+0x99, 0x6E, 0x6E, 0x5E, 0x5E, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+0x59, 0x59, 0x59, 0x5A, 0x5A, 0x66, 0x66, 0x8F, 0x8F, 0xA0, 0xA0, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0x9A, 0x9A, 0x70, 0x70, 0x5F,
+0x5F, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x66, 0x66, 0x8F, 0x8F, 0xA0, 0xA0, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0x99, 0x99, 0x70, 0x70, 0x60, 0x60, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5C, 0x5C, 0x67, 0x67, 0x90,
+0x90, 0x9F, 0x9F, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA3, 0xA3, 0x97, 0x97, 0x6E, 0x6E, 0x5F, 0x5F, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D, 0x5D, 0x6A, 0x6A, 0x93, 0x93, 0xA0, 0xA0, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA0, 0xA0, 0x94,
+0x94, 0x6B, 0x6B, 0x5E, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x60, 0x60, 0x6F, 0x6F, 0x97, 0x97, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x9D, 0x9D, 0x8C, 0x8C, 0x67, 0x67, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x65,
+0x65, 0x81, 0x81, 0x9A, 0x9A, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x97, 0x97, 0x72, 0x72, 0x62, 0x62, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x60, 0x60, 0x6C, 0x6C, 0x92, 0x92, 0x9F,
+0x9F, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x9D,
+0x9D, 0x8E, 0x8E, 0x69, 0x69, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x66, 0x66, 0x87, 0x87, 0x9A, 0x9A, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x9F, 0x9F, 0x94, 0x94, 0x6F, 0x6F, 0x62,
+0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x63,
+0x63, 0x71, 0x71, 0x96, 0x96, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x97, 0x97, 0x75, 0x75, 0x65, 0x65, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x63, 0x63, 0x6F, 0x6F, 0x92, 0x92, 0x9D,
+0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x97,
+0x97, 0x7B, 0x7B, 0x67, 0x67, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x63, 0x63, 0x6F, 0x6F, 0x92, 0x92, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x96, 0x96, 0x79, 0x79, 0x67, 0x67, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x71,
+0x71, 0x92, 0x92, 0x9C, 0x9C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+0x9D, 0x9D, 0x9D, 0x94, 0x94, 0x74, 0x74, 0x67, 0x67, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x68, 0x76, 0x76, 0x94, 0x94, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x90, 0x90, 0x70,
+0x70, 0x66, 0x66, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64,
+0x64, 0x6C, 0x6C, 0x8B, 0x8B, 0x97, 0x97, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x95, 0x95, 0x86, 0x86, 0x6B, 0x6B, 0x64, 0x64, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x74, 0x74, 0x91, 0x91, 0x9A,
+0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x97, 0x97, 0x8E,
+0x8E, 0x70, 0x70, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x67, 0x67, 0x70, 0x70, 0x8D, 0x8D, 0x97, 0x97, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x98, 0x90, 0x90, 0x74, 0x74, 0x6A, 0x6A, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x6F, 0x6F, 0x8A, 0x8A, 0x94,
+0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x90,
+0x90, 0x76, 0x76, 0x6B, 0x6B, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x69, 0x69, 0x70, 0x70, 0x89, 0x89, 0x93, 0x93, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x8F, 0x8F, 0x75, 0x75, 0x6C, 0x6C, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6B, 0x6B, 0x72, 0x72, 0x8B, 0x8B, 0x93,
+0x93, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x93, 0x93, 0x8B,
+0x8B, 0x73, 0x73, 0x6C, 0x6C, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+0x69, 0x6E, 0x6E, 0x78, 0x78, 0x8E, 0x8E, 0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95,
+0x95, 0x95, 0x95, 0x94, 0x94, 0x8F, 0x8F, 0x7D, 0x7D, 0x70, 0x70, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A,
+0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6D, 0x6D, 0x73, 0x73, 0x89, 0x89, 0x90, 0x90, 0x94,
+0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x88, 0x88, 0x74,
+0x74, 0x6E, 0x6E, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6D, 0x6D, 0x72,
+0x72, 0x84, 0x84, 0x8E, 0x8E, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+0x93, 0x8F, 0x8F, 0x89, 0x89, 0x76, 0x76, 0x70, 0x70, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6F, 0x6F, 0x73, 0x73, 0x81, 0x81, 0x8C, 0x8C, 0x90, 0x90, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x8E, 0x8E, 0x88, 0x88, 0x77, 0x77, 0x71, 0x71, 0x6E,
+0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x70, 0x70, 0x75, 0x75, 0x83, 0x83, 0x8B,
+0x8B, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8C, 0x8C, 0x86,
+0x86, 0x76, 0x76, 0x72, 0x72, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x73,
+0x73, 0x78, 0x78, 0x86, 0x86, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8C, 0x8C, 0x88, 0x88, 0x7C, 0x7C, 0x76, 0x76, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x71,
+0x71, 0x72, 0x72, 0x74, 0x74, 0x77, 0x77, 0x7C, 0x7C, 0x87, 0x87, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x88, 0x88, 0x84, 0x84, 0x79, 0x79, 0x76, 0x76, 0x75,
+0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x77, 0x77, 0x7B, 0x7B, 0x85, 0x85, 0x88,
+0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x87, 0x87, 0x84, 0x84, 0x7B,
+0x7B, 0x79, 0x79, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7C,
+0x7C, 0x83, 0x83, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x84,
+0x84, 0x82, 0x82, 0x7D, 0x7D, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C,
+0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x00, 0x00, 0x00,
+0x80, 0xA7, 0xA7, 0xB7, 0xB7, 0xBE, 0xBE, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC4, 0xC4, 0xC3,
+0xC3, 0xC1, 0xC1, 0xBD, 0xBD, 0xB7, 0xB7, 0xAE, 0xAE, 0xA2, 0xA2, 0x80, 0x80, 0x5D, 0x5D, 0x51,
+0x51, 0x48, 0x48, 0x42, 0x42, 0x3E, 0x3E, 0x3C, 0x3C, 0x3B, 0x3B, 0x3C, 0x3C, 0x3F, 0x3F, 0x43,
+0x43, 0x4A, 0x4A, 0x53, 0x53, 0x61, 0x61, 0x91, 0x91, 0xA5, 0xA5, 0xB0, 0xB0, 0xB8, 0xB8, 0xBE,
+0xBE, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xBF, 0xBF, 0xBA, 0xBA, 0xB3, 0xB3, 0xAA,
+0xAA, 0x9A, 0x9A, 0x68, 0x68, 0x57, 0x57, 0x4D, 0x4D, 0x46, 0x46, 0x41, 0x41, 0x3D, 0x3D, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3E, 0x3E, 0x41, 0x41, 0x46, 0x46, 0x4E, 0x4E, 0x58, 0x58, 0x6A, 0x6A, 0x9C,
+0x9C, 0xAA, 0xAA, 0xB4, 0xB4, 0xBB, 0xBB, 0xBF, 0xBF, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC1,
+0xC1, 0xBD, 0xBD, 0xB7, 0xB7, 0xAF, 0xAF, 0xA4, 0xA4, 0x8D, 0x8D, 0x5F, 0x5F, 0x52, 0x52, 0x4A,
+0x4A, 0x43, 0x43, 0x3F, 0x3F, 0x3D, 0x3D, 0x3C, 0x3C, 0x3D, 0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x49,
+0x49, 0x52, 0x52, 0x5F, 0x5F, 0x8B, 0x8B, 0xA3, 0xA3, 0xAF, 0xAF, 0xB7, 0xB7, 0xBD, 0xBD, 0xC0,
+0xC0, 0xC2, 0xC2, 0xC3, 0xC3, 0xC2, 0xC2, 0xBF, 0xBF, 0xBB, 0xBB, 0xB4, 0xB4, 0xAB, 0xAB, 0x9C,
+0x9C, 0x6B, 0x6B, 0x59, 0x59, 0x4E, 0x4E, 0x47, 0x47, 0x42, 0x42, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C,
+0x3C, 0x3E, 0x3E, 0x41, 0x41, 0x46, 0x46, 0x4D, 0x4D, 0x57, 0x57, 0x67, 0x67, 0x99, 0x99, 0xA9,
+0xA9, 0xB3, 0xB3, 0xB9, 0xB9, 0xBE, 0xBE, 0xC1, 0xC1, 0xC3, 0xC3, 0xC2, 0xC2, 0xC1, 0xC1, 0xBD,
+0xBD, 0xB8, 0xB8, 0xB0, 0xB0, 0xA5, 0xA5, 0x92, 0x92, 0x62, 0x62, 0x54, 0x54, 0x4B, 0x4B, 0x44,
+0x44, 0x40, 0x40, 0x3D, 0x3D, 0x3C, 0x3C, 0x3D, 0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x49, 0x49, 0x51,
+0x51, 0x5D, 0x5D, 0x78, 0x78, 0xA1, 0xA1, 0xAD, 0xAD, 0xB6, 0xB6, 0xBC, 0xBC, 0xC0, 0xC0, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xBB, 0xBB, 0xB5, 0xB5, 0xAC, 0xAC, 0x9E, 0x9E, 0x70,
+0x70, 0x5B, 0x5B, 0x50, 0x50, 0x48, 0x48, 0x42, 0x42, 0x3F, 0x3F, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E,
+0x3E, 0x41, 0x41, 0x46, 0x46, 0x4C, 0x4C, 0x56, 0x56, 0x65, 0x65, 0x96, 0x96, 0xA7, 0xA7, 0xB1,
+0xB1, 0xB8, 0xB8, 0xBD, 0xBD, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xBD, 0xBD, 0xB8,
+0xB8, 0xB1, 0xB1, 0xA7, 0xA7, 0x95, 0x95, 0x64, 0x64, 0x56, 0x56, 0x4C, 0x4C, 0x45, 0x45, 0x41,
+0x41, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0x3F, 0x43, 0x43, 0x48, 0x48, 0x50, 0x50, 0x5B,
+0x5B, 0x71, 0x71, 0x9F, 0x9F, 0xAC, 0xAC, 0xB4, 0xB4, 0xBB, 0xBB, 0xBF, 0xBF, 0xC1, 0xC1, 0xC2,
+0xC2, 0xC1, 0xC1, 0xBF, 0xBF, 0xBB, 0xBB, 0xB5, 0xB5, 0xAD, 0xAD, 0xA0, 0xA0, 0x76, 0x76, 0x5D,
+0x5D, 0x51, 0x51, 0x49, 0x49, 0x43, 0x43, 0x40, 0x40, 0x3E, 0x3E, 0x3D, 0x3D, 0x3E, 0x3E, 0x41,
+0x41, 0x45, 0x45, 0x4C, 0x4C, 0x55, 0x55, 0x62, 0x62, 0x92, 0x92, 0xA5, 0xA5, 0xB0, 0xB0, 0xB7,
+0xB7, 0xBC, 0xBC, 0xC0, 0xC0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0, 0xBD, 0xBD, 0xB8, 0xB8, 0xB2,
+0xB2, 0xA8, 0xA8, 0x98, 0x98, 0x67, 0x67, 0x57, 0x57, 0x4D, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x3F,
+0x3F, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x43, 0x43, 0x48, 0x48, 0x4F, 0x4F, 0x5A, 0x5A, 0x6D,
+0x6D, 0x9C, 0x9C, 0xAA, 0xAA, 0xB3, 0xB3, 0xBA, 0xBA, 0xBE, 0xBE, 0xC1, 0xC1, 0xC2, 0xC2, 0xC1,
+0xC1, 0xBF, 0xBF, 0xBB, 0xBB, 0xB6, 0xB6, 0xAE, 0xAE, 0xA2, 0xA2, 0x89, 0x89, 0x5F, 0x5F, 0x53,
+0x53, 0x4A, 0x4A, 0x44, 0x44, 0x41, 0x41, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x41, 0x41, 0x45,
+0x45, 0x4B, 0x4B, 0x54, 0x54, 0x61, 0x61, 0x8E, 0x8E, 0xA3, 0xA3, 0xAE, 0xAE, 0xB6, 0xB6, 0xBB,
+0xBB, 0xBF, 0xBF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB2, 0xB2, 0xA9,
+0xA9, 0x9B, 0x9B, 0x6A, 0x6A, 0x59, 0x59, 0x4F, 0x4F, 0x48, 0x48, 0x43, 0x43, 0x40, 0x40, 0x3E,
+0x3E, 0x3E, 0x3E, 0x40, 0x40, 0x43, 0x43, 0x48, 0x48, 0x4F, 0x4F, 0x59, 0x59, 0x69, 0x69, 0x9A,
+0x9A, 0xA8, 0xA8, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD, 0xBD, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xBF,
+0xBF, 0xBB, 0xBB, 0xB6, 0xB6, 0xAE, 0xAE, 0xA3, 0xA3, 0x8F, 0x8F, 0x61, 0x61, 0x54, 0x54, 0x4C,
+0x4C, 0x46, 0x46, 0x41, 0x41, 0x3F, 0x3F, 0x3E, 0x3E, 0x3F, 0x3F, 0x41, 0x41, 0x45, 0x45, 0x4B,
+0x4B, 0x53, 0x53, 0x5F, 0x5F, 0x86, 0x86, 0xA1, 0xA1, 0xAD, 0xAD, 0xB5, 0xB5, 0xBA, 0xBA, 0xBE,
+0xBE, 0xC0, 0xC0, 0xC1, 0xC1, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB3, 0xB3, 0xAA, 0xAA, 0x9D,
+0x9D, 0x6E, 0x6E, 0x5B, 0x5B, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x40, 0x40, 0x3F, 0x3F, 0x3E,
+0x3E, 0x40, 0x40, 0x43, 0x43, 0x47, 0x47, 0x4E, 0x4E, 0x58, 0x58, 0x67, 0x67, 0x97, 0x97, 0xA7,
+0xA7, 0xB0, 0xB0, 0xB7, 0xB7, 0xBC, 0xBC, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBB,
+0xBB, 0xB6, 0xB6, 0xAF, 0xAF, 0xA5, 0xA5, 0x93, 0x93, 0x64, 0x64, 0x56, 0x56, 0x4D, 0x4D, 0x47,
+0x47, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x45, 0x45, 0x4A, 0x4A, 0x52,
+0x52, 0x5D, 0x5D, 0x74, 0x74, 0x9F, 0x9F, 0xAB, 0xAB, 0xB4, 0xB4, 0xB9, 0xB9, 0xBD, 0xBD, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBD, 0xBD, 0xB9, 0xB9, 0xB3, 0xB3, 0xAB, 0xAB, 0x9E, 0x9E, 0x73,
+0x73, 0x5D, 0x5D, 0x52, 0x52, 0x4A, 0x4A, 0x45, 0x45, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x40,
+0x40, 0x43, 0x43, 0x47, 0x47, 0x4D, 0x4D, 0x56, 0x56, 0x64, 0x64, 0x94, 0x94, 0xA5, 0xA5, 0xAF,
+0xAF, 0xB6, 0xB6, 0xBB, 0xBB, 0xBE, 0xBE, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBB, 0xBB, 0xB7,
+0xB7, 0xB0, 0xB0, 0xA6, 0xA6, 0x96, 0x96, 0x66, 0x66, 0x58, 0x58, 0x4E, 0x4E, 0x48, 0x48, 0x43,
+0x43, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x41, 0x41, 0x45, 0x45, 0x4A, 0x4A, 0x51, 0x51, 0x5C,
+0x5C, 0x6F, 0x6F, 0x9D, 0x9D, 0xAA, 0xAA, 0xB2, 0xB2, 0xB8, 0xB8, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0,
+0xC0, 0xBF, 0xBF, 0xBD, 0xBD, 0xB9, 0xB9, 0xB4, 0xB4, 0xAC, 0xAC, 0xA0, 0xA0, 0x80, 0x80, 0x5F,
+0x5F, 0x53, 0x53, 0x4B, 0x4B, 0x46, 0x46, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x40, 0x40, 0x43,
+0x43, 0x47, 0x47, 0x4D, 0x4D, 0x55, 0x55, 0x62, 0x62, 0x90, 0x90, 0xA3, 0xA3, 0xAE, 0xAE, 0xB5,
+0xB5, 0xBA, 0xBA, 0xBE, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB0,
+0xB0, 0xA7, 0xA7, 0x99, 0x99, 0x69, 0x69, 0x59, 0x59, 0x50, 0x50, 0x49, 0x49, 0x44, 0x44, 0x41,
+0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x5A, 0x5A, 0x6B,
+0x6B, 0x9A, 0x9A, 0xA8, 0xA8, 0xB1, 0xB1, 0xB7, 0xB7, 0xBC, 0xBC, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF,
+0xBF, 0xBD, 0xBD, 0xBA, 0xBA, 0xB4, 0xB4, 0xAD, 0xAD, 0xA2, 0xA2, 0x8C, 0x8C, 0x61, 0x61, 0x55,
+0x55, 0x4D, 0x4D, 0x47, 0x47, 0x43, 0x43, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x43, 0x43, 0x47,
+0x47, 0x4C, 0x4C, 0x54, 0x54, 0x61, 0x61, 0x8B, 0x8B, 0xA1, 0xA1, 0xAC, 0xAC, 0xB4, 0xB4, 0xB9,
+0xB9, 0xBD, 0xBD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB1, 0xB1, 0xA8,
+0xA8, 0x9B, 0x9B, 0x6C, 0x6C, 0x5B, 0x5B, 0x51, 0x51, 0x4A, 0x4A, 0x45, 0x45, 0x42, 0x42, 0x40,
+0x40, 0x40, 0x40, 0x41, 0x41, 0x44, 0x44, 0x49, 0x49, 0x50, 0x50, 0x59, 0x59, 0x69, 0x69, 0x98,
+0x98, 0xA6, 0xA6, 0xB0, 0xB0, 0xB6, 0xB6, 0xBB, 0xBB, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD,
+0xBD, 0xBA, 0xBA, 0xB5, 0xB5, 0xAD, 0xAD, 0xA3, 0xA3, 0x91, 0x91, 0x63, 0x63, 0x56, 0x56, 0x4E,
+0x4E, 0x48, 0x48, 0x44, 0x44, 0x41, 0x41, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4C,
+0x4C, 0x54, 0x54, 0x5F, 0x5F, 0x79, 0x79, 0x9F, 0x9F, 0xAB, 0xAB, 0xB3, 0xB3, 0xB8, 0xB8, 0xBC,
+0xBC, 0xBE, 0xBE, 0xBF, 0xBF, 0xBE, 0xBE, 0xBB, 0xBB, 0xB7, 0xB7, 0xB2, 0xB2, 0xA9, 0xA9, 0x9D,
+0x9D, 0x71, 0x71, 0x5D, 0x5D, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x43, 0x43, 0x41, 0x41, 0x41,
+0x41, 0x42, 0x42, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x58, 0x58, 0x66, 0x66, 0x95, 0x95, 0xA5,
+0xA5, 0xAE, 0xAE, 0xB5, 0xB5, 0xBA, 0xBA, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBA,
+0xBA, 0xB5, 0xB5, 0xAE, 0xAE, 0xA4, 0xA4, 0x94, 0x94, 0x66, 0x66, 0x58, 0x58, 0x4F, 0x4F, 0x49,
+0x49, 0x45, 0x45, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4C, 0x4C, 0x53,
+0x53, 0x5E, 0x5E, 0x72, 0x72, 0x9D, 0x9D, 0xA9, 0xA9, 0xB1, 0xB1, 0xB7, 0xB7, 0xBB, 0xBB, 0xBD,
+0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBB, 0xBB, 0xB8, 0xB8, 0xB2, 0xB2, 0xAA, 0xAA, 0x9E, 0x9E, 0x76,
+0x76, 0x5F, 0x5F, 0x54, 0x54, 0x4C, 0x4C, 0x47, 0x47, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x42,
+0x42, 0x44, 0x44, 0x49, 0x49, 0x4F, 0x4F, 0x57, 0x57, 0x64, 0x64, 0x91, 0x91, 0xA3, 0xA3, 0xAD,
+0xAD, 0xB4, 0xB4, 0xB9, 0xB9, 0xBC, 0xBC, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBA, 0xBA, 0xB5,
+0xB5, 0xAF, 0xAF, 0xA5, 0xA5, 0x97, 0x97, 0x68, 0x68, 0x5A, 0x5A, 0x50, 0x50, 0x4A, 0x4A, 0x45,
+0x45, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46, 0x4B, 0x4B, 0x52, 0x52, 0x5C,
+0x5C, 0x6E, 0x6E, 0x9B, 0x9B, 0xA8, 0xA8, 0xB0, 0xB0, 0xB6, 0xB6, 0xBA, 0xBA, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB2, 0xB2, 0xAB, 0xAB, 0xA0, 0xA0, 0x88, 0x88, 0x61,
+0x61, 0x55, 0x55, 0x4D, 0x4D, 0x48, 0x48, 0x44, 0x44, 0x42, 0x42, 0x41, 0x41, 0x42, 0x42, 0x45,
+0x45, 0x48, 0x48, 0x4E, 0x4E, 0x56, 0x56, 0x62, 0x62, 0x8D, 0x8D, 0xA1, 0xA1, 0xAC, 0xAC, 0xB3,
+0xB3, 0xB8, 0xB8, 0xBB, 0xBB, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB5, 0xB5, 0xAF,
+0xAF, 0xA6, 0xA6, 0x99, 0x99, 0x6B, 0x6B, 0x5B, 0x5B, 0x52, 0x52, 0x4B, 0x4B, 0x46, 0x46, 0x43,
+0x43, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x46, 0x46, 0x4B, 0x4B, 0x52, 0x52, 0x5B, 0x5B, 0x6B,
+0x6B, 0x98, 0x98, 0xA6, 0xA6, 0xAF, 0xAF, 0xB5, 0xB5, 0xB9, 0xB9, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB3, 0xB3, 0xAC, 0xAC, 0xA1, 0xA1, 0x8E, 0x8E, 0x63, 0x63, 0x57,
+0x57, 0x4F, 0x4F, 0x49, 0x49, 0x45, 0x45, 0x43, 0x43, 0x42, 0x42, 0x43, 0x43, 0x45, 0x45, 0x48,
+0x48, 0x4E, 0x4E, 0x55, 0x55, 0x61, 0x61, 0x86, 0x86, 0x9F, 0x9F, 0xAA, 0xAA, 0xB2, 0xB2, 0xB7,
+0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB6, 0xB6, 0xB0, 0xB0, 0xA7,
+0xA7, 0x9B, 0x9B, 0x6F, 0x6F, 0x5D, 0x5D, 0x53, 0x53, 0x4C, 0x4C, 0x47, 0x47, 0x44, 0x44, 0x42,
+0x42, 0x42, 0x42, 0x44, 0x44, 0x46, 0x46, 0x4B, 0x4B, 0x51, 0x51, 0x5A, 0x5A, 0x68, 0x68, 0x96,
+0x96, 0xA4, 0xA4, 0xAE, 0xAE, 0xB4, 0xB4, 0xB8, 0xB8, 0xBB, 0xBB, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB,
+0xBB, 0xB8, 0xB8, 0xB3, 0xB3, 0xAC, 0xAC, 0xA3, 0xA3, 0x92, 0x92, 0x65, 0x65, 0x58, 0x58, 0x50,
+0x50, 0x4A, 0x4A, 0x46, 0x46, 0x43, 0x43, 0x42, 0x42, 0x43, 0x43, 0x45, 0x45, 0x48, 0x48, 0x4D,
+0x4D, 0x55, 0x55, 0x5F, 0x5F, 0x75, 0x75, 0x9D, 0x9D, 0xA9, 0xA9, 0xB0, 0xB0, 0xB6, 0xB6, 0xBA,
+0xBA, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xB9, 0xB9, 0xB6, 0xB6, 0xB0, 0xB0, 0xA8, 0xA8, 0x9D,
+0x9D, 0x73, 0x73, 0x5F, 0x5F, 0x55, 0x55, 0x4D, 0x4D, 0x48, 0x48, 0x45, 0x45, 0x43, 0x43, 0x43,
+0x43, 0x44, 0x44, 0x46, 0x46, 0x4A, 0x4A, 0x50, 0x50, 0x59, 0x59, 0x66, 0x66, 0x92, 0x92, 0xA3,
+0xA3, 0xAC, 0xAC, 0xB3, 0xB3, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xB8,
+0xB8, 0xB3, 0xB3, 0xAD, 0xAD, 0xA4, 0xA4, 0x95, 0x95, 0x68, 0x68, 0x5A, 0x5A, 0x51, 0x51, 0x4B,
+0x4B, 0x47, 0x47, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x48, 0x48, 0x4D, 0x4D, 0x54,
+0x54, 0x5E, 0x5E, 0x70, 0x70, 0x9B, 0x9B, 0xA7, 0xA7, 0xAF, 0xAF, 0xB5, 0xB5, 0xB9, 0xB9, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xA9, 0xA9, 0x9E, 0x9E, 0x80,
+0x80, 0x61, 0x61, 0x56, 0x56, 0x4F, 0x4F, 0x49, 0x49, 0x46, 0x46, 0x44, 0x44, 0x43, 0x43, 0x44,
+0x44, 0x46, 0x46, 0x4A, 0x4A, 0x50, 0x50, 0x58, 0x58, 0x64, 0x64, 0x8F, 0x8F, 0xA1, 0xA1, 0xAB,
+0xAB, 0xB2, 0xB2, 0xB6, 0xB6, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBA, 0xBA, 0xB8, 0xB8, 0xB3,
+0xB3, 0xAD, 0xAD, 0xA5, 0xA5, 0x97, 0x97, 0x6B, 0x6B, 0x5C, 0x5C, 0x53, 0x53, 0x4C, 0x4C, 0x48,
+0x48, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x48, 0x48, 0x4D, 0x4D, 0x53, 0x53, 0x5D,
+0x5D, 0x6D, 0x6D, 0x99, 0x99, 0xA6, 0xA6, 0xAE, 0xAE, 0xB4, 0xB4, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xAA, 0xAA, 0xA0, 0xA0, 0x8B, 0x8B, 0x63,
+0x63, 0x57, 0x57, 0x50, 0x50, 0x4A, 0x4A, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47,
+0x47, 0x4A, 0x4A, 0x50, 0x50, 0x57, 0x57, 0x63, 0x63, 0x8A, 0x8A, 0x9F, 0x9F, 0xA9, 0xA9, 0xB0,
+0xB0, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB4, 0xB4, 0xAE,
+0xAE, 0xA6, 0xA6, 0x99, 0x99, 0x6E, 0x6E, 0x5D, 0x5D, 0x54, 0x54, 0x4D, 0x4D, 0x49, 0x49, 0x46,
+0x46, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x48, 0x48, 0x4D, 0x4D, 0x53, 0x53, 0x5C, 0x5C, 0x6A,
+0x6A, 0x96, 0x96, 0xA4, 0xA4, 0xAD, 0xAD, 0xB3, 0xB3, 0xB7, 0xB7, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB,
+0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xAA, 0xAA, 0xA1, 0xA1, 0x90, 0x90, 0x65, 0x65, 0x59,
+0x59, 0x51, 0x51, 0x4B, 0x4B, 0x48, 0x48, 0x45, 0x45, 0x44, 0x44, 0x45, 0x45, 0x47, 0x47, 0x4A,
+0x4A, 0x4F, 0x4F, 0x57, 0x57, 0x61, 0x61, 0x79, 0x79, 0x9D, 0x9D, 0xA8, 0xA8, 0xAF, 0xAF, 0xB5,
+0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB4, 0xB4, 0xAE, 0xAE, 0xA6,
+0xA6, 0x9B, 0x9B, 0x71, 0x71, 0x5F, 0x5F, 0x55, 0x55, 0x4F, 0x4F, 0x4A, 0x4A, 0x47, 0x47, 0x45,
+0x45, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4C, 0x4C, 0x52, 0x52, 0x5B, 0x5B, 0x68, 0x68, 0x93,
+0x93, 0xA2, 0xA2, 0xAB, 0xAB, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9,
+0xB9, 0xB6, 0xB6, 0xB1, 0xB1, 0xAB, 0xAB, 0xA2, 0xA2, 0x93, 0x93, 0x67, 0x67, 0x5B, 0x5B, 0x52,
+0x52, 0x4C, 0x4C, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4F,
+0x4F, 0x56, 0x56, 0x60, 0x60, 0x73, 0x73, 0x9B, 0x9B, 0xA6, 0xA6, 0xAE, 0xAE, 0xB3, 0xB3, 0xB7,
+0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xAF, 0xAF, 0xA7, 0xA7, 0x9C,
+0x9C, 0x77, 0x77, 0x61, 0x61, 0x57, 0x57, 0x50, 0x50, 0x4B, 0x4B, 0x47, 0x47, 0x46, 0x46, 0x45,
+0x45, 0x46, 0x46, 0x48, 0x48, 0x4C, 0x4C, 0x52, 0x52, 0x5A, 0x5A, 0x66, 0x66, 0x90, 0x90, 0xA1,
+0xA1, 0xAA, 0xAA, 0xB0, 0xB0, 0xB5, 0xB5, 0xB8, 0xB8, 0xBA, 0xBA, 0xBA, 0xBA, 0xB8, 0xB8, 0xB6,
+0xB6, 0xB2, 0xB2, 0xAB, 0xAB, 0xA3, 0xA3, 0x95, 0x95, 0x6A, 0x6A, 0x5C, 0x5C, 0x54, 0x54, 0x4E,
+0x4E, 0x49, 0x49, 0x47, 0x47, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x4A, 0x4A, 0x4F, 0x4F, 0x55,
+0x55, 0x5F, 0x5F, 0x6F, 0x6F, 0x99, 0x99, 0xA5, 0xA5, 0xAD, 0xAD, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xAF, 0xAF, 0xA8, 0xA8, 0x9E, 0x9E, 0x88,
+0x88, 0x63, 0x63, 0x58, 0x58, 0x51, 0x51, 0x4C, 0x4C, 0x48, 0x48, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x49, 0x49, 0x4C, 0x4C, 0x52, 0x52, 0x59, 0x59, 0x64, 0x64, 0x8C, 0x8C, 0x9F, 0x9F, 0xA9,
+0xA9, 0xAF, 0xAF, 0xB4, 0xB4, 0xB7, 0xB7, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB2,
+0xB2, 0xAC, 0xAC, 0xA4, 0xA4, 0x97, 0x97, 0x6D, 0x6D, 0x5E, 0x5E, 0x55, 0x55, 0x4F, 0x4F, 0x4A,
+0x4A, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x4A, 0x4A, 0x4F, 0x4F, 0x55, 0x55, 0x5E,
+0x5E, 0x6C, 0x6C, 0x97, 0x97, 0xA3, 0xA3, 0xAC, 0xAC, 0xB1, 0xB1, 0xB5, 0xB5, 0xB8, 0xB8, 0xB9,
+0xB9, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9, 0xA9, 0x9F, 0x9F, 0x8D, 0x8D, 0x65,
+0x65, 0x5A, 0x5A, 0x52, 0x52, 0x4D, 0x4D, 0x49, 0x49, 0x47, 0x47, 0x46, 0x46, 0x47, 0x47, 0x49,
+0x49, 0x4C, 0x4C, 0x51, 0x51, 0x58, 0x58, 0x63, 0x63, 0x86, 0x86, 0x9D, 0x9D, 0xA7, 0xA7, 0xAE,
+0xAE, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB2, 0xB2, 0xAC,
+0xAC, 0xA5, 0xA5, 0x99, 0x99, 0x70, 0x70, 0x5F, 0x5F, 0x56, 0x56, 0x50, 0x50, 0x4B, 0x4B, 0x48,
+0x48, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4E, 0x4E, 0x54, 0x54, 0x5D, 0x5D, 0x6A,
+0x6A, 0x94, 0x94, 0xA2, 0xA2, 0xAA, 0xAA, 0xB0, 0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8,
+0xB8, 0xB7, 0xB7, 0xB4, 0xB4, 0xAF, 0xAF, 0xA9, 0xA9, 0xA0, 0xA0, 0x91, 0x91, 0x67, 0x67, 0x5B,
+0x5B, 0x53, 0x53, 0x4E, 0x4E, 0x4A, 0x4A, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x4C,
+0x4C, 0x51, 0x51, 0x58, 0x58, 0x62, 0x62, 0x76, 0x76, 0x9B, 0x9B, 0xA6, 0xA6, 0xAD, 0xAD, 0xB2,
+0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAD, 0xAD, 0xA5,
+0xA5, 0x9B, 0x9B, 0x74, 0x74, 0x61, 0x61, 0x58, 0x58, 0x51, 0x51, 0x4C, 0x4C, 0x49, 0x49, 0x47,
+0x47, 0x47, 0x47, 0x48, 0x48, 0x4A, 0x4A, 0x4E, 0x4E, 0x54, 0x54, 0x5C, 0x5C, 0x68, 0x68, 0x91,
+0x91, 0xA0, 0xA0, 0xA9, 0xA9, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xB8, 0xB8, 0xB6,
+0xB6, 0xB4, 0xB4, 0xB0, 0xB0, 0xAA, 0xAA, 0xA1, 0xA1, 0x93, 0x93, 0x69, 0x69, 0x5D, 0x5D, 0x55,
+0x55, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x4C, 0x4C, 0x51,
+0x51, 0x57, 0x57, 0x60, 0x60, 0x71, 0x71, 0x99, 0x99, 0xA4, 0xA4, 0xAC, 0xAC, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB7, 0xB7, 0xB8, 0xB8, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAD, 0xAD, 0xA6, 0xA6, 0x9C,
+0x9C, 0x80, 0x80, 0x63, 0x63, 0x59, 0x59, 0x52, 0x52, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x4B, 0x4B, 0x4E, 0x4E, 0x53, 0x53, 0x5B, 0x5B, 0x66, 0x66, 0x8E, 0x8E, 0x9E,
+0x9E, 0xA8, 0xA8, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6, 0xB6, 0xB4,
+0xB4, 0xB0, 0xB0, 0xAA, 0xAA, 0xA2, 0xA2, 0x95, 0x95, 0x6C, 0x6C, 0x5E, 0x5E, 0x56, 0x56, 0x50,
+0x50, 0x4C, 0x4C, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4C, 0x4C, 0x51, 0x51, 0x57,
+0x57, 0x5F, 0x5F, 0x6E, 0x6E, 0x97, 0x97, 0xA3, 0xA3, 0xAA, 0xAA, 0xB0, 0xB0, 0xB4, 0xB4, 0xB6,
+0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAD, 0xAD, 0xA7, 0xA7, 0x9D, 0x9D, 0x8A,
+0x8A, 0x65, 0x65, 0x5A, 0x5A, 0x53, 0x53, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x49,
+0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x53, 0x53, 0x5A, 0x5A, 0x65, 0x65, 0x89, 0x89, 0x9D, 0x9D, 0xA6,
+0xA6, 0xAD, 0xAD, 0xB2, 0xB2, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB6, 0xB6, 0xB3, 0xB3, 0xB0,
+0xB0, 0xAA, 0xAA, 0xA3, 0xA3, 0x97, 0x97, 0x6F, 0x6F, 0x60, 0x60, 0x57, 0x57, 0x51, 0x51, 0x4D,
+0x4D, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x50, 0x50, 0x56, 0x56, 0x5E,
+0x5E, 0x6C, 0x6C, 0x94, 0x94, 0xA1, 0xA1, 0xA9, 0xA9, 0xAF, 0xAF, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB2, 0xB2, 0xAD, 0xAD, 0xA7, 0xA7, 0x9E, 0x9E, 0x8E, 0x8E, 0x67,
+0x67, 0x5C, 0x5C, 0x55, 0x55, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x4B,
+0x4B, 0x4E, 0x4E, 0x53, 0x53, 0x5A, 0x5A, 0x63, 0x63, 0x7A, 0x7A, 0x9B, 0x9B, 0xA5, 0xA5, 0xAC,
+0xAC, 0xB0, 0xB0, 0xB4, 0xB4, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB,
+0xAB, 0xA4, 0xA4, 0x99, 0x99, 0x73, 0x73, 0x62, 0x62, 0x59, 0x59, 0x52, 0x52, 0x4E, 0x4E, 0x4B,
+0x4B, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x56, 0x56, 0x5E, 0x5E, 0x6A,
+0x6A, 0x92, 0x92, 0xA0, 0xA0, 0xA8, 0xA8, 0xAE, 0xAE, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB4, 0xB4, 0xB2, 0xB2, 0xAE, 0xAE, 0xA8, 0xA8, 0x9F, 0x9F, 0x91, 0x91, 0x69, 0x69, 0x5D,
+0x5D, 0x56, 0x56, 0x50, 0x50, 0x4D, 0x4D, 0x4A, 0x4A, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4E,
+0x4E, 0x53, 0x53, 0x59, 0x59, 0x62, 0x62, 0x74, 0x74, 0x99, 0x99, 0xA3, 0xA3, 0xAA, 0xAA, 0xAF,
+0xAF, 0xB3, 0xB3, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB, 0xAB, 0xA4,
+0xA4, 0x9A, 0x9A, 0x78, 0x78, 0x63, 0x63, 0x5A, 0x5A, 0x53, 0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A,
+0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5D, 0x5D, 0x68, 0x68, 0x8F,
+0x8F, 0x9E, 0x9E, 0xA7, 0xA7, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB2, 0xB2, 0xAE, 0xAE, 0xA8, 0xA8, 0xA0, 0xA0, 0x93, 0x93, 0x6C, 0x6C, 0x5F, 0x5F, 0x57,
+0x57, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4C, 0x4C, 0x4E, 0x4E, 0x53,
+0x53, 0x59, 0x59, 0x61, 0x61, 0x70, 0x70, 0x97, 0x97, 0xA2, 0xA2, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2,
+0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xB3, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5, 0xA5, 0x9B,
+0x9B, 0x87, 0x87, 0x65, 0x65, 0x5B, 0x5B, 0x55, 0x55, 0x50, 0x50, 0x4D, 0x4D, 0x4B, 0x4B, 0x4A,
+0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5C, 0x5C, 0x67, 0x67, 0x8B, 0x8B, 0x9C,
+0x9C, 0xA5, 0xA5, 0xAB, 0xAB, 0xB0, 0xB0, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB4, 0xB4, 0xB1,
+0xB1, 0xAE, 0xAE, 0xA8, 0xA8, 0xA1, 0xA1, 0x95, 0x95, 0x6E, 0x6E, 0x60, 0x60, 0x58, 0x58, 0x53,
+0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x58,
+0x58, 0x60, 0x60, 0x6E, 0x6E, 0x95, 0x95, 0xA0, 0xA0, 0xA8, 0xA8, 0xAD, 0xAD, 0xB1, 0xB1, 0xB3,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB2, 0xB2, 0xB0, 0xB0, 0xAB, 0xAB, 0xA5, 0xA5, 0x9C, 0x9C, 0x8C,
+0x8C, 0x67, 0x67, 0x5D, 0x5D, 0x56, 0x56, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x55, 0x55, 0x5C, 0x5C, 0x65, 0x65, 0x85, 0x85, 0x9B, 0x9B, 0xA4,
+0xA4, 0xAA, 0xAA, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE,
+0xAE, 0xA9, 0xA9, 0xA2, 0xA2, 0x97, 0x97, 0x71, 0x71, 0x62, 0x62, 0x5A, 0x5A, 0x54, 0x54, 0x50,
+0x50, 0x4D, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x58, 0x58, 0x5F,
+0x5F, 0x6C, 0x6C, 0x92, 0x92, 0x9F, 0x9F, 0xA7, 0xA7, 0xAC, 0xAC, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4,
+0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0x9D, 0x9D, 0x8F, 0x8F, 0x69,
+0x69, 0x5E, 0x5E, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E,
+0x4E, 0x50, 0x50, 0x55, 0x55, 0x5B, 0x5B, 0x64, 0x64, 0x77, 0x77, 0x99, 0x99, 0xA3, 0xA3, 0xA9,
+0xA9, 0xAE, 0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9,
+0xA9, 0xA2, 0xA2, 0x98, 0x98, 0x75, 0x75, 0x64, 0x64, 0x5B, 0x5B, 0x55, 0x55, 0x51, 0x51, 0x4E,
+0x4E, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x58, 0x58, 0x5F, 0x5F, 0x6A,
+0x6A, 0x90, 0x90, 0x9D, 0x9D, 0xA5, 0xA5, 0xAB, 0xAB, 0xAF, 0xAF, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0x9E, 0x9E, 0x91, 0x91, 0x6B, 0x6B, 0x60,
+0x60, 0x58, 0x58, 0x53, 0x53, 0x4F, 0x4F, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4E, 0x51,
+0x51, 0x55, 0x55, 0x5B, 0x5B, 0x63, 0x63, 0x72, 0x72, 0x97, 0x97, 0xA1, 0xA1, 0xA8, 0xA8, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9, 0xA9, 0xA3,
+0xA3, 0x99, 0x99, 0x80, 0x80, 0x66, 0x66, 0x5C, 0x5C, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4D,
+0x4D, 0x4C, 0x4C, 0x4D, 0x4D, 0x4F, 0x4F, 0x52, 0x52, 0x57, 0x57, 0x5E, 0x5E, 0x68, 0x68, 0x8C,
+0x8C, 0x9C, 0x9C, 0xA4, 0xA4, 0xAA, 0xAA, 0xAE, 0xAE, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1,
+0xB1, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0x9F, 0x9F, 0x93, 0x93, 0x6E, 0x6E, 0x61, 0x61, 0x5A,
+0x5A, 0x54, 0x54, 0x50, 0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x51, 0x51, 0x55,
+0x55, 0x5A, 0x5A, 0x62, 0x62, 0x70, 0x70, 0x95, 0x95, 0xA0, 0xA0, 0xA7, 0xA7, 0xAC, 0xAC, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9, 0xA9, 0xA3, 0xA3, 0x9B,
+0x9B, 0x89, 0x89, 0x67, 0x67, 0x5E, 0x5E, 0x57, 0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D,
+0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x53, 0x53, 0x57, 0x57, 0x5E, 0x5E, 0x67, 0x67, 0x88, 0x88, 0x9A,
+0x9A, 0xA3, 0xA3, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF,
+0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA0, 0xA0, 0x95, 0x95, 0x70, 0x70, 0x63, 0x63, 0x5B, 0x5B, 0x55,
+0x55, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x55, 0x55, 0x5A,
+0x5A, 0x61, 0x61, 0x6D, 0x6D, 0x93, 0x93, 0x9E, 0x9E, 0xA5, 0xA5, 0xAB, 0xAB, 0xAE, 0xAE, 0xB0,
+0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xAD, 0xAD, 0xA9, 0xA9, 0xA4, 0xA4, 0x9B, 0x9B, 0x8D,
+0x8D, 0x69, 0x69, 0x5F, 0x5F, 0x58, 0x58, 0x54, 0x54, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+0x4E, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x66, 0x66, 0x7A, 0x7A, 0x98, 0x98, 0xA1,
+0xA1, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAB,
+0xAB, 0xA7, 0xA7, 0xA0, 0xA0, 0x96, 0x96, 0x74, 0x74, 0x64, 0x64, 0x5C, 0x5C, 0x56, 0x56, 0x52,
+0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x55, 0x55, 0x5A, 0x5A, 0x61,
+0x61, 0x6C, 0x6C, 0x90, 0x90, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB0, 0xB0, 0xB1,
+0xB1, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD, 0xAD, 0xA9, 0xA9, 0xA4, 0xA4, 0x9C, 0x9C, 0x90, 0x90, 0x6B,
+0x6B, 0x61, 0x61, 0x5A, 0x5A, 0x55, 0x55, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4F, 0x4F, 0x50,
+0x50, 0x53, 0x53, 0x57, 0x57, 0x5D, 0x5D, 0x65, 0x65, 0x75, 0x75, 0x97, 0x97, 0xA0, 0xA0, 0xA6,
+0xA6, 0xAB, 0xAB, 0xAE, 0xAE, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAE, 0xAE, 0xAB, 0xAB, 0xA7,
+0xA7, 0xA1, 0xA1, 0x98, 0x98, 0x78, 0x78, 0x66, 0x66, 0x5D, 0x5D, 0x58, 0x58, 0x53, 0x53, 0x51,
+0x51, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x55, 0x55, 0x59, 0x59, 0x60, 0x60, 0x6A,
+0x6A, 0x8D, 0x8D, 0x9B, 0x9B, 0xA3, 0xA3, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0,
+0xB0, 0xAF, 0xAF, 0xAD, 0xAD, 0xA9, 0xA9, 0xA4, 0xA4, 0x9D, 0x9D, 0x92, 0x92, 0x6E, 0x6E, 0x62,
+0x62, 0x5B, 0x5B, 0x56, 0x56, 0x52, 0x52, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x51, 0x51, 0x53,
+0x53, 0x57, 0x57, 0x5C, 0x5C, 0x64, 0x64, 0x72, 0x72, 0x95, 0x95, 0x9F, 0x9F, 0xA5, 0xA5, 0xAA,
+0xAA, 0xAD, 0xAD, 0xAF, 0xAF, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAB, 0xAB, 0xA7, 0xA7, 0xA1,
+0xA1, 0x99, 0x99, 0x86, 0x86, 0x68, 0x68, 0x5F, 0x5F, 0x59, 0x59, 0x54, 0x54, 0x52, 0x52, 0x50,
+0x50, 0x4F, 0x4F, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x59, 0x59, 0x60, 0x60, 0x69, 0x69, 0x8A,
+0x8A, 0x9A, 0x9A, 0xA2, 0xA2, 0xA7, 0xA7, 0xAB, 0xAB, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAC, 0xAC, 0xA9, 0xA9, 0xA4, 0xA4, 0x9E, 0x9E, 0x93, 0x93, 0x70, 0x70, 0x64, 0x64, 0x5C,
+0x5C, 0x57, 0x57, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x57,
+0x57, 0x5C, 0x5C, 0x63, 0x63, 0x6F, 0x6F, 0x93, 0x93, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAC,
+0xAC, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAD, 0xAD, 0xAB, 0xAB, 0xA7, 0xA7, 0xA1, 0xA1, 0x9A,
+0x9A, 0x8B, 0x8B, 0x6A, 0x6A, 0x60, 0x60, 0x5A, 0x5A, 0x56, 0x56, 0x53, 0x53, 0x51, 0x51, 0x50,
+0x50, 0x51, 0x51, 0x52, 0x52, 0x55, 0x55, 0x59, 0x59, 0x5F, 0x5F, 0x68, 0x68, 0x84, 0x84, 0x98,
+0x98, 0xA0, 0xA0, 0xA6, 0xA6, 0xAA, 0xAA, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xAE, 0xAE, 0xAC,
+0xAC, 0xA9, 0xA9, 0xA5, 0xA5, 0x9E, 0x9E, 0x95, 0x95, 0x73, 0x73, 0x65, 0x65, 0x5D, 0x5D, 0x58,
+0x58, 0x54, 0x54, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x54, 0x57, 0x57, 0x5C,
+0x5C, 0x63, 0x63, 0x6E, 0x6E, 0x90, 0x90, 0x9C, 0x9C, 0xA3, 0xA3, 0xA8, 0xA8, 0xAB, 0xAB, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9A, 0x9A, 0x8E,
+0x8E, 0x6B, 0x6B, 0x62, 0x62, 0x5B, 0x5B, 0x57, 0x57, 0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x51,
+0x51, 0x53, 0x53, 0x55, 0x55, 0x59, 0x59, 0x5F, 0x5F, 0x67, 0x67, 0x77, 0x77, 0x96, 0x96, 0x9F,
+0x9F, 0xA5, 0xA5, 0xA9, 0xA9, 0xAC, 0xAC, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xA9,
+0xA9, 0xA5, 0xA5, 0x9F, 0x9F, 0x96, 0x96, 0x76, 0x76, 0x67, 0x67, 0x5F, 0x5F, 0x59, 0x59, 0x55,
+0x55, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x54, 0x54, 0x57, 0x57, 0x5C, 0x5C, 0x62,
+0x62, 0x6C, 0x6C, 0x8E, 0x8E, 0x9A, 0x9A, 0xA2, 0xA2, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE,
+0xAE, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA7, 0xA7, 0xA2, 0xA2, 0x9B, 0x9B, 0x90, 0x90, 0x6D,
+0x6D, 0x63, 0x63, 0x5C, 0x5C, 0x58, 0x58, 0x54, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53,
+0x53, 0x55, 0x55, 0x59, 0x59, 0x5E, 0x5E, 0x66, 0x66, 0x74, 0x74, 0x94, 0x94, 0x9E, 0x9E, 0xA4,
+0xA4, 0xA8, 0xA8, 0xAB, 0xAB, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA5,
+0xA5, 0x9F, 0x9F, 0x97, 0x97, 0x80, 0x80, 0x68, 0x68, 0x60, 0x60, 0x5A, 0x5A, 0x56, 0x56, 0x54,
+0x54, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x57, 0x57, 0x5C, 0x5C, 0x62, 0x62, 0x6B,
+0x6B, 0x8B, 0x8B, 0x99, 0x99, 0xA0, 0xA0, 0xA5, 0xA5, 0xA9, 0xA9, 0xAB, 0xAB, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAC, 0xAC, 0xAA, 0xAA, 0xA7, 0xA7, 0xA2, 0xA2, 0x9C, 0x9C, 0x91, 0x91, 0x70, 0x70, 0x64,
+0x64, 0x5E, 0x5E, 0x59, 0x59, 0x55, 0x55, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x56,
+0x56, 0x59, 0x59, 0x5E, 0x5E, 0x65, 0x65, 0x71, 0x71, 0x92, 0x92, 0x9C, 0x9C, 0xA2, 0xA2, 0xA7,
+0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xA8, 0xA8, 0xA5, 0xA5, 0x9F,
+0x9F, 0x98, 0x98, 0x88, 0x88, 0x6A, 0x6A, 0x61, 0x61, 0x5C, 0x5C, 0x58, 0x58, 0x55, 0x55, 0x53,
+0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x55, 0x57, 0x57, 0x5C, 0x5C, 0x61, 0x61, 0x6A, 0x6A, 0x87,
+0x87, 0x97, 0x97, 0x9F, 0x9F, 0xA4, 0xA4, 0xA8, 0xA8, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB,
+0xAB, 0xAA, 0xAA, 0xA7, 0xA7, 0xA2, 0xA2, 0x9C, 0x9C, 0x93, 0x93, 0x72, 0x72, 0x66, 0x66, 0x5F,
+0x5F, 0x5A, 0x5A, 0x57, 0x57, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x59,
+0x59, 0x5E, 0x5E, 0x65, 0x65, 0x70, 0x70, 0x90, 0x90, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xA9,
+0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5, 0xA5, 0xA0, 0xA0, 0x98,
+0x98, 0x8B, 0x8B, 0x6C, 0x6C, 0x63, 0x63, 0x5D, 0x5D, 0x59, 0x59, 0x56, 0x56, 0x54, 0x54, 0x53,
+0x53, 0x54, 0x54, 0x55, 0x55, 0x58, 0x58, 0x5C, 0x5C, 0x61, 0x61, 0x69, 0x69, 0x7B, 0x7B, 0x96,
+0x96, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xA9,
+0xA9, 0xA6, 0xA6, 0xA2, 0xA2, 0x9C, 0x9C, 0x94, 0x94, 0x75, 0x75, 0x67, 0x67, 0x60, 0x60, 0x5B,
+0x5B, 0x58, 0x58, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5E,
+0x5E, 0x64, 0x64, 0x6E, 0x6E, 0x8E, 0x8E, 0x99, 0x99, 0xA0, 0xA0, 0xA5, 0xA5, 0xA8, 0xA8, 0xAA,
+0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA4, 0xA4, 0xA0, 0xA0, 0x99, 0x99, 0x8E,
+0x8E, 0x6E, 0x6E, 0x64, 0x64, 0x5E, 0x5E, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x54, 0x54, 0x54,
+0x54, 0x56, 0x56, 0x58, 0x58, 0x5C, 0x5C, 0x61, 0x61, 0x68, 0x68, 0x76, 0x76, 0x94, 0x94, 0x9C,
+0x9C, 0xA2, 0xA2, 0xA6, 0xA6, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA6,
+0xA6, 0xA2, 0xA2, 0x9D, 0x9D, 0x95, 0x95, 0x79, 0x79, 0x69, 0x69, 0x61, 0x61, 0x5C, 0x5C, 0x59,
+0x59, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5E, 0x5E, 0x64,
+0x64, 0x6D, 0x6D, 0x8C, 0x8C, 0x98, 0x98, 0x9F, 0x9F, 0xA3, 0xA3, 0xA7, 0xA7, 0xA9, 0xA9, 0xAA,
+0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA7, 0xA7, 0xA4, 0xA4, 0xA0, 0xA0, 0x99, 0x99, 0x8F, 0x8F, 0x70,
+0x70, 0x66, 0x66, 0x5F, 0x5F, 0x5B, 0x5B, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56,
+0x56, 0x58, 0x58, 0x5C, 0x5C, 0x61, 0x61, 0x67, 0x67, 0x73, 0x73, 0x92, 0x92, 0x9B, 0x9B, 0xA1,
+0xA1, 0xA5, 0xA5, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0xA6, 0xA6, 0xA2,
+0xA2, 0x9D, 0x9D, 0x96, 0x96, 0x86, 0x86, 0x6B, 0x6B, 0x63, 0x63, 0x5D, 0x5D, 0x5A, 0x5A, 0x57,
+0x57, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x5A, 0x5A, 0x5E, 0x5E, 0x64, 0x64, 0x6C,
+0x6C, 0x89, 0x89, 0x96, 0x96, 0x9D, 0x9D, 0xA2, 0xA2, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA7, 0xA7, 0xA4, 0xA4, 0xA0, 0xA0, 0x9A, 0x9A, 0x91, 0x91, 0x72, 0x72, 0x67,
+0x67, 0x61, 0x61, 0x5C, 0x5C, 0x59, 0x59, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x59,
+0x59, 0x5C, 0x5C, 0x60, 0x60, 0x67, 0x67, 0x71, 0x71, 0x90, 0x90, 0x9A, 0x9A, 0x9F, 0x9F, 0xA4,
+0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA5, 0xA5, 0xA2, 0xA2, 0x9D,
+0x9D, 0x96, 0x96, 0x89, 0x89, 0x6C, 0x6C, 0x64, 0x64, 0x5F, 0x5F, 0x5B, 0x5B, 0x58, 0x58, 0x57,
+0x57, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5E, 0x5E, 0x63, 0x63, 0x6B, 0x6B, 0x84,
+0x84, 0x95, 0x95, 0x9C, 0x9C, 0xA1, 0xA1, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA0, 0xA0, 0x9A, 0x9A, 0x92, 0x92, 0x74, 0x74, 0x68, 0x68, 0x62,
+0x62, 0x5D, 0x5D, 0x5A, 0x5A, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x59, 0x59, 0x5C,
+0x5C, 0x60, 0x60, 0x66, 0x66, 0x70, 0x70, 0x8E, 0x8E, 0x98, 0x98, 0x9E, 0x9E, 0xA2, 0xA2, 0xA5,
+0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA5, 0xA5, 0xA2, 0xA2, 0x9D, 0x9D, 0x97,
+0x97, 0x8C, 0x8C, 0x6E, 0x6E, 0x66, 0x66, 0x60, 0x60, 0x5C, 0x5C, 0x59, 0x59, 0x58, 0x58, 0x57,
+0x57, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5E, 0x5E, 0x63, 0x63, 0x6A, 0x6A, 0x78, 0x78, 0x93,
+0x93, 0x9B, 0x9B, 0xA0, 0xA0, 0xA4, 0xA4, 0xA6, 0xA6, 0xA7, 0xA7, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6,
+0xA6, 0xA3, 0xA3, 0xA0, 0xA0, 0x9A, 0x9A, 0x93, 0x93, 0x78, 0x78, 0x6A, 0x6A, 0x63, 0x63, 0x5E,
+0x5E, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x58, 0x58, 0x5A, 0x5A, 0x5D, 0x5D, 0x60,
+0x60, 0x66, 0x66, 0x6F, 0x6F, 0x8C, 0x8C, 0x97, 0x97, 0x9D, 0x9D, 0xA1, 0xA1, 0xA4, 0xA4, 0xA6,
+0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0x9D, 0x9D, 0x97, 0x97, 0x8D,
+0x8D, 0x70, 0x70, 0x67, 0x67, 0x61, 0x61, 0x5D, 0x5D, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58,
+0x58, 0x59, 0x59, 0x5B, 0x5B, 0x5E, 0x5E, 0x63, 0x63, 0x6A, 0x6A, 0x75, 0x75, 0x91, 0x91, 0x99,
+0x99, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA5, 0xA5, 0xA3,
+0xA3, 0xA0, 0xA0, 0x9B, 0x9B, 0x93, 0x93, 0x80, 0x80, 0x6C, 0x6C, 0x64, 0x64, 0x60, 0x60, 0x5C,
+0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5D, 0x5D, 0x61, 0x61, 0x66,
+0x66, 0x6E, 0x6E, 0x89, 0x89, 0x95, 0x95, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3, 0xA3, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA4, 0xA4, 0xA1, 0xA1, 0x9D, 0x9D, 0x98, 0x98, 0x8F, 0x8F, 0x72,
+0x72, 0x68, 0x68, 0x62, 0x62, 0x5E, 0x5E, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x59, 0x59, 0x5A,
+0x5A, 0x5C, 0x5C, 0x5F, 0x5F, 0x63, 0x63, 0x69, 0x69, 0x73, 0x73, 0x90, 0x90, 0x98, 0x98, 0x9D,
+0x9D, 0xA1, 0xA1, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0x9F,
+0x9F, 0x9B, 0x9B, 0x94, 0x94, 0x87, 0x87, 0x6D, 0x6D, 0x66, 0x66, 0x61, 0x61, 0x5D, 0x5D, 0x5B,
+0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5D, 0x5D, 0x61, 0x61, 0x66, 0x66, 0x6D,
+0x6D, 0x86, 0x86, 0x94, 0x94, 0x9A, 0x9A, 0x9F, 0x9F, 0xA2, 0xA2, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9D, 0x9D, 0x98, 0x98, 0x90, 0x90, 0x74, 0x74, 0x6A,
+0x6A, 0x64, 0x64, 0x60, 0x60, 0x5D, 0x5D, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5F, 0x5F, 0x63, 0x63, 0x69, 0x69, 0x72, 0x72, 0x8E, 0x8E, 0x97, 0x97, 0x9C, 0x9C, 0xA0,
+0xA0, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA2, 0xA2, 0x9F, 0x9F, 0x9B,
+0x9B, 0x95, 0x95, 0x8A, 0x8A, 0x6F, 0x6F, 0x67, 0x67, 0x62, 0x62, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x66, 0x66, 0x6C, 0x6C, 0x7C,
+0x7C, 0x92, 0x92, 0x99, 0x99, 0x9E, 0x9E, 0xA1, 0xA1, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA0, 0xA0, 0x9D, 0x9D, 0x98, 0x98, 0x91, 0x91, 0x77, 0x77, 0x6B, 0x6B, 0x65,
+0x65, 0x61, 0x61, 0x5E, 0x5E, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F,
+0x5F, 0x63, 0x63, 0x68, 0x68, 0x71, 0x71, 0x8C, 0x8C, 0x95, 0x95, 0x9B, 0x9B, 0x9F, 0x9F, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F, 0x9F, 0x9B, 0x9B, 0x95,
+0x95, 0x8B, 0x8B, 0x70, 0x70, 0x68, 0x68, 0x63, 0x63, 0x60, 0x60, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B,
+0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x66, 0x66, 0x6C, 0x6C, 0x78, 0x78, 0x91,
+0x91, 0x98, 0x98, 0x9C, 0x9C, 0xA0, 0xA0, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2,
+0xA2, 0xA0, 0xA0, 0x9D, 0x9D, 0x98, 0x98, 0x91, 0x91, 0x7A, 0x7A, 0x6D, 0x6D, 0x66, 0x66, 0x62,
+0x62, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x63,
+0x63, 0x68, 0x68, 0x70, 0x70, 0x8A, 0x8A, 0x94, 0x94, 0x9A, 0x9A, 0x9E, 0x9E, 0xA0, 0xA0, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0x9E, 0x9E, 0x9A, 0x9A, 0x95, 0x95, 0x8D,
+0x8D, 0x72, 0x72, 0x6A, 0x6A, 0x65, 0x65, 0x61, 0x61, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5F, 0x5F, 0x62, 0x62, 0x66, 0x66, 0x6B, 0x6B, 0x75, 0x75, 0x8F, 0x8F, 0x96,
+0x96, 0x9B, 0x9B, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F,
+0x9F, 0x9C, 0x9C, 0x98, 0x98, 0x92, 0x92, 0x85, 0x85, 0x6E, 0x6E, 0x68, 0x68, 0x63, 0x63, 0x60,
+0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x64, 0x64, 0x68,
+0x68, 0x6F, 0x6F, 0x87, 0x87, 0x92, 0x92, 0x98, 0x98, 0x9C, 0x9C, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0xA0, 0x9E, 0x9E, 0x9A, 0x9A, 0x95, 0x95, 0x8E, 0x8E, 0x74,
+0x74, 0x6B, 0x6B, 0x66, 0x66, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E,
+0x5E, 0x60, 0x60, 0x62, 0x62, 0x66, 0x66, 0x6B, 0x6B, 0x74, 0x74, 0x8D, 0x8D, 0x95, 0x95, 0x9A,
+0x9A, 0x9D, 0x9D, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9C,
+0x9C, 0x98, 0x98, 0x92, 0x92, 0x88, 0x88, 0x70, 0x70, 0x69, 0x69, 0x64, 0x64, 0x61, 0x61, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x61, 0x61, 0x64, 0x64, 0x68, 0x68, 0x6F,
+0x6F, 0x83, 0x83, 0x91, 0x91, 0x97, 0x97, 0x9B, 0x9B, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1,
+0xA1, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x9A, 0x9A, 0x95, 0x95, 0x8F, 0x8F, 0x76, 0x76, 0x6D,
+0x6D, 0x67, 0x67, 0x63, 0x63, 0x61, 0x61, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x60,
+0x60, 0x63, 0x63, 0x66, 0x66, 0x6B, 0x6B, 0x73, 0x73, 0x8C, 0x8C, 0x94, 0x94, 0x99, 0x99, 0x9C,
+0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9E, 0x9E, 0x9B, 0x9B, 0x98,
+0x98, 0x92, 0x92, 0x89, 0x89, 0x71, 0x71, 0x6A, 0x6A, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5F,
+0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x68, 0x68, 0x6E, 0x6E, 0x7A,
+0x7A, 0x8F, 0x8F, 0x96, 0x96, 0x9A, 0x9A, 0x9D, 0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9A, 0x9A, 0x95, 0x95, 0x8F, 0x8F, 0x79, 0x79, 0x6E, 0x6E, 0x69,
+0x69, 0x65, 0x65, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x63,
+0x63, 0x66, 0x66, 0x6B, 0x6B, 0x72, 0x72, 0x8A, 0x8A, 0x92, 0x92, 0x97, 0x97, 0x9B, 0x9B, 0x9D,
+0x9D, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x97, 0x97, 0x93,
+0x93, 0x8B, 0x8B, 0x73, 0x73, 0x6C, 0x6C, 0x67, 0x67, 0x64, 0x64, 0x62, 0x62, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x65, 0x65, 0x69, 0x69, 0x6E, 0x6E, 0x77, 0x77, 0x8E,
+0x8E, 0x94, 0x94, 0x98, 0x98, 0x9B, 0x9B, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E,
+0x9E, 0x9C, 0x9C, 0x99, 0x99, 0x95, 0x95, 0x8F, 0x8F, 0x80, 0x80, 0x70, 0x70, 0x6A, 0x6A, 0x66,
+0x66, 0x63, 0x63, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x67,
+0x67, 0x6B, 0x6B, 0x71, 0x71, 0x87, 0x87, 0x91, 0x91, 0x96, 0x96, 0x99, 0x99, 0x9C, 0x9C, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9C, 0x9C, 0x9A, 0x9A, 0x97, 0x97, 0x93, 0x93, 0x8C,
+0x8C, 0x75, 0x75, 0x6D, 0x6D, 0x68, 0x68, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x61,
+0x61, 0x62, 0x62, 0x63, 0x63, 0x66, 0x66, 0x69, 0x69, 0x6E, 0x6E, 0x76, 0x76, 0x8C, 0x8C, 0x93,
+0x93, 0x97, 0x97, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B,
+0x9B, 0x99, 0x99, 0x95, 0x95, 0x90, 0x90, 0x85, 0x85, 0x71, 0x71, 0x6B, 0x6B, 0x67, 0x67, 0x65,
+0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x67, 0x67, 0x6B,
+0x6B, 0x71, 0x71, 0x85, 0x85, 0x8F, 0x8F, 0x95, 0x95, 0x98, 0x98, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x97, 0x97, 0x93, 0x93, 0x8C, 0x8C, 0x77,
+0x77, 0x6F, 0x6F, 0x6A, 0x6A, 0x67, 0x67, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x63,
+0x63, 0x64, 0x64, 0x66, 0x66, 0x69, 0x69, 0x6E, 0x6E, 0x75, 0x75, 0x8B, 0x8B, 0x92, 0x92, 0x96,
+0x96, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x98,
+0x98, 0x95, 0x95, 0x90, 0x90, 0x87, 0x87, 0x73, 0x73, 0x6D, 0x6D, 0x69, 0x69, 0x66, 0x66, 0x64,
+0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x68, 0x68, 0x6C, 0x6C, 0x71,
+0x71, 0x7C, 0x7C, 0x8E, 0x8E, 0x93, 0x93, 0x97, 0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C,
+0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x96, 0x96, 0x92, 0x92, 0x8D, 0x8D, 0x79, 0x79, 0x70,
+0x70, 0x6B, 0x6B, 0x68, 0x68, 0x66, 0x66, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x65,
+0x65, 0x67, 0x67, 0x6A, 0x6A, 0x6E, 0x6E, 0x74, 0x74, 0x89, 0x89, 0x90, 0x90, 0x94, 0x94, 0x97,
+0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x99, 0x97, 0x97, 0x94,
+0x94, 0x90, 0x90, 0x89, 0x89, 0x74, 0x74, 0x6E, 0x6E, 0x6A, 0x6A, 0x67, 0x67, 0x66, 0x66, 0x64,
+0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x69, 0x69, 0x6C, 0x6C, 0x71, 0x71, 0x7A,
+0x7A, 0x8C, 0x8C, 0x92, 0x92, 0x95, 0x95, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9A,
+0x9A, 0x99, 0x99, 0x98, 0x98, 0x95, 0x95, 0x92, 0x92, 0x8D, 0x8D, 0x7C, 0x7C, 0x71, 0x71, 0x6D,
+0x6D, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x68,
+0x68, 0x6B, 0x6B, 0x6E, 0x6E, 0x74, 0x74, 0x87, 0x87, 0x8F, 0x8F, 0x93, 0x93, 0x96, 0x96, 0x98,
+0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x90,
+0x90, 0x89, 0x89, 0x76, 0x76, 0x6F, 0x6F, 0x6C, 0x6C, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x65,
+0x65, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x6A, 0x6A, 0x6C, 0x6C, 0x71, 0x71, 0x78, 0x78, 0x8B,
+0x8B, 0x90, 0x90, 0x94, 0x94, 0x96, 0x96, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+0x98, 0x97, 0x97, 0x95, 0x95, 0x91, 0x91, 0x8D, 0x8D, 0x83, 0x83, 0x73, 0x73, 0x6E, 0x6E, 0x6B,
+0x6B, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6B,
+0x6B, 0x6F, 0x6F, 0x74, 0x74, 0x85, 0x85, 0x8D, 0x8D, 0x91, 0x91, 0x94, 0x94, 0x96, 0x96, 0x98,
+0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x8F, 0x8F, 0x8A,
+0x8A, 0x77, 0x77, 0x71, 0x71, 0x6D, 0x6D, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x67,
+0x67, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x71, 0x71, 0x77, 0x77, 0x89, 0x89, 0x8F,
+0x8F, 0x92, 0x92, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96,
+0x96, 0x94, 0x94, 0x91, 0x91, 0x8D, 0x8D, 0x85, 0x85, 0x74, 0x74, 0x70, 0x70, 0x6C, 0x6C, 0x6A,
+0x6A, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6F,
+0x6F, 0x74, 0x74, 0x82, 0x82, 0x8C, 0x8C, 0x90, 0x90, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97,
+0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x92, 0x92, 0x8F, 0x8F, 0x8A, 0x8A, 0x79,
+0x79, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x69,
+0x69, 0x6A, 0x6A, 0x6C, 0x6C, 0x6E, 0x6E, 0x71, 0x71, 0x77, 0x77, 0x88, 0x88, 0x8D, 0x8D, 0x91,
+0x91, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x94, 0x94, 0x93,
+0x93, 0x90, 0x90, 0x8C, 0x8C, 0x86, 0x86, 0x76, 0x76, 0x71, 0x71, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A,
+0x6A, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x74,
+0x74, 0x7C, 0x7C, 0x8A, 0x8A, 0x8E, 0x8E, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x91, 0x91, 0x8E, 0x8E, 0x8A, 0x8A, 0x7B, 0x7B, 0x74,
+0x74, 0x70, 0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x77, 0x77, 0x86, 0x86, 0x8C, 0x8C, 0x8F, 0x8F, 0x91,
+0x91, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x91, 0x91, 0x8F,
+0x8F, 0x8C, 0x8C, 0x87, 0x87, 0x77, 0x77, 0x73, 0x73, 0x70, 0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x71, 0x71, 0x74, 0x74, 0x7A,
+0x7A, 0x89, 0x89, 0x8D, 0x8D, 0x8F, 0x8F, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x93,
+0x93, 0x93, 0x93, 0x91, 0x91, 0x90, 0x90, 0x8D, 0x8D, 0x8A, 0x8A, 0x80, 0x80, 0x75, 0x75, 0x72,
+0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E,
+0x6E, 0x70, 0x70, 0x73, 0x73, 0x77, 0x77, 0x84, 0x84, 0x8A, 0x8A, 0x8D, 0x8D, 0x90, 0x90, 0x91,
+0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8B,
+0x8B, 0x87, 0x87, 0x79, 0x79, 0x74, 0x74, 0x72, 0x72, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D,
+0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x72, 0x72, 0x75, 0x75, 0x7A, 0x7A, 0x87,
+0x87, 0x8B, 0x8B, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+0x91, 0x90, 0x90, 0x8E, 0x8E, 0x8C, 0x8C, 0x89, 0x89, 0x83, 0x83, 0x77, 0x77, 0x74, 0x74, 0x71,
+0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x72,
+0x72, 0x74, 0x74, 0x77, 0x77, 0x82, 0x82, 0x89, 0x89, 0x8B, 0x8B, 0x8D, 0x8D, 0x8F, 0x8F, 0x90,
+0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8C, 0x8C, 0x8A, 0x8A, 0x87,
+0x87, 0x7B, 0x7B, 0x76, 0x76, 0x73, 0x73, 0x72, 0x72, 0x70, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F,
+0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x76, 0x76, 0x7A, 0x7A, 0x86, 0x86, 0x89,
+0x89, 0x8B, 0x8B, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E,
+0x8E, 0x8C, 0x8C, 0x8B, 0x8B, 0x88, 0x88, 0x84, 0x84, 0x79, 0x79, 0x76, 0x76, 0x74, 0x74, 0x72,
+0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x74, 0x74, 0x75,
+0x75, 0x78, 0x78, 0x7E, 0x7E, 0x87, 0x87, 0x89, 0x89, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x89, 0x89, 0x86, 0x86, 0x7C,
+0x7C, 0x78, 0x78, 0x76, 0x76, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x77, 0x77, 0x7A, 0x7A, 0x84, 0x84, 0x87, 0x87, 0x89,
+0x89, 0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A,
+0x8A, 0x89, 0x89, 0x87, 0x87, 0x83, 0x83, 0x7B, 0x7B, 0x78, 0x78, 0x76, 0x76, 0x75, 0x75, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x79,
+0x79, 0x7D, 0x7D, 0x85, 0x85, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x88, 0x88, 0x86, 0x86, 0x85, 0x85, 0x7E, 0x7E, 0x7A,
+0x7A, 0x79, 0x79, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77,
+0x77, 0x77, 0x77, 0x78, 0x78, 0x7A, 0x7A, 0x7C, 0x7C, 0x82, 0x82, 0x85, 0x85, 0x86, 0x86, 0x87,
+0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85,
+0x85, 0x84, 0x84, 0x82, 0x82, 0x7D, 0x7D, 0x7B, 0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79,
+0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7E,
+0x7E, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F,
+0x7F, 0x00, 0x00, 0x00, 0x80, 0x9B, 0x9B, 0xA6, 0xA6, 0xAD, 0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4,
+0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3,
+0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC3, 0xC2, 0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBE, 0xBE, 0xBC,
+0xBC, 0xB9, 0xB9, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF, 0xAF, 0xAA, 0xAA, 0xA4, 0xA4, 0x9C, 0x9C, 0x90,
+0x90, 0x6D, 0x6D, 0x62, 0x62, 0x5B, 0x5B, 0x55, 0x55, 0x50, 0x50, 0x4C, 0x4C, 0x48, 0x48, 0x45,
+0x45, 0x43, 0x43, 0x41, 0x41, 0x3F, 0x3F, 0x3E, 0x3E, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x41, 0x41, 0x43, 0x43, 0x45, 0x45, 0x48,
+0x48, 0x4C, 0x4C, 0x50, 0x50, 0x54, 0x54, 0x5A, 0x5A, 0x61, 0x61, 0x6C, 0x6C, 0x8E, 0x8E, 0x9B,
+0x9B, 0xA3, 0xA3, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2, 0xB2, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBE,
+0xBE, 0xBF, 0xBF, 0xC1, 0xC1, 0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2,
+0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB4, 0xB4, 0xB0,
+0xB0, 0xAC, 0xAC, 0xA6, 0xA6, 0x9F, 0x9F, 0x96, 0x96, 0x76, 0x76, 0x66, 0x66, 0x5E, 0x5E, 0x57,
+0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4A, 0x4A, 0x47, 0x47, 0x44, 0x44, 0x42, 0x42, 0x40, 0x40, 0x3F,
+0x3F, 0x3E, 0x3E, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F,
+0x3F, 0x40, 0x40, 0x42, 0x42, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4E, 0x4E, 0x53, 0x53, 0x58,
+0x58, 0x5E, 0x5E, 0x67, 0x67, 0x77, 0x77, 0x96, 0x96, 0xA0, 0xA0, 0xA6, 0xA6, 0xAC, 0xAC, 0xB0,
+0xB0, 0xB4, 0xB4, 0xB7, 0xB7, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xC0, 0xC0, 0xC1, 0xC1, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC3, 0xC3, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD,
+0xBD, 0xBB, 0xBB, 0xB8, 0xB8, 0xB5, 0xB5, 0xB1, 0xB1, 0xAD, 0xAD, 0xA8, 0xA8, 0xA2, 0xA2, 0x9A,
+0x9A, 0x8E, 0x8E, 0x6B, 0x6B, 0x61, 0x61, 0x5A, 0x5A, 0x55, 0x55, 0x50, 0x50, 0x4C, 0x4C, 0x49,
+0x49, 0x46, 0x46, 0x44, 0x44, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D,
+0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x42, 0x42, 0x44, 0x44, 0x47,
+0x47, 0x49, 0x49, 0x4D, 0x4D, 0x51, 0x51, 0x56, 0x56, 0x5B, 0x5B, 0x63, 0x63, 0x6E, 0x6E, 0x90,
+0x90, 0x9C, 0x9C, 0xA3, 0xA3, 0xA9, 0xA9, 0xAE, 0xAE, 0xB2, 0xB2, 0xB5, 0xB5, 0xB8, 0xB8, 0xBB,
+0xBB, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC1, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+0xC2, 0xC1, 0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBD, 0xBD, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6, 0xB6, 0xB3,
+0xB3, 0xAF, 0xAF, 0xAA, 0xAA, 0xA5, 0xA5, 0x9E, 0x9E, 0x94, 0x94, 0x73, 0x73, 0x65, 0x65, 0x5D,
+0x5D, 0x57, 0x57, 0x52, 0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x48, 0x48, 0x45, 0x45, 0x43, 0x43, 0x41,
+0x41, 0x40, 0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F,
+0x3F, 0x40, 0x40, 0x42, 0x42, 0x44, 0x44, 0x46, 0x46, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x54,
+0x54, 0x59, 0x59, 0x5F, 0x5F, 0x68, 0x68, 0x84, 0x84, 0x97, 0x97, 0xA0, 0xA0, 0xA6, 0xA6, 0xAB,
+0xAB, 0xB0, 0xB0, 0xB3, 0xB3, 0xB7, 0xB7, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBF, 0xBF, 0xC0,
+0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC2, 0xC2, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE,
+0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB7, 0xB7, 0xB4, 0xB4, 0xB0, 0xB0, 0xAC, 0xAC, 0xA7, 0xA7, 0xA1,
+0xA1, 0x99, 0x99, 0x8A, 0x8A, 0x6A, 0x6A, 0x61, 0x61, 0x5A, 0x5A, 0x55, 0x55, 0x50, 0x50, 0x4D,
+0x4D, 0x49, 0x49, 0x47, 0x47, 0x44, 0x44, 0x42, 0x42, 0x41, 0x41, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E,
+0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x45,
+0x45, 0x48, 0x48, 0x4B, 0x4B, 0x4E, 0x4E, 0x52, 0x52, 0x57, 0x57, 0x5D, 0x5D, 0x64, 0x64, 0x70,
+0x70, 0x92, 0x92, 0x9C, 0x9C, 0xA3, 0xA3, 0xA9, 0xA9, 0xAE, 0xAE, 0xB1, 0xB1, 0xB5, 0xB5, 0xB8,
+0xB8, 0xBA, 0xBA, 0xBC, 0xBC, 0xBE, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE, 0xBE, 0xBC, 0xBC, 0xBA, 0xBA, 0xB8, 0xB8, 0xB5,
+0xB5, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9, 0xA9, 0xA4, 0xA4, 0x9D, 0x9D, 0x92, 0x92, 0x71, 0x71, 0x65,
+0x65, 0x5D, 0x5D, 0x57, 0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x44,
+0x44, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F,
+0x3F, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x45, 0x45, 0x47, 0x47, 0x4A, 0x4A, 0x4D, 0x4D, 0x51,
+0x51, 0x55, 0x55, 0x5A, 0x5A, 0x61, 0x61, 0x6A, 0x6A, 0x89, 0x89, 0x98, 0x98, 0xA0, 0xA0, 0xA6,
+0xA6, 0xAB, 0xAB, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBE,
+0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE,
+0xBE, 0xBC, 0xBC, 0xBB, 0xBB, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6,
+0xA6, 0xA0, 0xA0, 0x97, 0x97, 0x86, 0x86, 0x69, 0x69, 0x60, 0x60, 0x5A, 0x5A, 0x55, 0x55, 0x51,
+0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x41, 0x41, 0x40, 0x40, 0x3F,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x44,
+0x44, 0x46, 0x46, 0x49, 0x49, 0x4C, 0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5E, 0x5E, 0x66,
+0x66, 0x73, 0x73, 0x93, 0x93, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1, 0xB1, 0xB4,
+0xB4, 0xB7, 0xB7, 0xB9, 0xB9, 0xBB, 0xBB, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB9, 0xB9, 0xB6,
+0xB6, 0xB4, 0xB4, 0xB0, 0xB0, 0xAC, 0xAC, 0xA8, 0xA8, 0xA2, 0xA2, 0x9B, 0x9B, 0x90, 0x90, 0x6F,
+0x6F, 0x64, 0x64, 0x5D, 0x5D, 0x57, 0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x49, 0x49, 0x46,
+0x46, 0x44, 0x44, 0x43, 0x43, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x40,
+0x40, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x44, 0x44, 0x46, 0x46, 0x48, 0x48, 0x4B, 0x4B, 0x4E,
+0x4E, 0x52, 0x52, 0x56, 0x56, 0x5C, 0x5C, 0x62, 0x62, 0x6C, 0x6C, 0x8C, 0x8C, 0x99, 0x99, 0xA1,
+0xA1, 0xA6, 0xA6, 0xAB, 0xAB, 0xAF, 0xAF, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBC,
+0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE,
+0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xB9, 0xB9, 0xB7, 0xB7, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xA9,
+0xA9, 0xA4, 0xA4, 0x9E, 0x9E, 0x96, 0x96, 0x79, 0x79, 0x68, 0x68, 0x60, 0x60, 0x5A, 0x5A, 0x55,
+0x55, 0x51, 0x51, 0x4D, 0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x44, 0x44, 0x42, 0x42, 0x41,
+0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x44,
+0x44, 0x45, 0x45, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x51, 0x51, 0x55, 0x55, 0x5A, 0x5A, 0x5F,
+0x5F, 0x67, 0x67, 0x76, 0x76, 0x94, 0x94, 0x9D, 0x9D, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD, 0xAD, 0xB1,
+0xB1, 0xB4, 0xB4, 0xB6, 0xB6, 0xB9, 0xB9, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8,
+0xB8, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF, 0xAF, 0xAB, 0xAB, 0xA6, 0xA6, 0xA1, 0xA1, 0x9A, 0x9A, 0x8E,
+0x8E, 0x6D, 0x6D, 0x63, 0x63, 0x5D, 0x5D, 0x57, 0x57, 0x53, 0x53, 0x4F, 0x4F, 0x4C, 0x4C, 0x49,
+0x49, 0x47, 0x47, 0x45, 0x45, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40,
+0x40, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x44, 0x44, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4C,
+0x4C, 0x4F, 0x4F, 0x53, 0x53, 0x58, 0x58, 0x5D, 0x5D, 0x64, 0x64, 0x6E, 0x6E, 0x8E, 0x8E, 0x9A,
+0x9A, 0xA1, 0xA1, 0xA6, 0xA6, 0xAB, 0xAB, 0xAF, 0xAF, 0xB2, 0xB2, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9,
+0xB9, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+0xBE, 0xBD, 0xBD, 0xBB, 0xBB, 0xBA, 0xBA, 0xB8, 0xB8, 0xB6, 0xB6, 0xB3, 0xB3, 0xB0, 0xB0, 0xAC,
+0xAC, 0xA8, 0xA8, 0xA3, 0xA3, 0x9D, 0x9D, 0x94, 0x94, 0x75, 0x75, 0x67, 0x67, 0x60, 0x60, 0x5A,
+0x5A, 0x55, 0x55, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x43,
+0x43, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x43,
+0x43, 0x45, 0x45, 0x47, 0x47, 0x49, 0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x52, 0x52, 0x56, 0x56, 0x5B,
+0x5B, 0x61, 0x61, 0x69, 0x69, 0x7B, 0x7B, 0x95, 0x95, 0x9E, 0x9E, 0xA4, 0xA4, 0xA9, 0xA9, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB3, 0xB3, 0xB6, 0xB6, 0xB8, 0xB8, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD,
+0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBA, 0xBA, 0xB8,
+0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA5, 0xA5, 0x9F, 0x9F, 0x98,
+0x98, 0x8B, 0x8B, 0x6C, 0x6C, 0x63, 0x63, 0x5D, 0x5D, 0x57, 0x57, 0x53, 0x53, 0x50, 0x50, 0x4D,
+0x4D, 0x4A, 0x4A, 0x48, 0x48, 0x46, 0x46, 0x44, 0x44, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x41,
+0x41, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4B,
+0x4B, 0x4D, 0x4D, 0x51, 0x51, 0x54, 0x54, 0x59, 0x59, 0x5E, 0x5E, 0x65, 0x65, 0x70, 0x70, 0x90,
+0x90, 0x9A, 0x9A, 0xA1, 0xA1, 0xA6, 0xA6, 0xAB, 0xAB, 0xAE, 0xAE, 0xB2, 0xB2, 0xB4, 0xB4, 0xB7,
+0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+0xBD, 0xBC, 0xBC, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB2, 0xB2, 0xAF,
+0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA2, 0xA2, 0x9B, 0x9B, 0x92, 0x92, 0x73, 0x73, 0x67, 0x67, 0x5F,
+0x5F, 0x5A, 0x5A, 0x55, 0x55, 0x52, 0x52, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x47, 0x47, 0x45,
+0x45, 0x44, 0x44, 0x43, 0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x44,
+0x44, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A, 0x4A, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x57,
+0x57, 0x5C, 0x5C, 0x62, 0x62, 0x6B, 0x6B, 0x87, 0x87, 0x96, 0x96, 0x9E, 0x9E, 0xA4, 0xA4, 0xA9,
+0xA9, 0xAC, 0xAC, 0xB0, 0xB0, 0xB3, 0xB3, 0xB5, 0xB5, 0xB7, 0xB7, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB,
+0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9,
+0xB9, 0xB7, 0xB7, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAC, 0xAC, 0xA9, 0xA9, 0xA4, 0xA4, 0x9E,
+0x9E, 0x96, 0x96, 0x88, 0x88, 0x6B, 0x6B, 0x63, 0x63, 0x5D, 0x5D, 0x58, 0x58, 0x54, 0x54, 0x50,
+0x50, 0x4D, 0x4D, 0x4B, 0x4B, 0x48, 0x48, 0x47, 0x47, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x46, 0x46, 0x48, 0x48, 0x4A,
+0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x52, 0x52, 0x56, 0x56, 0x5A, 0x5A, 0x60, 0x60, 0x67, 0x67, 0x72,
+0x72, 0x91, 0x91, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAE, 0xAE, 0xB1, 0xB1, 0xB4,
+0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9, 0xB9, 0xB7, 0xB7, 0xB6, 0xB6, 0xB3, 0xB3, 0xB1,
+0xB1, 0xAE, 0xAE, 0xAA, 0xAA, 0xA6, 0xA6, 0xA0, 0xA0, 0x9A, 0x9A, 0x90, 0x90, 0x71, 0x71, 0x66,
+0x66, 0x5F, 0x5F, 0x5A, 0x5A, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4C, 0x4C, 0x4A, 0x4A, 0x48,
+0x48, 0x46, 0x46, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44,
+0x44, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4B, 0x4B, 0x4E, 0x4E, 0x51, 0x51, 0x54,
+0x54, 0x59, 0x59, 0x5D, 0x5D, 0x64, 0x64, 0x6C, 0x6C, 0x8A, 0x8A, 0x97, 0x97, 0x9E, 0x9E, 0xA4,
+0xA4, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB8, 0xB8, 0xB9,
+0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9,
+0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB1, 0xB1, 0xAF, 0xAF, 0xAB, 0xAB, 0xA7, 0xA7, 0xA3,
+0xA3, 0x9D, 0x9D, 0x95, 0x95, 0x80, 0x80, 0x6A, 0x6A, 0x62, 0x62, 0x5D, 0x5D, 0x58, 0x58, 0x54,
+0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x46, 0x46, 0x45, 0x45, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x49,
+0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x50, 0x50, 0x53, 0x53, 0x57, 0x57, 0x5C, 0x5C, 0x61, 0x61, 0x68,
+0x68, 0x75, 0x75, 0x92, 0x92, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAE, 0xAE, 0xB0,
+0xB0, 0xB3, 0xB3, 0xB5, 0xB5, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xBA, 0xBA, 0xBB, 0xBB, 0xBB,
+0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xBA, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB4, 0xB4, 0xB2,
+0xB2, 0xAF, 0xAF, 0xAC, 0xAC, 0xA9, 0xA9, 0xA4, 0xA4, 0x9F, 0x9F, 0x98, 0x98, 0x8E, 0x8E, 0x6F,
+0x6F, 0x66, 0x66, 0x5F, 0x5F, 0x5A, 0x5A, 0x56, 0x56, 0x52, 0x52, 0x4F, 0x4F, 0x4D, 0x4D, 0x4B,
+0x4B, 0x49, 0x49, 0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x45,
+0x45, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x52,
+0x52, 0x56, 0x56, 0x5A, 0x5A, 0x5F, 0x5F, 0x65, 0x65, 0x6E, 0x6E, 0x8C, 0x8C, 0x98, 0x98, 0x9E,
+0x9E, 0xA4, 0xA4, 0xA8, 0xA8, 0xAC, 0xAC, 0xAF, 0xAF, 0xB1, 0xB1, 0xB4, 0xB4, 0xB6, 0xB6, 0xB7,
+0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9,
+0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xB0, 0xB0, 0xAD, 0xAD, 0xAA, 0xAA, 0xA6,
+0xA6, 0xA1, 0xA1, 0x9B, 0x9B, 0x93, 0x93, 0x77, 0x77, 0x69, 0x69, 0x62, 0x62, 0x5D, 0x5D, 0x58,
+0x58, 0x54, 0x54, 0x51, 0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A, 0x4A, 0x48, 0x48, 0x47, 0x47, 0x46,
+0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x49,
+0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x4F, 0x4F, 0x51, 0x51, 0x55, 0x55, 0x58, 0x58, 0x5D, 0x5D, 0x62,
+0x62, 0x6A, 0x6A, 0x78, 0x78, 0x93, 0x93, 0x9B, 0x9B, 0xA1, 0xA1, 0xA6, 0xA6, 0xAA, 0xAA, 0xAD,
+0xAD, 0xB0, 0xB0, 0xB2, 0xB2, 0xB4, 0xB4, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xBA,
+0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3,
+0xB3, 0xB1, 0xB1, 0xAE, 0xAE, 0xAB, 0xAB, 0xA7, 0xA7, 0xA3, 0xA3, 0x9E, 0x9E, 0x97, 0x97, 0x8C,
+0x8C, 0x6E, 0x6E, 0x65, 0x65, 0x5F, 0x5F, 0x5A, 0x5A, 0x56, 0x56, 0x53, 0x53, 0x50, 0x50, 0x4E,
+0x4E, 0x4B, 0x4B, 0x4A, 0x4A, 0x48, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x45, 0x45, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x49, 0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x4E, 0x4E, 0x51,
+0x51, 0x54, 0x54, 0x57, 0x57, 0x5B, 0x5B, 0x60, 0x60, 0x67, 0x67, 0x70, 0x70, 0x8E, 0x8E, 0x98,
+0x98, 0x9E, 0x9E, 0xA4, 0xA4, 0xA8, 0xA8, 0xAB, 0xAB, 0xAE, 0xAE, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5,
+0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB6, 0xB6, 0xB5, 0xB5, 0xB3, 0xB3, 0xB1, 0xB1, 0xAF, 0xAF, 0xAC, 0xAC, 0xA9,
+0xA9, 0xA5, 0xA5, 0xA0, 0xA0, 0x9A, 0x9A, 0x91, 0x91, 0x75, 0x75, 0x69, 0x69, 0x62, 0x62, 0x5D,
+0x5D, 0x58, 0x58, 0x55, 0x55, 0x52, 0x52, 0x4F, 0x4F, 0x4D, 0x4D, 0x4B, 0x4B, 0x49, 0x49, 0x48,
+0x48, 0x47, 0x47, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x49,
+0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x53, 0x53, 0x56, 0x56, 0x5A, 0x5A, 0x5E,
+0x5E, 0x64, 0x64, 0x6B, 0x6B, 0x84, 0x84, 0x94, 0x94, 0x9C, 0x9C, 0xA1, 0xA1, 0xA6, 0xA6, 0xA9,
+0xA9, 0xAC, 0xAC, 0xAF, 0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8,
+0xB8, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xB9, 0xB8, 0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB2, 0xB2, 0xAF, 0xAF, 0xAD, 0xAD, 0xAA, 0xAA, 0xA6, 0xA6, 0xA2, 0xA2, 0x9C, 0x9C, 0x95,
+0x95, 0x89, 0x89, 0x6D, 0x6D, 0x65, 0x65, 0x5F, 0x5F, 0x5B, 0x5B, 0x57, 0x57, 0x53, 0x53, 0x51,
+0x51, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x49, 0x49, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x47,
+0x47, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F,
+0x4F, 0x52, 0x52, 0x55, 0x55, 0x58, 0x58, 0x5C, 0x5C, 0x62, 0x62, 0x68, 0x68, 0x72, 0x72, 0x8F,
+0x8F, 0x98, 0x98, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xAB, 0xAB, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2,
+0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+0xB8, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB2, 0xB2, 0xB0, 0xB0, 0xAD, 0xAD, 0xAB,
+0xAB, 0xA7, 0xA7, 0xA3, 0xA3, 0x9F, 0x9F, 0x98, 0x98, 0x90, 0x90, 0x73, 0x73, 0x68, 0x68, 0x62,
+0x62, 0x5D, 0x5D, 0x59, 0x59, 0x55, 0x55, 0x52, 0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4C, 0x4C, 0x4A,
+0x4A, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x47, 0x47, 0x47, 0x47, 0x48, 0x48, 0x48, 0x48, 0x49,
+0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F, 0x4F, 0x51, 0x51, 0x54, 0x54, 0x57, 0x57, 0x5B,
+0x5B, 0x60, 0x60, 0x65, 0x65, 0x6D, 0x6D, 0x88, 0x88, 0x95, 0x95, 0x9C, 0x9C, 0xA1, 0xA1, 0xA5,
+0xA5, 0xA9, 0xA9, 0xAC, 0xAC, 0xAE, 0xAE, 0xB1, 0xB1, 0xB2, 0xB2, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6,
+0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB2, 0xB2, 0xB0, 0xB0, 0xAE, 0xAE, 0xAB, 0xAB, 0xA8, 0xA8, 0xA5, 0xA5, 0xA0, 0xA0, 0x9B,
+0x9B, 0x94, 0x94, 0x85, 0x85, 0x6C, 0x6C, 0x65, 0x65, 0x5F, 0x5F, 0x5B, 0x5B, 0x57, 0x57, 0x54,
+0x54, 0x51, 0x51, 0x4F, 0x4F, 0x4D, 0x4D, 0x4C, 0x4C, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4F,
+0x4F, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x5A, 0x5A, 0x5E, 0x5E, 0x63, 0x63, 0x69, 0x69, 0x74,
+0x74, 0x90, 0x90, 0x99, 0x99, 0x9E, 0x9E, 0xA3, 0xA3, 0xA7, 0xA7, 0xAA, 0xAA, 0xAD, 0xAD, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+0xB7, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAC,
+0xAC, 0xA9, 0xA9, 0xA6, 0xA6, 0xA2, 0xA2, 0x9D, 0x9D, 0x97, 0x97, 0x8E, 0x8E, 0x71, 0x71, 0x68,
+0x68, 0x62, 0x62, 0x5D, 0x5D, 0x59, 0x59, 0x56, 0x56, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4F, 0x4D,
+0x4D, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x53, 0x53, 0x55, 0x55, 0x59,
+0x59, 0x5C, 0x5C, 0x61, 0x61, 0x67, 0x67, 0x6F, 0x6F, 0x8A, 0x8A, 0x95, 0x95, 0x9C, 0x9C, 0xA1,
+0xA1, 0xA5, 0xA5, 0xA8, 0xA8, 0xAB, 0xAB, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4,
+0xB4, 0xB5, 0xB5, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4,
+0xB4, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD, 0xAD, 0xAA, 0xAA, 0xA7, 0xA7, 0xA3, 0xA3, 0x9F,
+0x9F, 0x9A, 0x9A, 0x92, 0x92, 0x7A, 0x7A, 0x6C, 0x6C, 0x65, 0x65, 0x5F, 0x5F, 0x5B, 0x5B, 0x58,
+0x58, 0x55, 0x55, 0x52, 0x52, 0x50, 0x50, 0x4E, 0x4E, 0x4D, 0x4D, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A,
+0x4A, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4D, 0x4D, 0x4E,
+0x4E, 0x50, 0x50, 0x52, 0x52, 0x55, 0x55, 0x58, 0x58, 0x5B, 0x5B, 0x5F, 0x5F, 0x64, 0x64, 0x6B,
+0x6B, 0x77, 0x77, 0x91, 0x91, 0x99, 0x99, 0x9E, 0x9E, 0xA3, 0xA3, 0xA6, 0xA6, 0xA9, 0xA9, 0xAC,
+0xAC, 0xAE, 0xAE, 0xB0, 0xB0, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB4, 0xB4, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAD,
+0xAD, 0xAB, 0xAB, 0xA8, 0xA8, 0xA5, 0xA5, 0xA1, 0xA1, 0x9C, 0x9C, 0x96, 0x96, 0x8C, 0x8C, 0x70,
+0x70, 0x68, 0x68, 0x62, 0x62, 0x5D, 0x5D, 0x5A, 0x5A, 0x56, 0x56, 0x54, 0x54, 0x51, 0x51, 0x4F,
+0x4F, 0x4E, 0x4E, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x52, 0x52, 0x54, 0x54, 0x57,
+0x57, 0x5A, 0x5A, 0x5E, 0x5E, 0x62, 0x62, 0x68, 0x68, 0x70, 0x70, 0x8C, 0x8C, 0x96, 0x96, 0x9C,
+0x9C, 0xA0, 0xA0, 0xA4, 0xA4, 0xA8, 0xA8, 0xAA, 0xAA, 0xAD, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xB2,
+0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3,
+0xB3, 0xB2, 0xB2, 0xB1, 0xB1, 0xAF, 0xAF, 0xAE, 0xAE, 0xAB, 0xAB, 0xA9, 0xA9, 0xA6, 0xA6, 0xA2,
+0xA2, 0x9E, 0x9E, 0x98, 0x98, 0x91, 0x91, 0x77, 0x77, 0x6B, 0x6B, 0x65, 0x65, 0x60, 0x60, 0x5C,
+0x5C, 0x58, 0x58, 0x55, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4F, 0x4E, 0x4E, 0x4C, 0x4C, 0x4C,
+0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E,
+0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x56, 0x56, 0x59, 0x59, 0x5C, 0x5C, 0x61, 0x61, 0x66,
+0x66, 0x6C, 0x6C, 0x7C, 0x7C, 0x92, 0x92, 0x99, 0x99, 0x9E, 0x9E, 0xA2, 0xA2, 0xA6, 0xA6, 0xA9,
+0xA9, 0xAB, 0xAB, 0xAD, 0xAD, 0xAF, 0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB3, 0xB3, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAE,
+0xAE, 0xAC, 0xAC, 0xA9, 0xA9, 0xA6, 0xA6, 0xA3, 0xA3, 0x9F, 0x9F, 0x9A, 0x9A, 0x94, 0x94, 0x89,
+0x89, 0x6F, 0x6F, 0x67, 0x67, 0x62, 0x62, 0x5E, 0x5E, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x52,
+0x52, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x55,
+0x55, 0x58, 0x58, 0x5B, 0x5B, 0x5F, 0x5F, 0x64, 0x64, 0x69, 0x69, 0x72, 0x72, 0x8D, 0x8D, 0x96,
+0x96, 0x9C, 0x9C, 0xA0, 0xA0, 0xA4, 0xA4, 0xA7, 0xA7, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE, 0xAE, 0xAF,
+0xAF, 0xB1, 0xB1, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAE, 0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA7, 0xA7, 0xA4,
+0xA4, 0xA1, 0xA1, 0x9C, 0x9C, 0x97, 0x97, 0x8F, 0x8F, 0x75, 0x75, 0x6B, 0x6B, 0x65, 0x65, 0x60,
+0x60, 0x5C, 0x5C, 0x59, 0x59, 0x56, 0x56, 0x54, 0x54, 0x52, 0x52, 0x50, 0x50, 0x4F, 0x4F, 0x4E,
+0x4E, 0x4D, 0x4D, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E,
+0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x55, 0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5E, 0x5E, 0x62,
+0x62, 0x67, 0x67, 0x6E, 0x6E, 0x86, 0x86, 0x93, 0x93, 0x99, 0x99, 0x9E, 0x9E, 0xA2, 0xA2, 0xA5,
+0xA5, 0xA8, 0xA8, 0xAA, 0xAA, 0xAC, 0xAC, 0xAE, 0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAE,
+0xAE, 0xAC, 0xAC, 0xAA, 0xAA, 0xA8, 0xA8, 0xA5, 0xA5, 0xA2, 0xA2, 0x9E, 0x9E, 0x99, 0x99, 0x93,
+0x93, 0x87, 0x87, 0x6E, 0x6E, 0x67, 0x67, 0x62, 0x62, 0x5E, 0x5E, 0x5B, 0x5B, 0x58, 0x58, 0x55,
+0x55, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x51, 0x51, 0x53, 0x53, 0x55,
+0x55, 0x57, 0x57, 0x5A, 0x5A, 0x5D, 0x5D, 0x60, 0x60, 0x65, 0x65, 0x6B, 0x6B, 0x74, 0x74, 0x8E,
+0x8E, 0x96, 0x96, 0x9C, 0x9C, 0xA0, 0xA0, 0xA3, 0xA3, 0xA6, 0xA6, 0xA9, 0xA9, 0xAB, 0xAB, 0xAD,
+0xAD, 0xAE, 0xAE, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+0xB2, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA8, 0xA8, 0xA6,
+0xA6, 0xA3, 0xA3, 0x9F, 0x9F, 0x9B, 0x9B, 0x95, 0x95, 0x8D, 0x8D, 0x73, 0x73, 0x6A, 0x6A, 0x65,
+0x65, 0x60, 0x60, 0x5D, 0x5D, 0x5A, 0x5A, 0x57, 0x57, 0x55, 0x55, 0x53, 0x53, 0x51, 0x51, 0x50,
+0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F,
+0x4F, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x54, 0x54, 0x56, 0x56, 0x59, 0x59, 0x5C, 0x5C, 0x5F,
+0x5F, 0x63, 0x63, 0x68, 0x68, 0x70, 0x70, 0x88, 0x88, 0x93, 0x93, 0x99, 0x99, 0x9E, 0x9E, 0xA1,
+0xA1, 0xA5, 0xA5, 0xA7, 0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xAD, 0xAD, 0xAE, 0xAE, 0xB0, 0xB0, 0xB0,
+0xB0, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA6, 0xA6, 0xA4, 0xA4, 0xA0, 0xA0, 0x9D, 0x9D, 0x98,
+0x98, 0x91, 0x91, 0x80, 0x80, 0x6E, 0x6E, 0x67, 0x67, 0x63, 0x63, 0x5F, 0x5F, 0x5B, 0x5B, 0x59,
+0x59, 0x56, 0x56, 0x54, 0x54, 0x53, 0x53, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E,
+0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x54,
+0x54, 0x56, 0x56, 0x58, 0x58, 0x5B, 0x5B, 0x5E, 0x5E, 0x62, 0x62, 0x66, 0x66, 0x6C, 0x6C, 0x77,
+0x77, 0x8F, 0x8F, 0x96, 0x96, 0x9B, 0x9B, 0x9F, 0x9F, 0xA3, 0xA3, 0xA6, 0xA6, 0xA8, 0xA8, 0xAA,
+0xAA, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA7,
+0xA7, 0xA4, 0xA4, 0xA1, 0xA1, 0x9E, 0x9E, 0x9A, 0x9A, 0x94, 0x94, 0x8B, 0x8B, 0x72, 0x72, 0x6A,
+0x6A, 0x65, 0x65, 0x61, 0x61, 0x5D, 0x5D, 0x5A, 0x5A, 0x58, 0x58, 0x56, 0x56, 0x54, 0x54, 0x52,
+0x52, 0x51, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+0x4F, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x54, 0x54, 0x56, 0x56, 0x58, 0x58, 0x5A, 0x5A, 0x5D,
+0x5D, 0x61, 0x61, 0x65, 0x65, 0x6A, 0x6A, 0x71, 0x71, 0x8A, 0x8A, 0x93, 0x93, 0x99, 0x99, 0x9D,
+0x9D, 0xA1, 0xA1, 0xA4, 0xA4, 0xA6, 0xA6, 0xA9, 0xA9, 0xAA, 0xAA, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE,
+0xAE, 0xAF, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE,
+0xAE, 0xAD, 0xAD, 0xAB, 0xAB, 0xA9, 0xA9, 0xA7, 0xA7, 0xA5, 0xA5, 0xA2, 0xA2, 0x9F, 0x9F, 0x9B,
+0x9B, 0x96, 0x96, 0x90, 0x90, 0x79, 0x79, 0x6D, 0x6D, 0x67, 0x67, 0x63, 0x63, 0x5F, 0x5F, 0x5C,
+0x5C, 0x59, 0x59, 0x57, 0x57, 0x55, 0x55, 0x54, 0x54, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50,
+0x50, 0x50, 0x50, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x54,
+0x54, 0x56, 0x56, 0x57, 0x57, 0x5A, 0x5A, 0x5C, 0x5C, 0x5F, 0x5F, 0x63, 0x63, 0x68, 0x68, 0x6E,
+0x6E, 0x7A, 0x7A, 0x90, 0x90, 0x96, 0x96, 0x9B, 0x9B, 0x9F, 0x9F, 0xA2, 0xA2, 0xA5, 0xA5, 0xA7,
+0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA8,
+0xA8, 0xA5, 0xA5, 0xA3, 0xA3, 0xA0, 0xA0, 0x9C, 0x9C, 0x98, 0x98, 0x93, 0x93, 0x89, 0x89, 0x71,
+0x71, 0x6A, 0x6A, 0x65, 0x65, 0x61, 0x61, 0x5E, 0x5E, 0x5B, 0x5B, 0x59, 0x59, 0x57, 0x57, 0x55,
+0x55, 0x54, 0x54, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51,
+0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5C,
+0x5C, 0x5F, 0x5F, 0x62, 0x62, 0x66, 0x66, 0x6B, 0x6B, 0x73, 0x73, 0x8B, 0x8B, 0x93, 0x93, 0x99,
+0x99, 0x9D, 0x9D, 0xA0, 0xA0, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7, 0xA7, 0xA9, 0xA9, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAD,
+0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA8, 0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA1, 0xA1, 0x9E,
+0x9E, 0x9A, 0x9A, 0x95, 0x95, 0x8E, 0x8E, 0x77, 0x77, 0x6D, 0x6D, 0x68, 0x68, 0x63, 0x63, 0x60,
+0x60, 0x5D, 0x5D, 0x5A, 0x5A, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52,
+0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x54,
+0x54, 0x55, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5E, 0x5E, 0x61, 0x61, 0x65, 0x65, 0x69,
+0x69, 0x6F, 0x6F, 0x83, 0x83, 0x90, 0x90, 0x96, 0x96, 0x9B, 0x9B, 0x9E, 0x9E, 0xA1, 0xA1, 0xA4,
+0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9, 0xA9, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAE, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC, 0xAC, 0xAB, 0xAB, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA1, 0xA1, 0x9F, 0x9F, 0x9B, 0x9B, 0x97, 0x97, 0x91, 0x91, 0x87,
+0x87, 0x71, 0x71, 0x6A, 0x6A, 0x65, 0x65, 0x62, 0x62, 0x5F, 0x5F, 0x5C, 0x5C, 0x5A, 0x5A, 0x58,
+0x58, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5B,
+0x5B, 0x5D, 0x5D, 0x60, 0x60, 0x63, 0x63, 0x67, 0x67, 0x6D, 0x6D, 0x75, 0x75, 0x8C, 0x8C, 0x93,
+0x93, 0x98, 0x98, 0x9C, 0x9C, 0x9F, 0x9F, 0xA2, 0xA2, 0xA4, 0xA4, 0xA6, 0xA6, 0xA8, 0xA8, 0xA9,
+0xA9, 0xAB, 0xAB, 0xAB, 0xAB, 0xAC, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAC,
+0xAC, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0x9F,
+0x9F, 0x9C, 0x9C, 0x98, 0x98, 0x94, 0x94, 0x8C, 0x8C, 0x75, 0x75, 0x6D, 0x6D, 0x68, 0x68, 0x64,
+0x64, 0x61, 0x61, 0x5E, 0x5E, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x54,
+0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55,
+0x55, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5B, 0x5B, 0x5D, 0x5D, 0x5F, 0x5F, 0x62, 0x62, 0x66,
+0x66, 0x6B, 0x6B, 0x71, 0x71, 0x86, 0x86, 0x90, 0x90, 0x96, 0x96, 0x9A, 0x9A, 0x9E, 0x9E, 0xA0,
+0xA0, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAC,
+0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8,
+0xA8, 0xA6, 0xA6, 0xA4, 0xA4, 0xA2, 0xA2, 0xA0, 0xA0, 0x9D, 0x9D, 0x9A, 0x9A, 0x95, 0x95, 0x90,
+0x90, 0x84, 0x84, 0x70, 0x70, 0x6A, 0x6A, 0x66, 0x66, 0x62, 0x62, 0x60, 0x60, 0x5D, 0x5D, 0x5B,
+0x5B, 0x59, 0x59, 0x58, 0x58, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53,
+0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5A,
+0x5A, 0x5C, 0x5C, 0x5F, 0x5F, 0x62, 0x62, 0x65, 0x65, 0x69, 0x69, 0x6E, 0x6E, 0x77, 0x77, 0x8D,
+0x8D, 0x93, 0x93, 0x98, 0x98, 0x9C, 0x9C, 0x9F, 0x9F, 0xA1, 0xA1, 0xA3, 0xA3, 0xA5, 0xA5, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA0,
+0xA0, 0x9E, 0x9E, 0x9B, 0x9B, 0x97, 0x97, 0x92, 0x92, 0x8B, 0x8B, 0x74, 0x74, 0x6D, 0x6D, 0x68,
+0x68, 0x64, 0x64, 0x61, 0x61, 0x5F, 0x5F, 0x5C, 0x5C, 0x5B, 0x5B, 0x59, 0x59, 0x58, 0x58, 0x57,
+0x57, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56,
+0x56, 0x56, 0x56, 0x57, 0x57, 0x59, 0x59, 0x5A, 0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x61, 0x61, 0x64,
+0x64, 0x67, 0x67, 0x6C, 0x6C, 0x72, 0x72, 0x88, 0x88, 0x91, 0x91, 0x96, 0x96, 0x9A, 0x9A, 0x9D,
+0x9D, 0x9F, 0x9F, 0xA2, 0xA2, 0xA4, 0xA4, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9,
+0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7,
+0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1, 0xA1, 0x9E, 0x9E, 0x9C, 0x9C, 0x98, 0x98, 0x94,
+0x94, 0x8E, 0x8E, 0x7B, 0x7B, 0x70, 0x70, 0x6B, 0x6B, 0x66, 0x66, 0x63, 0x63, 0x60, 0x60, 0x5E,
+0x5E, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A,
+0x5A, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x63, 0x63, 0x66, 0x66, 0x6A, 0x6A, 0x6F, 0x6F, 0x79,
+0x79, 0x8D, 0x8D, 0x93, 0x93, 0x97, 0x97, 0x9B, 0x9B, 0x9E, 0x9E, 0xA0, 0xA0, 0xA2, 0xA2, 0xA4,
+0xA4, 0xA5, 0xA5, 0xA7, 0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA3, 0xA3, 0xA1,
+0xA1, 0x9F, 0x9F, 0x9C, 0x9C, 0x99, 0x99, 0x95, 0x95, 0x91, 0x91, 0x89, 0x89, 0x74, 0x74, 0x6D,
+0x6D, 0x69, 0x69, 0x65, 0x65, 0x62, 0x62, 0x60, 0x60, 0x5E, 0x5E, 0x5C, 0x5C, 0x5A, 0x5A, 0x59,
+0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57,
+0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x62,
+0x62, 0x65, 0x65, 0x69, 0x69, 0x6D, 0x6D, 0x74, 0x74, 0x89, 0x89, 0x91, 0x91, 0x95, 0x95, 0x99,
+0x99, 0x9C, 0x9C, 0x9E, 0x9E, 0xA1, 0xA1, 0xA2, 0xA2, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7,
+0xA7, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA9, 0xA9, 0xA8, 0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7,
+0xA7, 0xA6, 0xA6, 0xA4, 0xA4, 0xA3, 0xA3, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x9A, 0x9A, 0x97,
+0x97, 0x93, 0x93, 0x8D, 0x8D, 0x79, 0x79, 0x70, 0x70, 0x6B, 0x6B, 0x67, 0x67, 0x64, 0x64, 0x61,
+0x61, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57,
+0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B,
+0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x62, 0x62, 0x65, 0x65, 0x68, 0x68, 0x6C, 0x6C, 0x71,
+0x71, 0x7D, 0x7D, 0x8E, 0x8E, 0x93, 0x93, 0x97, 0x97, 0x9A, 0x9A, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1,
+0xA1, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA8,
+0xA8, 0xA8, 0xA8, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA1,
+0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x98, 0x98, 0x94, 0x94, 0x8F, 0x8F, 0x87, 0x87, 0x73,
+0x73, 0x6D, 0x6D, 0x69, 0x69, 0x66, 0x66, 0x63, 0x63, 0x61, 0x61, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0x5E, 0x5E, 0x60, 0x60, 0x62,
+0x62, 0x64, 0x64, 0x67, 0x67, 0x6A, 0x6A, 0x6F, 0x6F, 0x76, 0x76, 0x8A, 0x8A, 0x90, 0x90, 0x95,
+0x95, 0x98, 0x98, 0x9B, 0x9B, 0x9D, 0x9D, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA4, 0xA4, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9D, 0x9D, 0x9B, 0x9B, 0x98,
+0x98, 0x95, 0x95, 0x91, 0x91, 0x8B, 0x8B, 0x77, 0x77, 0x70, 0x70, 0x6B, 0x6B, 0x68, 0x68, 0x65,
+0x65, 0x63, 0x63, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A,
+0x5A, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C,
+0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x62, 0x62, 0x64, 0x64, 0x66, 0x66, 0x69, 0x69, 0x6D,
+0x6D, 0x72, 0x72, 0x84, 0x84, 0x8E, 0x8E, 0x93, 0x93, 0x96, 0x96, 0x99, 0x99, 0x9C, 0x9C, 0x9E,
+0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6,
+0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1,
+0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9B, 0x9B, 0x99, 0x99, 0x96, 0x96, 0x92, 0x92, 0x8E, 0x8E, 0x85,
+0x85, 0x73, 0x73, 0x6E, 0x6E, 0x6A, 0x6A, 0x67, 0x67, 0x64, 0x64, 0x62, 0x62, 0x60, 0x60, 0x5F,
+0x5F, 0x5D, 0x5D, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E, 0x5E, 0x60, 0x60, 0x61,
+0x61, 0x63, 0x63, 0x66, 0x66, 0x69, 0x69, 0x6C, 0x6C, 0x70, 0x70, 0x77, 0x77, 0x8A, 0x8A, 0x90,
+0x90, 0x94, 0x94, 0x97, 0x97, 0x9A, 0x9A, 0x9C, 0x9C, 0x9E, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2,
+0xA2, 0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0x9F, 0x9F, 0x9E, 0x9E, 0x9C, 0x9C, 0x99,
+0x99, 0x97, 0x97, 0x94, 0x94, 0x90, 0x90, 0x8A, 0x8A, 0x76, 0x76, 0x70, 0x70, 0x6C, 0x6C, 0x69,
+0x69, 0x66, 0x66, 0x64, 0x64, 0x62, 0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C,
+0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D,
+0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x68, 0x68, 0x6B,
+0x6B, 0x6F, 0x6F, 0x74, 0x74, 0x86, 0x86, 0x8E, 0x8E, 0x92, 0x92, 0x95, 0x95, 0x98, 0x98, 0x9A,
+0x9A, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA1, 0xA0,
+0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A, 0x9A, 0x97, 0x97, 0x94, 0x94, 0x91, 0x91, 0x8C,
+0x8C, 0x80, 0x80, 0x73, 0x73, 0x6E, 0x6E, 0x6B, 0x6B, 0x68, 0x68, 0x65, 0x65, 0x64, 0x64, 0x62,
+0x62, 0x60, 0x60, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x62,
+0x62, 0x63, 0x63, 0x65, 0x65, 0x68, 0x68, 0x6A, 0x6A, 0x6D, 0x6D, 0x72, 0x72, 0x79, 0x79, 0x8B,
+0x8B, 0x90, 0x90, 0x93, 0x93, 0x96, 0x96, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F,
+0x9F, 0xA0, 0xA0, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2,
+0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9D, 0x9D, 0x9C, 0x9C, 0x9A,
+0x9A, 0x98, 0x98, 0x95, 0x95, 0x92, 0x92, 0x8E, 0x8E, 0x88, 0x88, 0x76, 0x76, 0x70, 0x70, 0x6D,
+0x6D, 0x6A, 0x6A, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F,
+0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x6A,
+0x6A, 0x6D, 0x6D, 0x70, 0x70, 0x75, 0x75, 0x87, 0x87, 0x8D, 0x8D, 0x91, 0x91, 0x94, 0x94, 0x97,
+0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9C, 0x9C, 0x9E, 0x9E, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1,
+0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F,
+0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9B, 0x9B, 0x9A, 0x9A, 0x98, 0x98, 0x96, 0x96, 0x93, 0x93, 0x8F,
+0x8F, 0x8B, 0x8B, 0x7B, 0x7B, 0x73, 0x73, 0x6F, 0x6F, 0x6C, 0x6C, 0x69, 0x69, 0x67, 0x67, 0x65,
+0x65, 0x63, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E,
+0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x62,
+0x62, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x69, 0x69, 0x6C, 0x6C, 0x6F, 0x6F, 0x73, 0x73, 0x7C,
+0x7C, 0x8B, 0x8B, 0x8F, 0x8F, 0x92, 0x92, 0x95, 0x95, 0x97, 0x97, 0x99, 0x99, 0x9B, 0x9B, 0x9C,
+0x9C, 0x9D, 0x9D, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A,
+0x9A, 0x98, 0x98, 0x96, 0x96, 0x93, 0x93, 0x90, 0x90, 0x8D, 0x8D, 0x86, 0x86, 0x76, 0x76, 0x71,
+0x71, 0x6D, 0x6D, 0x6B, 0x6B, 0x69, 0x69, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62,
+0x62, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60,
+0x60, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x67, 0x67, 0x69,
+0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x72, 0x72, 0x77, 0x77, 0x88, 0x88, 0x8D, 0x8D, 0x91, 0x91, 0x93,
+0x93, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x9A, 0x9A, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E,
+0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D,
+0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x99, 0x99, 0x98, 0x98, 0x96, 0x96, 0x94, 0x94, 0x91,
+0x91, 0x8E, 0x8E, 0x89, 0x89, 0x7A, 0x7A, 0x73, 0x73, 0x70, 0x70, 0x6D, 0x6D, 0x6A, 0x6A, 0x68,
+0x68, 0x67, 0x67, 0x65, 0x65, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61,
+0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64,
+0x64, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6B, 0x6B, 0x6E, 0x6E, 0x71, 0x71, 0x75,
+0x75, 0x82, 0x82, 0x8B, 0x8B, 0x8E, 0x8E, 0x91, 0x91, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x99,
+0x99, 0x9A, 0x9A, 0x9B, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E,
+0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99,
+0x99, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x8F, 0x8F, 0x8B, 0x8B, 0x84, 0x84, 0x76,
+0x76, 0x72, 0x72, 0x6F, 0x6F, 0x6C, 0x6C, 0x6A, 0x6A, 0x68, 0x68, 0x67, 0x67, 0x66, 0x66, 0x65,
+0x65, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x68, 0x68, 0x69,
+0x69, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x73, 0x73, 0x79, 0x79, 0x88, 0x88, 0x8C, 0x8C, 0x8F,
+0x8F, 0x92, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x9A, 0x9B,
+0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x95, 0x95, 0x94, 0x94, 0x92,
+0x92, 0x8F, 0x8F, 0x8C, 0x8C, 0x88, 0x88, 0x79, 0x79, 0x74, 0x74, 0x71, 0x71, 0x6E, 0x6E, 0x6C,
+0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x67, 0x67, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64,
+0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65,
+0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x6A, 0x6A, 0x6B, 0x6B, 0x6D, 0x6D, 0x70, 0x70, 0x72,
+0x72, 0x76, 0x76, 0x84, 0x84, 0x8A, 0x8A, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x95,
+0x95, 0x97, 0x97, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B,
+0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 0x97,
+0x97, 0x96, 0x96, 0x95, 0x95, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8D, 0x8D, 0x89, 0x89, 0x82,
+0x82, 0x76, 0x76, 0x73, 0x73, 0x70, 0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6A, 0x6A, 0x69, 0x69, 0x68,
+0x68, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A,
+0x6A, 0x6C, 0x6C, 0x6D, 0x6D, 0x6F, 0x6F, 0x72, 0x72, 0x75, 0x75, 0x7A, 0x7A, 0x88, 0x88, 0x8B,
+0x8B, 0x8E, 0x8E, 0x90, 0x90, 0x92, 0x92, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x91,
+0x91, 0x90, 0x90, 0x8D, 0x8D, 0x8A, 0x8A, 0x86, 0x86, 0x79, 0x79, 0x75, 0x75, 0x72, 0x72, 0x70,
+0x70, 0x6E, 0x6E, 0x6C, 0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67,
+0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68,
+0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6E, 0x6E, 0x70, 0x70, 0x72,
+0x72, 0x74, 0x74, 0x78, 0x78, 0x84, 0x84, 0x89, 0x89, 0x8C, 0x8C, 0x8E, 0x8E, 0x90, 0x90, 0x92,
+0x92, 0x93, 0x93, 0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98,
+0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95,
+0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8F, 0x8F, 0x8D, 0x8D, 0x8B, 0x8B, 0x88,
+0x88, 0x7D, 0x7D, 0x77, 0x77, 0x74, 0x74, 0x71, 0x71, 0x70, 0x70, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C,
+0x6C, 0x6B, 0x6B, 0x6A, 0x6A, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C,
+0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x70, 0x70, 0x72, 0x72, 0x74, 0x74, 0x77, 0x77, 0x7C, 0x7C, 0x87,
+0x87, 0x8A, 0x8A, 0x8D, 0x8D, 0x8E, 0x8E, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94,
+0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90,
+0x90, 0x8F, 0x8F, 0x8D, 0x8D, 0x8B, 0x8B, 0x89, 0x89, 0x85, 0x85, 0x79, 0x79, 0x76, 0x76, 0x73,
+0x73, 0x72, 0x72, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6D, 0x6D, 0x6C, 0x6C, 0x6B, 0x6B, 0x6B,
+0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B,
+0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x71, 0x71, 0x72,
+0x72, 0x74, 0x74, 0x76, 0x76, 0x7A, 0x7A, 0x84, 0x84, 0x88, 0x88, 0x8B, 0x8B, 0x8C, 0x8C, 0x8E,
+0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94,
+0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92,
+0x92, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 0x8D, 0x8B, 0x8B, 0x89,
+0x89, 0x86, 0x86, 0x7C, 0x7C, 0x78, 0x78, 0x75, 0x75, 0x74, 0x74, 0x72, 0x72, 0x71, 0x71, 0x70,
+0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F,
+0x6F, 0x70, 0x70, 0x70, 0x70, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x76, 0x76, 0x79, 0x79, 0x7E,
+0x7E, 0x86, 0x86, 0x89, 0x89, 0x8A, 0x8A, 0x8C, 0x8C, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90,
+0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E,
+0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8A, 0x8A, 0x89, 0x89, 0x87, 0x87, 0x83, 0x83, 0x7A, 0x7A, 0x77,
+0x77, 0x76, 0x76, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x6F,
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F,
+0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74,
+0x74, 0x75, 0x75, 0x77, 0x77, 0x79, 0x79, 0x7B, 0x7B, 0x84, 0x84, 0x87, 0x87, 0x88, 0x88, 0x8A,
+0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F,
+0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E,
+0x8E, 0x8E, 0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x88,
+0x88, 0x86, 0x86, 0x84, 0x84, 0x7C, 0x7C, 0x79, 0x79, 0x78, 0x78, 0x76, 0x76, 0x75, 0x75, 0x75,
+0x75, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71,
+0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73,
+0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7B,
+0x7B, 0x81, 0x81, 0x84, 0x84, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x8A, 0x8A, 0x8A,
+0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A,
+0x8A, 0x89, 0x89, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x81, 0x81, 0x7C,
+0x7C, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76,
+0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78,
+0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7E, 0x7E, 0x82, 0x82, 0x83, 0x83, 0x84,
+0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86,
+0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x83,
+0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C,
+0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x00, 0x00, 0x00};
@@ -0,0 +1,13 @@
+//Generated by assetpack_build from ../Manifest/pong.txt - do not edit
+
+#ifndef __PONGIDS_H
+#define __PONGIDS_H
+
+#define ASSET_ID_WAVDROPPEDBALL		0xF9204F60
+#define ASSET_ID_WAVGAMEOVER		0x0A2CFDB1
+#define ASSET_ID_WAVLEVELUP		0xB5EC0B94
+#define ASSET_ID_WAVPLAYERBOUNCE		0xE0228F7C
+#define ASSET_ID_WAVTILEBOUNCE		0xD13B2FFD
+#define ASSET_ID_WAVWALLBOUNCE		0x49DE2D69
+
+#endif
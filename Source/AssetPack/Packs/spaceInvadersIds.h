@@ -0,0 +1,12 @@
+//Generated by assetpack_build from ../Manifest/spaceInvaders.txt - do not edit
+
+#ifndef __SPACEINVADERSIDS_H
+#define __SPACEINVADERSIDS_H
+
+#define ASSET_ID_WAVENEMYEXPLODE		0xBAF55D08
+#define ASSET_ID_WAVENEMYFIRE		0xDA8FFF53
+#define ASSET_ID_WAVLEVELUP		0xB5EC0B94
+#define ASSET_ID_WAVPLAYEREXPLODE		0xE18775D9
+#define ASSET_ID_WAVPLAYERFIRE		0x3CA6FAE8
+
+#endif
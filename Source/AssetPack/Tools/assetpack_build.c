@@ -0,0 +1,497 @@
+/*////////////////////////////////////////////////////
+Asset Pack Builder - host tool
+
+Builds an asset pack (see AssetPack.h) from a manifest
+and optionally writes a header with the asset ids.
+
+Build:
+gcc -O2 -DASSET_PACK_HOST -I.. assetpack_build.c ../AssetPack.c -o assetpack_build
+
+Use:
+assetpack_build manifest.txt assets.pak [AssetPackIds.h]
+assetpack_build manifest.txt assets.c [AssetPackIds.h]
+
+Manifest - one asset per line, '#' starts a comment:
+<type> <name> <file> [param0 param1 param2 param3]
+
+type - image, font, sound or table
+name - asset name, hashed into the asset id
+file - a raw binary file, or one of the existing image /
+       sound / font .c files.  For .c files the first
+       brace initialized array of numbers is packed.
+param - type specific values, see AssetType_t
+
+Relative file paths are relative to the manifest.
+Blobs with identical content are stored once.
+
+If the pack file name ends in .c the pack is written as
+a C array in the .assetpack section instead, so a target
+can link it as a plain source file without an objcopy
+step.  AssetPack_OpenLinked() finds it the same way.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "AssetPack.h"
+
+#define MAX_ASSETS			1024
+#define MAX_LINE			512
+
+
+typedef struct
+{
+	char name[64];
+	AssetEntry entry;
+	uint8_t* data;
+	uint32_t hash;
+	int duplicateOf;			//index of the first copy, -1 if unique
+}PackItem;
+
+static PackItem mItems[MAX_ASSETS];
+static int mNumItems = 0;
+
+
+////////////////////////////////////////////
+//read a whole file, returns NULL on error
+static uint8_t* ReadFile(const char* path, uint32_t* size)
+{
+	FILE* fp = fopen(path, "rb");
+
+	if (!fp)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	uint8_t* buffer = malloc((size_t)length + 1);
+
+	if ((!buffer) || (fread(buffer, 1, (size_t)length, fp) != (size_t)length))
+	{
+		free(buffer);
+		fclose(fp);
+		return NULL;
+	}
+
+	buffer[length] = 0x00;
+	*size = (uint32_t)length;
+	fclose(fp);
+	return buffer;
+}
+
+////////////////////////////////////////////
+//Extract the first brace initialized number array
+//from a C source file.  Comments are skipped.
+//Returns a malloc'd byte array.
+static uint8_t* ParseSourceArray(const char* text, uint32_t* size)
+{
+	const char* p = text;
+	uint8_t* out = NULL;
+	uint32_t count = 0;
+	uint32_t capacity = 0;
+	int inArray = 0;
+
+	while (*p)
+	{
+		if ((p[0] == '/') && (p[1] == '/'))
+		{
+			while ((*p) && (*p != '\n'))
+				p++;
+			continue;
+		}
+
+		if ((p[0] == '/') && (p[1] == '*'))
+		{
+			p += 2;
+			while ((*p) && !((p[0] == '*') && (p[1] == '/')))
+				p++;
+			if (*p)
+				p += 2;
+			continue;
+		}
+
+		if (!inArray)
+		{
+			//start of the array is "[] =" followed by '{'
+			if ((p[0] == '[') && (p[1] == ']'))
+			{
+				const char* q = strchr(p, '{');
+				if (q)
+				{
+					inArray = 1;
+					p = q + 1;
+					continue;
+				}
+			}
+			p++;
+			continue;
+		}
+
+		if (*p == '}')
+			break;
+
+		if (isdigit((unsigned char)*p))
+		{
+			char* end;
+			unsigned long value = strtoul(p, &end, 0);
+
+			if (count == capacity)
+			{
+				capacity = capacity ? capacity * 2 : 1024;
+				out = realloc(out, capacity);
+			}
+
+			out[count++] = (uint8_t)value;
+			p = end;
+			continue;
+		}
+
+		p++;
+	}
+
+	*size = count;
+	return out;
+}
+
+static int GetType(const char* name)
+{
+	if (!strcmp(name, "image"))		return ASSET_TYPE_IMAGE;
+	if (!strcmp(name, "font"))		return ASSET_TYPE_FONT;
+	if (!strcmp(name, "sound"))		return ASSET_TYPE_SOUND;
+	if (!strcmp(name, "table"))		return ASSET_TYPE_TABLE;
+	return ASSET_TYPE_NONE;
+}
+
+////////////////////////////////////////////
+//Make a legal C identifier for the ids header
+static void WriteIdName(FILE* fp, const char* name)
+{
+	fprintf(fp, "#define ASSET_ID_");
+
+	for (const char* p = name ; *p ; p++)
+		fputc(isalnum((unsigned char)*p) ? toupper((unsigned char)*p) : '_', fp);
+}
+
+
+////////////////////////////////////////////
+//Include guard from the header file name,
+//Packs/spaceInvadersIds.h - __SPACEINVADERSIDS_H
+static void WriteGuardName(FILE* fp, const char* path)
+{
+	const char* base = strrchr(path, '/');
+	base = base ? base + 1 : path;
+
+	fprintf(fp, "__");
+
+	for (const char* p = base ; *p ; p++)
+		fputc(isalnum((unsigned char)*p) ? toupper((unsigned char)*p) : '_', fp);
+}
+
+
+////////////////////////////////////////////
+//Write the pack as a C array for the target,
+//placed in the .assetpack section
+static int WritePackSource(const char* path, const char* manifest, const uint8_t* pack, uint32_t size)
+{
+	FILE* fp = fopen(path, "w");
+
+	if (!fp)
+		return -1;
+
+	//array name from the file name
+	const char* base = strrchr(path, '/');
+	base = base ? base + 1 : path;
+
+	fprintf(fp, "//Generated by assetpack_build from %s - do not edit\n", manifest);
+	fprintf(fp, "//Asset pack linked into the .assetpack flash section,\n");
+	fprintf(fp, "//open it with AssetPack_OpenLinked()\n\n");
+	fprintf(fp, "#include <stdint.h>\n\n");
+	fprintf(fp, "__attribute__((section(\".assetpack\"), aligned(%d), used))\n", ASSET_PACK_ALIGN);
+	fprintf(fp, "const uint8_t _ap");
+
+	for (const char* p = base ; (*p) && (*p != '.') ; p++)
+		fputc(isalnum((unsigned char)*p) ? *p : '_', fp);
+
+	fprintf(fp, "[%u] =\n{", size);
+
+	for (uint32_t i = 0 ; i < size ; i++)
+	{
+		if (i)
+			fprintf(fp, (i % 16) ? ", " : ",\n");
+		else
+			fprintf(fp, "\n");
+
+		fprintf(fp, "0x%02X", pack[i]);
+	}
+
+	fprintf(fp, "};\n");
+	fclose(fp);
+	return 0;
+}
+
+
+////////////////////////////////////////////
+//Parse the manifest and load each asset
+static int LoadManifest(const char* path)
+{
+	char line[MAX_LINE];
+	char dir[MAX_LINE] = "";
+	int lineNumber = 0;
+	FILE* fp = fopen(path, "r");
+
+	if (!fp)
+	{
+		fprintf(stderr, "can't open manifest %s\n", path);
+		return -1;
+	}
+
+	const char* slash = strrchr(path, '/');
+	if (slash)
+		snprintf(dir, sizeof(dir), "%.*s/", (int)(slash - path), path);
+
+	while (fgets(line, sizeof(line), fp))
+	{
+		char type[16], name[64], file[MAX_LINE], full[MAX_LINE * 2];
+		unsigned int param[4] = {0, 0, 0, 0};
+
+		lineNumber++;
+
+		char* comment = strchr(line, '#');
+		if (comment)
+			*comment = 0x00;
+
+		int n = sscanf(line, "%15s %63s %511s %u %u %u %u", type, name, file,
+				&param[0], &param[1], &param[2], &param[3]);
+
+		if (n <= 0)
+			continue;
+
+		if ((n < 3) || (GetType(type) == ASSET_TYPE_NONE))
+		{
+			fprintf(stderr, "%s:%d: bad asset line\n", path, lineNumber);
+			fclose(fp);
+			return -1;
+		}
+
+		if (mNumItems >= MAX_ASSETS)
+		{
+			fprintf(stderr, "too many assets\n");
+			fclose(fp);
+			return -1;
+		}
+
+		if (file[0] == '/')
+			snprintf(full, sizeof(full), "%s", file);
+		else
+			snprintf(full, sizeof(full), "%s%s", dir, file);
+
+		uint32_t size = 0;
+		uint8_t* data = ReadFile(full, &size);
+
+		if (!data)
+		{
+			fprintf(stderr, "%s:%d: can't read %s\n", path, lineNumber, full);
+			fclose(fp);
+			return -1;
+		}
+
+		size_t length = strlen(full);
+		if ((length > 2) && (!strcmp(full + length - 2, ".c")))
+		{
+			uint8_t* array = ParseSourceArray((const char*)data, &size);
+			free(data);
+			data = array;
+
+			if (!data)
+			{
+				fprintf(stderr, "%s:%d: no array in %s\n", path, lineNumber, full);
+				fclose(fp);
+				return -1;
+			}
+		}
+
+		PackItem* item = &mItems[mNumItems];
+		uint32_t id = AssetPack_GetId(name);
+
+		for (int i = 0 ; i < mNumItems ; i++)
+		{
+			if (mItems[i].entry.id == id)
+			{
+				fprintf(stderr, "%s:%d: duplicate asset id for %s and %s\n",
+						path, lineNumber, name, mItems[i].name);
+				fclose(fp);
+				return -1;
+			}
+		}
+
+		memset(item, 0x00, sizeof(PackItem));
+		snprintf(item->name, sizeof(item->name), "%s", name);
+		item->data = data;
+		item->hash = AssetPack_Hash(data, size);
+		item->duplicateOf = -1;
+		item->entry.id = id;
+		item->entry.size = size;
+		item->entry.type = (uint8_t)GetType(type);
+		item->entry.contentHash = (uint16_t)item->hash;
+
+		for (int i = 0 ; i < 4 ; i++)
+			item->entry.param[i] = (uint16_t)param[i];
+
+		//dedup - same hash, size and bytes as an earlier blob
+		for (int i = 0 ; i < mNumItems ; i++)
+		{
+			if ((mItems[i].duplicateOf < 0) && (mItems[i].hash == item->hash) &&
+				(mItems[i].entry.size == size) && (!memcmp(mItems[i].data, data, size)))
+			{
+				item->duplicateOf = i;
+				break;
+			}
+		}
+
+		mNumItems++;
+	}
+
+	fclose(fp);
+	return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s manifest.txt assets.pak [AssetPackIds.h]\n", argv[0]);
+		return 1;
+	}
+
+	if (LoadManifest(argv[1]) < 0)
+		return 1;
+
+	//directory - power of 2, at least twice the assets
+	uint32_t dirSize = 4;
+	while (dirSize < (uint32_t)mNumItems * 2)
+		dirSize <<= 1;
+
+	if (dirSize > 0x8000)
+	{
+		fprintf(stderr, "too many assets\n");
+		return 1;
+	}
+
+	AssetEntry* directory = calloc(dirSize, sizeof(AssetEntry));
+	uint32_t dataOffset = sizeof(AssetPackHeader) + dirSize * sizeof(AssetEntry);
+	uint32_t offset = dataOffset;
+	uint32_t numUnique = 0;
+	uint32_t savedBytes = 0;
+
+	//assign blob offsets, duplicates share the first copy
+	for (int i = 0 ; i < mNumItems ; i++)
+	{
+		PackItem* item = &mItems[i];
+
+		if (item->duplicateOf >= 0)
+		{
+			item->entry.offset = mItems[item->duplicateOf].entry.offset;
+			savedBytes += item->entry.size;
+			continue;
+		}
+
+		offset = (offset + ASSET_PACK_ALIGN - 1) & ~(uint32_t)(ASSET_PACK_ALIGN - 1);
+		item->entry.offset = offset;
+		offset += item->entry.size;
+		numUnique++;
+	}
+
+	uint32_t totalSize = (offset + ASSET_PACK_ALIGN - 1) & ~(uint32_t)(ASSET_PACK_ALIGN - 1);
+
+	//hash the entries into the directory
+	for (int i = 0 ; i < mNumItems ; i++)
+	{
+		uint32_t slot = mItems[i].entry.id & (dirSize - 1);
+
+		while (directory[slot].id)
+			slot = (slot + 1) & (dirSize - 1);
+
+		directory[slot] = mItems[i].entry;
+	}
+
+	AssetPackHeader header;
+	memset(&header, 0x00, sizeof(header));
+	header.magic = ASSET_PACK_MAGIC;
+	header.version = ASSET_PACK_VERSION;
+	header.numAssets = (uint16_t)mNumItems;
+	header.dirSize = (uint16_t)dirSize;
+	header.dataOffset = dataOffset;
+	header.totalSize = totalSize;
+
+	uint8_t* pack = calloc(1, totalSize);
+	memcpy(pack, &header, sizeof(header));
+	memcpy(pack + sizeof(header), directory, dirSize * sizeof(AssetEntry));
+
+	for (int i = 0 ; i < mNumItems ; i++)
+	{
+		if (mItems[i].duplicateOf < 0)
+			memcpy(pack + mItems[i].entry.offset, mItems[i].data, mItems[i].entry.size);
+	}
+
+	FILE* fp = NULL;
+	size_t length = strlen(argv[2]);
+
+	if ((length > 2) && (!strcmp(argv[2] + length - 2, ".c")))
+	{
+		if (WritePackSource(argv[2], argv[1], pack, totalSize) < 0)
+		{
+			fprintf(stderr, "can't write %s\n", argv[2]);
+			return 1;
+		}
+	}
+	else
+	{
+		fp = fopen(argv[2], "wb");
+
+		if ((!fp) || (fwrite(pack, 1, totalSize, fp) != totalSize))
+		{
+			fprintf(stderr, "can't write %s\n", argv[2]);
+			return 1;
+		}
+
+		fclose(fp);
+	}
+
+	//ids header
+	if (argc > 3)
+	{
+		fp = fopen(argv[3], "w");
+
+		if (!fp)
+		{
+			fprintf(stderr, "can't write %s\n", argv[3]);
+			return 1;
+		}
+
+		fprintf(fp, "//Generated by assetpack_build from %s - do not edit\n\n", argv[1]);
+		fprintf(fp, "#ifndef ");
+		WriteGuardName(fp, argv[3]);
+		fprintf(fp, "\n#define ");
+		WriteGuardName(fp, argv[3]);
+		fprintf(fp, "\n\n");
+
+		for (int i = 0 ; i < mNumItems ; i++)
+		{
+			WriteIdName(fp, mItems[i].name);
+			fprintf(fp, "\t\t0x%08X\n", mItems[i].entry.id);
+		}
+
+		fprintf(fp, "\n#endif\n");
+		fclose(fp);
+	}
+
+	printf("%s: %d assets, %u unique blobs, %u bytes (%u bytes deduplicated)\n",
+			argv[2], mNumItems, numUnique, totalSize, savedBytes);
+
+	return 0;
+}
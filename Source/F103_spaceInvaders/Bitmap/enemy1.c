@@ -24,11 +24,32 @@ static const uint8_t _acenemy1Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgenemy1Bmp[] =
+{
+0x00, 0x00, 0x00, 0x80, 0xD0, 0x60, 0xC0, 0xC0, 0xC0, 0x60,
+0xD0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01,
+0x07, 0x0B, 0x0B, 0x03, 0x0B, 0x0B, 0x07, 0x01, 0x07, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkenemy1Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08200000, 0x04400000,
+0x0FE00000, 0x1BB00000, 0x3FF80000, 0x2FE80000, 0x28280000, 0x06C00000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData imageEnemy1 = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acenemy1Bmp,
+(uint8_t*)_pgenemy1Bmp, //page major data
+(uint32_t*)_mkenemy1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -23,11 +23,32 @@ static const uint8_t _acimgDrone1Bmp[] =
 0xFE, 0x0F, 0x18, 0xF0, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDrone1Bmp[] =
+{
+0x00, 0x40, 0x60, 0x60, 0xF0, 0xD8, 0xFC, 0xFC, 0x7E, 0x7E,
+0x56, 0xF2, 0xF2, 0x56, 0x7E, 0x7E, 0xFC, 0xFC, 0xD8, 0xF0,
+0x60, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDrone1Bmp[] =
+{
+0x00000000, 0x00FF0000, 0x03E7C000, 0x07C3E000, 0x0FFFF000, 0x3BDBDC00,
+0x7FFFFE00, 0x0F18F000, 0x04002000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDrone1Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDrone1Bmp,
+(uint8_t*)_pgimgDrone1Bmp, //page major data
+(uint32_t*)_mkimgDrone1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
@@ -23,11 +23,32 @@ static const uint8_t _acimgDroneExp1Bmp[] =
 0xEE, 0x0F, 0x18, 0xF0, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneExp1Bmp[] =
+{
+0x00, 0x40, 0x64, 0x60, 0xF2, 0xD8, 0xFC, 0xCE, 0x00, 0x10,
+0x56, 0xF2, 0xF2, 0x56, 0x7E, 0x7E, 0xE4, 0xC0, 0xC0, 0x82,
+0x44, 0x60, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneExp1Bmp[] =
+{
+0x00000000, 0x093F1000, 0x23278A00, 0x07030000, 0x0E7F0000, 0x3A1B8400,
+0x7F3FEE00, 0x0F18F000, 0x04002000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneExp1Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneExp1Bmp,
+(uint8_t*)_pgimgDroneExp1Bmp, //page major data
+(uint32_t*)_mkimgDroneExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
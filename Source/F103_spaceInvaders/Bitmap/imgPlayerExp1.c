@@ -23,11 +23,32 @@ static const uint8_t _acimgPlayerExp1Bmp[] =
 0xC0, 0x3F, 0xFF, 0xCC, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp1Bmp[] =
+{
+0x04, 0x04, 0x8C, 0x88, 0xD8, 0xC0, 0xE0, 0x80, 0x80, 0x80,
+0xF0, 0xD8, 0xF8, 0xF0, 0xE0, 0xE0, 0xF8, 0xEC, 0x04, 0x04,
+0x84, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp1Bmp[] =
+{
+0x00000000, 0x00000000, 0xE0007800, 0x3818C000, 0x083C8000, 0x022FC000,
+0x0E3FC000, 0x3FFFCC00, 0x7FFFFE00, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp1Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp1Bmp,
+(uint8_t*)_pgimgPlayerExp1Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
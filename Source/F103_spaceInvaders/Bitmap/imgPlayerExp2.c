@@ -23,11 +23,32 @@ static const uint8_t _acimgPlayerExp2Bmp[] =
 0x00, 0x3F, 0xDB, 0xCC, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp2Bmp[] =
+{
+0x04, 0x05, 0x8C, 0x88, 0xD8, 0xC1, 0xE0, 0x88, 0x80, 0x80,
+0x00, 0x91, 0xA8, 0x70, 0xA2, 0xC0, 0xB8, 0xAC, 0x00, 0x04,
+0x84, 0x80, 0x11, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp2Bmp[] =
+{
+0x44100300, 0x00020000, 0xE0005800, 0x3908C000, 0x08148200, 0x020EC000,
+0x0E050000, 0x3FDBCC00, 0x7FFFFE00, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp2Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp2Bmp,
+(uint8_t*)_pgimgPlayerExp2Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -23,11 +23,32 @@ static const uint8_t _acimgPlayerExp3Bmp[] =
 0x00, 0x29, 0x10, 0x00, 0x03, 0x4D, 0x24, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp3Bmp[] =
+{
+0x00, 0x05, 0x80, 0x00, 0xD0, 0x41, 0x20, 0x88, 0x00, 0x00,
+0x00, 0x91, 0x08, 0x40, 0x22, 0x40, 0x10, 0x24, 0x00, 0x04,
+0x04, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp3Bmp[] =
+{
+0x44100300, 0x00020000, 0x40005800, 0x01080000, 0x08108200, 0x02024000,
+0x0C050000, 0x29100000, 0x034D2400, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp3Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp3Bmp,
+(uint8_t*)_pgimgPlayerExp3Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////
+//Font atlas - widths and column data for each char
+//of font_table.  See font_atlas.h
+//
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "font_table.h"
+#include "font_atlas.h"
+
+//font_table starts with 4 arrows, ' ' is entry 4
+#define GLYPH(letter, offset)	{8 - (offset), &font_table[((letter) - 28) << 3]}
+
+
+const FontGlyph font_atlas[] =
+{
+	GLYPH(32, 4),		// ' '
+	GLYPH(33, 3),		// '!'
+	GLYPH(34, 2),		// '"'
+	GLYPH(35, 1),		// '#'
+	GLYPH(36, 2),		// '$'
+	GLYPH(37, 1),		// '%'
+	GLYPH(38, 1),		// '&'
+	GLYPH(39, 5),		// '''
+	GLYPH(40, 3),		// '('
+	GLYPH(41, 3),		// ')'
+	GLYPH(42, 0),		// '*'
+	GLYPH(43, 2),		// '+'
+	GLYPH(44, 4),		// ','
+	GLYPH(45, 2),		// '-'
+	GLYPH(46, 4),		// '.'
+	GLYPH(47, 1),		// '/'
+	GLYPH(48, 1),		// '0'
+	GLYPH(49, 2),		// '1'
+	GLYPH(50, 2),		// '2'
+	GLYPH(51, 2),		// '3'
+	GLYPH(52, 1),		// '4'
+	GLYPH(53, 2),		// '5'
+	GLYPH(54, 2),		// '6'
+	GLYPH(55, 2),		// '7'
+	GLYPH(56, 2),		// '8'
+	GLYPH(57, 2),		// '9'
+	GLYPH(58, 4),		// ':'
+	GLYPH(59, 4),		// ';'
+	GLYPH(60, 3),		// '<'
+	GLYPH(61, 2),		// '='
+	GLYPH(62, 2),		// '>'
+	GLYPH(63, 2),		// '?'
+	GLYPH(64, 1),		// '@'
+	GLYPH(65, 2),		// 'A'
+	GLYPH(66, 1),		// 'B'
+	GLYPH(67, 1),		// 'C'
+	GLYPH(68, 1),		// 'D'
+	GLYPH(69, 1),		// 'E'
+	GLYPH(70, 1),		// 'F'
+	GLYPH(71, 1),		// 'G'
+	GLYPH(72, 2),		// 'H'
+	GLYPH(73, 3),		// 'I'
+	GLYPH(74, 1),		// 'J'
+	GLYPH(75, 1),		// 'K'
+	GLYPH(76, 1),		// 'L'
+	GLYPH(77, 1),		// 'M'
+	GLYPH(78, 1),		// 'N'
+	GLYPH(79, 1),		// 'O'
+	GLYPH(80, 1),		// 'P'
+	GLYPH(81, 2),		// 'Q'
+	GLYPH(82, 1),		// 'R'
+	GLYPH(83, 2),		// 'S'
+	GLYPH(84, 2),		// 'T'
+	GLYPH(85, 2),		// 'U'
+	GLYPH(86, 2),		// 'V'
+	GLYPH(87, 1),		// 'W'
+	GLYPH(88, 1),		// 'X'
+	GLYPH(89, 2),		// 'Y'
+	GLYPH(90, 1),		// 'Z'
+	GLYPH(91, 3),		// '['
+	GLYPH(92, 1),		// '\'
+	GLYPH(93, 3),		// ']'
+	GLYPH(94, 1),		// '^'
+	GLYPH(95, 0),		// '_'
+	GLYPH(96, 3),		// '`'
+	GLYPH(97, 1),		// 'a'
+	GLYPH(98, 1),		// 'b'
+	GLYPH(99, 2),		// 'c'
+	GLYPH(100, 1),		// 'd'
+	GLYPH(101, 2),		// 'e'
+	GLYPH(102, 2),		// 'f'
+	GLYPH(103, 1),		// 'g'
+	GLYPH(104, 1),		// 'h'
+	GLYPH(105, 3),		// 'i'
+	GLYPH(106, 2),		// 'j'
+	GLYPH(107, 1),		// 'k'
+	GLYPH(108, 3),		// 'l'
+	GLYPH(109, 1),		// 'm'
+	GLYPH(110, 2),		// 'n'
+	GLYPH(111, 2),		// 'o'
+	GLYPH(112, 1),		// 'p'
+	GLYPH(113, 1),		// 'q'
+	GLYPH(114, 1),		// 'r'
+	GLYPH(115, 2),		// 's'
+	GLYPH(116, 2),		// 't'
+	GLYPH(117, 1),		// 'u'
+	GLYPH(118, 2),		// 'v'
+	GLYPH(119, 1),		// 'w'
+	GLYPH(120, 1),		// 'x'
+	GLYPH(121, 2),		// 'y'
+	GLYPH(122, 2),		// 'z'
+	GLYPH(123, 2),		// '{'
+	GLYPH(124, 3),		// '|'
+	GLYPH(125, 2),		// '}'
+	GLYPH(126, 1),		// '~'
+};
+
+
+////////////////////////////////////////////
+//Glyph for letter, chars outside the table
+//are drawn as ' '
+const FontGlyph* FontAtlas_GetGlyph(uint8_t letter)
+{
+	if ((letter < FONT_ATLAS_FIRST_CHAR) || (letter > FONT_ATLAS_LAST_CHAR))
+		letter = FONT_ATLAS_FIRST_CHAR;
+
+	return &font_atlas[letter - FONT_ATLAS_FIRST_CHAR];
+}
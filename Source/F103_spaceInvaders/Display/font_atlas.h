@@ -0,0 +1,30 @@
+/*
+ * Font atlas for the 5 x 8 font table
+ * One entry per char from ' ' (32) to '~' (126),
+ * width of the char (8 - offset) and the char
+ * columns in font_table.  Made from font_table and
+ * offset so text drawing does not work them out
+ * per char.
+ *
+ */
+
+#ifndef __FONT_ATLAS_H
+#define __FONT_ATLAS_H
+
+#include <stdint.h>
+
+#define FONT_ATLAS_FIRST_CHAR		32
+#define FONT_ATLAS_LAST_CHAR		126
+#define FONT_ATLAS_HEIGHT			8
+
+typedef struct
+{
+	uint8_t width;					//columns with pixels
+	const uint8_t* pColumns;		//page bytes, LSB top
+}FontGlyph;
+
+extern const FontGlyph font_atlas[];
+
+const FontGlyph* FontAtlas_GetGlyph(uint8_t letter);
+
+#endif
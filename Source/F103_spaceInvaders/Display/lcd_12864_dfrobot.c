@@ -46,14 +46,67 @@ pixels aligned LSB top, MSB bottom of page
 
 #include "lcd_12864_dfrobot.h"
 #include "font_table.h"			//fonts
-#include "offset.h"				//offsets for font table
+#include "font_atlas.h"			//char widths and columns
 #include "bitmap.h"				//ImageData data type
 
 
 ////////////////////////////////////////////////////////
 //Graphics Buffers
-uint8_t frameBuffer[FRAME_BUFFER_SIZE];
-uint8_t workingBuffer[FRAME_BUFFER_SIZE];
+uint8_t frameBuffer[FRAME_BUFFER_SIZE] __attribute__((aligned(4)));
+
+////////////////////////////////////////////////////////
+//Shadow of the panel memory - what the display holds
+//once the last update is sent.  Direct writes to the
+//panel keep it in step, or invalidate it.
+static uint8_t mShadowBuffer[FRAME_BUFFER_SIZE] __attribute__((aligned(4)));
+static uint8_t mShadowValid = 0x00;
+static LCD_UpdateStats mUpdateStats;
+static LCD_FrameStats mFrameStats;
+static uint32_t mPresentStart = 0x00;
+static uint32_t mPresentEnd = 0x00;
+static uint32_t mTransferStart = 0x00;
+
+//backlight level and ramp, Q8.  The tick only
+//runs the ramp while mRampTicks is set, so the
+//setters write it last.
+static volatile int32_t mBacklightLevel = 0x00;
+static volatile int32_t mBacklightStep = 0x00;
+static volatile int32_t mBacklightTarget = 0x00;
+static volatile uint16_t mRampTicks = 0x00;
+static volatile uint8_t mFlashCount = 0x00;
+static uint8_t mFlashLevel = 0x00;
+static uint16_t mFlashTicks = 0x00;
+static uint8_t mBacklightOnLevel = LCD_BACKLIGHT_MAX;
+
+typedef struct
+{
+	uint8_t start;			//first column
+	uint8_t end;			//last column
+}LCD_Span;
+
+//damaged columns per page, clean if first > last
+static uint8_t mDamageFirst[LCD_NUM_PAGE];
+static uint8_t mDamageLast[LCD_NUM_PAGE];
+static uint8_t mBatchDepth = 0x00;
+
+//display start line - frameBuffer row y is held in
+//panel RAM row (y + mStartLine) % 64, the shadow
+//holds the panel RAM as it is
+static uint8_t mStartLine = 0x00;
+
+static void LCD_Push(const uint8_t* buffer, const uint8_t* first, const uint8_t* last);
+static uint8_t LCD_DiffPage(const uint8_t* page, const uint8_t* shadow, uint8_t firstCol, uint8_t lastCol, LCD_Span* spans);
+static void LCD_ClearDamage(void);
+static void LCD_MarkDamage(uint8_t page, uint8_t first, uint8_t last);
+static void LCD_DamageAll(void);
+static void LCD_RequestFlush(void);
+static uint32_t LCD_GetCycles(void);
+static void LCD_BacklightConfig(void);
+static void LCD_BacklightWrite(int32_t level);
+static void LCD_StartRamp(uint8_t level, uint16_t ticks);
+static const uint8_t* LCD_GetRamPage(const uint8_t* buffer, uint8_t ramPage, uint8_t* temp);
+static void LCD_ShiftColumns(int dx, uint8_t wrap);
+static void LCD_ShiftRows(int dy, uint8_t wrap);
 
 
 static void LCD_DummyDelay(uint32_t count)
@@ -108,7 +161,7 @@ void LCD_Config(void)
 {
 
 	//set initial states for backlight, CD, reset,
-	HAL_GPIO_WritePin(LCD_Backlight_GPIO_Port, LCD_Backlight_Pin, GPIO_PIN_RESET);
+	LCD_BacklightConfig();
 	HAL_GPIO_WritePin(LCD_CMD_GPIO_Port, LCD_CMD_Pin, GPIO_PIN_RESET);
 	HAL_GPIO_WritePin(LCD_Reset_GPIO_Port, LCD_Reset_Pin, GPIO_PIN_RESET);
 	LCD_DummyDelay(100000);
@@ -150,6 +203,19 @@ void LCD_Config(void)
 	LCD_DummyDelay(100000);
 	LCD_WriteCommand(0xA4);				//normal display
 
+	memset(&mUpdateStats, 0x00, sizeof(mUpdateStats));
+	memset(&mFrameStats, 0x00, sizeof(mFrameStats));
+
+#ifdef LCD_PROFILE_CYCLES
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+	mPresentStart = mPresentEnd = LCD_GetCycles();
+	mBatchDepth = 0x00;
+	mStartLine = 0x00;			//0x40 above
+	mShadowValid = 0x00;		//panel contents unknown
+
 	LCD_Clear(0x00);
 	LCD_On();
 
@@ -165,19 +231,161 @@ void LCD_Reset(void)
 }
 
 
+////////////////////////////////////////////////////////
+//Backlight on / off - full on is the on level, set
+//with LCD_SetBacklight
 void LCD_BacklightOn(void)
 {
-	HAL_GPIO_WritePin(LCD_Backlight_GPIO_Port, LCD_Backlight_Pin, GPIO_PIN_SET);
+	LCD_SetBacklight(mBacklightOnLevel);
 }
 
 void LCD_BacklightOff(void)
 {
-	HAL_GPIO_WritePin(LCD_Backlight_GPIO_Port, LCD_Backlight_Pin, GPIO_PIN_RESET);
+	LCD_StartRamp(0, 0);
 }
 
 void LCD_BacklightToggle(void)
 {
-	HAL_GPIO_TogglePin(LCD_Backlight_GPIO_Port, LCD_Backlight_Pin);
+	if (mBacklightLevel > 0)
+		LCD_BacklightOff();
+	else
+		LCD_BacklightOn();
+}
+
+////////////////////////////////////////////////////////
+//Set the backlight level, 0 - 255.  Stops any ramp
+//or flash, nonzero levels are also the new on level.
+void LCD_SetBacklight(uint8_t level)
+{
+	if (level)
+		mBacklightOnLevel = level;
+
+	LCD_StartRamp(level, 0);
+}
+
+uint8_t LCD_GetBacklight(void)
+{
+	return (uint8_t)(mBacklightLevel >> 8);
+}
+
+////////////////////////////////////////////////////////
+//Ramp from the current level to level over ms.
+//Returns right away, the timer runs the ramp.
+void LCD_FadeBacklight(uint8_t level, uint16_t ms)
+{
+	if (level)
+		mBacklightOnLevel = level;
+
+	LCD_StartRamp(level, ms);
+}
+
+////////////////////////////////////////////////////////
+//Flash the backlight count times - ramp down to 0 and
+//back to the current level, periodMs per flash.
+//Returns right away, the timer runs the flash.
+void LCD_FlashBacklight(uint8_t count, uint16_t periodMs)
+{
+	if (!count)
+		return;
+
+	mFlashCount = 0x00;
+	mFlashLevel = (mBacklightLevel > 0) ? LCD_GetBacklight() : mBacklightOnLevel;
+	mFlashTicks = (periodMs >> 1) ? (periodMs >> 1) : 1;
+
+	//down first, then the tick alternates
+	LCD_StartRamp(0, mFlashTicks);
+	mFlashCount = (count << 1) - 1;
+}
+
+////////////////////////////////////////////////////////
+//Backlight tick - call at 1khz from the TIM1 period
+//elapsed callback.  Steps the ramp, starts the next
+//half of a flash when a ramp ends.
+void LCD_BacklightTick(void)
+{
+	if (!mRampTicks)
+		return;
+
+	mRampTicks--;
+
+	//last step lands on the target
+	if (mRampTicks)
+		mBacklightLevel += mBacklightStep;
+	else
+		mBacklightLevel = mBacklightTarget;
+
+	LCD_BacklightWrite(mBacklightLevel);
+
+	if ((!mRampTicks) && (mFlashCount))
+	{
+		mFlashCount--;
+		uint8_t level = (mFlashCount & 0x01) ? 0 : mFlashLevel;
+
+		mBacklightTarget = (int32_t)level << 8;
+		mBacklightStep = (mBacklightTarget - mBacklightLevel) / mFlashTicks;
+		mRampTicks = mFlashTicks;
+	}
+}
+
+////////////////////////////////////////////////////////
+//Start a ramp to level over ticks ms, ticks = 0 sets
+//the level now.  Cancels a flash.
+static void LCD_StartRamp(uint8_t level, uint16_t ticks)
+{
+	int32_t target = (int32_t)level << 8;
+
+	mRampTicks = 0x00;
+	mFlashCount = 0x00;
+
+	if (!ticks)
+	{
+		mBacklightLevel = target;
+		LCD_BacklightWrite(target);
+		return;
+	}
+
+	mBacklightTarget = target;
+	mBacklightStep = (target - mBacklightLevel) / ticks;
+	mRampTicks = ticks;
+}
+
+////////////////////////////////////////////////////////
+//Q8 level to compare value, period is read from the
+//timer so the HAL tick setup can change
+static void LCD_BacklightWrite(int32_t level)
+{
+	uint32_t period = TIM1->ARR + 1;
+
+	if (level < 0)
+		level = 0;
+	if (level > (LCD_BACKLIGHT_MAX << 8))
+		level = LCD_BACKLIGHT_MAX << 8;
+
+	TIM1->CCR1 = (period * (uint32_t)level) / (LCD_BACKLIGHT_MAX << 8);
+}
+
+////////////////////////////////////////////////////////
+//Backlight pin to TIM1 CH1, PWM mode 1 on the HAL
+//tick timer.  Backlight off.
+static void LCD_BacklightConfig(void)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+
+	mRampTicks = 0x00;
+	mFlashCount = 0x00;
+	mBacklightLevel = 0x00;
+
+	TIM1->CCR1 = 0x00;
+	TIM1->CCMR1 = (TIM1->CCMR1 & ~(TIM_CCMR1_OC1M | TIM_CCMR1_CC1S)) |
+			TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;
+	TIM1->CCER = (TIM1->CCER & ~TIM_CCER_CC1P) | TIM_CCER_CC1E;
+	TIM1->BDTR |= TIM_BDTR_MOE;				//advanced timer main output
+
+	GPIO_InitStruct.Pin = LCD_Backlight_Pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(LCD_Backlight_GPIO_Port, &GPIO_InitStruct);			//TIM1_CH1, no remap
 }
 
 
@@ -251,32 +459,36 @@ void LCD_SetContrast(uint8_t contrast)
 //Configure the address of COM0 - initial 
 //starting point of display data
 //0x40 | start line, where start line = 0 to 63
+//frameBuffer row 0 stays at the top of the screen,
+//the next flush moves the panel RAM to match.  Use
+//LCD_DisplayShift to scroll.
 void LCD_SetDisplayStartLine(uint8_t line)
 {
 	if (line < 64)
 	{
 		uint8_t value = 0x40 | line;
 		LCD_WriteCommand(value);
+
+		mStartLine = line;
+		LCD_DamageAll();
 	}
 }
 
+uint8_t LCD_GetDisplayStartLine(void)
+{
+	return mStartLine;
+}
+
+
 
 //////////////////////////////////////////////////
 //Clear LCD with a value
-//Column auto increments, but pages do not wrap
+//Clears the frameBuffer and sends it as page bursts
 //
 void LCD_Clear(uint8_t data)
 {
 	LCD_ClearMemory(frameBuffer, data);
-
-	for (int i = 0 ; i < LCD_NUM_PAGE ; i++)
-	{
-		LCD_SetPage(i);			//increment the page
-		LCD_SetColumn(0);		//reset the column
-
-		for (int j = 0 ; j < LCD_NUM_COL ; j++)
-			LCD_WriteData(data);		//write data, address should auto increment
-	}
+	LCD_Update(frameBuffer);
 }
 
 
@@ -286,24 +498,25 @@ void LCD_Clear(uint8_t data)
 //width - number of pixels long
 //Loffset - offset from LCD start edge
 //value - value to write
-//Also clears the page / offset in the frameBuffer
+//Clears the page / offset in the frameBuffer and
+//flushes it
 //
 void LCD_ClearPage(uint8_t page, uint8_t width, uint8_t Loffset, uint8_t value)
 {
 	if (page < LCD_NUM_PAGE)
 	{
-		if ((width + Loffset) <= LCD_NUM_COL)
+		if ((width > 0) && ((width + Loffset) <= LCD_NUM_COL))
 		{
-			LCD_SetColumn(Loffset);		//reset to offset
-			LCD_SetPage(page);			//set the page
-
 			uint16_t element = (page * LCD_WIDTH) + Loffset;
 
-			for (int i = 0 ; i < width ; i++)
-			{
-				frameBuffer[element + i] = value;		//update framebuffer
-				LCD_WriteData(value);					//update display data
-			}
+			memset(frameBuffer + element, value, width);		//update framebuffer
+
+			if (Loffset < mDamageFirst[page])
+				mDamageFirst[page] = Loffset;
+			if ((Loffset + width - 1) > mDamageLast[page])
+				mDamageLast[page] = Loffset + width - 1;
+
+			LCD_RequestFlush();
 		}
 	}	
 }
@@ -313,29 +526,310 @@ void LCD_ClearPage(uint8_t page, uint8_t width, uint8_t Loffset, uint8_t value)
 void LCD_ClearMemory(uint8_t* buffer, uint8_t data)
 {
 	memset(buffer, data, FRAME_BUFFER_SIZE);
+
+	if (buffer == frameBuffer)
+		LCD_DamageAll();
 }
 
 ////////////////////////////////////////////////////////
-//Update the LCD with the contents of gFrameBuffer1
-//NOTE: LCD does not wrap from one page to the next!!
+//Update the LCD with the contents of buffer.
+//Diffs every page against the shadow.
 //
 void LCD_Update(uint8_t* buffer)
 {
-	uint8_t* ptr = buffer;
-	
-	//write data
+	uint8_t first[LCD_NUM_PAGE];
+	uint8_t last[LCD_NUM_PAGE];
+
+	memset(first, 0x00, LCD_NUM_PAGE);
+	memset(last, LCD_NUM_COL - 1, LCD_NUM_PAGE);
+
+	LCD_Push(buffer, first, last);
+
+	//frameBuffer is on the panel now, anything
+	//else leaves frameBuffer out of step with it
+	if (buffer == frameBuffer)
+		LCD_ClearDamage();
+	else
+		LCD_DamageAll();
+}
+
+////////////////////////////////////////////////////////
+//Send the damaged part of frameBuffer
+void LCD_Flush(void)
+{
+	LCD_Push(frameBuffer, mDamageFirst, mDamageLast);
+	LCD_ClearDamage();
+}
+
+////////////////////////////////////////////////////////
+//Batch drawing - primitives drawn with update = 1
+//between begin and end are sent with one flush at
+//the end.  Batches can nest.
+void LCD_BeginBatch(void)
+{
+	mBatchDepth++;
+}
+
+void LCD_EndBatch(void)
+{
+	if (mBatchDepth > 0)
+	{
+		mBatchDepth--;
+
+		if (!mBatchDepth)
+			LCD_Flush();
+	}
+}
+
+static void LCD_RequestFlush(void)
+{
+	if (!mBatchDepth)
+		LCD_Flush();
+}
+
+static void LCD_ClearDamage(void)
+{
+	memset(mDamageFirst, LCD_NUM_COL, LCD_NUM_PAGE);
+	memset(mDamageLast, 0x00, LCD_NUM_PAGE);
+}
+
+static void LCD_MarkDamage(uint8_t page, uint8_t first, uint8_t last)
+{
+	if (first < mDamageFirst[page])
+		mDamageFirst[page] = first;
+	if (last > mDamageLast[page])
+		mDamageLast[page] = last;
+}
+
+static void LCD_DamageAll(void)
+{
+	memset(mDamageFirst, 0x00, LCD_NUM_PAGE);
+	memset(mDamageLast, LCD_NUM_COL - 1, LCD_NUM_PAGE);
+}
+
+
+////////////////////////////////////////////////////////
+//Push columns first to last of each page of buffer.
+//Only the column spans that differ from the shadow
+//are sent.
+//NOTE: LCD does not wrap from one page to the next!!
+//Each span gets its own page / column address.
+//
+static void LCD_Push(const uint8_t* buffer, const uint8_t* first, const uint8_t* last)
+{
+	LCD_Span spans[LCD_MAX_SPANS_PER_PAGE];
+	uint8_t temp[LCD_NUM_COL] __attribute__((aligned(4)));
+	uint32_t bytes = 0x00;
+	uint32_t numSpans = 0x00;
+
+	mTransferStart = LCD_GetCycles();
+
 	for (int i = 0 ; i < LCD_NUM_PAGE ; i++)
 	{
-		LCD_SetColumn(0x00);
-		LCD_SetPage(i);
+		uint8_t* shadow = mShadowBuffer + (i * LCD_NUM_COL);
+		uint8_t firstCol = first[i];
+		uint8_t lastCol = last[i];
+		uint8_t n = 1;
+
+		//panel RAM page i holds two buffer pages when
+		//the start line is not a multiple of 8
+		if (mStartLine)
+		{
+			uint8_t a = (i - (mStartLine >> 3) - 1) & (LCD_NUM_PAGE - 1);
+			uint8_t b = (a + 1) & (LCD_NUM_PAGE - 1);
+
+			firstCol = first[b];
+			lastCol = last[b];
+
+			if (mStartLine & 0x07)
+			{
+				firstCol = (first[a] < firstCol) ? first[a] : firstCol;
+				lastCol = (last[a] > lastCol) ? last[a] : lastCol;
+			}
+		}
+
+		if ((mShadowValid) && (firstCol > lastCol))
+			continue;
+
+		const uint8_t* page = LCD_GetRamPage(buffer, i, temp);
 
-		ptr = buffer + (i * LCD_NUM_COL);		
-		LCD_WriteDataBurst(ptr, LCD_NUM_COL);
+		spans[0].start = 0;
+		spans[0].end = LCD_NUM_COL - 1;
+
+		if (mShadowValid)
+			n = LCD_DiffPage(page, shadow, firstCol, lastCol, spans);
+
+		for (int j = 0 ; j < n ; j++)
+		{
+			uint8_t length = spans[j].end - spans[j].start + 1;
+
+			memcpy(shadow + spans[j].start, page + spans[j].start, length);
+
+			LCD_SetColumn(spans[j].start);
+			LCD_SetPage(i);
+			LCD_WriteDataBurst(shadow + spans[j].start, length);
+
+			bytes += LCD_ADDRESS_BYTES + length;
+			numSpans++;
+		}
 	}
 
+	mShadowValid = 1;
+
+	mUpdateStats.lastBytes = bytes;
+	mUpdateStats.lastSpans = numSpans;
+	mUpdateStats.totalBytes += bytes;
+	mUpdateStats.numUpdates++;
+
+	mFrameStats.transferCycles = LCD_GetCycles() - mTransferStart;
 }
 
 
+////////////////////////////////////////////////////////
+//Panel RAM page ramPage as it should be for buffer at
+//the current start line.  Returns the buffer page
+//itself for start lines that are a multiple of 8,
+//otherwise builds the page in temp.
+//
+static const uint8_t* LCD_GetRamPage(const uint8_t* buffer, uint8_t ramPage, uint8_t* temp)
+{
+	uint8_t shift = mStartLine & 0x07;
+	uint8_t b = (ramPage - (mStartLine >> 3)) & (LCD_NUM_PAGE - 1);
+	const uint8_t* pageB = buffer + (b * LCD_NUM_COL);
+
+	if (!shift)
+		return pageB;
+
+	//rows above come from the bottom of the page before
+	const uint8_t* pageA = buffer + (((b - 1) & (LCD_NUM_PAGE - 1)) * LCD_NUM_COL);
+
+	for (int i = 0 ; i < LCD_NUM_COL ; i++)
+		temp[i] = (pageA[i] >> (8 - shift)) | (pageB[i] << shift);
+
+	return temp;
+}
+
+
+////////////////////////////////////////////////////////
+//Diff columns first to last of one page against the
+//shadow.  Compares a word at a time from each end to
+//find the first and last changed column (the words
+//holding first and last are compared whole, any
+//difference there still has to be sent), then
+//splits that range at unchanged
+//gaps longer than LCD_SPAN_COST_BYTES - sending a gap
+//that short is cheaper than a new address.
+//Returns the number of spans, 0 if nothing changed.
+//
+static uint8_t LCD_DiffPage(const uint8_t* page, const uint8_t* shadow, uint8_t firstCol, uint8_t lastCol, LCD_Span* spans)
+{
+	const uint32_t* page32 = (const uint32_t*)page;
+	const uint32_t* shadow32 = (const uint32_t*)shadow;
+	int first = firstCol >> 2;
+	int last = lastCol >> 2;
+
+	while ((first <= last) && (page32[first] == shadow32[first]))
+		first++;
+
+	if (first > last)
+		return 0;
+
+	while (page32[last] == shadow32[last])
+		last--;
+
+	//down to the byte
+	int start = first * 4;
+	int end = (last * 4) + 3;
+
+	while (page[start] == shadow[start])
+		start++;
+	while (page[end] == shadow[end])
+		end--;
+
+	uint8_t count = 0x00;
+	int gap = 0;
+
+	spans[0].start = start;
+
+	for (int col = start ; col <= end ; col++)
+	{
+		if (page[col] == shadow[col])
+		{
+			gap++;
+			continue;
+		}
+
+		if ((gap > LCD_SPAN_COST_BYTES) && (count < (LCD_MAX_SPANS_PER_PAGE - 1)))
+		{
+			spans[count].end = col - gap - 1;
+			count++;
+			spans[count].start = col;
+		}
+
+		gap = 0;
+	}
+
+	spans[count].end = end;
+
+	return count + 1;
+}
+
+
+////////////////////////////////////////////////////////
+//Force the next update to send every page - use
+//after writing the panel outside of the driver
+void LCD_InvalidateShadow(void)
+{
+	mShadowValid = 0x00;
+}
+
+void LCD_GetUpdateStats(LCD_UpdateStats* stats)
+{
+	*stats = mUpdateStats;
+}
+
+
+////////////////////////////////////////////////////////
+//Present the frame drawn into frameBuffer.
+//Closes any open batch - draws with update = 1
+//after LCD_BeginBatch() go out here.
+//No DMA on this board - the push is blocking, so a
+//frame is still render + transfer.  Kept so the game
+//loop matches the F411 games.
+//
+void LCD_Present(void)
+{
+	uint32_t start = LCD_GetCycles();
+
+	mFrameStats.renderCycles = start - mPresentEnd;
+	mFrameStats.frameCycles = start - mPresentStart;
+	mPresentStart = start;
+
+	mBatchDepth = 0x00;
+
+	uint32_t ready = start;			//push is blocking
+
+	LCD_Flush();
+
+	mFrameStats.waitCycles = ready - start;
+	mFrameStats.numFrames++;
+	mPresentEnd = LCD_GetCycles();
+}
+
+void LCD_GetFrameStats(LCD_FrameStats* stats)
+{
+	*stats = mFrameStats;
+}
+
+static uint32_t LCD_GetCycles(void)
+{
+#ifdef LCD_PROFILE_CYCLES
+	return DWT->CYCCNT;
+#else
+	return 0x00;
+#endif
+}
+
 
 ////////////////////////////////////////////////////////
 //LCD_DrawCharKern
@@ -345,23 +839,17 @@ void LCD_Update(uint8_t* buffer)
 //y addresses are set in the drawstringkern function
 void LCD_DrawCharKern(uint8_t kern, uint8_t letter)
 {
-	unsigned char line;
-	unsigned int value0;
-	uint8_t width = 0x00;
+	const FontGlyph* glyph = FontAtlas_GetGlyph(letter);
 	int i = 0;
 
-	//get the line based on the letter
-	line = letter - 27;		//ie, for char 32 " ", it's on line 5
-	value0 = (line-1) << 3;
-
-	//now, get the char width as
-	//width = 8 - char offset
-	width = 8 - offset[letter - 32];
+	//writes the panel at the current address,
+	//the shadow can't follow it
+	mShadowValid = 0x00;
 
 	//loop through the width
-	for (i = 0 ; i < width ; i++)
+	for (i = 0 ; i < glyph->width ; i++)
 	{
-		LCD_WriteData(font_table[value0 + i]);
+		LCD_WriteData(glyph->pColumns[i]);
 	}
 
 	//now write the remaining spacing between chars
@@ -375,66 +863,15 @@ void LCD_DrawCharKern(uint8_t kern, uint8_t letter)
 ////////////////////////////////////////////////////////
 //LCD_WriteStringKern
 //implements offset and kern for controlled
-//character spacing.  pass the kern and letter into
-//the helper function for each character
+//character spacing.  Draws the string into the
+//frameBuffer at row and flushes it.
 //start at x = 0, and keep writing until the
 //x coordinate  = 127 - (8 - offset) of that char
 void LCD_DrawStringKern(uint8_t row_initial, uint8_t kern, const char* mystring)
 {
 	uint8_t row = row_initial & 0x07;       //max value of row is 7
-	uint8_t count = 0;
-	uint8_t position = 0;		//running position
-	uint8_t temp = 0;
-
-	unsigned char line;
-	unsigned int value0;
-	uint8_t width = 0x00;
-	int i = 0;
 
-	uint16_t element = 0x00;        //frame buffer element
-	element = row * LCD_WIDTH;
-	
-	//set the x and y start positions
-	LCD_SetPage(row);
-	LCD_SetColumn(0);
-	
-	while ((mystring[count] != '\0') && (position < 127))
-	{
-		LCD_SetColumn(position);
-		temp = 8 - offset[mystring[count] - 32] + kern;
-
-		if ((position + temp) < 127)
-		{
-			//put the contents of the function here, we need
-			//to update the frame buffer
-			//LCD_DrawCharKern(kern, mystring[count]);
-
-			line = mystring[count] - 27;		//ie, for char 32 " ", it's on line 5
-			value0 = (line-1) << 3;
-
-			//char width from offset
-			width = 8 - offset[mystring[count] - 32];
-
-			//loop through the width
-			for (i = 0 ; i < width ; i++)
-			{
-				LCD_WriteData(font_table[value0 + i]);
-				frameBuffer[element] = font_table[value0 + i];
-				element++;
-			}
-			
-			//now write the remaining spacing between chars
-			for (i = 0 ; i < kern ; i++)
-			{
-				LCD_WriteData(0x00);
-				frameBuffer[element] = 0x00;
-				element++;
-			}
-		}
-
-		position += temp;
-		count++;
-	}
+	LCD_DrawText(0, row << 3, kern, mystring, strlen(mystring), 1);
 }
 
 
@@ -445,51 +882,65 @@ void LCD_DrawStringKern(uint8_t row_initial, uint8_t kern, const char* mystring)
 void LCD_DrawStringKernLength(uint8_t row_initial, uint8_t kern, uint8_t* mystring, uint8_t length)
 {
 	uint8_t row = row_initial & 0x07;       //max value of row is 7
-	uint8_t count = 0;
-	uint8_t position = 0;		//running position
-	uint8_t temp = 0;
 
-	unsigned char line;
-	unsigned int value0;
-	uint8_t width = 0x00;
-	int i = 0;
+	LCD_DrawText(0, row << 3, kern, (const char*)mystring, length, 1);
+}
 
-	uint16_t element = 0x00;        //frame buffer element
-	element = row * LCD_WIDTH;
-	
-	//set the x and y start positions
-	LCD_SetPage(row);
-	LCD_SetColumn(0);
 
-	for (count = 0 ; count < length ; count++)
+//////////////////////////////////////////////////////
+//Draw text into the frameBuffer at pixel x, y (top
+//of the chars), any y.  Char widths and columns come
+//from the font atlas, each column byte lands in two
+//pages like LCD_BlitIcon.  The 8 rows under the text,
+//kern included, are cleared.  Stops at the first char
+//that does not fit before column 127.
+//update - flush the damage if 1
+//Returns the x position after the last char.
+//
+uint8_t LCD_DrawText(uint8_t x, uint8_t y, uint8_t kern, const char* text, uint8_t length, uint8_t update)
+{
+	uint8_t shift = y & 0x07;
+	uint8_t page = y >> 3;
+	uint8_t* dst0 = (page < LCD_NUM_PAGE) ? frameBuffer + (page * LCD_WIDTH) : NULL;
+	uint8_t* dst1 = ((shift) && ((page + 1) < LCD_NUM_PAGE)) ? frameBuffer + ((page + 1) * LCD_WIDTH) : NULL;
+	uint8_t mask0 = (uint8_t)(0xFF << shift);
+	uint8_t mask1 = (uint8_t)(0xFF >> (8 - shift));
+	uint8_t start = x;
+
+	if ((!dst0) || (x >= LCD_WIDTH))
+		return x;
+
+	for (uint8_t count = 0 ; count < length ; count++)
 	{
-		LCD_SetColumn(position);
-		temp = 8 - offset[mystring[count] - 32] + kern;
+		const FontGlyph* glyph = FontAtlas_GetGlyph(text[count]);
+		uint8_t advance = glyph->width + kern;
+
+		if ((x + advance) >= 127)
+			break;
 
-		if ((position + temp) < 127)
+		for (uint8_t i = 0 ; i < advance ; i++, x++)
 		{
-			line = mystring[count] - 27;		//ie, for char 32 " ", it's on line 5
-			value0 = (line-1) << 3;
-			width = 8 - offset[mystring[count] - 32];	//width from offset table
+			uint8_t data = (i < glyph->width) ? glyph->pColumns[i] : 0x00;
 
-			for (i = 0 ; i < width ; i++)
-			{
-				LCD_WriteData(font_table[value0 + i]);			//write to LCD directly
-				frameBuffer[element] = font_table[value0 + i];	//update the framebuffer
-				element++;
-			}
-			
-			//write remaining spacing between chars
-			for (i = 0 ; i < kern ; i++)
-			{
-				LCD_WriteData(0x00);
-				frameBuffer[element] = 0x00;
-				element++;
-			}
+			dst0[x] = (dst0[x] & ~mask0) | (uint8_t)(data << shift);
+
+			if (dst1)
+				dst1[x] = (dst1[x] & ~mask1) | (uint8_t)(data >> (8 - shift));
 		}
+	}
 
-		position += temp;			//update current column position with char width
+	if (x > start)
+	{
+		LCD_MarkDamage(page, start, x - 1);
+
+		if (dst1)
+			LCD_MarkDamage(page + 1, start, x - 1);
+
+		if (update == 1)
+			LCD_RequestFlush();
 	}
+
+	return x;
 }
 
 
@@ -502,7 +953,7 @@ void LCD_DrawStringKernLength(uint8_t row_initial, uint8_t kern, uint8_t* mystri
 //write the page / column.
 //color - 0 or 1, uses the least sig bit
 //update - 0 or 1, 0 = no update, just write to RAM
-//                 1 = update display too
+//                 1 = flush the damage to the display
 void LCD_PutPixel(uint16_t x, uint16_t y, uint8_t color, uint8_t update)
 {
 	uint16_t element = 0x00;    //frame buffer element
@@ -536,14 +987,17 @@ void LCD_PutPixel(uint16_t x, uint16_t y, uint8_t color, uint8_t update)
 	//write
 	frameBuffer[element] = elementValue;
 
+	//mark the damage
+	uint8_t page = y >> 3;
+
+	if (x < mDamageFirst[page])
+		mDamageFirst[page] = x;
+	if (x > mDamageLast[page])
+		mDamageLast[page] = x;
+
 	//update
 	if (update > 0)
-	{
-		//update the display
-		LCD_SetColumn(x);
-		LCD_SetPage((y >> 3));
-		LCD_WriteData(elementValue);
-	}
+		LCD_RequestFlush();
 }
 
 
@@ -585,10 +1039,14 @@ uint8_t LCD_ReadPixel(uint16_t x, uint16_t y, uint8_t* buffer)
 
 ////////////////////////////////////////////////////
 //Display Shift.
-//Copies the current instance into working buffer.
-//Shifts the contents of the working buffer back into
-//the framebuffer by dx dy.  LCD is updated with contents
-//of framebuffer if "update" is set to 1.
+//Shifts the contents of the framebuffer by dx dy, in
+//place.  LCD is updated with contents of framebuffer if
+//"update" is set to 1.
+//Horizontal shifts move the columns of each page,
+//vertical shifts move each column as a 64 bit word
+//(the 8 page bytes).  A wrapped vertical only shift
+//with update moves the display start line instead,
+//the panel RAM does not change so nothing is sent.
 //
 //Arguments:
 //dx, dy - offset to shift the display
@@ -597,50 +1055,133 @@ uint8_t LCD_ReadPixel(uint16_t x, uint16_t y, uint8_t* buffer)
 //
 void LCD_DisplayShift(int dx, int dy, uint8_t wrap, uint8_t update)
 {
-	memcpy(workingBuffer, frameBuffer, FRAME_BUFFER_SIZE);
+	if ((wrap == 1) && (update == 1) && (!dx) && (!mBatchDepth))
+	{
+		//anything pending goes out at the old start line
+		LCD_Flush();
+		LCD_ShiftRows(dy, 1);
+
+		//frameBuffer row y moved to y + dy, it is still
+		//in the same panel RAM row
+		uint8_t line = (mStartLine - dy) & (LCD_HEIGHT - 1);
+		LCD_WriteCommand(0x40 | line);
+		mStartLine = line;
+		return;
+	}
+
+	if (dx)
+		LCD_ShiftColumns(dx, wrap);
+	if (dy)
+		LCD_ShiftRows(dy, wrap);
+
+	LCD_DamageAll();
+
+	//finally, update the display
+	if (update == 1)
+		LCD_RequestFlush();
+
+}
+
+////////////////////////////////////////////////////
+//Move the columns of each page by dx, rotate
+//for wrap (3 reversals), else fill with 0
+static void LCD_ShiftColumns(int dx, uint8_t wrap)
+{
+	int n = dx % LCD_WIDTH;
 
-	//i and j range from border to border.
-	for (int i = 0 ; i < LCD_HEIGHT ; i++)
+	if (wrap == 1)
 	{
-		for (int j = 0 ; j < LCD_WIDTH ; j++)
+		if (n < 0)
+			n += LCD_WIDTH;
+
+		if (!n)
+			return;
+
+		for (int p = 0 ; p < LCD_NUM_PAGE ; p++)
 		{
-			//compute the source location for j,i on frame buffer
-			int prevX = j - dx;
-			int prevY = i - dy;
+			uint8_t* page = frameBuffer + (p * LCD_WIDTH);
+			int ranges[3][2] = {{0, LCD_WIDTH - 1}, {0, n - 1}, {n, LCD_WIDTH - 1}};
 
-			if (wrap == 1)
+			for (int r = 0 ; r < 3 ; r++)
 			{
-				//test the range, less than zero, wrap back,
-				//greater than size, roll over
-				if (prevX < 0)
-				prevX = prevX + LCD_WIDTH;
-				if (prevX > LCD_WIDTH - 1)
-				prevX = prevX - LCD_WIDTH;
-				
-				if (prevY < 0)
-				prevY = prevY + LCD_HEIGHT;
-				if (prevY > LCD_HEIGHT - 1)
-				prevY = prevY - LCD_HEIGHT;
+				for (int i = ranges[r][0], j = ranges[r][1] ; i < j ; i++, j--)
+				{
+					uint8_t temp = page[i];
+					page[i] = page[j];
+					page[j] = temp;
+				}
 			}
+		}
+		return;
+	}
+
+	if ((dx >= LCD_WIDTH) || (dx <= -LCD_WIDTH))
+	{
+		memset(frameBuffer, 0x00, FRAME_BUFFER_SIZE);
+		return;
+	}
+
+	for (int p = 0 ; p < LCD_NUM_PAGE ; p++)
+	{
+		uint8_t* page = frameBuffer + (p * LCD_WIDTH);
 
-			//write prevX and prevY into j,i
-			uint8_t pixelValue = LCD_ReadPixel(prevX, prevY, workingBuffer);
-			LCD_PutPixel(j, i, pixelValue, 0);
+		if (dx > 0)
+		{
+			memmove(page + dx, page, LCD_WIDTH - dx);
+			memset(page, 0x00, dx);
+		}
+		else
+		{
+			memmove(page, page - dx, LCD_WIDTH + dx);
+			memset(page + LCD_WIDTH + dx, 0x00, -dx);
 		}
 	}
+}
 
-	//finally, update the display
-	if (update == 1)
+////////////////////////////////////////////////////
+//Move each column down by dy rows.  Page 0 is the
+//low byte of the column word, LSB on top.
+static void LCD_ShiftRows(int dy, uint8_t wrap)
+{
+	int n = dy % LCD_HEIGHT;
+
+	if (wrap == 1)
 	{
-		LCD_Update(frameBuffer);
+		if (n < 0)
+			n += LCD_HEIGHT;
 	}
+	else if ((dy >= LCD_HEIGHT) || (dy <= -LCD_HEIGHT))
+	{
+		memset(frameBuffer, 0x00, FRAME_BUFFER_SIZE);
+		return;
+	}
+
+	if (!n)
+		return;
+
+	for (int x = 0 ; x < LCD_WIDTH ; x++)
+	{
+		uint64_t column = 0x00;
+
+		for (int p = 0 ; p < LCD_NUM_PAGE ; p++)
+			column |= (uint64_t)frameBuffer[(p * LCD_WIDTH) + x] << (p << 3);
 
+		if (wrap == 1)
+			column = (column << n) | (column >> (LCD_HEIGHT - n));
+		else if (n > 0)
+			column <<= n;
+		else
+			column >>= -n;
+
+		for (int p = 0 ; p < LCD_NUM_PAGE ; p++)
+			frameBuffer[(p * LCD_WIDTH) + x] = (uint8_t)(column >> (p << 3));
+	}
 }
 
 
 //////////////////////////////////////////////////
-//Draw line on LCD.  Updates framebuffer and the
-//display
+//Draw line on LCD.  Updates framebuffer and
+//flushes it to the display
 void LCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color)
 {
 	int dx = abs(x1-x0), sx = x0<x1 ? 1 : -1;
@@ -649,13 +1190,14 @@ void LCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color)
 
 	for(;;)
 	{
-		//update the display
-		LCD_PutPixel(x0,y0, color, 1);
+		LCD_PutPixel(x0,y0, color, 0);
 		if (x0==x1 && y0==y1) break;
 		e2 = err;
 		if (e2 >-dx) { err -= dy; x0 += sx; }
 		if (e2 < dy) { err += dx; y0 += sy; }
 	}
+
+	LCD_RequestFlush();
 }
 
 
@@ -688,10 +1230,6 @@ void LCD_DrawBitmap(const ImageData *image, uint8_t update)
 	
 	for (i = 0 ; i < 8 ; i++)
 	{
-		//set the page and reset the column
-		LCD_SetPage(i);
-		LCD_SetColumn(0);
-
 		for (j = 0 ; j < 128 ; j++)
 		{
 			//get the element offset in the original
@@ -748,8 +1286,125 @@ void LCD_DrawBitmap(const ImageData *image, uint8_t update)
 		}
 	}
 
+	LCD_DamageAll();
+
 	if (update == 1)
-		LCD_Update(frameBuffer);
+		LCD_RequestFlush();
+}
+
+
+///////////////////////////////////////////////////////
+//Blit a page major icon into the frameBuffer.
+//Each column byte of an icon page lands in two
+//frameBuffer pages, shifted down by offsetY % 8.
+//opaque - 0: OR the set pixels in, 1: clear the icon
+//rectangle first (mask and OR)
+//wrap - wrap to the other side / top / bottom, else clip.
+//Offsets are read as signed when clipping, so icons
+//part way off any edge are drawn in part.  With wrap
+//they are reduced to the lcd size first.
+//pImage->pPageData must not be NULL.
+//
+void LCD_BlitIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, uint8_t opaque, uint8_t wrap)
+{
+	const uint8_t* src = pImage->pPageData;
+	int32_t sizeX = pImage->xSize;
+	int32_t sizeY = pImage->ySize;
+	int32_t numPages = (sizeY + 7) >> 3;
+	int32_t x0, y0;
+
+	if (wrap)
+	{
+		x0 = offsetX % LCD_WIDTH;
+		y0 = offsetY % LCD_HEIGHT;
+	}
+	else
+	{
+		x0 = (int32_t)offsetX;
+		y0 = (int32_t)offsetY;
+
+		if ((x0 >= LCD_WIDTH) || (y0 >= LCD_HEIGHT) || ((x0 + sizeX) <= 0) || ((y0 + sizeY) <= 0))
+			return;
+	}
+
+	uint8_t shift = y0 & 0x07;
+	int32_t page = (y0 - shift) / 8;		//floor, -1 for y0 of -8 to -1
+
+	//icon columns drawn and lcd columns written -
+	//wrapped icons damage the full width
+	int32_t colFirst = 0;
+	int32_t colLast = sizeX;
+	uint8_t first, last;
+
+	if (!wrap)
+	{
+		if (x0 < 0)
+			colFirst = -x0;
+		if ((x0 + sizeX) > LCD_WIDTH)
+			colLast = LCD_WIDTH - x0;
+
+		first = x0 + colFirst;
+		last = x0 + colLast - 1;
+	}
+	else if ((x0 + sizeX) <= LCD_WIDTH)
+	{
+		first = x0;
+		last = x0 + sizeX - 1;
+	}
+	else
+	{
+		first = 0;
+		last = LCD_WIDTH - 1;
+	}
+
+	for (int32_t p = 0 ; p < numPages ; p++, page++, src += sizeX)
+	{
+		//rows in this icon page
+		int32_t rows = sizeY - (p << 3);
+		uint16_t mask = ((rows >= 8) ? 0xFF : ((1 << rows) - 1)) << shift;
+
+		int32_t page0 = wrap ? (page % LCD_NUM_PAGE) : page;
+		int32_t page1 = wrap ? ((page + 1) % LCD_NUM_PAGE) : (page + 1);
+		uint8_t* dst0 = ((page0 >= 0) && (page0 < LCD_NUM_PAGE)) ? frameBuffer + (page0 * LCD_WIDTH) : NULL;
+		uint8_t* dst1 = ((shift) && (page1 >= 0) && (page1 < LCD_NUM_PAGE)) ? frameBuffer + (page1 * LCD_WIDTH) : NULL;
+
+		if ((!dst0) && (!dst1))
+		{
+			//above the top, the next page may be on
+			if (page0 < 0)
+				continue;
+			break;
+		}
+
+		uint32_t x = x0 + colFirst;
+
+		for (int32_t i = colFirst ; i < colLast ; i++, x++)
+		{
+			if (x == LCD_WIDTH)
+				x = 0;
+
+			uint16_t bits = (uint16_t)src[i] << shift;
+
+			if (dst0)
+			{
+				if (opaque)
+					dst0[x] &= ~(uint8_t)mask;
+				dst0[x] |= (uint8_t)bits;
+			}
+
+			if (dst1)
+			{
+				if (opaque)
+					dst1[x] &= ~(uint8_t)(mask >> 8);
+				dst1[x] |= (uint8_t)(bits >> 8);
+			}
+		}
+
+		if (dst0)
+			LCD_MarkDamage(page0, first, last);
+		if (dst1)
+			LCD_MarkDamage(page1, first, last);
+	}
 }
 
 
@@ -759,7 +1414,10 @@ void LCD_DrawBitmap(const ImageData *image, uint8_t update)
 //offsetX and offsetY are x and y offsets from origin
 //
 //NOTE: if update == 0, only draws the black pixels.  Assumes the
-//framebuffer is cleared.
+//framebuffer is cleared.  With update == 1 the icon is flushed
+//once it is drawn, not pixel by pixel.
+//Icons with page major data go through LCD_BlitIcon, others
+//are drawn pixel by pixel.
 //
 void LCD_DrawIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, uint8_t update)
 {
@@ -771,6 +1429,17 @@ void LCD_DrawIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, u
 	uint8_t data = 0x00;
 	uint32_t x = offsetX;
 	uint32_t y = offsetY;
+
+	//page major data - blit column bytes
+	if (pImage->pPageData)
+	{
+		LCD_BlitIcon(offsetX, offsetY, pImage, update, 0);
+
+		if (update == 1)
+			LCD_RequestFlush();
+
+		return;
+	}
 	
 	for (uint32_t i = 0 ; i < sizeY ; i++)
 	{
@@ -788,11 +1457,11 @@ void LCD_DrawIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, u
 				bitValue = (data >> (p-1)) & 0x01;
 
 				if (bitValue == 1)
-					LCD_PutPixel(x, y, 1, update);
+					LCD_PutPixel(x, y, 1, 0);
 				else
 				{
 					if (update == 1)
-						LCD_PutPixel(x, y, 0, update);
+						LCD_PutPixel(x, y, 0, 0);
 				}
 
 				x++;            //increment the x
@@ -802,5 +1471,8 @@ void LCD_DrawIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, u
 		}
 		y++;        //increment the row
 	}
+
+	if (update == 1)
+		LCD_RequestFlush();
 }
 
@@ -45,10 +45,70 @@ SPI: idle clock high, data on trailing edge, MSB first
 #define LCD_NUM_COL				128
 #define FRAME_BUFFER_SIZE		(LCD_HEIGHT * LCD_WIDTH / 8)
 
+//Partial updates - LCD_Update() only sends the column
+//spans that differ from what the panel holds.  A span
+//costs its data plus a page / column address and the
+//transfer setup.  Unchanged gaps that cost less than
+//a new span are sent along with the changed bytes.
+#define LCD_MAX_SPANS_PER_PAGE		4
+#define LCD_ADDRESS_BYTES			3		//page, column high, column low
+#define LCD_SETUP_COST_BYTES		2		//transfer setup, in byte times
+#define LCD_SPAN_COST_BYTES			(LCD_ADDRESS_BYTES + (2 * LCD_SETUP_COST_BYTES))
+
+//Deferred drawing - the pixel primitives only write
+//frameBuffer and mark the damaged columns per page.
+//An update arg of 1 flushes the damage once the
+//primitive is drawn, or at LCD_EndBatch() if a batch
+//is open.  LCD_Flush() only looks at the damage, use
+//LCD_Update(frameBuffer) after writing frameBuffer
+//directly.
+
+
+/////////////////////////////////////////////////////
+//Update stats - bytes sent on the SPI by LCD_Update,
+//commands and data
+typedef struct
+{
+	uint32_t lastBytes;			//last update
+	uint32_t lastSpans;
+	uint32_t totalBytes;		//since LCD_Config
+	uint32_t numUpdates;
+}LCD_UpdateStats;
+
+
+/////////////////////////////////////////////////////
+//Frame stats - LCD_Present() to LCD_Present(), in
+//DWT cycles.  All 0 unless LCD_PROFILE_CYCLES is set.
+//render - game work between presents
+//wait - present waiting on the previous transfer
+//transfer - last frame push on the SPI
+typedef struct
+{
+	uint32_t renderCycles;
+	uint32_t waitCycles;
+	uint32_t transferCycles;
+	uint32_t frameCycles;
+	uint32_t numFrames;
+}LCD_FrameStats;
+
+//uncomment to record the frame stats using the
+//DWT cycle counter, read with LCD_GetFrameStats
+//#define LCD_PROFILE_CYCLES		1
+
+
+/////////////////////////////////////////////////////
+//Backlight - PWM on TIM1 CH1 (PA8).  TIM1 is also the
+//HAL tick timer, 1MHz count and 1khz period, so the
+//PWM runs at 1khz with no software toggling.  Ramps
+//and flashes step from LCD_BacklightTick(), called
+//from the TIM1 period elapsed callback.
+#define LCD_BACKLIGHT_MAX		255
+#define LCD_BACKLIGHT_DIM		51			//20%
+
 
 /////////////////////////////////////////////////////
+//frame buffers are word aligned for the page compare
 extern uint8_t frameBuffer[FRAME_BUFFER_SIZE];
-extern uint8_t workingBuffer[FRAME_BUFFER_SIZE];
 
 void LCD_WriteCommand(uint8_t cmd);
 void LCD_WriteData(uint8_t data);
@@ -59,6 +119,11 @@ void LCD_Reset(void);
 void LCD_BacklightOn(void);
 void LCD_BacklightOff(void);
 void LCD_BacklightToggle(void);
+void LCD_SetBacklight(uint8_t level);
+uint8_t LCD_GetBacklight(void);
+void LCD_FadeBacklight(uint8_t level, uint16_t ms);
+void LCD_FlashBacklight(uint8_t count, uint16_t periodMs);
+void LCD_BacklightTick(void);
 
 //command functions
 void LCD_On(void);
@@ -69,17 +134,26 @@ void LCD_SetColumn(uint8_t col);
 
 void LCD_SetContrast(uint8_t contrast);
 void LCD_SetDisplayStartLine(uint8_t line);
+uint8_t LCD_GetDisplayStartLine(void);
 
 void LCD_Clear(uint8_t data);
 void LCD_ClearPage(uint8_t page, uint8_t width, uint8_t Loffset, uint8_t value);
 
 void LCD_ClearMemory(uint8_t* buffer, uint8_t data);
 void LCD_Update(uint8_t* buffer);
+void LCD_Flush(void);
+void LCD_BeginBatch(void);
+void LCD_EndBatch(void);
+void LCD_InvalidateShadow(void);
+void LCD_GetUpdateStats(LCD_UpdateStats* stats);
+void LCD_Present(void);
+void LCD_GetFrameStats(LCD_FrameStats* stats);
 
 //graphics functions
 void LCD_DrawCharKern(uint8_t kern, uint8_t letter);
 void LCD_DrawStringKern(uint8_t row_initial, uint8_t kern, const char* mystring);
 void LCD_DrawStringKernLength(uint8_t row_initial, uint8_t kern, uint8_t* mystring, uint8_t length);
+uint8_t LCD_DrawText(uint8_t x, uint8_t y, uint8_t kern, const char* text, uint8_t length, uint8_t update);
 
 void LCD_PutPixel(uint16_t x, uint16_t y, uint8_t color, uint8_t update);
 uint8_t LCD_ReadPixel(uint16_t x, uint16_t y, uint8_t* buffer);
@@ -88,6 +162,7 @@ void LCD_DisplayShift(int dx, int dy, uint8_t wrap, uint8_t update);
 void LCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color);
 
 void LCD_DrawBitmap(const ImageData *image, uint8_t update);
+void LCD_BlitIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, uint8_t opaque, uint8_t wrap);
 void LCD_DrawIcon(uint32_t offsetX, uint32_t offsetY, const ImageData *pImage, uint8_t update);
 
 
@@ -347,6 +347,15 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     HAL_IncTick();
   }
 /* USER CODE BEGIN Callback 1 */
+  ////////////////////////////////////////////
+  //Timer TIM1 - HAL tick, 1khz.  Steps the
+  //backlight ramps, the PWM is in hardware, and
+  //decodes the joystick
+  if (htim->Instance == TIM1)
+  {
+	  LCD_BacklightTick();
+	  Joystick_Tick();
+  }
 
   ////////////////////////////////////////////
   //Timer TIM2 - Not Used For Now
@@ -43,12 +43,22 @@ GND -
 
 #include "Sound.h"
 #include "tim.h"
+#include "AssetPack.h"
+#include "spaceInvadersIds.h"
+
+//sounds - loaded from the asset pack in Sound_Init
+static SoundData wavSoundEnemyExplode;
+static SoundData wavSoundEnemyFire;
+static SoundData wavSoundLevelUp;
+static SoundData wavSoundPlayerExplode;
+static SoundData wavSoundPlayerFire;
 
 static uint8_t* waveData;
 static uint32_t waveCounter;
 static uint8_t mSoundFlag = 0x00;		//prevent overwrites
 static void Sound_PlaySound(const SoundData *sound, uint8_t preventOverwrite);
 static void Sound_DAC_Write(uint8_t value);
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id);
 
 //////////////////////////////////////////////
 //Configure a timer to run at 11khz and shut it off.
@@ -58,9 +68,32 @@ static void Sound_DAC_Write(uint8_t value);
 //
 void Sound_Init(void)
 {
+	AssetPack pack;
+
 	mSoundFlag = 0x00;
 	HAL_TIM_Base_Stop_IT(&htim3);		//timer3 off
 	Sound_DAC_Write(0x00);				//set all bits low
+
+	//sound arrays are in the linked asset pack,
+	//a sound that's missing has length 0 and
+	//doesn't play
+	AssetPack_OpenLinked(&pack);
+
+	Sound_Load(&pack, &wavSoundEnemyExplode, ASSET_ID_WAVENEMYEXPLODE);
+	Sound_Load(&pack, &wavSoundEnemyFire, ASSET_ID_WAVENEMYFIRE);
+	Sound_Load(&pack, &wavSoundLevelUp, ASSET_ID_WAVLEVELUP);
+	Sound_Load(&pack, &wavSoundPlayerExplode, ASSET_ID_WAVPLAYEREXPLODE);
+	Sound_Load(&pack, &wavSoundPlayerFire, ASSET_ID_WAVPLAYERFIRE);
+}
+
+//////////////////////////////////////////////
+//Point a sound at its data in the asset pack
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id)
+{
+	uint32_t size = 0x00;
+
+	sound->pSoundData = AssetPack_GetAsset(pack, id, ASSET_TYPE_SOUND, &size);
+	sound->length = sound->pSoundData ? size : 0x00;
 }
 
 /////////////////////////////////////////////
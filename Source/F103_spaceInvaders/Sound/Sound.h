@@ -31,12 +31,8 @@ typedef struct
 }SoundData;
 
 
-//sound arrays
-extern const SoundData wavSoundEnemyExplode;
-extern const SoundData wavSoundEnemyFire;
-extern const SoundData wavSoundLevelUp;
-extern const SoundData wavSoundPlayerExplode;
-extern const SoundData wavSoundPlayerFire;
+//sound arrays are in the asset pack, see
+//AssetPack/Manifest/spaceInvaders.txt
 
 
 void Sound_Init(void);                  //main
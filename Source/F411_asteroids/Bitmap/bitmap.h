@@ -18,10 +18,19 @@ struct ImageData{
     uint8_t bytesPerLine;
     uint8_t bitsPerPixel;
     const uint8_t * const pImageData;
+    const uint8_t * const pPageData;    // page major copy, NULL if none
+    const uint32_t * const pMask;       // collision mask, NULL if none
 };
 
 typedef struct ImageData ImageData;
 
+//pImageData - row major, MSB left, bytesPerLine per row
+//pPageData - (ySize + 7) / 8 pages of xSize column bytes,
+//LSB on top, the same layout as the 12864 frameBuffer.
+//Generated by Tools/bitmap_pagemajor.c
+//pMask - ySize words, one per row, bit 31 is the left
+//pixel.  Generated by Tools/bitmap_mask.c
+
 
 //bitmaps
 extern const ImageData imageEnemy1;
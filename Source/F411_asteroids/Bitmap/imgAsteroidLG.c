@@ -25,11 +25,37 @@ static const uint8_t _acimgAsteroidLGBmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgAsteroidLGBmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x30, 0x7C, 0xFE, 0xFE, 0xFE, 0xFE,
+0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC,
+0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00,
+0x0C, 0x1E, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x03, 0x03, 0x03,
+0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgAsteroidLGBmp[] =
+{
+0x00000000, 0x03C00000, 0x07E0F800, 0x07FFFC00, 0x0FFFFE00, 0x0FFFFE00,
+0x07FFFE00, 0x03FFFE00, 0x03FFFE00, 0x03FFFE00, 0x03FFFE00, 0x03FFFE00,
+0x03FFFE00, 0x03FFFC00, 0x03FFF800, 0x07FFE000, 0x0FFFE000, 0x1FFFE000,
+0x3F8FC000, 0x3F838000, 0x1F800000, 0x03800000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgAsteroidLGBmp = {
 24, //xSize
 24, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgAsteroidLGBmp,
+(uint8_t*)_pgimgAsteroidLGBmp, //page major data
+(uint32_t*)_mkimgAsteroidLGBmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgAsteroidMDBmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgAsteroidMDBmp[] =
+{
+0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+0x1F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x01,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgAsteroidMDBmp[] =
+{
+0x00000000, 0x00000000, 0x0E000000, 0x1FC00000, 0x3FF00000, 0x3FF00000,
+0x3FF80000, 0x3FFC0000, 0x1FFC0000, 0x1FF80000, 0x1FF80000, 0x0FF80000,
+0x0FF80000, 0x03F00000, 0x01E00000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgAsteroidMDBmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgAsteroidMDBmp,
+(uint8_t*)_pgimgAsteroidMDBmp, //page major data
+(uint32_t*)_mkimgAsteroidMDBmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -18,11 +18,28 @@ static const uint8_t _acimgAsteroidSMBmp[] =
 0x00, 0x06, 0x0E, 0x3E, 0x7E, 0x70, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgAsteroidSMBmp[] =
+{
+0x00, 0x30, 0x38, 0x38, 0x1C, 0x1E, 0x1E, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgAsteroidSMBmp[] =
+{
+0x00000000, 0x06000000, 0x0E000000, 0x3E000000, 0x7E000000, 0x70000000,
+0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgAsteroidSMBmp = {
 8, //xSize
 8, //ySize
 1, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgAsteroidSMBmp,
+(uint8_t*)_pgimgAsteroidSMBmp, //page major data
+(uint32_t*)_mkimgAsteroidSMBmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
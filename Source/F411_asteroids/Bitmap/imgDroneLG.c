@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGBmp[] =
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGBmp[] =
+{
+0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x08, 0x08,
+0xE8, 0xA8, 0xA8, 0xA8, 0xC8, 0x10, 0x10, 0x20, 0x40, 0x40,
+0x40, 0x40, 0xC0, 0x00, 0x00, 0x0E, 0x01, 0x04, 0x0E, 0x15,
+0x15, 0x15, 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+0x0E, 0x15, 0x15, 0x15, 0x0E, 0x00, 0x1F, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGBmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x01FE0000, 0x02018000, 0x043C4000,
+0x08223E00, 0x103E0200, 0x27007200, 0x48808A00, 0x5FFFFA00, 0x48808A00,
+0x07007200, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneLGBmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGBmp,
+(uint8_t*)_pgimgDroneLGBmp, //page major data
+(uint32_t*)_mkimgDroneLGBmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
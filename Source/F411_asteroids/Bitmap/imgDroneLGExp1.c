@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGExp1Bmp[] =
 0x02, 0x00, 0x24, 0x10, 0x10, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGExp1Bmp[] =
+{
+0x40, 0x04, 0x00, 0x08, 0x40, 0x00, 0x10, 0x08, 0x08, 0x0A,
+0xE8, 0xA0, 0xA8, 0xA8, 0xC8, 0x00, 0x10, 0x02, 0x40, 0x40,
+0x50, 0x41, 0xC0, 0x00, 0x00, 0x0E, 0x40, 0x04, 0x0E, 0x55,
+0x15, 0x14, 0x0E, 0x14, 0x04, 0x44, 0x04, 0x04, 0x24, 0x04,
+0x0C, 0x15, 0x14, 0x55, 0x0E, 0x00, 0x1F, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGExp1Bmp[] =
+{
+0x00000400, 0x00404000, 0x40000000, 0x11EE0000, 0x02008800, 0x003C0000,
+0x88223E00, 0x003E0200, 0x06005200, 0x48800A00, 0x5FFFFA00, 0x48808A00,
+0x07407200, 0x00020000, 0x24101000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneLGExp1Bmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGExp1Bmp,
+(uint8_t*)_pgimgDroneLGExp1Bmp, //page major data
+(uint32_t*)_mkimgDroneLGExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGExp2Bmp[] =
 0x02, 0x00, 0x24, 0x10, 0x10, 0x00, 0x00, 0x02};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGExp2Bmp[] =
+{
+0x40, 0x04, 0x40, 0x08, 0x40, 0x02, 0x10, 0x08, 0x08, 0x0A,
+0xA8, 0x80, 0x00, 0xA8, 0x4A, 0x00, 0x10, 0x02, 0x40, 0x00,
+0x50, 0x41, 0x84, 0x00, 0x00, 0x0E, 0x40, 0x04, 0x0A, 0x51,
+0x11, 0x14, 0x0E, 0x14, 0x04, 0x44, 0x00, 0x00, 0x24, 0x00,
+0x0C, 0x15, 0x10, 0x55, 0x0E, 0x00, 0x92, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGExp2Bmp[] =
+{
+0x00000400, 0x04424000, 0x40000200, 0x11E60000, 0x02008800, 0x00240000,
+0xA8022C00, 0x00340200, 0x06005000, 0x48800A00, 0x51F2D800, 0x48808800,
+0x07407200, 0x00020000, 0x24101000, 0x00000200};
+//end collision mask
+
+
 const ImageData bmimgDroneLGExp2Bmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGExp2Bmp,
+(uint8_t*)_pgimgDroneLGExp2Bmp, //page major data
+(uint32_t*)_mkimgDroneLGExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
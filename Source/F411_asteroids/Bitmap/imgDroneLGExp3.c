@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGExp3Bmp[] =
 0x02, 0x00, 0x24, 0x10, 0x10, 0x00, 0x00, 0x02};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGExp3Bmp[] =
+{
+0x40, 0x04, 0x40, 0x08, 0x40, 0x02, 0x10, 0x00, 0x00, 0x02,
+0x28, 0x00, 0x00, 0x20, 0x42, 0x00, 0x10, 0x02, 0x40, 0x00,
+0x10, 0x01, 0xA4, 0x00, 0x24, 0x00, 0x41, 0x00, 0x02, 0x41,
+0x00, 0x10, 0x0A, 0x10, 0x04, 0x44, 0x00, 0x00, 0x24, 0x00,
+0x08, 0x14, 0x00, 0x54, 0x08, 0x00, 0x92, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGExp3Bmp[] =
+{
+0x00000400, 0x04424000, 0x40000200, 0x10200000, 0x02008800, 0x00240200,
+0xA8022000, 0x00000200, 0x24000000, 0x08800200, 0x80325000, 0x00808800,
+0x01405200, 0x80020000, 0x24101000, 0x00000200};
+//end collision mask
+
+
 const ImageData bmimgDroneLGExp3Bmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGExp3Bmp,
+(uint8_t*)_pgimgDroneLGExp3Bmp, //page major data
+(uint32_t*)_mkimgDroneLGExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGExp4Bmp[] =
 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x02};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGExp4Bmp[] =
+{
+0x40, 0x04, 0x00, 0x08, 0x40, 0x02, 0x10, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0x40, 0x00,
+0x00, 0x01, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x82, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGExp4Bmp[] =
+{
+0x00000400, 0x04424000, 0x40000200, 0x10200000, 0x02008000, 0x00000000,
+0x88002000, 0x00000000, 0x00000000, 0x08000200, 0x80021000, 0x00000000,
+0x00401000, 0x80000000, 0x00101000, 0x00000200};
+//end collision mask
+
+
 const ImageData bmimgDroneLGExp4Bmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGExp4Bmp,
+(uint8_t*)_pgimgDroneLGExp4Bmp, //page major data
+(uint32_t*)_mkimgDroneLGExp4Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -22,11 +22,33 @@ static const uint8_t _acimgDroneLGExp5Bmp[] =
 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneLGExp5Bmp[] =
+{
+0x00, 0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneLGExp5Bmp[] =
+{
+0x00000400, 0x04400000, 0x40000200, 0x10200000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00100000, 0x00000200};
+//end collision mask
+
+
 const ImageData bmimgDroneLGExp5Bmp = {
 24, //xSize
 16, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneLGExp5Bmp,
+(uint8_t*)_pgimgDroneLGExp5Bmp, //page major data
+(uint32_t*)_mkimgDroneLGExp5Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDBmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDBmp[] =
+{
+0x00, 0xE0, 0x10, 0x08, 0x04, 0x22, 0x02, 0xC2, 0x82, 0x02,
+0x22, 0x04, 0x08, 0x30, 0xC0, 0x00, 0x00, 0x07, 0x08, 0x10,
+0x20, 0x2C, 0x48, 0x52, 0x53, 0x48, 0x2C, 0x20, 0x10, 0x0C,
+0x03, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDBmp[] =
+{
+0x00000000, 0x07E00000, 0x08100000, 0x10080000, 0x20040000, 0x44240000,
+0x41020000, 0x41820000, 0x40820000, 0x41820000, 0x44240000, 0x26640000,
+0x11880000, 0x0C300000, 0x03C00000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDBmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDBmp,
+(uint8_t*)_pgimgDroneMDBmp, //page major data
+(uint32_t*)_mkimgDroneMDBmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
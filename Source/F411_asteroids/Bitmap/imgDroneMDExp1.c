@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp1Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp1Bmp[] =
+{
+0x00, 0x24, 0x10, 0x08, 0x04, 0x02, 0x00, 0x40, 0x80, 0x02,
+0x22, 0x04, 0x00, 0x20, 0x42, 0x00, 0x00, 0x16, 0x48, 0x10,
+0x20, 0x2C, 0x48, 0x52, 0x53, 0x48, 0x2C, 0x22, 0x10, 0x0C,
+0x43, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp1Bmp[] =
+{
+0x00000000, 0x04620000, 0x48100000, 0x10000000, 0x20000000, 0x40240000,
+0x01020000, 0x00800000, 0x00820000, 0x41920000, 0x44240000, 0x26640000,
+0x51880000, 0x0C300000, 0x23C20000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp1Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp1Bmp,
+(uint8_t*)_pgimgDroneMDExp1Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
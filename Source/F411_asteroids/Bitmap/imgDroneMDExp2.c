@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp2Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp2Bmp[] =
+{
+0x00, 0x24, 0x10, 0x02, 0x00, 0x02, 0x00, 0x40, 0x88, 0x02,
+0x22, 0x04, 0x00, 0x20, 0x42, 0x00, 0x00, 0x12, 0x48, 0x11,
+0x20, 0x2C, 0x48, 0x50, 0x11, 0x08, 0x00, 0x20, 0x10, 0x00,
+0x41, 0x08};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp2Bmp[] =
+{
+0x00000000, 0x14620000, 0x40100000, 0x00800000, 0x20000000, 0x40240000,
+0x01020000, 0x00800000, 0x10820000, 0x40000000, 0x04000000, 0x26410000,
+0x51880000, 0x0C100000, 0x23020000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp2Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp2Bmp,
+(uint8_t*)_pgimgDroneMDExp2Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp3Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp3Bmp[] =
+{
+0x00, 0x20, 0x10, 0x02, 0x00, 0x02, 0x00, 0x40, 0x80, 0x02,
+0x22, 0x04, 0x00, 0x00, 0x42, 0x00, 0x00, 0x12, 0x48, 0x01,
+0x20, 0x00, 0x48, 0x10, 0x11, 0x08, 0x00, 0x20, 0x00, 0x00,
+0x40, 0x08};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp3Bmp[] =
+{
+0x00000000, 0x14620000, 0x00100000, 0x00000000, 0x20000000, 0x40200000,
+0x01020000, 0x00800000, 0x10800000, 0x40000000, 0x00000000, 0x22410000,
+0x41800000, 0x08100000, 0x22020000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp3Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp3Bmp,
+(uint8_t*)_pgimgDroneMDExp3Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
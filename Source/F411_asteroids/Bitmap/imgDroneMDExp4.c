@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp4Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp4Bmp[] =
+{
+0x00, 0x20, 0x10, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+0x02, 0x04, 0x00, 0x00, 0x42, 0x00, 0x00, 0x10, 0x40, 0x01,
+0x20, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x08};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp4Bmp[] =
+{
+0x00000000, 0x14620000, 0x00100000, 0x00000000, 0x20000000, 0x40000000,
+0x00020000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00410000,
+0x40000000, 0x08000000, 0x22020000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp4Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp4Bmp,
+(uint8_t*)_pgimgDroneMDExp4Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp4Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp5Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp5Bmp[] =
+{
+0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x10, 0x40, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp5Bmp[] =
+{
+0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x20000000, 0x00000000,
+0x00020000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x20000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp5Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp5Bmp,
+(uint8_t*)_pgimgDroneMDExp5Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp5Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
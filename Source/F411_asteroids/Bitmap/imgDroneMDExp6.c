@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneMDExp6Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneMDExp6Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneMDExp6Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneMDExp6Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneMDExp6Bmp,
+(uint8_t*)_pgimgDroneMDExp6Bmp, //page major data
+(uint32_t*)_mkimgDroneMDExp6Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneSMExp1Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneSMExp1Bmp[] =
+{
+0x00, 0x40, 0x10, 0x80, 0xD0, 0x60, 0xC0, 0x48, 0xC0, 0x60,
+0xD0, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21,
+0x06, 0x09, 0x0A, 0x02, 0x29, 0x0A, 0x05, 0x10, 0x07, 0x00,
+0x02, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneSMExp1Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x28200000, 0x04480000,
+0x4FE00000, 0x1AB00000, 0x14A80000, 0x2B4A0000, 0x28280000, 0x06C00000,
+0x00100000, 0x10800000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneSMExp1Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneSMExp1Bmp,
+(uint8_t*)_pgimgDroneSMExp1Bmp, //page major data
+(uint32_t*)_mkimgDroneSMExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneSMExp2Bmp[] =
 0x80, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneSMExp2Bmp[] =
+{
+0x00, 0x44, 0x10, 0x80, 0xD0, 0x60, 0x80, 0x0A, 0x00, 0x40,
+0x94, 0x80, 0x20, 0x00, 0xE2, 0x00, 0xE0, 0x00, 0x00, 0x21,
+0x06, 0x09, 0x0A, 0x02, 0x29, 0x0A, 0x05, 0x10, 0x00, 0x00,
+0x03, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneSMExp2Bmp[] =
+{
+0x00000000, 0x01020000, 0x40200000, 0x01000000, 0x28200000, 0x040A0000,
+0x4C420000, 0x1A320000, 0x14A20000, 0x0B420000, 0x08200000, 0x06C00000,
+0x00100000, 0x90800000, 0x80000000, 0x80000000};
+//end collision mask
+
+
 const ImageData bmimgDroneSMExp2Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneSMExp2Bmp,
+(uint8_t*)_pgimgDroneSMExp2Bmp, //page major data
+(uint32_t*)_mkimgDroneSMExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneSMExp3Bmp[] =
 0x80, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneSMExp3Bmp[] =
+{
+0x00, 0x44, 0x10, 0x82, 0x40, 0x00, 0x80, 0x0A, 0x00, 0x40,
+0x94, 0x80, 0x20, 0x00, 0x42, 0x00, 0xE0, 0x00, 0x00, 0x21,
+0x02, 0x41, 0x00, 0x00, 0x20, 0x02, 0x05, 0x00, 0x00, 0x00,
+0x02, 0x40};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneSMExp3Bmp[] =
+{
+0x00000000, 0x11020000, 0x40200000, 0x01000000, 0x20200000, 0x00080000,
+0x48420000, 0x12300000, 0x14200000, 0x08420000, 0x00200000, 0x00000000,
+0x00000000, 0x90800000, 0x84010000, 0x80000000};
+//end collision mask
+
+
 const ImageData bmimgDroneSMExp3Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneSMExp3Bmp,
+(uint8_t*)_pgimgDroneSMExp3Bmp, //page major data
+(uint32_t*)_mkimgDroneSMExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneSMExp4Bmp[] =
 0x80, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneSMExp4Bmp[] =
+{
+0x00, 0x44, 0x10, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x94, 0x00, 0x00, 0x00, 0x52, 0x00, 0xE0, 0x00, 0x00, 0x21,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+0x02, 0x40};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneSMExp4Bmp[] =
+{
+0x00000000, 0x11020000, 0x40200000, 0x00000000, 0x20220000, 0x00000000,
+0x40020000, 0x00200000, 0x10000000, 0x00020000, 0x00000000, 0x00000000,
+0x00100000, 0x90000000, 0x84010000, 0x80000000};
+//end collision mask
+
+
 const ImageData bmimgDroneSMExp4Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneSMExp4Bmp,
+(uint8_t*)_pgimgDroneSMExp4Bmp, //page major data
+(uint32_t*)_mkimgDroneSMExp4Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgDroneSMExp5Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneSMExp5Bmp[] =
+{
+0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x40};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneSMExp5Bmp[] =
+{
+0x00000000, 0x11020000, 0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x10000000, 0x04010000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneSMExp5Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneSMExp5Bmp,
+(uint8_t*)_pgimgDroneSMExp5Bmp, //page major data
+(uint32_t*)_mkimgDroneSMExp5Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
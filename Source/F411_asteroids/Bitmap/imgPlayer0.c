@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer0Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer0Bmp[] =
+{
+0x00, 0x00, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0,
+0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06,
+0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer0Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x3F800000,
+0x3FE00000, 0x20FC0000, 0x20FC0000, 0x3FE00000, 0x3F800000, 0x20000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer0Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer0Bmp,
+(uint8_t*)_pgimgPlayer0Bmp, //page major data
+(uint32_t*)_mkimgPlayer0Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer116Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer116Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0x5F, 0x78, 0x60, 0x23, 0x3F, 0x1C, 0x08, 0x08,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer116Bmp[] =
+{
+0x00000000, 0x08000000, 0x0C000000, 0x0E000000, 0x0F000000, 0x0F800000,
+0x0FC00000, 0x0FC00000, 0x06600000, 0x06600000, 0x06300000, 0x033C0000,
+0x03300000, 0x01E00000, 0x03800000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer116Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer116Bmp,
+(uint8_t*)_pgimgPlayer116Bmp, //page major data
+(uint32_t*)_mkimgPlayer116Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
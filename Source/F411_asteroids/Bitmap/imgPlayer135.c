@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer135Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer135Bmp[] =
+{
+0x00, 0x00, 0x0E, 0x3C, 0xF8, 0xF8, 0x38, 0x30, 0x30, 0x60,
+0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x07, 0x0E, 0x3C, 0x1C, 0x0C, 0x07, 0x03, 0x01,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer135Bmp[] =
+{
+0x00000000, 0x20000000, 0x30000000, 0x3E000000, 0x1F800000, 0x1FC00000,
+0x0C700000, 0x0C3C0000, 0x061C0000, 0x03180000, 0x03F00000, 0x01E00000,
+0x00C00000, 0x00800000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer135Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer135Bmp,
+(uint8_t*)_pgimgPlayer135Bmp, //page major data
+(uint32_t*)_mkimgPlayer135Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
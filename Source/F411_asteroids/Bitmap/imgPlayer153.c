@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer153Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer153Bmp[] =
+{
+0x00, 0x08, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0x30, 0x30, 0x20,
+0x60, 0x60, 0xC0, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x01, 0x03, 0x07, 0x06, 0x1E, 0x0E, 0x03, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer153Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x78000000, 0x3F800000, 0x3FF20000,
+0x1E3E0000, 0x0E0C0000, 0x07880000, 0x01F80000, 0x00F00000, 0x00300000,
+0x00200000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer153Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer153Bmp,
+(uint8_t*)_pgimgPlayer153Bmp, //page major data
+(uint32_t*)_mkimgPlayer153Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
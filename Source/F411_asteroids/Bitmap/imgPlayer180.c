@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer180Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer180Bmp[] =
+{
+0x00, 0x00, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0x60, 0x60,
+0x60, 0x60, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0F,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer180Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x01FC0000,
+0x07FC0000, 0x3F040000, 0x3F040000, 0x07FC0000, 0x01FC0000, 0x00040000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer180Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer180Bmp,
+(uint8_t*)_pgimgPlayer180Bmp, //page major data
+(uint32_t*)_mkimgPlayer180Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer206Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer206Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xE0, 0x60,
+0x78, 0x70, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x1E,
+0x1F, 0x0F, 0x0F, 0x0C, 0x0C, 0x04, 0x06, 0x06, 0x03, 0x03,
+0x06, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer206Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00300000, 0x00F00000,
+0x01F80000, 0x07880000, 0x0E0C0000, 0x1E3E0000, 0x3FF20000, 0x3F800000,
+0x78000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer206Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer206Bmp,
+(uint8_t*)_pgimgPlayer206Bmp, //page major data
+(uint32_t*)_mkimgPlayer206Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer243Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer243Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFA, 0x1E, 0x06, 0xC4,
+0xFC, 0x38, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer243Bmp[] =
+{
+0x00000000, 0x03800000, 0x01E00000, 0x03300000, 0x033C0000, 0x06300000,
+0x06600000, 0x06600000, 0x0FC00000, 0x0FC00000, 0x0F800000, 0x0F000000,
+0x0E000000, 0x0C000000, 0x08000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer243Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer243Bmp,
+(uint8_t*)_pgimgPlayer243Bmp, //page major data
+(uint32_t*)_mkimgPlayer243Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer26Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer26Bmp[] =
+{
+0x00, 0x60, 0xC0, 0xC0, 0x60, 0x60, 0x20, 0x30, 0x30, 0xF0,
+0xF0, 0xF8, 0x78, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03,
+0x0E, 0x1E, 0x06, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer26Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x001E0000, 0x01FC0000, 0x4FFC0000,
+0x7C780000, 0x30700000, 0x11E00000, 0x1F800000, 0x0F000000, 0x0C000000,
+0x04000000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer26Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer26Bmp,
+(uint8_t*)_pgimgPlayer26Bmp, //page major data
+(uint32_t*)_mkimgPlayer26Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
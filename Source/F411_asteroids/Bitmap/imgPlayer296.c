@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer296Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer296Bmp[] =
+{
+0x00, 0x00, 0x10, 0x10, 0x38, 0xFC, 0xC4, 0x06, 0x1E, 0xFA,
+0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer296Bmp[] =
+{
+0x00000000, 0x01C00000, 0x07800000, 0x0CC00000, 0x3CC00000, 0x0C600000,
+0x06600000, 0x06600000, 0x03F00000, 0x03F00000, 0x01F00000, 0x00F00000,
+0x00700000, 0x00300000, 0x00100000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer296Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer296Bmp,
+(uint8_t*)_pgimgPlayer296Bmp, //page major data
+(uint32_t*)_mkimgPlayer296Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
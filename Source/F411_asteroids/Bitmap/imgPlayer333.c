@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer333Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer333Bmp[] =
+{
+0x00, 0x00, 0x00, 0xC0, 0x70, 0x78, 0x60, 0xE0, 0xC0, 0x80,
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x03,
+0x06, 0x06, 0x04, 0x0C, 0x0C, 0x0F, 0x0F, 0x1F, 0x1E, 0x1C,
+0x10, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer333Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x0C000000, 0x0F000000,
+0x1F800000, 0x11E00000, 0x30700000, 0x7C780000, 0x4FFC0000, 0x01FC0000,
+0x001E0000, 0x00000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer333Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer333Bmp,
+(uint8_t*)_pgimgPlayer333Bmp, //page major data
+(uint32_t*)_mkimgPlayer333Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
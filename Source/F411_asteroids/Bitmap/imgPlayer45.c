@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer45Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer45Bmp[] =
+{
+0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0x30, 0x38,
+0xF8, 0xF8, 0x3C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+0x07, 0x0C, 0x1C, 0x3C, 0x0E, 0x07, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer45Bmp[] =
+{
+0x00000000, 0x00040000, 0x000C0000, 0x007C0000, 0x01F80000, 0x03F80000,
+0x0E300000, 0x3C300000, 0x38600000, 0x18C00000, 0x0FC00000, 0x07800000,
+0x03000000, 0x01000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer45Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer45Bmp,
+(uint8_t*)_pgimgPlayer45Bmp, //page major data
+(uint32_t*)_mkimgPlayer45Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
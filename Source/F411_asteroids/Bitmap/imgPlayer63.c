@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer63Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer63Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8,
+0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
+0x1C, 0x3F, 0x23, 0x60, 0x78, 0x5F, 0x07, 0x00, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer63Bmp[] =
+{
+0x00000000, 0x00100000, 0x00300000, 0x00700000, 0x00F00000, 0x01F00000,
+0x03F00000, 0x03F00000, 0x06600000, 0x06600000, 0x0C600000, 0x3CC00000,
+0x0CC00000, 0x07800000, 0x01C00000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer63Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer63Bmp,
+(uint8_t*)_pgimgPlayer63Bmp, //page major data
+(uint32_t*)_mkimgPlayer63Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
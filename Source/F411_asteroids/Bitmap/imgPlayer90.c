@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayer90Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayer90Bmp[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFC, 0xFC, 0xE0,
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x20, 0x3F, 0x3F, 0x20, 0x20, 0x3F, 0x3F, 0x20, 0x00, 0x00,
+0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayer90Bmp[] =
+{
+0x00000000, 0x00000000, 0x01800000, 0x01800000, 0x01800000, 0x03C00000,
+0x03C00000, 0x07E00000, 0x06600000, 0x06600000, 0x06600000, 0x06600000,
+0x06600000, 0x0FF00000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayer90Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayer90Bmp,
+(uint8_t*)_pgimgPlayer90Bmp, //page major data
+(uint32_t*)_mkimgPlayer90Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
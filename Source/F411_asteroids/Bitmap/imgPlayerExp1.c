@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayerExp1Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp1Bmp[] =
+{
+0x00, 0x00, 0x80, 0x80, 0xC0, 0xD0, 0x64, 0x10, 0x24, 0x3C,
+0xEA, 0x98, 0x2C, 0x2E, 0x00, 0x04, 0x00, 0x24, 0x01, 0x13,
+0x27, 0x0C, 0x1C, 0x34, 0x0E, 0x03, 0x11, 0x00, 0x02, 0x00,
+0x09, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp1Bmp[] =
+{
+0x00000000, 0x00240000, 0x02CD0000, 0x007C0000, 0x05500000, 0x02EC0000,
+0x0E200000, 0x3C300000, 0x38620000, 0x18C80000, 0x4F800000, 0x06820000,
+0x13200000, 0x49000000, 0x00000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp1Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp1Bmp,
+(uint8_t*)_pgimgPlayerExp1Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayerExp2Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp2Bmp[] =
+{
+0x00, 0x00, 0x88, 0xA4, 0x40, 0x50, 0x64, 0x10, 0x24, 0x10,
+0xCA, 0x98, 0x20, 0x26, 0x00, 0x00, 0x00, 0x25, 0x01, 0x13,
+0x21, 0x48, 0x14, 0x24, 0x0A, 0x03, 0x10, 0x00, 0x22, 0x00,
+0x09, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp2Bmp[] =
+{
+0x00000000, 0x00240000, 0x12840000, 0x20300000, 0x05500000, 0x128C0000,
+0x0E200000, 0x30300000, 0x78420000, 0x10C80000, 0x43000000, 0x04820000,
+0x12200000, 0x49080000, 0x04000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp2Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp2Bmp,
+(uint8_t*)_pgimgPlayerExp2Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayerExp3Bmp[] =
 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp3Bmp[] =
+{
+0x00, 0x00, 0x88, 0xA4, 0x00, 0x50, 0x24, 0x10, 0x24, 0x10,
+0x02, 0x90, 0x00, 0x26, 0x00, 0x00, 0x00, 0x25, 0x01, 0x13,
+0x21, 0x48, 0x10, 0x24, 0x0A, 0x01, 0x10, 0x00, 0x22, 0x00,
+0x09, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp3Bmp[] =
+{
+0x00000000, 0x00240000, 0x12840000, 0x20000000, 0x05500000, 0x12840000,
+0x04000000, 0x30100000, 0x78420000, 0x10880000, 0x41000000, 0x04820000,
+0x12200000, 0x49080000, 0x04000000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp3Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp3Bmp,
+(uint8_t*)_pgimgPlayerExp3Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
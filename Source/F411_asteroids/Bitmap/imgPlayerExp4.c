@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayerExp4Bmp[] =
 0x40, 0x90};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp4Bmp[] =
+{
+0x04, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+0x02, 0x00, 0x02, 0x06, 0x20, 0x09, 0x00, 0xA1, 0x01, 0x02,
+0x00, 0x48, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x22, 0x00,
+0x09, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp4Bmp[] =
+{
+0x20010000, 0x002C0000, 0x90840000, 0x20010000, 0x00000000, 0x10820000,
+0x00000000, 0x00000000, 0x60020000, 0x10080000, 0x00000000, 0x04020000,
+0x00000000, 0x40080000, 0x04000000, 0x40900000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp4Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp4Bmp,
+(uint8_t*)_pgimgPlayerExp4Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp4Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
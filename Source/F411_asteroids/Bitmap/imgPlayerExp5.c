@@ -21,11 +21,32 @@ static const uint8_t _acimgPlayerExp5Bmp[] =
 0x40, 0x90};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgPlayerExp5Bmp[] =
+{
+0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x06, 0x00, 0x09, 0x00, 0xA0, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+0x08, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgPlayerExp5Bmp[] =
+{
+0x20010000, 0x000C0000, 0x80040000, 0x00010000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00020000,
+0x00000000, 0x40000000, 0x00000000, 0x40900000};
+//end collision mask
+
+
 const ImageData bmimgPlayerExp5Bmp = {
 16, //xSize
 16, //ySize
 2, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgPlayerExp5Bmp,
+(uint8_t*)_pgimgPlayerExp5Bmp, //page major data
+(uint32_t*)_mkimgPlayerExp5Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
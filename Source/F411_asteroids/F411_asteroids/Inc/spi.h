@@ -55,6 +55,8 @@ extern SPI_HandleTypeDef hspi1;
 
 /* USER CODE BEGIN Private defines */
 
+extern DMA_HandleTypeDef hdma_spi1_tx;
+
 /* USER CODE END Private defines */
 
 extern void _Error_Handler(char *, int);
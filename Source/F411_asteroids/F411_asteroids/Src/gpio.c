@@ -41,6 +41,7 @@
 #include "gpio.h"
 /* USER CODE BEGIN 0 */
 #include "sprite.h"				//flags for button presses
+#include "lcd_12864_dfrobot.h"	//backlight
 
 /* USER CODE END 0 */
 
@@ -131,7 +132,7 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 	if (GPIO_Pin == userButton_Pin)
 	{
 		//toggle the backlight
-		HAL_GPIO_TogglePin(LCD_Backlight_GPIO_Port, LCD_Backlight_Pin);
+		LCD_BacklightToggle();
 	}
 
 	////////////////////////////////////////////////
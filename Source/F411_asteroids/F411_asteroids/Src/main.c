@@ -119,17 +119,16 @@ int main(void)
 	Joystick_Config();				//DMA stream for ADC - A1
 	Sound_Init();					//timers and sound
 	Sprite_Init();					//game init
-	LCD_BacklightOn();				//backlight
+	LCD_FadeBacklight(LCD_BACKLIGHT_DIM, 500);	//backlight 20%
 
 	HAL_Delay(100);					//wait a bit
 
-	EEPROM_init();					//simple read/write check
+	EEPROM_init();					//check the part is there
+	Score_Init();					//load the newest score record
 
 	/////////////////////////////////////////////////
 	//Clear high score. comment out if not needed
-//		int result = Score_Init();
-//		if (result < 0)
-//			while (1){};
+//		Score_Reset();
 	//////////////////////////////////////////////////
 
 
@@ -146,6 +145,8 @@ int main(void)
 		/* USER CODE END WHILE */
 
 		/* USER CODE BEGIN 3 */
+		Score_Process();				//score record write back
+
 		if (Sprite_GetGameOverFlag() == 1)
 		{
 			Sound_Play_GameOver();
@@ -161,13 +162,15 @@ int main(void)
 					HAL_Delay(1000);
 				}
 
-				//update the high score and level here
-				Score_SetHighScore(Sprite_GetGameScore());
-				Score_SetMaxLevel(Sprite_GetGameLevel());
-
 				Sprite_SetGameOverFlag();
 			}
 
+			//add to the leaderboard if it's in the top 10,
+			//written back from Score_Process.  skip the
+			//game over set at power up, nothing was played
+			if (Sprite_GetGameScore() > 0)
+				Score_Insert(Sprite_GetGameScore(), (uint8_t)Sprite_GetGameLevel());
+
 			HAL_Delay(2000);
 		}
 
@@ -177,15 +180,17 @@ int main(void)
 		//will clear the game over flag, otherwise, it fires
 		while (Sprite_GetGameOverFlag() == 1)
 		{
+			Score_Process();
+
 			uint8_t buffer[SCORE_PLAYER_NAME_SIZE] = {0x00};
-			uint8_t buffer2[16] = {0x00};
-			uint16_t highScore = Score_GetHighScore();
+			uint8_t buffer2[24] = {0x00};
+			uint32_t highScore = Score_GetHighScore();
 			uint8_t level = Score_GetMaxLevel();
 			uint8_t len = Score_GetPlayerName(buffer);
 
 			LCD_DrawStringKernLength(1, 3, buffer, len);
 
-			int n = sprintf((char*)buffer2, "Score:%d", highScore);
+			int n = sprintf((char*)buffer2, "Score:%lu", (unsigned long)highScore);
 			LCD_DrawStringKernLength(2, 3, buffer2, n);
 
 			n = sprintf((char*)buffer2, "Level:%d", level);
@@ -194,8 +199,9 @@ int main(void)
 			LCD_DrawStringKern(5, 3, " Press Button");
 
 			HAL_Delay(1000);
-			LCD_Clear(0x00);
+			Score_DisplayLeaderboard(0);
 			HAL_Delay(1000);
+			LCD_Clear(0x00);
 
 			Sprite_Init();                  //reset and clear all flags
 		}
@@ -211,21 +217,31 @@ int main(void)
 
 
 		///////////////////////////////////////////////////
-		//Read the joystick - up, down, left, right
-		//and update player orientation and thruster
-		JoystickPosition_t pos = Joystick_GetPosition();
+		//Read the joystick - left, right rotate once per
+		//press and autorepeat, down flips once per press,
+		//up fires the thruster while held
+		JoystickEvent event;
 
-		switch(pos)
+		while (Joystick_GetEvent(&event))
 		{
-			case JOYSTICK_UP:		Sprite_PlayerFireThruster();		break;
-			case JOYSTICK_DOWN: 	Sprite_PlayerFlipRotation();		break;
-			case JOYSTICK_LEFT:		Sprite_PlayerRotateCCW();			break;
-			case JOYSTICK_RIGHT:	Sprite_PlayerRotateCW();			break;
-			case JOYSTICK_PRESS:										break;
-			case JOYSTICK_NONE:											break;
-			default:													break;
+			if (event.type == JOYSTICK_EVENT_RELEASE)
+				continue;
+
+			switch(event.position)
+			{
+				case JOYSTICK_LEFT:		Sprite_PlayerRotateCCW();			break;
+				case JOYSTICK_RIGHT:	Sprite_PlayerRotateCW();			break;
+				case JOYSTICK_DOWN:
+					if (event.type == JOYSTICK_EVENT_PRESS)
+						Sprite_PlayerFlipRotation();
+					break;
+				default:													break;
+			}
 		}
 
+		if (Joystick_GetPosition() == JOYSTICK_UP)
+			Sprite_PlayerFireThruster();
+
 		//launch a drone ever 50 game loops
 		if (!(gCounter % 50))
 		{
@@ -327,27 +343,23 @@ void SystemClock_Config(void)
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
 	/* USER CODE BEGIN Callback 0 */
-	static uint32_t counter = 0x00;
 
 	/* USER CODE END Callback 0 */
 	if (htim->Instance == TIM1)
 	{
 		HAL_IncTick();
-
-		//increments at 1khz - set the backlight on 20%
-		if (!(counter % 5))
-		{
-			LCD_BacklightOn();
-		}
-		else
-		{
-			LCD_BacklightOff();
-		}
-
-		counter++;
-
 	}
 	/* USER CODE BEGIN Callback 1 */
+	////////////////////////////////////////////
+	//Timer TIM1 - HAL tick, 1khz.  Steps the
+	//backlight ramps, the PWM is in hardware, and
+	//decodes the joystick
+	if (htim->Instance == TIM1)
+	{
+		LCD_BacklightTick();
+		Joystick_Tick();
+	}
+
 	////////////////////////////////////////////
 	//Timer TIM2 - Not Used For Now
 	if (htim->Instance == TIM2)
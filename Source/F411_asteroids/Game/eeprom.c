@@ -40,12 +40,43 @@
  *
  */
 
+#include <string.h>
 
 #include "gpio.h"
 #include "i2c.h"
 #include "eeprom.h"
 #include "lcd_12864_dfrobot.h"			//backlight toggle
 
+
+typedef enum
+{
+	EEPROM_ASYNC_IDLE,
+	EEPROM_ASYNC_PAGE,					//next page, after the ack poll
+	EEPROM_ASYNC_DMA,					//page in flight
+	EEPROM_ASYNC_ERROR
+}EEPROM_AsyncState_t;
+
+//write cycle - set after each page, cleared
+//once the part acks its address again
+static volatile uint8_t mWriteCycle = 0x00;
+static volatile uint32_t mWriteCycleTick = 0x00;
+
+//async write
+static uint8_t mAsyncBuffer[EEPROM_SIZE];
+static volatile EEPROM_AsyncState_t mAsyncState = EEPROM_ASYNC_IDLE;
+static uint16_t mAsyncAddress = 0x00;
+static uint8_t mAsyncLength = 0x00;
+static volatile uint8_t mAsyncOffset = 0x00;
+static uint8_t mAsyncPageLength = 0x00;
+static EEPROM_Callback mAsyncCallback = NULL;
+static volatile int mAsyncResult = 0;		//last async write, 0 or -1
+
+static uint8_t EEPROM_PollReady(void);
+static int EEPROM_WaitReady(void);
+static uint8_t EEPROM_PageLength(uint16_t address, uint8_t len);
+static void EEPROM_AsyncDone(int result);
+
+
 /////////////////////////////////////////////
 //EEPROM_DummyDelay(uint32_t)
 static void EEPROM_DummyDelay(uint32_t delay)
@@ -59,16 +90,11 @@ static void EEPROM_DummyDelay(uint32_t delay)
 
 ////////////////////////////////////////
 //EEPROM IC uses I2C1
-//Write a byte to test address and read it
-//back.
+//Check the part acks its address, no
+//writes so boot doesn't wear the part.
 void EEPROM_init(void)
 {
-	uint8_t data = 0xAA;
-	EEPROM_writeByte(EEPROM_TEST_ADDR, data);
-	HAL_Delay(50);
-	uint8_t result = EEPROM_readByte(EEPROM_TEST_ADDR);
-
-	if (data != result)
+	if (HAL_I2C_IsDeviceReady(&hi2c1, EEPROM_I2C_ADDRESS, 3, EEPROM_I2C_TIMEOUT_MS) != HAL_OK)
 	{
 		while(1)
 		{
@@ -88,9 +114,7 @@ void EEPROM_init(void)
 void EEPROM_writeByte(uint16_t address, uint8_t data)
 {
 	uint8_t tx = data;
-	HAL_I2C_Mem_Write(&hi2c1, 0xA0, address, 1, &tx, 1, 0xFFFF);
-	EEPROM_DummyDelay(400000);
-
+	EEPROM_writeMultiByte(address, &tx, 1);
 }
 
 /////////////////////////////////////////////////////////
@@ -99,8 +123,7 @@ void EEPROM_writeByte(uint16_t address, uint8_t data)
 uint8_t EEPROM_readByte(uint16_t address)
 {
 	uint8_t rx = 0x00;
-	HAL_I2C_Mem_Read(&hi2c1, 0xA0, address, 1, &rx, 1, 0xFFFF);
-	EEPROM_DummyDelay(400000);
+	EEPROM_readMultiByte(address, &rx, 1);
 	return rx;
 }
 
@@ -108,19 +131,248 @@ uint8_t EEPROM_readByte(uint16_t address)
 
 ///////////////////////////////////////////////////
 //Write array of data start at address address, len bytes
-void EEPROM_writeMultiByte(uint16_t address, uint8_t* data, uint8_t len)
+//Split into page writes, each one waits for the
+//write cycle of the one before.  Returns 0 if ok,
+//-1 on error.
+int EEPROM_writeMultiByte(uint16_t address, uint8_t* data, uint8_t len)
 {
-	HAL_I2C_Mem_Write(&hi2c1, 0xA0, address, 1, data, len, 0xFFFF);
-	EEPROM_DummyDelay(400000);
+	if ((address + len) > EEPROM_SIZE)
+		return -1;
+
+	//a failed async write goes back to its own
+	//caller, not this one
+	EEPROM_Flush();
+
+	while (len > 0)
+	{
+		uint8_t count = EEPROM_PageLength(address, len);
+
+		if (EEPROM_WaitReady() < 0)
+			return -1;
+
+		if (HAL_I2C_Mem_Write(&hi2c1, EEPROM_I2C_ADDRESS, address, 1, data, count, EEPROM_I2C_TIMEOUT_MS) != HAL_OK)
+			return -1;
+
+		mWriteCycleTick = HAL_GetTick();
+		mWriteCycle = 1;
+
+		address += count;
+		data += count;
+		len -= count;
+	}
+
+	return 0;
 }
 
 
 /////////////////////////////////////////////////////
 //Read len bytes into data array, starting at address
-void EEPROM_readMultiByte(uint16_t address, uint8_t* data, uint8_t len)
+//Sequential reads don't wrap on pages, so this is
+//one bus read.  Returns 0 if ok, -1 on error.
+int EEPROM_readMultiByte(uint16_t address, uint8_t* data, uint8_t len)
 {
-	HAL_I2C_Mem_Read(&hi2c1, 0xA0, address, 1, data, len, 0xFFFF);
-	EEPROM_DummyDelay(400000);
+	if ((address + len) > EEPROM_SIZE)
+		return -1;
+
+	//a failed async write goes back to its own
+	//caller, not this one
+	EEPROM_Flush();
+
+	if (EEPROM_WaitReady() < 0)
+		return -1;
+
+	if (HAL_I2C_Mem_Read(&hi2c1, EEPROM_I2C_ADDRESS, address, 1, data, len, EEPROM_I2C_TIMEOUT_MS) != HAL_OK)
+		return -1;
+
+	return 0;
+}
+
+
+////////////////////////////////////////////////////
+//EEPROM_writeAsync
+//Start a write of len bytes at address and return.
+//The data is copied, the buffer can be reused right
+//away.  callback is called from EEPROM_Process when
+//the last page is written, can be NULL.  Returns
+//-1 if a write is already running or the range is
+//bad, 0 if started.
+//
+int EEPROM_writeAsync(uint16_t address, const uint8_t* data, uint8_t len, EEPROM_Callback callback)
+{
+	if ((mAsyncState != EEPROM_ASYNC_IDLE) || (!len) || ((address + len) > EEPROM_SIZE))
+		return -1;
+
+	memcpy(mAsyncBuffer, data, len);
+	mAsyncAddress = address;
+	mAsyncLength = len;
+	mAsyncOffset = 0x00;
+	mAsyncCallback = callback;
+	mAsyncResult = 0;
+	mAsyncState = EEPROM_ASYNC_PAGE;
+
+	EEPROM_Process();
+
+	return 0;
+}
+
+
+////////////////////////////////////////////////////
+//EEPROM_Process
+//Call from the main loop.  Starts the next page of
+//an async write once the part acks, one poll per
+//call, and runs the completion callback.
+//
+void EEPROM_Process(void)
+{
+	switch(mAsyncState)
+	{
+		case EEPROM_ASYNC_PAGE:
+		{
+			if (!EEPROM_PollReady())
+			{
+				if ((HAL_GetTick() - mWriteCycleTick) > EEPROM_WRITE_TIMEOUT_MS)
+				{
+					mWriteCycle = 0x00;
+					EEPROM_AsyncDone(-1);
+				}
+				break;
+			}
+
+			if (mAsyncOffset == mAsyncLength)
+			{
+				EEPROM_AsyncDone(0);
+				break;
+			}
+
+			uint16_t address = mAsyncAddress + mAsyncOffset;
+			mAsyncPageLength = EEPROM_PageLength(address, mAsyncLength - mAsyncOffset);
+			mAsyncState = EEPROM_ASYNC_DMA;
+
+			if (HAL_I2C_Mem_Write_DMA(&hi2c1, EEPROM_I2C_ADDRESS, address, 1, &mAsyncBuffer[mAsyncOffset], mAsyncPageLength) != HAL_OK)
+				EEPROM_AsyncDone(-1);
+
+			break;
+		}
+
+		case EEPROM_ASYNC_ERROR:
+			EEPROM_AsyncDone(-1);
+			break;
+
+		case EEPROM_ASYNC_IDLE:
+		case EEPROM_ASYNC_DMA:
+		default:
+			break;
+	}
+}
+
+
+////////////////////////////////////////////////////
+//Returns 1 while an async write is running
+uint8_t EEPROM_IsBusy(void)
+{
+	return (mAsyncState != EEPROM_ASYNC_IDLE) ? 1 : 0;
+}
+
+
+////////////////////////////////////////////////////
+//Block until a running async write is done.
+//Returns the result of the last async write, 0 if
+//ok, -1 if it failed.
+int EEPROM_Flush(void)
+{
+	uint32_t tickstart = HAL_GetTick();
+
+	while (mAsyncState != EEPROM_ASYNC_IDLE)
+	{
+		EEPROM_Process();
+
+		//each page is bounded by the write cycle
+		//timeout, this only catches a stuck dma
+		if ((HAL_GetTick() - tickstart) > (EEPROM_SIZE / EEPROM_PAGE_SIZE) * (EEPROM_WRITE_TIMEOUT_MS + EEPROM_I2C_TIMEOUT_MS))
+		{
+			HAL_I2C_Master_Abort_IT(&hi2c1, EEPROM_I2C_ADDRESS);
+			EEPROM_AsyncDone(-1);
+		}
+	}
+
+	return mAsyncResult;
+}
+
+
+////////////////////////////////////////////////////
+//HAL callbacks - I2C1 interrupt context
+//
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance != I2C1)
+		return;
+
+	mWriteCycleTick = HAL_GetTick();
+	mWriteCycle = 1;
+	mAsyncOffset += mAsyncPageLength;
+	mAsyncState = EEPROM_ASYNC_PAGE;
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance != I2C1)
+		return;
+
+	if (mAsyncState == EEPROM_ASYNC_DMA)
+		mAsyncState = EEPROM_ASYNC_ERROR;
+}
+
+
+////////////////////////////////////////////////////
+//Ack polling - one address probe, 1 if the
+//part is out of the write cycle
+static uint8_t EEPROM_PollReady(void)
+{
+	if (!mWriteCycle)
+		return 1;
+
+	if (HAL_I2C_IsDeviceReady(&hi2c1, EEPROM_I2C_ADDRESS, 1, EEPROM_I2C_TIMEOUT_MS) != HAL_OK)
+		return 0;
+
+	mWriteCycle = 0x00;
+	return 1;
+}
+
+////////////////////////////////////////////////////
+//Poll the ack until the write cycle is done,
+//-1 if the part never comes back
+static int EEPROM_WaitReady(void)
+{
+	while (!EEPROM_PollReady())
+	{
+		if ((HAL_GetTick() - mWriteCycleTick) > EEPROM_WRITE_TIMEOUT_MS)
+		{
+			mWriteCycle = 0x00;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////
+//Bytes that fit from address to the end of its page
+static uint8_t EEPROM_PageLength(uint16_t address, uint8_t len)
+{
+	uint8_t room = EEPROM_PAGE_SIZE - (address & (EEPROM_PAGE_SIZE - 1));
+	return (len < room) ? len : room;
+}
+
+static void EEPROM_AsyncDone(int result)
+{
+	EEPROM_Callback callback = mAsyncCallback;
+
+	mAsyncCallback = NULL;
+	mAsyncResult = result;
+	mAsyncState = EEPROM_ASYNC_IDLE;
+
+	if (callback)
+		callback(result);
 }
 
 
@@ -9,6 +9,18 @@
  A0.  WHen the shield is on the Atmel SAME70 M7 board, I'm using
  A1.
 
+ Decoding: the ADC scans both channels into a
+ circular DMA buffer of JOYSTICK_NUM_SAMPLES per
+ channel.  Joystick_Tick() runs at 1khz from the HAL
+ tick and maps each sample in the buffer to a ladder
+ level.  A level counts only if every sample agrees,
+ and becomes the position after JOYSTICK_STABLE_TICKS
+ in a row, so the levels passed on the way from one
+ button to another are never reported.  Position
+ changes go into an event queue as press / release,
+ and a held position repeats after the repeat delay
+ at the repeat rate, both in ms, not game frames.
+
  */ 
 
 
@@ -42,6 +54,13 @@
 #define JOYSTICK_LIMIT_3		3500
 #define JOYSTICK_LIMIT_4		4000
 
+#define JOYSTICK_NUM_CHANNELS			2
+#define JOYSTICK_NUM_SAMPLES			8			//per channel, in the dma buffer
+#define JOYSTICK_STABLE_TICKS			5			//ms
+#define JOYSTICK_REPEAT_DELAY_MS		250
+#define JOYSTICK_REPEAT_RATE_MS			60
+#define JOYSTICK_EVENT_QUEUE_SIZE		16			//power of 2
+
 typedef enum
 {
 	JOYSTICK_UP,
@@ -52,11 +71,28 @@ typedef enum
 	JOYSTICK_NONE
 }JoystickPosition_t;
 
+typedef enum
+{
+	JOYSTICK_EVENT_PRESS,
+	JOYSTICK_EVENT_RELEASE,
+	JOYSTICK_EVENT_REPEAT
+}JoystickEventType_t;
+
+typedef struct
+{
+	JoystickPosition_t position;
+	JoystickEventType_t type;
+	uint32_t tick;				//HAL tick
+}JoystickEvent;
+
 
 
 void Joystick_Config(void);
 JoystickPosition_t Joystick_GetPosition(void);
 uint16_t Joystick_GetRawData(void);
+void Joystick_Tick(void);
+uint8_t Joystick_GetEvent(JoystickEvent* event);
+void Joystick_SetRepeat(uint16_t delayMs, uint16_t rateMs);
 
 
 
@@ -8,7 +8,7 @@
    game.  Also functions for reading and writing
    the player name that got the high score.  High
    score is stored on the EEPROM IC using the I2C
-   interface
+   interface, as a top 10 leaderboard, see score.c
 
 
  */ 
@@ -24,29 +24,47 @@
 
 ///////////////////////////////////////////////////
 //I2C EEPROM IC only has 128 bytes of storage
-#define SCORE_HIGH_SCORE_ADDRESS_LOW		0x10
-#define SCORE_HIGH_SCORE_ADDRESS_HIGH		0x11
-#define SCORE_MAX_LEVEL_ADDRESS				0x12
+//Leaderboard - 2 header pages then the entry pages,
+//one spare page for the insert
+#define SCORE_NUM_ENTRIES					10
+#define SCORE_ENTRY_SIZE					8			//eeprom page size
+#define SCORE_NUM_PAGES						(SCORE_NUM_ENTRIES + 1)
+#define SCORE_HEADER_ADDRESS				0x00
+#define SCORE_ENTRY_ADDRESS					0x10
+#define SCORE_BOARD_SIZE					(SCORE_ENTRY_ADDRESS + (SCORE_NUM_PAGES * SCORE_ENTRY_SIZE))
+
+#define SCORE_INITIALS_SIZE					3
+#define SCORE_MAX							0xFFFFFF	//24 bits
 
 #define SCORE_PLAYER_NAME_SIZE				16
-#define SCORE_PLAYER_NAME_ADDRESS			0x20
 #define SCORE_PLAYER_NAME					(const char*)("Rebecca")
 
+
+typedef struct
+{
+	char initials[SCORE_INITIALS_SIZE + 1];
+	uint32_t score;
+	uint8_t level;
+}ScoreEntry;
+
+
 int Score_Init(void);
+void Score_Reset(void);
+void Score_Process(void);
+void Score_Flush(void);
 
-int Score_SetHighScore(uint16_t value);
-uint16_t Score_GetHighScore(void);
-void Score_ClearHighScore(void);
+int Score_Insert(uint32_t score, uint8_t level);
+uint8_t Score_GetNumEntries(void);
+int Score_GetEntry(uint8_t rank, ScoreEntry* entry);
 
-int Score_SetMaxLevel(uint8_t level);
+uint32_t Score_GetHighScore(void);
 uint8_t Score_GetMaxLevel(void);
-void Score_ClearMaxLevel(void);
 
 void Score_SetPlayerName(uint8_t* buffer, uint8_t len);
 uint8_t Score_GetPlayerName(uint8_t* buffer);
-void Score_ClearPlayerName(void);
 
-void Score_DisplayNewHighScore(uint16_t score, uint8_t level);
+void Score_DisplayNewHighScore(uint32_t score, uint8_t level);
+void Score_DisplayLeaderboard(uint8_t first);
 
 
 
@@ -58,6 +58,9 @@ static uint32_t mGameScore;
 static uint8_t mGameLevel;
 static uint8_t mGameOverFlag;
 
+static int Sprite_Player_Collide(const ImageData* image, uint32_t x, uint32_t y);
+static int Sprite_MaskOverlap(const ImageData* a, const ImageData* b, int32_t dx, int32_t dy);
+
 
 ///////////////////////////////////////////
 //Local delay not linked to a timer
@@ -377,7 +380,6 @@ void Sprite_Player_Move(void)
 void Sprite_Astroid_Move(void)
 {
 	int dx, dy;
-	uint32_t pX, pY, aTop, aBot, aLeft, aRight = 0x00;
 
 
 	for (int i = 0 ; i < NUM_ASTROID ; i++)
@@ -437,19 +439,10 @@ void Sprite_Astroid_Move(void)
 
 			//////////////////////////////////////////////
 			//Collisions - Astroid Hit Player?
-			//astroid index i, center of player
-			//in the footprint of the astroid
-
-			pX = mPlayer.x + mPlayer.sizeX / 2;
-			pY = mPlayer.y + mPlayer.sizeY / 2;
-
-			//center of the player has to be in the footprint of the astroid
-			aTop = mAstroid[i].y;
-			aBot = mAstroid[i].y + mAstroid[i].sizeY;
-			aLeft = mAstroid[i].x;
-			aRight = mAstroid[i].x + mAstroid[i].sizeX;
+			//astroid index i, pixels of the player
+			//image touching pixels of the astroid
 
-			if ((pX >= aLeft) && (pX <= aRight) && (pY >= aTop) && (pY <= aBot))
+			if (Sprite_Player_Collide(mAstroid[i].image, mAstroid[i].x, mAstroid[i].y))
 			{
 				//astroid hit player - remove a player and astroid
 				//play sound, increment score, etc.
@@ -469,6 +462,69 @@ void Sprite_Astroid_Move(void)
 }
 
 
+/////////////////////////////////////////////////////
+//Player Collide
+//Returns 1 if an image at x, y touches the player.
+//Everything wraps around the lcd, so use the
+//shortest offset from the player each way.
+//
+static int Sprite_Player_Collide(const ImageData* image, uint32_t x, uint32_t y)
+{
+	int32_t dx = (int32_t)x - (int32_t)mPlayer.x;
+	int32_t dy = (int32_t)y - (int32_t)mPlayer.y;
+
+	if (dx >= (LCD_WIDTH / 2))
+		dx -= LCD_WIDTH;
+	else if (dx < -(LCD_WIDTH / 2))
+		dx += LCD_WIDTH;
+
+	if (dy >= (LCD_HEIGHT / 2))
+		dy -= LCD_HEIGHT;
+	else if (dy < -(LCD_HEIGHT / 2))
+		dy += LCD_HEIGHT;
+
+	return Sprite_MaskOverlap(mPlayer.image, image, dx, dy);
+}
+
+
+/////////////////////////////////////////////////////
+//Pixel collision test - image b at dx, dy
+//relative to image a.  Boxes first, then each
+//row where they overlap: shift the b mask row
+//into line with a and and them.  One row test
+//covers the whole width (images max 32 wide).
+//An image without a mask is treated as its box.
+//
+static int Sprite_MaskOverlap(const ImageData* a, const ImageData* b, int32_t dx, int32_t dy)
+{
+	if ((dx >= a->xSize) || (dy >= a->ySize) ||
+		((dx + b->xSize) <= 0) || ((dy + b->ySize) <= 0))
+		return 0;
+
+	if ((!a->pMask) || (!b->pMask))
+		return 1;
+
+	int32_t top = (dy > 0) ? dy : 0;
+	int32_t bottom = ((dy + b->ySize) < a->ySize) ? (dy + b->ySize) : a->ySize;
+
+	for (int32_t y = top ; y < bottom ; y++)
+	{
+		uint32_t rowA = a->pMask[y];
+		uint32_t rowB = b->pMask[y - dy];
+
+		if (dx >= 0)
+			rowB >>= dx;
+		else
+			rowA >>= -dx;
+
+		if (rowA & rowB)
+			return 1;
+	}
+
+	return 0;
+}
+
+
 ////////////////////////////////////////////
 //loop over all player missile and
 //enemy missile.  if life == 1
@@ -633,8 +689,6 @@ void Sprite_Drone_Move(void)
 	uint32_t dy = 1;
 	uint32_t dx = 1;
 
-	uint32_t pX, pY, aTop, aBot, aLeft, aRight = 0x00;
-
 	if (mDrone.life == 1)
 	{
 		switch(mDrone.type)
@@ -704,20 +758,11 @@ void Sprite_Drone_Move(void)
 
 		//check to see if the drone hit the player
 		//////////////////////////////////////////////
-		//Collisions - Astroid Hit Player?
-		//astroid index i, center of player
-		//in the footprint of the astroid
-
-		pX = mPlayer.x + mPlayer.sizeX / 2;
-		pY = mPlayer.y + mPlayer.sizeY / 2;
+		//Collisions - Drone Hit Player?
+		//pixels of the player image touching
+		//pixels of the drone
 
-		//center of the player has to be in the footprint of the drone
-		aTop = mDrone.y;
-		aBot = mDrone.y + mDrone.sizeY;
-		aLeft = mDrone.x;
-		aRight = mDrone.x + mDrone.sizeX;
-
-		if ((pX >= aLeft) && (pX <= aRight) && (pY >= aTop) && (pY <= aBot))
+		if (Sprite_Player_Collide(mDrone.image, mDrone.x, mDrone.y))
 		{
 			//drone hit the player
 			Sprite_Drone_ScorePlayerHit();
@@ -1068,23 +1113,35 @@ int Sprite_Drone_ScorePlayerHit(void)
 
 	Sound_Play_PlayerExplode();
 
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp1Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[0], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp2Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[1], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp3Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[2], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp4Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[3], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp5Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[4], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
+	LCD_BeginBatch();
 	LCD_DrawIconWrap(mPlayer.x, mPlayer.y, &bmimgPlayerExp6Bmp, 1);		//refresh
 	LCD_DrawIconWrap(mDrone.x, mDrone.y, ptr[5], 1);						//refresh
+	LCD_EndBatch();
 	Sprite_DummyDelay(500000);
 
 	//remove the drone
@@ -1359,6 +1416,8 @@ void Sprite_UpdateDisplay(void)
 {
 	uint8_t buffer[40];
 
+	LCD_BeginBatch();									//held for LCD_Present
+
 	LCD_ClearMemory(frameBuffer, 0x00);					//clear the memory
 
 	Sprite_Player_Draw();			//draw player
@@ -1366,13 +1425,13 @@ void Sprite_UpdateDisplay(void)
 	Sprite_Missle_Draw();			//draw missiles
 	Sprite_Drone_Draw();			//draw drone
 
-	LCD_Update(frameBuffer);
-
 	//draw score
 	memset(buffer, 0x00, 40);
 	int n = sprintf((char*)buffer, "S:%04d   L:%d  P:%d", (int)mGameScore, mGameLevel, mPlayer.numLives);
 
-	LCD_DrawStringKernLength(0, 1, buffer, n);
+	LCD_DrawText(0, 0, 1, (char*)buffer, n, 1);
+
+	LCD_Present();
 }
 
 
@@ -43,12 +43,22 @@ GND -
 
 #include "Sound.h"
 #include "tim.h"
+#include "AssetPack.h"
+#include "asteroidsIds.h"
+
+//sounds - loaded from the asset pack in Sound_Init
+static SoundData sound_levelUp;
+static SoundData sound_enemyExplode;
+static SoundData sound_playerExplode;
+static SoundData sound_playerShoot;
+static SoundData sound_thruster;
 
 static uint8_t* waveData;
 static uint32_t waveCounter;
 static uint8_t mSoundFlag = 0x00;		//prevent overwrites
 static void Sound_PlaySound(const SoundData *sound, uint8_t preventOverwrite);
 static void Sound_DAC_Write(uint8_t value);
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id);
 
 //////////////////////////////////////////////
 //Configure a timer to run at 11khz and shut it off.
@@ -58,9 +68,41 @@ static void Sound_DAC_Write(uint8_t value);
 //
 void Sound_Init(void)
 {
+	AssetPack pack;
+
 	mSoundFlag = 0x00;
 	HAL_TIM_Base_Stop_IT(&htim3);		//timer3 off
 	Sound_DAC_Write(0x00);				//set all bits low
+
+	//sound arrays are in the linked asset pack,
+	//a sound that's missing has length 0 and
+	//doesn't play
+	AssetPack_OpenLinked(&pack);
+
+	Sound_Load(&pack, &sound_levelUp, ASSET_ID_WAVLEVELUP);
+	Sound_Load(&pack, &sound_enemyExplode, ASSET_ID_WAVENEMYEXPLODE);
+	Sound_Load(&pack, &sound_playerExplode, ASSET_ID_WAVPLAYEREXPLODE);
+	Sound_Load(&pack, &sound_playerShoot, ASSET_ID_WAVPLAYERSHOOT);
+	Sound_Load(&pack, &sound_thruster, ASSET_ID_WAVTHRUSTER);
+}
+
+//////////////////////////////////////////////
+//Point a sound at its data in the asset pack,
+//the sample rate and bit depth are the entry
+//params
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id)
+{
+	const AssetEntry* entry = AssetPack_Find(pack, id);
+
+	memset(sound, 0x00, sizeof(SoundData));
+
+	if ((entry) && (entry->type == ASSET_TYPE_SOUND))
+	{
+		sound->soundData = AssetPack_GetData(pack, entry);
+		sound->length = entry->size;
+		sound->bitDepth = (uint8_t)entry->param[1];
+		sound->sampleRate = entry->param[0];
+	}
 }
 
 /////////////////////////////////////////////
@@ -26,7 +26,7 @@ linux repository. (still under construction?)
 
 typedef struct 
 {
-	uint8_t* soundData;
+	const uint8_t* soundData;
 	uint32_t length;
 	uint8_t bitDepth;
 	uint32_t sampleRate;
@@ -34,12 +34,8 @@ typedef struct
 
 
 
-//sound arrays
-extern const SoundData sound_levelUp;			//ok
-extern const SoundData sound_enemyExplode;
-extern const SoundData sound_playerExplode;
-extern const SoundData sound_playerShoot;
-extern const SoundData sound_thruster;
+//sound arrays are in the asset pack, see
+//AssetPack/Manifest/asteroids.txt
 
 
 
@@ -23,11 +23,32 @@ static const uint8_t _acimgDroneExp2Bmp[] =
 0x2A, 0x40, 0x18, 0x00, 0x04, 0x80, 0x20, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneExp2Bmp[] =
+{
+0x00, 0x80, 0x04, 0x20, 0x12, 0x58, 0x7C, 0x4E, 0x00, 0x10,
+0x56, 0xF2, 0xF0, 0x50, 0x74, 0x60, 0x28, 0x00, 0x50, 0x02,
+0x44, 0x20, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneExp2Bmp[] =
+{
+0x00000000, 0x09301000, 0x23220A00, 0x07008000, 0x0E7E2000, 0x121B8400,
+0x073F2A00, 0x40180000, 0x04802000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneExp2Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneExp2Bmp,
+(uint8_t*)_pgimgDroneExp2Bmp, //page major data
+(uint32_t*)_mkimgDroneExp2Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
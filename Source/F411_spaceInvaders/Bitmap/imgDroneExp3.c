@@ -23,11 +23,32 @@ static const uint8_t _acimgDroneExp3Bmp[] =
 0x2A, 0x40, 0x10, 0x00, 0x04, 0x80, 0x20, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneExp3Bmp[] =
+{
+0x00, 0x80, 0x04, 0x20, 0x12, 0x48, 0x28, 0x06, 0x00, 0x00,
+0x44, 0x80, 0x30, 0x40, 0x04, 0x40, 0x00, 0x00, 0x50, 0x02,
+0x44, 0x20, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneExp3Bmp[] =
+{
+0x00000000, 0x09001000, 0x21220A00, 0x06000000, 0x08082000, 0x12080400,
+0x04252A00, 0x40100000, 0x04802000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneExp3Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneExp3Bmp,
+(uint8_t*)_pgimgDroneExp3Bmp, //page major data
+(uint32_t*)_mkimgDroneExp3Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
@@ -23,11 +23,32 @@ static const uint8_t _acimgDroneExp4Bmp[] =
 0x00, 0x40, 0x10, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgimgDroneExp4Bmp[] =
+{
+0x00, 0x80, 0x04, 0x20, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x44, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x02,
+0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkimgDroneExp4Bmp[] =
+{
+0x00000000, 0x08001000, 0x20220A00, 0x00000000, 0x08002000, 0x10000000,
+0x00200000, 0x40100000, 0x00802000, 0x00000000};
+//end collision mask
+
+
 const ImageData bmimgDroneExp4Bmp = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acimgDroneExp4Bmp,
+(uint8_t*)_pgimgDroneExp4Bmp, //page major data
+(uint32_t*)_mkimgDroneExp4Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
@@ -21,11 +21,28 @@ static const uint8_t _acmissile1Bmp[] =
 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0F, 0x18, 0x18};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgmissile1Bmp[] =
+{
+0x00, 0x00, 0x00, 0xC7, 0xFF, 0x38, 0x20, 0x20};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkmissile1Bmp[] =
+{
+0x18000000, 0x18000000, 0x18000000, 0x0C000000, 0x0C000000, 0x0F000000,
+0x18000000, 0x18000000};
+//end collision mask
+
+
 const ImageData imageMissile1 = {
 8, //xSize
 8, //ySize
 1, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acmissile1Bmp,
+(uint8_t*)_pgmissile1Bmp, //page major data
+(uint32_t*)_mkmissile1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
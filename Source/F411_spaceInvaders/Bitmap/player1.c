@@ -23,11 +23,32 @@ static const uint8_t _acplayer1Bmp[] =
 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF};
 
 
+//page major - generated by bitmap_pagemajor
+static const uint8_t _pgplayer1Bmp[] =
+{
+0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0,
+0xF0, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0,
+0x80, 0x80, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02};
+//end page major
+
+
+//collision mask - generated by bitmap_mask
+static const uint32_t _mkplayer1Bmp[] =
+{
+0x00000000, 0x00000000, 0x00000000, 0x00180000, 0x003C0000, 0x03FFC000,
+0x0FFFF000, 0x3FFFFC00, 0x7FFFFE00, 0xFFFFFF00};
+//end collision mask
+
+
 const ImageData imagePlayer1 = {
 24, //xSize
 10, //ySize
 3, //bytesPerLine
 1, //bits per pixel
 (uint8_t*)_acplayer1Bmp,
+(uint8_t*)_pgplayer1Bmp, //page major data
+(uint32_t*)_mkplayer1Bmp, //collision mask
 };
 /////////////////// End of File  ///////////////////////////
\ No newline at end of file
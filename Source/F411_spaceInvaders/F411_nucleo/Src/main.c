@@ -142,13 +142,12 @@ int main(void)
 	//wait a bit
 	HAL_Delay(100);
 
-	EEPROM_init();					//perform simple write/readback
+	EEPROM_init();					//check the part is there
+	Score_Init();					//load the newest score record
 
 	/////////////////////////////////////////////////
 	//Clear high score. comment out if not needed
-	//	int result = Score_Init();
-	//	if (result < 0)
-	//		while (1){};
+	//	Score_Reset();
 	//////////////////////////////////////////////////
 
 	Sprite_SetGameOverFlag();		//start with game over
@@ -168,6 +167,8 @@ int main(void)
 
 		/* USER CODE BEGIN 3 */
 
+		Score_Process();				//score record write back
+
 		///////////////////////////////////////////////////
 		//Game Over??
 		if (Sprite_GetGameOverFlag() == 1)
@@ -185,28 +186,32 @@ int main(void)
 					HAL_Delay(1000);
 				}
 
-				//update the high score and level here
-				Score_SetHighScore(Sprite_GetGameScore());
-				Score_SetMaxLevel(Sprite_GetGameLevel());
-
 				Sprite_SetGameOverFlag();
 			}
 
+			//add to the leaderboard if it's in the top 10,
+			//written back from Score_Process.  skip the
+			//game over set at power up, nothing was played
+			if (Sprite_GetGameScore() > 0)
+				Score_Insert(Sprite_GetGameScore(), (uint8_t)Sprite_GetGameLevel());
+
 			HAL_Delay(2000);
 		}
 
 
 		while (Sprite_GetGameOverFlag() == 1)
 		{
+			Score_Process();
+
 			uint8_t buffer[SCORE_PLAYER_NAME_SIZE] = {0x00};
-			uint8_t buffer2[16] = {0x00};
-			uint16_t highScore = Score_GetHighScore();
+			uint8_t buffer2[24] = {0x00};
+			uint32_t highScore = Score_GetHighScore();
 			uint8_t level = Score_GetMaxLevel();
 			uint8_t len = Score_GetPlayerName(buffer);
 
 			LCD_DrawStringKernLength(1, 3, buffer, len);
 
-			int n = sprintf((char*)buffer2, "Score:%d", highScore);
+			int n = sprintf((char*)buffer2, "Score:%lu", (unsigned long)highScore);
 			LCD_DrawStringKernLength(2, 3, buffer2, n);
 
 			n = sprintf((char*)buffer2, "Level:%d", level);
@@ -215,8 +220,9 @@ int main(void)
 			LCD_DrawStringKern(5, 3, " Press Button");
 
 			HAL_Delay(1000);
-			LCD_Clear(0x00);
+			Score_DisplayLeaderboard(0);
 			HAL_Delay(1000);
+			LCD_Clear(0x00);
 
 			Sprite_Init();                  //reset and clear all flags
 		}
@@ -340,6 +346,15 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     HAL_IncTick();
   }
 /* USER CODE BEGIN Callback 1 */
+  ////////////////////////////////////////////
+  //Timer TIM1 - HAL tick, 1khz.  Steps the
+  //backlight ramps, the PWM is in hardware, and
+  //decodes the joystick
+  if (htim->Instance == TIM1)
+  {
+	  LCD_BacklightTick();
+	  Joystick_Tick();
+  }
 
   ////////////////////////////////////////////
   //Timer TIM2 - Not Used For Now
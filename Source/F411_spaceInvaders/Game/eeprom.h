@@ -24,20 +24,53 @@
  *  7 - WP - PC9 - NOTE: Tie this to ground!!  no need for extra pin
  *  8 - Vcc - 3.3V
  *
+ *  Writes:
+ *  The part has 8 byte pages, a write that runs past the
+ *  end of a page wraps to the start of the same page.
+ *  Writes are split on page boundaries, one page per bus
+ *  write.  After each page the part goes into an internal
+ *  write cycle (5ms max) and does not ack its address
+ *  until it's done.  Instead of a fixed delay, the next
+ *  access polls the address ack, so the write cycle
+ *  overlaps with whatever the game is doing.
+ *
+ *  Async writes:
+ *  EEPROM_writeAsync copies the data and sends the pages
+ *  with I2C1 TX DMA (DMA1 Stream 6).  EEPROM_Process is
+ *  called from the main loop, it polls the ack between
+ *  pages and calls the completion callback, 0 if ok and
+ *  -1 on error, from the main loop, not the interrupt.
+ *  The blocking functions finish a pending async write
+ *  first.
+ *
  */
 
 #ifndef GAME_EEPROM_H_
 #define GAME_EEPROM_H_
 
-#define EEPROM_TEST_ADDR		0x50
+#include <stdint.h>
+
+#define EEPROM_I2C_ADDRESS			0xA0
+#define EEPROM_SIZE					128
+#define EEPROM_PAGE_SIZE			8
+#define EEPROM_WRITE_TIMEOUT_MS		10			//write cycle is 5ms max
+#define EEPROM_I2C_TIMEOUT_MS		10
+
+
+typedef void (*EEPROM_Callback)(int result);
 
 
 void EEPROM_init(void);
 void EEPROM_writeByte(uint16_t address, uint8_t data);
 uint8_t EEPROM_readByte(uint16_t address);
 
-void EEPROM_writeMultiByte(uint16_t address, uint8_t* data, uint8_t len);
-void EEPROM_readMultiByte(uint16_t address, uint8_t* data, uint8_t len);
+int EEPROM_writeMultiByte(uint16_t address, uint8_t* data, uint8_t len);
+int EEPROM_readMultiByte(uint16_t address, uint8_t* data, uint8_t len);
+
+int EEPROM_writeAsync(uint16_t address, const uint8_t* data, uint8_t len, EEPROM_Callback callback);
+void EEPROM_Process(void);
+uint8_t EEPROM_IsBusy(void);
+int EEPROM_Flush(void);
 
 
 
@@ -9,7 +9,7 @@
  *  to memory.  Once DMA starts, the ADC values from
  *  channels A0 and A1 (see pinout) are available at
  *  any time.  See joystick.h for joystick limits
- *  for up, down... etc.
+ *  for up, down... etc, and the ladder decoding.
  */ 
 ///////////////////////////////////////////////////
 
@@ -19,8 +19,26 @@
 #include "joystick.h"
 #include "adc.h"
 
-//ADC raw data
-volatile uint32_t rawAdcData[2] = {0x00};		//2 channels
+//ADC raw data - circular, channels interleaved
+volatile uint32_t rawAdcData[JOYSTICK_NUM_SAMPLES * JOYSTICK_NUM_CHANNELS];
+
+#define JOYSTICK_CHANNEL		1			//ladder channel, scan rank
+
+//decoder - written by the tick
+static JoystickPosition_t mCandidate = JOYSTICK_NONE;
+static uint8_t mStableCount = 0x00;
+static volatile JoystickPosition_t mPosition = JOYSTICK_NONE;
+static uint32_t mRepeatTick = 0x00;
+static uint16_t mRepeatDelay = JOYSTICK_REPEAT_DELAY_MS;
+static uint16_t mRepeatRate = JOYSTICK_REPEAT_RATE_MS;
+
+//single producer (tick) single consumer queue
+static JoystickEvent mEventQueue[JOYSTICK_EVENT_QUEUE_SIZE];
+static volatile uint8_t mEventHead = 0x00;
+static volatile uint8_t mEventTail = 0x00;
+
+static JoystickPosition_t Joystick_Classify(uint16_t value);
+static void Joystick_PutEvent(JoystickPosition_t position, JoystickEventType_t type, uint32_t tick);
 
 
 ///////////////////////////////////////////////////
@@ -28,8 +46,25 @@ volatile uint32_t rawAdcData[2] = {0x00};		//2 channels
 //and the array that holds the joystick data
 void Joystick_Config(void)
 {
+	mCandidate = JOYSTICK_NONE;
+	mStableCount = 0x00;
+	mPosition = JOYSTICK_NONE;
+	mEventHead = mEventTail = 0x00;
+
 	//init the DMA/ADC transfer
-	HAL_ADC_Start_DMA(&hadc1, (uint32_t*)rawAdcData, 2);		//start the transfers - A0, A1
+	HAL_ADC_Start_DMA(&hadc1, (uint32_t*)rawAdcData, JOYSTICK_NUM_SAMPLES * JOYSTICK_NUM_CHANNELS);		//A0, A1
+
+	//the tick reads the buffer, no need for the
+	//half / full transfer interrupts
+	__HAL_DMA_DISABLE_IT(hadc1.DMA_Handle, DMA_IT_HT | DMA_IT_TC);
+}
+
+
+//////////////////////////////////////////////////
+//Debounced position, updated by Joystick_Tick
+JoystickPosition_t Joystick_GetPosition(void)
+{
+	return mPosition;
 }
 
 
@@ -41,10 +76,8 @@ void Joystick_Config(void)
 //A1 (in case there are discrepancies in the text)
 //
 //Use Channel 1 to make the lcd shields cross-compatible
-JoystickPosition_t Joystick_GetPosition(void)
+static JoystickPosition_t Joystick_Classify(uint16_t value)
 {
-	uint16_t value = (uint16_t)(rawAdcData[1] & 0xFFF);
-
 	if (value < JOYSTICK_LIMIT_0)
 		return JOYSTICK_LEFT;
 	else if ((value >= JOYSTICK_LIMIT_0) && (value < JOYSTICK_LIMIT_1))
@@ -63,8 +96,108 @@ JoystickPosition_t Joystick_GetPosition(void)
 
 uint16_t Joystick_GetRawData()
 {
-	uint16_t value = (uint16_t)rawAdcData[1];
+	uint16_t value = (uint16_t)rawAdcData[JOYSTICK_CHANNEL];
 	return value;
 }
 
 
+//////////////////////////////////////////////////
+//Joystick_Tick
+//Called at 1khz from the TIM1 (HAL tick) period
+//elapsed callback.  Decodes the ladder and runs
+//the autorepeat, see joystick.h
+//
+void Joystick_Tick(void)
+{
+	uint32_t tick = HAL_GetTick();
+	JoystickPosition_t level = Joystick_Classify(rawAdcData[JOYSTICK_CHANNEL] & 0xFFF);
+	uint8_t valid = 1;
+
+	for (int i = 1 ; i < JOYSTICK_NUM_SAMPLES ; i++)
+	{
+		uint32_t value = rawAdcData[(i * JOYSTICK_NUM_CHANNELS) + JOYSTICK_CHANNEL] & 0xFFF;
+
+		if (Joystick_Classify(value) != level)
+		{
+			valid = 0;			//moving between levels
+			break;
+		}
+	}
+
+	if ((valid) && (level == mCandidate))
+	{
+		if (mStableCount < JOYSTICK_STABLE_TICKS)
+			mStableCount++;
+	}
+	else
+	{
+		mCandidate = level;
+		mStableCount = valid;
+	}
+
+	if ((mStableCount >= JOYSTICK_STABLE_TICKS) && (mCandidate != mPosition))
+	{
+		if (mPosition != JOYSTICK_NONE)
+			Joystick_PutEvent(mPosition, JOYSTICK_EVENT_RELEASE, tick);
+
+		mPosition = mCandidate;
+
+		if (mPosition != JOYSTICK_NONE)
+		{
+			Joystick_PutEvent(mPosition, JOYSTICK_EVENT_PRESS, tick);
+			mRepeatTick = tick + mRepeatDelay;
+		}
+	}
+	else if ((mPosition != JOYSTICK_NONE) && (mRepeatRate) && ((int32_t)(tick - mRepeatTick) >= 0))
+	{
+		Joystick_PutEvent(mPosition, JOYSTICK_EVENT_REPEAT, tick);
+		mRepeatTick += mRepeatRate;
+	}
+}
+
+
+//////////////////////////////////////////////////
+//Pop the oldest event.  Returns 1 if there was
+//one, 0 if the queue is empty.
+uint8_t Joystick_GetEvent(JoystickEvent* event)
+{
+	uint8_t tail = mEventTail;
+
+	if (tail == mEventHead)
+		return 0;
+
+	*event = mEventQueue[tail];
+	mEventTail = (tail + 1) & (JOYSTICK_EVENT_QUEUE_SIZE - 1);
+
+	return 1;
+}
+
+
+//////////////////////////////////////////////////
+//Autorepeat delay and rate in ms, rate 0 turns
+//the repeat off
+void Joystick_SetRepeat(uint16_t delayMs, uint16_t rateMs)
+{
+	mRepeatDelay = delayMs;
+	mRepeatRate = rateMs;
+}
+
+
+//////////////////////////////////////////////////
+//Push an event from the tick, dropped if the
+//queue is full
+static void Joystick_PutEvent(JoystickPosition_t position, JoystickEventType_t type, uint32_t tick)
+{
+	uint8_t head = mEventHead;
+	uint8_t next = (head + 1) & (JOYSTICK_EVENT_QUEUE_SIZE - 1);
+
+	if (next == mEventTail)
+		return;
+
+	mEventQueue[head].position = position;
+	mEventQueue[head].type = type;
+	mEventQueue[head].tick = tick;
+	mEventHead = next;
+}
+
+
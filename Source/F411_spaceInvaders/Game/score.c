@@ -10,6 +10,17 @@
  score is stored on the EEPROM IC using the I2C
  interface
 
+ Leaderboard - top SCORE_NUM_ENTRIES scores with
+ initials and level, kept in RAM.  Each entry is
+ one 8 byte page on the part.  A header page holds
+ the entry page of each rank, there are two header
+ slots and the valid one with the newest sequence
+ number is used at boot.  An insert writes the new
+ entry to a page no header uses, then the header to
+ the other slot, so a write cut off by a power
+ failure leaves the old board.  There is one more
+ entry page than ranks for that.
+
  */ 
 
 
@@ -19,186 +30,474 @@
 #include "eeprom.h"
 #include "lcd_12864_dfrobot.h"		//lcd functions
 
+//Board - RAM copy, rank order of entry pages
+static uint8_t mEntries[SCORE_NUM_PAGES][SCORE_ENTRY_SIZE];
+static uint8_t mOrder[SCORE_NUM_ENTRIES];
+static uint8_t mCount = 0x00;
+static uint8_t mInitials[SCORE_INITIALS_SIZE] = {0x00};
+
+//committed - order in the newest header on the part
+static uint8_t mCommitOrder[SCORE_NUM_ENTRIES];
+static uint8_t mCommitCount = 0x00;
+static uint8_t mHeaderSeq = 0x00;
+static uint8_t mHeaderSlot = 0x01;			//first write goes to slot 0
+static uint8_t mLastPage = SCORE_NUM_PAGES - 1;
+
+//write back
+static volatile uint16_t mDirtyPages = 0x00;
+static volatile uint8_t mHeaderDirty = 0x00;
+static volatile uint8_t mWriting = 0x00;
+static uint8_t mWritePage = 0x00;			//page in flight, SCORE_NUM_PAGES for the header
+static uint8_t mPendingOrder[SCORE_NUM_ENTRIES];
+static uint8_t mPendingCount = 0x00;
+
+static uint8_t Score_IsPageUsed(uint8_t page);
+static uint8_t Score_FindPage(void);
+static int Score_LoadHeader(const uint8_t* header, const uint8_t* buffer);
+static void Score_PackHeader(uint8_t* header, uint8_t seq);
+static uint32_t Score_EntryScore(uint8_t page);
+static uint8_t Score_Crc(const uint8_t* data, uint8_t len);
+static void Score_WriteDone(int result);
+
+
 //////////////////////////////////////
-//Initializes the high score, level
-//and player.  returns -1 if any of 
-//them failed, 0 if ok
+//Load the leaderboard.  Reads both
+//headers and the entry pages in one
+//eeprom read and uses the valid header
+//with the newest sequence number.
+//returns 0 if one was found, -1 if the
+//board is empty.
 int Score_Init(void)
 {
-	uint8_t buffer[SCORE_PLAYER_NAME_SIZE] = {0x00};
-	int n = sprintf((char*)buffer, SCORE_PLAYER_NAME);
+	uint8_t buffer[SCORE_BOARD_SIZE] = {0x00};
+	uint8_t buffer2[SCORE_PLAYER_NAME_SIZE] = {0x00};
+	int slot = -1;
+
+	int n = sprintf((char*)buffer2, SCORE_PLAYER_NAME);
+	Score_SetPlayerName(buffer2, n);
 
-	int ret1 = Score_SetHighScore(100);
-	int ret2 = Score_SetMaxLevel(1);
-	Score_SetPlayerName(buffer, n);
+	mCount = mCommitCount = 0x00;
+	mDirtyPages = 0x00;
+	mHeaderDirty = 0x00;
+	mWriting = 0x00;
+	mHeaderSlot = 0x01;
 
-	if ((ret1 < 0) || (ret2 < 0))
+	if (EEPROM_readMultiByte(SCORE_HEADER_ADDRESS, buffer, SCORE_BOARD_SIZE) < 0)
 		return -1;
-	else
-		return 0;
-		
+
+	for (int i = 0 ; i < SCORE_NUM_PAGES ; i++)
+	{
+		for (int j = 0 ; j < SCORE_ENTRY_SIZE ; j++)
+			mEntries[i][j] = buffer[SCORE_ENTRY_ADDRESS + (i * SCORE_ENTRY_SIZE) + j];
+	}
+
+	for (int i = 0 ; i < 2 ; i++)
+	{
+		const uint8_t* header = &buffer[i * SCORE_ENTRY_SIZE];
+
+		if (Score_LoadHeader(header, buffer) < 0)
+			continue;
+
+		//sequence wraps, newer is ahead by less than half
+		if ((slot < 0) || ((int8_t)(header[0] - mHeaderSeq) > 0))
+		{
+			slot = i;
+			mHeaderSeq = header[0];
+		}
+	}
+
+	if (slot < 0)
+		return -1;
+
+	Score_LoadHeader(&buffer[slot * SCORE_ENTRY_SIZE], buffer);
+	mHeaderSlot = slot;
+
+	for (int i = 0 ; i < mCommitCount ; i++)
+		mOrder[i] = mCommitOrder[i];
+
+	mCount = mCommitCount;
+
+	if (mCount)
+		mLastPage = mOrder[0];
+
+	return 0;
+}
+
+
+//////////////////////////////////////
+//Clear the leaderboard, an empty header
+//is written back on the next Score_Process
+void Score_Reset(void)
+{
+	mCount = 0x00;
+	mDirtyPages = 0x00;
+	mHeaderDirty = 1;
 }
 
 
-/////////////////////////////////////////
-//Set High Score
-//Write value to eeprom address low and high
+//////////////////////////////////////
+//Score_Insert
+//Add a score with the current initials.
+//Returns the rank, 0 is the high score,
+//or -1 if it didn't make the board.
+//The entry goes into a page that neither
+//the board nor the header on the part
+//uses, and is committed on the part by
+//one page write and a header flip from
+//Score_Process.
 //
-int Score_SetHighScore(uint16_t value)
+int Score_Insert(uint32_t score, uint8_t level)
 {
-	uint8_t low = value & 0xFF;
-	uint8_t high = (value >> 8) & 0xFF;
-	
-	EEPROM_writeByte(SCORE_HIGH_SCORE_ADDRESS_LOW, low);
-	EEPROM_writeByte(SCORE_HIGH_SCORE_ADDRESS_HIGH, high);
+	uint8_t rank = 0x00;
 
-	//read it back and compare
-	uint8_t resLow = 0x00;
-	uint8_t resHigh = 0x00;
+	if (score > SCORE_MAX)
+		score = SCORE_MAX;
 
-	resLow = EEPROM_readByte(SCORE_HIGH_SCORE_ADDRESS_LOW);
-	resHigh = EEPROM_readByte(SCORE_HIGH_SCORE_ADDRESS_HIGH);
+	while ((rank < mCount) && (Score_EntryScore(mOrder[rank]) >= score))
+		rank++;
 
-	uint16_t result = resLow;
-	result |= (((uint16_t)resHigh) << 8);
+	if (rank >= SCORE_NUM_ENTRIES)
+		return -1;
 
-	//compare
-	if (result != value)
-		return -1;			//error
+	uint8_t page = Score_FindPage();
 
-	return 0;
+	//the board and the old header use all the
+	//pages, commit the last insert first
+	if (page == SCORE_NUM_PAGES)
+	{
+		Score_Flush();
+		page = Score_FindPage();
+
+		if (page == SCORE_NUM_PAGES)
+			return -1;
+	}
+
+	uint8_t* entry = mEntries[page];
+
+	for (int i = 0 ; i < SCORE_INITIALS_SIZE ; i++)
+		entry[i] = mInitials[i];
+
+	entry[3] = score & 0xFF;
+	entry[4] = (score >> 8) & 0xFF;
+	entry[5] = (score >> 16) & 0xFF;
+	entry[6] = level;
+	entry[7] = Score_Crc(entry, SCORE_ENTRY_SIZE - 1);
+
+	//drop the last one if the board is full
+	if (mCount == SCORE_NUM_ENTRIES)
+	{
+		mDirtyPages &= ~(1u << mOrder[SCORE_NUM_ENTRIES - 1]);
+		mCount--;
+	}
+
+	for (int i = mCount ; i > rank ; i--)
+		mOrder[i] = mOrder[i - 1];
+
+	mOrder[rank] = page;
+	mCount++;
+	mLastPage = page;
+
+	mDirtyPages |= (1u << page);
+	mHeaderDirty = 1;
+
+	return rank;
 }
 
-///////////////////////////////////////
-//Get High Score
-//Read low and high bytes from eeprom
-//and return high score.
-uint16_t Score_GetHighScore(void)
+
+//////////////////////////////////////
+//Score_Process
+//Call from the main loop.  Writes the
+//new entry pages, then the header to the
+//other header slot, one async eeprom write
+//at a time.
+//
+void Score_Process(void)
 {
-	uint8_t resLow = 0x00;
-	uint8_t resHigh = 0x00;
+	EEPROM_Process();
 
-	resLow = EEPROM_readByte(SCORE_HIGH_SCORE_ADDRESS_LOW);
-	resHigh = EEPROM_readByte(SCORE_HIGH_SCORE_ADDRESS_HIGH);
+	if ((mWriting) || (EEPROM_IsBusy()))
+		return;
+
+	if (mDirtyPages)
+	{
+		uint8_t page = 0x00;
 
-	uint16_t result = resLow;
-	result |= (((uint16_t)resHigh) << 8);
+		while (!(mDirtyPages & (1u << page)))
+			page++;
 
-	return result;
+		mDirtyPages &= ~(1u << page);
+		mWritePage = page;
+		mWriting = 1;
+
+		if (EEPROM_writeAsync(SCORE_ENTRY_ADDRESS + (page * SCORE_ENTRY_SIZE), mEntries[page], SCORE_ENTRY_SIZE, Score_WriteDone) < 0)
+			Score_WriteDone(-1);
+	}
+	else if (mHeaderDirty)
+	{
+		uint8_t header[SCORE_ENTRY_SIZE] = {0x00};
+
+		Score_PackHeader(header, mHeaderSeq + 1);
+
+		for (int i = 0 ; i < mCount ; i++)
+			mPendingOrder[i] = mOrder[i];
+
+		mPendingCount = mCount;
+		mHeaderDirty = 0x00;
+		mWritePage = SCORE_NUM_PAGES;
+		mWriting = 1;
+
+		if (EEPROM_writeAsync(SCORE_HEADER_ADDRESS + ((mHeaderSlot ^ 0x01) * SCORE_ENTRY_SIZE), header, SCORE_ENTRY_SIZE, Score_WriteDone) < 0)
+			Score_WriteDone(-1);
+	}
 }
 
+
+//////////////////////////////////////
+//Block until the board is committed, at
+//most one try for each page and the header
+void Score_Flush(void)
+{
+	for (int i = 0 ; i <= SCORE_NUM_PAGES + 1 ; i++)
+	{
+		if ((!mWriting) && (!mDirtyPages) && (!mHeaderDirty))
+			break;
+
+		Score_Process();
+		EEPROM_Flush();
+	}
+}
+
+
 ///////////////////////////////////////
-//Reset high score
-void Score_ClearHighScore(void)
+//Number of entries on the board
+uint8_t Score_GetNumEntries(void)
 {
-	Score_SetHighScore(0x00);
+	return mCount;
 }
 
-/////////////////////////////////////////
-//Write max level to EEPROM storage.
-//reads the value back.  returns 0 if
-//OK, -1 if the value does not match
-int Score_SetMaxLevel(uint8_t level)
+///////////////////////////////////////
+//Entry at rank, 0 is the high score.
+//returns -1 if there is no entry there
+int Score_GetEntry(uint8_t rank, ScoreEntry* entry)
 {
-	uint8_t value = level;
-	uint8_t readback = 0x00;
+	if (rank >= mCount)
+		return -1;
 
-	EEPROM_writeByte(SCORE_MAX_LEVEL_ADDRESS, value);		//write
-	readback = EEPROM_readByte(SCORE_MAX_LEVEL_ADDRESS);	//read back
+	const uint8_t* data = mEntries[mOrder[rank]];
 
-	if (readback != value)
-		return -1;
+	for (int i = 0 ; i < SCORE_INITIALS_SIZE ; i++)
+		entry->initials[i] = data[i];
+
+	entry->initials[SCORE_INITIALS_SIZE] = 0x00;
+	entry->score = Score_EntryScore(mOrder[rank]);
+	entry->level = data[6];
 
 	return 0;
 }
 
-///////////////////////////////////////////
-//Get Max Level
-//Reads max level from EEPROM and returns value
-uint8_t Score_GetMaxLevel(void)
+///////////////////////////////////////
+//Get High Score - top of the board
+uint32_t Score_GetHighScore(void)
 {
-	uint8_t readback = EEPROM_readByte(SCORE_MAX_LEVEL_ADDRESS);
-	return readback;
+	return mCount ? Score_EntryScore(mOrder[0]) : 0x00;
 }
 
-//////////////////////////////////////
-//Reset max level
-void Score_ClearMaxLevel(void)
+///////////////////////////////////////////
+//Get Max Level - level of the high score
+uint8_t Score_GetMaxLevel(void)
 {
-	Score_SetMaxLevel(0x00);
+	return mCount ? mEntries[mOrder[0]][6] : 0x00;
 }
 
 //////////////////////////////////////////////////
-//Set player name in EEPROM.
-//stores up to SCORE_PLAYER_NAME_SIZE bytes in 
-//EEPROM.  all bytes not used out of max size
-//are set to 0x00.  len bytes must be less than
-//or equal to max size.
+//Set player name.  The first SCORE_INITIALS_SIZE
+//characters are the initials used for the next
+//Score_Insert, unused ones are set to ' '.
 void Score_SetPlayerName(uint8_t* buffer, uint8_t len)
 {
-	uint8_t numWrites = len;
+	for (int i = 0 ; i < SCORE_INITIALS_SIZE ; i++)
+		mInitials[i] = ((i < len) && (buffer[i])) ? buffer[i] : ' ';
+}
+
+////////////////////////////////////////////////
+//initials of the high score, with 0x00 at the
+//end, return the length including the 0x00.
+//Assumes buffer is large enough to hold the
+//player name
+uint8_t Score_GetPlayerName(uint8_t* buffer)
+{
+	ScoreEntry entry;
 
-	if (len > SCORE_PLAYER_NAME_SIZE)
-		numWrites = SCORE_PLAYER_NAME_SIZE;
-		
-	Score_ClearPlayerName();		//write 0x00 to player name address
+	if (Score_GetEntry(0, &entry) < 0)
+	{
+		buffer[0] = 0x00;
+		return 1;
+	}
 
-	//write numWrites to address - this is resulting in only 8 bytes
-	//then wrapping.  this is due to a page size of 8 bytes, wrapping
-	//after 8 bytes and over write the beginning
-//	EEPROM_writeMultiByte(SCORE_PLAYER_NAME_ADDRESS, buffer, numWrites);
+	for (int i = 0 ; i <= SCORE_INITIALS_SIZE ; i++)
+		buffer[i] = (uint8_t)entry.initials[i];
+
+	return SCORE_INITIALS_SIZE + 1;
+}
 
-	uint8_t* ptr = buffer;
-	uint16_t offset = 0;
 
-	for (int i = 0 ; i < numWrites ; i++)
+////////////////////////////////////////////////
+//Page used by the board or by the header
+//committed on the part
+static uint8_t Score_IsPageUsed(uint8_t page)
+{
+	for (int i = 0 ; i < mCount ; i++)
+	{
+		if (mOrder[i] == page)
+			return 1;
+	}
+
+	for (int i = 0 ; i < mCommitCount ; i++)
 	{
-		EEPROM_writeByte(SCORE_PLAYER_NAME_ADDRESS + (offset++), *ptr++);
+		if (mCommitOrder[i] == page)
+			return 1;
 	}
 
+	if ((mWriting) && (mWritePage == SCORE_NUM_PAGES))
+	{
+		for (int i = 0 ; i < mPendingCount ; i++)
+		{
+			if (mPendingOrder[i] == page)
+				return 1;
+		}
+	}
+
+	return 0;
 }
 
 ////////////////////////////////////////////////
-//read contents of eeprom over max player name
-//size, evaluate the length of non-0x00 chars, 
-//return the length.  Assumes buffer is large
-//enough to hold the player name
-uint8_t Score_GetPlayerName(uint8_t* buffer)
+//Free page - round robin from the last one
+//spreads the writes over the part.
+//SCORE_NUM_PAGES if there is none
+static uint8_t Score_FindPage(void)
+{
+	for (int i = 1 ; i <= SCORE_NUM_PAGES ; i++)
+	{
+		uint8_t page = (mLastPage + i) % SCORE_NUM_PAGES;
+
+		if (!Score_IsPageUsed(page))
+			return page;
+	}
+
+	return SCORE_NUM_PAGES;
+}
+
+////////////////////////////////////////////////
+//Header layout:
+//0 - sequence, 1..5 - entry page of each rank,
+//4 bits each, 6 - count, low 4 bits, and the
+//low 4 bits of the sequence again, 7 - crc8
+//The slot holds the header from two inserts
+//back, so a write torn part way through the
+//page has the sequence of one header at the
+//start and the other at the end, and fails
+//even when the old crc happens to check.
+//Checks a header and its entries, fills the
+//committed order.  -1 if not valid.
+static int Score_LoadHeader(const uint8_t* header, const uint8_t* buffer)
 {
-	uint8_t temp[SCORE_PLAYER_NAME_SIZE] = {0x00};
-	uint8_t counter = 0x00;
+	uint16_t used = 0x00;
+	uint8_t count = header[6] & 0x0F;
 
-	//read contents into temp
-	EEPROM_readMultiByte(SCORE_PLAYER_NAME_ADDRESS, temp, SCORE_PLAYER_NAME_SIZE);
+	if (Score_Crc(header, SCORE_ENTRY_SIZE - 1) != header[SCORE_ENTRY_SIZE - 1])
+		return -1;
+
+	if ((header[6] >> 4) != (header[0] & 0x0F))
+		return -1;
+
+	if (count > SCORE_NUM_ENTRIES)
+		return -1;
 
-	//copy temp into buffer
-	for (uint8_t i = 0 ; i < SCORE_PLAYER_NAME_SIZE ; i++)
+	for (int i = 0 ; i < count ; i++)
 	{
-		buffer[i] = temp[i];
-		counter++;
+		uint8_t page = (header[1 + (i >> 1)] >> ((i & 0x01) * 4)) & 0x0F;
+		const uint8_t* entry = &buffer[SCORE_ENTRY_ADDRESS + (page * SCORE_ENTRY_SIZE)];
 
-		if (buffer[i] == 0x00)
-			break;
+		if ((page >= SCORE_NUM_PAGES) || (used & (1u << page)))
+			return -1;
+
+		if (Score_Crc(entry, SCORE_ENTRY_SIZE - 1) != entry[SCORE_ENTRY_SIZE - 1])
+			return -1;
+
+		used |= (1u << page);
+		mCommitOrder[i] = page;
 	}
 
-	return counter;
+	mCommitCount = count;
+	return 0;
+}
+
+static void Score_PackHeader(uint8_t* header, uint8_t seq)
+{
+	header[0] = seq;
+	header[6] = ((seq & 0x0F) << 4) | mCount;
+
+	for (int i = 0 ; i < mCount ; i++)
+		header[1 + (i >> 1)] |= (mOrder[i] & 0x0F) << ((i & 0x01) * 4);
+
+	header[SCORE_ENTRY_SIZE - 1] = Score_Crc(header, SCORE_ENTRY_SIZE - 1);
 }
 
+////////////////////////////////////////////////
+//Entry layout:
+//0..2 - initials, 3..5 - score, 24 bits little
+//endian, 6 - level, 7 - crc8
+static uint32_t Score_EntryScore(uint8_t page)
+{
+	const uint8_t* entry = mEntries[page];
+	return entry[3] | (((uint32_t)entry[4]) << 8) | (((uint32_t)entry[5]) << 16);
+}
 
 ////////////////////////////////////////////////
-//Score_ClearPlayerName
-//write 0x00 to the player name space in EEPROM
-//Do this as single byte write since page size is 8 bytes
-//
-void Score_ClearPlayerName(void)
+//CRC-8, 0x07, init 0xFF.  An erased (0xFF) or
+//cleared (0x00) page does not check.
+static uint8_t Score_Crc(const uint8_t* data, uint8_t len)
 {
-	uint8_t value[SCORE_PLAYER_NAME_SIZE] = {0x00};
+	uint8_t crc = 0xFF;
 
-	uint8_t* ptr = value;
-	uint16_t offset = 0;
+	for (int i = 0 ; i < len ; i++)
+	{
+		crc ^= data[i];
 
-	for (int i = 0 ; i < SCORE_PLAYER_NAME_SIZE ; i++)
-		EEPROM_writeByte(SCORE_PLAYER_NAME_ADDRESS + (offset++), *ptr++);
+		for (int bit = 0 ; bit < 8 ; bit++)
+			crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+	}
+
+	return crc;
+}
+
+////////////////////////////////////////////////
+//Async write done - from Score_Process.  The
+//header only counts once it's on the part, a
+//failed write is tried again.
+static void Score_WriteDone(int result)
+{
+	mWriting = 0x00;
+
+	if (result < 0)
+	{
+		if (mWritePage == SCORE_NUM_PAGES)
+			mHeaderDirty = 1;
+		else
+			mDirtyPages |= (1u << mWritePage);
+
+		return;
+	}
+
+	if (mWritePage == SCORE_NUM_PAGES)
+	{
+		for (int i = 0 ; i < mPendingCount ; i++)
+			mCommitOrder[i] = mPendingOrder[i];
+
+		mCommitCount = mPendingCount;
+		mHeaderSeq++;
+		mHeaderSlot ^= 0x01;
+	}
 }
 
 
@@ -207,11 +506,11 @@ void Score_ClearPlayerName(void)
 //We have a new high score.
 //Display something on the lcd and update the
 //high score
-void Score_DisplayNewHighScore(uint16_t score, uint8_t level)
+void Score_DisplayNewHighScore(uint32_t score, uint8_t level)
 {
 	uint8_t buffer[SCORE_PLAYER_NAME_SIZE] = {0x00};
-	uint8_t buffer2[16] = {0x00};
-	uint16_t oldScore = Score_GetHighScore();
+	uint8_t buffer2[24] = {0x00};
+	uint32_t oldScore = Score_GetHighScore();
 	uint8_t oldLevel = Score_GetMaxLevel();
 	uint8_t len = Score_GetPlayerName(buffer);
 
@@ -220,7 +519,7 @@ void Score_DisplayNewHighScore(uint16_t score, uint8_t level)
 	LCD_DrawStringKernLength(0, 3, buffer, len);			//name
 	LCD_DrawStringKern(1, 3, "Old Stats");					//header
 
-	int n = sprintf((char*)buffer2, "Score:%d", oldScore);	
+	int n = sprintf((char*)buffer2, "Score:%lu", (unsigned long)oldScore);
 	LCD_DrawStringKernLength(2, 3, buffer2, n);				//old
 
 	n = sprintf((char*)buffer2, "Level:%d", oldLevel);		//old
@@ -228,7 +527,7 @@ void Score_DisplayNewHighScore(uint16_t score, uint8_t level)
 
 	LCD_DrawStringKern(5, 3, "New Stats");					//header
 
-	n = sprintf((char*)buffer2, "Score:%d", score);
+	n = sprintf((char*)buffer2, "Score:%lu", (unsigned long)score);
 	LCD_DrawStringKernLength(6, 3, buffer2, n);				//new
 
 	n = sprintf((char*)buffer2, "Level:%d", level);			//new
@@ -237,3 +536,25 @@ void Score_DisplayNewHighScore(uint16_t score, uint8_t level)
 
 
 
+//////////////////////////////////////////////
+//Show the leaderboard, one rank per line,
+//ranks first to first + 7
+void Score_DisplayLeaderboard(uint8_t first)
+{
+	uint8_t buffer[24] = {0x00};
+	ScoreEntry entry;
+
+	LCD_Clear(0x00);
+
+	for (uint8_t line = 0 ; line < 8 ; line++)
+	{
+		if (Score_GetEntry(first + line, &entry) < 0)
+			break;
+
+		int n = sprintf((char*)buffer, "%2d %s %6lu L%d", first + line + 1, entry.initials, (unsigned long)entry.score, entry.level);
+		LCD_DrawStringKernLength(line, 3, buffer, n);
+	}
+}
+
+
+
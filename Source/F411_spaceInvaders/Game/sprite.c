@@ -29,7 +29,7 @@ drone image 24x10
 
 //player, enemy, missle
 volatile PlayerStruct mPlayer;
-static EnemyStruct mEnemy[NUM_ENEMY];
+static FormationStruct mFormation;
 static MissileStruct mEnemyMissile[NUM_MISSILE];
 static MissileStruct mPlayerMissile[NUM_MISSILE];
 static DroneStruct mDrone;
@@ -42,6 +42,9 @@ static uint16_t mGameScore;
 static uint16_t mGameLevel;
 static uint8_t mGameOverFlag = 0;
 
+static int Sprite_Enemy_GetRowRange(int* top, int* bottom);
+static int Sprite_MaskOverlap(const ImageData* a, const ImageData* b, int32_t dx, int32_t dy);
+
 ///////////////////////////////////////////
 //Local delay that does not follow the
 //
@@ -87,27 +90,28 @@ void Sprite_Player_Init(void)
 
 
 ////////////////////////////////////////////////
-//Init the array of enemy structs
+//Init the enemy formation, all alive
 void Sprite_Enemy_Init(void)
 {
-    uint8_t count = 0;
+    mFormation.x = 0;                                           //origin - top left enemy
+    mFormation.y = 0;
+    mFormation.image = &imageEnemy1;                            //pointer to image data
+    mFormation.points = 30;                                     //points
+    mFormation.sizeX = imageEnemy1.xSize;                       //image width
+    mFormation.sizeY = imageEnemy1.ySize;                       //image height
+    mFormation.pitchX = imageEnemy1.xSize;                      //cell size
+    mFormation.pitchY = imageEnemy1.ySize;
+    mFormation.horizDirection = SPRITE_DIRECTION_LEFT;          //initial direction
+    mFormation.vertDirection = SPRITE_VERTICAL_DOWN;            //moving down
+
     for (int i = 0 ; i < NUM_ENEMY_ROWS ; i++)
-    {
-        for (int j = 0 ; j < NUM_ENEMY_COLS ; j++)
-        {
-            mEnemy[count].life = 1;                                 //life - 1 = alive, 0 = dead
-            mEnemy[count].image = &imageEnemy1;                          //pointer to image data
-            mEnemy[count].points = 30;                              //points
-            mEnemy[count].x = j * imageEnemy1.xSize;              //x position
-            mEnemy[count].y = i * imageEnemy1.ySize;              //y position
-            mEnemy[count].sizeX = imageEnemy1.xSize;                     //image width
-            mEnemy[count].sizeY = imageEnemy1.ySize;                     //image height
-            mEnemy[count].horizDirection = SPRITE_DIRECTION_LEFT;   //initial direction
-            mEnemy[count].vertDirection = SPRITE_VERTICAL_DOWN;     //moving down
-
-            count++;
-        }
-    }
+        mFormation.alive[i] = (uint16_t)((1u << NUM_ENEMY_COLS) - 1);
+
+    for (int i = 0 ; i < NUM_ENEMY_COLS ; i++)
+        mFormation.lowest[i] = NUM_ENEMY_ROWS - 1;      //bottom row fires
+
+    mFormation.columns = (uint16_t)((1u << NUM_ENEMY_COLS) - 1);
+    mFormation.numAlive = NUM_ENEMY;
 }
 
 
@@ -156,24 +160,31 @@ void Sprite_Drone_Init(void)
 //////////////////////////////////////////////////////
 //Set the player position x-direction
 //Uses the joystick on the LCD shield to get left 
-//and right presses.  If pressed left or right, move
-//player by 2 pixels.
+//and right presses.  Each press and autorepeat of
+//left or right moves the player by 2 pixels.
 //Player is left aligned, so max right position
 //is LCD_WIDTH - player.sizeX - 1
 //
 void Sprite_Player_Move(void)
 {
-	JoystickPosition_t pos = Joystick_GetPosition();
-	//move left
-	if (pos == JOYSTICK_LEFT)
-	{
-		if (mPlayer.x > (PLAYER_MIN_X + PLAYER_DX))
-			mPlayer.x -= PLAYER_DX;
-	}
-	else if (pos == JOYSTICK_RIGHT)
+	JoystickEvent event;
+
+	while (Joystick_GetEvent(&event))
 	{
-		if (mPlayer.x < (PLAYER_MAX_X + PLAYER_DX))
-			mPlayer.x += PLAYER_DX;
+		if (event.type == JOYSTICK_EVENT_RELEASE)
+			continue;
+
+		//move left
+		if (event.position == JOYSTICK_LEFT)
+		{
+			if (mPlayer.x > (PLAYER_MIN_X + PLAYER_DX))
+				mPlayer.x -= PLAYER_DX;
+		}
+		else if (event.position == JOYSTICK_RIGHT)
+		{
+			if (mPlayer.x < (PLAYER_MAX_X + PLAYER_DX))
+				mPlayer.x += PLAYER_DX;
+		}
 	}
 	mPlayer.y = PLAYER_DEFAULT_Y;		//just in case...
 
@@ -184,102 +195,90 @@ void Sprite_Player_Move(void)
 }
 
 /////////////////////////////////////
-//loop over all enemy.  if enemy
-//life == 1, move it dx dy.  
+//Move the enemy formation dx dy.  The
+//edges come from the leftmost / rightmost
+//alive column and the top / bottom alive
+//row, so the cost does not depend on the
+//number of enemy.
 void Sprite_Enemy_Move(void)
 {
-    int i, j;    
-    unsigned char flag = 0;
-    
-    for(i = 0 ; i < NUM_ENEMY ; i++)
+    uint16_t columns = mFormation.columns;
+    int top, bottom;
+
+    if ((!columns) || (Sprite_Enemy_GetRowRange(&top, &bottom) < 0))
+        return;
+
+    int first = __builtin_ctz(columns);                 //leftmost alive column
+    int last = 31 - __builtin_clz(columns);             //rightmost
+
+    int32_t left = mFormation.x + (first * mFormation.pitchX);
+    int32_t right = mFormation.x + (last * mFormation.pitchX) + mFormation.sizeX;
+    int32_t upper = mFormation.y + (top * mFormation.pitchY);
+    int32_t lower = mFormation.y + (bottom * mFormation.pitchY) + mFormation.sizeY;
+
+    //moving right
+    if (mFormation.horizDirection == SPRITE_DIRECTION_RIGHT)
     {
-        //moving right
-        if (mEnemy[i].horizDirection == SPRITE_DIRECTION_RIGHT)
+        if (right < SPRITE_MAX_X)                       //right edge
         {
-            //right edge and alive
-            if(((mEnemy[i].x + mEnemy[i].sizeX) < SPRITE_MAX_X) && (mEnemy[i].life == 1))     //right edge
-                mEnemy[i].x += 2;
+            mFormation.x += 2;
+            left += 2;
+            right += 2;
         }
-        
-        //moving left
-        else
-        {
-            if((mEnemy[i].x > SPRITE_MIN_X) && (mEnemy[i].life == 1))     //left edge
-                mEnemy[i].x -= 2;
-        } 
     }
-    
-    //check for direction change - left
-    flag = 0;
-    for (i = 0 ; i < NUM_ENEMY ; i++)
-    {
-        if (((mEnemy[i].x + mEnemy[i].sizeX) >= SPRITE_MAX_X) && (mEnemy[i].life == 1))
-            flag = 1;
-    }
-    
-    if (flag == 1)
+
+    //moving left
+    else
     {
-        for (j = 0 ; j < NUM_ENEMY ; j++)
-            mEnemy[j].horizDirection = SPRITE_DIRECTION_LEFT;
+        if (left > SPRITE_MIN_X)                        //left edge
+        {
+            mFormation.x -= 2;
+            left -= 2;
+            right -= 2;
+        }
     }
-    
+
+    //check for direction change - left
+    if (right >= SPRITE_MAX_X)
+        mFormation.horizDirection = SPRITE_DIRECTION_LEFT;
+
     //check for direction change - right
-    flag = 0;
-    for (i = 0 ; i < NUM_ENEMY ; i++)
-    {
-        if ((mEnemy[i].x <= SPRITE_MIN_X) && (mEnemy[i].life == 1))
-            flag = 1;
-    }
-    if (flag == 1)
+    if (left <= SPRITE_MIN_X)
     {
-        for (j = 0 ; j < NUM_ENEMY ; j++)
+        mFormation.horizDirection = SPRITE_DIRECTION_RIGHT;
+
+        //move down on a direction change, if current
+        //is moving down... continue moving down
+        if (mFormation.vertDirection == SPRITE_VERTICAL_DOWN)
         {
-            mEnemy[j].horizDirection = SPRITE_DIRECTION_RIGHT;
-                        
-            //move down on a direction change, if current
-            //is moving down... continue moving down
-            if (mEnemy[j].vertDirection == SPRITE_VERTICAL_DOWN)
+            if (lower < SPRITE_MAX_Y)
             {
-                if(((mEnemy[j].y + mEnemy[j].sizeY) < SPRITE_MAX_Y) && (mEnemy[j].life == 1))
-                    mEnemy[j].y++;
+                mFormation.y++;
+                upper++;
+                lower++;
             }
-            
-            //move up on a direction change, if current 
-            //is moving up, continue moving up
-            else
+        }
+
+        //move up on a direction change, if current
+        //is moving up, continue moving up
+        else
+        {
+            if (upper > SPRITE_MIN_Y)
             {
-                if((mEnemy[j].y > SPRITE_MIN_Y) && (mEnemy[j].life == 1))
-                    mEnemy[j].y--;
-            }             
-        }            
+                mFormation.y--;
+                upper--;
+                lower--;
+            }
+        }
     }
 
     //check for direction change - up
-    flag = 0;
-    for (i = 0 ; i < NUM_ENEMY ; i++)
-    {
-        if (((mEnemy[i].y + mEnemy[i].sizeY) >= SPRITE_MAX_Y) && (mEnemy[i].life == 1))
-            flag = 1;
-    }
-    if (flag == 1)
-    {
-        for (j = 0 ; j < NUM_ENEMY ; j++)
-            mEnemy[j].vertDirection = SPRITE_VERTICAL_UP;
-    }
-    
-    //check for direction change - down
-    flag = 0;
-    for (i = 0 ; i < NUM_ENEMY ; i++)
-    {
-        if ((mEnemy[i].y <= SPRITE_MIN_Y) && (mEnemy[i].life == 1))
-            flag = 1;
-    }
-    if (flag == 1)
-    {
-        for (j = 0 ; j < NUM_ENEMY ; j++)
-            mEnemy[j].vertDirection = SPRITE_VERTICAL_DOWN;            
-    }
+    if (lower >= SPRITE_MAX_Y)
+        mFormation.vertDirection = SPRITE_VERTICAL_UP;
 
+    //check for direction change - down
+    if (upper <= SPRITE_MIN_Y)
+        mFormation.vertDirection = SPRITE_VERTICAL_DOWN;
 }
 
 ////////////////////////////////////////////
@@ -289,8 +288,6 @@ void Sprite_Enemy_Move(void)
 //and enemy missiles move down (y+)  
 void Sprite_Missle_Move(void)
 {
-    uint16_t mX, mY, bot, top, left, right = 0x00;
-
     for (int i = 0 ; i < NUM_MISSILE ; i++)
     {
         ////////////////////////////////////////////////
@@ -306,63 +303,73 @@ void Sprite_Missle_Move(void)
         //player missile hit an enemy? - Player missile hit
         //the drone??
 
-        //if the missile is alive...
-        //for each live enemy, check the x and y position of the missle, top
-        //center of the missile within the enemy box
-        //
-        //Add player missile hit the drone
-        //
+        //if the missile is alive, box test then pixel
+        //test of the missile image against the drone
+        //and against each live enemy the missile box
+        //touches
         if (mPlayerMissile[i].life == 1)
         {
         	//missile hit drone
         	if (mDrone.life == 1)
         	{
-                mX = mPlayerMissile[i].x + (mPlayerMissile[i].sizeX / 2);
-                mY = mPlayerMissile[i].y;
-
-                bot = mDrone.y + mDrone.sizeY - ENEMY_IMAGE_PADDING;
-                top = mDrone.y + ENEMY_IMAGE_PADDING;
-                left = mDrone.x + ENEMY_IMAGE_PADDING;
-                right = mDrone.x + mDrone.sizeX - ENEMY_IMAGE_PADDING;
+                int32_t dx = (int32_t)mPlayerMissile[i].x - (int32_t)mDrone.x;
+                int32_t dy = (int32_t)mPlayerMissile[i].y - (int32_t)mDrone.y;
 
-                //tip of the missile in the drone box
-                 if ((mX >= left) && (mX <= right) && (mY <= bot) && (mY >= top))
-                 {
+                if (Sprite_MaskOverlap(mDrone.image, mPlayerMissile[i].image, dx, dy))
+                {
                 	 //pass missile index to remove the missile
                 	 //play sound, and explosion sequence.
                 	 Sprite_Score_DroneHit(i);
-                 }
+                }
         	}
 
 
-        	//test for player missile hit enemy
-            for (int j = 0 ; j < NUM_ENEMY ; j++)
+        	//test for player missile hit enemy - missile box
+        	//relative to the formation gives the range of
+        	//cells it touches, then pixel test the live ones
+            int32_t dx = (int32_t)mPlayerMissile[i].x - mFormation.x;
+            int32_t dy = (int32_t)mPlayerMissile[i].y - mFormation.y;
+            int32_t right = dx + (int32_t)mPlayerMissile[i].sizeX - 1;
+            int32_t bottom = dy + (int32_t)mPlayerMissile[i].sizeY - 1;
+
+            if ((mPlayerMissile[i].life == 1) && (right >= 0) && (bottom >= 0))
             {
-                //if the enemy is alive...
-                if (mEnemy[j].life == 1)
+                int32_t col0 = (dx > 0) ? (dx / (int32_t)mFormation.pitchX) : 0;
+                int32_t col1 = right / (int32_t)mFormation.pitchX;
+                int32_t row0 = (dy > 0) ? (dy / (int32_t)mFormation.pitchY) : 0;
+                int32_t row1 = bottom / (int32_t)mFormation.pitchY;
+
+                if (col1 >= NUM_ENEMY_COLS)
+                    col1 = NUM_ENEMY_COLS - 1;
+                if (row1 >= NUM_ENEMY_ROWS)
+                    row1 = NUM_ENEMY_ROWS - 1;
+
+                //lowest row first, the missile is moving up
+                for (int32_t row = row1 ; (row >= row0) && (mPlayerMissile[i].life == 1) ; row--)
                 {
-                    mX = mPlayerMissile[i].x + (mPlayerMissile[i].sizeX / 2);
-                    mY = mPlayerMissile[i].y;
+                    for (int32_t col = col0 ; col <= col1 ; col++)
+                    {
+                        if (!(mFormation.alive[row] & (1u << col)))
+                            continue;
 
-                    bot = mEnemy[j].y + mEnemy[j].sizeY - ENEMY_IMAGE_PADDING;
-                    top = mEnemy[j].y + ENEMY_IMAGE_PADDING;
-                    left = mEnemy[j].x + ENEMY_IMAGE_PADDING;
-                    right = mEnemy[j].x + mEnemy[j].sizeX - ENEMY_IMAGE_PADDING;
+                        if (!Sprite_MaskOverlap(mFormation.image, mPlayerMissile[i].image,
+                                                dx - (col * (int32_t)mFormation.pitchX),
+                                                dy - (row * (int32_t)mFormation.pitchY)))
+                            continue;
 
-                    //tip of the missile in the enemy box?
-                    if ((mX >= left) && (mX <= right) && (mY <= bot) && (mY >= top))
-                    {
                         //score hit!! - pass enemy index and missile index
                         //returns remaining
-                        int rem = Sprite_Score_EnemyHit(j, i);
+                        int rem = Sprite_Score_EnemyHit((row * NUM_ENEMY_COLS) + col, i);
 
                         //if !rem, all enemy is cleared and reset
                         if (!rem)
                         {
                             Sound_Play_LevelUp();           //play a sound
-                            mGameLevel++;                   //increment game level                                        
+                            mGameLevel++;                   //increment game level
                             Sprite_Enemy_Init();            //reset the enemy
                         }
+
+                        break;
                     }
                 }
             }
@@ -379,19 +386,14 @@ void Sprite_Missle_Move(void)
         if ((mEnemyMissile[i].life == 1) && ((mEnemyMissile[i].y + mEnemyMissile[i].sizeY) >= LCD_HEIGHT))
             mEnemyMissile[i].life = 0;
 
-        //enemy missile hit the player... evaluate bottom of missile
-        //with player box
+        //enemy missile hit the player... box test then
+        //pixel test of the missile against the player
         if (mEnemyMissile[i].life == 1)
         {
-            mX = mEnemyMissile[i].x + (mEnemyMissile[i].sizeX / 2);
-            mY = mEnemyMissile[i].y + mEnemyMissile[i].sizeY;
-
-            bot = mPlayer.y + mPlayer.sizeY - PLAYER_IMAGE_PADDING;
-            top = mPlayer.y + PLAYER_IMAGE_PADDING;
-            left = mPlayer.x + PLAYER_IMAGE_PADDING;
-            right = mPlayer.x + mPlayer.sizeX - PLAYER_IMAGE_PADDING;
+            int32_t dx = (int32_t)mEnemyMissile[i].x - (int32_t)mPlayer.x;
+            int32_t dy = (int32_t)mEnemyMissile[i].y - (int32_t)mPlayer.y;
 
-            if ((mX >= left) && (mX <= right) && (mY <= bot) && (mY >= top))
+            if (Sprite_MaskOverlap(mPlayer.image, mEnemyMissile[i].image, dx, dy))
             {
                 //score hit!! - pass the enemy missile index
                 //returns the num players remaining                
@@ -556,20 +558,24 @@ void Sprite_Player_Missle_Launch(void)
 
 ////////////////////////////////////////
 //Launch missile from enemy to player
-//get the num ememy remaining and get
-//a random number.  Fire missile from
-//enemy location.  
+//from the lowest enemy of a random column,
+//or the column nearest the player
+//ENEMY_AIM_CHANCE percent of the time.
 void Sprite_Enemy_Missle_Launch(void)
 {
     int nextMissile = Sprite_Enemy_GetNextMissile();    //next missile
-    int index = Sprite_GetRandomEnemy();                //index of random enemy
+    SpriteAim_t aim = ((rand() % 100) < ENEMY_AIM_CHANCE) ? SPRITE_AIM_PLAYER : SPRITE_AIM_RANDOM;
+    int index = Sprite_GetShooterEnemy(aim);            //index of the shooter
+
+    if ((index >= 0) && (nextMissile >= 0))
+    {
+        int32_t x = mFormation.x + ((index % NUM_ENEMY_COLS) * mFormation.pitchX);
+        int32_t y = mFormation.y + ((index / NUM_ENEMY_COLS) * mFormation.pitchY);
 
-    if (index >= 0)
-    {        
         //set the missile in the array as live
         mEnemyMissile[nextMissile].life = 1;
-        mEnemyMissile[nextMissile].x = mEnemy[index].x + (mEnemy[index].sizeX / 2) - (mEnemyMissile[nextMissile].sizeX / 2);
-        mEnemyMissile[nextMissile].y = mEnemy[index].y + mEnemy[index].sizeY;
+        mEnemyMissile[nextMissile].x = x + (mFormation.sizeX / 2) - (mEnemyMissile[nextMissile].sizeX / 2);
+        mEnemyMissile[nextMissile].y = y + mFormation.sizeY;
 
         Sound_Play_EnemyFire();
     }
@@ -670,10 +676,24 @@ void Sprite_SetGameOverFlag(void)
 int Sprite_Score_EnemyHit(uint8_t enemyIndex, uint8_t missileIndex)
 {
     Sound_Play_EnemyExplode();                                      //play sound
-    mGameScore += mEnemy[enemyIndex].points;                        //increment the score
-    mEnemy[enemyIndex].life = 0;                                    //remove enemy
-    mEnemy[enemyIndex].horizDirection = SPRITE_DIRECTION_RIGHT;     //reset
-    mEnemy[enemyIndex].vertDirection = SPRITE_VERTICAL_DOWN;        //reset
+    mGameScore += mFormation.points;                                //increment the score
+    int row = enemyIndex / NUM_ENEMY_COLS;
+    int col = enemyIndex % NUM_ENEMY_COLS;
+
+    mFormation.alive[row] &= ~(1u << col);                          //remove enemy
+    mFormation.numAlive--;
+
+    //shooter for the column - next alive one up
+    if (mFormation.lowest[col] == row)
+    {
+        while ((row >= 0) && (!(mFormation.alive[row] & (1u << col))))
+            row--;
+
+        mFormation.lowest[col] = row;
+
+        if (row < 0)
+            mFormation.columns &= ~(1u << col);
+    }
     
     mPlayerMissile[missileIndex].life = 0;                          //remove missile
     mPlayerMissile[missileIndex].x = 0;                             //reset x
@@ -756,14 +776,66 @@ uint8_t Sprite_GetNumPlayers(void)
 
 int Sprite_GetNumEnemy(void)
 {
-    int num = 0;
-    for (int i = 0 ; i < NUM_ENEMY ; i++)
+    return mFormation.numAlive;
+}
+
+
+////////////////////////////////////
+//first and last row with an enemy
+//alive, -1 if none
+static int Sprite_Enemy_GetRowRange(int* top, int* bottom)
+{
+    *top = -1;
+    *bottom = -1;
+
+    for (int i = 0 ; i < NUM_ENEMY_ROWS ; i++)
     {
-        if (mEnemy[i].life == 1)
-            num++;
+        if (mFormation.alive[i])
+        {
+            if (*top < 0)
+                *top = i;
+            *bottom = i;
+        }
     }
 
-    return num;
+    return *top;
+}
+
+
+////////////////////////////////////////////
+//Pixel collision test - image b at dx, dy
+//relative to image a.  Boxes first, then each
+//row where they overlap: shift the b mask row
+//into line with a and and them.  One row test
+//covers the whole width (images max 32 wide).
+//An image without a mask is treated as its box.
+static int Sprite_MaskOverlap(const ImageData* a, const ImageData* b, int32_t dx, int32_t dy)
+{
+    if ((dx >= a->xSize) || (dy >= a->ySize) ||
+        ((dx + b->xSize) <= 0) || ((dy + b->ySize) <= 0))
+        return 0;
+
+    if ((!a->pMask) || (!b->pMask))
+        return 1;
+
+    int32_t top = (dy > 0) ? dy : 0;
+    int32_t bottom = ((dy + b->ySize) < a->ySize) ? (dy + b->ySize) : a->ySize;
+
+    for (int32_t y = top ; y < bottom ; y++)
+    {
+        uint32_t rowA = a->pMask[y];
+        uint32_t rowB = b->pMask[y - dy];
+
+        if (dx >= 0)
+            rowB >>= dx;
+        else
+            rowA >>= -dx;
+
+        if (rowA & rowB)
+            return 1;
+    }
+
+    return 0;
 }
 
 
@@ -772,30 +844,60 @@ int Sprite_GetNumEnemy(void)
 //enemy for use in shooting missile
 int Sprite_GetRandomEnemy(void)
 {
-    int numEnemy = Sprite_GetNumEnemy();    //number of enemy
+    return Sprite_GetShooterEnemy(SPRITE_AIM_RANDOM);
+}
 
-    if (numEnemy > 0)
+
+////////////////////////////////////
+//Sprite_GetShooterEnemy
+//returns the index of the lowest enemy
+//in a random non empty column, or in the
+//non empty column nearest the player.
+//-1 if there are no enemy.  Only the
+//column mask is used, not the enemy.
+//
+int Sprite_GetShooterEnemy(SpriteAim_t aim)
+{
+    uint16_t columns = mFormation.columns;
+    int col;
+
+    if (!columns)
+        return -1;
+
+    if (aim == SPRITE_AIM_PLAYER)
     {
-        //get the random index
-        //rand() % (max_number + 1 - minimum_number) + minimum_number
-        //use index as the counter in the live enemy array
-        //0 - first live, 1 - second live,... etc
-        int index = rand() % (numEnemy - 1 + 1 - 0) + 0;
-        int counter = 0;
-
-        for (int i = 0 ; i < NUM_ENEMY ; i++)
-        {
-            if (mEnemy[i].life == 1)
-            {
-                if (index == counter)
-                    return counter;
+        //player center in formation columns
+        int32_t dx = (int32_t)(mPlayer.x + (mPlayer.sizeX / 2)) - mFormation.x;
+        int target = (dx < 0) ? 0 : (int)((uint32_t)dx / mFormation.pitchX);
+
+        if (target > (NUM_ENEMY_COLS - 1))
+            target = NUM_ENEMY_COLS - 1;
+
+        //nearest set bit at or left of target and right of it
+        uint16_t below = columns & (uint16_t)((2u << target) - 1);
+        uint16_t above = columns & (uint16_t)~((2u << target) - 1);
+        int left = below ? (31 - __builtin_clz(below)) : -1;
+        int right = above ? __builtin_ctz(above) : -1;
+
+        if (left < 0)
+            col = right;
+        else if ((right < 0) || ((target - left) <= (right - target)))
+            col = left;
+        else
+            col = right;
+    }
+    else
+    {
+        //n-th set bit, n random
+        int n = rand() % __builtin_popcount(columns);
 
-                counter++;      //increment only for live enemy
-            }
-        }
+        while (n--)
+            columns &= columns - 1;
+
+        col = __builtin_ctz(columns);
     }
-    
-    return -1;
+
+    return (mFormation.lowest[col] * NUM_ENEMY_COLS) + col;
 }
 
 
@@ -808,16 +910,18 @@ void Sprite_UpdateDisplay(void)
 {
     uint8_t buffer[32];
 
-    memset(frameBuffer, 0x00, FRAME_BUFFER_SIZE);
+    LCD_BeginBatch();                   //held for LCD_Present
+    LCD_ClearMemory(frameBuffer, 0x00);
 
     Sprite_Player_Draw();
     Sprite_Enemy_Draw();
     Sprite_Missle_Draw();
     Sprite_Drone_Draw();
-    LCD_Update(frameBuffer);
 
     int n = sprintf((char*)buffer, "L:%2d S:%6d  P:%d", mGameLevel, mGameScore, mPlayer.numLives);
-    LCD_DrawStringKernLength(0, 1, buffer, n);
+    LCD_DrawText(0, 0, 1, (char*)buffer, n, 1);
+
+    LCD_Present();
 }
 
 /////////////////////////////////////
@@ -833,16 +937,22 @@ void Sprite_Player_Draw(void)
 }
 
 ////////////////////////////////////////////
-//Loop through enemy array and draw those
-//enemy that have a life = 1
+//Draw the alive enemy in the formation, one
+//per set bit in each row
 //
 void Sprite_Enemy_Draw(void)
 {
-    for (int i = 0 ; i < NUM_ENEMY ; i++)
+    for (int i = 0 ; i < NUM_ENEMY_ROWS ; i++)
     {
-        if (mEnemy[i].life == 1)
+        uint16_t alive = mFormation.alive[i];
+        int32_t y = mFormation.y + (i * mFormation.pitchY);
+
+        while (alive)
         {
-            LCD_DrawIcon(mEnemy[i].x, mEnemy[i].y, mEnemy[i].image, 0);
+            int col = __builtin_ctz(alive);
+
+            LCD_DrawIcon(mFormation.x + (col * mFormation.pitchX), y, mFormation.image, 0);
+            alive &= alive - 1;
         }
     }
 }
@@ -883,22 +993,15 @@ void Sprite_Drone_Draw(void)
 //flash through a few images on a delay
 void Sprite_Player_Explode(uint16_t x, uint16_t y)
 {
+    LCD_FlashBacklight(3, 300);        //timer runs the flashes
     LCD_DrawIcon(x, y, &bmimgPlayerExp1Bmp, 1);
-	LCD_BacklightOff();
     Sprite_DummyDelay(700000);
     LCD_DrawIcon(x, y, &bmimgPlayerExp2Bmp, 1);
-	LCD_BacklightOn();
     Sprite_DummyDelay(700000);
     LCD_DrawIcon(x, y, &bmimgPlayerExp3Bmp, 1);
-	LCD_BacklightOff();
     Sprite_DummyDelay(700000);
     LCD_DrawIcon(x, y, &bmimgPlayerExp4Bmp, 1);
-	LCD_BacklightOn();
-    Sprite_DummyDelay(700000);
-	LCD_BacklightOff();
-    Sprite_DummyDelay(700000);
-	LCD_BacklightOn();
-    Sprite_DummyDelay(700000);
+    Sprite_DummyDelay(1400000);
 }
 
 ///////////////////////////////////////////////////////
@@ -22,10 +22,10 @@ use the LCD driver files for drawing images on the display.
 
 ///////////////////////////////////
 //defines
-#define NUM_ENEMY		12
+#define NUM_ENEMY		(NUM_ENEMY_ROWS * NUM_ENEMY_COLS)
 #define NUM_ENEMY_ROWS	2
-#define NUM_ENEMY_COLS	6
-#define ENEMY_IMAGE_PADDING   ((uint16_t)2)
+#define NUM_ENEMY_COLS	6				//max 16, one bit per column
+#define ENEMY_AIM_CHANCE		25				//percent of enemy shots from the column nearest the player
 
 #define PLAYER_DEFAULT_LIVES    5
 #define PLAYER_DEFAULT_X        60
@@ -34,8 +34,6 @@ use the LCD driver files for drawing images on the display.
 #define PLAYER_MAX_X			110				//LCD width - player sizex, padding check this
 #define PLAYER_DX				4
 
-#define PLAYER_IMAGE_PADDING   ((uint16_t)2)
-
 #define NUM_MISSILE    8
 
 #define SPRITE_MAX_X        120
@@ -57,6 +55,12 @@ typedef enum
 	SPRITE_VERTICAL_UP,
 }SpriteVerticalDirection_t;
 
+typedef enum
+{
+	SPRITE_AIM_RANDOM,					//any column
+	SPRITE_AIM_PLAYER,					//column nearest the player
+}SpriteAim_t;
+
 //player
 typedef struct
 {
@@ -69,19 +73,30 @@ typedef struct
 }PlayerStruct;
 
 
-//enemy
+//enemy formation - the enemy move as one block.
+//Enemy at row, col is at x + col * pitchX,
+//y + row * pitchY, bit col of alive[row] is set
+//while it's alive.  Enemy index is row * cols + col
+//Only the lowest alive enemy in a column can fire,
+//lowest[col] is its row, -1 for an empty column,
+//and bit col of columns is set if it's not empty.
 typedef struct
 {
-	uint8_t life;
-	uint32_t x;
-	uint32_t y;
+	int32_t x;
+	int32_t y;
+	uint32_t pitchX;
+	uint32_t pitchY;
 	uint32_t sizeX;
 	uint32_t sizeY;
+	uint16_t alive[NUM_ENEMY_ROWS];
+	uint16_t columns;
+	int8_t lowest[NUM_ENEMY_COLS];
+	uint8_t numAlive;
 	uint16_t points;
     SpriteDirection_t horizDirection;
     SpriteVerticalDirection_t vertDirection;
 	const ImageData* image;
-}EnemyStruct;
+}FormationStruct;
 
 
 //missile struct
@@ -145,6 +160,7 @@ uint8_t Sprite_GetNumPlayers(void);
 
 int Sprite_GetNumEnemy(void);
 int Sprite_GetRandomEnemy(void);
+int Sprite_GetShooterEnemy(SpriteAim_t aim);
 
 int Sprite_Player_GetNextMissile(void);
 int Sprite_Enemy_GetNextMissile(void);
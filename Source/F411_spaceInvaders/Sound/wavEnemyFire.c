@@ -1,471 +0,0 @@
-
-#include "Sound.h"
-
-
-const unsigned char _wavEnemyFire[] =
-{
-    0x00, 0x51, 0x60, 0x50, 0xdf, 0xa9, 0xa0, 0xb3,
-    0x29, 0x57, 0x5e, 0x47, 0xd0, 0xa8, 0xa2, 0xb7,
-    0x2b, 0x56, 0x5d, 0x49, 0xda, 0xac, 0xa2, 0xb1,
-    0xf3, 0x4d, 0x5c, 0x52, 0x26, 0xb9, 0xa5, 0xa9,
-    0xc5, 0x36, 0x55, 0x59, 0x47, 0xe1, 0xb2, 0xa5,
-    0xae, 0xd1, 0x3f, 0x56, 0x57, 0x41, 0xda, 0xb2,
-    0xa7, 0xb0, 0xd3, 0x3d, 0x54, 0x56, 0x43, 0xe5,
-    0xb6, 0xa9, 0xae, 0xca, 0x32, 0x4f, 0x55, 0x49,
-    0x21, 0xc0, 0xad, 0xac, 0xbe, 0x16, 0x46, 0x53,
-    0x4f, 0x37, 0xd4, 0xb5, 0xac, 0xb4, 0xd3, 0x36,
-    0x4d, 0x51, 0x45, 0x1b, 0xc2, 0xb0, 0xb0, 0xc1,
-    0x14, 0x42, 0x4f, 0x4c, 0x37, 0xd9, 0xb9, 0xb0,
-    0xb7, 0xd2, 0x31, 0x49, 0x4e, 0x43, 0x1f, 0xc7,
-    0xb4, 0xb4, 0xc4, 0x13, 0x3f, 0x4b, 0x48, 0x32,
-    0xd7, 0xbb, 0xb4, 0xbd, 0xdd, 0x35, 0x47, 0x49,
-    0x39, 0xeb, 0xc2, 0xb6, 0xbc, 0xd4, 0x2d, 0x44,
-    0x47, 0x3a, 0x00, 0xc5, 0xb9, 0xbd, 0xd5, 0x2d,
-    0x42, 0x45, 0x37, 0xeb, 0xc4, 0xba, 0xc2, 0xe1,
-    0x32, 0x42, 0x41, 0x2d, 0xd7, 0xc0, 0xbc, 0xcc,
-    0x1e, 0x3d, 0x43, 0x38, 0xf3, 0xc5, 0xbc, 0xc5,
-    0xf1, 0x38, 0x43, 0x3c, 0x17, 0xc8, 0xbc, 0xc3,
-    0xed, 0x38, 0x43, 0x3a, 0x09, 0xc5, 0xbc, 0xc8,
-    0x1b, 0x3d, 0x43, 0x32, 0xd9, 0xbf, 0xbf, 0xda,
-    0x33, 0x43, 0x3c, 0x09, 0xc4, 0xbc, 0xce, 0x2a,
-    0x42, 0x3e, 0x1a, 0xc6, 0xbc, 0xcd, 0x29, 0x42,
-    0x3e, 0x12, 0xc4, 0xbd, 0xd4, 0x32, 0x43, 0x37,
-    0xdc, 0xbe, 0xc2, 0x09, 0x3d, 0x41, 0x22, 0xc7,
-    0xbd, 0xd4, 0x33, 0x43, 0x32, 0xd1, 0xbc, 0xca,
-    0x29, 0x42, 0x38, 0xda, 0xbd, 0xc6, 0x25, 0x42,
-    0x39, 0xdb, 0xbd, 0xc6, 0x27, 0x42, 0x37, 0xd5,
-    0xbd, 0xcb, 0x2e, 0x43, 0x31, 0xcd, 0xbc, 0xd3,
-    0x36, 0x42, 0x23, 0xc5, 0xbe, 0xea, 0x3e, 0x3e,
-    0xec, 0xbf, 0xc5, 0x24, 0x42, 0x36, 0xd2, 0xbd,
-    0xd0, 0x33, 0x42, 0x27, 0xc6, 0xbe, 0xe3, 0x3c,
-    0x3f, 0xf5, 0xc0, 0xc3, 0x1f, 0x41, 0x38, 0xd7,
-    0xbd, 0xcc, 0x2e, 0x42, 0x2f, 0xcd, 0xbd, 0xd3,
-    0x35, 0x42, 0x28, 0xc8, 0xbd, 0xd8, 0x38, 0x41,
-    0x25, 0xc7, 0xbd, 0xd9, 0x37, 0x42, 0x28, 0xca,
-    0xbd, 0xd1, 0x31, 0x42, 0x32, 0xd3, 0xbd, 0xc7,
-    0x22, 0x40, 0x3c, 0xf2, 0xc2, 0xbf, 0xdc, 0x36,
-    0x42, 0x31, 0xd4, 0xbe, 0xc4, 0xf6, 0x3b, 0x41,
-    0x2b, 0xd0, 0xbe, 0xc5, 0xf6, 0x3b, 0x41, 0x2f,
-    0xd6, 0xbf, 0xc1, 0xde, 0x33, 0x42, 0x3a, 0x00,
-    0xc6, 0xbd, 0xc9, 0x18, 0x3c, 0x41, 0x32, 0xdf,
-    0xc2, 0xbe, 0xcd, 0x1e, 0x3c, 0x41, 0x33, 0xe4,
-    0xc4, 0xbd, 0xc8, 0xf1, 0x36, 0x42, 0x3b, 0x1f,
-    0xcf, 0xbf, 0xc0, 0xd1, 0x20, 0x3b, 0x41, 0x38,
-    0x15, 0xcc, 0xbf, 0xc0, 0xd1, 0x1e, 0x3a, 0x41,
-    0x3b, 0x21, 0xd3, 0xc1, 0xbe, 0xc8, 0xe9, 0x31,
-    0x3f, 0x40, 0x33, 0xf7, 0xcb, 0xbf, 0xbf, 0xcd,
-    0x08, 0x34, 0x40, 0x40, 0x32, 0xf5, 0xcc, 0xbf,
-    0xbf, 0xca, 0xea, 0x30, 0x3e, 0x41, 0x38, 0x1e,
-    0xd4, 0xc3, 0xbe, 0xc4, 0xd7, 0x21, 0x39, 0x41,
-    0x3e, 0x30, 0xee, 0xcc, 0xc0, 0xbf, 0xc8, 0xe1,
-    0x2a, 0x3c, 0x41, 0x3c, 0x2b, 0xe4, 0xc9, 0xbf,
-    0xbf, 0xca, 0xe5, 0x2c, 0x3c, 0x41, 0x3c, 0x2a,
-    0xe3, 0xc9, 0xbf, 0xbf, 0xca, 0xe5, 0x2c, 0x3c,
-    0x41, 0x3c, 0x2b, 0xe5, 0xca, 0xbf, 0xbf, 0xc9,
-    0xe4, 0x2b, 0x3c, 0x41, 0x3c, 0x2c, 0xe5, 0xca,
-    0xbf, 0xc0, 0xca, 0xe5, 0x2c, 0x3c, 0x41, 0x3b,
-    0x29, 0xe0, 0xc8, 0xbf, 0xc1, 0xce, 0xf8, 0x31,
-    0x3e, 0x40, 0x38, 0x20, 0xd6, 0xc4, 0xbf, 0xc4,
-    0xd6, 0x21, 0x38, 0x40, 0x3d, 0x2f, 0xe9, 0xca,
-    0xc0, 0xc1, 0xce, 0x0c, 0x33, 0x3f, 0x3f, 0x33,
-    0x0c, 0xce, 0xc0, 0xc0, 0xcc, 0x07, 0x33, 0x3f,
-    0x3f, 0x31, 0xef, 0xcb, 0xc0, 0xc2, 0xd3, 0x1e,
-    0x38, 0x40, 0x3b, 0x26, 0xd8, 0xc3, 0xbf, 0xc9,
-    0xef, 0x32, 0x3f, 0x3e, 0x2c, 0xdf, 0xc5, 0xbf,
-    0xc8, 0xec, 0x32, 0x3f, 0x3d, 0x29, 0xd9, 0xc3,
-    0xc0, 0xcd, 0x18, 0x38, 0x40, 0x37, 0x14, 0xcc,
-    0xbf, 0xc5, 0xe1, 0x30, 0x3f, 0x3c, 0x24, 0xd2,
-    0xc1, 0xc3, 0xdb, 0x2d, 0x3e, 0x3c, 0x24, 0xd1,
-    0xc0, 0xc4, 0xe0, 0x31, 0x3f, 0x3a, 0x18, 0xcb,
-    0xbf, 0xc8, 0x0e, 0x38, 0x3f, 0x32, 0xe0, 0xc3,
-    0xc1, 0xd7, 0x2c, 0x3e, 0x3b, 0x1a, 0xcb, 0xc0,
-    0xcb, 0x1a, 0x3b, 0x3e, 0x2a, 0xd4, 0xc1, 0xc5,
-    0xed, 0x36, 0x3f, 0x31, 0xdc, 0xc2, 0xc3, 0xdf,
-    0x32, 0x3f, 0x35, 0xe7, 0xc5, 0xc1, 0xd7, 0x2d,
-    0x3f, 0x38, 0x09, 0xc7, 0xc0, 0xd1, 0x26, 0x3d,
-    0x3b, 0x1d, 0xcc, 0xc0, 0xca, 0x18, 0x3a, 0x3e,
-    0x2a, 0xd5, 0xc1, 0xc4, 0xe3, 0x33, 0x3f, 0x35,
-    0xed, 0xc6, 0xc0, 0xcf, 0x1f, 0x3b, 0x3e, 0x2b,
-    0xd7, 0xc2, 0xc3, 0xd8, 0x2b, 0x3d, 0x3c, 0x24,
-    0xd3, 0xc1, 0xc3, 0xd9, 0x2a, 0x3d, 0x3c, 0x29,
-    0xd9, 0xc3, 0xc1, 0xcf, 0x1a, 0x38, 0x3f, 0x35,
-    0x0f, 0xcc, 0xc1, 0xc4, 0xd8, 0x25, 0x3a, 0x3e,
-    0x33, 0x0b, 0xcd, 0xc1, 0xc3, 0xd2, 0x1b, 0x37,
-    0x3e, 0x39, 0x25, 0xda, 0xc6, 0xc1, 0xc6, 0xda,
-    0x23, 0x38, 0x3e, 0x39, 0x26, 0xde, 0xc8, 0xc1,
-    0xc4, 0xd1, 0x0c, 0x31, 0x3d, 0x3e, 0x34, 0x1c,
-    0xd7, 0xc6, 0xc1, 0xc4, 0xd0, 0xf3, 0x2e, 0x3b,
-    0x3e, 0x39, 0x29, 0xe8, 0xce, 0xc3, 0xc1, 0xc6,
-    0xd4, 0x0e, 0x2f, 0x3b, 0x3e, 0x3a, 0x2d, 0x0b,
-    0xd4, 0xc6, 0xc1, 0xc3, 0xcb, 0xdd, 0x1e, 0x33,
-    0x3c, 0x3e, 0x39, 0x2d, 0x0f, 0xd6, 0xc8, 0xc2,
-    0xc2, 0xc8, 0xd5, 0xf9, 0x2b, 0x38, 0x3d, 0x3d,
-    0x36, 0x28, 0xf2, 0xd4, 0xc7, 0xc2, 0xc2, 0xc7,
-    0xd3, 0xec, 0x26, 0x35, 0x3c, 0x3e, 0x3a, 0x30,
-    0x1d, 0xe0, 0xce, 0xc5, 0xc1, 0xc3, 0xca, 0xd7,
-    0x06, 0x29, 0x36, 0x3c, 0x3d, 0x3a, 0x30, 0x1e,
-    0xe1, 0xcf, 0xc6, 0xc2, 0xc3, 0xc8, 0xd4, 0xec,
-    0x25, 0x33, 0x3b, 0x3d, 0x3b, 0x34, 0x26, 0xf1,
-    0xd5, 0xc9, 0xc3, 0xc2, 0xc5, 0xce, 0xde, 0x18,
-    0x2d, 0x38, 0x3d, 0x3d, 0x38, 0x2e, 0x1b, 0xdf,
-    0xce, 0xc6, 0xc2, 0xc3, 0xc9, 0xd5, 0xf1, 0x26,
-    0x34, 0x3b, 0x3d, 0x3b, 0x33, 0x24, 0xec, 0xd3,
-    0xc8, 0xc3, 0xc2, 0xc7, 0xd1, 0xe7, 0x22, 0x32,
-    0x3a, 0x3d, 0x3b, 0x34, 0x26, 0xee, 0xd4, 0xc8,
-    0xc3, 0xc3, 0xc8, 0xd4, 0xef, 0x26, 0x34, 0x3b,
-    0x3d, 0x39, 0x30, 0x1c, 0xdf, 0xcd, 0xc5, 0xc2,
-    0xc5, 0xcf, 0xe2, 0x20, 0x32, 0x3a, 0x3d, 0x3a,
-    0x30, 0x1c, 0xde, 0xcd, 0xc4, 0xc2, 0xc7, 0xd2,
-    0xf0, 0x28, 0x36, 0x3c, 0x3c, 0x35, 0x26, 0xeb,
-    0xd1, 0xc6, 0xc3, 0xc6, 0xd1, 0xea, 0x27, 0x36,
-    0x3c, 0x3b, 0x33, 0x22, 0xe1, 0xcd, 0xc4, 0xc3,
-    0xca, 0xda, 0x1a, 0x31, 0x3a, 0x3c, 0x37, 0x27,
-    0xe9, 0xd0, 0xc5, 0xc3, 0xc9, 0xda, 0x1c, 0x32,
-    0x3b, 0x3c, 0x34, 0x21, 0xde, 0xcb, 0xc3, 0xc5,
-    0xcf, 0xe9, 0x29, 0x38, 0x3c, 0x38, 0x2a, 0xed,
-    0xd0, 0xc5, 0xc4, 0xcc, 0xe1, 0x24, 0x36, 0x3c,
-    0x39, 0x2c, 0xf2, 0xd1, 0xc5, 0xc4, 0xcb, 0xe0,
-    0x24, 0x36, 0x3c, 0x38, 0x2b, 0xed, 0xcf, 0xc5,
-    0xc4, 0xcd, 0xe3, 0x26, 0x37, 0x3c, 0x38, 0x29,
-    0xe9, 0xcf, 0xc5, 0xc4, 0xcd, 0xe4, 0x26, 0x36,
-    0x3c, 0x38, 0x2a, 0xee, 0xd0, 0xc5, 0xc4, 0xcb,
-    0xdd, 0x1f, 0x33, 0x3b, 0x3a, 0x30, 0x18, 0xd8,
-    0xc9, 0xc4, 0xc6, 0xd1, 0xeb, 0x28, 0x36, 0x3b,
-    0x39, 0x2e, 0x13, 0xd7, 0xc9, 0xc4, 0xc5, 0xce,
-    0xe1, 0x20, 0x32, 0x3a, 0x3b, 0x35, 0x26, 0xec,
-    0xd3, 0xc8, 0xc4, 0xc6, 0xcd, 0xde, 0x19, 0x2e,
-    0x38, 0x3b, 0x38, 0x30, 0x1e, 0xe3, 0xd0, 0xc7,
-    0xc4, 0xc5, 0xcc, 0xd8, 0xf5, 0x27, 0x34, 0x3a,
-    0x3b, 0x37, 0x2e, 0x1e, 0xe6, 0xd3, 0xca, 0xc5,
-    0xc4, 0xc7, 0xce, 0xdb, 0x05, 0x26, 0x32, 0x39,
-    0x3b, 0x39, 0x34, 0x2a, 0x18, 0xe3, 0xd3, 0xca,
-    0xc6, 0xc4, 0xc6, 0xca, 0xd2, 0xdf, 0x0e, 0x26,
-    0x31, 0x37, 0x3a, 0x3a, 0x37, 0x31, 0x27, 0x15,
-    0xe3, 0xd5, 0xcc, 0xc7, 0xc5, 0xc5, 0xc7, 0xcc,
-    0xd3, 0xde, 0xf7, 0x21, 0x2d, 0x34, 0x39, 0x3a,
-    0x3a, 0x37, 0x31, 0x29, 0x1c, 0xed, 0xdb, 0xd1,
-    0xcb, 0xc7, 0xc5, 0xc5, 0xc7, 0xca, 0xd0, 0xd9,
-    0xe6, 0x15, 0x25, 0x2e, 0x35, 0x38, 0x3a, 0x3a,
-    0x38, 0x34, 0x2e, 0x24, 0x15, 0xe8, 0xda, 0xd1,
-    0xcb, 0xc7, 0xc5, 0xc5, 0xc6, 0xc9, 0xcd, 0xd4,
-    0xdd, 0xee, 0x1a, 0x26, 0x2f, 0x34, 0x38, 0x3a,
-    0x3a, 0x38, 0x35, 0x30, 0x29, 0x1f, 0x09, 0xe2,
-    0xd7, 0xd0, 0xcb, 0xc7, 0xc6, 0xc5, 0xc7, 0xc9,
-    0xcd, 0xd4, 0xdd, 0xec, 0x17, 0x25, 0x2d, 0x33,
-    0x37, 0x39, 0x3a, 0x39, 0x37, 0x33, 0x2d, 0x24,
-    0x18, 0xec, 0xdd, 0xd4, 0xce, 0xc9, 0xc7, 0xc6,
-    0xc6, 0xc8, 0xcb, 0xd1, 0xd9, 0xe4, 0x0e, 0x20,
-    0x2a, 0x30, 0x35, 0x38, 0x39, 0x39, 0x37, 0x34,
-    0x2f, 0x27, 0x1c, 0xf3, 0xdf, 0xd5, 0xce, 0xca,
-    0xc7, 0xc6, 0xc6, 0xc8, 0xcd, 0xd3, 0xdc, 0xeb,
-    0x18, 0x25, 0x2d, 0x33, 0x37, 0x39, 0x39, 0x38,
-    0x35, 0x30, 0x28, 0x1c, 0xf3, 0xdf, 0xd4, 0xce,
-    0xc9, 0xc7, 0xc6, 0xc7, 0xcb, 0xd0, 0xd9, 0xe6,
-    0x14, 0x24, 0x2d, 0x33, 0x37, 0x39, 0x39, 0x37,
-    0x33, 0x2c, 0x23, 0x11, 0xe4, 0xd7, 0xcf, 0xca,
-    0xc7, 0xc6, 0xc8, 0xcc, 0xd2, 0xdc, 0xf0, 0x1d,
-    0x29, 0x30, 0x35, 0x38, 0x38, 0x37, 0x33, 0x2c,
-    0x21, 0x0b, 0xe1, 0xd4, 0xcd, 0xc9, 0xc7, 0xc7,
-    0xca, 0xd0, 0xd9, 0xea, 0x1a, 0x27, 0x30, 0x35,
-    0x38, 0x38, 0x36, 0x31, 0x29, 0x1c, 0xee, 0xdb,
-    0xd1, 0xcb, 0xc8, 0xc7, 0xc9, 0xcd, 0xd5, 0xe3,
-    0x13, 0x24, 0x2e, 0x34, 0x37, 0x38, 0x36, 0x32,
-    0x2a, 0x1d, 0xee, 0xdb, 0xd1, 0xcb, 0xc8, 0xc7,
-    0xc9, 0xcd, 0xd5, 0xe1, 0x0e, 0x23, 0x2d, 0x33,
-    0x37, 0x38, 0x36, 0x32, 0x2b, 0x20, 0x00, 0xdf,
-    0xd4, 0xcd, 0xc9, 0xc7, 0xc8, 0xcb, 0xd0, 0xd8,
-    0xe5, 0x12, 0x24, 0x2d, 0x33, 0x37, 0x38, 0x37,
-    0x33, 0x2e, 0x25, 0x17, 0xea, 0xdb, 0xd2, 0xcd,
-    0xc9, 0xc8, 0xc8, 0xca, 0xcd, 0xd3, 0xdb, 0xe7,
-    0x12, 0x22, 0x2b, 0x31, 0x35, 0x37, 0x37, 0x36,
-    0x33, 0x2e, 0x27, 0x1c, 0x00, 0xe3, 0xd9, 0xd2,
-    0xcd, 0xca, 0xc8, 0xc8, 0xc8, 0xca, 0xcd, 0xd1,
-    0xd6, 0xdd, 0xe8, 0x0c, 0x1e, 0x27, 0x2e, 0x32,
-    0x35, 0x37, 0x37, 0x36, 0x35, 0x32, 0x2e, 0x29,
-    0x22, 0x18, 0xf7, 0xe5, 0xdc, 0xd6, 0xd1, 0xce,
-    0xcb, 0xc9, 0xc8, 0xc8, 0xc8, 0xc9, 0xcb, 0xcd,
-    0xd0, 0xd4, 0xd8, 0xde, 0xe5, 0xf0, 0x13, 0x1e,
-    0x25, 0x2b, 0x2f, 0x32, 0x34, 0x36, 0x37, 0x37,
-    0x36, 0x35, 0x33, 0x31, 0x2e, 0x2a, 0x25, 0x1f,
-    0x17, 0x08, 0xea, 0xe2, 0xdc, 0xd7, 0xd3, 0xd0,
-    0xce, 0xcc, 0xca, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xca, 0xcb, 0xcd, 0xcf, 0xd1, 0xd4, 0xd7, 0xdb,
-    0xe0, 0xe6, 0xee, 0x0c, 0x18, 0x1f, 0x25, 0x29,
-    0x2d, 0x2f, 0x32, 0x33, 0x35, 0x36, 0x36, 0x36,
-    0x36, 0x35, 0x34, 0x33, 0x31, 0x2e, 0x2c, 0x28,
-    0x25, 0x20, 0x1a, 0x12, 0xf6, 0xea, 0xe3, 0xde,
-    0xd9, 0xd6, 0xd3, 0xd0, 0xce, 0xcd, 0xcb, 0xca,
-    0xca, 0xc9, 0xc9, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
-    0xcf, 0xd1, 0xd3, 0xd6, 0xd9, 0xdd, 0xe2, 0xe8,
-    0xf2, 0x0f, 0x18, 0x1e, 0x23, 0x27, 0x2a, 0x2d,
-    0x2f, 0x31, 0x33, 0x34, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x34, 0x33, 0x31, 0x30, 0x2d, 0x2b, 0x28,
-    0x24, 0x1f, 0x1a, 0x11, 0xf5, 0xe9, 0xe3, 0xde,
-    0xd9, 0xd6, 0xd3, 0xd0, 0xce, 0xcd, 0xcc, 0xcb,
-    0xca, 0xca, 0xca, 0xca, 0xcb, 0xcd, 0xce, 0xd0,
-    0xd3, 0xd6, 0xda, 0xde, 0xe4, 0xec, 0x09, 0x15,
-    0x1c, 0x21, 0x26, 0x29, 0x2c, 0x2f, 0x31, 0x32,
-    0x33, 0x34, 0x35, 0x35, 0x35, 0x34, 0x33, 0x32,
-    0x30, 0x2d, 0x2a, 0x27, 0x23, 0x1d, 0x16, 0x08,
-    0xec, 0xe4, 0xde, 0xd9, 0xd5, 0xd2, 0xd0, 0xce,
-    0xcc, 0xcb, 0xcb, 0xca, 0xcb, 0xcc, 0xcd, 0xcf,
-    0xd1, 0xd5, 0xd9, 0xdd, 0xe4, 0xed, 0x0d, 0x18,
-    0x1e, 0x24, 0x28, 0x2b, 0x2e, 0x30, 0x32, 0x33,
-    0x34, 0x34, 0x34, 0x34, 0x33, 0x31, 0x2f, 0x2c,
-    0x29, 0x25, 0x1f, 0x18, 0x0d, 0xee, 0xe4, 0xde,
-    0xd9, 0xd5, 0xd2, 0xcf, 0xce, 0xcc, 0xcb, 0xcb,
-    0xcb, 0xcc, 0xcd, 0xcf, 0xd1, 0xd4, 0xd7, 0xdc,
-    0xe1, 0xe8, 0xf6, 0x13, 0x1c, 0x22, 0x26, 0x2a,
-    0x2d, 0x2f, 0x31, 0x33, 0x33, 0x34, 0x34, 0x33,
-    0x32, 0x31, 0x2f, 0x2c, 0x29, 0x26, 0x22, 0x1c,
-    0x15, 0x05, 0xec, 0xe4, 0xdf, 0xda, 0xd7, 0xd4,
-    0xd1, 0xd0, 0xce, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcd, 0xce, 0xcf, 0xd1, 0xd2, 0xd5, 0xd7,
-    0xda, 0xdd, 0xe0, 0xe5, 0xea, 0xf1, 0x0b, 0x16,
-    0x1c, 0x21, 0x25, 0x28, 0x2b, 0x2d, 0x2f, 0x30,
-    0x31, 0x32, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32,
-    0x31, 0x30, 0x2f, 0x2d, 0x2c, 0x2a, 0x27, 0x25,
-    0x22, 0x1f, 0x1c, 0x18, 0x13, 0x0c, 0xf5, 0xed,
-    0xe8, 0xe4, 0xe1, 0xde, 0xdc, 0xda, 0xd8, 0xd7,
-    0xd5, 0xd4, 0xd3, 0xd2, 0xd1, 0xd0, 0xcf, 0xcf,
-    0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc,
-    0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xce,
-    0xce, 0xce, 0xcf, 0xcf, 0xcf, 0xd0, 0xd0, 0xd1,
-    0xd1, 0xd2, 0xd2, 0xd3, 0xd4, 0xd4, 0xd5, 0xd6,
-    0xd6, 0xd7, 0xd8, 0xd9, 0xd9, 0xda, 0xdb, 0xdc,
-    0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4,
-    0xe5, 0xe6, 0xe8, 0xe9, 0xeb, 0xec, 0xee, 0xf1,
-    0xf3, 0xf7, 0x06, 0x0e, 0x13, 0x17, 0x1a, 0x1c,
-    0x1e, 0x20, 0x22, 0x24, 0x25, 0x27, 0x28, 0x29,
-    0x2a, 0x2b, 0x2c, 0x2d, 0x2d, 0x2e, 0x2f, 0x2f,
-    0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2e, 0x2e, 0x2d,
-    0x2c, 0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26,
-    0x25, 0x24, 0x23, 0x22, 0x20, 0x1f, 0x1d, 0x1b,
-    0x19, 0x17, 0x15, 0x12, 0x0e, 0x09, 0xf8, 0xf2,
-    0xee, 0xeb, 0xe9, 0xe6, 0xe4, 0xe3, 0xe1, 0xdf,
-    0xde, 0xdc, 0xdb, 0xda, 0xd9, 0xd8, 0xd7, 0xd6,
-    0xd5, 0xd4, 0xd3, 0xd3, 0xd2, 0xd2, 0xd1, 0xd1,
-    0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0,
-    0xd0, 0xd1, 0xd1, 0xd2, 0xd3, 0xd3, 0xd4, 0xd5,
-    0xd6, 0xd8, 0xd9, 0xda, 0xdc, 0xdd, 0xdf, 0xe1,
-    0xe3, 0xe6, 0xe9, 0xec, 0xf1, 0xfa, 0x0b, 0x10,
-    0x13, 0x16, 0x19, 0x1b, 0x1d, 0x1f, 0x20, 0x22,
-    0x23, 0x24, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b,
-    0x2b, 0x2c, 0x2d, 0x2d, 0x2e, 0x2e, 0x2f, 0x2f,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x2f, 0x2f, 0x2e, 0x2e, 0x2d, 0x2c, 0x2c,
-    0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26, 0x24, 0x23,
-    0x21, 0x1f, 0x1d, 0x1b, 0x19, 0x16, 0x13, 0x0f,
-    0x0a, 0xf7, 0xf1, 0xed, 0xea, 0xe7, 0xe5, 0xe3,
-    0xe1, 0xdf, 0xdd, 0xdc, 0xdb, 0xda, 0xd8, 0xd7,
-    0xd7, 0xd6, 0xd5, 0xd4, 0xd4, 0xd3, 0xd3, 0xd2,
-    0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd7,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 0xd8,
-    0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xdb,
-    0xdc, 0xdc, 0xdd, 0xdd, 0xde, 0xde, 0xdf, 0xe0,
-    0xe0, 0xe1, 0xe2, 0xe2, 0xe3, 0xe4, 0xe5, 0xe5,
-    0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xec, 0xed, 0xee,
-    0xf0, 0xf2, 0xf4, 0xf7, 0xfb, 0x05, 0x08, 0x0a,
-    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13,
-    0x14, 0x14, 0x15, 0x16, 0x17, 0x17, 0x18, 0x18,
-    0x19, 0x1a, 0x1a, 0x1b, 0x1b, 0x1c, 0x1c, 0x1d,
-    0x1d, 0x1d, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x20,
-    0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22,
-    0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08,
-    0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06,
-    0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03,
-    0x03, 0x02, 0x02, 0x01, 0x01, 0xfe, 0xfe, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfe, 0xfe, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01
-};
-
-const SoundData wavSoundEnemyFire =
-{
-	(const unsigned char*)_wavEnemyFire,	//pointer to sound data
-    3663, 									//unsigned int length
-};
@@ -1,1346 +0,0 @@
-
-#include "Sound.h"
-
-
-const unsigned char _wavLevelUp[] =
-{
-	0x00, 0x02, 0x05, 0x07, 0x09, 0x0b, 0x0d, 0x0e, 
-	0x0f, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x0e, 0x0b, 
-	0x07, 0xf8, 0xf3, 0xef, 0xec, 0xea, 0xe8, 0xe7, 
-	0xe6, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xea, 0xf3, 
-	0x0e, 0x16, 0x1c, 0x1e, 0x1f, 0x1f, 0x1f, 0x20, 
-	0x20, 0x20, 0x21, 0x21, 0x22, 0x22, 0x1d, 0x16, 
-	0x05, 0xea, 0xe2, 0xdc, 0xdb, 0xda, 0xda, 0xda, 
-	0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xde, 
-	0xe6, 0xf6, 0x17, 0x20, 0x27, 0x29, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 
-	0x26, 0x1d, 0x0e, 0xe8, 0xdd, 0xd5, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 
-	0xcf, 0xd2, 0xda, 0xe5, 0x0d, 0x1f, 0x29, 0x30, 
-	0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 
-	0x34, 0x34, 0x33, 0x2c, 0x23, 0x14, 0xe7, 0xda, 
-	0xd1, 0xca, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 
-	0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xd0, 0xda, 0xea, 
-	0x19, 0x27, 0x31, 0x38, 0x39, 0x39, 0x3a, 0x3a, 
-	0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3b, 0x38, 0x31, 
-	0x27, 0x17, 0xe6, 0xd6, 0xcd, 0xc5, 0xc3, 0xc2, 
-	0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 
-	0xc2, 0xc9, 0xd3, 0xe0, 0x10, 0x25, 0x31, 0x3a, 
-	0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 
-	0x41, 0x41, 0x41, 0x3b, 0x32, 0x26, 0x10, 0xdf, 
-	0xd0, 0xc7, 0xbf, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 
-	0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xbe, 0xc6, 0xd0, 
-	0xde, 0x10, 0x27, 0x33, 0x3c, 0x43, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3e, 0x36, 0x2b, 0x1a, 0xe5, 0xd4, 0xc9, 0xc1, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xc3, 0xcb, 0xd7, 0xea, 0x1d, 
-	0x2d, 0x37, 0x3e, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3a, 0x32, 
-	0x26, 0x10, 0xdf, 0xd1, 0xc8, 0xc0, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbe, 0xc5, 0xce, 0xda, 0xf1, 0x21, 0x2e, 0x38, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x40, 0x39, 0x30, 0x24, 0x09, 
-	0xdd, 0xd0, 0xc7, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xc7, 
-	0xd0, 0xdc, 0xfd, 0x23, 0x2f, 0x38, 0x3f, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3f, 0x38, 0x2f, 0x22, 0xf4, 0xdb, 0xcf, 
-	0xc6, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc1, 0xc8, 0xd2, 0xe0, 
-	0x11, 0x26, 0x32, 0x3a, 0x41, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3d, 
-	0x35, 0x2b, 0x1b, 0xe8, 0xd6, 0xcb, 0xc3, 0xbd, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbd, 0xc4, 0xcc, 0xd8, 0xed, 0x1f, 0x2d, 
-	0x37, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3f, 0x38, 0x2e, 0x20, 
-	0xf0, 0xd9, 0xcd, 0xc4, 0xbd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xc3, 
-	0xcc, 0xd8, 0xee, 0x20, 0x2f, 0x39, 0x40, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3f, 0x36, 0x2b, 0x1a, 0xe4, 0xd3, 0xc8, 
-	0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc0, 0xc8, 0xd3, 0xe4, 0x1b, 
-	0x2c, 0x37, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x37, 0x2b, 
-	0x19, 0xe2, 0xd1, 0xc6, 0xbe, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc2, 
-	0xcc, 0xd9, 0xfc, 0x26, 0x34, 0x3e, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x42, 0x39, 0x2d, 0x1a, 0xe2, 0xd0, 0xc5, 0xbc, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbc, 0xc4, 0xd0, 0xe2, 0x1c, 0x2f, 0x3b, 
-	0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3b, 0x30, 0x1d, 0xe2, 0xcf, 
-	0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbe, 0xc7, 0xd6, 0xf5, 0x28, 
-	0x37, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3d, 0x31, 0x1e, 0xe1, 
-	0xcd, 0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc1, 0xcd, 0xe1, 0x20, 
-	0x33, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3e, 0x31, 0x1a, 0xdc, 
-	0xc9, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbc, 0xc8, 0xda, 0x18, 0x31, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3c, 0x2d, 0x08, 0xd3, 0xc3, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc5, 0xd6, 0x15, 0x31, 0x3f, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x37, 0x22, 0xde, 0xc9, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 
-	0xd7, 0x1a, 0x34, 0x42, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x3d, 0x2c, 0xec, 
-	0xce, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc7, 0xde, 0x24, 0x39, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x41, 0x30, 0x08, 0xd0, 0xbe, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xce, 0xf3, 
-	0x2f, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x42, 0x31, 0x0c, 0xd0, 0xbe, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 
-	0xda, 0x23, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x42, 0x30, 0xf8, 0xce, 0xbd, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 
-	0xcf, 0x0f, 0x32, 0x43, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x40, 0x2d, 0xea, 0xcb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 
-	0xe2, 0x29, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3c, 0x28, 0xe3, 0xc9, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 0xd7, 0x1c, 
-	0x36, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x39, 0x24, 0xdf, 0xc9, 0xbc, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc1, 0xd0, 0xf1, 0x2c, 0x3c, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x41, 0x35, 0x20, 0xdf, 
-	0xcb, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xcb, 
-	0xdd, 0x1c, 0x31, 0x3d, 0x44, 0x44, 0x44, 0x43, 
-	0x3d, 0x32, 0x20, 0xe4, 0xd0, 0xc6, 0xc0, 0xbd, 
-	0xbe, 0xc2, 0xc9, 0xd5, 0xea, 0x21, 0x30, 0x39, 
-	0x3d, 0x3e, 0x3c, 0x37, 0x2e, 0x20, 0xef, 0xda, 
-	0xcf, 0xca, 0xc8, 0xc9, 0xcd, 0xd3, 0xde, 0xf4, 
-	0x1e, 0x29, 0x2f, 0x32, 0x31, 0x2e, 0x28, 0x1f, 
-	0x0e, 0xe8, 0xde, 0xda, 0xd8, 0xda, 0xdc, 0xe1, 
-	0xe8, 0xf6, 0x13, 0x1a, 0x1e, 0x1f, 0x1d, 0x19, 
-	0x15, 0x0d, 0xfc, 0xf7, 0xfb, 0x0d, 0x12, 0x14, 
-	0x13, 0x11, 0x0b, 0xf3, 0xeb, 0xe5, 0xe1, 0xdf, 
-	0xe0, 0xe2, 0xe8, 0x08, 0x1b, 0x25, 0x2b, 0x2e, 
-	0x2d, 0x29, 0x21, 0x0d, 0xe2, 0xd6, 0xcf, 0xcc, 
-	0xcc, 0xd0, 0xd9, 0xed, 0x21, 0x30, 0x38, 0x3c, 
-	0x3b, 0x36, 0x2b, 0x12, 0xd9, 0xca, 0xc2, 0xbe, 
-	0xc0, 0xc7, 0xd5, 0x0f, 0x2f, 0x3d, 0x44, 0x44, 
-	0x43, 0x39, 0x25, 0xde, 0xc7, 0xbb, 0xbb, 0xbb, 
-	0xbe, 0xcd, 0xfa, 0x33, 0x44, 0x44, 0x44, 0x44, 
-	0x3d, 0x22, 0xd3, 0xbd, 0xbb, 0xbb, 0xbb, 0xbd, 
-	0xd4, 0x28, 0x43, 0x44, 0x44, 0x44, 0x44, 0x31, 
-	0xdb, 0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xd0, 0x2b, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x2b, 0xce, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbd, 0xeb, 0x3d, 0x44, 0x44, 
-	0x44, 0x44, 0x38, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xe4, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x33, 
-	0xd1, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0x22, 0x44, 
-	0x44, 0x44, 0x44, 0x41, 0xf1, 0xbc, 0xbb, 0xbb, 
-	0xbb, 0xbe, 0x0b, 0x42, 0x44, 0x44, 0x44, 0x40, 
-	0xf1, 0xbd, 0xbb, 0xbb, 0xbb, 0xc5, 0x1f, 0x44, 
-	0x44, 0x44, 0x44, 0x31, 0xd4, 0xbb, 0xbb, 0xbb, 
-	0xbe, 0xe1, 0x36, 0x44, 0x44, 0x44, 0x36, 0xe5, 
-	0xc2, 0xbb, 0xbb, 0xc3, 0xdf, 0x2e, 0x41, 0x44, 
-	0x3f, 0x2c, 0xe2, 0xc9, 0xc1, 0xc4, 0xd0, 0xf7, 
-	0x2d, 0x38, 0x37, 0x2e, 0x18, 0xdd, 0xd1, 0xd0, 
-	0xd7, 0xe7, 0x19, 0x24, 0x26, 0x20, 0x13, 0xf0, 
-	0xeb, 0xf1, 0x04, 0x09, 0xf4, 0xe9, 0xe5, 0xe3, 
-	0xea, 0x16, 0x26, 0x2c, 0x29, 0x1a, 0xe0, 0xd0, 
-	0xcb, 0xd0, 0xe8, 0x2a, 0x3b, 0x3d, 0x31, 0xf4, 
-	0xca, 0xbd, 0xbf, 0xd1, 0x25, 0x40, 0x44, 0x41, 
-	0x23, 0xca, 0xbb, 0xbb, 0xc4, 0x1d, 0x44, 0x44, 
-	0x44, 0x2b, 0xc6, 0xbb, 0xbb, 0xc0, 0x27, 0x44, 
-	0x44, 0x44, 0x22, 0xbb, 0xbb, 0xbb, 0xc8, 0x39, 
-	0x44, 0x44, 0x44, 0xd7, 0xbb, 0xbb, 0xbb, 0x0e, 
-	0x44, 0x44, 0x44, 0x25, 0xbb, 0xbb, 0xbb, 0xd2, 
-	0x44, 0x44, 0x44, 0x34, 0xbe, 0xbb, 0xbb, 0xcb, 
-	0x41, 0x44, 0x44, 0x33, 0xbf, 0xbb, 0xbb, 0xd3, 
-	0x42, 0x44, 0x44, 0x24, 0xbc, 0xbb, 0xbb, 0x03, 
-	0x44, 0x44, 0x3f, 0xde, 0xbb, 0xbb, 0xcc, 0x2e, 
-	0x44, 0x41, 0x23, 0xcc, 0xbf, 0xca, 0x10, 0x35, 
-	0x38, 0x26, 0xdf, 0xd0, 0xd5, 0xed, 0x22, 0x26, 
-	0x1b, 0xf0, 0xec, 0xf6, 0x08, 0xef, 0xe6, 0xe6, 
-	0x13, 0x27, 0x2a, 0x15, 0xd6, 0xcd, 0xd8, 0x24, 
-	0x3b, 0x37, 0xf2, 0xc4, 0xbe, 0xd9, 0x38, 0x44, 
-	0x39, 0xd2, 0xbb, 0xbb, 0x18, 0x44, 0x44, 0x25, 
-	0xbb, 0xbb, 0xc8, 0x41, 0x44, 0x43, 0xc6, 0xbb, 
-	0xbb, 0x31, 0x44, 0x44, 0xdd, 0xbb, 0xbb, 0x11, 
-	0x44, 0x44, 0x1b, 0xbb, 0xbb, 0xdd, 0x44, 0x44, 
-	0x27, 0xbb, 0xbb, 0xda, 0x44, 0x44, 0x21, 0xbb, 
-	0xbb, 0xe9, 0x44, 0x44, 0xef, 0xbb, 0xbb, 0x24, 
-	0x44, 0x44, 0xd3, 0xbb, 0xc2, 0x34, 0x44, 0x32, 
-	0xc7, 0xbc, 0xdb, 0x38, 0x3c, 0x03, 0xc7, 0xce, 
-	0x1d, 0x32, 0x23, 0xdf, 0xda, 0xed, 0x1b, 0x13, 
-	0x02, 0x18, 0x1a, 0xe6, 0xd6, 0xe6, 0x2b, 0x30, 
-	0xea, 0xc7, 0xd0, 0x2f, 0x40, 0x1a, 0xbf, 0xc2, 
-	0x2d, 0x44, 0x2d, 0xbb, 0xbb, 0x2b, 0x44, 0x36, 
-	0xbb, 0xbb, 0x2a, 0x44, 0x39, 0xbb, 0xbb, 0x31, 
-	0x44, 0x37, 0xbb, 0xbb, 0x3b, 0x44, 0x29, 0xbb, 
-	0xbb, 0x44, 0x44, 0xe1, 0xbb, 0xc4, 0x44, 0x44, 
-	0xc2, 0xbb, 0xee, 0x44, 0x3e, 0xbb, 0xbb, 0x3a, 
-	0x44, 0xf5, 0xbb, 0xcc, 0x44, 0x41, 0xc4, 0xbb, 
-	0x27, 0x44, 0x16, 0xbf, 0xd5, 0x39, 0x31, 0xd2, 
-	0xcf, 0x1e, 0x2b, 0xf4, 0xdd, 0xf2, 0x13, 0xf7, 
-	0x16, 0x1c, 0xde, 0xd8, 0x23, 0x30, 0xde, 0xc7, 
-	0x1a, 0x3e, 0x07, 0xbd, 0xe1, 0x44, 0x2a, 0xbb, 
-	0xcc, 0x44, 0x3c, 0xbb, 0xbf, 0x44, 0x44, 0xbb, 
-	0xbb, 0x44, 0x44, 0xbb, 0xbb, 0x44, 0x44, 0xbb, 
-	0xbb, 0x44, 0x44, 0xbb, 0xbb, 0x44, 0x44, 0xbb, 
-	0xbb, 0x44, 0x44, 0xbb, 0xbb, 0x44, 0x44, 0xbb, 
-	0xc1, 0x44, 0x36, 0xbb, 0xd5, 0x44, 0x18, 0xbb, 
-	0x1b, 0x44, 0xd6, 0xbb, 0x34, 0x41, 0xc7, 0xc6, 
-	0x3a, 0x2d, 0xc6, 0xe0, 0x36, 0xfd, 0xd1, 0x17, 
-	0x24, 0xe9, 0xee, 0x0d, 0xf3, 0x1d, 0x10, 0xd5, 
-	0x13, 0x32, 0xd6, 0xce, 0x36, 0x2a, 0xbf, 0xed, 
-	0x44, 0xd2, 0xbb, 0x40, 0x38, 0xbb, 0xe7, 0x44, 
-	0xca, 0xbb, 0x44, 0x3a, 0xbb, 0x1a, 0x44, 0xbb, 
-	0xbb, 0x44, 0x28, 0xbb, 0x3d, 0x44, 0xbb, 0xcb, 
-	0x44, 0xca, 0xbb, 0x44, 0x37, 0xbb, 0x37, 0x44, 
-	0xbb, 0xcc, 0x44, 0xc4, 0xbb, 0x44, 0x23, 0xbb, 
-	0x40, 0x41, 0xbb, 0x21, 0x44, 0xbb, 0xd2, 0x44, 
-	0xcd, 0xc3, 0x43, 0xeb, 0xc0, 0x3a, 0x23, 0xc3, 
-	0x29, 0x27, 0xd0, 0x1a, 0x26, 0xde, 0xfe, 0x17, 
-	0xf4, 0x08, 0xe5, 0x1b, 0x17, 0xd6, 0x22, 0x25, 
-	0xca, 0x25, 0x31, 0xc3, 0x24, 0x38, 0xbc, 0x24, 
-	0x3f, 0xbb, 0x22, 0x43, 0xbb, 0x24, 0x44, 0xbb, 
-	0x26, 0x44, 0xbb, 0x2d, 0x44, 0xbb, 0x33, 0x44, 
-	0xbb, 0x3c, 0x44, 0xbb, 0x44, 0x3c, 0xbb, 0x44, 
-	0x2e, 0xbb, 0x44, 0x04, 0xbb, 0x44, 0xd1, 0xbb, 
-	0x44, 0xbf, 0xc1, 0x44, 0xbb, 0xdb, 0x44, 0xbb, 
-	0x28, 0x44, 0xbb, 0x43, 0x33, 0xbb, 0x44, 0xe8, 
-	0xbb, 0x44, 0xc4, 0xd0, 0x44, 0xbb, 0x1c, 0x3d, 
-	0xbb, 0x36, 0x1e, 0xc2, 0x3d, 0xda, 0xd5, 0x37, 
-	0xcf, 0x10, 0x27, 0xd3, 0x21, 0x0c, 0xe5, 0x1c, 
-	0xee, 0xf8, 0x0a, 0x12, 0xec, 0xeb, 0x25, 0xd9, 
-	0x1b, 0x1e, 0xd2, 0x31, 0xdc, 0xdb, 0x39, 0xc4, 
-	0x29, 0x27, 0xc3, 0x42, 0xcb, 0xdd, 0x43, 0xbb, 
-	0x3d, 0x19, 0xbd, 0x44, 0xbb, 0x21, 0x3f, 0xbb, 
-	0x44, 0xc9, 0xce, 0x44, 0xbb, 0x44, 0x11, 0xbb, 
-	0x44, 0xbb, 0x39, 0x34, 0xbb, 0x44, 0xbb, 0x1c, 
-	0x44, 0xbb, 0x44, 0xbb, 0xe2, 0x44, 0xbb, 0x44, 
-	0xc1, 0xd0, 0x44, 0xbb, 0x44, 0xc4, 0xd1, 0x44, 
-	0xbb, 0x44, 0xc3, 0xd5, 0x44, 0xbb, 0x44, 0xc2, 
-	0xe0, 0x44, 0xbb, 0x44, 0xbc, 0x1b, 0x3a, 0xbb, 
-	0x44, 0xbb, 0x31, 0x24, 0xc0, 0x44, 0xbb, 0x3a, 
-	0xe4, 0xd2, 0x3e, 0xbd, 0x3c, 0xd2, 0x08, 0x29, 
-	0xcc, 0x37, 0xce, 0x24, 0xf8, 0xe0, 0x25, 0xdc, 
-	0x22, 0xe4, 0x0b, 0x0e, 0xf5, 0xef, 0x19, 0xe4, 
-	0x15, 0x0e, 0xe0, 0x29, 0xd4, 0x2a, 0xda, 0x15, 
-	0x1f, 0xd3, 0x36, 0xc5, 0x39, 0xd0, 0x18, 0x29, 
-	0xc7, 0x3f, 0xbd, 0x42, 0xc5, 0x29, 0x1e, 0xc6, 
-	0x44, 0xbb, 0x44, 0xbb, 0x3a, 0xe2, 0x3f, 0x3b, 
-	0x2e, 0x44, 0x14, 0x44, 0xfc, 0x44, 0x25, 0x0c, 
-	0x34, 0xbb, 0x2d, 0xbb, 0xf6, 0xbb, 0xc5, 0xbf, 
-	0xbb, 0xf5, 0xbb, 0x3a, 0xbe, 0x40, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x15, 
-	0xd2, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc6, 0xdf, 0x26, 0x3c, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3d, 0x29, 
-	0xe4, 0xc9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xca, 0xe4, 0x29, 0x3c, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3e, 
-	0x2c, 0xee, 0xce, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xd5, 0x15, 0x31, 
-	0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3b, 0x29, 0xea, 0xce, 0xc0, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc1, 0xd1, 
-	0xf1, 0x2a, 0x3b, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x40, 0x33, 0x1e, 0xde, 0xca, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc4, 0xd3, 0xf2, 0x29, 0x39, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x37, 
-	0x26, 0xea, 0xd1, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xca, 0xda, 0x14, 
-	0x2d, 0x3a, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x40, 0x35, 0x26, 0xf0, 0xd5, 0xc7, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbe, 0xc7, 0xd4, 0xea, 0x23, 0x32, 0x3d, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3b, 
-	0x31, 0x21, 0xe9, 0xd4, 0xc8, 0xbf, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xc7, 0xd3, 
-	0xe6, 0x1e, 0x2e, 0x39, 0x40, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x43, 0x3d, 0x34, 0x28, 0x11, 
-	0xde, 0xcf, 0xc6, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbd, 0xc3, 0xcb, 0xd7, 0xec, 0x20, 
-	0x2e, 0x38, 0x3f, 0x43, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x41, 0x3b, 0x33, 0x29, 0x16, 0xe3, 0xd3, 
-	0xc9, 0xc2, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbd, 0xc2, 0xca, 0xd3, 0xe2, 0x14, 0x26, 0x32, 
-	0x39, 0x3f, 0x43, 0x44, 0x44, 0x44, 0x44, 0x42, 
-	0x3d, 0x37, 0x2f, 0x23, 0x0c, 0xdf, 0xd3, 0xca, 
-	0xc3, 0xbf, 0xbc, 0xbb, 0xbb, 0xbb, 0xbc, 0xc0, 
-	0xc5, 0xcc, 0xd5, 0xe3, 0x12, 0x25, 0x2f, 0x37, 
-	0x3c, 0x40, 0x43, 0x44, 0x44, 0x43, 0x40, 0x3c, 
-	0x37, 0x30, 0x25, 0x15, 0xe5, 0xd7, 0xce, 0xc7, 
-	0xc2, 0xbf, 0xbc, 0xbb, 0xbc, 0xbd, 0xc0, 0xc4, 
-	0xca, 0xd2, 0xdd, 0xf0, 0x1d, 0x29, 0x32, 0x38, 
-	0x3c, 0x40, 0x41, 0x42, 0x42, 0x40, 0x3d, 0x39, 
-	0x33, 0x2b, 0x20, 0x09, 0xe1, 0xd5, 0xcd, 0xc7, 
-	0xc3, 0xc0, 0xbe, 0xbd, 0xbe, 0xc0, 0xc3, 0xc7, 
-	0xcd, 0xd5, 0xe0, 0xf7, 0x1e, 0x29, 0x31, 0x37, 
-	0x3b, 0x3e, 0x40, 0x40, 0x40, 0x3e, 0x3b, 0x37, 
-	0x32, 0x2a, 0x1f, 0x0b, 0xe2, 0xd7, 0xcf, 0xc9, 
-	0xc5, 0xc2, 0xc0, 0xbf, 0xc0, 0xc1, 0xc4, 0xc8, 
-	0xcd, 0xd4, 0xde, 0xf0, 0x1b, 0x27, 0x2f, 0x35, 
-	0x39, 0x3c, 0x3e, 0x3f, 0x3f, 0x3d, 0x3b, 0x37, 
-	0x32, 0x2b, 0x22, 0x12, 0xe7, 0xda, 0xd2, 0xcc, 
-	0xc7, 0xc4, 0xc2, 0xc0, 0xc1, 0xc2, 0xc4, 0xc8, 
-	0xcc, 0xd3, 0xdc, 0xe9, 0x14, 0x23, 0x2c, 0x32, 
-	0x37, 0x3a, 0x3d, 0x3e, 0x3e, 0x3d, 0x3b, 0x38, 
-	0x33, 0x2d, 0x25, 0x19, 0xef, 0xdf, 0xd5, 0xce, 
-	0xc9, 0xc6, 0xc3, 0xc2, 0xc1, 0xc2, 0xc4, 0xc7, 
-	0xcb, 0xd1, 0xd9, 0xe4, 0x0a, 0x1e, 0x28, 0x2f, 
-	0x35, 0x39, 0x3b, 0x3d, 0x3d, 0x3d, 0x3b, 0x38, 
-	0x34, 0x2f, 0x28, 0x1d, 0x07, 0xe3, 0xd8, 0xd1, 
-	0xcb, 0xc7, 0xc4, 0xc2, 0xc2, 0xc2, 0xc4, 0xc6, 
-	0xca, 0xcf, 0xd6, 0xe0, 0xf2, 0x1a, 0x26, 0x2e, 
-	0x33, 0x38, 0x3b, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 
-	0x36, 0x30, 0x29, 0x20, 0x0f, 0xe6, 0xda, 0xd2, 
-	0xcc, 0xc8, 0xc4, 0xc2, 0xc2, 0xc2, 0xc3, 0xc6, 
-	0xc9, 0xcf, 0xd5, 0xdf, 0xef, 0x1a, 0x25, 0x2d, 
-	0x34, 0x38, 0x3b, 0x3d, 0x3e, 0x3d, 0x3c, 0x39, 
-	0x36, 0x31, 0x29, 0x20, 0x0e, 0xe5, 0xd9, 0xd1, 
-	0xcb, 0xc7, 0xc4, 0xc2, 0xc1, 0xc2, 0xc3, 0xc6, 
-	0xca, 0xcf, 0xd7, 0xe1, 0xfc, 0x1d, 0x28, 0x30, 
-	0x36, 0x3a, 0x3d, 0x3e, 0x3f, 0x3e, 0x3c, 0x39, 
-	0x35, 0x2f, 0x27, 0x1a, 0xef, 0xde, 0xd4, 0xcd, 
-	0xc8, 0xc4, 0xc2, 0xc0, 0xc1, 0xc2, 0xc4, 0xc7, 
-	0xcc, 0xd3, 0xdc, 0xec, 0x19, 0x26, 0x2f, 0x35, 
-	0x3a, 0x3d, 0x3f, 0x40, 0x3f, 0x3e, 0x3b, 0x37, 
-	0x31, 0x28, 0x1c, 0xf2, 0xde, 0xd4, 0xcc, 0xc7, 
-	0xc3, 0xc0, 0xbf, 0xbf, 0xc0, 0xc3, 0xc6, 0xcc, 
-	0xd3, 0xde, 0xf2, 0x1d, 0x29, 0x32, 0x38, 0x3d, 
-	0x40, 0x41, 0x42, 0x41, 0x3e, 0x3b, 0x35, 0x2e, 
-	0x24, 0x13, 0xe5, 0xd7, 0xce, 0xc7, 0xc3, 0xbf, 
-	0xbe, 0xbd, 0xbe, 0xc0, 0xc4, 0xc9, 0xd0, 0xda, 
-	0xec, 0x1b, 0x29, 0x32, 0x39, 0x3e, 0x41, 0x43, 
-	0x43, 0x43, 0x40, 0x3c, 0x37, 0x2f, 0x24, 0x0f, 
-	0xe1, 0xd4, 0xcb, 0xc4, 0xc0, 0xbd, 0xbb, 0xbb, 
-	0xbd, 0xbf, 0xc4, 0xca, 0xd3, 0xe0, 0x0f, 0x25, 
-	0x30, 0x38, 0x3e, 0x42, 0x44, 0x44, 0x44, 0x43, 
-	0x3f, 0x3a, 0x32, 0x27, 0x14, 0xe2, 0xd3, 0xca, 
-	0xc3, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xc3, 
-	0xca, 0xd4, 0xe3, 0x18, 0x2a, 0x35, 0x3d, 0x42, 
-	0x44, 0x44, 0x44, 0x44, 0x43, 0x3f, 0x38, 0x2e, 
-	0x1e, 0xea, 0xd6, 0xca, 0xc2, 0xbd, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc1, 0xc8, 0xd3, 0xe4, 0x1b, 
-	0x2c, 0x38, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3e, 0x36, 0x29, 0x13, 0xdd, 0xce, 0xc4, 
-	0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xc4, 
-	0xcf, 0xdf, 0x18, 0x2d, 0x39, 0x42, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3f, 0x35, 0x26, 0xf3, 
-	0xd6, 0xc8, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbf, 0xc9, 0xd8, 0x0f, 0x2b, 0x39, 0x43, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x36, 
-	0x25, 0xea, 0xd1, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc2, 0xcf, 0xe6, 0x24, 0x36, 
-	0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 
-	0x38, 0x26, 0xe7, 0xcf, 0xc1, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc5, 0xd6, 0x13, 0x30, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3c, 0x2b, 0xed, 0xcf, 0xc0, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 0xdb, 0x20, 0x37, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 
-	0x33, 0x14, 0xd3, 0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc7, 0xdf, 0x27, 0x3c, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x27, 
-	0xde, 0xc5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc5, 0xde, 0x28, 0x3e, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x37, 0x17, 0xd0, 0xbd, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xd5, 
-	0x22, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x35, 0x00, 0xca, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc8, 0xf2, 0x34, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x37, 0x0f, 0xca, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcf, 
-	0x1e, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x40, 0x23, 0xd2, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xd0, 0x22, 0x3f, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x37, 0xf4, 0xc6, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 0x10, 0x3a, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0xeb, 0xc4, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xd3, 0x28, 
-	0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x1a, 
-	0xca, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xd4, 
-	0x2a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x35, 
-	0xe5, 0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc9, 
-	0x17, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 
-	0xe9, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xd0, 
-	0x24, 0x41, 0x44, 0x44, 0x44, 0x44, 0x40, 0x24, 
-	0xd1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcb, 0x17, 
-	0x3b, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x20, 0xd1, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xd5, 0x25, 0x3e, 
-	0x44, 0x44, 0x44, 0x42, 0x2e, 0xe2, 0xc5, 0xbb, 
-	0xbb, 0xbb, 0xbf, 0xd2, 0x1c, 0x38, 0x44, 0x44, 
-	0x44, 0x3e, 0x2a, 0xe1, 0xc8, 0xbc, 0xbb, 0xbd, 
-	0xc7, 0xde, 0x25, 0x39, 0x42, 0x44, 0x3e, 0x31, 
-	0x13, 0xd4, 0xc6, 0xc0, 0xc2, 0xc9, 0xda, 0x19, 
-	0x30, 0x3a, 0x3c, 0x38, 0x2c, 0x13, 0xda, 0xce, 
-	0xc9, 0xcb, 0xd2, 0xe3, 0x1b, 0x2b, 0x32, 0x31, 
-	0x2c, 0x1f, 0xee, 0xdc, 0xd6, 0xd5, 0xda, 0xe4, 
-	0x0a, 0x1d, 0x23, 0x24, 0x20, 0x17, 0xfb, 0xec, 
-	0xe7, 0xea, 0xed, 0xf3, 0x03, 0x09, 0x05, 0xf6, 
-	0xf3, 0xf3, 0x09, 0x15, 0x1d, 0x1f, 0x1c, 0x13, 
-	0xee, 0xe1, 0xdb, 0xda, 0xdf, 0xee, 0x1d, 0x29, 
-	0x2e, 0x2c, 0x22, 0xef, 0xd7, 0xcd, 0xcc, 0xd2, 
-	0xe5, 0x23, 0x34, 0x3a, 0x37, 0x29, 0xe9, 0xcd, 
-	0xc3, 0xc2, 0xcd, 0xeb, 0x2f, 0x3f, 0x42, 0x3b, 
-	0x24, 0xd5, 0xc0, 0xbb, 0xbf, 0xd2, 0x25, 0x40, 
-	0x44, 0x44, 0x33, 0xdf, 0xbf, 0xbb, 0xbb, 0xc9, 
-	0x20, 0x43, 0x44, 0x44, 0x39, 0xde, 0xbb, 0xbb, 
-	0xbb, 0xc8, 0x29, 0x44, 0x44, 0x44, 0x33, 0xcc, 
-	0xbb, 0xbb, 0xbb, 0xd8, 0x3e, 0x44, 0x44, 0x44, 
-	0xf5, 0xbb, 0xbb, 0xbb, 0xc4, 0x30, 0x44, 0x44, 
-	0x44, 0x26, 0xbc, 0xbb, 0xbb, 0xbe, 0x2c, 0x44, 
-	0x44, 0x44, 0x25, 0xbb, 0xbb, 0xbb, 0xc2, 0x36, 
-	0x44, 0x44, 0x44, 0xea, 0xbb, 0xbb, 0xbb, 0xd9, 
-	0x44, 0x44, 0x44, 0x39, 0xc3, 0xbb, 0xbb, 0xbf, 
-	0x33, 0x44, 0x44, 0x44, 0xd6, 0xbb, 0xbb, 0xbb, 
-	0x23, 0x44, 0x44, 0x44, 0xe2, 0xbb, 0xbb, 0xbb, 
-	0x21, 0x44, 0x44, 0x44, 0xda, 0xbb, 0xbb, 0xc1, 
-	0x2e, 0x44, 0x44, 0x37, 0xcc, 0xbb, 0xbb, 0xd5, 
-	0x3b, 0x44, 0x44, 0x16, 0xc0, 0xbb, 0xc5, 0x22, 
-	0x43, 0x44, 0x2c, 0xd0, 0xbe, 0xc4, 0xed, 0x37, 
-	0x3e, 0x2e, 0xde, 0xc8, 0xcb, 0xe5, 0x2c, 0x34, 
-	0x28, 0xe7, 0xd4, 0xd7, 0xed, 0x1f, 0x24, 0x19, 
-	0xef, 0xeb, 0xf1, 0x01, 0xf0, 0xe8, 0xee, 0x19, 
-	0x23, 0x1f, 0xe9, 0xd6, 0xd5, 0xfa, 0x2d, 0x33, 
-	0x1c, 0xd1, 0xc6, 0xd6, 0x2c, 0x40, 0x33, 0xd7, 
-	0xbd, 0xc4, 0x21, 0x44, 0x42, 0xeb, 0xbb, 0xbb, 
-	0xf7, 0x44, 0x44, 0x1b, 0xbb, 0xbb, 0xe3, 0x44, 
-	0x44, 0x20, 0xbb, 0xbb, 0xe2, 0x44, 0x44, 0x11, 
-	0xbb, 0xbb, 0x18, 0x44, 0x44, 0xd8, 0xbb, 0xbb, 
-	0x36, 0x44, 0x44, 0xbe, 0xbb, 0xc1, 0x44, 0x44, 
-	0x29, 0xbb, 0xbb, 0x21, 0x44, 0x44, 0xc3, 0xbb, 
-	0xc3, 0x44, 0x44, 0x1b, 0xbb, 0xbb, 0x37, 0x44, 
-	0x3a, 0xbb, 0xbb, 0x0d, 0x44, 0x44, 0xc2, 0xbb, 
-	0xd9, 0x44, 0x44, 0xcf, 0xbb, 0xd4, 0x44, 0x43, 
-	0xd4, 0xbb, 0xd7, 0x3e, 0x3c, 0xd7, 0xc0, 0xe1, 
-	0x37, 0x2f, 0xda, 0xce, 0xf4, 0x2d, 0x20, 0xdf, 
-	0xdf, 0x10, 0x18, 0x04, 0x11, 0x10, 0xe9, 0xe1, 
-	0x12, 0x2a, 0x16, 0xd0, 0xd7, 0x2e, 0x34, 0xd9, 
-	0xc3, 0x0e, 0x42, 0x27, 0xbc, 0xc8, 0x40, 0x44, 
-	0xc8, 0xbb, 0x28, 0x44, 0x10, 0xbb, 0xd4, 0x44, 
-	0x3c, 0xbb, 0xbb, 0x44, 0x44, 0xbb, 0xbb, 0x3f, 
-	0x44, 0xc9, 0xbb, 0x2f, 0x44, 0xd8, 0xbb, 0x16, 
-	0x44, 0x14, 0xbb, 0xe4, 0x44, 0x1d, 0xbb, 0xe5, 
-	0x44, 0x17, 0xbb, 0xf2, 0x44, 0xe7, 0xbb, 0x23, 
-	0x44, 0xd4, 0xbb, 0x32, 0x44, 0xc6, 0xbb, 0x3e, 
-	0x40, 0xc0, 0xc9, 0x40, 0x2a, 0xc0, 0xe5, 0x3c, 
-	0xeb, 0xcb, 0x20, 0x2a, 0xdf, 0xe1, 0x1f, 0x10, 
-	0xf1, 0xfc, 0xe6, 0x15, 0x23, 0xdd, 0xdd, 0x31, 
-	0x16, 0xc7, 0x24, 0x3b, 0xc7, 0xd0, 0x44, 0xf3, 
-	0xbb, 0x38, 0x41, 0xbb, 0xdc, 0x44, 0xc8, 0xbb, 
-	0x44, 0x2b, 0xbb, 0x3b, 0x44, 0xbb, 0xe0, 0x44, 
-	0xbb, 0xbb, 0x44, 0xdb, 0xbb, 0x44, 0x32, 0xbb, 
-	0x43, 0x44, 0xbb, 0x2b, 0x44, 0xbb, 0xe7, 0x44, 
-	0xbb, 0xcf, 0x44, 0xbb, 0xc9, 0x44, 0xc2, 0xc7, 
-	0x44, 0xc9, 0xc8, 0x44, 0xcd, 0xcd, 0x41, 0xd2, 
-	0xd6, 0x38, 0xd7, 0xe2, 0x2e, 0xdd, 0xf3, 0x1a, 
-	0xee, 0xf8, 0xe5, 0x24, 0xe6, 0xde, 0x32, 0xd2, 
-	0xe6, 0x3a, 0xc0, 0x26, 0x34, 0xbb, 0x3f, 0x14, 
-	0xbb, 0x44, 0xc4, 0xcd, 0x44, 0xbb, 0x35, 0x3d, 
-	0xbb, 0x44, 0xcd, 0xbd, 0x44, 0xbb, 0x37, 0x3f, 
-	0xbb, 0x44, 0xc0, 0xcb, 0x44, 0xbb, 0x44, 0xf6, 
-	0xbb, 0x44, 0xbb, 0x38, 0x2e, 0xbb, 0x44, 0xbb, 
-	0x2a, 0x33, 0xbb, 0x44, 0xbe, 0x26, 0x29, 0xc2, 
-	0x40, 0xc8, 0x27, 0x14, 0xd5, 0x30, 0xd7, 0x20, 
-	0xef, 0xf4, 0xf4, 0x1f, 0xdf, 0x22, 0xe4, 0xeb, 
-	0x2a, 0xc8, 0x3e, 0xc2, 0x36, 0xdb, 0xde, 0x39, 
-	0xbb, 0x44, 0xbb, 0x44, 0xc6, 0x19, 0x33, 0xbb, 
-	0x44, 0xbb, 0x44, 0xbb, 0x44, 0xc6, 0x15, 0x34, 
-	0xbb, 0x44, 0xbb, 0x44, 0xbb, 0x44, 0xbb, 0x43, 
-	0xcd, 0x17, 0x2a, 0xc6, 0x44, 0xbb, 0x44, 0xbb, 
-	0x44, 0xbb, 0x44, 0xbb, 0x43, 0xc2, 0x35, 0xd3, 
-	0x24, 0xe3, 0x10, 0x0b, 0xed, 0x15, 0xea, 0x15, 
-	0xee, 0x08, 0x10, 0xe9, 0x1f, 0xdd, 0x27, 0xd4, 
-	0x30, 0xca, 0x3a, 0xc8, 0x3a, 0xc3, 0x3e, 0xbf, 
-	0x42, 0xbb, 0x44, 0xbe, 0x41, 0xbf, 0x3f, 0xc2, 
-	0x3b, 0xcc, 0x2b, 0xe7, 0xea, 0x25, 0xcf, 0x38, 
-	0xbd, 0x44, 0xbb, 0x44, 0xbb, 0x44, 0xbb, 0x44, 
-	0xbb, 0x44, 0xbb, 0x43, 0xe7, 0x44, 0x32, 0x44, 
-	0x40, 0x36, 0x3f, 0xd2, 0x37, 0xbb, 0x23, 0xbb, 
-	0xec, 0xbb, 0xde, 0xc7, 0x2d, 0x40, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3f, 0x2b, 0xe2, 0xc7, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 0xe5, 0x2c, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x2c, 
-	0xe6, 0xc9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc7, 0xe0, 0x29, 0x3d, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x41, 0x2f, 0xf0, 0xcd, 0xbd, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc4, 0xda, 0x22, 0x39, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x43, 0x34, 0x17, 0xd4, 
-	0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xd1, 
-	0x0f, 0x31, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3b, 0x27, 0xe2, 0xc9, 0xbc, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc8, 0xde, 0x23, 0x38, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x41, 0x34, 0x1a, 0xd8, 0xc5, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xcd, 0xe8, 
-	0x28, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3f, 
-	0x30, 0x14, 0xd6, 0xc5, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc1, 0xcf, 0xe9, 0x28, 0x39, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x3e, 0x31, 0x19, 0xda, 0xc8, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xcb, 0xdf, 
-	0x1f, 0x33, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x40, 
-	0x36, 0x25, 0xe8, 0xd0, 0xc4, 0xbc, 0xbb, 0xbb, 
-	0xbb, 0xbd, 0xc6, 0xd4, 0xf2, 0x28, 0x37, 0x40, 
-	0x44, 0x44, 0x44, 0x43, 0x3c, 0x30, 0x1d, 0xe1, 
-	0xce, 0xc3, 0xbd, 0xbb, 0xbb, 0xbb, 0xc0, 0xc9, 
-	0xd7, 0x06, 0x28, 0x35, 0x3e, 0x43, 0x44, 0x44, 
-	0x41, 0x3a, 0x2f, 0x1e, 0xe4, 0xd1, 0xc6, 0xbf, 
-	0xbc, 0xbb, 0xbd, 0xc1, 0xc9, 0xd5, 0xeb, 0x21, 
-	0x30, 0x39, 0x3f, 0x42, 0x42, 0x40, 0x3b, 0x32, 
-	0x25, 0xf9, 0xda, 0xcd, 0xc5, 0xc0, 0xbe, 0xbe, 
-	0xc1, 0xc6, 0xcf, 0xdd, 0x0f, 0x26, 0x32, 0x39, 
-	0x3e, 0x3f, 0x3f, 0x3c, 0x37, 0x2e, 0x20, 0xee, 
-	0xd9, 0xce, 0xc6, 0xc2, 0xc0, 0xc1, 0xc4, 0xc9, 
-	0xd2, 0xdf, 0x0e, 0x24, 0x2f, 0x36, 0x3a, 0x3c, 
-	0x3c, 0x3a, 0x35, 0x2d, 0x21, 0xfc, 0xde, 0xd2, 
-	0xcb, 0xc6, 0xc4, 0xc4, 0xc5, 0xca, 0xd1, 0xdb, 
-	0xee, 0x1c, 0x29, 0x31, 0x36, 0x38, 0x39, 0x38, 
-	0x35, 0x2f, 0x26, 0x19, 0xeb, 0xdb, 0xd2, 0xcc, 
-	0xc8, 0xc7, 0xc7, 0xc9, 0xce, 0xd5, 0xe0, 0xf5, 
-	0x1d, 0x28, 0x2f, 0x33, 0x35, 0x36, 0x35, 0x32, 
-	0x2c, 0x24, 0x17, 0xed, 0xde, 0xd5, 0xcf, 0xcc, 
-	0xca, 0xcb, 0xcd, 0xd0, 0xd6, 0xdf, 0xef, 0x17, 
-	0x23, 0x2a, 0x2e, 0x31, 0x32, 0x31, 0x2f, 0x2b, 
-	0x25, 0x1b, 0x08, 0xe5, 0xdc, 0xd5, 0xd1, 0xcf, 
-	0xce, 0xcf, 0xd1, 0xd6, 0xdc, 0xe6, 0x06, 0x1a, 
-	0x22, 0x28, 0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x27, 
-	0x20, 0x18, 0xf8, 0xe6, 0xde, 0xd8, 0xd4, 0xd2, 
-	0xd2, 0xd3, 0xd5, 0xd9, 0xdf, 0xe7, 0xfb, 0x17, 
-	0x1f, 0x24, 0x27, 0x29, 0x2a, 0x29, 0x28, 0x24, 
-	0x1f, 0x18, 0x0a, 0xeb, 0xe3, 0xdd, 0xd9, 0xd7, 
-	0xd6, 0xd7, 0xd8, 0xdb, 0xe0, 0xe6, 0xf0, 0x0f, 
-	0x18, 0x1e, 0x22, 0x24, 0x25, 0x25, 0x24, 0x22, 
-	0x1e, 0x1a, 0x12, 0xf8, 0xeb, 0xe4, 0xe0, 0xdd, 
-	0xdc, 0xdb, 0xdb, 0xdd, 0xe0, 0xe4, 0xea, 0xf4, 
-	0x0f, 0x16, 0x1b, 0x1d, 0x20, 0x20, 0x20, 0x1f, 
-	0x1d, 0x1a, 0x16, 0x10, 0xfa, 0xee, 0xe8, 0xe5, 
-	0xe2, 0xe1, 0xe0, 0xe0, 0xe2, 0xe4, 0xe7, 0xec, 
-	0xf4, 0x0a, 0x11, 0x16, 0x19, 0x1a, 0x1b, 0x1a, 
-	0x1a, 0x18, 0x16, 0x13, 0x0f, 0x08, 0xf4, 0xef, 
-	0xeb, 0xe9, 0xe7, 0xe6, 0xe6, 0xe6, 0xe8, 0xeb, 
-	0xee, 0xf3, 0xfb, 0x0b, 0x0f, 0x12, 0x14, 0x13, 
-	0x14, 0x14, 0x13, 0x12, 0x11, 0x0e, 0x0a, 0xfd, 
-	0xf5, 0xf1, 0xef, 0xee, 0xec, 0xec, 0xed, 0xee, 
-	0xf0, 0xf2, 0xf4, 0xf7, 0x02, 0x08, 0x0a, 0x09, 
-	0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x06, 
-	0x04, 0xfe, 0xfa, 0xf9, 0xf7, 0xf6, 0xf6, 0xfa, 
-	0xfa, 0xfb, 0x04, 0x04, 0x03, 0x03, 0xfe, 0xfa, 
-	0xf8, 0xf6, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 
-	0xf3, 0xf5, 0xf8, 0xfe, 0x07, 0x0a, 0x0d, 0x0d, 
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0d, 0x0a, 
-	0x04, 0xf7, 0xf3, 0xf0, 0xee, 0xed, 0xeb, 0xeb, 
-	0xeb, 0xec, 0xee, 0xf0, 0xf4, 0xf9, 0x09, 0x0e, 
-	0x10, 0x12, 0x14, 0x15, 0x15, 0x15, 0x15, 0x13, 
-	0x11, 0x0e, 0x08, 0xf7, 0xf1, 0xee, 0xeb, 0xe9, 
-	0xe8, 0xe8, 0xe8, 0xe9, 0xea, 0xec, 0xef, 0xf5, 
-	0x07, 0x0e, 0x12, 0x14, 0x16, 0x18, 0x19, 0x19, 
-	0x18, 0x17, 0x14, 0x11, 0x0c, 0xfc, 0xf1, 0xed, 
-	0xea, 0xe7, 0xe6, 0xe5, 0xe5, 0xe6, 0xe7, 0xe9, 
-	0xec, 0xf1, 0xfa, 0x0d, 0x12, 0x15, 0x18, 0x1a, 
-	0x1b, 0x1b, 0x1b, 0x19, 0x17, 0x14, 0x10, 0x09, 
-	0xf3, 0xed, 0xe9, 0xe6, 0xe5, 0xe4, 0xe3, 0xe4, 
-	0xe5, 0xe7, 0xea, 0xee, 0xf4, 0x0a, 0x11, 0x15, 
-	0x18, 0x1a, 0x1b, 0x1c, 0x1c, 0x1b, 0x1a, 0x17, 
-	0x13, 0x0d, 0xf7, 0xef, 0xea, 0xe6, 0xe4, 0xe2, 
-	0xe2, 0xe3, 0xe4, 0xe5, 0xe8, 0xec, 0xf1, 0x07, 
-	0x10, 0x15, 0x18, 0x1b, 0x1c, 0x1e, 0x1e, 0x1d, 
-	0x1b, 0x18, 0x14, 0x0e, 0xfb, 0xef, 0xea, 0xe7, 
-	0xe4, 0xe3, 0xe2, 0xe3, 0xe3, 0xe5, 0xe7, 0xeb, 
-	0xf0, 0x02, 0x0f, 0x15, 0x18, 0x1b, 0x1d, 0x1e, 
-	0x1e, 0x1d, 0x1b, 0x18, 0x14, 0x0f, 0xfc, 0xf0, 
-	0xea, 0xe7, 0xe5, 0xe3, 0xe2, 0xe3, 0xe3, 0xe5, 
-	0xe8, 0xeb, 0xf1, 0x05, 0x0f, 0x15, 0x19, 0x1b, 
-	0x1c, 0x1d, 0x1d, 0x1c, 0x1a, 0x18, 0x13, 0x0d, 
-	0xf7, 0xef, 0xea, 0xe7, 0xe5, 0xe3, 0xe3, 0xe4, 
-	0xe5, 0xe7, 0xea, 0xee, 0xf4, 0x0a, 0x11, 0x16, 
-	0x19, 0x1b, 0x1c, 0x1c, 0x1c, 0x1b, 0x18, 0x15, 
-	0x10, 0x07, 0xf3, 0xed, 0xe9, 0xe7, 0xe5, 0xe5, 
-	0xe5, 0xe6, 0xe7, 0xea, 0xed, 0xf2, 0x06, 0x0f, 
-	0x13, 0x17, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x17, 
-	0x14, 0x10, 0x08, 0xf5, 0xef, 0xeb, 0xe9, 0xe8, 
-	0xe7, 0xe8, 0xe8, 0xea, 0xeb, 0xee, 0xf3, 0x06, 
-	0x0e, 0x12, 0x15, 0x17, 0x19, 0x19, 0x18, 0x17, 
-	0x14, 0x11, 0x0c, 0x04, 0xf4, 0xf0, 0xed, 0xec, 
-	0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xef, 0xf3, 0xf9, 
-	0x09, 0x0e, 0x11, 0x13, 0x15, 0x16, 0x15, 0x14, 
-	0x12, 0x0f, 0x0c, 0x06, 0xf7, 0xf3, 0xf2, 0xf0, 
-	0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf6, 0xfa, 
-	0x06, 0x0a, 0x0c, 0x0e, 0x10, 0x10, 0x10, 0x0e, 
-	0x0c, 0x0a, 0x06, 0x02, 0xfa, 0xf9, 0xfb, 0xfc, 
-	0x06, 0x09, 0x09, 0x09, 0x04, 0x05, 0x03, 0xfe, 
-	0xfd, 0xfa, 0xfa, 0xfb, 0xfc, 0x05, 0xfa, 0xf7, 
-	0xf6, 0xf8, 0xfa, 0x06, 0x09, 0x0c, 0x0f, 0x11, 
-	0x13, 0x13, 0x12, 0x10, 0x0d, 0x09, 0xfd, 0xf5, 
-	0xf2, 0xf0, 0xee, 0xed, 0xee, 0xee, 0xef, 0xf0, 
-	0xf3, 0xf9, 0x0a, 0x10, 0x13, 0x16, 0x18, 0x19, 
-	0x18, 0x17, 0x14, 0x10, 0x09, 0xf5, 0xef, 0xeb, 
-	0xe8, 0xe7, 0xe7, 0xe8, 0xe8, 0xea, 0xee, 0xf5, 
-	0x0b, 0x13, 0x18, 0x1b, 0x1d, 0x1e, 0x1d, 0x1c, 
-	0x18, 0x13, 0x0a, 0xf2, 0xea, 0xe6, 0xe3, 0xe2, 
-	0xe2, 0xe2, 0xe3, 0xe7, 0xed, 0xf9, 0x12, 0x19, 
-	0x1d, 0x21, 0x23, 0x22, 0x21, 0x1e, 0x19, 0x11, 
-	0xf4, 0xe9, 0xe3, 0xe0, 0xdd, 0xdd, 0xdd, 0xdf, 
-	0xe3, 0xe9, 0xf5, 0x13, 0x1c, 0x22, 0x25, 0x27, 
-	0x26, 0x25, 0x21, 0x1a, 0x10, 0xef, 0xe5, 0xde, 
-	0xdb, 0xd9, 0xd8, 0xd9, 0xdd, 0xe2, 0xeb, 0x0e, 
-	0x1b, 0x23, 0x28, 0x2a, 0x2b, 0x2a, 0x26, 0x20, 
-	0x16, 0xf2, 0xe3, 0xdc, 0xd7, 0xd5, 0xd4, 0xd5, 
-	0xd9, 0xdf, 0xea, 0x11, 0x1f, 0x27, 0x2c, 0x2f, 
-	0x2f, 0x2d, 0x28, 0x1f, 0x11, 0xe9, 0xdd, 0xd6, 
-	0xd2, 0xd0, 0xd0, 0xd4, 0xd9, 0xe3, 0x05, 0x1e, 
-	0x28, 0x2f, 0x32, 0x32, 0x31, 0x2c, 0x24, 0x15, 
-	0xe8, 0xda, 0xd2, 0xce, 0xcc, 0xcd, 0xd1, 0xd7, 
-	0xe3, 0x11, 0x23, 0x2d, 0x33, 0x36, 0x36, 0x32, 
-	0x2c, 0x20, 0xf6, 0xdd, 0xd2, 0xcc, 0xc9, 0xc9, 
-	0xcc, 0xd2, 0xde, 0x08, 0x23, 0x2f, 0x36, 0x39, 
-	0x39, 0x36, 0x2e, 0x21, 0xf2, 0xda, 0xcf, 0xc8, 
-	0xc5, 0xc6, 0xca, 0xd2, 0xe1, 0x17, 0x2a, 0x35, 
-	0x3b, 0x3d, 0x3b, 0x35, 0x2a, 0x16, 0xdf, 0xcf, 
-	0xc7, 0xc3, 0xc3, 0xc6, 0xce, 0xdc, 0x13, 0x2b, 
-	0x37, 0x3d, 0x3f, 0x3d, 0x37, 0x2b, 0x13, 0xdb, 
-	0xcb, 0xc3, 0xc0, 0xc0, 0xc5, 0xcf, 0xe2, 0x20, 
-	0x33, 0x3d, 0x42, 0x42, 0x3d, 0x34, 0x21, 0xe2, 
-	0xcd, 0xc2, 0xbd, 0xbd, 0xc1, 0xcb, 0xdd, 0x1e, 
-	0x34, 0x3f, 0x44, 0x44, 0x40, 0x35, 0x20, 0xdd, 
-	0xc9, 0xbe, 0xbb, 0xbb, 0xc1, 0xce, 0xe9, 0x2a, 
-	0x3c, 0x44, 0x44, 0x44, 0x3d, 0x2c, 0xeb, 0xcd, 
-	0xbf, 0xbb, 0xbb, 0xbc, 0xc8, 0xe0, 0x28, 0x3c, 
-	0x44, 0x44, 0x44, 0x3f, 0x2d, 0xe7, 0xc9, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xcb, 0xf0, 0x32, 0x43, 0x44, 
-	0x44, 0x44, 0x39, 0x1d, 0xd2, 0xbe, 0xbb, 0xbb, 
-	0xbb, 0xc3, 0xde, 0x2c, 0x42, 0x44, 0x44, 0x44, 
-	0x3d, 0x21, 0xd2, 0xbc, 0xbb, 0xbb, 0xbb, 0xc4, 
-	0xe4, 0x33, 0x44, 0x44, 0x44, 0x44, 0x38, 0xf7, 
-	0xc6, 0xbb, 0xbb, 0xbb, 0xbb, 0xd1, 0x26, 0x42, 
-	0x44, 0x44, 0x44, 0x3f, 0x1d, 0xca, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xce, 0x26, 0x44, 0x44, 0x44, 0x44, 
-	0x3e, 0x0f, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 
-	0x35, 0x44, 0x44, 0x44, 0x44, 0x2f, 0xd2, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xcc, 0x2b, 0x44, 0x44, 0x44, 
-	0x44, 0x35, 0xd6, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 
-	0x2d, 0x44, 0x44, 0x44, 0x44, 0x2d, 0xcb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xe3, 0x3e, 0x44, 0x44, 0x44, 
-	0x3f, 0xe2, 0xbb, 0xbb, 0xbb, 0xbb, 0xd0, 0x35, 
-	0x44, 0x44, 0x44, 0x44, 0xf4, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xd0, 0x38, 0x44, 0x44, 0x44, 0x40, 0xde, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xe8, 0x44, 0x44, 0x44, 
-	0x44, 0x2b, 0xc2, 0xbb, 0xbb, 0xbb, 0xcc, 0x38, 
-	0x44, 0x44, 0x44, 0x38, 0xcc, 0xbb, 0xbb, 0xbb, 
-	0xc7, 0x34, 0x44, 0x44, 0x44, 0x38, 0xca, 0xbb, 
-	0xbb, 0xbb, 0xce, 0x3c, 0x44, 0x44, 0x44, 0x27, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0x13, 0x44, 0x44, 0x44, 
-	0x3f, 0xd1, 0xbb, 0xbb, 0xbb, 0xd2, 0x40, 0x44, 
-	0x44, 0x44, 0xe4, 0xbb, 0xbb, 0xbb, 0xcc, 0x3c, 
-	0x44, 0x44, 0x44, 0xe2, 0xbb, 0xbb, 0xbb, 0xd3, 
-	0x42, 0x44, 0x44, 0x3f, 0xcf, 0xbb, 0xbb, 0xbb, 
-	0x18, 0x44, 0x44, 0x44, 0x25, 0xbb, 0xbb, 0xbb, 
-	0xce, 0x3e, 0x44, 0x44, 0x3a, 0xca, 0xbb, 0xbb, 
-	0xc2, 0x31, 0x44, 0x44, 0x3f, 0xd4, 0xbb, 0xbb, 
-	0xc1, 0x2d, 0x44, 0x44, 0x3c, 0xd1, 0xbb, 0xbb, 
-	0xc8, 0x34, 0x44, 0x44, 0x31, 0xc7, 0xbb, 0xbb, 
-	0xdb, 0x3f, 0x44, 0x44, 0x08, 0xbb, 0xbb, 0xc3, 
-	0x27, 0x44, 0x44, 0x30, 0xcb, 0xbb, 0xbc, 0xea, 
-	0x3f, 0x44, 0x38, 0xd9, 0xbb, 0xbc, 0xdb, 0x38, 
-	0x44, 0x39, 0xe1, 0xc0, 0xbf, 0xdb, 0x33, 0x41, 
-	0x35, 0xe0, 0xc4, 0xc4, 0xe3, 0x32, 0x3d, 0x2d, 
-	0xda, 0xc6, 0xcc, 0x0f, 0x33, 0x35, 0x1c, 0xd4, 
-	0xcc, 0xda, 0x21, 0x31, 0x29, 0xeb, 0xd4, 0xd7, 
-	0xf7, 0x26, 0x26, 0x13, 0xe1, 0xe0, 0xec, 0x18, 
-	0x1e, 0x13, 0xef, 0xea, 0xf2, 0x09, 0x07, 0x09, 
-	0x08, 0x12, 0x11, 0xf2, 0xe6, 0xe6, 0x12, 0x21, 
-	0x1d, 0xe9, 0xd9, 0xdf, 0x1b, 0x2e, 0x23, 0xde, 
-	0xd0, 0xdd, 0x28, 0x34, 0x21, 0xd1, 0xc9, 0xe9, 
-	0x34, 0x36, 0xf1, 0xc6, 0xca, 0x22, 0x3f, 0x30, 
-	0xcf, 0xbf, 0xda, 0x3c, 0x41, 0xee, 0xbb, 0xc5, 
-	0x30, 0x44, 0x2d, 0xc0, 0xbb, 0x14, 0x44, 0x3d, 
-	0xc7, 0xbb, 0xdc, 0x44, 0x44, 0xcf, 0xbb, 0xd0, 
-	0x44, 0x44, 0xd5, 0xbb, 0xca, 0x44, 0x44, 0xd2, 
-	0xbb, 0xcb, 0x44, 0x44, 0xc9, 0xbb, 0xd8, 0x44, 
-	0x44, 0xbc, 0xbb, 0x1b, 0x44, 0x3b, 0xbb, 0xbb, 
-	0x3f, 0x44, 0xf4, 0xbb, 0xc3, 0x44, 0x44, 0xbb, 
-	0xbb, 0x2b, 0x44, 0x2b, 0xbb, 0xbb, 0x44, 0x44, 
-	0xbb, 0xbb, 0x34, 0x44, 0xfc, 0xbb, 0xd0, 0x44, 
-	0x41, 0xbb, 0xbb, 0x44, 0x44, 0xbb, 0xbb, 0x3e, 
-	0x44, 0xcc, 0xbb, 0x28, 0x44, 0xe8, 0xbb, 0x08, 
-	0x44, 0x19, 0xbb, 0xdf, 0x44, 0x25, 0xbb, 0xdd, 
-	0x44, 0x1f, 0xbb, 0xe7, 0x44, 0x0b, 0xbb, 0x1e, 
-	0x44, 0xd8, 0xbb, 0x2f, 0x44, 0xc9, 0xbb, 0x3d, 
-	0x3e, 0xbe, 0xc9, 0x43, 0x2a, 0xbd, 0xef, 0x42, 
-	0xde, 0xc1, 0x2e, 0x36, 0xcc, 0xd6, 0x38, 0x16, 
-	0xca, 0x1a, 0x2e, 0xdb, 0xde, 0x26, 0x12, 0xdc, 
-	0x12, 0x18, 0xed, 0xf5, 0x02, 0x02, 0x0f, 0xf1, 
-	0xeb, 0x20, 0x0a, 0xd9, 0x21, 0x22, 0xd1, 0x06, 
-	0x33, 0xd3, 0xd8, 0x39, 0xe1, 0xca, 0x38, 0x1a, 
-	0xc1, 0x35, 0x30, 0xbb, 0x2c, 0x3c, 0xbb, 0x1f, 
-	0x44, 0xbb, 0xf5, 0x44, 0xbb, 0xe6, 0x44, 0xbb, 
-	0xe1, 0x44, 0xbb, 0xe5, 0x44, 0xbb, 0x18, 0x44, 
-	0xbb, 0x2d, 0x44, 0xbb, 0x3f, 0x3f, 0xbb, 0x44, 
-	0x23, 0xbb, 0x44, 0xce, 0xbb, 0x44, 0xbb, 0xde, 
-	0x44, 0xbb, 0x3e, 0x3e, 0xbb, 0x44, 0xce, 0xbc, 
-	0x44, 0xbb, 0x2a, 0x44, 0xbb, 0x44, 0xcd, 0xc3, 
-	0x44, 0xbb, 0x3d, 0x2b, 0xbb, 0x44, 0xbb, 0x27, 
-	0x38, 0xbb, 0x44, 0xc0, 0x19, 0x34, 0xbb, 0x44, 
-	0xc1, 0x25, 0x29, 0xc6, 0x3f, 0xc1, 0x30, 0xec, 
-	0xd9, 0x32, 0xcc, 0x31, 0xd9, 0x18, 0x16, 0xdf, 
-	0x21, 0xe1, 0x11, 0x08, 0xf4, 0xf7, 0x13, 0xe3, 
-	0x24, 0xd6, 0x2d, 0xd4, 0x23, 0xeb, 0xe4, 0x2b, 
-	0xc9, 0x3e, 0xbd, 0x44, 0xbb, 0x42, 0xc2, 0x38, 
-	0xd1, 0x1e, 0x18, 0xd5, 0x36, 0xc2, 0x44, 0xbb, 
-	0x44, 0xbb, 0x3e, 0xd6, 0x44, 0xf9, 0x44, 0x13, 
-	0x44, 0xe0, 0x3a, 0x3b, 0x39, 0x35, 0x2d, 0x21, 
-	0xf7, 0xdd, 0xd2, 0xcb, 0xc7, 0xc6, 0xc7, 0xca, 
-	0xd1, 0xdb, 0xf0, 0x1e, 0x2c, 0x33, 0x38, 0x3a, 
-	0x39, 0x36, 0x2f, 0x25, 0x13, 0xe3, 0xd5, 0xcd, 
-	0xc9, 0xc7, 0xc8, 0xca, 0xd0, 0xda, 0xec, 0x1c, 
-	0x2a, 0x32, 0x37, 0x38, 0x38, 0x35, 0x2e, 0x24, 
-	0x11, 0xe2, 0xd5, 0xce, 0xc9, 0xc8, 0xc9, 0xcd, 
-	0xd4, 0xdf, 0xff, 0x21, 0x2c, 0x33, 0x37, 0x38, 
-	0x36, 0x31, 0x29, 0x1c, 0xec, 0xda, 0xd1, 0xcb, 
-	0xc9, 0xc9, 0xcc, 0xd1, 0xdb, 0xed, 0x1c, 0x29, 
-	0x31, 0x35, 0x37, 0x35, 0x31, 0x2a, 0x1d, 0xf0, 
-	0xdc, 0xd2, 0xcc, 0xca, 0xca, 0xcc, 0xd2, 0xdc, 
-	0xef, 0x1d, 0x29, 0x31, 0x35, 0x36, 0x34, 0x2f, 
-	0x27, 0x19, 0xea, 0xda, 0xd1, 0xcc, 0xca, 0xcb, 
-	0xcf, 0xd6, 0xe1, 0x0d, 0x23, 0x2d, 0x33, 0x35, 
-	0x35, 0x32, 0x2c, 0x21, 0x08, 0xe0, 0xd4, 0xce, 
-	0xcb, 0xcb, 0xce, 0xd3, 0xdd, 0xf1, 0x1d, 0x29, 
-	0x30, 0x34, 0x35, 0x33, 0x2d, 0x23, 0x11, 0xe3, 
-	0xd7, 0xcf, 0xcc, 0xcb, 0xcd, 0xd2, 0xdb, 0xed, 
-	0x1b, 0x28, 0x30, 0x34, 0x35, 0x33, 0x2d, 0x24, 
-	0x12, 0xe3, 0xd7, 0xcf, 0xcb, 0xcb, 0xcd, 0xd3, 
-	0xdc, 0xf0, 0x1d, 0x29, 0x31, 0x34, 0x34, 0x32, 
-	0x2c, 0x22, 0x0a, 0xe0, 0xd5, 0xce, 0xcb, 0xcb, 
-	0xce, 0xd4, 0xe0, 0x09, 0x22, 0x2c, 0x32, 0x35, 
-	0x34, 0x30, 0x29, 0x1d, 0xee, 0xdb, 0xd2, 0xcc, 
-	0xca, 0xcc, 0xd0, 0xd8, 0xe7, 0x17, 0x26, 0x2f, 
-	0x34, 0x35, 0x33, 0x2e, 0x25, 0x12, 0xe3, 0xd6, 
-	0xcf, 0xcb, 0xca, 0xcd, 0xd3, 0xde, 0xf9, 0x21, 
-	0x2c, 0x32, 0x35, 0x35, 0x31, 0x2a, 0x1d, 0xed, 
-	0xda, 0xd1, 0xcb, 0xc9, 0xcb, 0xcf, 0xd8, 0xe8, 
-	0x1a, 0x28, 0x30, 0x35, 0x36, 0x34, 0x2e, 0x23, 
-	0x0c, 0xdf, 0xd3, 0xcc, 0xc9, 0xc9, 0xcc, 0xd4, 
-	0xe0, 0x10, 0x25, 0x2f, 0x35, 0x37, 0x36, 0x31, 
-	0x28, 0x18, 0xe5, 0xd6, 0xcd, 0xc9, 0xc8, 0xca, 
-	0xd0, 0xdb, 0xf2, 0x21, 0x2d, 0x34, 0x37, 0x37, 
-	0x34, 0x2c, 0x1f, 0xee, 0xd9, 0xcf, 0xc9, 0xc7, 
-	0xc8, 0xcd, 0xd6, 0xe6, 0x1a, 0x2a, 0x33, 0x37, 
-	0x38, 0x36, 0x30, 0x25, 0x0e, 0xde, 0xd1, 0xca, 
-	0xc6, 0xc6, 0xc9, 0xd1, 0xde, 0x0f, 0x26, 0x31, 
-	0x37, 0x39, 0x39, 0x34, 0x2b, 0x1b, 0xe6, 0xd5, 
-	0xcb, 0xc6, 0xc5, 0xc7, 0xcd, 0xd7, 0xec, 0x20, 
-	0x2e, 0x36, 0x3a, 0x3b, 0x38, 0x30, 0x24, 0xf9, 
-	0xda, 0xce, 0xc6, 0xc4, 0xc4, 0xc8, 0xd1, 0xdf, 
-	0x15, 0x29, 0x34, 0x3a, 0x3c, 0x3b, 0x36, 0x2c, 
-	0x1b, 0xe3, 0xd2, 0xc9, 0xc4, 0xc2, 0xc4, 0xca, 
-	0xd5, 0xea, 0x21, 0x30, 0x38, 0x3c, 0x3d, 0x3a, 
-	0x33, 0x27, 0x0b, 0xda, 0xcd, 0xc5, 0xc2, 0xc2, 
-	0xc5, 0xcc, 0xda, 0x0a, 0x27, 0x34, 0x3b, 0x3e, 
-	0x3e, 0x3a, 0x32, 0x23, 0xee, 0xd6, 0xca, 0xc3, 
-	0xc0, 0xc1, 0xc5, 0xce, 0xdd, 0x15, 0x2b, 0x36, 
-	0x3d, 0x40, 0x3f, 0x3a, 0x31, 0x21, 0xe7, 0xd3, 
-	0xc7, 0xc1, 0xbf, 0xbf, 0xc4, 0xce, 0xde, 0x18, 
-	0x2d, 0x38, 0x3f, 0x41, 0x40, 0x3b, 0x32, 0x21, 
-	0xe7, 0xd2, 0xc6, 0xc0, 0xbd, 0xbe, 0xc3, 0xcc, 
-	0xdc, 0x16, 0x2d, 0x39, 0x3f, 0x42, 0x41, 0x3d, 
-	0x34, 0x25, 0xed, 0xd4, 0xc7, 0xc0, 0xbc, 0xbc, 
-	0xc0, 0xc8, 0xd6, 0x05, 0x29, 0x37, 0x3f, 0x43, 
-	0x43, 0x40, 0x39, 0x2c, 0x13, 0xd9, 0xca, 0xc1, 
-	0xbc, 0xbb, 0xbd, 0xc4, 0xcf, 0xe4, 0x20, 0x32, 
-	0x3d, 0x43, 0x44, 0x43, 0x3d, 0x34, 0x23, 0xe6, 
-	0xd0, 0xc4, 0xbd, 0xbb, 0xbb, 0xbf, 0xc7, 0xd5, 
-	0x05, 0x2a, 0x38, 0x41, 0x44, 0x44, 0x43, 0x3c, 
-	0x30, 0x1a, 0xdc, 0xcb, 0xc0, 0xbb, 0xbb, 0xbb, 
-	0xbf, 0xc9, 0xda, 0x16, 0x2e, 0x3b, 0x43, 0x44, 
-	0x44, 0x43, 0x3b, 0x2e, 0x15, 0xd9, 0xc8, 0xbf, 
-	0xbb, 0xbb, 0xbb, 0xbf, 0xc9, 0xda, 0x17, 0x2f, 
-	0x3c, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x30, 0x18, 
-	0xda, 0xc8, 0xbe, 0xbb, 0xbb, 0xbb, 0xbd, 0xc6, 
-	0xd6, 0x0f, 0x2d, 0x3b, 0x43, 0x44, 0x44, 0x44, 
-	0x40, 0x34, 0x21, 0xe1, 0xcc, 0xc0, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc2, 0xcf, 0xe7, 0x26, 0x37, 0x41, 
-	0x44, 0x44, 0x44, 0x44, 0x3b, 0x2c, 0x07, 0xd4, 
-	0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xc6, 0xd6, 
-	0x14, 0x30, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x42, 
-	0x37, 0x24, 0xe4, 0xcd, 0xc0, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbe, 0xc9, 0xdd, 0x1e, 0x34, 0x40, 0x44, 
-	0x44, 0x44, 0x44, 0x41, 0x35, 0x20, 0xde, 0xca, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xca, 0xdf, 
-	0x21, 0x36, 0x42, 0x44, 0x44, 0x44, 0x44, 0x41, 
-	0x35, 0x20, 0xdd, 0xc9, 0xbd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbd, 0xc9, 0xdd, 0x20, 0x35, 0x41, 0x44, 
-	0x44, 0x44, 0x44, 0x43, 0x37, 0x24, 0xe2, 0xcb, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc6, 0xd8, 
-	0x19, 0x32, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3c, 0x2b, 0xee, 0xcf, 0xc1, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc1, 0xd0, 0xf1, 0x2c, 0x3c, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x40, 0x33, 0x1a, 0xd7, 
-	0xc5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xc8, 
-	0xdd, 0x20, 0x36, 0x43, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3b, 0x29, 0xe9, 0xcd, 0xbf, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc0, 0xcf, 0xf1, 0x2c, 0x3d, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x35, 0x1e, 
-	0xda, 0xc6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc5, 0xd8, 0x1b, 0x34, 0x42, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3f, 0x2f, 0x08, 0xd1, 0xc1, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xca, 0xe2, 0x26, 
-	0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3a, 
-	0x27, 0xe3, 0xca, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc0, 0xd0, 0x00, 0x2f, 0x3f, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x43, 0x35, 0x1c, 0xd7, 0xc4, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc5, 0xd9, 
-	0x1d, 0x36, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3f, 0x2e, 0xf4, 0xcf, 0xbf, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbd, 0xcb, 0xe5, 0x29, 0x3c, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x24, 0xde, 
-	0xc7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc2, 
-	0xd4, 0x17, 0x34, 0x42, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x40, 0x30, 0x08, 0xd0, 0xbf, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbc, 0xcb, 0xe7, 0x2b, 0x3d, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x37, 0x1f, 
-	0xd8, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc5, 0xdc, 0x23, 0x39, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3b, 0x27, 0xe0, 0xc8, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xd7, 0x1e, 0x37, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3d, 0x29, 
-	0xe2, 0xc8, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc3, 0xd7, 0x1f, 0x38, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3b, 0x25, 0xdd, 0xc6, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 0xe0, 0x28, 0x3c, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x35, 0x17, 
-	0xd2, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 
-	0xd0, 0x11, 0x34, 0x43, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3c, 0x27, 0xde, 0xc6, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xca, 0xe8, 0x2e, 0x40, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3f, 0x2b, 0xe3, 0xc8, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc9, 0xe9, 
-	0x2e, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3d, 
-	0x27, 0xdd, 0xc5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbd, 0xcf, 0x12, 0x35, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x36, 0x15, 0xd0, 0xbd, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc6, 0xe2, 0x2c, 0x40, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3b, 0x22, 0xd6, 0xc1, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 0xde, 0x29, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3a, 0x1f, 
-	0xd4, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 
-	0xe9, 0x30, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x32, 0xf1, 0xca, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc0, 0xd6, 0x23, 0x3c, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x39, 0x1a, 0xd0, 0xbc, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbe, 0xd3, 0x1f, 0x3b, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x38, 0x15, 0xcd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc1, 0xda, 0x29, 0x40, 0x44, 0x44, 
-	0x44, 0x44, 0x42, 0x2e, 0xe0, 0xc3, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xce, 0x18, 0x39, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x34, 0xee, 0xc8, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xcc, 0x14, 0x39, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x32, 0xe6, 0xc5, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbd, 0xd4, 0x24, 0x3f, 0x44, 0x44, 
-	0x44, 0x44, 0x3e, 0x22, 0xd2, 0xbc, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc9, 0x09, 0x38, 0x44, 0x44, 0x44, 
-	0x44, 0x42, 0x2b, 0xd9, 0xbf, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc8, 0xfa, 0x38, 0x44, 0x44, 0x44, 0x44, 
-	0x40, 0x25, 0xd3, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xd1, 0x23, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x35, 
-	0xea, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 0x09, 
-	0x39, 0x44, 0x44, 0x44, 0x44, 0x39, 0x0b, 0xc7, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 0x0c, 0x3a, 0x44, 
-	0x44, 0x44, 0x44, 0x36, 0xe7, 0xc3, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xd0, 0x25, 0x42, 0x44, 0x44, 0x44, 
-	0x41, 0x25, 0xd0, 0xbb, 0xbb, 0xbb, 0xbb, 0xc6, 
-	0x09, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x2d, 0xd6, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0xc5, 0xf7, 0x3a, 0x44, 
-	0x44, 0x44, 0x44, 0x28, 0xd1, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xcb, 0x21, 0x41, 0x44, 0x44, 0x44, 0x3b, 
-	0x08, 0xc4, 0xbb, 0xbb, 0xbb, 0xc0, 0xe6, 0x38, 
-	0x44, 0x44, 0x44, 0x41, 0x21, 0xcb, 0xbb, 0xbb, 
-	0xbb, 0xbe, 0xde, 0x35, 0x44, 0x44, 0x44, 0x41, 
-	0x1f, 0xc9, 0xbb, 0xbb, 0xbb, 0xc1, 0xed, 0x3a, 
-	0x44, 0x44, 0x44, 0x3a, 0xea, 0xc0, 0xbb, 0xbb, 
-	0xbb, 0xcd, 0x28, 0x44, 0x44, 0x44, 0x44, 0x24, 
-	0xcb, 0xbb, 0xbb, 0xbb, 0xc5, 0x16, 0x40, 0x44, 
-	0x44, 0x44, 0x2c, 0xd0, 0xbb, 0xbb, 0xbb, 0xc4, 
-	0x14, 0x40, 0x44, 0x44, 0x44, 0x26, 0xcb, 0xbb, 
-	0xbb, 0xbb, 0xcb, 0x26, 0x44, 0x44, 0x44, 0x3e, 
-	0xf5, 0xc0, 0xbb, 0xbb, 0xbc, 0xe2, 0x3a, 0x44, 
-	0x44, 0x44, 0x28, 0xca, 0xbb, 0xbb, 0xbb, 0xd3, 
-	0x31, 0x44, 0x44, 0x44, 0x2f, 0xd0, 0xbb, 0xbb, 
-	0xbb, 0xd2, 0x31, 0x44, 0x44, 0x44, 0x2b, 0xcb, 
-	0xbb, 0xbb, 0xbb, 0xdd, 0x39, 0x44, 0x44, 0x42, 
-	0x15, 0xc1, 0xbb, 0xbb, 0xc4, 0x1e, 0x44, 0x44, 
-	0x44, 0x32, 0xd0, 0xbb, 0xbb, 0xbb, 0xe0, 0x3c, 
-	0x44, 0x44, 0x3b, 0xde, 0xbb, 0xbb, 0xbb, 0xd7, 
-	0x37, 0x44, 0x44, 0x3d, 0xe1, 0xbb, 0xbb, 0xbb, 
-	0xda, 0x3b, 0x44, 0x44, 0x38, 0xd7, 0xbb, 0xbb, 
-	0xbd, 0x04, 0x42, 0x44, 0x44, 0x29, 0xc6, 0xbb, 
-	0xbb, 0xcb, 0x30, 0x44, 0x44, 0x3c, 0xdc, 0xbb, 
-	0xbb, 0xbf, 0x18, 0x44, 0x44, 0x44, 0x0f, 0xbd, 
-	0xbb, 0xbb, 0xe6, 0x41, 0x44, 0x44, 0x1d, 0xc0, 
-	0xbb, 0xbb, 0xe4, 0x41, 0x44, 0x44, 0x17, 0xbe, 
-	0xbb, 0xbc, 0x0c, 0x44, 0x44, 0x40, 0xe2, 0xbb, 
-	0xbb, 0xc4, 0x2b, 0x44, 0x44, 0x33, 0xca, 0xbb, 
-	0xbb, 0xdb, 0x3f, 0x44, 0x44, 0xed, 0xbb, 0xbb, 
-	0xc6, 0x2f, 0x44, 0x44, 0x28, 0xc1, 0xbb, 0xbe, 
-	0x1f, 0x44, 0x44, 0x31, 0xc7, 0xbb, 0xbb, 0x12, 
-	0x44, 0x44, 0x33, 0xc7, 0xbb, 0xbc, 0x1b, 0x44, 
-	0x44, 0x2c, 0xc2, 0xbb, 0xc1, 0x2a, 0x44, 0x44, 
-	0x18, 0xbb, 0xbb, 0xce, 0x3a, 0x44, 0x3e, 0xd4, 
-	0xbb, 0xbb, 0x13, 0x44, 0x44, 0x24, 0xbd, 0xbb, 
-	0xcf, 0x3c, 0x44, 0x39, 0xcb, 0xbb, 0xc0, 0x2c, 
-	0x44, 0x43, 0xdc, 0xbb, 0xbb, 0x1a, 0x44, 0x44, 
-	0xee, 0xbb, 0xbb, 0x04, 0x44, 0x44, 0x07, 0xbb, 
-	0xbb, 0x10, 0x44, 0x44, 0xe8, 0xbb, 0xbb, 0x20, 
-	0x44, 0x42, 0xd4, 0xbb, 0xc1, 0x33, 0x44, 0x37, 
-	0xc4, 0xbb, 0xd2, 0x42, 0x44, 0x1c, 0xbb, 0xbb, 
-	0x21, 0x44, 0x3f, 0xcc, 0xbb, 0xcd, 0x40, 0x44, 
-	0x18, 0xbb, 0xbb, 0x2b, 0x44, 0x36, 0xc1, 0xbb, 
-	0xeb, 0x44, 0x42, 0xce, 0xbb, 0xd2, 0x44, 0x44, 
-	0xdb, 0xbb, 0xca, 0x40, 0x44, 0xe4, 0xbb, 0xc7, 
-	0x3f, 0x44, 0xe6, 0xbb, 0xc9, 0x40, 0x44, 0xda, 
-	0xbb, 0xd0, 0x44, 0x44, 0xcf, 0xbb, 0xe2, 0x44, 
-	0x3b, 0xc1, 0xbb, 0x27, 0x44, 0x27, 0xbb, 0xc3, 
-	0x3f, 0x44, 0xd4, 0xbb, 0xe6, 0x44, 0x35, 0xbb, 
-	0xbe, 0x3a, 0x44, 0xd7, 0xbb, 0xe9, 0x44, 0x2f, 
-	0xbb, 0xc4, 0x41, 0x44, 0xc7, 0xbb, 0x2c, 0x44, 
-	0xe2, 0xbb, 0xe9, 0x44, 0x27, 0xbb, 0xce, 0x44, 
-	0x37, 0xbb, 0xc4, 0x44, 0x3e, 0xbe, 0xc0, 0x41, 
-	0x41, 0xbf, 0xbe, 0x40, 0x41, 0xc0, 0xc0, 0x42, 
-	0x3f, 0xbc, 0xc3, 0x44, 0x39, 0xbb, 0xcb, 0x44, 
-	0x2c, 0xbb, 0xe0, 0x44, 0xee, 0xbb, 0x26, 0x44, 
-	0xca, 0xbb, 0x3f, 0x3d, 0xbb, 0xcd, 0x44, 0x1b, 
-	0xbb, 0x28, 0x44, 0xc6, 0xbe, 0x44, 0x32, 0xbb, 
-	0x10, 0x44, 0xca, 0xbd, 0x44, 0x2f, 0xbb, 0x20, 
-	0x44, 0xc2, 0xc4, 0x44, 0x11, 0xbb, 0x38, 0x3e, 
-	0xbb, 0xea, 0x44, 0xc5, 0xc5, 0x44, 0xe6, 0xbb, 
-	0x44, 0x2e, 0xbb, 0x35, 0x3e, 0xbb, 0x1d, 0x44, 
-	0xbb, 0xdc, 0x44, 0xc1, 0xcb, 0x44, 0xc7, 0xc6, 
-	0x44, 0xcc, 0xc3, 0x44, 0xce, 0xc3, 0x44, 0xca, 
-	0xc6, 0x44, 0xc5, 0xcd, 0x44, 0xbf, 0xdd, 0x44, 
-	0xbb, 0x1b, 0x44, 0xbb, 0x35, 0x36, 0xbb, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3c, 0x29, 0xe6, 0xcb, 0xbc, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xca, 0xe5, 0x29, 0x3c, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x2b, 
-	0xe8, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc0, 0xd4, 0x18, 0x34, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3e, 0x2b, 0xe5, 0xc9, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc9, 0xe9, 0x2c, 
-	0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3e, 0x28, 0xe0, 0xc6, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc1, 0xd8, 0x21, 
-	0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3d, 0x26, 0xdc, 0xc3, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcb, 0xf8, 0x32, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3d, 0x26, 0xda, 0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbf, 0xd7, 0x24, 0x3d, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x2a, 
-	0xde, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc3, 0xe0, 0x2c, 0x42, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x35, 0xf4, 0xc9, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc2, 0xdf, 
-	0x2c, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x43, 0x2e, 0xe0, 0xc2, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xd0, 0x1f, 0x3c, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xe2, 0xc3, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xd7, 
-	0x29, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x3c, 0x1a, 0xcd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xd1, 0x22, 0x3f, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3b, 0x15, 0xca, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xdd, 0x2f, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2a, 0xd7, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xd5, 
-	0x29, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x2a, 0xd5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc0, 0xe1, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x3a, 0x00, 0xc5, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xd2, 0x27, 0x43, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3e, 0x19, 0xc9, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xd2, 0x28, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3a, 0xf3, 0xc3, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbf, 0xe2, 0x35, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x2a, 0xd2, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xd0, 0x29, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x32, 0xdb, 0xbc, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xcd, 0x25, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x31, 0xd9, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xd2, 0x2b, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x28, 0xd0, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbe, 0xe3, 0x37, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3b, 0xf3, 0xc2, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xcd, 0x25, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x26, 0xcd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc4, 0x0c, 0x3d, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x2f, 0xd6, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbf, 0xe8, 0x39, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x33, 0xda, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbe, 0xe4, 0x37, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x33, 0xda, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 
-	0xe9, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2f, 
-	0xd5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0x09, 
-	0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 0x29, 0xce, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc8, 0x1e, 0x42, 
-	0x44, 0x44, 0x44, 0x44, 0x41, 0x1d, 0xc7, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xd0, 0x2b, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x3a, 0xea, 0xc0, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xdd, 0x35, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x31, 0xd7, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc4, 0x0f, 0x3e, 0x44, 0x44, 0x44, 0x44, 
-	0x43, 0x22, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xce, 0x27, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3c, 
-	0xf3, 0xc2, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 
-	0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x32, 0xd9, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0x00, 0x3c, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0xcd, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x24, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x3d, 0x0f, 0xc4, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xd7, 0x30, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x36, 0xe1, 0xbe, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbf, 0xe5, 0x38, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x2e, 0xd5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc5, 0x0c, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x26, 0xcf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc9, 
-	0x1d, 0x40, 0x44, 0x44, 0x44, 0x44, 0x41, 0x1f, 
-	0xca, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x22, 
-	0x42, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x1b, 0xc9, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xce, 0x24, 0x42, 
-	0x44, 0x44, 0x44, 0x44, 0x3f, 0x1a, 0xc9, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xce, 0x24, 0x42, 0x44, 
-	0x44, 0x44, 0x44, 0x3f, 0x1c, 0xca, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xcc, 0x20, 0x41, 0x44, 0x44, 
-	0x44, 0x44, 0x41, 0x21, 0xcd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc8, 0x18, 0x3e, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x28, 0xd2, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc4, 0xf1, 0x39, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x30, 0xdb, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbf, 0xdd, 0x32, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x38, 0xef, 0xc4, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xd1, 0x26, 0x42, 0x44, 0x44, 0x44, 0x44, 0x3f, 
-	0x20, 0xcd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 
-	0x0e, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2f, 
-	0xdb, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xdc, 
-	0x2f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3a, 0x10, 
-	0xc8, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x1d, 
-	0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2a, 0xd7, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xe0, 0x31, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x39, 0x0b, 0xc8, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x1b, 0x3d, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x2c, 0xd9, 0xbe, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xdc, 0x2f, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3b, 0x15, 0xca, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc9, 0x13, 0x3a, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x2f, 0xde, 0xc0, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbe, 0xd7, 0x2a, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x3d, 0x1e, 0xce, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc7, 0xf4, 0x37, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x33, 0xe5, 0xc3, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xd4, 0x26, 0x40, 0x44, 0x44, 
-	0x44, 0x44, 0x3e, 0x21, 0xd1, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xc6, 0xec, 0x35, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x33, 0xe7, 0xc4, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbc, 0xd3, 0x25, 0x3f, 0x44, 0x44, 0x44, 
-	0x44, 0x3e, 0x21, 0xd1, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xc8, 0xf4, 0x36, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x30, 0xe1, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc0, 0xda, 0x2b, 0x42, 0x44, 0x44, 0x44, 0x44, 
-	0x38, 0x12, 0xca, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xd0, 0x1f, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x3e, 
-	0x22, 0xd2, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xca, 
-	0x0b, 0x37, 0x44, 0x44, 0x44, 0x44, 0x41, 0x2a, 
-	0xda, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xc6, 0xea, 
-	0x33, 0x44, 0x44, 0x44, 0x44, 0x42, 0x2d, 0xdf, 
-	0xc2, 0xbb, 0xbb, 0xbb, 0xbb, 0xc5, 0xe6, 0x31, 
-	0x44, 0x44, 0x44, 0x44, 0x42, 0x2d, 0xdf, 0xc3, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 0xea, 0x32, 0x44, 
-	0x44, 0x44, 0x44, 0x40, 0x29, 0xda, 0xc1, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xcb, 0x0d, 0x36, 0x44, 0x44, 
-	0x44, 0x44, 0x3c, 0x20, 0xd3, 0xbe, 0xbb, 0xbb, 
-	0xbb, 0xbe, 0xd3, 0x20, 0x3c, 0x44, 0x44, 0x44, 
-	0x44, 0x34, 0xf9, 0xca, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc5, 0xe3, 0x2e, 0x42, 0x44, 0x44, 0x44, 0x3e, 
-	0x26, 0xd8, 0xc1, 0xbb, 0xbb, 0xbb, 0xbf, 0xd3, 
-	0x20, 0x3b, 0x44, 0x44, 0x44, 0x42, 0x30, 0xe9, 
-	0xc8, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x0c, 0x35, 
-	0x44, 0x44, 0x44, 0x44, 0x35, 0x0d, 0xcc, 0xbc, 
-	0xbb, 0xbb, 0xbb, 0xca, 0xef, 0x32, 0x43, 0x44, 
-	0x44, 0x44, 0x35, 0x11, 0xcd, 0xbd, 0xbb, 0xbb, 
-	0xbc, 0xcb, 0xf5, 0x33, 0x43, 0x44, 0x44, 0x42, 
-	0x32, 0xf4, 0xcb, 0xbc, 0xbb, 0xbb, 0xbf, 0xd0, 
-	0x17, 0x37, 0x44, 0x44, 0x44, 0x3e, 0x2a, 0xe0, 
-	0xc6, 0xbb, 0xbb, 0xbb, 0xc5, 0xdc, 0x27, 0x3c, 
-	0x44, 0x44, 0x43, 0x36, 0x17, 0xd2, 0xc0, 0xbb, 
-	0xbb, 0xc0, 0xd0, 0x14, 0x35, 0x42, 0x44, 0x44, 
-	0x3b, 0x25, 0xdc, 0xc5, 0xbc, 0xbb, 0xbe, 0xcc, 
-	0xec, 0x2e, 0x3f, 0x44, 0x44, 0x3c, 0x29, 0xe2, 
-	0xc9, 0xbd, 0xbb, 0xbf, 0xcb, 0xe9, 0x2c, 0x3d, 
-	0x44, 0x43, 0x3b, 0x27, 0xe1, 0xc9, 0xbe, 0xbc, 
-	0xc1, 0xcf, 0xf4, 0x2f, 0x3d, 0x43, 0x41, 0x37, 
-	0x20, 0xda, 0xc6, 0xbe, 0xbe, 0xc5, 0xd6, 0x1a, 
-	0x34, 0x3f, 0x41, 0x3c, 0x2e, 0x05, 0xd1, 0xc3, 
-	0xbf, 0xc2, 0xcd, 0xe8, 0x29, 0x39, 0x3f, 0x3e, 
-	0x34, 0x1e, 0xda, 0xc8, 0xc2, 0xc2, 0xcb, 0xde, 
-	0x21, 0x34, 0x3d, 0x3d, 0x35, 0x23, 0xe1, 0xcd, 
-	0xc4, 0xc4, 0xcb, 0xdd, 0x1d, 0x32, 0x3b, 0x3b, 
-	0x34, 0x21, 0xe1, 0xce, 0xc6, 0xc6, 0xce, 0xe0, 
-	0x20, 0x32, 0x39, 0x38, 0x2f, 0x1b, 0xdd, 0xcd, 
-	0xc8, 0xc9, 0xd3, 0xec, 0x25, 0x33, 0x37, 0x34, 
-	0x28, 0xf7, 0xd6, 0xcc, 0xca, 0xcf, 0xdd, 0x17, 
-	0x2c, 0x34, 0x34, 0x2c, 0x19, 0xe1, 0xd2, 0xcd, 
-	0xcf, 0xd9, 0xf9, 0x24, 0x2f, 0x31, 0x2c, 0x1d, 
-	0xe7, 0xd6, 0xd0, 0xd2, 0xda, 0xf1, 0x21, 0x2c, 
-	0x2e, 0x2a, 0x1c, 0xe9, 0xda, 0xd3, 0xd5, 0xde, 
-	0xf6, 0x20, 0x2a, 0x2a, 0x25, 0x16, 0xe7, 0xdb, 
-	0xd8, 0xda, 0xe4, 0x0e, 0x1f, 0x26, 0x25, 0x1e, 
-	0x0a, 0xe4, 0xdc, 0xdd, 0xe1, 0xef, 0x16, 0x1f, 
-	0x22, 0x1f, 0x13, 0xee, 0xe5, 0xe3, 0xe5, 0xec, 
-	0x0d, 0x18, 0x1d, 0x19, 0x12, 0xf7, 0xec, 0xe9, 
-	0xeb, 0xf0, 0x05, 0x0e, 0x11, 0x11, 0x0d, 0xfc, 
-	0xf7, 0xf6, 0xf5, 0x05, 0xfe, 0x05, 0xf8, 0xf4, 
-	0xf5, 0x05, 0x0e, 0x16, 0x14, 0x10, 0xf6, 0xec, 
-	0xe9, 0xea, 0xef, 0x0f, 0x1a, 0x1e, 0x1c, 0x10, 
-	0xec, 0xe2, 0xe1, 0xe4, 0xf4, 0x19, 0x22, 0x22, 
-	0x1b, 0xf3, 0xe1, 0xda, 0xdc, 0xe7, 0x17, 0x25, 
-	0x29, 0x24, 0x0f, 0xe0, 0xd5, 0xd6, 0xe0, 0x13, 
-	0x27, 0x2d, 0x29, 0x17, 0xdf, 0xd2, 0xd1, 0xdc, 
-	0x12, 0x2a, 0x32, 0x2d, 0x19, 0xdc, 0xce, 0xce, 
-	0xda, 0x18, 0x30, 0x35, 0x2e, 0x12, 0xd5, 0xca, 
-	0xcc, 0xde, 0x23, 0x36, 0x38, 0x2b, 0xe8, 0xcc, 
-	0xc6, 0xce, 0xef, 0x30, 0x3c, 0x37, 0x1f, 0xd4, 
-	0xc4, 0xc5, 0xd7, 0x26, 0x3c, 0x3e, 0x2e, 0xde, 
-	0xc4, 0xc0, 0xcd, 0x1b, 0x3b, 0x42, 0x36, 0xea, 
-	0xc4, 0xbc, 0xc7, 0x10, 0x3b, 0x44, 0x3a, 0xf0, 
-	0xc3, 0xbb, 0xc4, 0x10, 0x3e, 0x44, 0x3a, 0xe8, 
-	0xbf, 0xbb, 0xc6, 0x20, 0x43, 0x44, 0x37, 0xd7, 
-	0xbb, 0xbb, 0xcd, 0x30, 0x44, 0x44, 0x2a, 0xc7, 
-	0xbb, 0xbb, 0xe3, 0x41, 0x44, 0x41, 0xe3, 0xbb, 
-	0xbb, 0xc8, 0x31, 0x44, 0x44, 0x28, 0xc0, 0xbb, 
-	0xbb, 0x1a, 0x44, 0x44, 0x38, 0xc9, 0xbb, 0xbb, 
-	0xe4, 0x44, 0x44, 0x40, 0xd0, 0xbb, 0xbb, 0xdb, 
-	0x44, 0x44, 0x42, 0xcf, 0xbb, 0xbb, 0xdf, 0x44, 
-	0x44, 0x3f, 0xc8, 0xbb, 0xbb, 0x0b, 0x44, 0x44, 
-	0x36, 0xbd, 0xbb, 0xbb, 0x2e, 0x44, 0x44, 0x17, 
-	0xbb, 0xbb, 0xca, 0x44, 0x44, 0x44, 0xc7, 0xbb, 
-	0xbb, 0x22, 0x44, 0x44, 0x1d, 0xbb, 0xbb, 0xcf, 
-	0x44, 0x44, 0x3e, 0xbb, 0xbb, 0xbb, 0x3e, 0x44, 
-	0x44, 0xca, 0xbb, 0xbb, 0x2e, 0x44, 0x44, 0xd8, 
-	0xbb, 0xbb, 0x1f, 0x44, 0x44, 0xe3, 0xbb, 0xbb, 
-	0x20, 0x44, 0x44, 0xde, 0xbb, 0xbb, 0x2c, 0x44, 
-	0x44, 0xcd, 0xbb, 0xbb, 0x3b, 0x44, 0x44, 0xbc, 
-	0xbb, 0xc1, 0x44, 0x44, 0x31, 0xbb, 0xbb, 0xec, 
-	0x44, 0x44, 0xd5, 0xbb, 0xbb, 0x3f, 0x44, 0x3b, 
-	0xbb, 0xbb, 0xe1, 0x44, 0x44, 0xd0, 0xbb, 0xbd, 
-	0x44, 0x44, 0x29, 0xbb, 0xbb, 0x30, 0x44, 0x3e, 
-	0xbb, 0xbb, 0xed, 0x44, 0x44, 0xc2, 0xbb, 0xd8, 
-	0x44, 0x44, 0xcc, 0xbb, 0xcf, 0x44, 0x44, 0xcf, 
-	0xbb, 0xd0, 0x44, 0x44, 0xce, 0xbb, 0xd6, 0x44, 
-	0x44, 0xca, 0xbb, 0xe8, 0x44, 0x3a, 0xc2, 0xbb, 
-	0x20, 0x44, 0x29, 0xbd, 0xc4, 0x35, 0x43, 0xe6, 
-	0xbd, 0xd7, 0x3d, 0x36, 0xce, 0xc3, 0x1f, 0x3d, 
-	0x1b, 0xc7, 0xd5, 0x32, 0x31, 0xd8, 0xcc, 0x19, 
-	0x31, 0x12, 0xd2, 0xe2, 0x29, 0x22, 0xdc, 0xdd, 
-	0x19, 0x1f, 0xee, 0xe7, 0x07, 0x16, 0x04, 0xf3, 
-	0x09, 0xea, 0xf0, 0x19, 0x13, 0xe3, 0xe5, 0x21, 
-	0x23, 0xdc, 0xd9, 0x25, 0x2a, 0xd9, 0xd4, 0x28, 
-	0x30, 0xd5, 0xcc, 0x2e, 0x36, 0xd0, 0xc8, 0x33, 
-	0x39, 0xc8, 0xc8, 0x3c, 0x35, 0xbf, 0xcc, 0x43, 
-	0x30, 0xbb, 0xd9, 0x44, 0x10, 0xbb, 0x44, 0x44, 
-	0xe4, 0x35, 0x44, 0x44, 0x07, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x31, 
-	0x21, 0xe9, 0xd4, 0xc8, 0xbe, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xc3, 0xcd, 0xdd, 0x14, 0x2a, 0x37, 0x41, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3c, 0x31, 0x20, 0xe8, 0xd3, 0xc7, 
-	0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc1, 0xcb, 0xda, 0x0e, 0x29, 
-	0x36, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3f, 0x35, 0x26, 0xf8, 
-	0xd8, 0xca, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xc6, 0xd2, 0xe6, 
-	0x1f, 0x31, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x31, 0x20, 
-	0xe6, 0xd2, 0xc6, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xc7, 0xd3, 0xe9, 
-	0x22, 0x32, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x3d, 0x32, 0x22, 0xeb, 
-	0xd4, 0xc7, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc3, 0xce, 0xdf, 0x19, 0x2d, 
-	0x39, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x42, 0x3a, 0x2d, 0x19, 0xdf, 0xce, 0xc3, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 
-	0xc4, 0xcf, 0xe1, 0x1b, 0x2e, 0x3a, 0x43, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3b, 0x30, 
-	0x1e, 0xe4, 0xd1, 0xc5, 0xbd, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xc0, 0xc9, 0xd6, 0xf1, 0x25, 
-	0x34, 0x3e, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x42, 0x3a, 0x2e, 0x1b, 0xe1, 0xd0, 0xc5, 0xbd, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xc7, 0xd3, 
-	0xe7, 0x20, 0x30, 0x3b, 0x42, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x3e, 0x35, 0x28, 0x0d, 0xdb, 0xcc, 
-	0xc3, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xc7, 
-	0xd3, 0xe5, 0x1e, 0x2f, 0x3a, 0x41, 0x44, 0x44, 
-	0x44, 0x44, 0x40, 0x39, 0x2e, 0x1d, 0xe6, 0xd3, 
-	0xc8, 0xc1, 0xbc, 0xbb, 0xbb, 0xbd, 0xc2, 0xca, 
-	0xd5, 0xe8, 0x1f, 0x2f, 0x39, 0x40, 0x43, 0x44, 
-	0x43, 0x40, 0x3a, 0x32, 0x24, 0xf7, 0xda, 0xcd, 
-	0xc5, 0xc0, 0xbe, 0xbe, 0xc0, 0xc5, 0xcc, 0xd7, 
-	0xec, 0x20, 0x2f, 0x38, 0x3e, 0x40, 0x41, 0x3f, 
-	0x3b, 0x34, 0x29, 0x17, 0xe2, 0xd3, 0xca, 0xc5, 
-	0xc2, 0xc1, 0xc3, 0xc7, 0xce, 0xd9, 0xee, 0x20, 
-	0x2d, 0x36, 0x3b, 0x3e, 0x3d, 0x3a, 0x35, 0x2d, 
-	0x20, 0xf2, 0xdb, 0xd0, 0xc9, 0xc6, 0xc5, 0xc6, 
-	0xca, 0xd0, 0xdb, 0xee, 0x1d, 0x2a, 0x33, 0x37, 
-	0x3a, 0x39, 0x36, 0x30, 0x27, 0x17, 0xe7, 0xd9, 
-	0xd0, 0xcc, 0xc9, 0xca, 0xcd, 0xd2, 0xda, 0xe9, 
-	0x17, 0x26, 0x2e, 0x33, 0x35, 0x34, 0x31, 0x2b, 
-	0x22, 0x11, 0xe6, 0xda, 0xd3, 0xd0, 0xcf, 0xd0, 
-	0xd3, 0xd9, 0xe3, 0x08, 0x1d, 0x27, 0x2d, 0x30, 
-	0x30, 0x2d, 0x28, 0x20, 0x12, 0xea, 0xdf, 0xd8, 
-	0xd5, 0xd4, 0xd5, 0xd9, 0xdf, 0xe9, 0x0e, 0x1c, 
-	0x24, 0x28, 0x2a, 0x29, 0x26, 0x20, 0x17, 0xf6, 
-	0xe7, 0xe0, 0xdc, 0xdb, 0xdd, 0xdf, 0xe3, 0xeb, 
-	0x08, 0x17, 0x1d, 0x22, 0x22, 0x21, 0x1e, 0x19, 
-	0x10, 0xf4, 0xeb, 0xe6, 0xe5, 0xe5, 0xe6, 0xe9, 
-	0xed, 0xf5, 0x0c, 0x13, 0x16, 0x18, 0x18, 0x16, 
-	0x12, 0x0c, 0xfc, 0xf4, 0xf5, 0xf6, 0xfd, 0xfd, 
-	0xfe, 0x00, 0xfd, 0x03, 0xfa, 0xf8, 0xf8, 0xf6, 
-	0xf3, 0xf3, 0xf6, 0x07, 0x0f, 0x14, 0x17, 0x19, 
-	0x17, 0x14, 0x0f, 0xf9, 0xee, 0xe9, 0xe6, 0xe5, 
-	0xe5, 0xe7, 0xed, 0x05, 0x14, 0x1b, 0x20, 0x22, 
-	0x21, 0x1d, 0x15, 0xf8, 0xe8, 0xe1, 0xdd, 0xdd, 
-	0xdd, 0xe2, 0xea, 0x0d, 0x1c, 0x23, 0x27, 0x28, 
-	0x26, 0x1f, 0x14, 0xec, 0xdf, 0xd9, 0xd6, 0xd6, 
-	0xda, 0xe2, 0xf3, 0x1b, 0x26, 0x2c, 0x2d, 0x2c, 
-	0x26, 0x1a, 0xee, 0xdd, 0xd5, 0xd1, 0xd1, 0xd5, 
-	0xde, 0xf1, 0x1d, 0x2a, 0x30, 0x32, 0x30, 0x28, 
-	0x1a, 0xe8, 0xd8, 0xd0, 0xcd, 0xce, 0xd3, 0xdf, 
-	0x0f, 0x25, 0x30, 0x34, 0x35, 0x30, 0x25, 0x0b, 
-	0xdc, 0xd0, 0xca, 0xc9, 0xcd, 0xd7, 0xec, 0x22, 
-	0x30, 0x37, 0x38, 0x35, 0x2b, 0x16, 0xde, 0xcf, 
-	0xc8, 0xc7, 0xca, 0xd3, 0xe8, 0x22, 0x32, 0x39, 
-	0x3b, 0x37, 0x2c, 0x15, 0xdb, 0xcc, 0xc5, 0xc4, 
-	0xc9, 0xd4, 0xf2, 0x28, 0x36, 0x3c, 0x3c, 0x36, 
-	0x29, 0xf0, 0xd3, 0xc6, 0xc2, 0xc3, 0xca, 0xdb, 
-	0x1b, 0x32, 0x3c, 0x3f, 0x3c, 0x32, 0x1c, 0xda, 
-	0xc9, 0xc1, 0xc1, 0xc5, 0xd3, 0x09, 0x2e, 0x3b, 
-	0x3e, 0x3e, 0x36, 0x24, 0xdf, 0xca, 0xc1, 0xc1, 
-	0xc3, 0xd0, 0xf2, 0x2d, 0x3c, 0x3e, 0x3e, 0x38, 
-	0x25, 0xde, 0xc9, 0xc1, 0xc1, 0xc2, 0xcf, 0x04, 
-	0x30, 0x3d, 0x3d, 0x3d, 0x37, 0x21, 0xd9, 0xc5, 
-	0xc2, 0xc2, 0xc3, 0xd4, 0x1a, 0x36, 0x3d, 0x3d, 
-	0x3d, 0x32, 0x0d, 0xcf, 0xc2, 0xc2, 0xc2, 0xc8, 
-	0xe1, 0x2a, 0x3d, 0x3d, 0x3c, 0x3c, 0x27, 0xdc, 
-	0xc5, 0xc3, 0xc3, 0xc3, 0xd2, 0x1c, 0x38, 0x3c, 
-	0x3c, 0x3c, 0x31, 0xef, 0xcb, 0xc3, 0xc3, 0xc3, 
-	0xcb, 0xf4, 0x32, 0x3c, 0x3c, 0x3c, 0x37, 0x16, 
-	0xcf, 0xc4, 0xc4, 0xc4, 0xc7, 0xe4, 0x2f, 0x3b, 
-	0x3b, 0x3b, 0x3a, 0x1e, 0xd2, 0xc4, 0xc4, 0xc4, 
-	0xc5, 0xe1, 0x2d, 0x3b, 0x3b, 0x3b, 0x3a, 0x1f, 
-	0xd2, 0xc4, 0xc4, 0xc4, 0xc5, 0xe2, 0x2e, 0x3a, 
-	0x3a, 0x3a, 0x39, 0x1c, 0xd0, 0xc5, 0xc5, 0xc5, 
-	0xc7, 0xe9, 0x31, 0x3a, 0x3a, 0x3a, 0x36, 0x0f, 
-	0xcb, 0xc5, 0xc5, 0xc5, 0xcb, 0x0d, 0x37, 0x39, 
-	0x39, 0x39, 0x31, 0xe6, 0xc6, 0xc6, 0xc6, 0xc6, 
-	0xd3, 0x22, 0x39, 0x39, 0x39, 0x39, 0x27, 0xd7, 
-	0xc6, 0xc6, 0xc6, 0xc6, 0xdf, 0x2e, 0x39, 0x39, 
-	0x39, 0x38, 0x14, 0xcc, 0xc7, 0xc7, 0xc7, 0xcc, 
-	0x14, 0x38, 0x38, 0x38, 0x38, 0x2d, 0xdf, 0xc7, 
-	0xc7, 0xc7, 0xc7, 0xd9, 0x29, 0x38, 0x38, 0x38, 
-	0x38, 0x1b, 0xcf, 0xc8, 0xc8, 0xc8, 0xcb, 0x0d, 
-	0x36, 0x37, 0x37, 0x37, 0x2e, 0xdf, 0xc8, 0xc8, 
-	0xc8, 0xc8, 0xda, 0x2a, 0x37, 0x37, 0x37, 0x37, 
-	0x17, 0xce, 0xc8, 0xc8, 0xc9, 0xcd, 0x15, 0x36, 
-	0x36, 0x36, 0x36, 0x2a, 0xdb, 0xc9, 0xc9, 0xc9, 
-	0xc9, 0xe0, 0x2e, 0x36, 0x36, 0x36, 0x34, 0xf7, 
-	0xca, 0xc9, 0xc9, 0xc9, 0xd2, 0x20, 0x35, 0x35, 
-	0x35, 0x35, 0x22, 0xd4, 0xca, 0xca, 0xca, 0xca, 
-	0xf4, 0x33, 0x35, 0x35, 0x35, 0x2d, 0xe1, 0xca, 
-	0xca, 0xca, 0xca, 0xdc, 0x2a, 0x34, 0x34, 0x34, 
-	0x34, 0x0f, 0xcc, 0xcb, 0xcb, 0xcb, 0xd2, 0x1e, 
-	0x34, 0x34, 0x34, 0x34, 0x22, 0xd5, 0xcb, 0xcb, 
-	0xcb, 0xcb, 0xf2, 0x32, 0x34, 0x33, 0x33, 0x2c, 
-	0xe1, 0xcc, 0xcc, 0xcc, 0xcc, 0xdf, 0x2b, 0x33, 
-	0x33, 0x33, 0x33, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 
-	0xd5, 0x20, 0x33, 0x33, 0x32, 0x32, 0x1e, 0xd4, 
-	0xcd, 0xcd, 0xcd, 0xce, 0x0c, 0x32, 0x32, 0x32, 
-	0x32, 0x29, 0xde, 0xcd, 0xcd, 0xcd, 0xcd, 0xe4, 
-	0x2c, 0x32, 0x31, 0x31, 0x30, 0xee, 0xce, 0xce, 
-	0xce, 0xce, 0xd8, 0x23, 0x31, 0x31, 0x31, 0x31, 
-	0x19, 0xd3, 0xce, 0xce, 0xce, 0xd1, 0x14, 0x31, 
-	0x31, 0x30, 0x30, 0x25, 0xdb, 0xcf, 0xcf, 0xcf, 
-	0xcf, 0xe9, 0x2d, 0x30, 0x30, 0x30, 0x2c, 0xe8, 
-	0xcf, 0xcf, 0xcf, 0xcf, 0xdc, 0x25, 0x2f, 0x2f, 
-	0x2f, 0x2f, 0x13, 0xd2, 0xd0, 0xd0, 0xd0, 0xd4, 
-	0x18, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0xd9, 0xd0, 
-	0xd0, 0xd0, 0xd0, 0xf2, 0x2e, 0x2e, 0x2e, 0x2e, 
-	0x29, 0xe4, 0xd1, 0xd1, 0xd1, 0xd1, 0xe2, 0x27, 
-	0x2e, 0x2e, 0x2e, 0x2e, 0xf6, 0xd1, 0xd1, 0xd2, 
-	0xd2, 0xda, 0x1f, 0x2d, 0x2d, 0x2d, 0x2d, 0x18, 
-	0xd6, 0xd2, 0xd2, 0xd2, 0xd4, 0x12, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x22, 0xde, 0xd3, 0xd3, 0xd3, 0xd3, 
-	0xeb, 0x2a, 0x2c, 0x2c, 0x2c, 0x28, 0xe8, 0xd3, 
-	0xd3, 0xd3, 0xd3, 0xe1, 0x24, 0x2c, 0x2c, 0x2b, 
-	0x2b, 0x09, 0xd4, 0xd4, 0xd4, 0xd4, 0xdb, 0x1b, 
-	0x2b, 0x2b, 0x2b, 0x2b, 0x18, 0xd9, 0xd4, 0xd4, 
-	0xd4, 0xd6, 0x11, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 
-	0xdf, 0xd5, 0xd5, 0xd5, 0xd5, 0xf2, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x24, 0xe5, 0xd6, 0xd6, 0xd6, 0xd6, 
-	0xe7, 0x25, 0x29, 0x29, 0x29, 0x28, 0xee, 0xd6, 
-	0xd6, 0xd6, 0xd6, 0xe2, 0x21, 0x29, 0x28, 0x28, 
-	0x28, 0x07, 0xd7, 0xd7, 0xd7, 0xd7, 0xde, 0x1c, 
-	0x28, 0x28, 0x28, 0x28, 0x11, 0xd9, 0xd7, 0xd8, 
-	0xd8, 0xdc, 0x17, 0x27, 0x27, 0x27, 0x27, 0x17, 
-	0xdc, 0xd8, 0xd8, 0xd8, 0xda, 0x13, 0x27, 0x27, 
-	0x26, 0x26, 0x19, 0xde, 0xd9, 0xd9, 0xd9, 0xda, 
-	0x0f, 0x26, 0x26, 0x26, 0x26, 0x1a, 0xdf, 0xd9, 
-	0xda, 0xda, 0xda, 0x0f, 0x25, 0x25, 0x25, 0x25, 
-	0x19, 0xe0, 0xda, 0xda, 0xda, 0xdc, 0x10, 0x25, 
-	0x24, 0x24, 0x24, 0x17, 0xdf, 0xdb, 0xdb, 0xdb, 
-	0xdd, 0x13, 0x24, 0x24, 0x24, 0x24, 0x14, 0xde, 
-	0xdc, 0xdc, 0xdc, 0xe0, 0x17, 0x23, 0x23, 0x23, 
-	0x23, 0x0c, 0xdc, 0xdc, 0xdc, 0xdc, 0xe5, 0x1a, 
-	0x22, 0x22, 0x22, 0x22, 0xf2, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xec, 0x1f, 0x22, 0x21, 0x21, 0x1d, 0xe9, 
-	0xde, 0xde, 0xde, 0xde, 0x07, 0x21, 0x21, 0x21, 
-	0x21, 0x14, 0xe2, 0xdf, 0xdf, 0xdf, 0xe3, 0x16, 
-	0x20, 0x20, 0x20, 0x20, 0xf5, 0xdf, 0xdf, 0xe0, 
-	0xe0, 0xef, 0x1d, 0x1f, 0x1f, 0x1f, 0x17, 0xe7, 
-	0xe0, 0xe0, 0xe0, 0xe3, 0x12, 0x1e, 0x1e, 0x1e, 
-	0x1e, 0xf9, 0xe1, 0xe1, 0xe1, 0xe1, 0xf1, 0x1c, 
-	0x1e, 0x1d, 0x1d, 0x14, 0xe7, 0xe2, 0xe2, 0xe2, 
-	0xe8, 0x14, 0x1d, 0x1d, 0x1d, 0x1a, 0xf0, 0xe3, 
-	0xe3, 0xe3, 0xe4, 0x0b, 0x1c, 0x1c, 0x1c, 0x1c, 
-	0x06, 0xe4, 0xe4, 0xe4, 0xe4, 0xf4, 0x1a, 0x1b, 
-	0x1b, 0x1b, 0x0e, 0xe7, 0xe5, 0xe5, 0xe5, 0xf0, 
-	0x17, 0x1a, 0x1a, 0x1a, 0x10, 0xea, 0xe6, 0xe6, 
-	0xe6, 0xef, 0x14, 0x19, 0x19, 0x19, 0x10, 0xeb, 
-	0xe7, 0xe7, 0xe7, 0xf0, 0x13, 0x18, 0x18, 0x18, 
-	0x0f, 0xec, 0xe8, 0xe8, 0xe8, 0xf2, 0x13, 0x17, 
-	0x17, 0x17, 0x0b, 0xec, 0xe9, 0xe9, 0xe9, 0xf8, 
-	0x14, 0x16, 0x15, 0x14, 0xfd, 0xeb, 0xea, 0xea, 
-	0xed, 0x09, 0x14, 0x14, 0x14, 0x10, 0xf4, 0xeb, 
-	0xeb, 0xeb, 0xf2, 0x0e, 0x13, 0x13, 0x13, 0x09, 
-	0xf0, 0xed, 0xed, 0xef, 0x01, 0x10, 0x12, 0x12, 
-	0x0e, 0xf7, 0xee, 0xee, 0xee, 0xf5, 0x0b, 0x10, 
-	0x10, 0x0f, 0x06, 0xf2, 0xf0, 0xf0, 0xf3, 0x06, 
-	0x0d, 0x0f, 0x0e, 0x08, 0xf6, 0xf2, 0xf1, 0xf4, 
-	0xfc, 0x0a, 0x0d, 0x0c, 0x08, 0xf9, 0xf5, 0xf4, 
-	0xf5, 0xfb, 0x08, 0x0a, 0x0a, 0x07, 0xfb, 0xf7, 
-	0xf7, 0xf8, 0xfc, 0x05, 0x07, 0x06, 0x04, 0xfd, 
-	0xfb, 0xfb, 0xfc, 0xfe, 0x01
-};
-
-const SoundData wavSoundLevelUp =
-{
-	(const unsigned char*)_wavLevelUp,	//pointer to sound data
-    10661, 								//unsigned int length
-};
@@ -1,1968 +0,0 @@
-
-#include "Sound.h"
-
-const unsigned char _wavPlayerExplode[] =
-{
-    0x00, 0xdd, 0xe8, 0x04, 0x11, 0x12, 0x10, 0x0d, 
-	0x09, 0x05, 0xfc, 0xfa, 0xfa, 0xfb, 0xfc, 0xfd, 
-	0xff, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-	0x0b, 0xd8, 0xe0, 0xea, 0xf9, 0x0d, 0x0e, 0x0d, 
-	0x0b, 0x07, 0x03, 0xfc, 0xfb, 0xfb, 0xfc, 0xfd, 
-	0xfe, 0x00, 0x01, 0x01, 0x01, 0x01, 0xfd, 0xfe, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 
-	0xfd, 0xfd, 0xfe, 0x00, 0x00, 0x01, 0x01, 0x00, 
-	0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf6, 0xf9, 
-	0xfd, 0x03, 0x04, 0x03, 0x02, 0x02, 0xfd, 0xfc, 
-	0xfd, 0xfd, 0xfe, 0x00, 0x01, 0x01, 0x00, 0x01, 
-	0xfe, 0xfe, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf6, 0xf9, 
-	0xfc, 0x02, 0x03, 0x03, 0x02, 0x01, 0xff, 0xfe, 
-	0xfe, 0x11, 0x04, 0xf3, 0xf2, 0xf5, 0xf9, 0x03, 
-	0x05, 0x05, 0x04, 0x02, 0xfe, 0xfd, 0xfd, 0xfe, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 
-	0x00, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 
-	0xfd, 0x12, 0x09, 0xf5, 0xf0, 0xf3, 0xf8, 0x04, 
-	0x06, 0x06, 0x04, 0x01, 0xfd, 0xfd, 0xfd, 0xfe, 
-	0x00, 0x01, 0xfa, 0xfc, 0x01, 0x02, 0x02, 0x02, 
-	0x01, 0xfe, 0x01, 0x01, 0x00, 0xff, 0xff, 0xfe, 
-	0xff, 0xff, 0x00, 0x03, 0xf6, 0xf9, 0x01, 0x04, 
-	0x04, 0x03, 0x01, 0xfe, 0xfd, 0xfe, 0xfe, 0x00, 
-	0x01, 0x00, 0xfa, 0xfc, 0xfe, 0xcc, 0xd3, 0xe0, 
-	0xf8, 0x15, 0x15, 0x0f, 0x04, 0xde, 0x12, 0x1e, 
-	0x1c, 0x12, 0xf7, 0xf1, 0xef, 0xf4, 0x04, 0x08, 
-	0x07, 0x05, 0xfd, 0xfb, 0xfc, 0xfd, 0x01, 0x02, 
-	0x01, 0x00, 0xff, 0xfe, 0xff, 0xd0, 0xd4, 0xde, 
-	0xf1, 0x12, 0x14, 0x10, 0x09, 0xda, 0xfb, 0x1c, 
-	0x1c, 0x14, 0x02, 0xf3, 0xef, 0xf4, 0xfe, 0x07, 
-	0x07, 0x05, 0xff, 0xfc, 0xfc, 0xfd, 0x01, 0x01, 
-	0x01, 0x01, 0xff, 0xfe, 0xff, 0xff, 0x00, 0x00, 
-	0x00, 0x00, 0xfc, 0x03, 0x03, 0x02, 0xfe, 0xfd, 
-	0xfe, 0xff, 0x00, 0x01, 0x00, 0x00, 0x02, 0xff, 
-	0xfe, 0xfe, 0xff, 0x00, 0xca, 0xd3, 0xe5, 0x13, 
-	0x18, 0x13, 0x04, 0xf3, 0xf3, 0xf8, 0x05, 0x07, 
-	0x05, 0xff, 0xfc, 0xfc, 0xfe, 0x01, 0x01, 0x01, 
-	0xff, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 
-	0xfe, 0xfe, 0x00, 0x01, 0xcd, 0xd3, 0xe2, 0x0f, 
-	0x18, 0x13, 0x08, 0xf4, 0xf3, 0xf8, 0x0b, 0xfc, 
-	0xf9, 0xfb, 0x01, 0x03, 0x02, 0xfd, 0xfd, 0xfe, 
-	0x00, 0x01, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xec, 
-	0x03, 0x0d, 0x0b, 0x04, 0xf8, 0xf7, 0xfe, 0x04, 
-	0x04, 0x02, 0xfd, 0xf8, 0x09, 0x06, 0x0b, 0xf7, 
-	0xf7, 0xf9, 0x05, 0x05, 0x03, 0xfb, 0xfc, 0xfd, 
-	0x01, 0x02, 0x01, 0xff, 0xfe, 0xff, 0xe5, 0xeb, 
-	0xf9, 0x2b, 0xcc, 0xdb, 0x17, 0x1f, 0x16, 0xf3, 
-	0xed, 0xf2, 0x06, 0x06, 0x0b, 0x06, 0xf9, 0xf9, 
-	0xfb, 0xfe, 0x05, 0x03, 0xfd, 0xfc, 0xfd, 0xfe, 
-	0x01, 0x01, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 
-	0x00, 0x2f, 0xcc, 0xd8, 0x12, 0x1f, 0x18, 0xf7, 
-	0xed, 0xf1, 0x04, 0x0a, 0x08, 0xfe, 0xf9, 0xfb, 
-	0x00, 0xfb, 0x09, 0x03, 0xf9, 0xfa, 0xfe, 0x03, 
-	0x03, 0x0c, 0x08, 0xfb, 0xf9, 0xfb, 0x03, 0x04, 
-	0x02, 0xfd, 0xfd, 0xfe, 0xff, 0x01, 0x00, 0xff, 
-	0xf1, 0xfb, 0x07, 0x06, 0xfe, 0xfb, 0xfc, 0x01, 
-	0x02, 0xf9, 0x09, 0x04, 0xfa, 0xfa, 0xfd, 0x03, 
-	0x03, 0x0b, 0x09, 0xfd, 0xf9, 0xfa, 0x02, 0x03, 
-	0xe2, 0xf4, 0x0f, 0x0d, 0xfb, 0xf6, 0xf8, 0x04, 
-	0xf3, 0xfb, 0x06, 0x05, 0xfd, 0xfc, 0xfd, 0x01, 
-	0x02, 0x01, 0x01, 0x06, 0xf6, 0xfc, 0x06, 0x05, 
-	0xfd, 0xfb, 0xfd, 0x02, 0xfb, 0xfc, 0x01, 0x02, 
-	0xe2, 0xf2, 0x0f, 0x0e, 0x02, 0xf6, 0xf8, 0x03, 
-	0x05, 0x03, 0xfc, 0xfc, 0xfd, 0x02, 0x02, 0x00, 
-	0xfe, 0xfe, 0xd3, 0xd4, 0xe9, 0x1a, 0x17, 0xf7, 
-	0xee, 0xf4, 0x09, 0x09, 0xfb, 0xf8, 0xfb, 0x04, 
-	0x04, 0xfe, 0xfd, 0xfe, 0xfa, 0xfc, 0x02, 0x02, 
-	0x01, 0x0b, 0xf7, 0xf8, 0x03, 0x05, 0x03, 0xfc, 
-	0xfc, 0x00, 0xd8, 0xd1, 0xf1, 0x19, 0x13, 0xf3, 
-	0xf0, 0xf8, 0x09, 0x08, 0xfd, 0xf6, 0xf6, 0xfb, 
-	0x06, 0xfc, 0xfe, 0xfe, 0xfa, 0xfb, 0x01, 0x02, 
-	0x01, 0x0b, 0xf8, 0xf8, 0x02, 0x05, 0x18, 0x30, 
-	0x21, 0xe5, 0xe4, 0xed, 0x1b, 0x0f, 0xee, 0xf0, 
-	0x07, 0x0b, 0x05, 0xf8, 0xf9, 0xfa, 0xf8, 0xfa, 
-	0x03, 0xfc, 0x02, 0x01, 0xfa, 0x03, 0x02, 0xfe, 
-	0xfd, 0xff, 0x01, 0xf4, 0xf7, 0x07, 0xf5, 0x2e, 
-	0x23, 0xe8, 0xe3, 0xf6, 0x12, 0x0d, 0xf5, 0xe0, 
-	0x0a, 0x12, 0x08, 0xf3, 0xf6, 0x07, 0x07, 0xfc, 
-	0xfa, 0xfd, 0x0a, 0xf7, 0xf8, 0x06, 0x05, 0xfc, 
-	0xfb, 0xfc, 0x02, 0xf4, 0xf7, 0x04, 0x06, 0x02, 
-	0xfc, 0xfd, 0x02, 0x02, 0xff, 0xfe, 0xff, 0xc8, 
-	0xd4, 0x17, 0x1f, 0x04, 0xea, 0x3c, 0xe0, 0xdd, 
-	0x11, 0x19, 0x0c, 0xec, 0xf4, 0x0c, 0x0a, 0xf7, 
-	0xf8, 0x01, 0x04, 0x02, 0xfd, 0xfd, 0x02, 0x02, 
-	0xff, 0xfe, 0xfe, 0x01, 0x00, 0xff, 0xff, 0xd3, 
-	0xd4, 0x06, 0x1d, 0x0f, 0xec, 0x3d, 0xe4, 0xdc, 
-	0x0c, 0x19, 0x0b, 0xee, 0xf4, 0x0a, 0x09, 0xf8, 
-	0xf9, 0x03, 0xd1, 0x2c, 0x10, 0xdf, 0xec, 0x15, 
-	0x0f, 0xf2, 0xf3, 0x07, 0x09, 0xfc, 0xf9, 0xfe, 
-	0x04, 0x02, 0xfc, 0xfe, 0x01, 0x01, 0xfe, 0xfe, 
-	0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xfe, 
-	0xff, 0x00, 0xcd, 0x2b, 0x16, 0xe0, 0xea, 0x13, 
-	0x11, 0xf3, 0xf3, 0x06, 0x09, 0xfd, 0xf9, 0xf9, 
-	0x05, 0x04, 0xfc, 0xfc, 0x02, 0x02, 0xfe, 0xfe, 
-	0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 
-	0x01, 0x05, 0x08, 0x03, 0xfa, 0xfe, 0x03, 0x01, 
-	0xfd, 0xfe, 0x01, 0x01, 0xfe, 0xff, 0x00, 0xf9, 
-	0x02, 0x03, 0xfe, 0xfd, 0x01, 0x01, 0xff, 0xfe, 
-	0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 
-	0x02, 0x03, 0x08, 0x04, 0xfa, 0xe2, 0x0f, 0x10, 
-	0xf4, 0xf4, 0x08, 0x08, 0xfa, 0xfa, 0x03, 0x03, 
-	0xfd, 0xfd, 0x01, 0x01, 0xfe, 0xfe, 0x00, 0x00, 
-	0xff, 0xff, 0x02, 0x01, 0xfe, 0xfe, 0x00, 0x00, 
-	0xff, 0xff, 0x00, 0x00, 0xff, 0xe2, 0x0b, 0x11, 
-	0xf3, 0xf2, 0x08, 0x09, 0xfa, 0xf9, 0x03, 0x04, 
-	0xfd, 0xfc, 0x01, 0x02, 0xfe, 0xfa, 0xfe, 0x03, 
-	0xfe, 0xfd, 0x02, 0x02, 0xfe, 0xfd, 0x00, 0x01, 
-	0xff, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xf9, 0x08, 
-	0xf9, 0xf9, 0x04, 0x04, 0xfc, 0xfd, 0x02, 0x02, 
-	0xfe, 0xfe, 0x01, 0x00, 0xff, 0xfa, 0xfd, 0x03, 
-	0x00, 0x38, 0x30, 0xde, 0xe2, 0x19, 0x12, 0xed, 
-	0xf4, 0x0d, 0x06, 0xf6, 0xfd, 0x06, 0xfd, 0xfb, 
-	0x02, 0x03, 0xfe, 0xfd, 0x01, 0x01, 0xfe, 0xff, 
-	0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-	0x00, 0x33, 0x31, 0xe1, 0xe0, 0x18, 0x14, 0xed, 
-	0xf3, 0x0d, 0x07, 0xf6, 0xfb, 0x06, 0x01, 0xfb, 
-	0x01, 0x03, 0xfe, 0xfd, 0x01, 0x01, 0xfe, 0xff, 
-	0x00, 0x00, 0xfe, 0xfe, 0x00, 0x01, 0xff, 0xff, 
-	0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 
-	0xff, 0xfb, 0xfc, 0x02, 0x01, 0xfd, 0xff, 0x01, 
-	0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 
-	0x00, 0xf4, 0x08, 0xfd, 0xf9, 0x03, 0x04, 0xfc, 
-	0xfd, 0xfc, 0xfc, 0x02, 0x02, 0xfe, 0xfe, 0x01, 
-	0x00, 0xfe, 0x00, 0x01, 0xfe, 0x01, 0x00, 0xfe, 
-	0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 
-	0x00, 0xf3, 0x08, 0x02, 0xf9, 0x02, 0x04, 0xfc, 
-	0xfd, 0x02, 0x01, 0xfe, 0xe1, 0x0f, 0x0c, 0xf1, 
-	0xfb, 0x0a, 0xfa, 0xf9, 0x05, 0x03, 0xfb, 0xff, 
-	0x02, 0xfe, 0xfe, 0x01, 0x00, 0xfe, 0x00, 0x00, 
-	0xff, 0xfd, 0x01, 0xff, 0xfe, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0xff, 0xff, 0xe1, 0x0e, 0x10, 0xf4, 
-	0xf6, 0x09, 0x02, 0xf8, 0x03, 0x04, 0xfc, 0xfd, 
-	0x02, 0xff, 0xfe, 0xff, 0xfd, 0xfb, 0x02, 0x02, 
-	0xfd, 0xfd, 0x02, 0x02, 0xfd, 0x01, 0x01, 0xfe, 
-	0xfe, 0x01, 0x00, 0xff, 0x00, 0x00, 0x08, 0x08, 
-	0xf9, 0xfb, 0x05, 0xfe, 0xfc, 0x02, 0x01, 0xfd, 
-	0x00, 0x01, 0xff, 0xfe, 0xfe, 0xbf, 0x14, 0x20, 
-	0xe2, 0xf2, 0x15, 0xf3, 0xf2, 0x0c, 0x2f, 0x25, 
-	0xde, 0xfc, 0x1a, 0xee, 0xf3, 0x0f, 0xf9, 0xf6, 
-	0x07, 0x04, 0xf9, 0x03, 0x03, 0xfc, 0xfe, 0x02, 
-	0xfe, 0xfe, 0x01, 0xff, 0xff, 0xbf, 0x0c, 0x21, 
-	0xe3, 0xef, 0x15, 0xf5, 0xf2, 0x0c, 0x2c, 0x27, 
-	0xdf, 0xf3, 0x1a, 0xef, 0xf1, 0x0e, 0xfc, 0xf5, 
-	0x07, 0x05, 0xf9, 0x02, 0x03, 0xfc, 0xfe, 0x02, 
-	0xfe, 0xfe, 0x01, 0x00, 0xff, 0x00, 0x00, 0xff, 
-	0xfb, 0xfc, 0x03, 0x00, 0xfd, 0x01, 0x01, 0xfe, 
-	0x00, 0x00, 0xff, 0x02, 0xff, 0xfe, 0x01, 0xc5, 
-	0x29, 0xe3, 0xe4, 0x1a, 0xf7, 0xee, 0x0e, 0x06, 
-	0xf5, 0x07, 0x05, 0xf9, 0x03, 0x03, 0xfc, 0x01, 
-	0x02, 0xfe, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 
-	0x00, 0x00, 0x02, 0x01, 0xfe, 0x00, 0x00, 0xc3, 
-	0x29, 0xe6, 0xe2, 0x19, 0x01, 0xed, 0x0d, 0x07, 
-	0x05, 0xfa, 0x08, 0xfc, 0xfa, 0x04, 0xfe, 0xfc, 
-	0x02, 0x01, 0xfd, 0x01, 0x01, 0xfe, 0xff, 0xf5, 
-	0xf5, 0xeb, 0x0d, 0x07, 0xf4, 0x07, 0x05, 0xf8, 
-	0x05, 0xfe, 0xfc, 0x03, 0x00, 0xf4, 0xf9, 0x07, 
-	0x0b, 0xf6, 0x07, 0x02, 0xf9, 0x04, 0xff, 0xfc, 
-	0x01, 0x01, 0xfd, 0x01, 0x01, 0xfe, 0x00, 0xf3, 
-	0xfa, 0xeb, 0x2a, 0xe8, 0x31, 0xe4, 0xe8, 0x1b, 
-	0xef, 0xf2, 0x0f, 0xf6, 0xf8, 0xfa, 0xf6, 0x05, 
-	0x03, 0xfa, 0x03, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 
-	0x02, 0xfe, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 
-	0x00, 0xff, 0x2d, 0xdf, 0x31, 0xe7, 0xe6, 0x1b, 
-	0xf1, 0xf0, 0x0f, 0xf7, 0xf7, 0x09, 0xfb, 0xfa, 
-	0x05, 0xfd, 0xf2, 0x03, 0x06, 0xf9, 0x03, 0x03, 
-	0xfc, 0x02, 0x02, 0xfd, 0x01, 0x01, 0xfe, 0x00, 
-	0x00, 0xf1, 0x20, 0xe6, 0x0c, 0x0f, 0xef, 0x08, 
-	0xfb, 0xf8, 0x04, 0xfe, 0xfc, 0x03, 0xfe, 0xfe, 
-	0x02, 0xff, 0xf3, 0xfd, 0x06, 0xf9, 0x02, 0x03, 
-	0xfc, 0x01, 0x02, 0xfd, 0x01, 0x01, 0xe1, 0x0f, 
-	0x03, 0xeb, 0x22, 0xe7, 0x05, 0x11, 0xef, 0x07, 
-	0x03, 0xf8, 0x05, 0x01, 0xfb, 0x03, 0xfe, 0xfd, 
-	0x02, 0x0c, 0xf7, 0x07, 0x02, 0xfa, 0x04, 0xfd, 
-	0xfd, 0x02, 0xfc, 0xfc, 0x03, 0xfd, 0xe1, 0x0e, 
-	0x07, 0xf1, 0x0b, 0xfd, 0xf8, 0x06, 0xfc, 0xfc, 
-	0x04, 0xfd, 0xfc, 0x02, 0xfe, 0xfe, 0x01, 0xe1, 
-	0xe9, 0xd7, 0x1f, 0xf1, 0xec, 0x13, 0xf3, 0xf8, 
-	0x0a, 0xf6, 0x01, 0x04, 0xfb, 0x03, 0x02, 0xfd, 
-	0x03, 0xfe, 0xfa, 0x02, 0x01, 0xfd, 0x02, 0x07, 
-	0x03, 0x08, 0xf9, 0x03, 0x03, 0xfb, 0x03, 0xdd, 
-	0xf3, 0xd5, 0x0d, 0xf5, 0xee, 0x0e, 0xf8, 0xf7, 
-	0x09, 0xf9, 0xfc, 0xfc, 0xf9, 0xf7, 0x07, 0xfb, 
-	0xfa, 0x05, 0xf8, 0x00, 0x03, 0xfc, 0x02, 0x07, 
-	0xfc, 0x09, 0xf9, 0x02, 0x03, 0x37, 0xdd, 0x31, 
-	0xe0, 0xf4, 0xf2, 0xe8, 0x12, 0xf4, 0xf6, 0x0b, 
-	0xf7, 0x03, 0x05, 0xf7, 0x01, 0xf7, 0x06, 0xfd, 
-	0xf9, 0x05, 0xfb, 0xfd, 0xfb, 0x02, 0xfc, 0x01, 
-	0x01, 0xfe, 0x01, 0xf2, 0x07, 0x3b, 0xd9, 0x31, 
-	0xe3, 0xef, 0x19, 0xea, 0x0b, 0x0b, 0xf3, 0x08, 
-	0xe9, 0xf0, 0x10, 0xf1, 0x07, 0x06, 0xf7, 0x06, 
-	0xfc, 0xfc, 0x03, 0x06, 0xfd, 0x09, 0xf8, 0x04, 
-	0x03, 0xf8, 0x05, 0xf1, 0x06, 0xfe, 0xf9, 0x05, 
-	0xfd, 0xfd, 0x03, 0xfd, 0x01, 0x01, 0xfe, 0xf7, 
-	0xeb, 0xdf, 0xe2, 0xd7, 0x21, 0xe7, 0xf9, 0x11, 
-	0xef, 0x0c, 0xfd, 0xfd, 0x08, 0x06, 0x37, 0xdd, 
-	0x2a, 0xe6, 0xf7, 0x14, 0xec, 0x0d, 0xfd, 0xf6, 
-	0x09, 0xf9, 0x02, 0x04, 0xfb, 0x03, 0xfe, 0xfe, 
-	0x01, 0xde, 0xe5, 0xd7, 0x21, 0xe7, 0xf8, 0x11, 
-	0xef, 0x0b, 0xff, 0xf7, 0x07, 0xfa, 0x3a, 0xdb, 
-	0x29, 0xe9, 0xf2, 0x15, 0xed, 0x0c, 0x05, 0xf6, 
-	0x09, 0xf9, 0xfe, 0xbf, 0x1c, 0xf5, 0xe5, 0x19, 
-	0xec, 0x09, 0x0a, 0xf4, 0x0a, 0xf9, 0xfc, 0x05, 
-	0xfb, 0x03, 0xfe, 0xfd, 0x02, 0xfe, 0x01, 0x00, 
-	0xfe, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 
-	0xff, 0x00, 0xff, 0xc0, 0x18, 0x09, 0xe3, 0x19, 
-	0xed, 0x06, 0x0b, 0xf3, 0x09, 0xfa, 0xfc, 0x05, 
-	0xfb, 0x03, 0x00, 0xfd, 0x02, 0xfe, 0x00, 0x00, 
-	0xfe, 0x00, 0xff, 0xfa, 0x01, 0x01, 0xfd, 0x02, 
-	0xfe, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xff, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x01, 0x05, 
-	0x09, 0x06, 0xf9, 0x06, 0xfb, 0x02, 0x02, 0xfd, 
-	0x02, 0xfe, 0xff, 0xfa, 0xfe, 0x02, 0xfd, 0x02, 
-	0xfd, 0xff, 0x01, 0xfe, 0x01, 0xff, 0x00, 0x00, 
-	0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x06, 
-	0x08, 0x07, 0xf9, 0x06, 0xfb, 0x01, 0xe1, 0x11, 
-	0xed, 0x09, 0x03, 0xf7, 0x08, 0xf8, 0x04, 0xff, 
-	0xfc, 0x03, 0xfd, 0x01, 0xff, 0xfe, 0x01, 0xfe, 
-	0x00, 0xff, 0x02, 0xff, 0xff, 0x01, 0xfe, 0x00, 
-	0xff, 0xff, 0x00, 0xff, 0x00, 0xf6, 0xe1, 0x10, 
-	0xef, 0x06, 0x06, 0xf6, 0x08, 0xf9, 0x03, 0x02, 
-	0xfc, 0x03, 0xfc, 0xfc, 0xfd, 0x02, 0xfd, 0x01, 
-	0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0xf5, 0x02, 0xf7, 
-	0x06, 0xfa, 0x0d, 0x14, 0x0e, 0xf2, 0x0e, 0xf4, 
-	0x08, 0xfc, 0xfb, 0x03, 0xfa, 0x04, 0xfc, 0x02, 
-	0x00, 0xfe, 0xfe, 0xfe, 0x01, 0xfe, 0x00, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0x0f, 0x13, 0x0f, 0xf2, 0x0e, 0xf5, 
-	0x07, 0xfd, 0xfb, 0x05, 0xfb, 0x03, 0xfd, 0xff, 
-	0x01, 0xfe, 0x01, 0xfe, 0x00, 0x00, 0xff, 0x00, 
-	0xff, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0xfd, 0x02, 
-	0xfe, 0x01, 0x02, 0xfe, 0x01, 0xff, 0xff, 0x00, 
-	0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x04, 0x0a, 
-	0x03, 0xfc, 0x05, 0xf9, 0x04, 0xfd, 0xfe, 0x02, 
-	0xfd, 0x02, 0xfe, 0x01, 0xff, 0xff, 0x00, 0xfe, 
-	0xfe, 0xfe, 0x01, 0xfe, 0x00, 0xff, 0x00, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x04, 0x0a, 
-	0x04, 0xfb, 0x05, 0xfb, 0xe2, 0x0e, 0xf2, 0xfb, 
-	0x07, 0xf7, 0x07, 0xf9, 0x05, 0xfc, 0x01, 0x00, 
-	0xfd, 0x01, 0xfe, 0x01, 0x02, 0xff, 0x01, 0xfe, 
-	0x01, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf2, 0x07, 
-	0xf8, 0x04, 0xfd, 0xfd, 0xe2, 0x0d, 0xf3, 0xf9, 
-	0x08, 0xf5, 0x08, 0xf9, 0x04, 0xfd, 0xfe, 0x01, 
-	0xfd, 0x02, 0xfd, 0x01, 0x01, 0x00, 0x01, 0xfe, 
-	0x01, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf2, 0x07, 
-	0xf8, 0x03, 0xfe, 0x44, 0xd6, 0x30, 0xde, 0x1b, 
-	0xf0, 0xfd, 0x0b, 0xf3, 0x0b, 0xf5, 0x08, 0xf9, 
-	0x04, 0xfd, 0xfd, 0x02, 0xfd, 0x02, 0xfd, 0x01, 
-	0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0xff, 0x44, 0xd5, 0x30, 0xdf, 0x19, 
-	0xf2, 0xf9, 0x0c, 0xf2, 0x0c, 0xf5, 0x08, 0xfa, 
-	0x04, 0xfe, 0xfd, 0x02, 0xfd, 0x02, 0xfe, 0x01, 
-	0xfe, 0x00, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
-	0x00, 0xfe, 0x00, 0xff, 0x00, 0xfd, 0x01, 0x02, 
-	0xfe, 0x01, 0xff, 0xfe, 0xfa, 0x01, 0xfd, 0xfe, 
-	0x01, 0xfe, 0x01, 0xfe, 0x01, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xfe, 
-	0xfa, 0xf4, 0xff, 0xfc, 0xfc, 0x03, 0xfc, 0x03, 
-	0xfd, 0x02, 0xfe, 0xfe, 0xfa, 0x01, 0xfe, 0x02, 
-	0x01, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-	0xf9, 0xf5, 0xe0, 0x10, 0xec, 0x0d, 0xf3, 0x08, 
-	0xf9, 0x04, 0xfe, 0xfd, 0x02, 0xfd, 0x02, 0x01, 
-	0x01, 0x00, 0xfd, 0x01, 0xfe, 0x01, 0xff, 0x00, 
-	0xff, 0x00, 0x00, 0x0a, 0x05, 0x07, 0xfb, 0x05, 
-	0xfb, 0x04, 0xe0, 0x10, 0xec, 0x0d, 0xf3, 0x08, 
-	0xf9, 0x03, 0x01, 0xfd, 0x03, 0xfc, 0x02, 0xfd, 
-	0x01, 0xfe, 0xfd, 0x01, 0xfe, 0x00, 0xff, 0x00, 
-	0xff, 0x00, 0xff, 0x0b, 0x04, 0x07, 0xfa, 0xe6, 
-	0xc8, 0x11, 0xe6, 0xf9, 0x05, 0xf3, 0x0a, 0xf4, 
-	0x0a, 0xf6, 0x07, 0xf9, 0x05, 0xfb, 0x03, 0xfc, 
-	0x03, 0xfd, 0x01, 0xfc, 0xfb, 0xfe, 0xfe, 0xfe, 
-	0x01, 0x0d, 0xfa, 0x08, 0xfa, 0x05, 0xfb, 0xe2, 
-	0xca, 0x09, 0xe9, 0xef, 0xe7, 0xf4, 0xfe, 0xf4, 
-	0x0a, 0xf5, 0x08, 0xf8, 0x06, 0xf1, 0x07, 0xf7, 
-	0x05, 0xf8, 0x04, 0xfa, 0xfc, 0xfc, 0x01, 0xfd, 
-	0x01, 0x0d, 0xfa, 0x08, 0x29, 0x3a, 0x0c, 0x19, 
-	0x0d, 0xf7, 0x0e, 0xed, 0xe9, 0xf6, 0xf9, 0xf6, 
-	0x07, 0xf8, 0x07, 0xf9, 0x04, 0xf2, 0x07, 0xf8, 
-	0x04, 0xf8, 0x04, 0xfb, 0x02, 0xfd, 0x01, 0xfe, 
-	0x00, 0xff, 0xfe, 0x00, 0x2d, 0x36, 0x14, 0x15, 
-	0x11, 0xf3, 0x10, 0xf1, 0x0d, 0xf4, 0x09, 0xf6, 
-	0x07, 0xf9, 0x05, 0xfb, 0x03, 0xfd, 0x02, 0xfe, 
-	0x01, 0xf6, 0xf7, 0xfa, 0xfd, 0xfc, 0x02, 0xfd, 
-	0x02, 0xfe, 0x02, 0xfe, 0x01, 0xfe, 0x01, 0xfd, 
-	0x00, 0xfe, 0x01, 0xfe, 0xef, 0xe7, 0x02, 0xf3, 
-	0x04, 0xf9, 0xfe, 0x00, 0xfd, 0x02, 0xfd, 0x01, 
-	0xfd, 0xf5, 0xf8, 0xfa, 0xfe, 0x0d, 0xf9, 0x08, 
-	0xfa, 0x05, 0xfc, 0x03, 0xf9, 0x02, 0xfc, 0x02, 
-	0xfe, 0x02, 0xfe, 0x01, 0xed, 0xe8, 0xfb, 0xf4, 
-	0xff, 0xfb, 0xfc, 0x02, 0xfc, 0x03, 0xfc, 0x01, 
-	0xbd, 0x1a, 0xd7, 0x1a, 0xe5, 0x17, 0xec, 0x10, 
-	0xf2, 0x0b, 0xf6, 0x08, 0xf7, 0x05, 0xfa, 0x04, 
-	0xfc, 0x01, 0xfa, 0x02, 0xfc, 0x02, 0xfd, 0x0d, 
-	0xfa, 0x08, 0xfa, 0x05, 0xfb, 0x03, 0xfc, 0x02, 
-	0xbd, 0x19, 0xd0, 0x1c, 0xe1, 0x16, 0xeb, 0x0f, 
-	0xf2, 0x0b, 0xf6, 0x06, 0xf2, 0x07, 0xf7, 0x05, 
-	0xfa, 0xfb, 0xfa, 0xfe, 0xfc, 0x01, 0xfd, 0x0e, 
-	0xf9, 0x08, 0xfa, 0x05, 0xfb, 0x03, 0xfc, 0x44, 
-	0xe9, 0x2a, 0xdc, 0x1d, 0xe7, 0x14, 0xef, 0x0e, 
-	0xf4, 0x09, 0xf8, 0x03, 0xf2, 0x06, 0xf8, 0x05, 
-	0xf9, 0xfc, 0xfd, 0xfd, 0xf9, 0xfe, 0xfc, 0x01, 
-	0xfd, 0x01, 0xfd, 0xf2, 0x06, 0xf7, 0x05, 0x44, 
-	0xe5, 0x2e, 0xe4, 0x1d, 0xea, 0x13, 0xf0, 0xf3, 
-	0xe5, 0x0c, 0xef, 0x0a, 0xf4, 0x08, 0xf8, 0x05, 
-	0xfa, 0x04, 0xfc, 0x03, 0x0c, 0xf9, 0x08, 0xfa, 
-	0x05, 0xfc, 0xfa, 0xf2, 0x05, 0xf7, 0x05, 0x11, 
-	0xeb, 0x0d, 0xf2, 0x09, 0xf7, 0x06, 0xfa, 0xed, 
-	0xe7, 0x06, 0xf1, 0x08, 0xf6, 0x06, 0xf9, 0x04, 
-	0xfb, 0x03, 0xfc, 0x02, 0x0d, 0xf9, 0x08, 0xfa, 
-	0x05, 0xfb, 0xfa, 0x0a, 0x09, 0x03, 0x05, 0x11, 
-	0xeb, 0x0e, 0xf2, 0x0a, 0xf6, 0x07, 0xf9, 0x04, 
-	0xfb, 0x03, 0xfd, 0xfd, 0xfa, 0x02, 0xfc, 0x02, 
-	0xfc, 0x02, 0xfd, 0x01, 0xfe, 0x01, 0x02, 0x00, 
-	0x01, 0xff, 0x00, 0x0a, 0x08, 0x03, 0x05, 0xfd, 
-	0x03, 0xfd, 0x02, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 
-	0x01, 0xff, 0x00, 0xfc, 0xfa, 0x01, 0xfc, 0x02, 
-	0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x00, 0x02, 0xff, 
-	0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0xf7, 0xbc, 0x1f, 
-	0xd6, 0x19, 0xe5, 0x11, 0xef, 0x0b, 0xf6, 0x06, 
-	0xfa, 0x03, 0xfe, 0xfe, 0x01, 0xfd, 0x01, 0xfe, 
-	0x01, 0xfe, 0x01, 0xfe, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0xbd, 0x1f, 
-	0xd6, 0x19, 0xe5, 0x12, 0xef, 0x0b, 0xf5, 0x07, 
-	0xfa, 0x03, 0xfd, 0x00, 0x01, 0xfe, 0x03, 0xfd, 
-	0x02, 0xfe, 0x01, 0xfe, 0x01, 0xff, 0x00, 0xff, 
-	0xfb, 0xfb, 0x00, 0xfc, 0x01, 0xfd, 0x01, 0xfe, 
-	0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0xff, 
-	0x04, 0x0d, 0xf9, 0x08, 0xfa, 0x05, 0xfd, 0x03, 
-	0xfe, 0x01, 0x00, 0xff, 0xfe, 0xfd, 0x01, 0xfe, 
-	0xfb, 0xfb, 0xff, 0xfd, 0x01, 0xfd, 0x01, 0xfe, 
-	0x01, 0xfe, 0x00, 0xff, 0xe9, 0xe8, 0x07, 0xef, 
-	0x0b, 0x07, 0x06, 0x03, 0x03, 0x02, 0x00, 0x01, 
-	0xfe, 0x01, 0x01, 0x02, 0xfe, 0xfe, 0xff, 0xfe, 
-	0x00, 0xff, 0x00, 0xf6, 0x1e, 0xf0, 0x13, 0xf3, 
-	0x0c, 0xf8, 0x06, 0xfc, 0xe8, 0xe9, 0x05, 0xef, 
-	0x09, 0xf4, 0x08, 0xf8, 0x05, 0xfa, 0x03, 0xfc, 
-	0x02, 0xfe, 0x02, 0x02, 0xff, 0x01, 0xfe, 0x01, 
-	0xff, 0x00, 0xff, 0xf8, 0x1e, 0xf0, 0x13, 0xf3, 
-	0x0c, 0xf8, 0x06, 0xfb, 0x02, 0x01, 0xfd, 0x02, 
-	0xfd, 0x02, 0xfe, 0x01, 0xfe, 0x01, 0xff, 0x00, 
-	0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 
-	0x00, 0xff, 0xff, 0xfe, 0x00, 0xff, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0x00, 0x02, 0x01, 0x00, 0x01, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-	0xfd, 0xfa, 0x02, 0xfc, 0x02, 0xfd, 0x00, 0xff, 
-	0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x00, 0x0c, 0x08, 0x04, 0x06, 0xfc, 0x05, 
-	0xfc, 0x03, 0xfd, 0x02, 0xfe, 0x00, 0xfd, 0xfe, 
-	0xfd, 0xf9, 0x02, 0xfc, 0x02, 0xfd, 0x01, 0xfe, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe0, 0x05, 
-	0xef, 0xf8, 0x0c, 0xfb, 0x07, 0xfc, 0x04, 0xff, 
-	0x00, 0x02, 0xfe, 0x03, 0xff, 0x01, 0xfd, 0xfe, 
-	0x00, 0xfe, 0x01, 0xf3, 0xf8, 0xfb, 0xf9, 0x04, 
-	0xfa, 0x03, 0xfc, 0x02, 0xfb, 0xfa, 0xe0, 0x07, 
-	0xee, 0xf9, 0xfa, 0xf7, 0x05, 0xf8, 0x05, 0xfb, 
-	0x03, 0xfd, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x33, 0x41, 0xe4, 0x2e, 0xe5, 
-	0x1c, 0xf1, 0x0d, 0x07, 0xf7, 0x08, 0xf7, 0x07, 
-	0xfa, 0x04, 0xfc, 0x01, 0xff, 0xfd, 0x01, 0xfe, 
-	0x01, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 
-	0xff, 0xff, 0xff, 0x37, 0x3f, 0xe6, 0x2e, 0xe5, 
-	0x1d, 0xf0, 0x0e, 0x05, 0xf9, 0x09, 0xf7, 0x07, 
-	0xf9, 0x05, 0xfc, 0x02, 0x01, 0xfe, 0x01, 0xfe, 
-	0x01, 0xfe, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 
-	0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0x00, 
-	0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-	0xfa, 0xfb, 0xff, 0xfc, 0x02, 0xfd, 0x01, 0xfe, 
-	0xff, 0xff, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 
-	0x00, 0xff, 0x00, 0xfa, 0xf2, 0x05, 0xf7, 0xfe, 
-	0xfc, 0xfc, 0x02, 0xfc, 0x02, 0xfd, 0x01, 0xff, 
-	0xfa, 0xfc, 0x01, 0xfc, 0x02, 0xfd, 0x01, 0xfe, 
-	0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-	0x00, 0xff, 0x00, 0xe0, 0xef, 0xf2, 0xf0, 0x07, 
-	0xf4, 0x06, 0xf9, 0x01, 0xfe, 0xfc, 0x02, 0xfd, 
-	0x02, 0x01, 0xfe, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
-	0x00, 0xff, 0x04, 0x0e, 0xfb, 0x08, 0x03, 0x02, 
-	0x04, 0xfc, 0x03, 0xe0, 0xf7, 0xf0, 0xf3, 0x06, 
-	0xf4, 0x07, 0xf8, 0x04, 0xfc, 0xfd, 0x02, 0xfd, 
-	0x02, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-	0x00, 0xff, 0x05, 0x0d, 0xfb, 0xc9, 0xcb, 0x12, 
-	0xd7, 0x13, 0xe8, 0xf9, 0xfe, 0xf2, 0x09, 0xf5, 
-	0x06, 0xfb, 0xfe, 0x03, 0xfc, 0x04, 0xfd, 0x02, 
-	0xfc, 0xfa, 0x02, 0xfc, 0x01, 0xfe, 0x0e, 0x05, 
-	0x05, 0x06, 0xfb, 0x05, 0xfd, 0xc7, 0xcd, 0x10, 
-	0xce, 0x10, 0xe5, 0xf0, 0x07, 0xef, 0x0b, 0xf4, 
-	0x06, 0xf1, 0xf8, 0xfc, 0xf8, 0xfd, 0xf9, 0x02, 
-	0xfa, 0xfa, 0x01, 0xfb, 0x01, 0xfd, 0x0e, 0x05, 
-	0x38, 0x44, 0xe4, 0x2f, 0xef, 0x16, 0x12, 0xf3, 
-	0xe4, 0xef, 0xf6, 0xf1, 0x07, 0xf5, 0x04, 0xfb, 
-	0xfc, 0xf2, 0xf9, 0xfa, 0xf9, 0xfb, 0xfa, 0x00, 
-	0xfb, 0x00, 0xfd, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 
-	0x3a, 0x42, 0xe5, 0x2f, 0xed, 0x17, 0x11, 0xf4, 
-	0x10, 0xf3, 0x0a, 0xfa, 0xfe, 0x05, 0xfb, 0x04, 
-	0xfc, 0x01, 0xfb, 0xf1, 0x03, 0xf8, 0xfb, 0x02, 
-	0xfb, 0x02, 0xfd, 0x02, 0xfe, 0xfe, 0x01, 0xfe, 
-	0x01, 0xfd, 0xfe, 0x00, 0xfe, 0xe8, 0xe4, 0x0a, 
-	0xec, 0x02, 0xf7, 0xf7, 0x05, 0xf8, 0x04, 0xfc, 
-	0xfc, 0x02, 0xf9, 0xf2, 0x03, 0xfd, 0x0d, 0xfb, 
-	0x06, 0x04, 0xfd, 0x05, 0xfd, 0xfa, 0xfc, 0xfd, 
-	0xfd, 0x02, 0x00, 0xff, 0x01, 0xe7, 0xe5, 0x0a, 
-	0xec, 0x05, 0xf7, 0xf7, 0x05, 0xf8, 0x04, 0xfb, 
-	0xfc, 0xc8, 0xc8, 0x14, 0xd7, 0x0d, 0xf2, 0xed, 
-	0x0d, 0xf1, 0x08, 0xfa, 0xf9, 0xfd, 0xf9, 0x03, 
-	0xfc, 0x02, 0x02, 0xfc, 0xfa, 0xff, 0xfc, 0xfd, 
-	0x00, 0x09, 0x0d, 0xfb, 0x08, 0x03, 0xfe, 0x04, 
-	0xfd, 0xc7, 0xca, 0x12, 0xd6, 0xe2, 0xeb, 0xe9, 
-	0xf6, 0xf2, 0xf7, 0xfa, 0xf9, 0xff, 0xfb, 0xfc, 
-	0xf1, 0xfb, 0xf9, 0xf8, 0xfa, 0xf9, 0xfa, 0xfd, 
-	0xfb, 0x09, 0x0c, 0xfa, 0x08, 0x02, 0xfe, 0x04, 
-	0xfd, 0x02, 0xff, 0xff, 0xf5, 0xf6, 0x44, 0xf0, 
-	0x26, 0x22, 0xec, 0x1c, 0xf3, 0x0c, 0x0c, 0xf5, 
-	0xf6, 0xf9, 0xfa, 0xfb, 0xfd, 0xf9, 0xfa, 0xfd, 
-	0xfb, 0xfd, 0xfd, 0xfb, 0xfa, 0x00, 0xfc, 0xfd, 
-	0xff, 0xfd, 0xf7, 0xf2, 0x03, 0x21, 0x44, 0xf4, 
-	0x28, 0x21, 0xef, 0x1c, 0xf3, 0x0d, 0x0b, 0xf7, 
-	0xe6, 0xe6, 0x08, 0xed, 0xfb, 0xf9, 0xf6, 0x05, 
-	0xf8, 0xfd, 0xfe, 0xfa, 0xfa, 0x04, 0x0d, 0x03, 
-	0x06, 0x06, 0xf6, 0xf3, 0xfe, 0xf6, 0xfc, 0xfc, 
-	0x11, 0x1c, 0xf7, 0xee, 0xe5, 0x08, 0xf0, 0xf5, 
-	0xe4, 0xe6, 0x08, 0xec, 0xfd, 0xf8, 0xf6, 0x05, 
-	0xf8, 0xfd, 0xff, 0xfb, 0x02, 0x04, 0x0e, 0x02, 
-	0x06, 0x06, 0xfc, 0x05, 0xfb, 0xfa, 0x03, 0xfc, 
-	0x13, 0x1b, 0xf7, 0xed, 0xe7, 0x0f, 0xef, 0xfa, 
-	0x05, 0xf6, 0x06, 0xfa, 0xfc, 0x03, 0xfc, 0x02, 
-	0xfe, 0xfe, 0x01, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 
-	0xfa, 0xfb, 0x00, 0xfc, 0xff, 0xfe, 0xfe, 0x00, 
-	0xfe, 0xff, 0x00, 0xff, 0x0a, 0x0c, 0xfc, 0x08, 
-	0x04, 0x00, 0x04, 0xfd, 0x02, 0x01, 0xfe, 0x01, 
-	0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 
-	0xfa, 0xfb, 0x00, 0xfc, 0x00, 0xfe, 0xfe, 0x01, 
-	0xfe, 0xff, 0xff, 0xff, 0x00, 0x02, 0x01, 0x01, 
-	0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 
-	0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 
-	0xff, 0xeb, 0xbb, 0xe2, 0xe5, 0xda, 0x0d, 0xe9, 
-	0xf0, 0x07, 0xf1, 0x04, 0xfa, 0xf8, 0x04, 0xfb, 
-	0xfd, 0x02, 0xfc, 0x01, 0xfe, 0xfe, 0x01, 0xfe, 
-	0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 
-	0xff, 0xe9, 0xbb, 0xe5, 0xe4, 0xdb, 0x0e, 0xe9, 
-	0xf1, 0x07, 0xf1, 0x04, 0xfa, 0xf8, 0x04, 0xfb, 
-	0x01, 0x01, 0xfd, 0x01, 0xfe, 0xfe, 0x01, 0xfe, 
-	0xff, 0xf9, 0xfc, 0xfe, 0xfc, 0x00, 0xfe, 0xfe, 
-	0x00, 0xfe, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 
-	0x0d, 0x01, 0x07, 0x06, 0xfd, 0x04, 0x02, 0x02, 
-	0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0xff, 
-	0xfe, 0xf9, 0xfc, 0xfe, 0xfc, 0x00, 0xfe, 0xfe, 
-	0xe6, 0xe4, 0x06, 0xed, 0xf3, 0x03, 0xf4, 0x08, 
-	0x0d, 0xf9, 0x07, 0x05, 0x14, 0x44, 0x24, 0x18, 
-	0x29, 0xf8, 0x15, 0x15, 0xf6, 0x0e, 0x08, 0xfc, 
-	0x09, 0xfd, 0x03, 0x04, 0xfd, 0x02, 0x02, 0xfe, 
-	0xd9, 0xbb, 0xe5, 0xdf, 0xd9, 0x0a, 0xe8, 0xed, 
-	0x06, 0xf0, 0xf9, 0xfc, 0x16, 0x44, 0x22, 0x19, 
-	0x29, 0xf6, 0x15, 0x14, 0xf6, 0x0f, 0x08, 0xfc, 
-	0x09, 0xfd, 0x03, 0x04, 0xfd, 0x02, 0x02, 0xfe, 
-	0xdf, 0xbb, 0xe7, 0xe2, 0xdb, 0x0a, 0xea, 0xee, 
-	0x07, 0xf1, 0xf9, 0xfe, 0xf7, 0x02, 0xfc, 0xfb, 
-	0x02, 0xfd, 0xfe, 0x01, 0xfe, 0x00, 0x00, 0xff, 
-	0x00, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0x02, 0x02, 0xff, 0x01, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0xfb, 0x00, 
-	0xfc, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x00, 
-	0xff, 0xff, 0xfe, 0xff, 0x03, 0x0e, 0x08, 0x04, 
-	0x08, 0x02, 0x04, 0x05, 0xfe, 0x02, 0x02, 0xfe, 
-	0xfd, 0xfe, 0xff, 0xfe, 0x00, 0xfa, 0xfb, 0x00, 
-	0xfc, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xe6, 0xe3, 
-	0xfe, 0xee, 0xf0, 0x03, 0xf5, 0x0c, 0x07, 0xfa, 
-	0x07, 0x02, 0xfe, 0x05, 0xfe, 0x01, 0x02, 0xfe, 
-	0xfd, 0xff, 0xf4, 0xf3, 0xfe, 0xf8, 0xf9, 0x01, 
-	0xfb, 0xfc, 0xff, 0xf9, 0xfb, 0xfe, 0xe5, 0xe3, 
-	0xfe, 0xee, 0xf1, 0x03, 0xf4, 0xf8, 0xfe, 0xf9, 
-	0xfd, 0xfd, 0xfc, 0x02, 0xff, 0xfe, 0x01, 0xfe, 
-	0x12, 0x44, 0x31, 0x0e, 0x2f, 0x16, 0x0e, 0x1b, 
-	0x08, 0x0b, 0x0f, 0xf9, 0x07, 0x08, 0xfb, 0x04, 
-	0x03, 0xfc, 0x03, 0x00, 0xfe, 0x01, 0xff, 0xff, 
-	0x01, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 
-	0x15, 0x44, 0x30, 0x14, 0x2f, 0x16, 0x10, 0x1b, 
-	0x08, 0x0c, 0x0f, 0xfe, 0x08, 0x08, 0xfd, 0x05, 
-	0x04, 0xfe, 0x03, 0x02, 0xff, 0x02, 0xff, 0xff, 
-	0x01, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xfd, 
-	0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-	0xfe, 0x00, 0x02, 0xfe, 0xf9, 0xfb, 0xfe, 0xfc, 
-	0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf1, 
-	0xf7, 0xfb, 0xf7, 0xfb, 0xfd, 0xfb, 0xfd, 0xfe, 
-	0xfd, 0xfe, 0xfe, 0xfe, 0xfa, 0xfb, 0xfe, 0xfc, 
-	0xfd, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0xe7, 0xf1, 
-	0xec, 0xf2, 0xf6, 0xf4, 0xf7, 0xfa, 0xf9, 0xfb, 
-	0xfc, 0xfb, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 
-	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x02, 0x07, 
-	0x06, 0x01, 0x04, 0x03, 0xfb, 0xe0, 0xe8, 0xf9, 
-	0xed, 0xf2, 0xfb, 0xf4, 0xf8, 0xfc, 0xf9, 0xfb, 
-	0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfe, 0xfe, 0xfd, 
-	0xff, 0xff, 0xfe, 0xff, 0x0d, 0x0b, 0xc1, 0xc6, 
-	0xf5, 0xda, 0xde, 0xf7, 0xe9, 0xec, 0xf7, 0xf2, 
-	0xf4, 0xfa, 0xf7, 0xf9, 0xfd, 0xfb, 0xfc, 0xfe, 
-	0xfc, 0xf9, 0xfb, 0xfd, 0xfc, 0xfd, 0x0a, 0x0d, 
-	0x04, 0x06, 0x07, 0x01, 0x03, 0x04, 0xc0, 0xc7, 
-	0xe5, 0xd0, 0xdd, 0xef, 0xe3, 0xeb, 0xf5, 0xef, 
-	0xf3, 0xf2, 0xf0, 0xf7, 0xf7, 0xf5, 0xf8, 0xfa, 
-	0xf9, 0xf8, 0xfa, 0xfb, 0xfb, 0xfc, 0x0a, 0x0d, 
-	0x2a, 0x44, 0x2c, 0x1b, 0x2f, 0x1b, 0x10, 0x1b, 
-	0xed, 0xe3, 0x0d, 0xf4, 0xef, 0x07, 0xf9, 0xf6, 
-	0x03, 0xf3, 0xf2, 0xfc, 0xf8, 0xf6, 0xf9, 0xfb, 
-	0xf9, 0xf9, 0xf9, 0xfb, 0xfc, 0x03, 0x06, 0x01, 
-	0x2d, 0x44, 0x2a, 0x1c, 0x2f, 0x1a, 0x11, 0x1b, 
-	0x10, 0x0a, 0x10, 0x0a, 0x06, 0x09, 0x06, 0x04, 
-	0x05, 0xf2, 0xf4, 0x01, 0xf8, 0xf8, 0xfd, 0xfb, 
-	0xfb, 0xfa, 0xfa, 0xfc, 0xfc, 0x04, 0x06, 0x01, 
-	0xfe, 0x03, 0x01, 0xed, 0xe0, 0xee, 0xf4, 0xec, 
-	0xf3, 0xf8, 0xf4, 0xf8, 0xfb, 0xf8, 0xfa, 0xfc, 
-	0xfb, 0xf2, 0xf4, 0xfe, 0x0b, 0x08, 0x02, 0x06, 
-	0x05, 0x03, 0x04, 0xfd, 0xfa, 0xfe, 0xfe, 0xfc, 
-	0x02, 0x02, 0xfd, 0xec, 0xe0, 0xef, 0xf4, 0xed, 
-	0xf4, 0xf8, 0xf4, 0xf8, 0xfb, 0xf9, 0xfa, 0xfc, 
-	0xd2, 0xbc, 0xdd, 0xe5, 0xd9, 0xe9, 0xf0, 0xe8, 
-	0xf0, 0xf6, 0xf2, 0xf4, 0xf7, 0xf7, 0xf8, 0xfa, 
-	0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xfa, 0xfd, 0xfc, 
-	0xfc, 0xfe, 0x0c, 0x0c, 0x04, 0x07, 0x07, 0x02, 
-	0xd0, 0xbc, 0xde, 0xe4, 0xd7, 0xe8, 0xe8, 0xd9, 
-	0xe7, 0xf2, 0xe8, 0xef, 0xf6, 0xf2, 0xf5, 0xfa, 
-	0xf8, 0xf9, 0xfa, 0xf1, 0xf3, 0xf9, 0xf7, 0xf7, 
-	0xfb, 0xf8, 0x0b, 0x0c, 0x01, 0x05, 0x07, 0x01, 
-	0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0xed, 0xe0, 
-	0xed, 0xf5, 0xed, 0xf3, 0x44, 0x44, 0x18, 0x28, 
-	0x2c, 0x15, 0x16, 0x18, 0x0d, 0x0d, 0x0f, 0x09, 
-	0x07, 0x07, 0x04, 0x04, 0x04, 0x01, 0x00, 0xff, 
-	0xfe, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfc, 
-	0xfe, 0xfe, 0xf8, 0xf2, 0x44, 0x44, 0x17, 0x28, 
-	0x2b, 0x15, 0x17, 0x1b, 0x10, 0x0d, 0x10, 0x0b, 
-	0x08, 0xf0, 0xe0, 0xec, 0xf6, 0xed, 0xf1, 0xf8, 
-	0xf5, 0xf6, 0xfa, 0xf7, 0xf7, 0xfb, 0xfb, 0xfa, 
-	0x08, 0x0e, 0xfe, 0xf2, 0xfc, 0x04, 0xf8, 0xfb, 
-	0xfa, 0x0e, 0x1d, 0x14, 0x08, 0x11, 0x0e, 0x06, 
-	0x06, 0xdd, 0xd8, 0xeb, 0xec, 0xe7, 0xef, 0xf4, 
-	0xf1, 0xf4, 0xf8, 0xf6, 0xf8, 0xfa, 0xfa, 0xfa, 
-	0x08, 0x0d, 0x07, 0x04, 0x08, 0x05, 0x02, 0x04, 
-	0xfa, 0x0f, 0x1d, 0x13, 0x09, 0x11, 0x0e, 0x06, 
-	0x04, 0xe1, 0xe6, 0xf7, 0xef, 0xef, 0xf7, 0xf6, 
-	0x04, 0x0c, 0x04, 0xfd, 0x07, 0x04, 0xfe, 0x04, 
-	0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0xfe, 
-	0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfa, 
-	0xf9, 0xfc, 0xfd, 0xfc, 0xfd, 0xfe, 0xfd, 0xfe, 
-	0x0b, 0x0d, 0x06, 0x06, 0x08, 0x05, 0x04, 0x05, 
-	0x04, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 
-	0xfa, 0xfd, 0xfd, 0xfc, 0xfd, 0xfe, 0xfd, 0xfe, 
-	0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x01, 0x02, 0x01, 
-	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfe, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-	0x00, 0x00, 0xf6, 0xc0, 0xc3, 0xe4, 0xde, 0xd8, 
-	0xe6, 0xec, 0xe7, 0xec, 0xf3, 0xf1, 0xf2, 0xf6, 
-	0xf7, 0xf7, 0xf9, 0xfa, 0xfa, 0xfb, 0xfc, 0xfc, 
-	0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 
-	0xfe, 0xff, 0xf4, 0xbf, 0xc4, 0xe5, 0xdd, 0xd8, 
-	0xe7, 0xec, 0xe7, 0xec, 0xf3, 0xf1, 0xf2, 0xf6, 
-	0xf7, 0xf7, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xfb, 
-	0xfb, 0xfb, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 
-	0xfe, 0xfe, 0x0a, 0x0e, 0x08, 0x05, 0x08, 0x06, 
-	0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x01, 
-	0x01, 0x02, 0x01, 0x01, 0x01, 0xfa, 0xfa, 0xfc, 
-	0xf5, 0xe0, 0xe5, 0xf3, 0xef, 0xf7, 0x44, 0x3f, 
-	0x1c, 0x23, 0x2b, 0x1e, 0x15, 0x1a, 0x17, 0x0f, 
-	0x0f, 0x0f, 0x0c, 0x09, 0x09, 0x08, 0x06, 0x06, 
-	0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 
-	0xf4, 0xe0, 0xe5, 0xf4, 0xef, 0xd6, 0x0d, 0x2b, 
-	0x0d, 0xef, 0x17, 0x11, 0xf7, 0x0a, 0x0c, 0x05, 
-	0x03, 0x07, 0x05, 0x02, 0x04, 0x03, 0x02, 0x02, 
-	0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xbb, 0xd1, 
-	0xe6, 0xd8, 0xdb, 0xea, 0xe9, 0xe7, 0xed, 0xf2, 
-	0xf0, 0xf2, 0xf6, 0xf6, 0xf6, 0xf8, 0xf9, 0xfa, 
-	0xfa, 0xfb, 0xfc, 0xfc, 0xfd, 0x00, 0x00, 0xfe, 
-	0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 
-	0xfa, 0xfd, 0xfc, 0xfc, 0xfd, 0xfe, 0xfd, 0xfe, 
-	0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0x0b, 0x0d, 0x08, 
-	0x05, 0x08, 0x07, 0x04, 0x04, 0x05, 0x04, 0x02, 
-	0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xfd, 0xf9, 
-	0xfb, 0xfd, 0xfc, 0xfc, 0xfb, 0xe3, 0xe2, 0xef, 
-	0xf1, 0xec, 0xf0, 0xf6, 0xf4, 0x05, 0x0b, 0x04, 
-	0xfb, 0x06, 0x05, 0x00, 0x02, 0x03, 0x02, 0xfe, 
-	0xf3, 0xf2, 0xf8, 0xf9, 0xf7, 0xf8, 0xfb, 0xfb, 
-	0xf9, 0xf8, 0xfa, 0xfc, 0xf9, 0xe2, 0xe2, 0xef, 
-	0xf1, 0xec, 0xf0, 0xf5, 0xf4, 0xf4, 0xf7, 0xf8, 
-	0xf8, 0xfa, 0xfb, 0xfb, 0xfb, 0x35, 0x44, 0x38, 
-	0x1d, 0x2b, 0x2c, 0x1d, 0x18, 0x1c, 0x18, 0x11, 
-	0x11, 0x10, 0x0d, 0x0b, 0x0a, 0x09, 0x07, 0x07, 
-	0x06, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 
-	0x02, 0x02, 0x01, 0x01, 0x01, 0x37, 0x44, 0x37, 
-	0x1f, 0x2d, 0x2c, 0x1d, 0x19, 0x1d, 0x18, 0x12, 
-	0x12, 0x11, 0x0e, 0x0c, 0x0b, 0x0a, 0x08, 0x07, 
-	0x07, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 
-	0x02, 0x02, 0xfe, 0xfe, 0x01, 0x00, 0xfe, 0xfe, 
-	0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfa, 0xf9, 
-	0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-	0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xf5, 0xf1, 0xf5, 0xf9, 0xf7, 0xf7, 0xfa, 0xfb, 
-	0xfa, 0xfb, 0xfc, 0xfc, 0xfc, 0xfe, 0xfa, 0xf9, 
-	0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 
-	0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xe0, 0xe4, 
-	0xee, 0xeb, 0xeb, 0xf0, 0xf2, 0xf2, 0xf3, 0xf6, 
-	0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xfa, 0xfb, 0xfc, 
-	0xfc, 0xfc, 0xfd, 0xfd, 0x09, 0x0e, 0x0a, 0x05, 
-	0x07, 0x08, 0x06, 0x04, 0x05, 0xf1, 0xe0, 0xe4, 
-	0xf1, 0xef, 0xec, 0xf1, 0xf5, 0xf4, 0xf4, 0xf7, 
-	0xf8, 0xf8, 0xf9, 0xfa, 0xfa, 0xfa, 0xfb, 0xfc, 
-	0xfc, 0xfc, 0xfd, 0xfd, 0x09, 0xe5, 0xbe, 0xc4, 
-	0xde, 0xdf, 0xd7, 0xde, 0xe8, 0xe7, 0xe6, 0xeb, 
-	0xef, 0xef, 0xf0, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 
-	0xf7, 0xf7, 0xf8, 0xfa, 0xfa, 0xfb, 0x0c, 0x0d, 
-	0x07, 0x05, 0x07, 0x07, 0x04, 0xe1, 0xbd, 0xc4, 
-	0xd4, 0xd4, 0xd3, 0xdc, 0xe2, 0xe2, 0xe4, 0xe9, 
-	0xeb, 0xe9, 0xeb, 0xf0, 0xf1, 0xf0, 0xf2, 0xf5, 
-	0xf5, 0xf4, 0xf6, 0xf8, 0xf8, 0xf9, 0x0c, 0x0c, 
-	0x3f, 0x44, 0x37, 0x23, 0x2d, 0x2e, 0x22, 0x1a, 
-	0x05, 0xf4, 0x0e, 0x0d, 0x03, 0x04, 0x09, 0x07, 
-	0xfa, 0xf2, 0xf4, 0xfa, 0xf9, 0xf6, 0xf7, 0xfa, 
-	0xf9, 0xf7, 0xf8, 0xfa, 0xfa, 0xfa, 0xfb, 0xf3, 
-	0x3f, 0x44, 0x36, 0x22, 0x2d, 0x2d, 0x22, 0x1e, 
-	0x1f, 0x1b, 0x16, 0x14, 0x13, 0x11, 0x0e, 0x05, 
-	0xfa, 0x07, 0x07, 0x03, 0x01, 0x03, 0x04, 0x03, 
-	0xfd, 0xfa, 0xfb, 0xfd, 0xfd, 0xfc, 0xfc, 0xf3, 
-	0xf2, 0xea, 0xdf, 0xe5, 0xef, 0xee, 0xee, 0xf6, 
-	0xf9, 0xf5, 0xf5, 0xf9, 0xf9, 0xf8, 0xf9, 0xf2, 
-	0xf1, 0xf6, 0x0a, 0x0a, 0x03, 0x02, 0x06, 0x06, 
-	0x04, 0x02, 0xfb, 0xfb, 0xfd, 0xfe, 0xfe, 0x01, 
-	0x01, 0xeb, 0xe0, 0xe6, 0xf0, 0xef, 0xec, 0xf0, 
-	0xf4, 0xf4, 0xf4, 0xf6, 0xf7, 0xf7, 0xf8, 0xe1, 
-	0xbe, 0xc2, 0xdb, 0xe0, 0xd7, 0xdb, 0xe5, 0xe7, 
-	0xe6, 0xe8, 0xec, 0xee, 0xef, 0xf0, 0xf3, 0xf4, 
-	0xf5, 0xf6, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xfa, 
-	0xfa, 0xfa, 0xfb, 0x08, 0x0d, 0x0b, 0x06, 0xe0, 
-	0xbe, 0xc3, 0xda, 0xde, 0xd7, 0xdb, 0xe4, 0xe7, 
-	0xe6, 0xe0, 0xdb, 0xe2, 0xe9, 0xe9, 0xe9, 0xec, 
-	0xf0, 0xf1, 0xf1, 0xf3, 0xf4, 0xf4, 0xf5, 0xf3, 
-	0xf0, 0xf2, 0xf6, 0x01, 0x0a, 0x08, 0xfd, 0xfb, 
-	0x02, 0x02, 0xfd, 0xfc, 0xfd, 0xfe, 0xfd, 0xfd, 
-	0xfe, 0xe8, 0xe0, 0xe7, 0xf0, 0xee, 0xec, 0xf0, 
-	0xf3, 0xf3, 0xf4, 0xf5, 0xf7, 0x37, 0x44, 0x3f, 
-	0x25, 0x29, 0x2f, 0x28, 0x1e, 0x1d, 0x1d, 0x19, 
-	0x15, 0x14, 0x13, 0x11, 0x0e, 0x0d, 0x0c, 0x0b, 
-	0x0a, 0x09, 0x08, 0x07, 0x06, 0x06, 0x00, 0xfc, 
-	0x01, 0x03, 0x01, 0xfe, 0x01, 0x39, 0x44, 0x3e, 
-	0x26, 0x2a, 0x2f, 0x28, 0x1e, 0x1d, 0x1e, 0x1a, 
-	0x16, 0x14, 0x13, 0x11, 0x0f, 0x0e, 0xf9, 0xe3, 
-	0xe4, 0xee, 0xf2, 0xee, 0xee, 0xf2, 0xf3, 0xf3, 
-	0xf4, 0xf6, 0xf7, 0xf7, 0xf8, 0xf9, 0xf3, 0xf5, 
-	0x08, 0x08, 0x0b, 0x1b, 0x1b, 0x12, 0x0e, 0x11, 
-	0x11, 0x0d, 0x0b, 0x0b, 0x0b, 0x09, 0xf2, 0xe1, 
-	0xe3, 0xed, 0xf1, 0xed, 0xe8, 0xde, 0xe1, 0xea, 
-	0xec, 0xea, 0xec, 0xf0, 0xf1, 0xf2, 0xf3, 0xfe, 
-	0x0a, 0x06, 0x0c, 0x1c, 0x1b, 0x12, 0x0e, 0x11, 
-	0x11, 0x0d, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x07, 
-	0x06, 0x06, 0x05, 0x05, 0xee, 0xe0, 0xe3, 0xed, 
-	0xf0, 0xec, 0xee, 0xf2, 0xf3, 0xf3, 0xf4, 0xf6, 
-	0xf7, 0xf7, 0xfe, 0x0c, 0x0b, 0x06, 0x05, 0x07, 
-	0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 
-	0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-	0x01, 0x00, 0x00, 0xfb, 0xf9, 0xfa, 0xfc, 0xfc, 
-	0xfc, 0xfc, 0x07, 0x0d, 0x0c, 0x08, 0x07, 0x08, 
-	0x08, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 
-	0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 
-	0x01, 0x01, 0x01, 0xfb, 0xf9, 0xfb, 0xfc, 0xfc, 
-	0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 
-	0xfe, 0xff, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-	0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 
-	0xff, 0xff, 0x00, 0xd4, 0xbc, 0xc3, 0xd7, 0xdc, 
-	0xd6, 0xd8, 0xdf, 0xe4, 0xe4, 0xe5, 0xe8, 0xeb, 
-	0xed, 0xee, 0xef, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 
-	0xf6, 0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 
-	0xfb, 0xfb, 0xfc, 0xd3, 0xbc, 0xc4, 0xd8, 0xdc, 
-	0xd6, 0xd8, 0xe0, 0xe4, 0xe4, 0xe5, 0xe9, 0xeb, 
-	0xec, 0xed, 0xef, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 
-	0xf6, 0xf7, 0xf7, 0xf8, 0x08, 0x0d, 0x0a, 0x06, 
-	0x06, 0x07, 0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 
-	0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x0c, 0x39, 
-	0x42, 0x34, 0x23, 0x25, 0x29, 0x25, 0x1e, 0x1b, 
-	0x1b, 0x19, 0x16, 0x14, 0x15, 0x16, 0x13, 0x10, 
-	0x0f, 0x0e, 0x0d, 0x0b, 0x0a, 0x0a, 0x09, 0x08, 
-	0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x0f, 0x39, 
-	0x42, 0x33, 0x24, 0x25, 0x29, 0x25, 0x17, 0xc8, 
-	0xc1, 0xd2, 0xe1, 0xdd, 0xd9, 0xde, 0xe4, 0xe7, 
-	0xe6, 0xe8, 0xeb, 0xed, 0xee, 0xef, 0xf1, 0xf2, 
-	0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 
-	0xf9, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xe9, 0xc2, 
-	0xbd, 0xcd, 0xdb, 0xd9, 0xd6, 0xda, 0xe1, 0xe3, 
-	0xe4, 0xe5, 0xe8, 0xeb, 0xec, 0xed, 0xef, 0xf1, 
-	0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf6, 0xf7, 0xf8, 
-	0xf7, 0xf7, 0xf8, 0xf9, 0xfa, 0xfa, 0xfa, 0xfb, 
-	0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0x07, 0x0d, 0x0d, 
-	0x09, 0x07, 0x08, 0x08, 0x07, 0x06, 0x05, 0x05, 
-	0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 
-	0xfb, 0xfa, 0xfb, 0xf3, 0xe2, 0xe1, 0xe8, 0xee, 
-	0xed, 0xec, 0xee, 0xf1, 0xf2, 0xf5, 0x06, 0x07, 
-	0xfc, 0xfa, 0xfd, 0x03, 0x01, 0xfa, 0xf3, 0xf2, 
-	0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 
-	0xf8, 0xf9, 0xfa, 0xf1, 0xe2, 0xe0, 0xe8, 0xee, 
-	0xed, 0xec, 0xee, 0xf1, 0xf2, 0xf2, 0xf3, 0xf4, 
-	0xf6, 0x0b, 0x41, 0x44, 0x41, 0x2e, 0x2a, 0x2f, 
-	0x2d, 0x26, 0x21, 0x20, 0x1f, 0x1c, 0x19, 0x17, 
-	0x16, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0d, 0x0c, 
-	0x0b, 0x0a, 0x0a, 0x09, 0x08, 0x07, 0x07, 0x06, 
-	0x06, 0x11, 0x42, 0x44, 0x40, 0x2e, 0x2c, 0x30, 
-	0x2e, 0x27, 0x22, 0x21, 0x20, 0x1d, 0x1a, 0x18, 
-	0x16, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0e, 0x0d, 
-	0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x08, 0x07, 0x07, 
-	0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 
-	0xfc, 0xfa, 0xfa, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 
-	0xfa, 0xf9, 0xfa, 0x02, 0x05, 0x04, 0x01, 0x01, 
-	0x02, 0xfb, 0xf3, 0xf2, 0xf4, 0xf7, 0xf7, 0xf7, 
-	0xf7, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfb, 0xfc, 
-	0xfa, 0xf8, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 
-	0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xeb, 0xe0, 
-	0xe2, 0xe9, 0xea, 0xe9, 0xe9, 0xec, 0xef, 0xef, 
-	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 
-	0xf7, 0xf8, 0xf8, 0xf9, 0x05, 0x0c, 0x0c, 0x09, 
-	0x06, 0x07, 0x08, 0x07, 0x06, 0x05, 0xea, 0xe0, 
-	0xe2, 0xea, 0xee, 0xec, 0xec, 0xee, 0xf0, 0xf2, 
-	0xf2, 0xf3, 0xf4, 0xf5, 0xf5, 0xf6, 0xf7, 0xf7, 
-	0xf8, 0xf8, 0xf9, 0xf9, 0x06, 0xd9, 0xbf, 0xbf, 
-	0xce, 0xd9, 0xd8, 0xd6, 0xd8, 0xde, 0xe1, 0xe2, 
-	0xe3, 0xe5, 0xe8, 0xe9, 0xeb, 0xec, 0xee, 0xef, 
-	0xef, 0xf0, 0xf1, 0xf3, 0xf4, 0xf8, 0x09, 0x09, 
-	0x05, 0xfd, 0x02, 0x04, 0x04, 0xd6, 0xbe, 0xbd, 
-	0xc7, 0xd0, 0xd2, 0xd2, 0xd5, 0xd9, 0xdd, 0xdf, 
-	0xdf, 0xe0, 0xe3, 0xe5, 0xe7, 0xe8, 0xea, 0xeb, 
-	0xec, 0xed, 0xef, 0xf0, 0xf1, 0xf5, 0x06, 0x18, 
-	0x43, 0x44, 0x42, 0x31, 0x2d, 0x30, 0x30, 0x26, 
-	0x17, 0x15, 0x1b, 0x1b, 0x17, 0x14, 0x13, 0x13, 
-	0x0f, 0x09, 0x08, 0x0a, 0x0a, 0x07, 0x05, 0x05, 
-	0x04, 0xfe, 0xfd, 0x02, 0x02, 0x02, 0xf8, 0x16, 
-	0x43, 0x44, 0x41, 0x31, 0x2d, 0x30, 0x30, 0x2a, 
-	0x25, 0x22, 0x19, 0x08, 0x08, 0x11, 0x12, 0x16, 
-	0x1f, 0x1f, 0x1a, 0x15, 0x14, 0x15, 0x14, 0x12, 
-	0x0f, 0x0e, 0x0e, 0x0d, 0x0c, 0x0b, 0x07, 0xed, 
-	0xe1, 0xe0, 0xe6, 0xec, 0xec, 0xeb, 0xec, 0xee, 
-	0xf0, 0xf0, 0xe4, 0xde, 0xe1, 0xe8, 0xeb, 0xf2, 
-	0x17, 0x1b, 0x16, 0x0e, 0x0e, 0x10, 0x10, 0x0e, 
-	0x0b, 0x0a, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0xf0, 
-	0xe2, 0xe1, 0xe7, 0xed, 0xed, 0xec, 0xed, 0xef, 
-	0xf1, 0xf2, 0xf2, 0xf3, 0xf4, 0xf5, 0xf5, 0xdd, 
-	0xc1, 0xbe, 0xc9, 0xd6, 0xd8, 0xd5, 0xd6, 0xda, 
-	0xde, 0xe0, 0xe1, 0xe3, 0xe5, 0xe7, 0xe9, 0xea, 
-	0xeb, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf2, 
-	0xf3, 0xf4, 0xf5, 0xf5, 0xf6, 0xf7, 0x06, 0xde, 
-	0xc1, 0xbe, 0xc9, 0xd6, 0xd8, 0xd5, 0xd6, 0xda, 
-	0xdf, 0xe1, 0xe2, 0xe3, 0xe5, 0xe7, 0xdf, 0xdb, 
-	0xde, 0xe3, 0xe7, 0xe7, 0xe7, 0xe9, 0xeb, 0xec, 
-	0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf7, 0xf6, 
-	0xf3, 0xf3, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-	0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xf7, 0xe6, 0xe0, 
-	0xe3, 0xe9, 0xec, 0xec, 0xeb, 0xed, 0xef, 0xf0, 
-	0xf1, 0xf2, 0xf2, 0xf3, 0xf4, 0xf5, 0xf4, 0xf0, 
-	0xef, 0xf1, 0xf4, 0x2e, 0x44, 0x44, 0x3e, 0x30, 
-	0x2e, 0x31, 0x30, 0x2b, 0x27, 0x24, 0x23, 0x21, 
-	0x1f, 0x1d, 0x1b, 0x19, 0x18, 0x16, 0x15, 0x13, 
-	0x12, 0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0a, 
-	0x09, 0x09, 0x09, 0x30, 0x44, 0x44, 0x3e, 0x30, 
-	0x2e, 0x30, 0x30, 0x2b, 0x27, 0x24, 0x23, 0x21, 
-	0x1f, 0x1c, 0x1b, 0x19, 0x18, 0x16, 0x15, 0x13, 
-	0x12, 0xfd, 0xe6, 0xe4, 0xe9, 0xef, 0xf0, 0xee, 
-	0xee, 0xef, 0xf1, 0xf8, 0x18, 0x1d, 0x19, 0x11, 
-	0x0a, 0x0c, 0x0f, 0x0f, 0x0d, 0x0b, 0x0b, 0x0b, 
-	0x0a, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 
-	0x06, 0xee, 0xe2, 0xe1, 0xe6, 0xeb, 0xed, 0xec, 
-	0xec, 0xee, 0xef, 0xf6, 0x17, 0x1c, 0x19, 0x12, 
-	0x0e, 0xeb, 0xe5, 0xe7, 0xed, 0xf1, 0xf0, 0xef, 
-	0xf0, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 
-	0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 
-	0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-	0xf5, 0xe5, 0xe0, 0xe3, 0xe9, 0xec, 0xec, 0xeb, 
-	0xec, 0xee, 0xf0, 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 
-	0xf4, 0xf5, 0xf7, 0x08, 0x0b, 0x09, 0x06, 0x05, 
-	0x05, 0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x03, 
-	0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 
-	0x02, 0x02, 0xfd, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 
-	0xfc, 0xfc, 0x05, 0x0c, 0x0d, 0x0c, 0x09, 0x08, 
-	0x08, 0x09, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 
-	0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 
-	0x03, 0x03, 0xfe, 0xfa, 0xfa, 0xfb, 0xfc, 0xfc, 
-	0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 
-	0x01, 0x01, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xfe, 0xff, 0xe2, 0xc4, 0xbd, 0xc4, 0xcf, 
-	0xd5, 0xd5, 0xd4, 0xd6, 0xd9, 0xdd, 0xde, 0xe0, 
-	0xe1, 0xe3, 0xe5, 0xe6, 0xe8, 0xe9, 0xea, 0xeb, 
-	0xec, 0xee, 0xef, 0xef, 0xf0, 0xf1, 0xf2, 0xf3, 
-	0xf3, 0xf4, 0xf5, 0xdf, 0xc3, 0xbc, 0xc4, 0xcf, 
-	0xd5, 0xd4, 0xd4, 0xd6, 0xd9, 0xdc, 0xde, 0xdf, 
-	0xe1, 0xe3, 0xe4, 0xe6, 0xe7, 0xe9, 0xec, 0xf0, 
-	0xf1, 0xf0, 0xf0, 0xf1, 0xf3, 0xf4, 0xf4, 0xfb, 
-	0x30, 0x40, 0x3f, 0x34, 0x2b, 0x29, 0x2a, 0x2a, 
-	0x27, 0x24, 0x21, 0x20, 0x1e, 0x1c, 0x1b, 0x19, 
-	0x18, 0x17, 0x15, 0x14, 0x13, 0x12, 0x13, 0x14, 
-	0x13, 0x12, 0x10, 0x0f, 0x0f, 0x0e, 0x0d, 0x10, 
-	0x32, 0x41, 0x3f, 0x35, 0x2c, 0x2a, 0x2b, 0x2b, 
-	0x28, 0x24, 0x22, 0x20, 0x1f, 0x1d, 0x1c, 0xef, 
-	0xc9, 0xc0, 0xc6, 0xd1, 0xd8, 0xd8, 0xd7, 0xd8, 
-	0xdb, 0xde, 0xe0, 0xe1, 0xe2, 0xe4, 0xe5, 0xe7, 
-	0xe8, 0xe9, 0xea, 0xec, 0xed, 0xee, 0xef, 0xef, 
-	0xf0, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xdf, 
-	0xc4, 0xbc, 0xc3, 0xcd, 0xd4, 0xd4, 0xd3, 0xd5, 
-	0xd8, 0xdb, 0xdd, 0xdf, 0xe0, 0xe2, 0xe3, 0xe5, 
-	0xe6, 0xe8, 0xe9, 0xe9, 0xeb, 0xec, 0xed, 0xee, 
-	0xef, 0xf0, 0xf0, 0xf1, 0xf2, 0xf3, 0xf5, 0x05, 
-	0x09, 0x07, 0x04, 0xfe, 0x02, 0x04, 0x04, 0x03, 
-	0x02, 0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 
-	0x02, 0x02, 0xfb, 0xec, 0xe2, 0xe0, 0xe4, 0xe9, 
-	0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xee, 0xf1, 0xf6, 
-	0xfa, 0xf8, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 
-	0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 
-	0xf7, 0xf7, 0xf7, 0xeb, 0xe1, 0xe0, 0xe4, 0xe8, 
-	0xeb, 0xea, 0xea, 0xeb, 0xed, 0xee, 0xef, 0x2e, 
-	0x44, 0x44, 0x43, 0x37, 0x31, 0x30, 0x31, 0x2f, 
-	0x2c, 0x29, 0x27, 0x25, 0x23, 0x22, 0x20, 0x1e, 
-	0x1d, 0x1b, 0x1a, 0x18, 0x17, 0x16, 0x15, 0x14, 
-	0x13, 0x12, 0x11, 0x10, 0x0f, 0x0f, 0x0e, 0x33, 
-	0x44, 0x44, 0x44, 0x39, 0x33, 0x33, 0x34, 0x32, 
-	0x2e, 0x2b, 0x29, 0x27, 0x25, 0x23, 0x21, 0x1f, 
-	0x1e, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x15, 
-	0x14, 0x13, 0x12, 0x11, 0x10, 0x10, 0x0f, 0x0e, 
-	0x0d, 0x0d, 0x0c, 0x0b, 0x09, 0x09, 0x08, 0x08, 
-	0x08, 0x07, 0x07, 0x06, 0x05, 0x03, 0xfe, 0x01, 
-	0x03, 0x03, 0x03, 0xfc, 0xf5, 0xf3, 0xf4, 0xf5, 
-	0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 
-	0xf9, 0xfa, 0xfa, 0xf9, 0xf8, 0xf8, 0xf9, 0xfa, 
-	0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xef, 
-	0xe4, 0xe0, 0xe3, 0xe7, 0xe8, 0xe7, 0xe7, 0xe8, 
-	0xea, 0xec, 0xec, 0xed, 0xee, 0xef, 0xef, 0xf0, 
-	0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf9, 0x08, 0x09, 
-	0x07, 0x04, 0x03, 0x04, 0x05, 0x05, 0x03, 0xee, 
-	0xe3, 0xe0, 0xe3, 0xe7, 0xea, 0xeb, 0xeb, 0xeb, 
-	0xec, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xf1, 0xf2, 
-	0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xda, 0xc4, 0xbe, 
-	0xc3, 0xcb, 0xd2, 0xd3, 0xd3, 0xd4, 0xd6, 0xd8, 
-	0xda, 0xdc, 0xde, 0xdf, 0xe1, 0xe2, 0xe4, 0xe5, 
-	0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xec, 0xf0, 0xf2, 
-	0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xd8, 0xc2, 0xbb, 
-	0xbd, 0xc4, 0xcb, 0xce, 0xce, 0xcf, 0xd1, 0xd4, 
-	0xd6, 0xd7, 0xd8, 0xda, 0xdc, 0xde, 0xdf, 0xe0, 
-	0xe2, 0xe3, 0xe4, 0xe5, 0xe7, 0xe9, 0xec, 0x09, 
-	0x38, 0x44, 0x44, 0x41, 0x38, 0x33, 0x32, 0x2f, 
-	0x29, 0x25, 0x24, 0x23, 0x23, 0x21, 0x1f, 0x1d, 
-	0x1b, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 
-	0x11, 0x10, 0x0f, 0x0e, 0x0e, 0x0d, 0x0a, 0x15, 
-	0x3a, 0x44, 0x44, 0x42, 0x39, 0x34, 0x34, 0x34, 
-	0x32, 0x2f, 0x28, 0x20, 0x1d, 0x1e, 0x1f, 0x1e, 
-	0x1c, 0x1a, 0x18, 0x17, 0x18, 0x18, 0x18, 0x16, 
-	0x18, 0x1e, 0x20, 0x1f, 0x1c, 0x19, 0x0b, 0xea, 
-	0xe7, 0xea, 0xf0, 0xf3, 0xf3, 0xf1, 0xf1, 0xf2, 
-	0xf3, 0xf1, 0xe6, 0xe0, 0xe0, 0xe3, 0xe7, 0xea, 
-	0xec, 0xed, 0xed, 0xed, 0xf0, 0xf5, 0xf8, 0xf7, 
-	0x08, 0x16, 0x1a, 0x19, 0x16, 0x13, 0xf3, 0xe7, 
-	0xe6, 0xe9, 0xed, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 
-	0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf8, 
-	0xdf, 0xc7, 0xbe, 0xc1, 0xc8, 0xcf, 0xd2, 0xd2, 
-	0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xdd, 0xdf, 
-	0xe0, 0xe1, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 
-	0xe9, 0xea, 0xeb, 0xeb, 0xec, 0xed, 0xee, 0xef, 
-	0xda, 0xc4, 0xbd, 0xc0, 0xc8, 0xcf, 0xd2, 0xd2, 
-	0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xdd, 0xde, 
-	0xe0, 0xe1, 0xe3, 0xe4, 0xe5, 0xe4, 0xde, 0xda, 
-	0xdb, 0xde, 0xe1, 0xe3, 0xe4, 0xe4, 0xe5, 0xe6, 
-	0xe7, 0xe9, 0xea, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 
-	0xf1, 0xf2, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xf1, 
-	0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xef, 0xe4, 0xdf, 
-	0xe0, 0xe3, 0xe7, 0xe8, 0xe9, 0xe9, 0xe9, 0xea, 
-	0xec, 0xed, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xf1, 
-	0xf1, 0xf2, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xf1, 
-	0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0x17, 
-	0x3b, 0x44, 0x44, 0x44, 0x3b, 0x36, 0x34, 0x34, 
-	0x33, 0x31, 0x2f, 0x2d, 0x2b, 0x29, 0x27, 0x26, 
-	0x24, 0x23, 0x21, 0x20, 0x1f, 0x1d, 0x1c, 0x1b, 
-	0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x20, 
-	0x3e, 0x44, 0x44, 0x44, 0x3d, 0x38, 0x36, 0x36, 
-	0x34, 0x32, 0x2f, 0x2d, 0x2b, 0x29, 0x28, 0x26, 
-	0x25, 0x23, 0x22, 0x20, 0x1f, 0x1f, 0x1f, 0x1e, 
-	0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x15, 0x14, 
-	0x13, 0x13, 0x12, 0x11, 0x11, 0x0d, 0x09, 0xfb, 
-	0xf5, 0xf5, 0xf6, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 
-	0xf9, 0xfa, 0xfa, 0xfa, 0xfd, 0x09, 0x0c, 0x0c, 
-	0x0b, 0x0a, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 
-	0x07, 0x07, 0x07, 0x06, 0x06, 0xf8, 0xf4, 0xf3, 
-	0xf4, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 
-	0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xef, 0xe5, 0xe1, 
-	0xe1, 0xe4, 0xe7, 0xe9, 0xea, 0xea, 0xea, 0xeb, 
-	0xec, 0xed, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xf1, 
-	0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 
-	0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xee, 0xe4, 0xe0, 
-	0xe1, 0xe4, 0xe7, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 
-	0xeb, 0xec, 0xed, 0xee, 0xee, 0xf0, 0xf3, 0xf8, 
-	0xf9, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 
-	0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 
-	0xfa, 0xfb, 0xfa, 0xf9, 0xf8, 0xf8, 0xf9, 0xf9, 
-	0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0x03, 0x0a, 0x0c, 
-	0x0d, 0x0c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x08, 
-	0x08, 0x08, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 
-	0x06, 0x05, 0x05, 0x02, 0xfd, 0xfc, 0xfd, 0xfe, 
-	0x01, 0x01, 0xff, 0xfe, 0xfe, 0xfe, 0x01, 0x02, 
-	0x02, 0x02, 0x02, 0xf7, 0xd5, 0xc4, 0xbe, 0xc1, 
-	0xc7, 0xcc, 0xd0, 0xd1, 0xd1, 0xd2, 0xd4, 0xd5, 
-	0xd7, 0xd9, 0xda, 0xdb, 0xdd, 0xde, 0xdf, 0xe0, 
-	0xe1, 0xe3, 0xe4, 0xe5, 0xe6, 0xe6, 0xe7, 0xe8, 
-	0xe9, 0xea, 0xeb, 0xea, 0xd1, 0xc1, 0xbc, 0xbf, 
-	0xc5, 0xcb, 0xce, 0xcf, 0xcf, 0xd0, 0xd2, 0xd4, 
-	0xd7, 0x0f, 0x30, 0x37, 0x35, 0x2f, 0x29, 0x26, 
-	0x25, 0x25, 0x25, 0x24, 0x22, 0x21, 0x1f, 0x1e, 
-	0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x18, 0x16, 
-	0x15, 0x15, 0x14, 0x13, 0x13, 0x12, 0x11, 0x11, 
-	0x13, 0x2d, 0x3d, 0x42, 0x40, 0x3a, 0x34, 0x31, 
-	0x30, 0x2f, 0x2e, 0x2d, 0x2b, 0x29, 0x28, 0x26, 
-	0x25, 0x24, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 
-	0x18, 0xda, 0xc7, 0xc2, 0xc5, 0xcb, 0xd0, 0xd3, 
-	0xd4, 0xd4, 0xd5, 0xd6, 0xd8, 0xda, 0xdb, 0xdc, 
-	0xdd, 0xde, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 
-	0xe6, 0xe7, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 
-	0xe7, 0xcf, 0xc1, 0xbd, 0xbf, 0xc5, 0xca, 0xcd, 
-	0xcf, 0xcf, 0xd0, 0xd2, 0xd3, 0xd5, 0xd7, 0xd8, 
-	0xd9, 0xda, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 
-	0xe3, 0xe5, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 
-	0xeb, 0xec, 0xed, 0xed, 0xee, 0xef, 0xef, 0xf0, 
-	0xf0, 0xf1, 0xf1, 0xf1, 0xe8, 0xe2, 0xdf, 0xe0, 
-	0xe2, 0xe5, 0xe6, 0xe7, 0xe7, 0xe8, 0xe9, 0xe9, 
-	0xeb, 0xed, 0xf0, 0xf1, 0xef, 0xed, 0xed, 0xed, 
-	0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 
-	0xf2, 0xf2, 0xf3, 0xf2, 0xe9, 0xe2, 0xe0, 0xe1, 
-	0xe3, 0xe5, 0xe7, 0xe8, 0xe8, 0x19, 0x39, 0x44, 
-	0x44, 0x44, 0x3e, 0x39, 0x36, 0x34, 0x33, 0x32, 
-	0x31, 0x2f, 0x2d, 0x2c, 0x2a, 0x29, 0x27, 0x26, 
-	0x25, 0x24, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 
-	0x1c, 0x1b, 0x1a, 0x1a, 0x19, 0x28, 0x40, 0x44, 
-	0x44, 0x44, 0x42, 0x3d, 0x3b, 0x39, 0x38, 0x37, 
-	0x36, 0x34, 0x31, 0x30, 0x2e, 0x2d, 0x2b, 0x2a, 
-	0x28, 0x27, 0x26, 0x24, 0x22, 0x21, 0x21, 0x20, 
-	0x20, 0x1f, 0x1e, 0x1c, 0x1b, 0x1b, 0x1a, 0x19, 
-	0x18, 0x17, 0x16, 0x15, 0x15, 0x14, 0x13, 0x13, 
-	0x12, 0x11, 0x10, 0x10, 0x0f, 0x0f, 0x0d, 0x09, 
-	0x04, 0xfe, 0x03, 0x02, 0xf7, 0xf6, 0xfd, 0x08, 
-	0x09, 0x09, 0x08, 0x07, 0x06, 0x06, 0x05, 0x04, 
-	0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-	0xf8, 0xeb, 0xe4, 0xe1, 0xe2, 0xe4, 0xe6, 0xe6, 
-	0xe6, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 
-	0xeb, 0xec, 0xed, 0xed, 0xee, 0xef, 0xf1, 0xf5, 
-	0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 
-	0xf3, 0xe9, 0xe2, 0xe0, 0xe1, 0xe4, 0xe6, 0xe7, 
-	0xe8, 0xe8, 0xe9, 0xe9, 0xea, 0xeb, 0xeb, 0xec, 
-	0xed, 0xed, 0xee, 0xee, 0xef, 0xe2, 0xcd, 0xc2, 
-	0xbf, 0xc1, 0xc6, 0xca, 0xcd, 0xce, 0xcf, 0xd0, 
-	0xd1, 0xd2, 0xd4, 0xd5, 0xd7, 0xd8, 0xd9, 0xda, 
-	0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe1, 0xe3, 0xe4, 
-	0xe6, 0xe6, 0xe7, 0xe7, 0xe8, 0xde, 0xca, 0xbe, 
-	0xbb, 0xbb, 0xbe, 0xc2, 0xc6, 0xc8, 0xc9, 0xca, 
-	0xcb, 0xcc, 0xcd, 0xcf, 0xd0, 0xd2, 0xd3, 0xd5, 
-	0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdc, 0xde, 0xe0, 
-	0x17, 0x37, 0x44, 0x44, 0x43, 0x3d, 0x39, 0x34, 
-	0x2f, 0x2c, 0x2b, 0x2a, 0x2a, 0x29, 0x28, 0x26, 
-	0x25, 0x23, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 
-	0x1b, 0x1a, 0x19, 0x19, 0x18, 0x17, 0x16, 0x14, 
-	0x29, 0x3f, 0x44, 0x44, 0x44, 0x43, 0x3e, 0x3b, 
-	0x3a, 0x39, 0x36, 0x31, 0x2d, 0x2b, 0x2a, 0x2a, 
-	0x29, 0x28, 0x27, 0x25, 0x24, 0x24, 0x24, 0x23, 
-	0x22, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x19, 
-	0x17, 0x16, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 
-	0x10, 0x0f, 0xf5, 0xe9, 0xe5, 0xe4, 0xe6, 0xe9, 
-	0xed, 0xef, 0xf0, 0xef, 0xf0, 0xf2, 0xf5, 0xf7, 
-	0xf7, 0xf6, 0xf5, 0xf4, 0xf4, 0xf5, 0xf6, 0xf6, 
-	0xf7, 0xf6, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf3, 
-	0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xfa, 
-	0x07, 0x0a, 0xeb, 0xd1, 0xc4, 0xc0, 0xc1, 0xc4, 
-	0xc9, 0xcc, 0xce, 0xcf, 0xcf, 0xd0, 0xd2, 0xd3, 
-	0xd4, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 
-	0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe2, 0xe3, 
-	0xe4, 0xe4, 0xdd, 0xcb, 0xc0, 0xbc, 0xbd, 0xc1, 
-	0xc5, 0xc8, 0xca, 0xcc, 0xcd, 0xcf, 0xd0, 0xd1, 
-	0xd2, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 
-	0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 
-	0xe3, 0xe2, 0xde, 0xda, 0xd9, 0xda, 0xdb, 0xdd, 
-	0xdf, 0xe0, 0xe1, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 
-	0xe7, 0xe8, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 0xeb, 
-	0xec, 0xec, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0xeb, 
-	0xec, 0xeb, 0xe4, 0xe0, 0xde, 0xde, 0xe0, 0xe2, 
-	0xe3, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe8, 
-	0xe8, 0xe9, 0xea, 0xea, 0xeb, 0xeb, 0xec, 0xec, 
-	0xed, 0xed, 0xee, 0xee, 0xec, 0xec, 0xeb, 0xec, 
-	0xed, 0xed, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 
-	0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 
-	0xf3, 0x24, 0x3b, 0x44, 0x44, 0x44, 0x43, 0x3f, 
-	0x3c, 0x3a, 0x39, 0x38, 0x37, 0x35, 0x34, 0x32, 
-	0x31, 0x30, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x29, 
-	0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 
-	0x20, 0x30, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x41, 0x3e, 0x3d, 0x3c, 0x3b, 0x39, 0x38, 0x36, 
-	0x35, 0x33, 0x32, 0x31, 0x2f, 0x2e, 0x2d, 0x2c, 
-	0x2b, 0x2a, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 
-	0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1e, 0x1d, 0x1d, 
-	0x1c, 0x1b, 0x1a, 0x1a, 0x19, 0x18, 0x18, 0x17, 
-	0x16, 0x16, 0x15, 0x13, 0x11, 0x10, 0x0f, 0x0f, 
-	0x0f, 0x0f, 0x0e, 0x0d, 0x0d, 0x0c, 0x0c, 0x0b, 
-	0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 
-	0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 
-	0x07, 0x07, 0x04, 0xf8, 0xf5, 0xf4, 0xf4, 0xf5, 
-	0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-	0xf7, 0xf8, 0xf8, 0xf5, 0xeb, 0xe5, 0xe2, 0xe1, 
-	0xe2, 0xe4, 0xe6, 0xe7, 0xe7, 0xe8, 0xe8, 0xe9, 
-	0xe9, 0xea, 0xea, 0xeb, 0xeb, 0xec, 0xec, 0xed, 
-	0xed, 0xee, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 
-	0xf0, 0xf1, 0xf1, 0xef, 0xe8, 0xe2, 0xe0, 0xe0, 
-	0xe1, 0xe2, 0xe4, 0xe5, 0xe6, 0xe6, 0xe7, 0xe8, 
-	0xea, 0xec, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 
-	0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 
-	0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 
-	0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 
-	0x06, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 
-	0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-	0x06, 0x05, 0x03, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 
-	0x01, 0x01, 0x01, 0xf0, 0xd7, 0xc9, 0xc2, 0xc0, 
-	0xc2, 0xc5, 0xc8, 0xca, 0xcc, 0xcd, 0xce, 0xcf, 
-	0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 
-	0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdc, 0xdd, 0xde, 
-	0xdf, 0xe0, 0x11, 0x29, 0x26, 0x14, 0xe5, 0xdc, 
-	0xda, 0xdb, 0xde, 0xe1, 0xe3, 0xe4, 0xe5, 0xe5, 
-	0xe5, 0xe6, 0xe6, 0xe7, 0xe8, 0xe8, 0xe9, 0xea, 
-	0xea, 0xeb, 0xeb, 0xec, 0xec, 0xed, 0xed, 0xee, 
-	0xee, 0xf0, 0x20, 0x32, 0x3b, 0x3e, 0x3d, 0x3a, 
-	0x37, 0x34, 0x32, 0x31, 0x30, 0x2f, 0x2f, 0x2e, 
-	0x2d, 0x2b, 0x2a, 0x29, 0x28, 0x28, 0x27, 0x26, 
-	0x25, 0x24, 0x23, 0x22, 0x22, 0x21, 0x20, 0x1f, 
-	0x1f, 0x1d, 0xea, 0xd3, 0xc8, 0xc5, 0xc6, 0xc8, 
-	0xcb, 0xce, 0xd0, 0xd1, 0xd2, 0xd2, 0xd3, 0xd4, 
-	0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xda, 0xdb, 
-	0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xe0, 0xe1, 0xe1, 
-	0xe2, 0xe1, 0xd3, 0xc6, 0xbe, 0xbc, 0xbd, 0xc0, 
-	0xc3, 0xc5, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 
-	0xcd, 0xcf, 0xd0, 0xd1, 0xd2, 0xd4, 0xd5, 0xd6, 
-	0xd7, 0xd8, 0xd9, 0xda, 0xda, 0xdb, 0xdc, 0xdd, 
-	0xde, 0xde, 0xdf, 0xe0, 0xe1, 0xe0, 0xdd, 0xda, 
-	0xd8, 0xd8, 0xd9, 0xda, 0xdb, 0xdd, 0xdd, 0xde, 
-	0xdf, 0xe0, 0xe0, 0xe1, 0xe2, 0xe3, 0xe3, 0xe4, 
-	0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 
-	0xe8, 0xe8, 0xe9, 0xe9, 0xea, 0xe8, 0xe3, 0xdf, 
-	0xdd, 0xdd, 0xde, 0xdf, 0xec, 0x29, 0x3b, 0x43, 
-	0x44, 0x44, 0x41, 0x3d, 0x3b, 0x38, 0x37, 0x35, 
-	0x34, 0x34, 0x33, 0x32, 0x30, 0x2f, 0x2e, 0x2d, 
-	0x2c, 0x2b, 0x2a, 0x29, 0x29, 0x28, 0x27, 0x26, 
-	0x25, 0x24, 0x24, 0x23, 0x2a, 0x3b, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x40, 0x3f, 
-	0x3e, 0x3d, 0x3b, 0x3a, 0x39, 0x38, 0x37, 0x35, 
-	0x34, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2d, 0x2d, 
-	0x2c, 0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26, 
-	0x25, 0x24, 0x24, 0x23, 0x22, 0x21, 0x21, 0x20, 
-	0x1f, 0x1e, 0x1c, 0x1b, 0x1a, 0x19, 0x19, 0x19, 
-	0x18, 0x16, 0x15, 0x13, 0x13, 0x12, 0x13, 0x14, 
-	0x15, 0x15, 0x15, 0x14, 0x14, 0x13, 0x12, 0x12, 
-	0x12, 0x11, 0x0d, 0xf2, 0xea, 0xe7, 0xe6, 0xe6, 
-	0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 
-	0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xee, 
-	0xf0, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-	0xf3, 0xf3, 0xee, 0xe7, 0xe3, 0xe1, 0xe1, 0xe1, 
-	0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe6, 0xe7, 0xe7, 
-	0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0xd9, 0xcb, 
-	0xc3, 0xc0, 0xbf, 0xc1, 0xc3, 0xc6, 0xc8, 0xc9, 
-	0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 
-	0xd2, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 
-	0xda, 0xdb, 0xdb, 0xdc, 0xdd, 0xdd, 0xd1, 0xc5, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xbf, 0xc1, 
-	0xc2, 0xc3, 0xc4, 0xc4, 0xc5, 0xc6, 0xc7, 0xc9, 
-	0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 
-	0xd3, 0xdf, 0x20, 0x34, 0x3c, 0x3f, 0x3e, 0x3b, 
-	0x36, 0x32, 0x2e, 0x2c, 0x2b, 0x2a, 0x2a, 0x2a, 
-	0x29, 0x28, 0x27, 0x25, 0x24, 0x23, 0x23, 0x22, 
-	0x21, 0x21, 0x20, 0x1f, 0x1f, 0x1e, 0x1d, 0x1c, 
-	0x1b, 0x28, 0x39, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x43, 0x41, 0x3e, 0x3b, 0x38, 0x36, 0x35, 
-	0x34, 0x33, 0x33, 0x32, 0x31, 0x30, 0x2f, 0x2f, 
-	0x2e, 0x2d, 0x2c, 0x2b, 0x2b, 0x2a, 0x29, 0x27, 
-	0x26, 0x25, 0x24, 0x23, 0x23, 0x22, 0x22, 0x21, 
-	0x1e, 0xec, 0xd9, 0xd9, 0xe0, 0xeb, 0x09, 0x13, 
-	0x16, 0x16, 0x15, 0x14, 0x13, 0x12, 0x13, 0x13, 
-	0x14, 0x14, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 
-	0x10, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x0e, 
-	0xff, 0xdd, 0xd1, 0xd4, 0xdd, 0xec, 0x10, 0x17, 
-	0x19, 0x19, 0x17, 0x16, 0x14, 0x13, 0x07, 0xdc, 
-	0xce, 0xc6, 0xc3, 0xc3, 0xc4, 0xc6, 0xc8, 0xca, 
-	0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd1, 
-	0xd2, 0xd3, 0xd4, 0xd5, 0xd5, 0xd6, 0xd7, 0xd8, 
-	0xd8, 0xd9, 0xda, 0xdb, 0xdb, 0xdc, 0xd9, 0xcd, 
-	0xc3, 0xbd, 0xbb, 0xbb, 0xbc, 0xbe, 0xc0, 0xc2, 
-	0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 
-	0xcc, 0xce, 0xcf, 0xd0, 0xd0, 0xd1, 0xd2, 0xd3, 
-	0xd4, 0xd4, 0xd5, 0xd6, 0xd7, 0xd7, 0xd8, 0xd9, 
-	0xda, 0xda, 0xdb, 0xdb, 0xdc, 0xdd, 0xdd, 0xde, 
-	0xde, 0xdf, 0xe0, 0xe0, 0xde, 0xdb, 0xd9, 0xd9, 
-	0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xde, 0xdf, 
-	0xdf, 0xe0, 0xe0, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 
-	0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 
-	0xe7, 0xe8, 0xe8, 0xe8, 0xe4, 0xdf, 0xdc, 0xdb, 
-	0xdb, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe0, 
-	0xe1, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe4, 
-	0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 
-	0xe8, 0xe8, 0xe9, 0xe9, 0xe8, 0xe8, 0xe8, 0xe8, 
-	0xe8, 0xe8, 0xe9, 0xe9, 0xea, 0xea, 0xeb, 0xeb, 
-	0xeb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 
-	0xed, 0xee, 0xee, 0x0e, 0x2a, 0x39, 0x42, 0x44, 
-	0x44, 0x44, 0x44, 0x42, 0x40, 0x3e, 0x3d, 0x3c, 
-	0x3b, 0x3a, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34, 
-	0x33, 0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2e, 
-	0x2d, 0x2c, 0x2b, 0x2f, 0x3c, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x43, 0x42, 0x41, 0x40, 0x3f, 0x3e, 0x3d, 0x3c, 
-	0x3b, 0x3a, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34, 
-	0x33, 0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2e, 
-	0x2d, 0x2c, 0x2b, 0x2a, 0x2a, 0x29, 0x28, 0x28, 
-	0x27, 0x26, 0x26, 0x25, 0x24, 0x24, 0x23, 0x23, 
-	0x22, 0x21, 0x21, 0x20, 0x20, 0x1f, 0x1e, 0x1d, 
-	0x1c, 0x1b, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x18, 
-	0x18, 0x17, 0x17, 0x16, 0x16, 0x16, 0x15, 0x15, 
-	0x15, 0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x12, 
-	0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0f, 0x0e, 
-	0x0c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-	0x09, 0x09, 0x09, 0x09, 0x07, 0xf3, 0xeb, 0xe7, 
-	0xe4, 0xe3, 0xe4, 0xe4, 0xe5, 0xe6, 0xe6, 0xe7, 
-	0xe7, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0xea, 
-	0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 
-	0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xe4, 0xe1, 
-	0xe0, 0xdf, 0xdf, 0xe0, 0xe2, 0xe3, 0xe4, 0xe5, 
-	0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe8, 0xe8, 
-	0xe8, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xea, 
-	0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xed, 0xed, 
-	0xed, 0xed, 0xee, 0xef, 0xf0, 0xf2, 0xf3, 0xf4, 
-	0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-	0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 
-	0xeb, 0xd9, 0xcd, 0xc6, 0xc3, 0xc1, 0xc2, 0xc3, 
-	0xc4, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 
-	0xcc, 0xcd, 0xce, 0xd6, 0xe9, 0x1b, 0x26, 0x2b, 
-	0x2c, 0x2c, 0x2b, 0x29, 0x28, 0x27, 0x26, 0x25, 
-	0x20, 0xf4, 0xdb, 0xd1, 0xcc, 0xca, 0xca, 0xcb, 
-	0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd3, 
-	0xd4, 0xd5, 0xd6, 0xe0, 0x13, 0x26, 0x2e, 0x31, 
-	0x32, 0x32, 0x30, 0x2f, 0x2e, 0x2d, 0x2c, 0x2b, 
-	0x2a, 0x2a, 0x29, 0x28, 0x28, 0x27, 0x26, 0x26, 
-	0x25, 0x25, 0x24, 0x24, 0x23, 0x22, 0x22, 0x21, 
-	0x21, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1e, 0x1e, 
-	0x1b, 0xef, 0xda, 0xcf, 0xca, 0xc7, 0xc7, 0xc7, 
-	0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 
-	0xd0, 0xd1, 0xd2, 0xd2, 0xd3, 0xd4, 0xd4, 0xd5, 
-	0xd5, 0xd6, 0xd7, 0xd7, 0xd8, 0xd8, 0xd9, 0xd9, 
-	0xd8, 0xcf, 0xc6, 0xc0, 0xbc, 0xbb, 0xbb, 0xbb, 
-	0xbd, 0xbe, 0xbf, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 
-	0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xca, 0xcb, 0xcc, 
-	0xcd, 0xcd, 0xce, 0xcf, 0xcf, 0xd0, 0xd0, 0xcf, 
-	0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xcf, 0xd0, 
-	0xd0, 0xd1, 0xd2, 0xd2, 0xd3, 0xd3, 0xd4, 0xd4, 
-	0xd5, 0xd6, 0xd7, 0xd7, 0xd8, 0xd8, 0xd9, 0xd9, 
-	0xda, 0xda, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xd9, 
-	0xd7, 0xd6, 0xd6, 0xde, 0x17, 0x2c, 0x36, 0x3b, 
-	0x3e, 0x3e, 0x3d, 0x3c, 0x3a, 0x39, 0x37, 0x36, 
-	0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x31, 0x30, 
-	0x2f, 0x2f, 0x2e, 0x2d, 0x2d, 0x2c, 0x2b, 0x2b, 
-	0x2a, 0x2a, 0x29, 0x30, 0x3b, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3f, 0x3e, 
-	0x3d, 0x3c, 0x3b, 0x3b, 0x3a, 0x39, 0x38, 0x38, 
-	0x37, 0x37, 0x36, 0x35, 0x35, 0x34, 0x33, 0x33, 
-	0x32, 0x31, 0x30, 0x30, 0x2f, 0x2e, 0x2d, 0x2c, 
-	0x2b, 0x2a, 0x2a, 0x29, 0x29, 0x28, 0x27, 0x26, 
-	0x25, 0x25, 0x24, 0x23, 0x23, 0x23, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x20, 0x1d, 0x18, 0x14, 
-	0x11, 0x0f, 0x0d, 0x0d, 0x0b, 0x0a, 0x08, 0x07, 
-	0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
-	0x07, 0x0a, 0x0b, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 
-	0x0d, 0x0c, 0x0c, 0x0b, 0x03, 0xf0, 0xeb, 0xe7, 
-	0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 
-	0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe9, 0xe7, 0xda, 
-	0xcf, 0xc8, 0xc4, 0xc1, 0xc1, 0xc1, 0xc2, 0xc3, 
-	0xc4, 0xc5, 0xc6, 0xc7, 0xc7, 0xc8, 0xc9, 0xca, 
-	0xca, 0xcb, 0xcc, 0xcc, 0xcd, 0xcd, 0xce, 0xcf, 
-	0xd0, 0xd1, 0xd2, 0xd2, 0xd3, 0xd4, 0xd3, 0xcc, 
-	0xc4, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xbd, 0xbe, 
-	0xbf, 0xbf, 0xc0, 0xc1, 0xc2, 0xc2, 0xc3, 0xc4, 
-	0xc5, 0xc6, 0xc8, 0xd3, 0xe8, 0x1e, 0x2a, 0x30, 
-	0x32, 0x31, 0x2f, 0x2d, 0x2a, 0x29, 0x27, 0x26, 
-	0x26, 0x25, 0x24, 0x24, 0x23, 0x22, 0x21, 0x21, 
-	0x20, 0x20, 0x1f, 0x1f, 0x1e, 0x1e, 0x1d, 0x1d, 
-	0x1d, 0x1c, 0x1d, 0x2b, 0x37, 0x40, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3f, 
-	0x3e, 0x3c, 0x3b, 0x3a, 0x3a, 0x39, 0x38, 0x38, 
-	0x37, 0x37, 0x36, 0x36, 0x35, 0x34, 0x34, 0x33, 
-	0x32, 0x31, 0x30, 0x30, 0x2f, 0x2e, 0x2d, 0x2d, 
-	0x2c, 0x2c, 0x2b, 0x2b, 0x23, 0x05, 0xdd, 0xd2, 
-	0xcc, 0xca, 0xc9, 0xca, 0xd3, 0xe1, 0x09, 0x1c, 
-	0x23, 0x26, 0x27, 0x28, 0x27, 0x26, 0x25, 0x24, 
-	0x24, 0x23, 0x22, 0x22, 0x22, 0x21, 0x21, 0x20, 
-	0x20, 0x20, 0x1f, 0x1f, 0x12, 0xe4, 0xd7, 0xcf, 
-	0xcb, 0xc9, 0xc8, 0xcb, 0xd3, 0xe1, 0x09, 0x1c, 
-	0x22, 0x25, 0x26, 0x26, 0x25, 0x24, 0x19, 0xe9, 
-	0xda, 0xd2, 0xcd, 0xcb, 0xca, 0xca, 0xcb, 0xcc, 
-	0xcd, 0xcd, 0xce, 0xcf, 0xd0, 0xd0, 0xd1, 0xd1, 
-	0xd2, 0xd2, 0xd3, 0xd3, 0xd4, 0xd4, 0xd5, 0xd5, 
-	0xd6, 0xd6, 0xd7, 0xd7, 0xd8, 0xd8, 0xd1, 0xc9, 
-	0xc3, 0xbe, 0xbc, 0xbb, 0xbb, 0xbb, 0xbc, 0xbd, 
-	0xbe, 0xbf, 0xc0, 0xc0, 0xc1, 0xc2, 0xc3, 0xc3, 
-	0xc4, 0xc5, 0xc5, 0xc6, 0xc7, 0xc7, 0xc8, 0xc9, 
-	0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xcd, 0xce, 0xcf, 
-	0xcf, 0xd0, 0xd1, 0xd1, 0xd2, 0xd2, 0xd3, 0xd3, 
-	0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd7, 
-	0xd7, 0xd8, 0xd8, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 
-	0xdb, 0xdb, 0xdc, 0xdd, 0xde, 0xde, 0xdd, 0xdb, 
-	0xd9, 0xd8, 0xd8, 0xd7, 0xd8, 0xd8, 0xd8, 0xd9, 
-	0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 
-	0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 
-	0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xdf, 0xdd, 
-	0xdb, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 
-	0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 
-	0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xdf, 0xdf, 
-	0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 
-	0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 
-	0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 
-	0xe5, 0xe5, 0xe5, 0xea, 0x1a, 0x2b, 0x36, 0x3c, 
-	0x40, 0x42, 0x43, 0x43, 0x42, 0x41, 0x41, 0x40, 
-	0x3f, 0x3e, 0x3d, 0x3d, 0x3c, 0x3b, 0x3b, 0x3a, 
-	0x39, 0x39, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 
-	0x34, 0x34, 0x33, 0x35, 0x3c, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x42, 0x41, 
-	0x41, 0x40, 0x3f, 0x3e, 0x3e, 0x3d, 0x3c, 0x3c, 
-	0x3b, 0x3b, 0x3a, 0x39, 0x39, 0x38, 0x37, 0x37, 
-	0x36, 0x35, 0x35, 0x34, 0x34, 0x33, 0x33, 0x32, 
-	0x32, 0x31, 0x31, 0x30, 0x2f, 0x2f, 0x2e, 0x2e, 
-	0x2d, 0x2d, 0x2c, 0x2c, 0x2b, 0x2a, 0x2a, 0x29, 
-	0x28, 0x28, 0x27, 0x27, 0x26, 0x26, 0x26, 0x25, 
-	0x25, 0x24, 0x24, 0x24, 0x23, 0x23, 0x22, 0x22, 
-	0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x1f, 
-	0x1f, 0x1f, 0x1e, 0x1e, 0x1d, 0x1c, 0x1c, 0x1b, 
-	0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x18, 0x17, 
-	0x12, 0x0d, 0xfb, 0xf3, 0xf0, 0xef, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-	0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 
-	0xea, 0xe7, 0xe5, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 
-	0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 
-	0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 
-	0xe9, 0xea, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xee, 
-	0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 
-	0xf0, 0xec, 0xdf, 0xd5, 0xcd, 0xc8, 0xc5, 0xc3, 
-	0xc2, 0xc2, 0xc2, 0xc3, 0xc7, 0xce, 0xd7, 0xe1, 
-	0xee, 0x0d, 0x15, 0x19, 0x1a, 0x1b, 0x1b, 0x1b, 
-	0x1a, 0x1a, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 
-	0x18, 0x14, 0xec, 0xdd, 0xd3, 0xce, 0xca, 0xc8, 
-	0xc7, 0xc6, 0xc6, 0xc7, 0xcb, 0xd3, 0xde, 0xec, 
-	0x11, 0x1a, 0x1e, 0x21, 0x22, 0x22, 0x22, 0x21, 
-	0x21, 0x21, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1e, 
-	0x1e, 0x1e, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 
-	0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 
-	0x19, 0x19, 0x19, 0x19, 0x14, 0xec, 0xdd, 0xd4, 
-	0xce, 0xcb, 0xc9, 0xc7, 0xc7, 0xc7, 0xc7, 0xc8, 
-	0xc8, 0xc9, 0xc9, 0xca, 0xca, 0xcb, 0xcb, 0xcc, 
-	0xcc, 0xcd, 0xcd, 0xce, 0xce, 0xcf, 0xcf, 0xd0, 
-	0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xca, 0xc4, 0xc0, 
-	0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbc, 0xbd, 0xbd, 0xbe, 0xbf, 0xbf, 
-	0xc0, 0xc1, 0xc1, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 
-	0xc2, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc3, 0xc3, 
-	0xc4, 0xc4, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc7, 
-	0xc7, 0xc8, 0xc9, 0xc9, 0xca, 0xca, 0xcb, 0xcb, 
-	0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xcc, 
-	0xcc, 0xd3, 0xe0, 0x0b, 0x20, 0x28, 0x2d, 0x30, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x30, 0x30, 
-	0x2f, 0x2f, 0x2e, 0x2e, 0x2d, 0x2d, 0x2c, 0x2c, 
-	0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x29, 0x29, 0x29, 
-	0x2a, 0x31, 0x3a, 0x41, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 
-	0x43, 0x42, 0x41, 0x41, 0x40, 0x40, 0x3f, 0x3f, 
-	0x3e, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3b, 0x3b, 
-	0x3a, 0x39, 0x39, 0x38, 0x38, 0x37, 0x36, 0x36, 
-	0x35, 0x35, 0x34, 0x33, 0x33, 0x32, 0x32, 0x31, 
-	0x31, 0x30, 0x30, 0x2f, 0x2f, 0x2e, 0x2c, 0x2a, 
-	0x28, 0x27, 0x26, 0x25, 0x25, 0x24, 0x24, 0x23, 
-	0x22, 0x22, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f, 
-	0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1c, 0x19, 0x15, 
-	0x12, 0x0f, 0x0c, 0x09, 0x06, 0x04, 0xfd, 0xfc, 
-	0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfb, 0xf1, 0xe2, 
-	0xd8, 0xd1, 0xcc, 0xc9, 0xc7, 0xc6, 0xc5, 0xc5, 
-	0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 
-	0xc8, 0xc8, 0xc9, 0xc9, 0xca, 0xca, 0xcb, 0xcb, 
-	0xcc, 0xcc, 0xcd, 0xce, 0xce, 0xcf, 0xcd, 0xc9, 
-	0xc3, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbc, 0xbc, 0xbd, 0xbe, 0xc2, 0xc9, 0xd3, 0xde, 
-	0xee, 0x11, 0x18, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 
-	0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1a, 0x19, 0x19, 
-	0x18, 0x18, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 
-	0x15, 0x15, 0x15, 0x14, 0x1d, 0x29, 0x33, 0x3a, 
-	0x3f, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x42, 0x41, 0x40, 0x3f, 0x3e, 0x3e, 0x3d, 
-	0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0x3a, 0x3a, 0x39, 
-	0x39, 0x39, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 
-	0x34, 0x34, 0x34, 0x33, 0x33, 0x32, 0x31, 0x30, 
-	0x2a, 0x1f, 0x0c, 0xe6, 0xdc, 0xd7, 0xd4, 0xd2, 
-	0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd8, 0xe2, 0xf5, 
-	0x18, 0x20, 0x24, 0x27, 0x29, 0x2a, 0x2b, 0x2b, 
-	0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 
-	0x23, 0x18, 0xf0, 0xe2, 0xdb, 0xd6, 0xd3, 0xd1, 
-	0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd8, 0xe1, 0xf2, 
-	0x16, 0x1e, 0x23, 0x26, 0x28, 0x29, 0x2a, 0x2a, 
-	0x25, 0x1c, 0x05, 0xe6, 0xde, 0xd9, 0xd5, 0xd3, 
-	0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 
-	0xd2, 0xd2, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 
-	0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd7, 0xd7, 
-	0xd2, 0xcd, 0xc7, 0xc3, 0xc0, 0xbe, 0xbd, 0xbc, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xbc, 0xbd, 0xbd, 
-	0xbe, 0xbe, 0xbf, 0xbf, 0xc0, 0xc0, 0xc0, 0xc1, 
-	0xc1, 0xc2, 0xc2, 0xc3, 0xc3, 0xc4, 0xc4, 0xc5, 
-	0xc5, 0xc5, 0xc6, 0xc6, 0xc7, 0xc7, 0xc8, 0xc8, 
-	0xc8, 0xc9, 0xc9, 0xca, 0xca, 0xcb, 0xcc, 0xcc, 
-	0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xcf, 0xcf, 0xcf, 
-	0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 
-	0xd2, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd5, 
-	0xd5, 0xd5, 0xd6, 0xd6, 0xd7, 0xd7, 0xd8, 0xd8, 
-	0xd9, 0xd9, 0xd8, 0xd7, 0xd6, 0xd5, 0xd4, 0xd4, 
-	0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 
-	0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd7, 0xd7, 0xd7, 
-	0xd7, 0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xda, 0xd9, 0xd8, 0xd7, 0xd6, 0xd5, 0xd4, 0xd3, 
-	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 
-	0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 
-	0xd6, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 0xd8, 0xd8, 
-	0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xda, 0xdb, 0xdd, 0xdf, 0xe1, 0xe3, 0xe4, 0xe5, 
-	0xe6, 0xe7, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0xe9, 
-	0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 
-	0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec, 
-	0xed, 0xef, 0xf5, 0x07, 0x0e, 0x11, 0x13, 0x14, 
-	0x15, 0x16, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 
-	0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 
-	0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 
-	0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 
-	0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 
-	0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 
-	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 
-	0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 
-	0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 
-	0x13, 0x12, 0x0f, 0x0b, 0xfb, 0xf4, 0xf0, 0xee, 
-	0xed, 0xec, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 
-	0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 
-	0xea, 0xe9, 0xe7, 0xe5, 0xe3, 0xe1, 0xe0, 0xdf, 
-	0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 
-	0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 
-	0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-	0xe0, 0xe2, 0xf3, 0x1b, 0x27, 0x2e, 0x34, 0x37, 
-	0x3a, 0x3c, 0x3d, 0x3e, 0x3e, 0x3f, 0x3f, 0x3f, 
-	0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3d, 0x3d, 0x3d, 
-	0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3a, 0x3a, 0x3a, 
-	0x39, 0x3a, 0x3f, 0x43, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 
-	0x41, 0x40, 0x40, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 
-	0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 
-	0x3a, 0x3a, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 
-	0x36, 0x36, 0x36, 0x35, 0x35, 0x35, 0x34, 0x34, 
-	0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x31, 
-	0x31, 0x31, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 
-	0x2e, 0x2d, 0x2c, 0x2a, 0x29, 0x27, 0x26, 0x25, 
-	0x24, 0x23, 0x23, 0x22, 0x22, 0x21, 0x21, 0x21, 
-	0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-	0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 
-	0x1e, 0x1d, 0x1b, 0x19, 0x17, 0x15, 0x13, 0x11, 
-	0x10, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 
-	0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 
-	0x05, 0x05, 0x06, 0x07, 0x08, 0x0a, 0x07, 0xec, 
-	0xe2, 0xda, 0xd4, 0xd0, 0xcd, 0xcb, 0xc9, 0xc8, 
-	0xc7, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 
-	0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc8, 
-	0xc8, 0xc8, 0xc9, 0xc9, 0xca, 0xca, 0xca, 0xc7, 
-	0xc4, 0xc0, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xc5, 0xca, 
-	0xd0, 0xd6, 0xdb, 0xdf, 0xe3, 0xe5, 0xe7, 0xe9, 
-	0xea, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 
-	0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 
-	0xec, 0xec, 0xec, 0xee, 0x11, 0x20, 0x29, 0x30, 
-	0x35, 0x39, 0x3c, 0x3e, 0x3f, 0x40, 0x41, 0x42, 
-	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 
-	0x41, 0x41, 0x40, 0x40, 0x40, 0x3f, 0x3f, 0x3e, 
-	0x3e, 0x3e, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x3b, 
-	0x3b, 0x3b, 0x3a, 0x3a, 0x39, 0x38, 0x37, 0x36, 
-	0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x31, 0x30, 
-	0x30, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 
-	0x2b, 0x2b, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x25, 
-	0x24, 0x23, 0x22, 0x21, 0x20, 0x20, 0x1f, 0x1c, 
-	0x12, 0xee, 0xe3, 0xdc, 0xd7, 0xd4, 0xd1, 0xcf, 
-	0xce, 0xcd, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 
-	0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcc, 0xcc, 
-	0xcc, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xcd, 
-	0xc9, 0xc5, 0xc1, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xc0, 
-	0xc5, 0xca, 0xcf, 0xd3, 0xd7, 0xdb, 0xde, 0xe1, 
-	0xe4, 0xe6, 0xe9, 0xea, 0xec, 0xed, 0xee, 0xef, 
-	0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-	0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xf3, 0x13, 0x20, 
-	0x28, 0x2f, 0x34, 0x38, 0x3a, 0x3d, 0x3e, 0x3f, 
-	0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 
-	0x3e, 0x3e, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
-	0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3a, 0x3a, 0x3a, 
-	0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x35, 
-	0x34, 0x33, 0x32, 0x31, 0x30, 0x30, 0x2f, 0x2e, 
-	0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 
-	0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 
-	0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x29, 
-	0x29, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27, 
-	0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 
-	0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 
-	0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 
-	0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x1f, 0x1e, 0x18, 0x0a, 0xea, 0xe2, 0xdc, 0xd8, 
-	0xd5, 0xd2, 0xd1, 0xcf, 0xce, 0xcd, 0xcc, 0xcc, 
-	0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 
-	0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-	0xcd, 0xcc, 0xca, 0xc6, 0xc3, 0xc0, 0xbe, 0xbc, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 
-	0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xbc, 0xbc, 
-	0xbd, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xbf, 0xbf, 
-	0xc0, 0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 
-	0xc2, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xc4, 
-	0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xc7, 
-	0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xc5, 0xc5, 0xc5, 
-	0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 
-	0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 
-	0xc8, 0xc8, 0xc9, 0xca, 0xcb, 0xcb, 0xcc, 0xcd, 
-	0xce, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 
-	0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 
-	0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 
-	0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 
-	0xd4, 0xd5, 0xd6, 0xd6, 0xd7, 0xd7, 0xd7, 0xd8, 
-	0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 
-	0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 
-	0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 
-	0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 
-	0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-	0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-	0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-	0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 
-	0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-	0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-	0xe7, 0xe7, 0xe7, 0xe8, 0xe7, 0xe6, 0xe4, 0xe3, 
-	0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 
-	0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 
-	0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 
-	0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdd, 0xdc, 0xdb, 
-	0xdb, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 
-	0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 
-	0xd8, 0xd8, 0xdc, 0xe5, 0xf4, 0x16, 0x1f, 0x25, 
-	0x2a, 0x2d, 0x30, 0x32, 0x34, 0x35, 0x36, 0x37, 
-	0x38, 0x38, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x3a, 
-	0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 
-	0x39, 0x39, 0x3c, 0x3f, 0x43, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-	0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 
-	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 
-	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x42, 
-	0x42, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 
-	0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 
-	0x3d, 0x3d, 0x3d, 0x3c, 0x3b, 0x3a, 0x39, 0x39, 
-	0x38, 0x37, 0x37, 0x36, 0x35, 0x35, 0x34, 0x34, 
-	0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x31, 
-	0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 
-	0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2d, 0x2c, 0x2b, 
-	0x2a, 0x2a, 0x29, 0x29, 0x28, 0x28, 0x27, 0x27, 
-	0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x23, 0x1f, 0x19, 0x10, 
-	0xf3, 0xe9, 0xe3, 0xdf, 0xdc, 0xda, 0xd8, 0xd6, 
-	0xd5, 0xd3, 0xd3, 0xd2, 0xd1, 0xd1, 0xd0, 0xd0, 
-	0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-	0xcf, 0xcf, 0xd0, 0xd0, 0xcf, 0xcd, 0xca, 0xc8, 
-	0xc5, 0xc2, 0xc0, 0xbe, 0xbd, 0xbd, 0xbd, 0xbd, 
-	0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 
-	0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 
-	0xbd, 0xbd, 0xbe, 0xc2, 0xc5, 0xc8, 0xcb, 0xce, 
-	0xd0, 0xd2, 0xd4, 0xd6, 0xd7, 0xd9, 0xda, 0xdb, 
-	0xdc, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 
-	0xe0, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 
-	0xea, 0x07, 0x18, 0x20, 0x26, 0x2a, 0x2e, 0x31, 
-	0x33, 0x35, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3b, 
-	0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
-	0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3a, 0x3a, 
-	0x39, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x35, 
-	0x35, 0x34, 0x34, 0x34, 0x33, 0x33, 0x32, 0x32, 
-	0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 
-	0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x2e, 0x2d, 
-	0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x29, 0x28, 0x28, 
-	0x27, 0x23, 0x1f, 0x18, 0x10, 0xf5, 0xeb, 0xe6, 
-	0xe2, 0xdf, 0xdd, 0xdb, 0xd9, 0xd8, 0xd7, 0xd6, 
-	0xd5, 0xd5, 0xd4, 0xd4, 0xd3, 0xd3, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd0, 0xcd, 0xca, 0xc8, 0xc5, 0xc3, 0xc1, 
-	0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-	0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-	0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-	0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xc2, 
-	0xc5, 0xc7, 0xca, 0xcc, 0xce, 0xd1, 0xd3, 0xd4, 
-	0xd6, 0xd8, 0xd9, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 
-	0xe0, 0xe1, 0xe2, 0xe3, 0xe3, 0xe4, 0xe4, 0xe5, 
-	0xe5, 0xe6, 0xe6, 0xe6, 0xeb, 0x06, 0x16, 0x1e, 
-	0x24, 0x28, 0x2c, 0x2f, 0x31, 0x33, 0x34, 0x35, 
-	0x36, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x39, 
-	0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 
-	0x39, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 
-	0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x36, 
-	0x35, 0x35, 0x34, 0x33, 0x33, 0x32, 0x31, 0x31, 
-	0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x2e, 0x2e, 
-	0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 
-	0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x29, 
-	0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 
-	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 
-	0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 
-	0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 
-	0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x1d, 0x18, 
-	0x11, 0xfa, 0xee, 0xe8, 0xe4, 0xe1, 0xdf, 0xdd, 
-	0xdb, 0xda, 0xd8, 0xd7, 0xd6, 0xd6, 0xd5, 0xd4, 
-	0xd4, 0xd3, 0xd3, 0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xce, 0xcc, 
-	0xca, 0xc8, 0xc6, 0xc5, 0xc4, 0xc2, 0xc1, 0xc1, 
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-	0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 
-	0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 
-	0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 
-	0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 
-	0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 
-	0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 
-	0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 
-	0xc2, 0xc2, 0xc3, 0xc4, 0xc6, 0xc8, 0xcb, 0xcd, 
-	0xd0, 0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xde, 
-	0xe0, 0xe2, 0xe4, 0xe6, 0xe5, 0xe2, 0xdf, 0xdc, 
-	0xd9, 0xd7, 0xd5, 0xd3, 0xd1, 0xd0, 0xcf, 0xce, 
-	0xcd, 0xcc, 0xcc, 0xcd, 0xcf, 0xd1, 0xd3, 0xd5, 
-	0xd8, 0xda, 0xdc, 0xde, 0xe1, 0xe3, 0xe5, 0xe7, 
-	0xe9, 0xeb, 0xed, 0xf0, 0xee, 0xea, 0xe6, 0xe3, 
-	0xe0, 0xdd, 0xdb, 0xd9, 0xd8, 0xd6, 0xd5, 0xd4, 
-	0xd3, 0xd3, 0xd2, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 
-	0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-	0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-	0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-	0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 
-	0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 
-	0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 
-	0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 
-	0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 
-	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 
-	0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 
-	0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 
-	0xd4, 0xd7, 0xdb, 0xde, 0xe3, 0xe7, 0xed, 0xf5, 
-	0x0c, 0x12, 0x16, 0x19, 0x1c, 0x1e, 0x1f, 0x21, 
-	0x22, 0x23, 0x24, 0x25, 0x26, 0x26, 0x27, 0x27, 
-	0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2b, 
-	0x2d, 0x30, 0x33, 0x35, 0x37, 0x39, 0x3b, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-	0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 
-	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 
-	0x3a, 0x39, 0x39, 0x39, 0x38, 0x38, 0x37, 0x37, 
-	0x37, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x35, 
-	0x35, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 
-	0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x31, 0x31, 
-	0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 
-	0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x28, 0x25, 
-	0x23, 0x20, 0x1e, 0x1b, 0x18, 0x14, 0x11, 0x0c, 
-	0x03, 0xf4, 0xf0, 0xed, 0xeb, 0xe9, 0xe8, 0xe7, 
-	0xe5, 0xe4, 0xe4, 0xe3, 0xe2, 0xe1, 0xe1, 0xe1, 
-	0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdc, 0xd9, 
-	0xd7, 0xd4, 0xd2, 0xd0, 0xcf, 0xcd, 0xcc, 0xcb, 
-	0xca, 0xc9, 0xc8, 0xc7, 0xc7, 0xc6, 0xc5, 0xc5, 
-	0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 
-	0xc5, 0xc5, 0xc7, 0xc9, 0xca, 0xcc, 0xce, 0xd0, 
-	0xd1, 0xd2, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 
-	0xda, 0xda, 0xdb, 0xdc, 0xdd, 0xdd, 0xde, 0xde, 
-	0xdf, 0xdf, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 
-	0xe5, 0xeb, 0xf3, 0x0d, 0x15, 0x1a, 0x1d, 0x21, 
-	0x23, 0x25, 0x27, 0x29, 0x2a, 0x2b, 0x2d, 0x2e, 
-	0x2e, 0x2f, 0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 
-	0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 
-	0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 
-	0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 
-	0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 
-	0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 
-	0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2c, 
-	0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 
-	0x27, 0x25, 0x23, 0x21, 0x1e, 0x1b, 0x18, 0x15, 
-	0x12, 0x0e, 0x09, 0xf8, 0xf2, 0xef, 0xed, 0xeb, 
-	0xe9, 0xe7, 0xe6, 0xe5, 0xe4, 0xe3, 0xe3, 0xe2, 
-	0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 
-	0xdd, 0xdb, 0xd9, 0xd7, 0xd5, 0xd3, 0xd2, 0xd0, 
-	0xcf, 0xce, 0xcc, 0xcb, 0xcb, 0xca, 0xc9, 0xc8, 
-	0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-	0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-	0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-	0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc9, 0xca, 
-	0xcb, 0xcd, 0xce, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 
-	0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 
-	0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xe1, 
-	0xe1, 0xe2, 0xe4, 0xe8, 0xee, 0xf8, 0x0f, 0x15, 
-	0x19, 0x1c, 0x1f, 0x21, 0x23, 0x25, 0x27, 0x28, 
-	0x29, 0x2a, 0x2a, 0x2b, 0x2c, 0x2c, 0x2d, 0x2d, 
-	0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x2f, 
-	0x2f, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 
-	0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 
-	0x2d, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 
-	0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x29, 
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 
-	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 
-	0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 
-	0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 
-	0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1f, 
-	0x1e, 0x1b, 0x19, 0x16, 0x13, 0x10, 0x0c, 0x05, 
-	0xf5, 0xf1, 0xee, 0xec, 0xea, 0xe9, 0xe7, 0xe6, 
-	0xe5, 0xe4, 0xe3, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 
-	0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xdd, 0xdc, 
-	0xda, 0xd8, 0xd7, 0xd5, 0xd4, 0xd3, 0xd2, 0xd1, 
-	0xd0, 0xcf, 0xce, 0xce, 0xcd, 0xcc, 0xcc, 0xcb, 
-	0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcc, 
-	0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 
-	0xd5, 0xd6, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xda, 
-	0xdb, 0xdc, 0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 
-	0xdf, 0xdf, 0xde, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 
-	0xdf, 0xdf, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 
-	0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 
-	0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 
-	0xe8, 0xe8, 0xe7, 0xe5, 0xe3, 0xe2, 0xe0, 0xdf, 
-	0xdd, 0xdc, 0xdb, 0xda, 0xd9, 0xd8, 0xd8, 0xd7, 
-	0xd6, 0xd6, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd3, 
-	0xd3, 0xd3, 0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 
-	0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 
-	0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd2, 0xd3, 0xd5, 
-	0xd6, 0xd8, 0xd9, 0xda, 0xdc, 0xdd, 0xdf, 0xe0, 
-	0xe1, 0xe3, 0xe4, 0xe5, 0xe7, 0xe8, 0xea, 0xeb, 
-	0xed, 0xee, 0xf0, 0xf2, 0xf4, 0xf6, 0xf9, 0x04, 
-	0x08, 0x0a, 0x0c, 0x0d, 0x11, 0x15, 0x19, 0x1c, 
-	0x1e, 0x20, 0x22, 0x24, 0x26, 0x27, 0x28, 0x29, 
-	0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x2f, 0x30, 
-	0x30, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-	0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 
-	0x2f, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 
-	0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 
-	0x2a, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x29, 
-	0x29, 0x28, 0x28, 0x28, 0x28, 0x27, 0x26, 0x25, 
-	0x24, 0x23, 0x22, 0x21, 0x1f, 0x1e, 0x1d, 0x1c, 
-	0x1b, 0x19, 0x18, 0x17, 0x16, 0x15, 0x13, 0x12, 
-	0x11, 0x0f, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0xfc, 
-	0xf9, 0xf7, 0xf5, 0xf4, 0xf3, 0xf0, 0xed, 0xea, 
-	0xe8, 0xe6, 0xe4, 0xe2, 0xe0, 0xdf, 0xde, 0xdc, 
-	0xdb, 0xda, 0xd9, 0xd9, 0xd8, 0xd7, 0xd6, 0xd6, 
-	0xd5, 0xd5, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd2, 
-	0xd3, 0xd4, 0xd5, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 
-	0xda, 0xda, 0xdb, 0xdb, 0xdc, 0xdd, 0xdd, 0xde, 
-	0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 
-	0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 
-	0xe6, 0xe9, 0xeb, 0xef, 0xf3, 0xfd, 0x0b, 0x0f, 
-	0x12, 0x15, 0x17, 0x19, 0x1a, 0x1c, 0x1d, 0x1e, 
-	0x1f, 0x20, 0x21, 0x21, 0x22, 0x23, 0x23, 0x24, 
-	0x24, 0x25, 0x25, 0x26, 0x26, 0x26, 0x27, 0x27, 
-	0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 
-	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 
-	0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x24, 
-	0x23, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 
-	0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x13, 0x12, 
-	0x11, 0x0f, 0x0e, 0x0c, 0x0b, 0x09, 0x06, 0xfd, 
-	0xf8, 0xf6, 0xf5, 0xf3, 0xf2, 0xf1, 0xf0, 0xef, 
-	0xec, 0xea, 0xe8, 0xe6, 0xe5, 0xe4, 0xe2, 0xe1, 
-	0xe0, 0xdf, 0xde, 0xdd, 0xdc, 0xdb, 0xda, 0xda, 
-	0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 0xd6, 0xd6, 0xd5, 
-	0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 
-	0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 
-	0xd3, 0xd4, 0xd5, 0xd5, 0xd6, 0xd7, 0xd7, 0xd8, 
-	0xd9, 0xd9, 0xda, 0xdb, 0xdb, 0xdc, 0xdc, 0xdd, 
-	0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xe1, 
-	0xe1, 0xe2, 0xe2, 0xe3, 0xe5, 0xe7, 0xe9, 0xec, 
-	0xee, 0xf2, 0xf7, 0x07, 0x0c, 0x0f, 0x12, 0x14, 
-	0x16, 0x17, 0x18, 0x1a, 0x1b, 0x1b, 0x1c, 0x1d, 
-	0x1d, 0x1e, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x21, 
-	0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x23, 0x23, 
-	0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 
-	0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 
-	0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 
-	0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 
-	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 
-	0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-	0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 
-	0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 
-	0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1d, 0x1d, 
-	0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 
-	0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 
-	0x14, 0x13, 0x12, 0x11, 0x0f, 0x0e, 0x0d, 0x0b, 
-	0x09, 0x07, 0x04, 0xfa, 0xf8, 0xf6, 0xf4, 0xf3, 
-	0xf2, 0xf1, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xed, 
-	0xec, 0xea, 0xe9, 0xe7, 0xe6, 0xe5, 0xe4, 0xe3, 
-	0xe2, 0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xdd, 
-	0xdd, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xda, 0xda, 
-	0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 
-	0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 
-	0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 
-	0xd8, 0xd8, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xdb, 
-	0xdb, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 
-	0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 
-	0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe3, 0xe4, 0xe5, 
-	0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 
-	0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xe9, 0xe8, 0xe7, 
-	0xe7, 0xe6, 0xe5, 0xe4, 0xe4, 0xe3, 0xe3, 0xe2, 
-	0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 
-	0xdf, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 
-	0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 
-	0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 
-	0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-	0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-	0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-	0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xdc, 0xdc, 
-	0xdd, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xe1, 
-	0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe4, 0xe4, 
-	0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe8, 
-	0xe8, 0xea, 0xeb, 0xed, 0xef, 0xf1, 0xf4, 0xf8, 
-	0x04, 0x09, 0x0c, 0x0e, 0x10, 0x11, 0x13, 0x14, 
-	0x15, 0x16, 0x17, 0x18, 0x18, 0x19, 0x1a, 0x1a, 
-	0x1b, 0x1b, 0x1c, 0x1c, 0x1d, 0x1d, 0x1e, 0x1e, 
-	0x1e, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x20, 
-	0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 
-	0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-	0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 
-	0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 
-	0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-	0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1d, 0x1d, 
-	0x1c, 0x1c, 0x1b, 0x1b, 0x1a, 0x1a, 0x19, 0x19, 
-	0x18, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x14, 
-	0x14, 0x13, 0x13, 0x12, 0x12, 0x11, 0x11, 0x10, 
-	0x10, 0x0f, 0x0f, 0x0e, 0x0d, 0x0c, 0x0a, 0x08, 
-	0x02, 0xf8, 0xf5, 0xf3, 0xf2, 0xf0, 0xef, 0xee, 
-	0xed, 0xec, 0xeb, 0xea, 0xe9, 0xe9, 0xe8, 0xe8, 
-	0xe7, 0xe7, 0xe6, 0xe6, 0xe5, 0xe5, 0xe4, 0xe4, 
-	0xe4, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 
-	0xe7, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 
-	0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 
-	0xec, 0xed, 0xee, 0xf0, 0xf1, 0xf2, 0xf4, 0xf6, 
-	0xf8, 0xfc, 0x05, 0x07, 0x09, 0x0b, 0x0c, 0x0d, 
-	0x0e, 0x0f, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13, 
-	0x13, 0x14, 0x14, 0x15, 0x15, 0x16, 0x16, 0x16, 
-	0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-	0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 
-	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 
-	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 
-	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 
-	0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 
-	0x14, 0x14, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11, 
-	0x11, 0x10, 0x10, 0x0f, 0x0f, 0x0e, 0x0e, 0x0d, 
-	0x0d, 0x0c, 0x0c, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 
-	0x06, 0xfd, 0xf9, 0xf7, 0xf5, 0xf4, 0xf2, 0xf1, 
-	0xf1, 0xf0, 0xef, 0xee, 0xee, 0xed, 0xec, 0xec, 
-	0xeb, 0xeb, 0xea, 0xea, 0xe9, 0xe9, 0xe8, 0xe8, 
-	0xe8, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 
-	0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 
-	0xe4, 0xe4, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 
-	0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-	0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-	0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 
-	0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 
-	0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 
-	0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 
-	0xea, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xee, 0xef, 
-	0xf0, 0xf1, 0xf2, 0xf4, 0xf5, 0xf6, 0xf8, 0xfa, 
-	0x02, 0x06, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0c, 
-	0x0d, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x10, 0x10, 
-	0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 
-	0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 
-	0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x17, 
-	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
-	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
-	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
-	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 
-	0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 
-	0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 
-	0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-	0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 
-	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 
-	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 
-	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 
-	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 
-	0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 
-	0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 
-	0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 
-	0x0a, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x06, 
-	0x05, 0x03, 0xfd, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6, 
-	0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 
-	0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 
-	0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 
-	0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 
-	0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 
-	0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 
-	0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 
-	0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 
-	0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-	0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 
-	0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 
-	0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-	0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-	0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 
-	0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 
-	0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-	0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-	0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 
-	0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 
-	0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfb, 
-	0xfc, 0xfc, 0xfe, 0x01, 0x02, 0x03, 0x04, 0x04, 
-	0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 
-	0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-	0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-	0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 
-	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 
-	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 
-	0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 
-	0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01
-};
-
-const SoundData wavSoundPlayerExplode =
-{
-	(const unsigned char*)_wavPlayerExplode,	//pointer to sound data
-    15647, 										//unsigned int length
-};
@@ -0,0 +1,307 @@
+/*////////////////////////////////////////////////////
+Bitmap Collision Mask Generator - host tool
+
+Adds a 1 bit collision mask to the 1bpp bitmap files
+used by the 12864 lcd games, so sprite collisions can
+test the pixels that are drawn instead of the image
+box, a whole row of the image at a time.
+
+Build:
+gcc -O2 bitmap_mask.c -o bitmap_mask
+
+Use:
+bitmap_mask ../F411_spaceInvaders/Bitmap/enemy1.c ...
+
+Run bitmap_pagemajor first, the mask pointer goes
+after the page major pointer in the ImageData.
+
+Each file is updated in place.  The row major array
+(MSB left, bytesPerLine bytes per row) is read from the
+file, converted and written back as a second array:
+
+_mk<name>[] - ySize words, one per row, bit 31 is the
+left pixel.  Images up to 32 pixels wide.
+
+and the ImageData gets a pointer to it (pMask).
+Files that already have a mask are regenerated.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MASK_BEGIN_TAG		"//collision mask - generated by bitmap_mask\n"
+#define MASK_END_TAG		"//end collision mask\n"
+#define MASK_FIELD_TAG		", //collision mask\n"
+#define PAGE_FIELD_TAG		", //page major data\n"
+
+#define MASK_MAX_WIDTH		32
+
+
+////////////////////////////////////////////
+//read a whole file, returns NULL on error
+static char* ReadFile(const char* path)
+{
+	FILE* fp = fopen(path, "rb");
+
+	if (!fp)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	char* buffer = malloc((size_t)length + 1);
+
+	if ((!buffer) || (fread(buffer, 1, (size_t)length, fp) != (size_t)length))
+	{
+		free(buffer);
+		fclose(fp);
+		return NULL;
+	}
+
+	buffer[length] = 0x00;
+	fclose(fp);
+	return buffer;
+}
+
+////////////////////////////////////////////
+//Remove a generated block from text, in place
+static void RemoveBlock(char* text, const char* begin, const char* end)
+{
+	char* start = strstr(text, begin);
+
+	if (!start)
+		return;
+
+	char* stop = strstr(start, end);
+
+	if (!stop)
+		return;
+
+	stop += strlen(end);
+
+	//and the blank lines after it
+	while (*stop == '\n')
+		stop++;
+
+	memmove(start, stop, strlen(stop) + 1);
+}
+
+////////////////////////////////////////////
+//Remove the whole line ending with tag, in place
+static void RemoveLine(char* text, const char* tag)
+{
+	char* field = strstr(text, tag);
+
+	if (!field)
+		return;
+
+	char* start = field;
+	while ((start > text) && (start[-1] != '\n'))
+		start--;
+
+	memmove(start, field + strlen(tag), strlen(field + strlen(tag)) + 1);
+}
+
+////////////////////////////////////////////
+//Parse the first brace initialized number array.
+//Stores the array name (after "_ac") in name.
+static uint8_t* ParseArray(const char* text, char* name, size_t nameSize, uint32_t* size)
+{
+	const char* p = strstr(text, "static const uint8_t _ac");
+
+	if (!p)
+		return NULL;
+
+	p += strlen("static const uint8_t _ac");
+
+	size_t n = 0;
+	while ((isalnum((unsigned char)p[n]) || (p[n] == '_')) && (n < nameSize - 1))
+	{
+		name[n] = p[n];
+		n++;
+	}
+	name[n] = 0x00;
+
+	p = strchr(p, '{');
+	if (!p)
+		return NULL;
+	p++;
+
+	uint8_t* out = NULL;
+	uint32_t count = 0;
+	uint32_t capacity = 0;
+
+	while ((*p) && (*p != '}'))
+	{
+		if (isdigit((unsigned char)*p))
+		{
+			char* end;
+			unsigned long value = strtoul(p, &end, 0);
+
+			if (count == capacity)
+			{
+				capacity = capacity ? capacity * 2 : 256;
+				out = realloc(out, capacity);
+			}
+
+			out[count++] = (uint8_t)value;
+			p = end;
+			continue;
+		}
+		p++;
+	}
+
+	*size = count;
+	return out;
+}
+
+////////////////////////////////////////////
+//Read "<value>, //<field>" from the ImageData initializer
+static int ParseField(const char* text, const char* field)
+{
+	char tag[32];
+	snprintf(tag, sizeof(tag), "//%s", field);
+
+	const char* p = strstr(text, tag);
+
+	if (!p)
+		return -1;
+
+	//back up to the start of the line
+	while ((p > text) && (p[-1] != '\n'))
+		p--;
+
+	return atoi(p);
+}
+
+
+static int ConvertFile(const char* path)
+{
+	char name[128];
+	uint32_t size = 0;
+	char* text = ReadFile(path);
+
+	if (!text)
+	{
+		fprintf(stderr, "can't read %s\n", path);
+		return -1;
+	}
+
+	//regenerate
+	RemoveBlock(text, MASK_BEGIN_TAG, MASK_END_TAG);
+	RemoveLine(text, MASK_FIELD_TAG);
+
+	uint8_t* data = ParseArray(text, name, sizeof(name), &size);
+	int xSize = ParseField(text, "xSize");
+	int ySize = ParseField(text, "ySize");
+	int bytesPerLine = ParseField(text, "bytesPerLine");
+
+	if ((!data) || (xSize <= 0) || (ySize <= 0) || (bytesPerLine <= 0) ||
+		((uint32_t)(bytesPerLine * ySize) > size))
+	{
+		fprintf(stderr, "%s: no 1bpp image found\n", path);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	if (xSize > MASK_MAX_WIDTH)
+	{
+		fprintf(stderr, "%s: %d pixels wide, max is %d\n", path, xSize, MASK_MAX_WIDTH);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	uint32_t* mask = calloc((size_t)ySize, sizeof(uint32_t));
+
+	for (int y = 0 ; y < ySize ; y++)
+	{
+		for (int x = 0 ; x < xSize ; x++)
+		{
+			uint32_t bit = (data[(y * bytesPerLine) + (x >> 3)] >> (7 - (x & 0x07))) & 0x01;
+			mask[y] |= bit << (31 - x);
+		}
+	}
+
+	//array goes before the ImageData, pointer after pPageData
+	char* image = strstr(text, "const ImageData ");
+	char* field = image ? strstr(image, PAGE_FIELD_TAG) : NULL;
+
+	if (!field)
+	{
+		fprintf(stderr, "%s: no page major data, run bitmap_pagemajor first\n", path);
+		free(mask);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	char* lineEnd = field + strlen(PAGE_FIELD_TAG);
+
+	FILE* fp = fopen(path, "wb");
+
+	if (!fp)
+	{
+		fprintf(stderr, "can't write %s\n", path);
+		free(mask);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	fwrite(text, 1, (size_t)(image - text), fp);
+
+	fprintf(fp, MASK_BEGIN_TAG);
+	fprintf(fp, "static const uint32_t _mk%s[] =\n{", name);
+
+	for (int i = 0 ; i < ySize ; i++)
+	{
+		if (i)
+			fprintf(fp, (i % 6) ? ", " : ",\n");
+		else
+			fprintf(fp, "\n");
+
+		fprintf(fp, "0x%08X", mask[i]);
+	}
+
+	fprintf(fp, "};\n");
+	fprintf(fp, MASK_END_TAG);
+	fprintf(fp, "\n\n");
+
+	fwrite(image, 1, (size_t)(lineEnd - image), fp);
+	fprintf(fp, "(uint32_t*)_mk%s" MASK_FIELD_TAG, name);
+	fputs(lineEnd, fp);
+	fclose(fp);
+
+	printf("%s: %dx%d mask\n", path, xSize, ySize);
+
+	free(mask);
+	free(data);
+	free(text);
+	return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+	int result = 0;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s bitmap.c [bitmap.c ...]\n", argv[0]);
+		return 1;
+	}
+
+	for (int i = 1 ; i < argc ; i++)
+	{
+		if (ConvertFile(argv[i]) < 0)
+			result = 1;
+	}
+
+	return result;
+}
@@ -0,0 +1,284 @@
+/*////////////////////////////////////////////////////
+Bitmap Page Major Converter - host tool
+
+Adds a page major copy of the image data to the 1bpp
+bitmap files used by the 12864 lcd games, so the lcd
+driver can blit sprites a column byte at a time
+instead of pixel by pixel.
+
+Build:
+gcc -O2 bitmap_pagemajor.c -o bitmap_pagemajor
+
+Use:
+bitmap_pagemajor ../F411_spaceInvaders/Bitmap/enemy1.c ...
+
+Each file is updated in place.  The row major array
+(MSB left, bytesPerLine bytes per row) is read from the
+file, converted and written back as a second array:
+
+_pg<name>[] - (ySize + 7) / 8 pages of xSize column
+bytes, LSB on top, same layout as the lcd frameBuffer.
+
+and the ImageData gets a pointer to it (pPageData).
+Files that already have page data are regenerated.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#define PAGE_BEGIN_TAG		"//page major - generated by bitmap_pagemajor\n"
+#define PAGE_END_TAG		"//end page major\n"
+#define PAGE_FIELD_TAG		", //page major data\n"
+
+
+////////////////////////////////////////////
+//read a whole file, returns NULL on error
+static char* ReadFile(const char* path)
+{
+	FILE* fp = fopen(path, "rb");
+
+	if (!fp)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	char* buffer = malloc((size_t)length + 1);
+
+	if ((!buffer) || (fread(buffer, 1, (size_t)length, fp) != (size_t)length))
+	{
+		free(buffer);
+		fclose(fp);
+		return NULL;
+	}
+
+	buffer[length] = 0x00;
+	fclose(fp);
+	return buffer;
+}
+
+////////////////////////////////////////////
+//Remove a generated block from text, in place
+static void RemoveBlock(char* text, const char* begin, const char* end)
+{
+	char* start = strstr(text, begin);
+
+	if (!start)
+		return;
+
+	char* stop = strstr(start, end);
+
+	if (!stop)
+		return;
+
+	stop += strlen(end);
+
+	//and the blank lines after it
+	while (*stop == '\n')
+		stop++;
+
+	memmove(start, stop, strlen(stop) + 1);
+}
+
+////////////////////////////////////////////
+//Parse the first brace initialized number array.
+//Stores the array name (after "_ac") in name.
+static uint8_t* ParseArray(const char* text, char* name, size_t nameSize, uint32_t* size)
+{
+	const char* p = strstr(text, "static const uint8_t _ac");
+
+	if (!p)
+		return NULL;
+
+	p += strlen("static const uint8_t _ac");
+
+	size_t n = 0;
+	while ((isalnum((unsigned char)p[n]) || (p[n] == '_')) && (n < nameSize - 1))
+	{
+		name[n] = p[n];
+		n++;
+	}
+	name[n] = 0x00;
+
+	p = strchr(p, '{');
+	if (!p)
+		return NULL;
+	p++;
+
+	uint8_t* out = NULL;
+	uint32_t count = 0;
+	uint32_t capacity = 0;
+
+	while ((*p) && (*p != '}'))
+	{
+		if (isdigit((unsigned char)*p))
+		{
+			char* end;
+			unsigned long value = strtoul(p, &end, 0);
+
+			if (count == capacity)
+			{
+				capacity = capacity ? capacity * 2 : 256;
+				out = realloc(out, capacity);
+			}
+
+			out[count++] = (uint8_t)value;
+			p = end;
+			continue;
+		}
+		p++;
+	}
+
+	*size = count;
+	return out;
+}
+
+////////////////////////////////////////////
+//Read "<value>, //<field>" from the ImageData initializer
+static int ParseField(const char* text, const char* field)
+{
+	char tag[32];
+	snprintf(tag, sizeof(tag), "//%s", field);
+
+	const char* p = strstr(text, tag);
+
+	if (!p)
+		return -1;
+
+	//back up to the start of the line
+	while ((p > text) && (p[-1] != '\n'))
+		p--;
+
+	return atoi(p);
+}
+
+
+static int ConvertFile(const char* path)
+{
+	char name[128];
+	uint32_t size = 0;
+	char* text = ReadFile(path);
+
+	if (!text)
+	{
+		fprintf(stderr, "can't read %s\n", path);
+		return -1;
+	}
+
+	//regenerate
+	RemoveBlock(text, PAGE_BEGIN_TAG, PAGE_END_TAG);
+	char* field = strstr(text, PAGE_FIELD_TAG);
+	if (field)
+	{
+		char* start = field;
+		while ((start > text) && (start[-1] != '\n'))
+			start--;
+		memmove(start, field + strlen(PAGE_FIELD_TAG), strlen(field + strlen(PAGE_FIELD_TAG)) + 1);
+	}
+
+	uint8_t* data = ParseArray(text, name, sizeof(name), &size);
+	int xSize = ParseField(text, "xSize");
+	int ySize = ParseField(text, "ySize");
+	int bytesPerLine = ParseField(text, "bytesPerLine");
+
+	if ((!data) || (xSize <= 0) || (ySize <= 0) || (bytesPerLine <= 0) ||
+		((uint32_t)(bytesPerLine * ySize) > size))
+	{
+		fprintf(stderr, "%s: no 1bpp image found\n", path);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	int numPages = (ySize + 7) / 8;
+	uint8_t* page = calloc((size_t)(numPages * xSize), 1);
+
+	for (int y = 0 ; y < ySize ; y++)
+	{
+		for (int x = 0 ; x < xSize ; x++)
+		{
+			uint8_t bit = (data[(y * bytesPerLine) + (x >> 3)] >> (7 - (x & 0x07))) & 0x01;
+			page[((y >> 3) * xSize) + x] |= (uint8_t)(bit << (y & 0x07));
+		}
+	}
+
+	//array goes before the ImageData, pointer after pImageData
+	char* image = strstr(text, "const ImageData ");
+	char* pointer = image ? strstr(image, "_ac") : NULL;
+	char* lineEnd = pointer ? strchr(pointer, '\n') : NULL;
+
+	if (!lineEnd)
+	{
+		fprintf(stderr, "%s: no ImageData found\n", path);
+		free(page);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	FILE* fp = fopen(path, "wb");
+
+	if (!fp)
+	{
+		fprintf(stderr, "can't write %s\n", path);
+		free(page);
+		free(data);
+		free(text);
+		return -1;
+	}
+
+	fwrite(text, 1, (size_t)(image - text), fp);
+
+	fprintf(fp, PAGE_BEGIN_TAG);
+	fprintf(fp, "static const uint8_t _pg%s[] =\n{", name);
+
+	for (int i = 0 ; i < numPages * xSize ; i++)
+	{
+		if (i)
+			fprintf(fp, (i % 10) ? ", " : ",\n");
+		else
+			fprintf(fp, "\n");
+
+		fprintf(fp, "0x%02X", page[i]);
+	}
+
+	fprintf(fp, "};\n");
+	fprintf(fp, PAGE_END_TAG);
+	fprintf(fp, "\n\n");
+
+	fwrite(image, 1, (size_t)(lineEnd + 1 - image), fp);
+	fprintf(fp, "(uint8_t*)_pg%s" PAGE_FIELD_TAG, name);
+	fputs(lineEnd + 1, fp);
+	fclose(fp);
+
+	printf("%s: %dx%d, %d pages\n", path, xSize, ySize, numPages);
+
+	free(page);
+	free(data);
+	free(text);
+	return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+	int result = 0;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s bitmap.c [bitmap.c ...]\n", argv[0]);
+		return 1;
+	}
+
+	for (int i = 1 ; i < argc ; i++)
+	{
+		if (ConvertFile(argv[i]) < 0)
+			result = 1;
+	}
+
+	return result;
+}
@@ -0,0 +1,284 @@
+/*////////////////////////////////////////////////////
+LCD Blit Test - host tool
+
+Runs the F411 asteroids 12864 lcd driver on the PC with
+the spi and gpio mocked.
+
+Checks LCD_BlitIcon against the same icon drawn with
+LCD_PutPixel, one pixel at a time, for random icons at
+random offsets:
+
+- clipped and wrapped, OR and opaque
+- offsets part way off every edge, including negative
+offsets passed as uint32_t
+- offsets far outside the lcd.  Add -fsanitize=address
+to the build to catch writes outside the frameBuffer.
+
+Then times the blit against the PutPixel path of
+LCD_DrawIcon (the same image with no page major data)
+for the asteroid and player images.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_asteroids/Display -I../F411_asteroids/Bitmap \
+-I../F411_asteroids/F411_asteroids/Inc \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+lcd_blit_test.c ../F411_asteroids/Display/lcd_12864_dfrobot.c \
+../F411_asteroids/Display/font_atlas.c ../F411_asteroids/Display/font_table.c \
+../F411_asteroids/Bitmap/imgAsteroidLG.c ../F411_asteroids/Bitmap/imgAsteroidMD.c \
+../F411_asteroids/Bitmap/imgAsteroidSM.c ../F411_asteroids/Bitmap/imgPlayer0.c \
+-o lcd_blit_test
+
+Use:
+lcd_blit_test
+
+Returns 0 if every blit matches.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "spi.h"
+#include "gpio.h"
+#include "lcd_12864_dfrobot.h"
+#include "bitmap.h"
+
+#define TEST_NUM_BLITS		200000
+#define TEST_MAX_WIDTH		32
+#define TEST_MAX_HEIGHT		32
+#define BENCH_NUM_DRAWS		2000000
+
+
+extern uint8_t frameBuffer[FRAME_BUFFER_SIZE];
+
+extern const ImageData bmimgAsteroidLGBmp;
+extern const ImageData bmimgAsteroidMDBmp;
+extern const ImageData bmimgAsteroidSMBmp;
+extern const ImageData bmimgPlayer0Bmp;
+
+
+////////////////////////////////////////////
+//Mocked peripherals - nothing is sent, the
+//tests only draw into the frameBuffer
+SPI_HandleTypeDef hspi1;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+	(void)GPIOx;
+	(void)GPIO_Init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+	(void)PinState;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	(void)Timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+	(void)hspi;
+	return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return 0;
+}
+
+
+////////////////////////////////////////////
+//Random icon - row major for the PutPixel
+//reference, page major for the blit
+static uint8_t mRowData[TEST_MAX_HEIGHT * (TEST_MAX_WIDTH / 8)];
+static uint8_t mPageData[((TEST_MAX_HEIGHT + 7) / 8) * TEST_MAX_WIDTH];
+
+static void MakeIcon(int sizeX, int sizeY)
+{
+	int bytesPerLine = sizeX / 8;
+
+	for (int i = 0 ; i < bytesPerLine * sizeY ; i++)
+		mRowData[i] = (uint8_t)rand();
+
+	memset(mPageData, 0x00, sizeof(mPageData));
+
+	for (int y = 0 ; y < sizeY ; y++)
+	{
+		for (int x = 0 ; x < sizeX ; x++)
+		{
+			if ((mRowData[(y * bytesPerLine) + (x >> 3)] >> (7 - (x & 0x07))) & 0x01)
+				mPageData[((y >> 3) * sizeX) + x] |= 1 << (y & 0x07);
+		}
+	}
+}
+
+////////////////////////////////////////////
+//Reference - every pixel with LCD_PutPixel,
+//coordinates worked out signed
+static void DrawReference(uint32_t offsetX, uint32_t offsetY, int sizeX, int sizeY, uint8_t opaque, uint8_t wrap)
+{
+	int bytesPerLine = sizeX / 8;
+
+	for (int y = 0 ; y < sizeY ; y++)
+	{
+		for (int x = 0 ; x < sizeX ; x++)
+		{
+			int64_t px, py;
+
+			if (wrap)
+			{
+				px = (uint32_t)(offsetX + x) % LCD_WIDTH;
+				py = (uint32_t)(offsetY + y) % LCD_HEIGHT;
+			}
+			else
+			{
+				px = (int64_t)(int32_t)offsetX + x;
+				py = (int64_t)(int32_t)offsetY + y;
+
+				if ((px < 0) || (px >= LCD_WIDTH) || (py < 0) || (py >= LCD_HEIGHT))
+					continue;
+			}
+
+			int bit = (mRowData[(y * bytesPerLine) + (x >> 3)] >> (7 - (x & 0x07))) & 0x01;
+
+			if (bit)
+				LCD_PutPixel((uint16_t)px, (uint16_t)py, 1, 0);
+			else if (opaque)
+				LCD_PutPixel((uint16_t)px, (uint16_t)py, 0, 0);
+		}
+	}
+}
+
+////////////////////////////////////////////
+//Offset near the lcd, part way off an edge,
+//or anywhere in 32 bits
+static uint32_t RandomOffset(int size)
+{
+	switch (rand() % 8)
+	{
+		case 0:		return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+		case 1:		return (uint32_t)(-(rand() % 64));
+		default:	return (uint32_t)((rand() % (size + 96)) - 48);
+	}
+}
+
+
+static int TestBlit(void)
+{
+	static uint8_t background[FRAME_BUFFER_SIZE];
+	static uint8_t reference[FRAME_BUFFER_SIZE];
+	const int widths[] = {8, 16, 24, 32};
+	const int heights[] = {1, 5, 8, 10, 16, 24, 32};
+	long failures = 0;
+
+	for (long t = 0 ; t < TEST_NUM_BLITS ; t++)
+	{
+		int sizeX = widths[rand() % 4];
+		int sizeY = heights[rand() % 7];
+		uint8_t opaque = rand() & 0x01;
+		uint8_t wrap = rand() & 0x01;
+		uint32_t offsetX = RandomOffset(LCD_WIDTH);
+		uint32_t offsetY = RandomOffset(LCD_HEIGHT);
+
+		MakeIcon(sizeX, sizeY);
+		const ImageData image = {(uint8_t)sizeX, (uint8_t)sizeY, (uint8_t)(sizeX / 8), 1, mRowData, mPageData, NULL};
+
+		for (int i = 0 ; i < FRAME_BUFFER_SIZE ; i++)
+			background[i] = (uint8_t)rand();
+
+		memcpy(frameBuffer, background, FRAME_BUFFER_SIZE);
+		DrawReference(offsetX, offsetY, sizeX, sizeY, opaque, wrap);
+		memcpy(reference, frameBuffer, FRAME_BUFFER_SIZE);
+
+		memcpy(frameBuffer, background, FRAME_BUFFER_SIZE);
+		LCD_BlitIcon(offsetX, offsetY, &image, opaque, wrap);
+
+		if (memcmp(frameBuffer, reference, FRAME_BUFFER_SIZE))
+		{
+			if (failures < 10)
+				printf("mismatch %dx%d at %ld, %ld opaque %d wrap %d\n", sizeX, sizeY,
+						(long)(int32_t)offsetX, (long)(int32_t)offsetY, opaque, wrap);
+			failures++;
+		}
+	}
+
+	printf("blit vs PutPixel  %d blits  %ld failures\n", TEST_NUM_BLITS, failures);
+
+	return failures ? 1 : 0;
+}
+
+
+////////////////////////////////////////////
+//Time one image through the blit and through
+//the PutPixel path, OR mode, positions on the lcd
+static void BenchImage(const char* name, const ImageData* pImage)
+{
+	const ImageData pixelImage = {pImage->xSize, pImage->ySize, pImage->bytesPerLine,
+								pImage->bitsPerPixel, pImage->pImageData, NULL, NULL};
+	uint32_t rangeX = LCD_WIDTH - pImage->xSize + 1;
+	uint32_t rangeY = LCD_HEIGHT - pImage->ySize + 1;
+	double ns[2];
+
+	for (int pass = 0 ; pass < 2 ; pass++)
+	{
+		memset(frameBuffer, 0x00, FRAME_BUFFER_SIZE);
+		clock_t start = clock();
+
+		for (long i = 0 ; i < BENCH_NUM_DRAWS ; i++)
+		{
+			uint32_t x = (uint32_t)(i * 7) % rangeX;
+			uint32_t y = (uint32_t)(i * 3) % rangeY;
+
+			if (!pass)
+				LCD_BlitIcon(x, y, pImage, 0, 0);
+			else
+				LCD_DrawIcon(x, y, &pixelImage, 0);
+		}
+
+		ns[pass] = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_NUM_DRAWS;
+	}
+
+	printf("%-12s %2dx%-2d  blit %7.1f ns  PutPixel %7.1f ns  %5.1fx\n", name,
+			pImage->xSize, pImage->ySize, ns[0], ns[1], ns[1] / ns[0]);
+}
+
+
+int main(void)
+{
+	int result = 0;
+
+	srand(1);
+
+	if (TestBlit())
+		result = 1;
+
+	BenchImage("asteroid LG", &bmimgAsteroidLGBmp);
+	BenchImage("asteroid MD", &bmimgAsteroidMDBmp);
+	BenchImage("asteroid SM", &bmimgAsteroidSMBmp);
+	BenchImage("player", &bmimgPlayer0Bmp);
+
+	printf("%s\n", result ? "FAIL" : "ok");
+	return result;
+}
@@ -0,0 +1,438 @@
+/*////////////////////////////////////////////////////
+LCD Frame Model - host tool
+
+Runs the F411 asteroids 12864 lcd driver on the PC
+against a simulated clock, SPI DMA and panel, and
+compares the frame time with the transfer serialized
+after rendering (present then wait, as before
+LCD_Present) and overlapped with the next frame
+(LCD_Present only).
+
+Each frame draws a scene like Sprite_UpdateDisplay -
+clear, asteroids and the player moving, the score -
+then spends the render time on the simulated clock.
+The SPI runs at the F411 rate (100MHz / 64), a byte
+takes 8 bit times and each descriptor adds
+LCD_SETUP_COST_BYTES byte times.  The CPU time of the
+driver itself is not counted.
+
+The panel model follows the page / column commands
+and data the DMA sends, reading the source bytes when
+each descriptor completes.  Whenever no transfer is
+running it must match the last frame presented, so a
+frame drawn while the DMA runs can't leak into the one
+being sent.
+
+Then stalls the DMA at each descriptor in turn, so the
+LCD_WaitUpdate timeout drops the rest of the frame,
+and checks the panel matches again once the next two
+frames are presented.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_asteroids/Display -I../F411_asteroids/Bitmap \
+-I../F411_asteroids/F411_asteroids/Inc \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+lcd_frame_model.c ../F411_asteroids/Display/lcd_12864_dfrobot.c \
+../F411_asteroids/Display/font_atlas.c ../F411_asteroids/Display/font_table.c \
+../F411_asteroids/Bitmap/imgAsteroidLG.c ../F411_asteroids/Bitmap/imgAsteroidMD.c \
+../F411_asteroids/Bitmap/imgAsteroidSM.c ../F411_asteroids/Bitmap/imgPlayer0.c \
+-o lcd_frame_model
+
+Use:
+lcd_frame_model
+
+Returns 0 if the panel always matches, also after a
+stalled transfer, and the overlapped frame time is
+max(render, transfer).
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "spi.h"
+#include "gpio.h"
+#include "lcd_12864_dfrobot.h"
+#include "bitmap.h"
+
+#define MODEL_SPI_HZ			(100000000 / 64)
+#define MODEL_NUM_FRAMES		500
+#define MODEL_NUM_ROCKS			6
+#define MODEL_RENDER_STEP_US	1000
+#define MODEL_RENDER_MAX_US		12000
+#define MODEL_SLACK_US			50				//per frame, allowed over the ideal
+#define MODEL_NUM_STALLS		200				//stalled descriptor positions
+#define MODEL_STALLED			UINT64_MAX		//dma end of a stalled transfer
+
+
+extern uint8_t frameBuffer[FRAME_BUFFER_SIZE];
+
+extern const ImageData bmimgAsteroidLGBmp;
+extern const ImageData bmimgAsteroidMDBmp;
+extern const ImageData bmimgAsteroidSMBmp;
+extern const ImageData bmimgPlayer0Bmp;
+
+
+////////////////////////////////////////////
+//Simulated clock (ns), SPI and panel
+SPI_HandleTypeDef hspi1;
+
+static uint64_t mNow;
+static uint8_t mDataMode;				//D/C pin
+static uint8_t mDmaActive;
+static uint64_t mDmaEnd;
+static const uint8_t* mDmaData;
+static uint16_t mDmaSize;
+
+static uint8_t mPanel[LCD_NUM_PAGE][LCD_NUM_COL];
+static uint8_t mPanelPage;
+static uint8_t mPanelColumn;
+
+static uint32_t mDmaCount;				//descriptors started
+static uint32_t mStallAt;				//descriptor that never completes
+static uint8_t mStallArmed;
+
+static uint8_t mTransferOpen;			//frame push running
+static uint64_t mTransferBegin;
+static uint64_t mTransferTotal;
+
+static uint64_t ByteTime(uint32_t bytes)
+{
+	return ((uint64_t)bytes * 8 * 1000000000) / MODEL_SPI_HZ;
+}
+
+static void Panel_Write(const uint8_t* data, uint16_t size)
+{
+	for (int i = 0 ; i < size ; i++)
+	{
+		if (mDataMode)
+		{
+			if (mPanelColumn < LCD_NUM_COL)
+				mPanel[mPanelPage][mPanelColumn] = data[i];
+			mPanelColumn++;
+		}
+		else if ((data[i] & 0xF0) == 0xB0)
+			mPanelPage = data[i] & 0x07;
+		else if ((data[i] & 0xF0) == 0x10)
+			mPanelColumn = (mPanelColumn & 0x0F) | ((data[i] & 0x0F) << 4);
+		else if ((data[i] & 0xF0) == 0x00)
+			mPanelColumn = (mPanelColumn & 0xF0) | data[i];
+	}
+}
+
+////////////////////////////////////////////
+//Move the clock to time, completing any DMA
+//that ends before it.  The complete callback
+//may start the next descriptor.
+static void Model_RunUntil(uint64_t time)
+{
+	while ((mDmaActive) && (mDmaEnd <= time))
+	{
+		mNow = mDmaEnd;
+		mDmaActive = 0;
+		Panel_Write(mDmaData, mDmaSize);
+		HAL_SPI_TxCpltCallback(&hspi1);
+
+		if ((mTransferOpen) && (!LCD_UpdateBusy()))
+		{
+			mTransferTotal += mNow - mTransferBegin;
+			mTransferOpen = 0;
+		}
+	}
+
+	if (time > mNow)
+		mNow = time;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+	(void)GPIOx;
+	(void)GPIO_Init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if ((GPIOx == LCD_CMD_GPIO_Port) && (GPIO_Pin == LCD_CMD_Pin))
+		mDataMode = (PinState == GPIO_PIN_SET);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hspi;
+	(void)Timeout;
+	Model_RunUntil(mNow + ByteTime(Size));
+	Panel_Write(pData, Size);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+	(void)hspi;
+
+	if (mDmaActive)
+		return HAL_BUSY;
+
+	mDmaActive = 1;
+	mDmaData = pData;
+	mDmaSize = Size;
+	mDmaEnd = mNow + ByteTime(Size + LCD_SETUP_COST_BYTES);
+
+	if ((mStallArmed) && (mDmaCount == mStallAt))
+	{
+		mDmaEnd = MODEL_STALLED;
+		mStallArmed = 0;
+	}
+
+	mDmaCount++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+	(void)hspi;
+	mDmaActive = 0;
+	return HAL_OK;
+}
+
+////////////////////////////////////////////
+//The driver polls the tick while it waits on
+//the DMA - move the clock to the next event,
+//1ms per poll while the DMA is stalled
+uint32_t HAL_GetTick(void)
+{
+	if ((mDmaActive) && (mDmaEnd == MODEL_STALLED))
+		mNow += 1000000;
+	else if (mDmaActive)
+		Model_RunUntil(mDmaEnd);
+
+	return (uint32_t)(mNow / 1000000);
+}
+
+
+////////////////////////////////////////////
+//Scene - asteroids bouncing around the lcd,
+//the player turning in the middle, the score
+typedef struct
+{
+	const ImageData* image;
+	int x, y, dx, dy;
+}Rock;
+
+static Rock mRocks[MODEL_NUM_ROCKS];
+static int mScore;
+
+static void Scene_Init(void)
+{
+	const ImageData* images[] = {&bmimgAsteroidLGBmp, &bmimgAsteroidMDBmp, &bmimgAsteroidSMBmp};
+
+	srand(1);
+
+	for (int i = 0 ; i < MODEL_NUM_ROCKS ; i++)
+	{
+		mRocks[i].image = images[i % 3];
+		mRocks[i].x = rand() % (LCD_WIDTH - mRocks[i].image->xSize);
+		mRocks[i].y = 8 + rand() % (LCD_HEIGHT - 8 - mRocks[i].image->ySize);
+		mRocks[i].dx = (rand() % 2) ? 1 : -1;
+		mRocks[i].dy = (rand() % 2) ? 1 : -1;
+	}
+
+	mScore = 0;
+}
+
+static void Scene_Draw(int frame)
+{
+	char buffer[40];
+
+	LCD_BeginBatch();
+	LCD_ClearMemory(frameBuffer, 0x00);
+
+	for (int i = 0 ; i < MODEL_NUM_ROCKS ; i++)
+	{
+		Rock* rock = &mRocks[i];
+
+		rock->x += rock->dx;
+		rock->y += rock->dy;
+
+		if ((rock->x <= 0) || (rock->x >= (LCD_WIDTH - rock->image->xSize)))
+			rock->dx = -rock->dx;
+		if ((rock->y <= 8) || (rock->y >= (LCD_HEIGHT - rock->image->ySize)))
+			rock->dy = -rock->dy;
+
+		LCD_DrawIcon(rock->x, rock->y, rock->image, 0);
+	}
+
+	LCD_DrawIcon(56 + (frame & 0x03), 24, &bmimgPlayer0Bmp, 0);
+
+	mScore += 10;
+	int n = sprintf(buffer, "S:%04d   L:%d  P:%d", mScore % 10000, 1, 3);
+	LCD_DrawText(0, 0, 1, buffer, n, 1);
+}
+
+
+////////////////////////////////////////////
+//Run the scene, render us of work per frame.
+//Returns the average frame and transfer time
+//in us and counts panel mismatches.
+typedef struct
+{
+	double frameUs;
+	double transferUs;
+	long checks;
+	long mismatches;
+}ModelResult;
+
+static void Model_Run(uint32_t renderUs, int overlap, ModelResult* result)
+{
+	static uint8_t presented[FRAME_BUFFER_SIZE];
+	uint64_t firstPresent = 0;
+	uint8_t havePresented = 0;
+
+	memset(result, 0x00, sizeof(*result));
+	Scene_Init();
+	mTransferTotal = 0;
+
+	for (int frame = 0 ; frame < MODEL_NUM_FRAMES ; frame++)
+	{
+		Scene_Draw(frame);
+		Model_RunUntil(mNow + ((uint64_t)renderUs * 1000));
+
+		//frame boundary - the start of the present
+		if (!frame)
+			firstPresent = mNow;
+
+		//the panel holds the last frame once the push
+		//is done.  overlapped, Present waits first
+		if (overlap)
+			LCD_WaitUpdate();
+
+		if (havePresented)
+		{
+			result->checks++;
+			if (memcmp(mPanel, presented, FRAME_BUFFER_SIZE))
+				result->mismatches++;
+		}
+
+		LCD_Present();
+
+		memcpy(presented, frameBuffer, FRAME_BUFFER_SIZE);
+		havePresented = 1;
+
+		if (LCD_UpdateBusy())
+		{
+			mTransferOpen = 1;
+			mTransferBegin = mNow;
+		}
+
+		if (!overlap)
+			LCD_WaitUpdate();
+	}
+
+	//to the start of the next present
+	Model_RunUntil(mNow + ((uint64_t)renderUs * 1000));
+	LCD_WaitUpdate();
+
+	result->checks++;
+	if (memcmp(mPanel, presented, FRAME_BUFFER_SIZE))
+		result->mismatches++;
+
+	result->frameUs = (double)(mNow - firstPresent) / 1000.0 / MODEL_NUM_FRAMES;
+	result->transferUs = (double)mTransferTotal / 1000.0 / MODEL_NUM_FRAMES;
+}
+
+
+////////////////////////////////////////////
+//Stall the DMA at each descriptor of a frame
+//in turn.  The timeout drops the rest of the
+//frame, two presents later the panel must match
+//the last frame again.  Returns the mismatches.
+static long Model_Stall(long* checks)
+{
+	long mismatches = 0;
+
+	*checks = 0;
+	Scene_Init();
+
+	for (uint32_t stall = 0 ; stall < MODEL_NUM_STALLS ; stall++)
+	{
+		Scene_Draw(0);
+		LCD_Present();
+		LCD_WaitUpdate();
+
+		//stall a descriptor of the next frame
+		mStallAt = mDmaCount + stall;
+		mStallArmed = 1;
+
+		Scene_Draw(1);
+		LCD_Present();
+		LCD_WaitUpdate();
+
+		//past the end of the frame, nothing stalled
+		if (mStallArmed)
+		{
+			mStallArmed = 0;
+			break;
+		}
+
+		for (int frame = 2 ; frame <= 3 ; frame++)
+		{
+			Scene_Draw(frame);
+			LCD_Present();
+			LCD_WaitUpdate();
+		}
+
+		(*checks)++;
+		if (memcmp(mPanel, frameBuffer, FRAME_BUFFER_SIZE))
+			mismatches++;
+	}
+
+	return mismatches;
+}
+
+
+int main(void)
+{
+	int result = 0;
+
+	printf("render us   transfer us   serialized us   overlapped us   max(r, t) us\n");
+
+	for (uint32_t renderUs = 0 ; renderUs <= MODEL_RENDER_MAX_US ; renderUs += MODEL_RENDER_STEP_US)
+	{
+		ModelResult serial, overlap;
+
+		Model_Run(renderUs, 0, &serial);
+		Model_Run(renderUs, 1, &overlap);
+
+		double ideal = (renderUs > overlap.transferUs) ? renderUs : overlap.transferUs;
+
+		printf("%9lu   %11.1f   %13.1f   %13.1f   %12.1f\n", (unsigned long)renderUs,
+				overlap.transferUs, serial.frameUs, overlap.frameUs, ideal);
+
+		if ((serial.mismatches) || (overlap.mismatches))
+		{
+			printf("  panel mismatch - serialized %ld of %ld, overlapped %ld of %ld\n",
+					serial.mismatches, serial.checks, overlap.mismatches, overlap.checks);
+			result = 1;
+		}
+
+		if (overlap.frameUs > (ideal + MODEL_SLACK_US))
+		{
+			printf("  overlapped frame is over max(render, transfer)\n");
+			result = 1;
+		}
+	}
+
+	long checks = 0;
+	long mismatches = Model_Stall(&checks);
+
+	printf("stalled transfer   %ld positions  %ld panel mismatches\n", checks, mismatches);
+
+	if ((!checks) || (mismatches))
+		result = 1;
+
+	printf("%s\n", result ? "FAIL" : "ok");
+	return result;
+}
@@ -0,0 +1,429 @@
+/*////////////////////////////////////////////////////
+Pong Sweep Fuzz - host tool
+
+Runs the pong ball move (Sprite/Sprite.c, included so
+the tool can set up the ball, paddle and tiles) on the
+PC with the lcd, touch panel, slide pot and sound
+mocked, over fuzzed trajectories:
+
+- each of the levels with a random third of the tiles
+gone, the ball anywhere clear above the paddle, in
+any direction, the paddle anywhere
+- game speed 1 to 12, past GAME_SPEED_FAST, so a step
+is several times the tile and paddle size
+
+After every move the ball must be inside the walls,
+clear of every live tile and still at the ball speed.
+A move with no bounce must not pass through a tile
+that was live before it, or cross the paddle top over
+the paddle.  Also checks Sprite_InvSqrt against sqrt.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -Wno-pointer-to-int-cast -DSTM32F429xx -DUSE_HAL_DRIVER \
+-I../pong/Sprite -I../pong/Tables -I../pong/Display -I../pong/Bitmap \
+-I../pong/TouchPanel -I../pong/Controls -I../pong/Sound \
+-I../pong/cube/pong_game/Inc \
+-I../pong/cube/pong_game/Drivers/CMSIS/Include \
+-I../pong/cube/pong_game/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../pong/cube/pong_game/Drivers/STM32F4xx_HAL_Driver/Inc \
+pong_sweep_fuzz.c ../pong/Sprite/TileGrid.c ../pong/Tables/levels.c \
+../pong/Bitmap/imgBall.c ../pong/Bitmap/imgPlayer.c \
+../pong/Bitmap/imgTile.c ../pong/Bitmap/imgTileBlank.c \
+-lm -o pong_sweep_fuzz
+
+The layer addresses are cast to 32 bits for the LTDC,
+-Wno-pointer-to-int-cast quiets that on a 64 bit PC.
+
+Use:
+pong_sweep_fuzz
+
+Returns 0 if every move checks.
+
+*/////////////////////////////////////////////////////
+#include <math.h>
+
+#include "../pong/Sprite/Sprite.c"
+
+#define FUZZ_NUM_GAMES			20000
+#define FUZZ_NUM_MOVES			500
+#define FUZZ_MAX_SPEED			12
+#define FUZZ_NUM_SAMPLES		64				//points along a move for the tunnel check
+
+
+////////////////////////////////////////////
+//Mocked hal, lcd, touch, slide pot and sound.
+//The sounds count the bounces.
+LTDC_HandleTypeDef hltdc;
+
+static long mTileBounces;
+static long mPlayerBounces;
+static long mWallBounces;
+
+void HAL_Delay(__IO uint32_t Delay)
+{
+	(void)Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return 0;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAddress(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx)
+{
+	(void)hltdc;
+	(void)Address;
+	(void)LayerIdx;
+	return HAL_OK;
+}
+
+void LCD_SetTextLineColor(uint16_t color)
+{
+	(void)color;
+}
+
+void LCD_SetTextBackColor(uint16_t color)
+{
+	(void)color;
+}
+
+void LCD_Clear(uint32_t layer, uint16_t color)
+{
+	(void)layer;
+	(void)color;
+}
+
+void LCD_DrawLine(uint32_t layer, int x0, int y0, int x1, int y1, uint16_t color)
+{
+	(void)layer;
+	(void)x0;
+	(void)y0;
+	(void)x1;
+	(void)y1;
+	(void)color;
+}
+
+void LCD_DrawBox(uint32_t layer, uint32_t x0, uint32_t y0, uint32_t sizeX, uint32_t sizeY, uint16_t color)
+{
+	(void)layer;
+	(void)x0;
+	(void)y0;
+	(void)sizeX;
+	(void)sizeY;
+	(void)color;
+}
+
+void LCD_DrawString(uint8_t layer, uint8_t row, char* output)
+{
+	(void)layer;
+	(void)row;
+	(void)output;
+}
+
+void LCD_DrawStringLength(uint8_t layer, uint8_t row, char output[], uint8_t length)
+{
+	(void)layer;
+	(void)row;
+	(void)output;
+	(void)length;
+}
+
+void LCD_DrawBitmapTransparent(uint32_t layer, uint32_t x0, uint32_t y0, const ImageData* image, uint16_t transparentColor)
+{
+	(void)layer;
+	(void)x0;
+	(void)y0;
+	(void)image;
+	(void)transparentColor;
+}
+
+TouchPanelData TouchPanel_getPosition(void)
+{
+	TouchPanelData data;
+	memset(&data, 0x00, sizeof(data));
+	return data;
+}
+
+void TouchPanel_Process(void)
+{
+}
+
+uint32_t TouchPanel_GetSampleCount(void)
+{
+	return 0;
+}
+
+int TouchPanel_SolveCalibration(const TouchPanelCalibPoint points[3], TouchPanelCalib* calib)
+{
+	(void)points;
+	(void)calib;
+	return -1;
+}
+
+void TouchPanel_SetCalibration(const TouchPanelCalib* calib)
+{
+	(void)calib;
+}
+
+int TouchPanel_SaveCalibration(void)
+{
+	return -1;
+}
+
+void TouchTrack_Init(void)
+{
+}
+
+uint8_t TouchTrack_GetPosition(uint32_t tick, uint16_t* x, uint16_t* y)
+{
+	(void)tick;
+	(void)x;
+	(void)y;
+	return 0;
+}
+
+void TouchTrack_FramePresented(uint32_t tick)
+{
+	(void)tick;
+}
+
+void TouchTrack_GetLatency(TouchTrackLatency* latency)
+{
+	memset(latency, 0x00, sizeof(TouchTrackLatency));
+}
+
+uint16_t SlidePot_ReadPosition(void)
+{
+	return 0;
+}
+
+void Sound_Play_PlayerBounce(void)
+{
+	mPlayerBounces++;
+}
+
+void Sound_Play_WallBounce(void)
+{
+	mWallBounces++;
+}
+
+void Sound_Play_TileBounce(void)
+{
+	mTileBounces++;
+}
+
+
+////////////////////////////////////////////
+//Ball at x, y (Q8) overlaps the box (pixels)
+static int Fuzz_Overlap(int64_t x, int64_t y, int64_t left, int64_t top, int64_t right, int64_t bottom)
+{
+	return ((x < (right << 8)) && ((x + ((int64_t)mBall.sizeX << 8)) > (left << 8)) &&
+			(y < (bottom << 8)) && ((y + ((int64_t)mBall.sizeY << 8)) > (top << 8)));
+}
+
+////////////////////////////////////////////
+//Ball at x, y (Q8) overlaps a tile live in alive
+static int Fuzz_HitsTile(int64_t x, int64_t y, const uint16_t* alive)
+{
+	for (int row = 0 ; row < mTileGrid.numRows ; row++)
+	{
+		for (int col = 0 ; col < mTileGrid.numCols ; col++)
+		{
+			int64_t left = mTileGrid.x + (col * mTileGrid.sizeX);
+			int64_t top = mTileGrid.y + (row * mTileGrid.sizeY);
+
+			if (((alive[row] >> col) & 0x01) &&
+					(Fuzz_Overlap(x, y, left, top, left + mTileGrid.sizeX, top + mTileGrid.sizeY)))
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////
+//Ball at x, y (Q8) past a wall
+static int Fuzz_OutOfBounds(int64_t x, int64_t y)
+{
+	return ((x < (SCREEN_LEFT << 8)) || ((x + ((int64_t)mBall.sizeX << 8)) > (SCREEN_RIGHT << 8)) ||
+			(y < (SCREEN_TOP << 8)));
+}
+
+////////////////////////////////////////////
+//Random ball, paddle, speed and tiles
+static void Fuzz_Setup(void)
+{
+	int32_t x, y;
+
+	spriteGameLevel = rand() % NUM_LEVELS;
+	Tile_Init();
+	Ball_Init();
+	Player_Init();
+
+	for (int row = 0 ; row < mTileGrid.numRows ; row++)
+	{
+		for (int col = 0 ; col < mTileGrid.numCols ; col++)
+		{
+			if ((((mTileGrid.alive[row] >> col) & 0x01)) && (!(rand() % 3)))
+			{
+				mTileGrid.alive[row] &= ~(1u << col);
+				mTileGrid.numAlive--;
+			}
+		}
+	}
+
+	mPlayer.x = SCREEN_LEFT + (rand() % (SCREEN_RIGHT - SCREEN_LEFT - mPlayer.sizeX));
+
+	do
+	{
+		x = SCREEN_LEFT + (rand() % (SCREEN_RIGHT - SCREEN_LEFT - mBall.sizeX));
+		y = SCREEN_TOP + (rand() % (mPlayer.y - SCREEN_TOP - mBall.sizeY));
+	}while (Fuzz_HitsTile((int64_t)x << 8, (int64_t)y << 8, mTileGrid.alive));
+
+	mBall.x = x;
+	mBall.y = y;
+	mBall.posX = x << 8;
+	mBall.posY = y << 8;
+	Sprite_Ball_SetDirection((rand() % 41) - 20, (rand() % 41) - 20);
+
+	spriteGameSpeed = (GameSpeed_t)(1 + (rand() % FUZZ_MAX_SPEED));
+	spriteBallMissedFlag = 0;
+}
+
+////////////////////////////////////////////
+//Ball speed, 1 if off SPRITE_BALL_SPEED
+static int Fuzz_BadSpeed(void)
+{
+	double speed = sqrt(((double)mBall.vx * mBall.vx) + ((double)mBall.vy * mBall.vy));
+	return (fabs(speed - SPRITE_BALL_SPEED) > 3.0);
+}
+
+
+static int TestInvSqrt(void)
+{
+	int failures = 0;
+
+	for (uint32_t n = 1 ; n < 2000000 ; n += (n / 7) + 1)
+	{
+		double expected = 16777216.0 / sqrt((double)n);
+		double result = Sprite_InvSqrt(n);
+
+		if (fabs(result - expected) > ((expected * 0.002) + 1))
+		{
+			if (failures < 10)
+				printf("invsqrt %lu: %.1f, expected %.1f\n", (unsigned long)n, result, expected);
+			failures++;
+		}
+	}
+
+	printf("inv sqrt            %d failures\n", failures);
+	return failures;
+}
+
+
+static int TestSweep(void)
+{
+	uint16_t alive[TILE_GRID_MAX_ROWS];
+	long moves = 0;
+	int failures = 0;
+
+	for (long game = 0 ; (game < FUZZ_NUM_GAMES) && (failures < 10) ; game++)
+	{
+		Fuzz_Setup();
+
+		for (int move = 0 ; move < FUZZ_NUM_MOVES ; move++)
+		{
+			int64_t startX = mBall.posX;
+			int64_t startY = mBall.posY;
+			long bounces = mTileBounces + mPlayerBounces + mWallBounces;
+
+			memcpy(alive, mTileGrid.alive, sizeof(alive));
+
+			Sprite_Ball_Move();
+			moves++;
+
+			if (spriteBallMissedFlag)
+				break;
+
+			int64_t endX = mBall.posX;
+			int64_t endY = mBall.posY;
+			const char* error = NULL;
+
+			if (Fuzz_OutOfBounds(endX, endY))
+				error = "past a wall";
+			else if (Fuzz_HitsTile(endX, endY, mTileGrid.alive))
+				error = "in a tile";
+			else if (Fuzz_BadSpeed())
+				error = "speed";
+
+			//straight move - nothing between the ends
+			else if ((mTileBounces + mPlayerBounces + mWallBounces) == bounces)
+			{
+				int64_t paddleY = (int64_t)mPlayer.y << 8;
+				int64_t sizeY = (int64_t)mBall.sizeY << 8;
+
+				for (int i = 0 ; i <= FUZZ_NUM_SAMPLES ; i++)
+				{
+					int64_t x = startX + (((endX - startX) * i) / FUZZ_NUM_SAMPLES);
+					int64_t y = startY + (((endY - startY) * i) / FUZZ_NUM_SAMPLES);
+
+					if (Fuzz_HitsTile(x, y, alive))
+					{
+						error = "through a tile";
+						break;
+					}
+				}
+
+				//ball bottom crosses the paddle top
+				if ((!error) && ((startY + sizeY) <= paddleY) && ((endY + sizeY) > paddleY))
+				{
+					int64_t x = startX + (((endX - startX) * (paddleY - sizeY - startY)) / (endY - startY));
+
+					if (((x + ((int64_t)mBall.sizeX << 8)) > ((int64_t)mPlayer.x << 8)) &&
+							(x < ((int64_t)(mPlayer.x + mPlayer.sizeX) << 8)))
+						error = "through the paddle";
+				}
+			}
+
+			if (error)
+			{
+				printf("game %ld move %d: %s, (%.2f, %.2f) to (%.2f, %.2f) speed %d\n", game, move, error,
+						startX / 256.0, startY / 256.0, endX / 256.0, endY / 256.0, (int)spriteGameSpeed);
+				failures++;
+				break;
+			}
+
+			if (!mTileGrid.numAlive)
+				break;
+		}
+
+		int numAlive = 0;
+
+		for (int row = 0 ; row < mTileGrid.numRows ; row++)
+			numAlive += __builtin_popcount(mTileGrid.alive[row]);
+
+		if (numAlive != mTileGrid.numAlive)
+		{
+			printf("game %ld: %d tiles alive, count is %d\n", game, numAlive, mTileGrid.numAlive);
+			failures++;
+		}
+	}
+
+	printf("swept moves         %ld moves  %ld tile, %ld paddle, %ld wall bounces  %d failures\n",
+			moves, mTileBounces, mPlayerBounces, mWallBounces, failures);
+	return failures;
+}
+
+
+int main(void)
+{
+	int failures = 0;
+
+	srand(1);
+
+	failures += TestInvSqrt();
+	failures += TestSweep();
+
+	printf("%s\n", failures ? "FAIL" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,702 @@
+/*////////////////////////////////////////////////////
+Score EEPROM Sim - host tool
+
+Runs the F411 asteroids leaderboard and eeprom driver
+(Game/score.c, Game/eeprom.c) on the PC against a
+simulated 24LC01B on I2C1 and a simulated clock.
+
+The part model:
+- 100kHz bus, 9 bit times a byte, one for the start
+and one for the stop
+- data goes into the 8 byte page latch and rolls over
+to the start of the page, nothing is written before
+the stop
+- the stop starts a 5ms write cycle, the part nacks
+its address until it's done, then programs the page
+- sequential reads roll over at the end of the part
+
+Insert cost - inserts from the main loop, one
+Score_Process per SIM_LOOP_US pass, and counts the bus
+writes, bytes, ack polls, the time the main loop is
+held up in Score_Process and the time until the header
+is programmed.  Also how the page programs spread over
+the entry pages.
+
+Power fail - for each insert the power is cut every
+SIM_CUT_STEP_US from Score_Insert to the end of the
+header write cycle, then the part and the game are
+restarted and the board loaded.  A cut on the bus
+loses the page.  A cut in the write cycle tears the
+page: in the first half bits of the old data erase to
+1, in the second half the page is erased and bits of
+the new data program to 0, more of them the later the
+cut.  The board must load as before the insert until
+the header write cycle starts and as after it once the
+header is programmed.  A header torn in its write
+cycle must load one or the other - a torn page that
+still checks is a crc8 collision, there can be at
+most 1 in 256 of those.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_asteroids/Game -I../F411_asteroids/Display \
+-I../F411_asteroids/Bitmap \
+-I../F411_asteroids/F411_asteroids/Inc \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+score_eeprom_sim.c ../F411_asteroids/Game/score.c \
+../F411_asteroids/Game/eeprom.c -o score_eeprom_sim
+
+Use:
+score_eeprom_sim
+
+Returns 0 if every power fail loads a good board.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "i2c.h"
+#include "score.h"
+#include "eeprom.h"
+#include "lcd_12864_dfrobot.h"
+
+#define SIM_I2C_HZ				100000
+#define SIM_BIT_US				(1000000 / SIM_I2C_HZ)
+#define SIM_WRITE_CYCLE_US		5000			//24LC01B tWC max
+#define SIM_LOOP_US				1000			//game work per main loop pass
+#define SIM_POLL_US				1				//cpu time per HAL_GetTick
+#define SIM_OFF_US				100000			//power off time
+
+#define SIM_NUM_COST			200
+#define SIM_NUM_POWER_FAIL		150
+#define SIM_CUT_STEP_US			20
+
+#define SIM_NEVER				UINT64_MAX
+
+
+////////////////////////////////////////////
+//Simulated clock (us) and 24LC01B
+I2C_HandleTypeDef hi2c1 = {.Instance = I2C1};
+
+static uint64_t mNow;
+
+static uint8_t mChip[EEPROM_SIZE];
+static uint8_t mPowered = 1;
+static uint8_t mLatch[EEPROM_PAGE_SIZE];
+static uint8_t mLatchMask;					//latch bytes loaded
+static uint8_t mLatchPage;
+static uint8_t mCycle;						//in the write cycle
+static uint64_t mCycleStart;
+static uint64_t mCycleEnd;
+
+//page write from the tx dma, the stop is at mDmaEnd
+static uint8_t mDmaActive;
+static uint8_t mDmaNack;
+static uint64_t mDmaEnd;
+static uint16_t mDmaAddress;
+static uint8_t mDmaData[EEPROM_SIZE];
+static uint16_t mDmaSize;
+
+//power cut
+static uint64_t mCutTime = SIM_NEVER;
+static int mCutTorn;						//-1, or the page torn by the cut
+
+//counters
+static long mBusWrites;
+static long mBusBytes;
+static long mBusPolls;
+static uint64_t mBusUs;
+static long mPrograms[EEPROM_SIZE / EEPROM_PAGE_SIZE];
+static uint64_t mHeaderProgramTime;
+
+
+static uint64_t BusTime(uint32_t bytes)
+{
+	return (((uint64_t)bytes * 9) + 2) * SIM_BIT_US;
+}
+
+static uint8_t Chip_Ready(void)
+{
+	return (mPowered) && (!mCycle);
+}
+
+////////////////////////////////////////////
+//Bytes into the page latch, rolling over at
+//the end of the page
+static void Chip_Load(uint16_t address, const uint8_t* data, uint16_t size)
+{
+	mLatchPage = (address / EEPROM_PAGE_SIZE) % (EEPROM_SIZE / EEPROM_PAGE_SIZE);
+	mLatchMask = 0x00;
+
+	for (int i = 0 ; i < size ; i++)
+	{
+		uint8_t column = (address + i) & (EEPROM_PAGE_SIZE - 1);
+
+		mLatch[column] = data[i];
+		mLatchMask |= 1 << column;
+	}
+}
+
+////////////////////////////////////////////
+//Stop condition - the page write cycle starts
+static void Chip_Stop(void)
+{
+	mCycle = 1;
+	mCycleStart = mNow;
+	mCycleEnd = mNow + SIM_WRITE_CYCLE_US;
+}
+
+static void Chip_Program(void)
+{
+	uint8_t* page = &mChip[mLatchPage * EEPROM_PAGE_SIZE];
+
+	for (int i = 0 ; i < EEPROM_PAGE_SIZE ; i++)
+	{
+		if (mLatchMask & (1 << i))
+			page[i] = mLatch[i];
+	}
+
+	mCycle = 0x00;
+	mPrograms[mLatchPage]++;
+
+	if ((mLatchPage * EEPROM_PAGE_SIZE) < SCORE_ENTRY_ADDRESS)
+		mHeaderProgramTime = mNow;
+}
+
+////////////////////////////////////////////
+//Power cut in the write cycle - erase first,
+//then program, each bit part way by chance
+static void Chip_Tear(void)
+{
+	uint8_t* page = &mChip[mLatchPage * EEPROM_PAGE_SIZE];
+	int progress = (int)(((mNow - mCycleStart) * 512) / SIM_WRITE_CYCLE_US);
+
+	for (int i = 0 ; i < EEPROM_PAGE_SIZE ; i++)
+	{
+		if (!(mLatchMask & (1 << i)))
+			continue;
+
+		for (int bit = 0 ; bit < 8 ; bit++)
+		{
+			uint8_t mask = 1 << bit;
+
+			if (progress < 256)
+			{
+				if ((rand() % 256) < progress)
+					page[i] |= mask;
+			}
+			else
+			{
+				page[i] |= mask;
+
+				if ((!(mLatch[i] & mask)) && ((rand() % 256) < (progress - 256)))
+					page[i] &= ~mask;
+			}
+		}
+	}
+
+	mCutTorn = mLatchPage;
+}
+
+static void Chip_PowerOff(void)
+{
+	if (mCycle)
+		Chip_Tear();
+
+	mCycle = 0x00;
+	mDmaActive = 0x00;
+	mPowered = 0x00;
+	mCutTime = SIM_NEVER;
+}
+
+////////////////////////////////////////////
+//Move the clock to time, running the dma stop,
+//the end of the write cycle and the power cut
+//in the order they happen
+static void Sim_RunUntil(uint64_t time)
+{
+	for (;;)
+	{
+		uint64_t next = time;
+		int event = 0;
+
+		if ((mDmaActive) && (mDmaEnd <= next))
+		{
+			next = mDmaEnd;
+			event = 1;
+		}
+
+		if ((mCycle) && (mCycleEnd <= next))
+		{
+			next = mCycleEnd;
+			event = 2;
+		}
+
+		if ((mPowered) && (mCutTime <= next))
+		{
+			next = mCutTime;
+			event = 3;
+		}
+
+		if (!event)
+			break;
+
+		if (next > mNow)
+			mNow = next;
+
+		switch (event)
+		{
+			case 1:
+				mDmaActive = 0x00;
+
+				if (mDmaNack)
+					HAL_I2C_ErrorCallback(&hi2c1);
+				else
+				{
+					Chip_Load(mDmaAddress, mDmaData, mDmaSize);
+					Chip_Stop();
+					HAL_I2C_MemTxCpltCallback(&hi2c1);
+				}
+				break;
+
+			case 2:
+				Chip_Program();
+				break;
+
+			default:
+				Chip_PowerOff();
+				break;
+		}
+	}
+
+	if (time > mNow)
+		mNow = time;
+}
+
+
+////////////////////////////////////////////
+//HAL I2C on the part
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if (!Chip_Ready())
+	{
+		Sim_RunUntil(mNow + BusTime(1));
+		return HAL_ERROR;
+	}
+
+	mBusWrites++;
+	mBusBytes += Size + 2;
+	mBusUs += BusTime(Size + 2);
+	Sim_RunUntil(mNow + BusTime(Size + 2));
+
+	//power lost before the stop
+	if (!mPowered)
+		return HAL_ERROR;
+
+	Chip_Load(MemAddress, pData, Size);
+	Chip_Stop();
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+
+	if ((mDmaActive) || (Size > EEPROM_SIZE))
+		return HAL_BUSY;
+
+	//a nack on the address ends it at the first byte
+	mDmaNack = !Chip_Ready();
+	mDmaActive = 1;
+	mDmaAddress = MemAddress;
+	mDmaSize = Size;
+	memcpy(mDmaData, pData, Size);
+	mDmaEnd = mNow + BusTime(mDmaNack ? 1 : (Size + 2));
+
+	if (!mDmaNack)
+	{
+		mBusWrites++;
+		mBusBytes += Size + 2;
+		mBusUs += BusTime(Size + 2);
+	}
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if (!Chip_Ready())
+	{
+		Sim_RunUntil(mNow + BusTime(1));
+		return HAL_ERROR;
+	}
+
+	for (int i = 0 ; i < Size ; i++)
+		pData[i] = mChip[(MemAddress + i) % EEPROM_SIZE];
+
+	mBusBytes += Size + 3;
+	mBusUs += BusTime(Size + 3);
+	Sim_RunUntil(mNow + BusTime(Size + 3));
+
+	return mPowered ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)Timeout;
+
+	for (uint32_t i = 0 ; i < Trials ; i++)
+	{
+		uint8_t ack = Chip_Ready();
+
+		mBusPolls++;
+		mBusUs += BusTime(1);
+		Sim_RunUntil(mNow + BusTime(1));
+
+		if (ack)
+			return HAL_OK;
+	}
+
+	return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	mDmaActive = 0x00;
+	return HAL_OK;
+}
+
+////////////////////////////////////////////
+//The driver polls the tick while it waits on
+//the dma - move the clock to the stop
+uint32_t HAL_GetTick(void)
+{
+	Sim_RunUntil(mDmaActive ? mDmaEnd : (mNow + SIM_POLL_US));
+	return (uint32_t)(mNow / 1000);
+}
+
+////////////////////////////////////////////
+//lcd - the display functions are not tested
+void LCD_BacklightToggle(void)
+{
+}
+
+void LCD_Clear(uint8_t data)
+{
+	(void)data;
+}
+
+void LCD_DrawStringKern(uint8_t row_initial, uint8_t kern, const char* mystring)
+{
+	(void)row_initial;
+	(void)kern;
+	(void)mystring;
+}
+
+void LCD_DrawStringKernLength(uint8_t row_initial, uint8_t kern, uint8_t* mystring, uint8_t length)
+{
+	(void)row_initial;
+	(void)kern;
+	(void)mystring;
+	(void)length;
+}
+
+
+////////////////////////////////////////////
+//Power up - finish whatever the driver was
+//doing with the part off, as if the cpu went
+//down too, then start the part and the game
+static void Sim_Reboot(void)
+{
+	if (EEPROM_IsBusy())
+	{
+		if (mDmaActive)
+			Sim_RunUntil(mDmaEnd);
+		else if (!mPowered)
+			HAL_I2C_ErrorCallback(&hi2c1);
+
+		EEPROM_Flush();
+	}
+
+	Chip_PowerOff();
+	Sim_RunUntil(mNow + SIM_OFF_US);
+	mPowered = 1;
+
+	EEPROM_init();
+	Score_Init();
+}
+
+////////////////////////////////////////////
+//Main loop until the board is on the part,
+//or the power goes.  Returns the time held
+//up in Score_Process.
+static uint64_t Sim_RunLoop(void)
+{
+	uint64_t blocked = 0;
+
+	while (mPowered)
+	{
+		uint64_t start = mNow;
+
+		Score_Process();
+		blocked += mNow - start;
+
+		if (!EEPROM_IsBusy())
+			break;
+
+		Sim_RunUntil(mNow + SIM_LOOP_US);
+	}
+
+	//the header write cycle
+	if (mCycle)
+		Sim_RunUntil(mCycleEnd);
+
+	return blocked;
+}
+
+
+////////////////////////////////////////////
+//Board as loaded, for comparing
+typedef struct
+{
+	int count;
+	ScoreEntry entries[SCORE_NUM_ENTRIES];
+}Board;
+
+static void Board_Read(Board* board)
+{
+	memset(board, 0x00, sizeof(Board));
+	board->count = Score_GetNumEntries();
+
+	for (int i = 0 ; i < board->count ; i++)
+		Score_GetEntry(i, &board->entries[i]);
+}
+
+static int Board_Equal(const Board* a, const Board* b)
+{
+	return !memcmp(a, b, sizeof(Board));
+}
+
+////////////////////////////////////////////
+//Scores mostly rising, so nearly every insert
+//makes the board
+static uint32_t NextScore(long n)
+{
+	return (uint32_t)((n * 100) + (rand() % 1000));
+}
+
+static void SetInitials(long n)
+{
+	uint8_t initials[SCORE_INITIALS_SIZE];
+
+	initials[0] = 'A' + (n % 26);
+	initials[1] = 'A' + ((n / 26) % 26);
+	initials[2] = 'A' + ((n / 676) % 26);
+
+	Score_SetPlayerName(initials, SCORE_INITIALS_SIZE);
+}
+
+
+////////////////////////////////////////////
+//Insert cost from the main loop, the board
+//reloaded after each insert
+static int TestCost(void)
+{
+	Board board, loaded;
+	long inserts = 0;
+	long writes = 0, bytes = 0, polls = 0;
+	uint64_t busUs = 0, blockedUs = 0, commitUs = 0, commitMax = 0;
+	int failures = 0;
+
+	memset(mChip, 0xFF, EEPROM_SIZE);
+	memset(mPrograms, 0x00, sizeof(mPrograms));
+	Sim_Reboot();
+	srand(1);
+
+	for (long n = 0 ; n < SIM_NUM_COST ; n++)
+	{
+		uint32_t score = NextScore(n);
+		uint8_t level = (uint8_t)(1 + (rand() % 20));
+
+		SetInitials(n);
+
+		long startWrites = mBusWrites, startBytes = mBusBytes, startPolls = mBusPolls;
+		uint64_t startBus = mBusUs, start = mNow;
+
+		if (Score_Insert(score, level) < 0)
+			continue;
+
+		blockedUs += Sim_RunLoop();
+
+		uint64_t commit = mHeaderProgramTime - start;
+
+		inserts++;
+		writes += mBusWrites - startWrites;
+		bytes += mBusBytes - startBytes;
+		polls += mBusPolls - startPolls;
+		busUs += mBusUs - startBus;
+		commitUs += commit;
+
+		if (commit > commitMax)
+			commitMax = commit;
+
+		Board_Read(&board);
+		Sim_Reboot();
+		Board_Read(&loaded);
+
+		if (!Board_Equal(&board, &loaded))
+		{
+			printf("cost %ld: board did not reload\n", n);
+			failures++;
+		}
+	}
+
+	long pageMin = mPrograms[SCORE_ENTRY_ADDRESS / EEPROM_PAGE_SIZE];
+	long pageMax = pageMin;
+
+	for (int i = 0 ; i < SCORE_NUM_PAGES ; i++)
+	{
+		long programs = mPrograms[(SCORE_ENTRY_ADDRESS / EEPROM_PAGE_SIZE) + i];
+
+		if (programs < pageMin)
+			pageMin = programs;
+		if (programs > pageMax)
+			pageMax = programs;
+	}
+
+	printf("insert cost         %ld inserts, each:\n", inserts);
+	printf("  bus writes        %.2f  (%.1f bytes)\n", (double)writes / inserts, (double)bytes / inserts);
+	printf("  ack polls         %.2f\n", (double)polls / inserts);
+	printf("  bus time          %.2f ms\n", (double)busUs / 1000.0 / inserts);
+	printf("  main loop held    %.2f ms over the insert\n", (double)blockedUs / 1000.0 / inserts);
+	printf("  to commit         %.2f ms  (max %.2f ms)\n", (double)commitUs / 1000.0 / inserts, (double)commitMax / 1000.0);
+	printf("  entry page wear   %ld to %ld programs, header slots %ld and %ld\n",
+			pageMin, pageMax, mPrograms[0], mPrograms[1]);
+
+	return failures;
+}
+
+
+////////////////////////////////////////////
+//Power cut every SIM_CUT_STEP_US through each
+//insert, reboot and load the board
+static int TestPowerFail(void)
+{
+	uint8_t saved[EEPROM_SIZE];
+	Board oldBoard, newBoard, loaded;
+	long cuts = 0, oldLoads = 0, newLoads = 0;
+	long headerTears = 0, collisions = 0;
+	int failures = 0;
+
+	memset(mChip, 0xFF, EEPROM_SIZE);
+	Sim_Reboot();
+	srand(2);
+
+	for (long n = 0 ; n < SIM_NUM_POWER_FAIL ; n++)
+	{
+		uint32_t score = NextScore(n);
+		uint8_t level = (uint8_t)(1 + (rand() % 20));
+
+		//the insert without a cut
+		memcpy(saved, mChip, EEPROM_SIZE);
+		Sim_Reboot();
+		Board_Read(&oldBoard);
+		SetInitials(n);
+
+		uint64_t start = mNow;
+
+		if (Score_Insert(score, level) < 0)
+			continue;
+
+		Sim_RunLoop();
+
+		uint64_t headerStart = mHeaderProgramTime - SIM_WRITE_CYCLE_US - start;
+		uint64_t length = mHeaderProgramTime - start;
+		uint8_t committed[EEPROM_SIZE];
+
+		Board_Read(&newBoard);
+		memcpy(committed, mChip, EEPROM_SIZE);
+
+		for (uint64_t cut = 0 ; cut <= length ; cut += SIM_CUT_STEP_US)
+		{
+			memcpy(mChip, saved, EEPROM_SIZE);
+			Sim_Reboot();
+			SetInitials(n);
+
+			start = mNow;
+			mCutTime = start + cut;
+			mCutTorn = -1;
+
+			if (Score_Insert(score, level) >= 0)
+				Sim_RunLoop();
+
+			mCutTime = SIM_NEVER;
+			Sim_Reboot();
+			Board_Read(&loaded);
+			cuts++;
+
+			uint8_t isOld = Board_Equal(&loaded, &oldBoard);
+			uint8_t isNew = Board_Equal(&loaded, &newBoard);
+
+			oldLoads += isOld;
+			newLoads += isNew;
+
+			if ((mCutTorn >= 0) && ((mCutTorn * EEPROM_PAGE_SIZE) < SCORE_ENTRY_ADDRESS))
+			{
+				headerTears++;
+
+				if ((!isOld) && (!isNew))
+					collisions++;
+			}
+			else if (((cut < headerStart) && (!isOld)) || ((cut >= length) && (!isNew)))
+			{
+				printf("power fail %ld: cut at %.2f ms, %d entries loaded\n", n,
+						(double)cut / 1000.0, loaded.count);
+				failures++;
+			}
+		}
+
+		memcpy(mChip, committed, EEPROM_SIZE);
+	}
+
+	printf("power fail          %ld cuts  %ld loaded the old board  %ld the new\n", cuts, oldLoads, newLoads);
+	printf("  torn headers      %ld  %ld loaded neither board\n", headerTears, collisions);
+
+	if (collisions > (headerTears / 256))
+		failures++;
+
+	printf("  failures          %d\n", failures);
+	return failures;
+}
+
+
+int main(void)
+{
+	int failures = 0;
+
+	failures += TestCost();
+	failures += TestPowerFail();
+
+	printf("%s\n", failures ? "FAIL" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,431 @@
+/*////////////////////////////////////////////////////
+Score Slot Test - host tool
+
+Runs the F411 asteroids leaderboard (Game/score.c) on
+the PC over a mocked eeprom - the EEPROM_ api on a
+128 byte array - and checks the two header slots:
+
+- a blank part (0xFF or 0x00) loads as an empty board
+- every commit writes one entry page, then the header
+to the other slot, and the board reloads the same
+after each one, past the 8 bit sequence wrapping
+- with the newest header corrupted the board reloads
+as it was before that commit
+- a write torn after 0 to 7 bytes, for the entry page
+and for the header of an insert, reloads as the board
+before or after the insert, never anything else.  A
+torn header has the sequence of the old header at one
+end and the new one at the other, so it fails even
+when its stale crc8 checks.
+
+The board is checked against a sorted list kept by
+the tool.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_asteroids/Game -I../F411_asteroids/Display \
+-I../F411_asteroids/Bitmap \
+-I../F411_asteroids/F411_asteroids/Inc \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+score_slot_test.c ../F411_asteroids/Game/score.c -o score_slot_test
+
+Use:
+score_slot_test
+
+Returns 0 if every check passes.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "score.h"
+#include "eeprom.h"
+#include "lcd_12864_dfrobot.h"
+
+#define TEST_NUM_INSERTS		600				//header sequence wraps twice
+#define TEST_NUM_TORN			2000
+
+
+////////////////////////////////////////////
+//Mocked eeprom - one async write at a time,
+//done on the next EEPROM_Process or Flush.
+//mCutWrite / mCutBytes tear a write: only the
+//first mCutBytes land and the part loses power,
+//nothing after it is written.
+static uint8_t mMemory[EEPROM_SIZE];
+static uint8_t mPending;
+static uint16_t mPendingAddress;
+static uint8_t mPendingData[EEPROM_SIZE];
+static uint8_t mPendingLength;
+static EEPROM_Callback mPendingCallback;
+static int mLastResult;
+
+static long mNumWrites;
+static uint16_t mWriteAddress[4];			//last writes, oldest first
+static long mCutWrite = -1;
+static int mCutBytes;
+static int mPowerLost;
+
+int EEPROM_readMultiByte(uint16_t address, uint8_t* data, uint8_t len)
+{
+	if ((address + len) > EEPROM_SIZE)
+		return -1;
+
+	memcpy(data, &mMemory[address], len);
+	return 0;
+}
+
+int EEPROM_writeAsync(uint16_t address, const uint8_t* data, uint8_t len, EEPROM_Callback callback)
+{
+	if ((mPending) || (!len) || ((address + len) > EEPROM_SIZE))
+		return -1;
+
+	memcpy(mPendingData, data, len);
+	mPendingAddress = address;
+	mPendingLength = len;
+	mPendingCallback = callback;
+	mPending = 1;
+	return 0;
+}
+
+static void Mock_Complete(void)
+{
+	int result = 0;
+
+	if (!mPending)
+		return;
+
+	mPending = 0;
+
+	if (mPowerLost)
+		result = -1;
+	else
+	{
+		uint8_t length = (mNumWrites == mCutWrite) ? mCutBytes : mPendingLength;
+
+		memcpy(&mMemory[mPendingAddress], mPendingData, length);
+
+		if (mNumWrites == mCutWrite)
+		{
+			mPowerLost = 1;
+			result = -1;
+		}
+
+		memmove(&mWriteAddress[0], &mWriteAddress[1], sizeof(mWriteAddress) - sizeof(mWriteAddress[0]));
+		mWriteAddress[3] = mPendingAddress;
+		mNumWrites++;
+	}
+
+	mLastResult = result;
+
+	if (mPendingCallback)
+		mPendingCallback(result);
+}
+
+void EEPROM_Process(void)
+{
+	Mock_Complete();
+}
+
+uint8_t EEPROM_IsBusy(void)
+{
+	return mPending;
+}
+
+int EEPROM_Flush(void)
+{
+	Mock_Complete();
+	return mLastResult;
+}
+
+
+////////////////////////////////////////////
+//lcd - the display functions are not tested
+void LCD_Clear(uint8_t data)
+{
+	(void)data;
+}
+
+void LCD_DrawStringKern(uint8_t row_initial, uint8_t kern, const char* mystring)
+{
+	(void)row_initial;
+	(void)kern;
+	(void)mystring;
+}
+
+void LCD_DrawStringKernLength(uint8_t row_initial, uint8_t kern, uint8_t* mystring, uint8_t length)
+{
+	(void)row_initial;
+	(void)kern;
+	(void)mystring;
+	(void)length;
+}
+
+
+////////////////////////////////////////////
+//Expected board - sorted high to low, a new
+//score goes below equal ones
+typedef struct
+{
+	int count;
+	ScoreEntry entries[SCORE_NUM_ENTRIES];
+}Board;
+
+static void Board_Insert(Board* board, const char* initials, uint32_t score, uint8_t level)
+{
+	int rank = 0;
+
+	while ((rank < board->count) && (board->entries[rank].score >= score))
+		rank++;
+
+	if (rank >= SCORE_NUM_ENTRIES)
+		return;
+
+	if (board->count == SCORE_NUM_ENTRIES)
+		board->count--;
+
+	memmove(&board->entries[rank + 1], &board->entries[rank], (board->count - rank) * sizeof(ScoreEntry));
+
+	memset(&board->entries[rank], 0x00, sizeof(ScoreEntry));
+	memcpy(board->entries[rank].initials, initials, SCORE_INITIALS_SIZE);
+	board->entries[rank].score = score;
+	board->entries[rank].level = level;
+	board->count++;
+}
+
+////////////////////////////////////////////
+//1 if the board loaded matches board
+static int Board_Match(const Board* board)
+{
+	ScoreEntry entry;
+
+	if (Score_GetNumEntries() != board->count)
+		return 0;
+
+	for (int i = 0 ; i < board->count ; i++)
+	{
+		if ((Score_GetEntry(i, &entry) < 0) ||
+			(memcmp(entry.initials, board->entries[i].initials, SCORE_INITIALS_SIZE)) ||
+			(entry.score != board->entries[i].score) || (entry.level != board->entries[i].level))
+			return 0;
+	}
+
+	return 1;
+}
+
+////////////////////////////////////////////
+//Power up - reload from the part and compare
+static int Board_Check(const Board* board, const char* what, long n)
+{
+	Score_Init();
+
+	if (Board_Match(board))
+		return 0;
+
+	printf("%s %ld: %d entries loaded, expected %d\n", what, n, Score_GetNumEntries(), board->count);
+	return 1;
+}
+
+////////////////////////////////////////////
+//Scores mostly rising, so nearly every insert
+//makes the board and is committed
+static uint32_t NextScore(long n)
+{
+	return (uint32_t)((n * 100) + (rand() % 1000));
+}
+
+static void SetInitials(long n, char* initials)
+{
+	initials[0] = 'A' + (n % 26);
+	initials[1] = 'A' + ((n / 26) % 26);
+	initials[2] = 'A' + ((n / 676) % 26);
+	initials[3] = 0x00;
+	Score_SetPlayerName((uint8_t*)initials, SCORE_INITIALS_SIZE);
+}
+
+
+////////////////////////////////////////////
+//Blank part, either erase value
+static int TestBlank(void)
+{
+	const uint8_t blank[] = {0xFF, 0x00};
+	int failures = 0;
+
+	for (int i = 0 ; i < 2 ; i++)
+	{
+		memset(mMemory, blank[i], EEPROM_SIZE);
+
+		if ((Score_Init() != -1) || (Score_GetNumEntries()) || (Score_GetHighScore()))
+		{
+			printf("blank 0x%02X: not an empty board\n", blank[i]);
+			failures++;
+		}
+	}
+
+	printf("blank part          %d failures\n", failures);
+	return failures;
+}
+
+////////////////////////////////////////////
+//Inserts past the sequence wrap - one entry
+//page and one header per commit, the header
+//slots take turns, reload after each.  Then
+//the newest header is corrupted.
+static int TestSlots(void)
+{
+	static Board history[TEST_NUM_INSERTS + 1];
+	char initials[SCORE_INITIALS_SIZE + 1];
+	int failures = 0;
+
+	memset(mMemory, 0xFF, EEPROM_SIZE);
+	Score_Init();
+	memset(&history[0], 0x00, sizeof(Board));
+
+	srand(1);
+
+	for (long n = 0 ; n < TEST_NUM_INSERTS ; n++)
+	{
+		uint32_t score = NextScore(n);
+		uint8_t level = (uint8_t)(1 + (rand() % 20));
+		long writes = mNumWrites;
+
+		history[n + 1] = history[n];
+		SetInitials(n, initials);
+		Board_Insert(&history[n + 1], initials, score, level);
+
+		if (Score_Insert(score, level) < 0)
+			continue;
+
+		Score_Flush();
+
+		//entry page then a header, other slot than the last
+		if ((mNumWrites - writes) != 2)
+		{
+			printf("insert %ld: %ld writes\n", n, mNumWrites - writes);
+			failures++;
+		}
+		else if ((mWriteAddress[2] < SCORE_ENTRY_ADDRESS) || (mWriteAddress[3] >= SCORE_ENTRY_ADDRESS) ||
+				((n > 0) && (mWriteAddress[3] == mWriteAddress[1])))
+		{
+			printf("insert %ld: wrote 0x%02X then 0x%02X\n", n, mWriteAddress[2], mWriteAddress[3]);
+			failures++;
+		}
+
+		failures += Board_Check(&history[n + 1], "insert", n);
+	}
+
+	//corrupt the newest header, the one before wins
+	{
+		uint8_t saved[EEPROM_SIZE];
+		long n = TEST_NUM_INSERTS - 1;
+
+		memcpy(saved, mMemory, EEPROM_SIZE);
+
+		//back up to the last insert that made the board
+		while ((n > 0) && (!memcmp(&history[n + 1], &history[n], sizeof(Board))))
+			n--;
+
+		mMemory[mWriteAddress[3] + 1] ^= 0x01;
+		failures += Board_Check(&history[n], "old header", n);
+
+		memcpy(mMemory, saved, EEPROM_SIZE);
+		failures += Board_Check(&history[TEST_NUM_INSERTS], "restored", n);
+	}
+
+	printf("slots and wrap      %d inserts  %ld writes  %d failures\n", TEST_NUM_INSERTS, mNumWrites, failures);
+	return failures;
+}
+
+////////////////////////////////////////////
+//Tear the entry page or the header write of an
+//insert after 0 to 7 bytes, reload.  The board
+//must be the one before or after the insert.
+static int TestTorn(void)
+{
+	uint8_t saved[EEPROM_SIZE];
+	char initials[SCORE_INITIALS_SIZE + 1];
+	Board board, newBoard;
+	long cuts = 0;
+	long loadedNew = 0;
+	int failures = 0;
+
+	memset(mMemory, 0xFF, EEPROM_SIZE);
+	memset(&board, 0x00, sizeof(board));
+	Score_Init();
+
+	srand(2);
+
+	for (long n = 0 ; n < TEST_NUM_TORN ; n++)
+	{
+		uint32_t score = NextScore(n);
+		uint8_t level = (uint8_t)(1 + (rand() % 20));
+
+		SetInitials(n, initials);
+		memcpy(saved, mMemory, EEPROM_SIZE);
+
+		newBoard = board;
+		Board_Insert(&newBoard, initials, score, level);
+
+		for (int write = 0 ; write < 2 ; write++)
+		{
+			for (int bytes = 0 ; bytes < SCORE_ENTRY_SIZE ; bytes++)
+			{
+				memcpy(mMemory, saved, EEPROM_SIZE);
+				Score_Init();
+				Score_SetPlayerName((uint8_t*)initials, SCORE_INITIALS_SIZE);
+
+				mCutWrite = mNumWrites + write;
+				mCutBytes = bytes;
+				mPowerLost = 0;
+
+				if (Score_Insert(score, level) >= 0)
+					Score_Flush();
+
+				mCutWrite = -1;
+				mPowerLost = 0;
+				cuts++;
+
+				Score_Init();
+
+				if (Board_Match(&newBoard))
+					loadedNew++;
+				else if (!Board_Match(&board))
+				{
+					printf("torn %ld: write %d cut after %d bytes, %d entries loaded\n", n, write, bytes, Score_GetNumEntries());
+					failures++;
+				}
+			}
+		}
+
+		//now the whole insert
+		memcpy(mMemory, saved, EEPROM_SIZE);
+		Score_Init();
+		Score_SetPlayerName((uint8_t*)initials, SCORE_INITIALS_SIZE);
+
+		if (Score_Insert(score, level) >= 0)
+			Score_Flush();
+
+		board = newBoard;
+		failures += Board_Check(&board, "after torn", n);
+	}
+
+	printf("torn writes         %ld cuts  %ld loaded the new board  %d failures\n", cuts, loadedNew, failures);
+	return failures;
+}
+
+
+int main(void)
+{
+	int failures = 0;
+
+	failures += TestBlank();
+	failures += TestSlots();
+	failures += TestTorn();
+
+	printf("%s\n", failures ? "FAIL" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,363 @@
+/*////////////////////////////////////////////////////
+Shooter Bench - host tool
+
+Runs the F411 space invaders sprites (Game/sprite.c)
+on the PC with the lcd, joystick and sound mocked, and
+checks and times the enemy shooter selection.
+
+Checks, over random kill orders down to an empty
+formation:
+- Sprite_GetShooterEnemy picks an alive enemy with
+nothing alive below it in its column
+- random aim picks every non empty column
+- player aim picks the non empty column nearest the
+player's center, the left one on a tie
+
+Then times a pick against the enemies remaining, for
+the random and the player aim, and for the old
+Sprite_GetRandomEnemy - a random n, then a walk over
+the alive rows to the n-th alive enemy - run over the
+same formation.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_spaceInvaders/Game -I../F411_spaceInvaders/Display \
+-I../F411_spaceInvaders/Bitmap -I../F411_spaceInvaders/Sound \
+-I../F411_spaceInvaders/F411_nucleo/Inc \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/CMSIS/Include \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/STM32F4xx_HAL_Driver/Inc \
+shooter_bench.c ../F411_spaceInvaders/Game/sprite.c \
+../F411_spaceInvaders/Display/lcd_12864_dfrobot.c \
+../F411_spaceInvaders/Display/font_atlas.c ../F411_spaceInvaders/Display/font_table.c \
+../F411_spaceInvaders/Bitmap/enemy1.c ../F411_spaceInvaders/Bitmap/missile1.c \
+../F411_spaceInvaders/Bitmap/player1.c ../F411_spaceInvaders/Bitmap/imgDrone1.c \
+../F411_spaceInvaders/Bitmap/imgDroneExp1.c ../F411_spaceInvaders/Bitmap/imgDroneExp2.c \
+../F411_spaceInvaders/Bitmap/imgDroneExp3.c ../F411_spaceInvaders/Bitmap/imgDroneExp4.c \
+../F411_spaceInvaders/Bitmap/imgPlayerExp1.c ../F411_spaceInvaders/Bitmap/imgPlayerExp2.c \
+../F411_spaceInvaders/Bitmap/imgPlayerExp3.c ../F411_spaceInvaders/Bitmap/imgPlayerExp4.c \
+-o shooter_bench
+
+Use:
+shooter_bench
+
+Returns 0 if every pick checks.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "spi.h"
+#include "gpio.h"
+#include "sprite.h"
+#include "joystick.h"
+#include "bitmap.h"
+#include "Sound.h"
+
+#define TEST_NUM_ORDERS		2000
+#define TEST_NUM_PICKS		200				//random aim picks per formation
+#define BENCH_NUM_PICKS		10000000
+
+
+////////////////////////////////////////////
+//Mocked peripherals, joystick and sound
+SPI_HandleTypeDef hspi1;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+	(void)GPIOx;
+	(void)GPIO_Init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+	(void)PinState;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	(void)Timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+	(void)hspi;
+	return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return 0;
+}
+
+uint8_t Joystick_GetEvent(JoystickEvent* event)
+{
+	(void)event;
+	return 0;
+}
+
+void Sound_Play_PlayerFire(void) {}
+void Sound_Play_EnemyFire(void) {}
+void Sound_Play_PlayerExplode(void) {}
+void Sound_Play_EnemyExplode(void) {}
+void Sound_Play_LevelUp(void) {}
+
+
+////////////////////////////////////////////
+//Formation kept by the tool, same layout as
+//the sprites - bit col of alive[row]
+static uint16_t mAlive[NUM_ENEMY_ROWS];
+static uint8_t mOrder[NUM_ENEMY];
+
+static void Formation_Init(void)
+{
+	Sprite_Init();
+
+	for (int i = 0 ; i < NUM_ENEMY_ROWS ; i++)
+		mAlive[i] = (uint16_t)((1u << NUM_ENEMY_COLS) - 1);
+
+	//random kill order
+	for (int i = 0 ; i < NUM_ENEMY ; i++)
+		mOrder[i] = (uint8_t)i;
+
+	for (int i = NUM_ENEMY - 1 ; i > 0 ; i--)
+	{
+		int j = rand() % (i + 1);
+		uint8_t temp = mOrder[i];
+		mOrder[i] = mOrder[j];
+		mOrder[j] = temp;
+	}
+}
+
+static void Formation_Kill(int index)
+{
+	mAlive[index / NUM_ENEMY_COLS] &= ~(1u << (index % NUM_ENEMY_COLS));
+	Sprite_Score_EnemyHit((uint8_t)index, 0);
+}
+
+static int Formation_IsAlive(int row, int col)
+{
+	return (mAlive[row] >> col) & 0x01;
+}
+
+static int Formation_ColumnAlive(int col)
+{
+	for (int row = 0 ; row < NUM_ENEMY_ROWS ; row++)
+	{
+		if (Formation_IsAlive(row, col))
+			return 1;
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////
+//Old Sprite_GetRandomEnemy - n-th alive
+//enemy, n random
+static int Old_GetRandomEnemy(int numEnemy)
+{
+	if (numEnemy > 0)
+	{
+		int index = rand() % numEnemy;
+		int counter = 0;
+
+		for (int i = 0 ; i < NUM_ENEMY_ROWS ; i++)
+		{
+			uint16_t alive = mAlive[i];
+
+			while (alive)
+			{
+				int col = __builtin_ctz(alive);
+
+				if (index == counter)
+					return (i * NUM_ENEMY_COLS) + col;
+
+				counter++;
+				alive &= alive - 1;
+			}
+		}
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////
+//Player aim reference - every column by its
+//distance from the player's center
+static int Aim_Reference(void)
+{
+	int center = PLAYER_DEFAULT_X + (imagePlayer1.xSize / 2);
+	int target = center / imageEnemy1.xSize;
+
+	if (target > (NUM_ENEMY_COLS - 1))
+		target = NUM_ENEMY_COLS - 1;
+
+	for (int distance = 0 ; distance < NUM_ENEMY_COLS ; distance++)
+	{
+		if ((target - distance >= 0) && (Formation_ColumnAlive(target - distance)))
+			return target - distance;
+		if ((target + distance < NUM_ENEMY_COLS) && (Formation_ColumnAlive(target + distance)))
+			return target + distance;
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////
+//1 if index is alive with nothing alive
+//below it in the column
+static int Shooter_Check(int index)
+{
+	int row = index / NUM_ENEMY_COLS;
+	int col = index % NUM_ENEMY_COLS;
+
+	if ((index < 0) || (index >= NUM_ENEMY) || (!Formation_IsAlive(row, col)))
+		return 0;
+
+	for (int below = row + 1 ; below < NUM_ENEMY_ROWS ; below++)
+	{
+		if (Formation_IsAlive(below, col))
+			return 0;
+	}
+
+	return 1;
+}
+
+
+static int TestShooter(void)
+{
+	long picks = 0;
+	int failures = 0;
+
+	for (long n = 0 ; n < TEST_NUM_ORDERS ; n++)
+	{
+		Formation_Init();
+
+		for (int kill = 0 ; kill <= NUM_ENEMY ; kill++)
+		{
+			int numEnemy = NUM_ENEMY - kill;
+			uint16_t columns = 0x00;
+			uint16_t picked = 0x00;
+
+			for (int col = 0 ; col < NUM_ENEMY_COLS ; col++)
+				columns |= Formation_ColumnAlive(col) << col;
+
+			if (!numEnemy)
+			{
+				if ((Sprite_GetShooterEnemy(SPRITE_AIM_RANDOM) != -1) || (Sprite_GetShooterEnemy(SPRITE_AIM_PLAYER) != -1))
+				{
+					printf("order %ld: shooter with no enemy\n", n);
+					failures++;
+				}
+				break;
+			}
+
+			for (int i = 0 ; i < TEST_NUM_PICKS ; i++)
+			{
+				int index = Sprite_GetShooterEnemy(SPRITE_AIM_RANDOM);
+
+				if (!Shooter_Check(index))
+				{
+					printf("order %ld, %d left: random shooter %d\n", n, numEnemy, index);
+					failures++;
+					break;
+				}
+
+				picked |= 1u << (index % NUM_ENEMY_COLS);
+				picks++;
+			}
+
+			if (picked != columns)
+			{
+				printf("order %ld, %d left: columns 0x%02X of 0x%02X picked\n", n, numEnemy, picked, columns);
+				failures++;
+			}
+
+			int index = Sprite_GetShooterEnemy(SPRITE_AIM_PLAYER);
+
+			if ((!Shooter_Check(index)) || ((index % NUM_ENEMY_COLS) != Aim_Reference()))
+			{
+				printf("order %ld, %d left: aimed shooter %d, column %d expected\n", n, numEnemy, index, Aim_Reference());
+				failures++;
+			}
+
+			picks++;
+			Formation_Kill(mOrder[kill]);
+		}
+
+		if (failures > 10)
+			break;
+	}
+
+	printf("shooter checks      %ld picks  %d failures\n", picks, failures);
+	return failures;
+}
+
+
+////////////////////////////////////////////
+//ns per pick against enemies remaining
+static void BenchShooter(void)
+{
+	volatile int sink = 0;
+
+	printf("enemies   old walk ns   random ns   player aim ns\n");
+
+	Formation_Init();
+
+	for (int kill = 0 ; kill < NUM_ENEMY ; kill++)
+	{
+		int numEnemy = NUM_ENEMY - kill;
+		double ns[3];
+
+		for (int pass = 0 ; pass < 3 ; pass++)
+		{
+			clock_t start = clock();
+
+			for (long i = 0 ; i < BENCH_NUM_PICKS ; i++)
+			{
+				switch (pass)
+				{
+					case 0:		sink += Old_GetRandomEnemy(numEnemy);						break;
+					case 1:		sink += Sprite_GetShooterEnemy(SPRITE_AIM_RANDOM);			break;
+					default:	sink += Sprite_GetShooterEnemy(SPRITE_AIM_PLAYER);			break;
+				}
+			}
+
+			ns[pass] = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_NUM_PICKS;
+		}
+
+		printf("%7d   %11.1f   %9.1f   %13.1f\n", numEnemy, ns[0], ns[1], ns[2]);
+		Formation_Kill(mOrder[kill]);
+	}
+}
+
+
+int main(void)
+{
+	int failures = 0;
+
+	srand(1);
+
+	failures += TestShooter();
+	BenchShooter();
+
+	printf("%s\n", failures ? "FAIL" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,304 @@
+/*////////////////////////////////////////////////////
+Sound Resample Test - host tool
+
+Runs the F429 astroids sound engine (Sound.c, included
+so the tool can reach the sounds, and the asteroids
+asset pack) on the PC with the DAC and TIM7 mocked,
+and checks every DAC write against a float reference:
+
+- each sound alone at pitches from SOUND_PITCH_MIN to
+SOUND_PITCH_MAX in 1/16 steps
+- two voices mixed, thruster and effect at different
+pitches
+- Sound_SetVoicePitch part way through a sound keeps
+the phase
+
+The reference is the same Q16.16 phase (so the same
+rate), with the full 16 bit fraction, signed samples,
+a float blend and the 0x80 bias at the output.  The
+engine may be off by 1 LSB per voice from truncating
+the blend.
+
+Also prints the host time per isr call.  Cycle counts
+on the M4 need the board: define SOUND_PROFILE_CYCLES
+and read Sound_GetISRCycles.
+
+The --defsym options put _sassetpack and _eassetpack
+around the .assetpack section, the same as the target
+linker scripts, so Sound_Init opens the pack with
+AssetPack_OpenLinked.
+
+Build (from Source/Tools):
+gcc -O2 -Wall -Wextra -DSTM32F429xx -DUSE_HAL_DRIVER \
+-I../astroids/Sound -I../AssetPack -I../AssetPack/Packs \
+-I../astroids/cube/astroids/Inc \
+-I../astroids/cube/astroids/Drivers/CMSIS/Include \
+-I../astroids/cube/astroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../astroids/cube/astroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+sound_resample_test.c ../AssetPack/AssetPack.c ../AssetPack/Packs/asteroids.c \
+'-Wl,--defsym=_sassetpack=ADDR(.assetpack)' \
+'-Wl,--defsym=_eassetpack=ADDR(.assetpack)+SIZEOF(.assetpack)' \
+-o sound_resample_test
+
+Use:
+sound_resample_test
+
+Returns 0 if every write is within 1 LSB per voice.
+
+*/////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "Sound.c"
+
+#define TEST_MAX_ERROR		1				//per voice
+
+
+////////////////////////////////////////////
+//Mocked peripherals - the dac keeps the last
+//value written, the timer is just a flag
+DAC_HandleTypeDef hdac;
+TIM_HandleTypeDef htim7;
+
+static uint32_t mDacValue;
+static int mTimerRunning;
+
+HAL_StatusTypeDef HAL_DAC_Start(DAC_HandleTypeDef* hdac, uint32_t Channel)
+{
+	(void)hdac;
+	(void)Channel;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_SetValue(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t Alignment, uint32_t Data)
+{
+	(void)hdac;
+	(void)Channel;
+	(void)Alignment;
+	mDacValue = Data;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+	(void)htim;
+	mTimerRunning = 1;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+	(void)htim;
+	mTimerRunning = 0;
+	return HAL_OK;
+}
+
+
+////////////////////////////////////////////
+//Reference voice - same Q16.16 phase as the
+//engine, float blend
+typedef struct
+{
+	const SoundData* sound;
+	uint32_t phase;
+	uint32_t step;
+	int active;
+}RefVoice;
+
+static uint32_t GetStep(const SoundData* sound, uint32_t pitch)
+{
+	uint32_t unity = (uint32_t)(((uint64_t)sound->sampleRate << 16) / SOUND_OUTPUT_RATE_HZ);
+	return (uint32_t)(((uint64_t)unity * pitch) >> 16);
+}
+
+static double RefVoice_Next(RefVoice* voice)
+{
+	if (!voice->active)
+		return 0.0;
+
+	uint32_t index = voice->phase >> 16;
+
+	if (index + 1 >= voice->sound->length)
+	{
+		voice->active = 0;
+		return 0.0;
+	}
+
+	double s0 = (int8_t)voice->sound->soundData[index];
+	double s1 = (int8_t)voice->sound->soundData[index + 1];
+	double frac = (voice->phase & 0xFFFF) / 65536.0;
+
+	voice->phase += voice->step;
+
+	return s0 + ((s1 - s0) * frac);
+}
+
+static double Ref_Output(double mix)
+{
+	mix += 0x80;
+
+	if (mix < 0.0)
+		return 0.0;
+	if (mix > 255.0)
+		return 255.0;
+	return mix;
+}
+
+
+typedef struct
+{
+	long samples;
+	double maxError;
+	long failures;
+}TestResult;
+
+////////////////////////////////////////////
+//Run the engine until the timer stops, compare
+//every write.  pitchAt/newPitch retune voice 0
+//after pitchAt samples (0 = never).
+static void RunTest(RefVoice* ref, int numVoices, long pitchAt, uint32_t newPitch, TestResult* result)
+{
+	long n = 0;
+
+	while (mTimerRunning)
+	{
+		if ((pitchAt) && (n == pitchAt))
+		{
+			uint8_t voice = (ref[0].sound == &sound_thruster) ? SOUND_VOICE_THRUSTER : SOUND_VOICE_EFFECT;
+			Sound_SetVoicePitch(voice, newPitch);
+			ref[0].step = GetStep(ref[0].sound, newPitch);
+		}
+
+		double mix = 0.0;
+		int active = 0;
+
+		for (int i = 0 ; i < numVoices ; i++)
+		{
+			mix += RefVoice_Next(&ref[i]);
+			active |= ref[i].active;
+		}
+
+		Sound_InterruptHandler();
+
+		//last isr stops the timer and writes 0
+		if (!mTimerRunning)
+		{
+			if (active)
+				result->failures++;
+			break;
+		}
+
+		double error = (double)mDacValue - Ref_Output(mix);
+
+		if (error < 0)
+			error = -error;
+
+		if (error > result->maxError)
+			result->maxError = error;
+
+		if (error > (TEST_MAX_ERROR * numVoices))
+			result->failures++;
+
+		result->samples++;
+		n++;
+	}
+}
+
+
+int main(void)
+{
+	const SoundData* sounds[] = {&sound_levelUp, &sound_enemyExplode, &sound_playerExplode,
+								&sound_playerShoot, &sound_thruster};
+	const char* names[] = {"levelUp", "enemyExplode", "playerExplode", "playerShoot", "thruster"};
+	const int numSounds = sizeof(sounds) / sizeof(sounds[0]);
+	int result = 0;
+
+	Sound_Init();
+
+	//each sound alone over the pitch range
+	for (int s = 0 ; s < numSounds ; s++)
+	{
+		TestResult test = {0, 0.0, 0};
+
+		for (uint32_t pitch = SOUND_PITCH_MIN ; pitch <= SOUND_PITCH_MAX ; pitch += (SOUND_PITCH_UNITY >> 4))
+		{
+			RefVoice ref = {sounds[s], 0, GetStep(sounds[s], pitch), 1};
+			Sound_PlaySoundPitch(sounds[s], SOUND_VOICE_EFFECT, pitch);
+			RunTest(&ref, 1, 0, 0, &test);
+		}
+
+		printf("%-14s %8ld samples  max error %.3f  %ld failures\n", names[s], test.samples, test.maxError, test.failures);
+
+		if (test.failures)
+			result = 1;
+	}
+
+	//two voices
+	{
+		TestResult test = {0, 0.0, 0};
+
+		for (int s = 0 ; s < numSounds - 1 ; s++)
+		{
+			for (uint32_t pitch = SOUND_PITCH_MIN ; pitch <= SOUND_PITCH_MAX ; pitch += (SOUND_PITCH_UNITY >> 2))
+			{
+				uint32_t thrustPitch = SOUND_PITCH_MAX + SOUND_PITCH_MIN - pitch;
+				RefVoice ref[2] = {{sounds[s], 0, GetStep(sounds[s], pitch), 1},
+								{&sound_thruster, 0, GetStep(&sound_thruster, thrustPitch), 1}};
+
+				Sound_PlaySoundPitch(sounds[s], SOUND_VOICE_EFFECT, pitch);
+				Sound_PlaySoundPitch(&sound_thruster, SOUND_VOICE_THRUSTER, thrustPitch);
+				RunTest(ref, 2, 0, 0, &test);
+			}
+		}
+
+		printf("%-14s %8ld samples  max error %.3f  %ld failures\n", "two voices", test.samples, test.maxError, test.failures);
+
+		if (test.failures)
+			result = 1;
+	}
+
+	//retune part way through
+	{
+		TestResult test = {0, 0.0, 0};
+
+		for (uint32_t pitch = SOUND_PITCH_MIN ; pitch <= SOUND_PITCH_MAX ; pitch += (SOUND_PITCH_UNITY >> 2))
+		{
+			RefVoice ref = {&sound_thruster, 0, GetStep(&sound_thruster, SOUND_PITCH_UNITY), 1};
+			Sound_PlaySoundPitch(&sound_thruster, SOUND_VOICE_THRUSTER, SOUND_PITCH_UNITY);
+			RunTest(&ref, 1, 1000, pitch, &test);
+		}
+
+		printf("%-14s %8ld samples  max error %.3f  %ld failures\n", "set pitch", test.samples, test.maxError, test.failures);
+
+		if (test.failures)
+			result = 1;
+	}
+
+	//host time per isr, both voices busy
+	{
+		const long numCalls = 20000000;
+		long calls = 0;
+		clock_t start = clock();
+
+		while (calls < numCalls)
+		{
+			Sound_PlaySoundPitch(&sound_playerExplode, SOUND_VOICE_EFFECT, SOUND_PITCH_UNITY + 0x1234);
+			Sound_PlaySoundPitch(&sound_thruster, SOUND_VOICE_THRUSTER, SOUND_PITCH_UNITY - 0x1234);
+
+			while ((mTimerRunning) && (calls < numCalls))
+			{
+				Sound_InterruptHandler();
+				calls++;
+			}
+		}
+
+		double ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / numCalls;
+		printf("host isr time  %.1f ns per call, two voices\n", ns);
+	}
+
+	printf("%s\n", result ? "FAIL" : "ok");
+	return result;
+}
@@ -0,0 +1,511 @@
+/*////////////////////////////////////////////////////
+Sprite Mask Test - host tool
+
+Runs the collision tests of the F411 asteroids or
+space invaders sprites (Game/sprite.c, included so the
+tool can reach the static tests) on the PC with the
+lcd, joystick and sound mocked, against a brute force
+reference that compares the image pixels one by one.
+
+- every mask row matches the pixels of its image, and
+is clear past the image width
+- Sprite_MaskOverlap for every pair of images in the
+game at every offset from -40 to 40 on each axis
+- asteroids: Sprite_Player_Collide for random images
+at random places on the lcd, pixels wrapped around
+the edges
+- invaders: Sprite_Missle_Move for a player missile at
+random places over a random formation, the enemy hit
+must be the live enemy with a pixel under the missile.
+With the gaps in the enemy image a missile touches one
+enemy at most, the reference takes the lowest one.
+
+Then times Sprite_MaskOverlap against a bounding box
+test and the reference over the same pairs.
+
+Asteroids sprite.c has an unused variable and a sign
+compare that -Wall -Wextra warn on, invaders sprite.c
+has an unused variable - those are from the game.
+
+Build asteroids (from Source/Tools):
+gcc -O2 -Wall -Wextra -DMASK_TEST_ASTEROIDS -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_asteroids/Game -I../F411_asteroids/Display \
+-I../F411_asteroids/Bitmap -I../F411_asteroids/Sound \
+-I../F411_asteroids/F411_asteroids/Inc \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_asteroids/F411_asteroids/Drivers/STM32F4xx_HAL_Driver/Inc \
+sprite_mask_test.c ../F411_asteroids/Display/lcd_12864_dfrobot.c \
+../F411_asteroids/Display/font_atlas.c ../F411_asteroids/Display/font_table.c \
+../F411_asteroids/Bitmap/img*.c ../F411_asteroids/Bitmap/enemy1.c \
+-o sprite_mask_asteroids
+
+Build invaders (from Source/Tools):
+gcc -O2 -Wall -Wextra -DMASK_TEST_INVADERS -DSTM32F411xE -DUSE_HAL_DRIVER \
+-I../F411_spaceInvaders/Game -I../F411_spaceInvaders/Display \
+-I../F411_spaceInvaders/Bitmap -I../F411_spaceInvaders/Sound \
+-I../F411_spaceInvaders/F411_nucleo/Inc \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/CMSIS/Include \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/CMSIS/Device/ST/STM32F4xx/Include \
+-I../F411_spaceInvaders/F411_nucleo/Drivers/STM32F4xx_HAL_Driver/Inc \
+sprite_mask_test.c ../F411_spaceInvaders/Display/lcd_12864_dfrobot.c \
+../F411_spaceInvaders/Display/font_atlas.c ../F411_spaceInvaders/Display/font_table.c \
+../F411_spaceInvaders/Bitmap/img*.c ../F411_spaceInvaders/Bitmap/enemy1.c \
+../F411_spaceInvaders/Bitmap/missile1.c ../F411_spaceInvaders/Bitmap/player1.c \
+-o sprite_mask_invaders
+
+Use:
+sprite_mask_asteroids
+sprite_mask_invaders
+
+Returns 0 if every test matches the reference.
+
+*/////////////////////////////////////////////////////
+#include <time.h>
+
+#include "spi.h"
+#include "gpio.h"
+#include "sprite.c"
+
+#define TEST_RANGE				40				//offsets -40 to 39
+#define TEST_NUM_PLACES			2000000
+#define BENCH_NUM_PAIRS			2000
+
+
+#ifdef MASK_TEST_ASTEROIDS
+static const ImageData* const mImages[] =
+{
+	&imageEnemy1,
+	&bmimgAsteroidLGBmp, &bmimgAsteroidMDBmp, &bmimgAsteroidSMBmp,
+	&bmimgDroneLGBmp, &bmimgDroneLGExp1Bmp, &bmimgDroneLGExp2Bmp, &bmimgDroneLGExp3Bmp,
+	&bmimgDroneLGExp4Bmp, &bmimgDroneLGExp5Bmp, &bmimgDroneLGExp6Bmp,
+	&bmimgDroneMDBmp, &bmimgDroneMDExp1Bmp, &bmimgDroneMDExp2Bmp, &bmimgDroneMDExp3Bmp,
+	&bmimgDroneMDExp4Bmp, &bmimgDroneMDExp5Bmp, &bmimgDroneMDExp6Bmp,
+	&bmimgDroneSMBmp, &bmimgDroneSMExp1Bmp, &bmimgDroneSMExp2Bmp, &bmimgDroneSMExp3Bmp,
+	&bmimgDroneSMExp4Bmp, &bmimgDroneSMExp5Bmp, &bmimgDroneSMExp6Bmp,
+	&bmimgPlayer0Bmp, &bmimgPlayer26Bmp, &bmimgPlayer45Bmp, &bmimgPlayer63Bmp,
+	&bmimgPlayer90Bmp, &bmimgPlayer116Bmp, &bmimgPlayer135Bmp, &bmimgPlayer153Bmp,
+	&bmimgPlayer180Bmp, &bmimgPlayer206Bmp, &bmimgPlayer225Bmp, &bmimgPlayer243Bmp,
+	&bmimgPlayer270Bmp, &bmimgPlayer296Bmp, &bmimgPlayer315Bmp, &bmimgPlayer333Bmp,
+	&bmimgPlayerExp1Bmp, &bmimgPlayerExp2Bmp, &bmimgPlayerExp3Bmp,
+	&bmimgPlayerExp4Bmp, &bmimgPlayerExp5Bmp, &bmimgPlayerExp6Bmp,
+};
+#else
+static const ImageData* const mImages[] =
+{
+	&imagePlayer1, &imageEnemy1, &imageMissile1,
+	&bmimgDrone1Bmp,
+	&bmimgPlayerExp1Bmp, &bmimgPlayerExp2Bmp, &bmimgPlayerExp3Bmp, &bmimgPlayerExp4Bmp,
+	&bmimgDroneExp1Bmp, &bmimgDroneExp2Bmp, &bmimgDroneExp3Bmp, &bmimgDroneExp4Bmp,
+};
+#endif
+
+#define TEST_NUM_IMAGES			((int)(sizeof(mImages) / sizeof(mImages[0])))
+
+
+////////////////////////////////////////////
+//Mocked peripherals, joystick and sound
+SPI_HandleTypeDef hspi1;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+	(void)GPIOx;
+	(void)GPIO_Init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+	(void)PinState;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	(void)Timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+	(void)hspi;
+	return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return 0;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	(void)Delay;
+}
+
+uint8_t Joystick_GetEvent(JoystickEvent* event)
+{
+	(void)event;
+	return 0;
+}
+
+void Sound_Play_PlayerFire(void) {}
+void Sound_Play_EnemyFire(void) {}
+void Sound_Play_PlayerExplode(void) {}
+void Sound_Play_EnemyExplode(void) {}
+void Sound_Play_LevelUp(void) {}
+void Sound_Play_GameOver(void) {}
+
+#ifdef MASK_TEST_ASTEROIDS
+void Sound_Play_Thruster(void) {}
+#endif
+
+
+////////////////////////////////////////////
+//Reference - pixel x, y of an image, and
+//every pixel of b at dx, dy against a
+static int Image_Pixel(const ImageData* image, int x, int y)
+{
+	return (image->pImageData[(y * image->bytesPerLine) + (x >> 3)] >> (7 - (x & 0x07))) & 0x01;
+}
+
+static int Reference_Overlap(const ImageData* a, const ImageData* b, int dx, int dy)
+{
+	for (int y = 0 ; y < a->ySize ; y++)
+	{
+		for (int x = 0 ; x < a->xSize ; x++)
+		{
+			int bx = x - dx;
+			int by = y - dy;
+
+			if ((bx < 0) || (by < 0) || (bx >= b->xSize) || (by >= b->ySize))
+				continue;
+
+			if ((Image_Pixel(a, x, y)) && (Image_Pixel(b, bx, by)))
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int Box_Overlap(const ImageData* a, const ImageData* b, int dx, int dy)
+{
+	return ((dx < a->xSize) && (dy < a->ySize) && ((dx + b->xSize) > 0) && ((dy + b->ySize) > 0));
+}
+
+
+static int TestMasks(void)
+{
+	int failures = 0;
+
+	for (int i = 0 ; i < TEST_NUM_IMAGES ; i++)
+	{
+		const ImageData* image = mImages[i];
+
+		if (!image->pMask)
+		{
+			printf("image %d: no mask\n", i);
+			failures++;
+			continue;
+		}
+
+		for (int y = 0 ; y < image->ySize ; y++)
+		{
+			uint32_t row = 0x00;
+
+			for (int x = 0 ; x < image->xSize ; x++)
+				row |= (uint32_t)Image_Pixel(image, x, y) << (31 - x);
+
+			if (image->pMask[y] != row)
+			{
+				printf("image %d row %d: mask 0x%08lX, pixels 0x%08lX\n", i, y,
+						(unsigned long)image->pMask[y], (unsigned long)row);
+				failures++;
+			}
+		}
+	}
+
+	printf("masks               %d images  %d failures\n", TEST_NUM_IMAGES, failures);
+	return failures;
+}
+
+
+static int TestPairs(void)
+{
+	long cases = 0, hits = 0, boxes = 0;
+	int failures = 0;
+
+	for (int i = 0 ; i < TEST_NUM_IMAGES ; i++)
+	{
+		for (int j = 0 ; j < TEST_NUM_IMAGES ; j++)
+		{
+			for (int dy = -TEST_RANGE ; dy < TEST_RANGE ; dy++)
+			{
+				for (int dx = -TEST_RANGE ; dx < TEST_RANGE ; dx++)
+				{
+					int expected = Reference_Overlap(mImages[i], mImages[j], dx, dy);
+
+					if (Sprite_MaskOverlap(mImages[i], mImages[j], dx, dy) != expected)
+					{
+						if (failures < 10)
+							printf("images %d, %d at %d, %d: expected %d\n", i, j, dx, dy, expected);
+						failures++;
+					}
+
+					cases++;
+					hits += expected;
+					boxes += Box_Overlap(mImages[i], mImages[j], dx, dy);
+				}
+			}
+		}
+	}
+
+	printf("mask overlap        %ld cases  %ld boxes  %ld pixel hits  %d failures\n", cases, boxes, hits, failures);
+	return failures;
+}
+
+
+#ifdef MASK_TEST_ASTEROIDS
+////////////////////////////////////////////
+//Player collide - images anywhere on the lcd,
+//pixels wrapped around the edges
+static int Reference_Wrapped(const ImageData* image, uint32_t x, uint32_t y)
+{
+	static uint8_t screen[LCD_HEIGHT][LCD_WIDTH];
+	int result = 0;
+
+	memset(screen, 0x00, sizeof(screen));
+
+	for (int py = 0 ; py < mPlayer.image->ySize ; py++)
+	{
+		for (int px = 0 ; px < mPlayer.image->xSize ; px++)
+		{
+			if (Image_Pixel(mPlayer.image, px, py))
+				screen[(mPlayer.y + py) % LCD_HEIGHT][(mPlayer.x + px) % LCD_WIDTH] = 1;
+		}
+	}
+
+	for (int iy = 0 ; (iy < image->ySize) && (!result) ; iy++)
+	{
+		for (int ix = 0 ; ix < image->xSize ; ix++)
+		{
+			if ((Image_Pixel(image, ix, iy)) && (screen[(y + iy) % LCD_HEIGHT][(x + ix) % LCD_WIDTH]))
+			{
+				result = 1;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+static int TestGame(void)
+{
+	long hits = 0;
+	int failures = 0;
+
+	for (long n = 0 ; n < (TEST_NUM_PLACES / 10) ; n++)
+	{
+		const ImageData* image = mImages[rand() % TEST_NUM_IMAGES];
+		uint32_t x = rand() % LCD_WIDTH;
+		uint32_t y = rand() % LCD_HEIGHT;
+
+		mPlayer.image = mImages[25 + (rand() % 16)];		//a player rotation
+		mPlayer.x = rand() % LCD_WIDTH;
+		mPlayer.y = rand() % LCD_HEIGHT;
+
+		int expected = Reference_Wrapped(image, x, y);
+
+		if (Sprite_Player_Collide(image, x, y) != expected)
+		{
+			if (failures < 10)
+				printf("player at %lu, %lu, image at %lu, %lu: expected %d\n", (unsigned long)mPlayer.x,
+						(unsigned long)mPlayer.y, (unsigned long)x, (unsigned long)y, expected);
+			failures++;
+		}
+
+		hits += expected;
+	}
+
+	printf("player collide      %d places  %ld hits  %d failures\n", TEST_NUM_PLACES / 10, hits, failures);
+	return failures;
+}
+
+#else
+////////////////////////////////////////////
+//Formation hit - one player missile over a
+//random formation, moved once
+static int Reference_Formation(int32_t missileX, int32_t missileY)
+{
+	for (int row = NUM_ENEMY_ROWS - 1 ; row >= 0 ; row--)
+	{
+		for (int col = 0 ; col < NUM_ENEMY_COLS ; col++)
+		{
+			int32_t dx = missileX - (mFormation.x + (col * (int32_t)mFormation.pitchX));
+			int32_t dy = missileY - (mFormation.y + (row * (int32_t)mFormation.pitchY));
+
+			if ((mFormation.alive[row] & (1u << col)) &&
+					(Reference_Overlap(mFormation.image, mPlayerMissile[0].image, dx, dy)))
+				return (row * NUM_ENEMY_COLS) + col;
+		}
+	}
+
+	return -1;
+}
+
+static int TestGame(void)
+{
+	long hits = 0;
+	int failures = 0;
+
+	for (long n = 0 ; n < TEST_NUM_PLACES ; n++)
+	{
+		Sprite_Init();
+		mDrone.life = 0;
+
+		//at least two alive, a hit never clears the level
+		do
+		{
+			mFormation.numAlive = 0;
+
+			for (int row = 0 ; row < NUM_ENEMY_ROWS ; row++)
+			{
+				mFormation.alive[row] = (uint16_t)(rand() & ((1u << NUM_ENEMY_COLS) - 1));
+				mFormation.numAlive += __builtin_popcount(mFormation.alive[row]);
+			}
+		}while (mFormation.numAlive < 2);
+
+		mFormation.columns = 0x00;
+
+		for (int col = 0 ; col < NUM_ENEMY_COLS ; col++)
+		{
+			mFormation.lowest[col] = -1;
+
+			for (int row = 0 ; row < NUM_ENEMY_ROWS ; row++)
+			{
+				if (mFormation.alive[row] & (1u << col))
+				{
+					mFormation.lowest[col] = row;
+					mFormation.columns |= 1u << col;
+				}
+			}
+		}
+
+		mFormation.x = rand() % 40;
+		mFormation.y = SPRITE_MIN_Y + (rand() % 20);
+
+		//missile ends the move at x, y
+		int32_t x = rand() % LCD_WIDTH;
+		int32_t y = SPRITE_MIN_Y + 1 + (rand() % (LCD_HEIGHT - SPRITE_MIN_Y - 1));
+		uint16_t before[NUM_ENEMY_ROWS];
+
+		mPlayerMissile[0].life = 1;
+		mPlayerMissile[0].x = x;
+		mPlayerMissile[0].y = y + 2;
+
+		int expected = Reference_Formation(x, y);
+		int result = -1;
+
+		memcpy(before, mFormation.alive, sizeof(before));
+		Sprite_Missle_Move();
+
+		for (int row = 0 ; row < NUM_ENEMY_ROWS ; row++)
+		{
+			uint16_t killed = before[row] & ~mFormation.alive[row];
+
+			if (killed)
+				result = (result < 0) ? ((row * NUM_ENEMY_COLS) + __builtin_ctz(killed)) : NUM_ENEMY;
+		}
+
+		if (result != expected)
+		{
+			if (failures < 10)
+				printf("missile at %ld, %ld, formation at %ld, %ld: hit %d, expected %d\n", (long)x, (long)y,
+						(long)mFormation.x, (long)mFormation.y, result, expected);
+			failures++;
+		}
+
+		hits += (expected >= 0);
+	}
+
+	printf("formation hit       %d places  %ld hits  %d failures\n", TEST_NUM_PLACES, hits, failures);
+	return failures;
+}
+#endif
+
+
+////////////////////////////////////////////
+//ns per test over the pairs that touch
+static void BenchPairs(void)
+{
+	volatile int sink = 0;
+	double ns[3];
+	long count = 0;
+
+	for (int pass = 0 ; pass < 3 ; pass++)
+	{
+		clock_t start = clock();
+		count = 0;
+
+		for (int n = 0 ; n < BENCH_NUM_PAIRS ; n++)
+		{
+			const ImageData* a = mImages[n % TEST_NUM_IMAGES];
+
+			for (int j = 0 ; j < TEST_NUM_IMAGES ; j++)
+			{
+				const ImageData* b = mImages[j];
+
+				for (int dy = -b->ySize + 1 ; dy < a->ySize ; dy += 3)
+				{
+					for (int dx = -b->xSize + 1 ; dx < a->xSize ; dx += 3)
+					{
+						switch (pass)
+						{
+							case 0:		sink += Box_Overlap(a, b, dx, dy);				break;
+							case 1:		sink += Sprite_MaskOverlap(a, b, dx, dy);		break;
+							default:	sink += Reference_Overlap(a, b, dx, dy);		break;
+						}
+
+						count++;
+					}
+				}
+			}
+
+			//the reference is slow, fewer rounds
+			if ((pass == 2) && (n >= (BENCH_NUM_PAIRS / 20)))
+				break;
+		}
+
+		ns[pass] = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / count;
+	}
+
+	printf("ns per test         box %.1f  mask %.1f  pixel reference %.1f\n", ns[0], ns[1], ns[2]);
+}
+
+
+int main(void)
+{
+	int failures = 0;
+
+	srand(1);
+
+	failures += TestMasks();
+	failures += TestPairs();
+	failures += TestGame();
+	BenchPairs();
+
+	printf("%s\n", failures ? "FAIL" : "ok");
+	return failures ? 1 : 0;
+}
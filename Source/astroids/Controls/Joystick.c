@@ -23,99 +23,259 @@ CENTER PUSH - Interrupt falling edge on PE2
 
 #include "Sprite.h"
 
-static volatile uint32_t adcRawData[2] = {0x00, 0x00};	//raw reading
+//circular dma buffer - channel samples interleaved in rank order
+static volatile uint32_t adcBuffer[JOYSTICK_OVERSAMPLE * JOYSTICK_NUM_CHANNELS];
 
-void Joystick_init(void)
+static uint32_t adcRawData[JOYSTICK_NUM_CHANNELS] = {0x00, 0x00};	//decimated reading
+static int32_t mAxisValue[JOYSTICK_NUM_CHANNELS] = {0x00, 0x00};
+static uint8_t mAxisEngaged[JOYSTICK_NUM_CHANNELS] = {0x00, 0x00};
+
+//digital joystick - written by the tick, the
+//queue is single producer (tick) single consumer
+static const uint16_t mDigitalPin[JOYSTICK_DIGITAL_NUM] =
 {
-	memset((uint32_t*)adcRawData, 0x00, 2);
+	USER_GPIO_PD2_Pin,			//left
+	USER_GPIO_PD4_Pin,			//right
+	USER_GPIO_PD5_Pin,			//up
+	USER_GPIO_PD7_Pin,			//down
+};
 
-	//start the dma transfer - continuous
-	HAL_ADC_Start_DMA(&hadc3, (uint32_t*)adcRawData, 2);
-}
+static uint8_t mDebounce[JOYSTICK_DIGITAL_NUM];
+static volatile uint8_t mDigitalState = 0x00;
+static JoystickEvent mEventQueue[JOYSTICK_EVENT_QUEUE_SIZE];
+static volatile uint8_t mEventHead = 0x00;
+static volatile uint8_t mEventTail = 0x00;
 
-////////////////////////////////////////////////
-//returns adc raw data pointer, 32bit, 2 elements
-void Joystick_GetRawData(uint32_t *data)
+static int32_t Joystick_AxisCurve(uint32_t raw, uint8_t* engaged);
+static void Joystick_PutEvent(uint8_t direction, uint8_t pressed, uint32_t tick);
+
+
+void Joystick_init(void)
 {
-	data[0] = adcRawData[0];
-	data[1] = adcRawData[1];
+	memset((uint32_t*)adcBuffer, 0x00, sizeof(adcBuffer));
+	memset(adcRawData, 0x00, sizeof(adcRawData));
+	memset(mAxisValue, 0x00, sizeof(mAxisValue));
+	memset(mAxisEngaged, 0x00, sizeof(mAxisEngaged));
+	memset(mDebounce, 0x00, sizeof(mDebounce));
+	mDigitalState = 0x00;
+	mEventHead = mEventTail = 0x00;
+
+	//start the dma transfer - continuous, circular
+	HAL_ADC_Start_DMA(&hadc3, (uint32_t*)adcBuffer, JOYSTICK_OVERSAMPLE * JOYSTICK_NUM_CHANNELS);
+
+	//buffer is read at frame time, no need for the
+	//half / full transfer interrupts
+	__HAL_DMA_DISABLE_IT(hadc3.DMA_Handle, DMA_IT_HT | DMA_IT_TC);
 }
 
 
-//////////////////////////////////////////
-//DMA Complete Callback function
-//Compute the position and reset the dma
-//Check the values read on the ADC, if in range
-//to trigger a joystick event, set the appropriate flag
-//a joystick event is one that  the raw data falls
-//in the upper or lower 1/3 out of 4095....so,
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
+///////////////////////////////////////////////
+//Joystick_Update
+//Called once per frame from the main loop.
+//Average the samples for each channel and compute
+//the axis values.  Y axis pulled down past the
+//deadzone sets the special event flag, once per push.
+//
+void Joystick_Update(void)
 {
+	uint32_t sum[JOYSTICK_NUM_CHANNELS] = {0x00, 0x00};
 
-#ifdef JOYSTICK_USE_ANALOG
-	if (hadc == &hadc3)
+	for (uint32_t i = 0 ; i < JOYSTICK_OVERSAMPLE ; i++)
 	{
-		//left right
-		if (adcRawData[0] < JOYSTICK_DOWN_TRIGGER_VALUE)
-		{
-			Sprite_PlayerSetSpecialEventFlag();
-		}
-		else if (adcRawData[0] > JOYSTICK_UP_TRIGGER_VALUE)
-		{
-			Sprite_PlayerSetThursterFlag();
-		}
-		else if (adcRawData[1] < JOYSTICK_LEFT_TRIGGER_VALUE)
-		{
-			Sprite_PlayerSetRotateCCWFlag();
-		}
-		else if (adcRawData[1] > JOYSTICK_RIGHT_TRIGGER_VALUE)
-		{
-			Sprite_PlayerSetRotateCWFlag();
-		}
+		for (uint32_t ch = 0 ; ch < JOYSTICK_NUM_CHANNELS ; ch++)
+			sum[ch] += adcBuffer[i * JOYSTICK_NUM_CHANNELS + ch];
+	}
 
+	int32_t lastY = mAxisValue[JOYSTICK_AXIS_Y];
+
+	for (uint32_t ch = 0 ; ch < JOYSTICK_NUM_CHANNELS ; ch++)
+	{
+		adcRawData[ch] = sum[ch] >> JOYSTICK_OVERSAMPLE_SHIFT;
+		mAxisValue[ch] = Joystick_AxisCurve(adcRawData[ch], &mAxisEngaged[ch]);
 	}
 
-#endif
+	if ((mAxisValue[JOYSTICK_AXIS_Y] < 0) && (lastY >= 0))
+		Sprite_PlayerSetSpecialEventFlag();
+}
+
+
+///////////////////////////////////////////////
+//Axis curve - deadzone with hysteresis.  The
+//axis engages past deadzone + hysteresis and lets
+//go inside the deadzone, so a stick resting near
+//the edge doesn't chatter.  Engaged, the output is
+//linear from the deadzone to full deflection.
+//
+static int32_t Joystick_AxisCurve(uint32_t raw, uint8_t* engaged)
+{
+	int32_t delta = (int32_t)raw - JOYSTICK_CENTER_VALUE;
+	int32_t magnitude = (delta < 0) ? -delta : delta;
+
+	if ((!*engaged) && (magnitude > (JOYSTICK_DEADZONE + JOYSTICK_HYSTERESIS)))
+		*engaged = 1;
+	else if ((*engaged) && (magnitude < JOYSTICK_DEADZONE))
+		*engaged = 0;
 
-	HAL_ADC_Start_DMA(&hadc3, (uint32_t*)adcRawData, 2);
+	if (!*engaged)
+		return 0;
+
+	int32_t value = ((magnitude - JOYSTICK_DEADZONE) * JOYSTICK_AXIS_FULL_SCALE) /
+						(JOYSTICK_MAX_DEFLECTION - JOYSTICK_DEADZONE);
+
+	if (value > JOYSTICK_AXIS_FULL_SCALE)
+		value = JOYSTICK_AXIS_FULL_SCALE;
+
+	return (delta < 0) ? -value : value;
+}
+
+
+///////////////////////////////////////////////
+//Axis value from the last update,
+//+/- JOYSTICK_AXIS_FULL_SCALE, 0 in the deadzone
+int32_t Joystick_GetAxis(JoystickAxis_t axis)
+{
+	return mAxisValue[axis];
+}
+
+
+////////////////////////////////////////////////
+//returns the decimated adc reading from the
+//last update, 32bit, 2 elements
+void Joystick_GetRawData(uint32_t *data)
+{
+	data[0] = adcRawData[0];
+	data[1] = adcRawData[1];
 }
 
 
 
 ///////////////////////////////////////////
 //Joystick - Digital Read
-//Read state of 4 joystick pins and set the
-//appropriate flag
+//Set the flags from the held directions.  Press
+//events are read too, so a tap that was released
+//before this frame still counts once.  Left and
+//right together cancel, down is a press edge.
 //
 void Joystick_Digital_Read(void)
 {
 #ifndef JOYSTICK_USE_ANALOG
 
-	//left
-	if (!HAL_GPIO_ReadPin(USER_GPIO_PD2_GPIO_Port, USER_GPIO_PD2_Pin))
+	uint8_t held = Joystick_GetDigitalState();
+	uint8_t pressed = 0x00;
+	JoystickEvent event;
+
+	while (Joystick_GetEvent(&event))
 	{
-		Sprite_PlayerSetRotateCCWFlag();
+		if (event.pressed)
+			pressed |= event.direction;
 	}
-	//right
-	else if (!HAL_GPIO_ReadPin(USER_GPIO_PD4_GPIO_Port, USER_GPIO_PD4_Pin))
-	{
+
+	held |= pressed;
+
+	if ((held & (JOYSTICK_DIGITAL_LEFT | JOYSTICK_DIGITAL_RIGHT)) == JOYSTICK_DIGITAL_LEFT)
+		Sprite_PlayerSetRotateCCWFlag();
+
+	if ((held & (JOYSTICK_DIGITAL_LEFT | JOYSTICK_DIGITAL_RIGHT)) == JOYSTICK_DIGITAL_RIGHT)
 		Sprite_PlayerSetRotateCWFlag();
-	}
 
-	//up
-	else if (!HAL_GPIO_ReadPin(USER_GPIO_PD5_GPIO_Port, USER_GPIO_PD5_Pin))
-	{
+	if (held & JOYSTICK_DIGITAL_UP)
 		Sprite_PlayerSetThursterFlag();
-	}
 
-	//down
-	else if (!HAL_GPIO_ReadPin(USER_GPIO_PD7_GPIO_Port, USER_GPIO_PD7_Pin))
-	{
+	//special event once per push, like the analog stick
+	if (pressed & JOYSTICK_DIGITAL_DOWN)
 		Sprite_PlayerSetSpecialEventFlag();
+
+#endif
+
+}
+
+
+///////////////////////////////////////////
+//Joystick - Digital Tick
+//Called at 1khz from the TIM1 (HAL tick) period
+//elapsed callback.  One read of GPIOD for all four
+//pins, integrator debounce per pin, events on the
+//debounced edges.
+//
+void Joystick_DigitalTick(void)
+{
+#ifndef JOYSTICK_USE_ANALOG
+
+	uint32_t input = ~USER_GPIO_PD2_GPIO_Port->IDR;		//active low
+	uint32_t tick = HAL_GetTick();
+	uint8_t state = mDigitalState;
+
+	for (uint8_t i = 0 ; i < JOYSTICK_DIGITAL_NUM ; i++)
+	{
+		uint8_t bit = 1 << i;
+
+		if (input & mDigitalPin[i])
+		{
+			if (mDebounce[i] < JOYSTICK_DEBOUNCE_MS)
+				mDebounce[i]++;
+		}
+		else if (mDebounce[i] > 0)
+			mDebounce[i]--;
+
+		if ((!(state & bit)) && (mDebounce[i] == JOYSTICK_DEBOUNCE_MS))
+		{
+			state |= bit;
+			Joystick_PutEvent(bit, 1, tick);
+		}
+		else if ((state & bit) && (!mDebounce[i]))
+		{
+			state &= ~bit;
+			Joystick_PutEvent(bit, 0, tick);
+		}
 	}
 
+	mDigitalState = state;
+
 #endif
+}
+
+
+///////////////////////////////////////////
+//Held directions, JOYSTICK_DIGITAL_ bits.
+//One byte, so it is always a consistent snapshot.
+uint8_t Joystick_GetDigitalState(void)
+{
+	return mDigitalState;
+}
+
+
+///////////////////////////////////////////
+//Pop the oldest event.  Returns 1 if there was
+//one, 0 if the queue is empty.
+uint8_t Joystick_GetEvent(JoystickEvent* event)
+{
+	uint8_t tail = mEventTail;
+
+	if (tail == mEventHead)
+		return 0;
+
+	*event = mEventQueue[tail];
+	mEventTail = (tail + 1) & (JOYSTICK_EVENT_QUEUE_SIZE - 1);
+
+	return 1;
+}
+
+
+///////////////////////////////////////////
+//Push an event from the tick, dropped if the
+//queue is full
+static void Joystick_PutEvent(uint8_t direction, uint8_t pressed, uint32_t tick)
+{
+	uint8_t head = mEventHead;
+	uint8_t next = (head + 1) & (JOYSTICK_EVENT_QUEUE_SIZE - 1);
+
+	if (next == mEventTail)
+		return;
 
+	mEventQueue[head].direction = direction;
+	mEventQueue[head].pressed = pressed;
+	mEventQueue[head].tick = tick;
+	mEventHead = next;
 }
 
 
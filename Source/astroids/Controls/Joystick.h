@@ -13,8 +13,26 @@ Connections:
 UP/DOWN - CH4 - PF6
 LEFT/RIGHT - CH13 - PC3
 
-Alternate Joystick - PE2, PE3, PE4 to
-use digital signal for left, right, thruster
+Sampling:
+ADC3 scans both channels continuously into a circular
+DMA buffer of JOYSTICK_OVERSAMPLE samples per channel.
+The DMA interrupts are turned off, nothing runs per
+conversion.  Joystick_Update() is called once per frame
+and averages the buffer (decimation), then runs each
+axis through a deadzone with hysteresis and a linear
+curve to a signed value of +/- JOYSTICK_AXIS_FULL_SCALE.
+
+X axis - + rotates CW, - rotates CCW
+Y axis - + fires thrusters, - is the special event
+
+Alternate Joystick - PD2, PD4, PD5, PD7, active low,
+digital left, right, up, down.  Joystick_DigitalTick()
+runs from the 1khz HAL tick, reads GPIOD IDR once
+and debounces each direction with an integrator -
+a count that steps toward the pin level and changes
+the state only at 0 or JOYSTICK_DEBOUNCE_MS.  State
+changes go into an event queue with the tick, the
+main loop reads the held directions as one bitmask.
 
 */
 //////////////////////////////////////////////////////////
@@ -30,14 +48,54 @@ use digital signal for left, right, thruster
 #define JOYSTICK_DOWN_TRIGGER_VALUE				((uint32_t)1365)
 #define JOYSTICK_UP_TRIGGER_VALUE				((uint32_t)2730)
 
+#define JOYSTICK_NUM_CHANNELS			2
+#define JOYSTICK_OVERSAMPLE_SHIFT		4
+#define JOYSTICK_OVERSAMPLE				(1 << JOYSTICK_OVERSAMPLE_SHIFT)	//samples per channel
+
+#define JOYSTICK_CENTER_VALUE			((int32_t)2048)
+#define JOYSTICK_MAX_DEFLECTION			((int32_t)2047)
+#define JOYSTICK_DEADZONE				((int32_t)300)		//adc counts from center
+#define JOYSTICK_HYSTERESIS				((int32_t)100)		//engage at deadzone + hysteresis
+#define JOYSTICK_AXIS_FULL_SCALE		((int32_t)256)
+
+//digital joystick - direction bits, debounce and
+//event queue size (power of 2)
+#define JOYSTICK_DIGITAL_LEFT			((uint8_t)0x01)		//PD2
+#define JOYSTICK_DIGITAL_RIGHT			((uint8_t)0x02)		//PD4
+#define JOYSTICK_DIGITAL_UP				((uint8_t)0x04)		//PD5
+#define JOYSTICK_DIGITAL_DOWN			((uint8_t)0x08)		//PD7
+#define JOYSTICK_DIGITAL_NUM			4
+#define JOYSTICK_DEBOUNCE_MS			5
+#define JOYSTICK_EVENT_QUEUE_SIZE		16
+
 //comment this out if you want to use digital
 #define JOYSTICK_USE_ANALOG				1
 
 
+//index matches the adc conversion rank
+typedef enum
+{
+	JOYSTICK_AXIS_Y = 0,		//CH4 - up / down
+	JOYSTICK_AXIS_X = 1,		//CH13 - left / right
+}JoystickAxis_t;
+
+
+typedef struct
+{
+	uint8_t direction;			//JOYSTICK_DIGITAL_ bit
+	uint8_t pressed;			//1 - press, 0 - release
+	uint32_t tick;				//HAL tick of the debounced edge
+}JoystickEvent;
+
 
 void Joystick_init(void);
+void Joystick_Update(void);
+int32_t Joystick_GetAxis(JoystickAxis_t axis);
 void Joystick_GetRawData(uint32_t* data);
 void Joystick_Digital_Read(void);
+void Joystick_DigitalTick(void);
+uint8_t Joystick_GetDigitalState(void);
+uint8_t Joystick_GetEvent(JoystickEvent* event);
 
 
 
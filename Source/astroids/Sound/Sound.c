@@ -1,8 +1,15 @@
 /*////////////////////////////////////////////////////
 Sound - DAC output
 
-
-
+Resampling playback engine.  Each voice steps a
+Q16.16 phase through its sound array and linearly
+interpolates between adjacent samples, so a sound
+can be played at any rate without another flash
+array.  The sound arrays are signed 8 bit (two's
+complement, as the wav converter writes them).
+Active voices are mixed signed, biased to the 0x80
+midpoint once and written to DAC Ch2 from the TIM7
+isr.
 
 */////////////////////////////////////////////////////
 #include <stdio.h>
@@ -14,21 +21,94 @@ Sound - DAC output
 #include "Sound.h"
 #include "dac.h"
 #include "tim.h"
+#include "AssetPack.h"
+#include "asteroidsIds.h"
+
+//sounds - loaded from the asset pack in Sound_Init
+static SoundData sound_levelUp;
+static SoundData sound_enemyExplode;
+static SoundData sound_playerExplode;
+static SoundData sound_playerShoot;
+static SoundData sound_thruster;
+
+
+////////////////////////////////////////////
+//Voice - one sound array being played back
+//phase - Q16.16 read position in the array
+//step - Q16.16 phase increment per output sample
+//unity - step at the recorded pitch
+//end - Q16.16 last position that still has a next
+//sample to interpolate with
+typedef struct
+{
+	const uint8_t* waveData;
+	volatile uint32_t phase;
+	volatile uint32_t step;
+	uint32_t unity;
+	uint32_t end;
+	volatile uint8_t active;
+}SoundVoice;
+
+static SoundVoice mVoice[SOUND_NUM_VOICES];
 
+#ifdef SOUND_PROFILE_CYCLES
+static volatile uint32_t mISRCycles = 0x00;
+#endif
 
-static uint8_t* waveData;
-static uint32_t waveCounter;
+static uint32_t Sound_GetUnityStep(const SoundData *sound);
+static uint32_t Sound_GetStep(uint32_t unity, uint32_t pitch);
 static void Sound_PlaySound(const SoundData *sound);
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id);
 
 
 ////////////////////////////////
 //
 void Sound_Init(void)
 {
+	AssetPack pack;
+
 	//start the dac
 	HAL_TIM_Base_Stop_IT(&htim7);
 	HAL_DAC_Start(&hdac, DAC1_CHANNEL_2);
 	HAL_DAC_SetValue(&hdac, DAC1_CHANNEL_2, DAC_ALIGN_8B_R, 0x00);
+
+	memset(mVoice, 0x00, sizeof(mVoice));
+
+	//sound arrays are in the linked asset pack,
+	//a sound that's missing has length 0 and
+	//doesn't play
+	AssetPack_OpenLinked(&pack);
+
+	Sound_Load(&pack, &sound_levelUp, ASSET_ID_WAVLEVELUP);
+	Sound_Load(&pack, &sound_enemyExplode, ASSET_ID_WAVENEMYEXPLODE);
+	Sound_Load(&pack, &sound_playerExplode, ASSET_ID_WAVPLAYEREXPLODE);
+	Sound_Load(&pack, &sound_playerShoot, ASSET_ID_WAVPLAYERSHOOT);
+	Sound_Load(&pack, &sound_thruster, ASSET_ID_WAVTHRUSTER);
+
+#ifdef SOUND_PROFILE_CYCLES
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0x00;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+//////////////////////////////////////////////
+//Point a sound at its data in the asset pack,
+//the sample rate and bit depth are the entry
+//params
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id)
+{
+	const AssetEntry* entry = AssetPack_Find(pack, id);
+
+	memset(sound, 0x00, sizeof(SoundData));
+
+	if ((entry) && (entry->type == ASSET_TYPE_SOUND))
+	{
+		sound->soundData = AssetPack_GetData(pack, entry);
+		sound->length = entry->size;
+		sound->bitDepth = (uint8_t)entry->param[1];
+		sound->sampleRate = entry->param[0];
+	}
 }
 
 /////////////////////////////////////////////
@@ -36,18 +116,58 @@ void Sound_Init(void)
 //Called from Timer TIM7 interrupt handler function
 //in main, period elapsed callback
 //
-//4 is from reading every 4th element.
-//since the sample rate on input file is 44khz
-//and output is 11khz
+//For each active voice, the integer part of the
+//phase indexes the sound array and the top 8 bits
+//of the fraction blend toward the next sample.
+//Samples are signed, so voices are summed signed,
+//then biased to the 0x80 midpoint and clipped to
+//the 8 bit dac range.  The timer is stopped when
+//no voices remain.
 void Sound_InterruptHandler(void)
 {
-	//down counter complete? - every sample
-	if (waveCounter > 1)
+#ifdef SOUND_PROFILE_CYCLES
+	uint32_t start = DWT->CYCCNT;
+#endif
+
+	int32_t mix = 0x00;
+	uint8_t numActive = 0x00;
+
+	for (int i = 0 ; i < SOUND_NUM_VOICES ; i++)
+	{
+		SoundVoice* voice = &mVoice[i];
+
+		if (!voice->active)
+			continue;
+
+		uint32_t phase = voice->phase;
+
+		if (phase < voice->end)
+		{
+			uint32_t index = phase >> 16;
+			int32_t frac = (phase >> 8) & 0xFF;
+			int32_t s0 = (int8_t)voice->waveData[index];
+			int32_t s1 = (int8_t)voice->waveData[index + 1];
+
+			mix += s0 + (((s1 - s0) * frac) >> 8);
+			voice->phase = phase + voice->step;
+			numActive++;
+		}
+		else
+		{
+			voice->active = 0x00;
+		}
+	}
+
+	if (numActive > 0)
 	{
-		//output deref waveData ptr to the dac
-		HAL_DAC_SetValue(&hdac, DAC1_CHANNEL_2, DAC_ALIGN_8B_R, *waveData);
-		waveData++;				//increment the pointer
-		waveCounter--;			//decrement the downcounter
+		mix += 0x80;
+
+		if (mix < 0x00)
+			mix = 0x00;
+		else if (mix > 0xFF)
+			mix = 0xFF;
+
+		HAL_DAC_SetValue(&hdac, DAC1_CHANNEL_2, DAC_ALIGN_8B_R, (uint32_t)mix);
 	}
 
 	else
@@ -56,19 +176,107 @@ void Sound_InterruptHandler(void)
 		HAL_DAC_SetValue(&hdac, DAC1_CHANNEL_2, DAC_ALIGN_8B_R, 0x00);
 		HAL_TIM_Base_Stop_IT(&htim7);
 	}
+
+#ifdef SOUND_PROFILE_CYCLES
+	uint32_t cycles = DWT->CYCCNT - start;
+	if (cycles > mISRCycles)
+		mISRCycles = cycles;
+#endif
 }
 
 
-////////////////////////////////////////////////
-void Sound_PlaySound(const SoundData *sound)
+/////////////////////////////////////////////////
+//Q16.16 phase step that plays a sound at its
+//recorded pitch - the sound sample rate over the
+//output rate.
+uint32_t Sound_GetUnityStep(const SoundData *sound)
+{
+	uint32_t sampleRate = sound->sampleRate;
+
+	if (!sampleRate)
+		sampleRate = SOUND_OUTPUT_RATE_HZ;
+
+	return (uint32_t)(((uint64_t)sampleRate << 16) / SOUND_OUTPUT_RATE_HZ);
+}
+
+/////////////////////////////////////////////////
+//Scale the unity step by pitch (Q16.16).  Pitch
+//is clamped to SOUND_PITCH_MIN/MAX.
+uint32_t Sound_GetStep(uint32_t unity, uint32_t pitch)
+{
+	if (pitch < SOUND_PITCH_MIN)
+		pitch = SOUND_PITCH_MIN;
+	else if (pitch > SOUND_PITCH_MAX)
+		pitch = SOUND_PITCH_MAX;
+
+	return (uint32_t)(((uint64_t)unity * pitch) >> 16);
+}
+
+
+/////////////////////////////////////////////////
+//Play sound on a voice at pitch (Q16.16,
+//SOUND_PITCH_UNITY = recorded pitch).  Replaces
+//whatever the voice was playing.  The voice is
+//disabled while it's being set up so the isr never
+//sees a half written voice.
+void Sound_PlaySoundPitch(const SoundData *sound, uint8_t voice, uint32_t pitch)
 {
-	waveData = (uint8_t*)sound->soundData;		//set the pointer
-	waveCounter = sound->length;
+	if ((voice >= SOUND_NUM_VOICES) || (sound->length < 2))
+		return;
+
+	SoundVoice* ptr = &mVoice[voice];
+
+	ptr->active = 0x00;
+	ptr->waveData = sound->soundData;
+	ptr->phase = 0x00;
+	ptr->unity = Sound_GetUnityStep(sound);
+	ptr->step = Sound_GetStep(ptr->unity, pitch);
+	ptr->end = (sound->length - 1) << 16;
+	ptr->active = 1;
 
 	//start the timer - calls Sound_InterruptHandler
 	HAL_TIM_Base_Start_IT(&htim7);
 }
 
+/////////////////////////////////////////////////
+//Change the pitch of a voice while it's playing.
+//The phase is kept, so there is no click.
+void Sound_SetVoicePitch(uint8_t voice, uint32_t pitch)
+{
+	if (voice >= SOUND_NUM_VOICES)
+		return;
+
+	mVoice[voice].step = Sound_GetStep(mVoice[voice].unity, pitch);
+}
+
+void Sound_StopVoice(uint8_t voice)
+{
+	if (voice < SOUND_NUM_VOICES)
+		mVoice[voice].active = 0x00;
+}
+
+/////////////////////////////////////////////////
+//Returns the worst case TIM7 isr cycle count since
+//Sound_Init when SOUND_PROFILE_CYCLES is defined,
+//0 otherwise.
+uint32_t Sound_GetISRCycles(void)
+{
+#ifdef SOUND_PROFILE_CYCLES
+	return mISRCycles;
+#else
+	return 0x00;
+#endif
+}
+
+
+////////////////////////////////////////////////
+//Sound effects play on the effect voice at the
+//recorded pitch
+void Sound_PlaySound(const SoundData *sound)
+{
+	Sound_PlaySoundPitch(sound, SOUND_VOICE_EFFECT, SOUND_PITCH_UNITY);
+}
+
 
 
 void Sound_Play_PlayerFire(void)
@@ -99,5 +307,39 @@ void Sound_Play_LevelUp(void)
 
 void Sound_Play_Thruster(void)
 {
-	Sound_PlaySound(&sound_thruster);
+	Sound_PlaySoundPitch(&sound_thruster, SOUND_VOICE_THRUSTER, SOUND_PITCH_UNITY);
+}
+
+//////////////////////////////////////////////
+//Level up tone rises 1/8 per level, up to 2x
+void Sound_Play_LevelUpTone(uint8_t level)
+{
+	uint32_t pitch = SOUND_PITCH_UNITY + (level * (SOUND_PITCH_UNITY >> 3));
+
+	if (pitch > (SOUND_PITCH_UNITY << 1))
+		pitch = SOUND_PITCH_UNITY << 1;
+
+	Sound_PlaySoundPitch(&sound_levelUp, SOUND_VOICE_EFFECT, pitch);
+}
+
+//////////////////////////////////////////////
+//Thruster pitch rises 1/4 per player speed step.
+//Called on every thrust frame.  If the thruster
+//voice is already playing only its pitch changes,
+//so a held thrust doesn't restart the sound.
+void Sound_Play_ThrusterSpeed(uint8_t speed)
+{
+	uint32_t pitch = SOUND_PITCH_UNITY + (speed * (SOUND_PITCH_UNITY >> 2));
+
+	if (mVoice[SOUND_VOICE_THRUSTER].active)
+		Sound_SetVoicePitch(SOUND_VOICE_THRUSTER, pitch);
+	else
+		Sound_PlaySoundPitch(&sound_thruster, SOUND_VOICE_THRUSTER, pitch);
+}
+
+//////////////////////////////////////////////
+//Thruster released
+void Sound_Stop_Thruster(void)
+{
+	Sound_StopVoice(SOUND_VOICE_THRUSTER);
 }
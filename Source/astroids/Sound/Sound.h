@@ -21,6 +21,17 @@ http://ccgi.cjseymour.plus.com/wavtocode/wavtocode.htm
 Sounds assumed to be sampled at 44khz.  To avoid jamming up the
 interrupts, run the output at 11khz, so read every 4th sample
 
+Resampling playback:
+Each voice keeps a Q16.16 phase accumulator into its sound
+array.  Every TIM7 tick the integer part selects the sample,
+the fraction linearly interpolates to the next sample and the
+phase advances by the voice step.  The step is the ratio of
+the sound sample rate to the 11khz output rate, scaled by a
+Q16.16 pitch (SOUND_PITCH_UNITY plays at the recorded pitch).
+This lets one flash array play at any pitch (ie, thruster
+by player speed, rising level up tone) and two voices are
+mixed so the thruster does not cut off the sound effects.
+
 
 */
 
@@ -30,29 +41,45 @@ interrupts, run the output at 11khz, so read every 4th sample
 #include <stddef.h>
 #include <stdint.h>
 
+//output rate of TIM7 - 84mhz / 84 / 92
+#define SOUND_OUTPUT_RATE_HZ		11000
+
+//Q16.16 pitch multipliers
+#define SOUND_PITCH_UNITY			0x00010000
+#define SOUND_PITCH_MIN				(SOUND_PITCH_UNITY >> 2)
+#define SOUND_PITCH_MAX				(SOUND_PITCH_UNITY << 2)
+
+//voices - one for sound effects, one for the thruster
+#define SOUND_NUM_VOICES			2
+#define SOUND_VOICE_EFFECT			0
+#define SOUND_VOICE_THRUSTER		1
+
+//uncomment to record TIM7 sound isr cycles using
+//the DWT cycle counter, read with Sound_GetISRCycles
+//#define SOUND_PROFILE_CYCLES		1
+
 
 typedef struct 
 {
-	uint8_t* soundData;
+	const uint8_t* soundData;
 	uint32_t length;
 	uint8_t bitDepth;
 	uint32_t sampleRate;
 }SoundData;
 
 
-//sound arrays
-//extern const SoundData sound_gameover;			//ok
-
-extern const SoundData sound_levelUp;			//ok
-extern const SoundData sound_enemyExplode;
-extern const SoundData sound_playerExplode;
-extern const SoundData sound_playerShoot;
-extern const SoundData sound_thruster;
+//sound arrays are in the asset pack, see
+//AssetPack/Manifest/asteroids.txt
 
 
 void Sound_Init(void);                  //main
 void Sound_InterruptHandler(void);      //main
 
+void Sound_PlaySoundPitch(const SoundData *sound, uint8_t voice, uint32_t pitch);
+void Sound_SetVoicePitch(uint8_t voice, uint32_t pitch);
+void Sound_StopVoice(uint8_t voice);
+uint32_t Sound_GetISRCycles(void);
+
 
 
 
@@ -65,6 +92,9 @@ void Sound_Play_EnemyExplode(void);
 void Sound_Play_GameOver(void);
 void Sound_Play_LevelUp(void);
 void Sound_Play_Thruster(void);
+void Sound_Play_LevelUpTone(uint8_t level);
+void Sound_Play_ThrusterSpeed(uint8_t speed);
+void Sound_Stop_Thruster(void);
 
 
 #endif
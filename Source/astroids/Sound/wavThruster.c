@@ -1,1419 +0,0 @@
-///////////////////////////////////////////////////
-/*
-Simple Wave File Conversion Utility
-
-Dana Olcott
-Feb, 2018
-www.danasboatshop.com
-Generate sound input files for use in
-firmware on memory constrained devices
-
-To Use:
-Configure a timer to interrupt at sampleRate
-Configure a DAC with bit size bitDepth
-On timer interrupt, write soundData[] to DAC
-Define the following struct somewhere in the firmware:
-
-typedef struct
-{
-	uint8_t* soundData
-	uint32_t length
-	uint8_t bitDepth
-	uint32_t sampleRate
-}SoundData;
-
-Source: Thruster.wav
-Target: wavThruster.c
-Input:
-Sample Rate (hz): 44100
-Bit Depth: 16
-Length(bytes): 87046
-Duration (ms): 986.916
-
-Output:
-SoundData Struct Name: sound_thruster
-Sample Rate (hz): 11000
-Bit Depth: 8
-Length(bytes): 10880
-Duration (ms): 986.916
-
-*/
-////////////////////////////////////////////////////
-
-#include "Sound.h"
-
-static const uint8_t soundData[] = 
-{
-	0x00, 0xcb, 0xcc, 0xcd, 0xd5, 0xd5, 0xdf, 0x24, 
-	0x24, 0x2d, 0x39, 0x39, 0x24, 0x00, 0x00, 0x39, 
-	0x3d, 0x3d, 0xef, 0xe8, 0xe8, 0xd6, 0xd6, 0xd6, 
-	0xd9, 0xd9, 0xd9, 0xc1, 0xc1, 0xc1, 0xb1, 0xb1, 
-	0xb1, 0xb8, 0xb8, 0xb8, 0xca, 0xca, 0xca, 0xb2, 
-	0xb2, 0xb2, 0xb8, 0xb8, 0xb8, 0xdf, 0xdf, 0xde, 
-	0xd1, 0xd1, 0xd7, 0xe8, 0xe8, 0xca, 0xc2, 0xc2, 
-	0xc8, 0xc9, 0xc9, 0xb9, 0xb9, 0xb9, 0xb4, 0xb4, 
-	0xb4, 0xae, 0xae, 0xae, 0xe0, 0xe0, 0xe0, 0xda, 
-	0xda, 0xda, 0xb7, 0xb7, 0xbb, 0xe0, 0xe0, 0xcb, 
-	0xc5, 0xc5, 0xe5, 0xe9, 0xe9, 0xc3, 0xc3, 0xc3, 
-	0x16, 0x16, 0x16, 0x42, 0x42, 0x42, 0x38, 0x38, 
-	0x38, 0xe0, 0xe0, 0xe0, 0xd5, 0xd5, 0xf3, 0x2c, 
-	0x2c, 0x26, 0x25, 0x25, 0x3b, 0x3b, 0x3b, 0x38, 
-	0x38, 0x38, 0xc9, 0xc9, 0xc9, 0x2a, 0x2a, 0x2a, 
-	0x1e, 0x1e, 0x1e, 0xef, 0xef, 0xed, 0xd8, 0xd8, 
-	0xe8, 0x1e, 0x1e, 0x3c, 0x3f, 0x3f, 0x3d, 0x3d, 
-	0x3d, 0xdb, 0xdb, 0xdb, 0xbf, 0xbf, 0xbf, 0xc2, 
-	0xc2, 0xc2, 0xb5, 0xb5, 0xbd, 0xd4, 0xd4, 0xd2, 
-	0xd2, 0xd2, 0xc7, 0xc7, 0xc7, 0x23, 0x23, 0x23, 
-	0xd2, 0xd2, 0xd2, 0xe5, 0xe5, 0xdd, 0xc8, 0xc8, 
-	0xd4, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0x15, 0x15, 
-	0x15, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xc7, 0xd3, 
-	0xd3, 0x2a, 0x2a, 0x2a, 0xd3, 0xd3, 0xd3, 0xdf, 
-	0xdf, 0xdf, 0x35, 0x35, 0x36, 0x3b, 0x3b, 0x28, 
-	0x25, 0x25, 0xda, 0xda, 0xda, 0xcb, 0xcb, 0xcb, 
-	0xb9, 0xb9, 0xbc, 0xcb, 0xcb, 0xc0, 0xbf, 0xbf, 
-	0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb6, 0xd4, 0xd4, 
-	0xc0, 0xb6, 0xb6, 0xdd, 0xdd, 0xdd, 0xd6, 0xd6, 
-	0xd7, 0xe3, 0xe3, 0xf2, 0x30, 0x30, 0xdc, 0xd9, 
-	0xd9, 0xc6, 0xc6, 0xc6, 0x14, 0x14, 0x19, 0x2c, 
-	0x2c, 0x35, 0x37, 0x37, 0x34, 0x34, 0x34, 0x1e, 
-	0x1e, 0x19, 0xd9, 0xd9, 0x41, 0x46, 0x46, 0x2b, 
-	0x2b, 0x2b, 0x39, 0x39, 0x36, 0x2b, 0x2b, 0xd2, 
-	0xd2, 0xd2, 0xd4, 0xd4, 0xd4, 0xda, 0xda, 0xe0, 
-	0x13, 0x13, 0x1a, 0x27, 0x27, 0x27, 0xf1, 0xf1, 
-	0xf1, 0x32, 0x32, 0x32, 0x3a, 0x3a, 0x3a, 0x17, 
-	0x17, 0x15, 0xe5, 0xe5, 0xf3, 0x2d, 0x2d, 0x2e, 
-	0x2f, 0x2f, 0x22, 0x17, 0x17, 0xf1, 0xec, 0xec, 
-	0xf1, 0xf1, 0xf1, 0xd4, 0xd4, 0xd4, 0x29, 0x29, 
-	0x29, 0x38, 0x38, 0x38, 0x42, 0x42, 0x42, 0x44, 
-	0x44, 0x44, 0x42, 0x42, 0x42, 0x34, 0x34, 0x33, 
-	0x30, 0x30, 0x36, 0x3b, 0x3b, 0x28, 0x22, 0x22, 
-	0x33, 0x33, 0x33, 0x1a, 0x1a, 0x1a, 0x0e, 0x0e, 
-	0x0e, 0x26, 0x26, 0x26, 0xe2, 0xe2, 0xe2, 0x29, 
-	0x29, 0x2c, 0x38, 0x38, 0x2d, 0x29, 0x29, 0x2b, 
-	0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x1f, 0x1f, 0x1f, 
-	0xcf, 0xcf, 0xcf, 0xd2, 0xd2, 0xd2, 0xf1, 0xf1, 
-	0xf1, 0x36, 0x36, 0x35, 0x0e, 0x0e, 0x0e, 0x0e, 
-	0x0e, 0x31, 0x38, 0x38, 0x43, 0x43, 0x43, 0x13, 
-	0x13, 0x13, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 
-	0x1f, 0x1f, 0x1f, 0x28, 0x28, 0x2d, 0x39, 0x39, 
-	0x23, 0x17, 0x17, 0xe5, 0xe5, 0xe5, 0x22, 0x22, 
-	0x22, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x3c, 
-	0x3c, 0x35, 0x26, 0x26, 0xdc, 0xd8, 0xd8, 0xcf, 
-	0xcf, 0xcf, 0xe8, 0xe8, 0xe8, 0xd6, 0xd6, 0xd6, 
-	0xe8, 0xe8, 0xe6, 0xe2, 0xe2, 0xce, 0xcb, 0xcb, 
-	0x3e, 0x3e, 0x3e, 0x30, 0x30, 0x2f, 0x43, 0x43, 
-	0x43, 0x31, 0x31, 0x34, 0x3c, 0x3c, 0x39, 0x37, 
-	0x37, 0x1f, 0x1f, 0x1f, 0x31, 0x31, 0x31, 0x2c, 
-	0x2c, 0x26, 0x1f, 0x1f, 0x2f, 0x2f, 0x2f, 0x2b, 
-	0x2b, 0x2b, 0xd6, 0xd6, 0xd7, 0xe5, 0xe5, 0xde, 
-	0xdb, 0xdb, 0xd1, 0xd1, 0xd1, 0x31, 0x31, 0x31, 
-	0x1a, 0x1a, 0xee, 0xd1, 0xd1, 0xcc, 0xcb, 0xcb, 
-	0xe5, 0xe5, 0xe5, 0xec, 0xec, 0xe3, 0xcd, 0xcd, 
-	0xdd, 0xe2, 0xe2, 0xbd, 0xbd, 0xbd, 0xbc, 0xbc, 
-	0xbe, 0xd8, 0xd8, 0xd5, 0xd4, 0xd4, 0x1a, 0x1a, 
-	0x1a, 0x21, 0x21, 0x24, 0x2e, 0x2e, 0x00, 0xec, 
-	0xec, 0xec, 0xec, 0xec, 0x17, 0x17, 0xf3, 0xd4, 
-	0xd4, 0x22, 0x27, 0x27, 0x25, 0x25, 0x25, 0x2c, 
-	0x2c, 0x2c, 0x27, 0x27, 0x2b, 0x2e, 0x3e, 0x3e, 
-	0x36, 0x1f, 0x1f, 0x19, 0x13, 0x13, 0xf8, 0xf2, 
-	0xf2, 0xe4, 0xe3, 0xe3, 0x11, 0x13, 0x13, 0x1a, 
-	0x1a, 0x1a, 0x29, 0x29, 0x29, 0x2f, 0x2f, 0x2f, 
-	0xde, 0xde, 0xde, 0x0d, 0x0d, 0x0d, 0xbc, 0xbc, 
-	0xbc, 0xbc, 0xbc, 0xbc, 0xc7, 0xc7, 0xc8, 0xcd, 
-	0xcd, 0xc3, 0xbc, 0xbc, 0xcb, 0xd3, 0xd3, 0xd6, 
-	0xd6, 0xd6, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-	0xda, 0xda, 0xda, 0xca, 0xca, 0xca, 0xcc, 0xcc, 
-	0xcd, 0xd4, 0xd4, 0xd3, 0xd1, 0xd1, 0xe0, 0xe5, 
-	0xe5, 0x1c, 0x1c, 0x1c, 0x0d, 0x0d, 0x0d, 0x31, 
-	0x31, 0x31, 0xec, 0xec, 0xec, 0x37, 0x37, 0x37, 
-	0x0d, 0x0d, 0x0d, 0x38, 0x38, 0x2c, 0xc3, 0xc3, 
-	0xc4, 0xc6, 0xc6, 0xd3, 0xd6, 0xd6, 0xdc, 0xdc, 
-	0xdc, 0x2c, 0x2c, 0x2c, 0x2e, 0x2e, 0x2e, 0x2a, 
-	0x2a, 0x2a, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x23, 
-	0xf2, 0xf2, 0x11, 0x16, 0x16, 0x32, 0x32, 0x32, 
-	0x29, 0x29, 0x29, 0x2c, 0x2c, 0x2c, 0x23, 0x23, 
-	0x23, 0x3b, 0x3b, 0x32, 0x0d, 0x0d, 0xe4, 0xde, 
-	0xde, 0xcf, 0xcf, 0xcf, 0x00, 0x00, 0x00, 0x30, 
-	0x30, 0x30, 0x2a, 0x2a, 0x28, 0x1f, 0x1f, 0xe7, 
-	0xdc, 0xdc, 0xe9, 0xe9, 0xe9, 0xe3, 0xe3, 0xe3, 
-	0x16, 0x16, 0x16, 0xde, 0xde, 0xdc, 0xd2, 0xd2, 
-	0xd0, 0xcd, 0xcd, 0xdf, 0xe6, 0xe6, 0xda, 0xda, 
-	0xda, 0xde, 0xde, 0xde, 0xbf, 0xbf, 0xbf, 0xca, 
-	0xca, 0xcc, 0xcc, 0xcc, 0xca, 0xca, 0xca, 0xe9, 
-	0xe9, 0xdd, 0xcc, 0xcc, 0xd8, 0xda, 0xda, 0xd5, 
-	0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xbf, 0xbf, 0xc3, 
-	0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 
-	0xcc, 0xcc, 0xc9, 0xc4, 0xc4, 0x27, 0x27, 0x27, 
-	0x19, 0x19, 0x19, 0x2f, 0x2f, 0x2d, 0x29, 0x29, 
-	0xd6, 0xd3, 0xd3, 0xc8, 0xc8, 0xc8, 0x25, 0x25, 
-	0x0c, 0xd3, 0xd3, 0x42, 0x42, 0x42, 0x42, 0x42, 
-	0x42, 0x2d, 0x2d, 0x30, 0x37, 0x37, 0x3f, 0x40, 
-	0x40, 0x35, 0x35, 0x35, 0x2a, 0x2a, 0x2d, 0x38, 
-	0x38, 0x2d, 0x28, 0x28, 0x16, 0x16, 0x16, 0x16, 
-	0x19, 0x34, 0x34, 0x30, 0x19, 0x19, 0x2b, 0x42, 
-	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 
-	0x38, 0x38, 0xdc, 0xd8, 0xd8, 0x19, 0x19, 0x19, 
-	0x21, 0x21, 0x21, 0xf2, 0xf2, 0xf2, 0x27, 0x27, 
-	0x27, 0x1f, 0x1f, 0x1f, 0xe3, 0xe3, 0xe3, 0xc5, 
-	0xc5, 0xc5, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc6, 
-	0xc6, 0xc6, 0xbd, 0xbd, 0xbd, 0xdc, 0xdc, 0xdc, 
-	0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0xc5, 
-	0xc5, 0xc9, 0xc9, 0xcc, 0xd7, 0xd7, 0xd4, 0xcf, 
-	0xcf, 0xdf, 0xf2, 0xf2, 0xd7, 0xd2, 0xd2, 0xee, 
-	0xf2, 0xf2, 0xbd, 0xbd, 0xbd, 0xc9, 0xc9, 0xc9, 
-	0xda, 0xda, 0xda, 0x28, 0x28, 0x28, 0xd3, 0xd3, 
-	0xd4, 0xda, 0xda, 0xe1, 0x0d, 0x0d, 0xd9, 0xcc, 
-	0xcc, 0x1d, 0x28, 0x28, 0x2e, 0x2e, 0x2e, 0xe3, 
-	0xe3, 0xe3, 0xd8, 0xd8, 0xd8, 0xe3, 0xe3, 0xe3, 
-	0x2e, 0x2e, 0x1e, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 
-	0xbd, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xca, 0xca, 
-	0xca, 0xc8, 0xc8, 0xc8, 0xe1, 0xe1, 0xf4, 0x28, 
-	0x28, 0x30, 0x32, 0x32, 0x2b, 0x2b, 0x2b, 0xe1, 
-	0xe1, 0xe1, 0xe3, 0xe3, 0xe3, 0x21, 0x21, 0x26, 
-	0x2d, 0x2d, 0x27, 0x25, 0x25, 0x30, 0x31, 0x31, 
-	0xcb, 0xcb, 0xcb, 0xce, 0xce, 0xce, 0xcd, 0xcd, 
-	0xcd, 0xe1, 0xe1, 0xdd, 0xd5, 0xd5, 0xd0, 0xcd, 
-	0xcd, 0xc7, 0xc7, 0xc7, 0xbd, 0xbe, 0xbe, 0xd9, 
-	0xd9, 0xd9, 0xc2, 0xc2, 0xe1, 0xe1, 0xe1, 0xd9, 
-	0xd9, 0xd9, 0xe1, 0xe1, 0xd6, 0xd1, 0xd1, 0x2b, 
-	0x2b, 0x2b, 0xda, 0xda, 0xda, 0xed, 0xed, 0xe7, 
-	0xde, 0xde, 0xe2, 0xe3, 0xe3, 0x1c, 0x1c, 0x1c, 
-	0x28, 0x28, 0x2b, 0x37, 0x37, 0x2c, 0x28, 0x28, 
-	0xdc, 0xdc, 0xdc, 0xce, 0xce, 0xd0, 0xd7, 0xd7, 
-	0xce, 0xcc, 0xcc, 0x12, 0x12, 0x12, 0x20, 0x20, 
-	0x1e, 0x12, 0x12, 0xd6, 0xcf, 0xcf, 0x20, 0x20, 
-	0x20, 0xc4, 0xc4, 0xc4, 0xc3, 0xc3, 0xca, 0xd5, 
-	0xd5, 0xe9, 0xe9, 0xe9, 0xc0, 0xc0, 0xc0, 0xc6, 
-	0xc6, 0xc9, 0xce, 0xce, 0xe9, 0xed, 0xed, 0xc8, 
-	0xd7, 0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xcd, 
-	0xcd, 0xcd, 0xbe, 0xbe, 0xbe, 0xf2, 0xf2, 0xf2, 
-	0xce, 0xce, 0xce, 0xdd, 0xdd, 0xdd, 0x24, 0x24, 
-	0x1b, 0xc5, 0xc5, 0xc1, 0xbe, 0xbe, 0xca, 0xe6, 
-	0xe6, 0xe4, 0xe3, 0xe3, 0x2a, 0x2f, 0x2f, 0x24, 
-	0x24, 0x24, 0x20, 0x20, 0x20, 0x16, 0x16, 0x16, 
-	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x37, 
-	0x3a, 0x3f, 0x3f, 0x34, 0x26, 0x26, 0x31, 0x33, 
-	0x33, 0x07, 0xf2, 0xf2, 0x0d, 0x0d, 0x0d, 0x32, 
-	0x32, 0x32, 0x36, 0x36, 0x36, 0x12, 0x12, 0x12, 
-	0xd9, 0xd9, 0xd9, 0x2e, 0x2e, 0x2c, 0x19, 0x19, 
-	0xf4, 0xd7, 0xd7, 0xdc, 0xe1, 0xe1, 0xd6, 0xd3, 
-	0xd3, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xbf, 
-	0xbf, 0xbf, 0x20, 0x20, 0x20, 0xf2, 0xf2, 0xeb, 
-	0xd6, 0xd6, 0xdb, 0xe6, 0xe6, 0xe2, 0xe1, 0xe1, 
-	0xf7, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xdd, 0xdd, 
-	0xdd, 0xd6, 0xd6, 0xd5, 0xd3, 0xd3, 0xdf, 0x1c, 
-	0x1c, 0x23, 0x26, 0x26, 0xcc, 0xcc, 0xcc, 0xed, 
-	0xed, 0xed, 0xbf, 0xbf, 0xbf, 0xc6, 0xc6, 0xe9, 
-	0x41, 0x41, 0x3c, 0x34, 0x34, 0x39, 0x3a, 0x3a, 
-	0x41, 0x41, 0x41, 0x2f, 0x2f, 0x2f, 0x3e, 0x3e, 
-	0x3e, 0x2f, 0x2f, 0x31, 0x38, 0x38, 0x22, 0xdf, 
-	0xdf, 0xd3, 0xd1, 0xd1, 0xcf, 0xcf, 0xcf, 0xc7, 
-	0xc7, 0xc7, 0xd6, 0xd6, 0xd7, 0x00, 0x00, 0xe9, 
-	0xdd, 0xdd, 0xda, 0xd9, 0xda, 0xdd, 0xdd, 0xd6, 
-	0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xc7, 0xc7, 0xc7, 
-	0xe1, 0xe1, 0xd0, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 
-	0xca, 0xca, 0xca, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-	0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-	0xbe, 0xbe, 0xbf, 0xc4, 0xc6, 0xc6, 0xcf, 0xcf, 
-	0xcf, 0x19, 0x19, 0x22, 0x2f, 0x2f, 0x08, 0xdb, 
-	0xdb, 0xe9, 0xe9, 0xe9, 0xd4, 0xd4, 0xd4, 0xca, 
-	0xca, 0xd2, 0xdd, 0xdd, 0xea, 0xed, 0xed, 0xd0, 
-	0xd0, 0xd0, 0xe1, 0xe1, 0xf7, 0x24, 0x24, 0x0c, 
-	0xf2, 0xf2, 0xd6, 0xd6, 0xd6, 0xcb, 0xcb, 0xc6, 
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 
-	0x3e, 0x3d, 0x3d, 0x34, 0x34, 0x34, 0x40, 0x40, 
-	0x40, 0x38, 0x38, 0x38, 0x34, 0x34, 0x37, 0x40, 
-	0x40, 0x37, 0xf2, 0xf2, 0x1d, 0x29, 0x29, 0xf6, 
-	0xdd, 0xdd, 0x1e, 0x22, 0x22, 0xe1, 0xe1, 0xe1, 
-	0xed, 0xed, 0xed, 0x16, 0x16, 0x16, 0xed, 0xed, 
-	0xed, 0x27, 0x27, 0x25, 0xf2, 0xf2, 0xec, 0xe4, 
-	0xe4, 0xe0, 0xdd, 0xdd, 0xe1, 0xe4, 0xe4, 0xeb, 
-	0xed, 0xed, 0xcf, 0xce, 0xce, 0xd3, 0xd3, 0xd3, 
-	0xd2, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xca, 
-	0xca, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 
-	0xbf, 0xbf, 0xc0, 0xc0, 0xc5, 0xc9, 0xc9, 0xc6, 
-	0xc6, 0xc6, 0xbf, 0xbf, 0xbf, 0xd3, 0xd3, 0xd3, 
-	0xd8, 0xd8, 0xd8, 0xdb, 0xdb, 0xdd, 0x12, 0x12, 
-	0xeb, 0xd5, 0xd5, 0xdf, 0xf2, 0xf2, 0xdb, 0xd8, 
-	0xd8, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x2a, 0x1e, 
-	0x1e, 0x1e, 0x27, 0x27, 0x1e, 0xe6, 0xe6, 0xe6, 
-	0xe6, 0xe6, 0xe9, 0xea, 0xea, 0x24, 0x24, 0x24, 
-	0xed, 0xed, 0xed, 0x1b, 0x1b, 0xf4, 0xce, 0xce, 
-	0xcc, 0xc9, 0xc9, 0xcb, 0xcd, 0xcd, 0xd9, 0xdb, 
-	0xdb, 0xcf, 0xcf, 0xcf, 0x15, 0x15, 0x15, 0xcd, 
-	0xcd, 0xcf, 0x27, 0x27, 0x30, 0x40, 0x40, 0x37, 
-	0x2d, 0x2d, 0x21, 0x1e, 0x1e, 0x24, 0x24, 0x24, 
-	0x00, 0x00, 0x00, 0x12, 0x12, 0x11, 0x0d, 0x0d, 
-	0xea, 0xdf, 0xdf, 0x09, 0x15, 0x15, 0x18, 0x18, 
-	0x2a, 0x2c, 0x2c, 0x18, 0x18, 0x18, 0x2e, 0x2e, 
-	0x25, 0xea, 0xea, 0xe0, 0xdb, 0xdb, 0x12, 0x12, 
-	0x12, 0xce, 0xce, 0xd8, 0x31, 0x31, 0x2f, 0x2d, 
-	0x2d, 0xcc, 0xcc, 0xcc, 0xdf, 0xdf, 0xe1, 0xed, 
-	0xed, 0xd6, 0xc8, 0xc8, 0xf2, 0xf2, 0xf2, 0x32, 
-	0x32, 0x2f, 0xd2, 0xd2, 0xde, 0x00, 0x00, 0x10, 
-	0x12, 0x12, 0x12, 0x12, 0x12, 0x2c, 0x2b, 0x2b, 
-	0x2b, 0x2b, 0x0f, 0xe2, 0xe2, 0xd5, 0xd5, 0xd5, 
-	0x1b, 0x1b, 0x1d, 0x25, 0x25, 0x0f, 0xdf, 0xdf, 
-	0xce, 0xce, 0xce, 0xcd, 0xcd, 0xce, 0xd8, 0xd8, 
-	0xda, 0xdc, 0xdc, 0xd2, 0xd7, 0xdc, 0xd4, 0xd2, 
-	0xd2, 0xce, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2, 0xdd, 
-	0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xed, 0xed, 0xed, 
-	0x23, 0x23, 0x23, 0x15, 0x15, 0x19, 0x2a, 0x2a, 
-	0x30, 0x3a, 0x3a, 0x37, 0x33, 0x33, 0x32, 0x32, 
-	0x32, 0x29, 0x25, 0x25, 0x2e, 0x2e, 0x2e, 0x21, 
-	0x21, 0x21, 0xe2, 0xe2, 0xe2, 0x2b, 0x2b, 0x2b, 
-	0x21, 0x21, 0x21, 0x2d, 0x2d, 0x28, 0xdc, 0xdc, 
-	0xe0, 0xed, 0xed, 0x23, 0x36, 0x36, 0x35, 0x34, 
-	0x34, 0x3b, 0x3e, 0x3e, 0x3e, 0x3d, 0x3d, 0x25, 
-	0x25, 0x25, 0x2a, 0x2a, 0x2a, 0xda, 0xda, 0xda, 
-	0x28, 0x28, 0x28, 0x2f, 0x2f, 0x2f, 0x31, 0x31, 
-	0x18, 0xcc, 0xcc, 0xc6, 0xc0, 0xc0, 0xdb, 0x0d, 
-	0x0d, 0xdb, 0xda, 0xda, 0xd4, 0xd4, 0xd4, 0xcc, 
-	0xcc, 0xcc, 0xc0, 0xc0, 0xc0, 0xd0, 0xd0, 0xd5, 
-	0xe0, 0xe0, 0xd9, 0xd4, 0xd4, 0xe1, 0xe7, 0xe7, 
-	0x25, 0x25, 0x25, 0xc9, 0xc9, 0xc9, 0xdc, 0xdc, 
-	0xdb, 0xd4, 0xd4, 0xdd, 0xf2, 0xf2, 0xdc, 0xd4, 
-	0xd4, 0xc7, 0xc7, 0xc7, 0xd5, 0xd5, 0xd5, 0xd3, 
-	0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 
-	0xca, 0xca, 0xc6, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 
-	0xd7, 0xd8, 0xd8, 0x00, 0x00, 0x00, 0xd0, 0xd0, 
-	0xd0, 0xc4, 0xc4, 0xc6, 0xca, 0xca, 0xc5, 0xc0, 
-	0xc0, 0xc0, 0xc0, 0xc0, 0xd4, 0xd4, 0xd4, 0xde, 
-	0xde, 0xde, 0xe4, 0xe4, 0xdf, 0xd4, 0xd4, 0xd3, 
-	0xd3, 0xcf, 0xcc, 0xcc, 0xc2, 0xc1, 0xc1, 0xce, 
-	0xce, 0xce, 0xd3, 0xd3, 0xc8, 0xc0, 0xc0, 0xc6, 
-	0xcb, 0xcb, 0xd5, 0xd5, 0xd5, 0xdc, 0xdc, 0xd1, 
-	0xc1, 0xc1, 0xcf, 0xda, 0xda, 0xe2, 0xe2, 0xe2, 
-	0xee, 0xee, 0xe4, 0xd7, 0xd7, 0xee, 0x21, 0x21, 
-	0x13, 0x11, 0x11, 0x21, 0x21, 0x21, 0xea, 0xea, 
-	0x09, 0x1b, 0x1b, 0xde, 0xd4, 0xd4, 0x15, 0x15, 
-	0x15, 0xd4, 0xd4, 0xd7, 0xe4, 0xe4, 0xea, 0xf2, 
-	0xf2, 0xee, 0xee, 0xee, 0xdc, 0xdc, 0xd9, 0xc8, 
-	0xc8, 0xd1, 0xdc, 0xdc, 0xcd, 0xcd, 0xcd, 0xd9, 
-	0xd9, 0xdf, 0x2e, 0x2e, 0x1e, 0xea, 0x1e, 0x2e, 
-	0xea, 0xea, 0xea, 0x2c, 0x2c, 0x2c, 0x18, 0x18, 
-	0x15, 0xd4, 0xd4, 0xd7, 0xea, 0xea, 0xf2, 0x11, 
-	0x11, 0x09, 0xf2, 0xf2, 0x1c, 0x26, 0x26, 0x30, 
-	0x32, 0x32, 0xe6, 0xde, 0xde, 0xda, 0xda, 0xda, 
-	0x33, 0x33, 0x33, 0x2b, 0x2b, 0x2b, 0xce, 0xce, 
-	0xcc, 0xc6, 0xc6, 0xcc, 0xe4, 0xe4, 0xe1, 0xde, 
-	0xde, 0xe4, 0xee, 0xee, 0x0f, 0x1b, 0x1b, 0xd5, 
-	0xc4, 0xc4, 0xc9, 0xca, 0xca, 0x24, 0x28, 0x28, 
-	0x3d, 0x3d, 0x3d, 0x3e, 0x3e, 0x3e, 0x2f, 0x2f, 
-	0x2f, 0x23, 0x23, 0x22, 0x1b, 0x1b, 0x28, 0x3c, 
-	0x3c, 0x37, 0x32, 0x32, 0x1d, 0xde, 0xde, 0xee, 
-	0x0c, 0x0c, 0xce, 0xcb, 0xcb, 0x15, 0x15, 0x15, 
-	0xf3, 0xf3, 0xf3, 0xe0, 0xe0, 0xdd, 0xcd, 0xcd, 
-	0xd1, 0xd7, 0xd7, 0xf6, 0x26, 0x26, 0x31, 0x35, 
-	0x35, 0xf7, 0xee, 0xee, 0xcc, 0xcc, 0xcc, 0x24, 
-	0x24, 0x24, 0x1d, 0x1d, 0x25, 0x30, 0x30, 0x2d, 
-	0x29, 0x29, 0xda, 0xcf, 0xcf, 0xce, 0xce, 0xce, 
-	0xdb, 0xdb, 0xdb, 0x11, 0x11, 0x16, 0x35, 0x35, 
-	0x33, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x2d, 0x2a, 
-	0x2a, 0x10, 0xf3, 0xf3, 0x1f, 0x1f, 0x1f, 0xdc, 
-	0xdc, 0xdc, 0xc5, 0xc5, 0xc7, 0xd1, 0xd1, 0xd1, 
-	0xd1, 0xd1, 0xd8, 0xe0, 0xe0, 0x10, 0x15, 0x15, 
-	0x00, 0x00, 0x00, 0xee, 0xee, 0xf8, 0x37, 0x37, 
-	0x34, 0x30, 0x30, 0x27, 0x1d, 0x1d, 0x27, 0x29, 
-	0x29, 0x30, 0x30, 0x24, 0x24, 0x21, 0xcf, 0xcf, 
-	0xd2, 0xd5, 0xd5, 0xd0, 0xce, 0xce, 0xca, 0xca, 
-	0xca, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcf, 0xd2, 
-	0xd2, 0xd8, 0xd8, 0xd8, 0xc5, 0xc5, 0xc9, 0xd0, 
-	0xd0, 0xda, 0xea, 0xea, 0xdd, 0xdc, 0xdc, 0xcc, 
-	0xcc, 0xcc, 0xe2, 0xe2, 0xcc, 0xc1, 0xc1, 0xc1, 
-	0xc3, 0xc3, 0x11, 0x11, 0x11, 0x27, 0x27, 0x27, 
-	0x27, 0x27, 0x22, 0x1d, 0x1d, 0xe6, 0xe5, 0xe5, 
-	0xe0, 0xe0, 0xe5, 0x22, 0x22, 0xf0, 0xd8, 0xd8, 
-	0xe5, 0xe7, 0xe7, 0x0c, 0x0c, 0x06, 0xe5, 0xe5, 
-	0xd4, 0xc9, 0xc9, 0xe4, 0xf3, 0xf3, 0x26, 0x26, 
-	0x1a, 0xf3, 0x26, 0x26, 0x26, 0x3a, 0x3a, 0x3a, 
-	0x3b, 0x3b, 0x38, 0x2d, 0x2d, 0x30, 0x34, 0x34, 
-	0x34, 0x34, 0x34, 0x2b, 0x1f, 0x1f, 0x2d, 0x32, 
-	0x32, 0x2c, 0x2a, 0x2a, 0x11, 0x11, 0x11, 0xd8, 
-	0xd8, 0xd8, 0xee, 0xee, 0xee, 0xd9, 0xd9, 0xd9, 
-	0xd5, 0xd5, 0xd0, 0xc1, 0xc1, 0xc5, 0xd8, 0xd8, 
-	0xd8, 0xd8, 0xd8, 0xd2, 0xcd, 0xcd, 0xcf, 0xd1, 
-	0xd1, 0xf1, 0x20, 0x20, 0x0f, 0x00, 0x00, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0x26, 0x26, 0x26, 
-	0x1c, 0x1c, 0x1c, 0xd0, 0xd0, 0xce, 0xc8, 0xc8, 
-	0xde, 0x29, 0x29, 0x20, 0x11, 0x11, 0x25, 0x2e, 
-	0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 
-	0x2d, 0x2d, 0x18, 0x18, 0x19, 0x24, 0x24, 0x25, 
-	0x29, 0x29, 0x2d, 0x31, 0x31, 0x2e, 0x2b, 0x2b, 
-	0x2d, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x3d, 0x3d, 
-	0x3d, 0xee, 0xee, 0x17, 0x2e, 0x2e, 0x25, 0x17, 
-	0x17, 0x23, 0x27, 0x27, 0x1a, 0x17, 0x17, 0x1e, 
-	0x1e, 0x1e, 0xe1, 0xe1, 0xe1, 0x1e, 0x1e, 0x1c, 
-	0xee, 0xee, 0xdb, 0xca, 0xca, 0xd3, 0xdf, 0xdf, 
-	0xde, 0xdd, 0xdd, 0x2b, 0x2f, 0x2f, 0xf3, 0xf3, 
-	0xf3, 0x1e, 0x1e, 0x1d, 0xea, 0xea, 0xe3, 0xda, 
-	0xda, 0xee, 0x1e, 0x1e, 0xde, 0xd0, 0xd0, 0xe3, 
-	0xe3, 0xe3, 0xeb, 0xeb, 0xeb, 0x1a, 0x1a, 0x10, 
-	0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xd4, 0xce, 0xce, 
-	0xd7, 0xd7, 0xd7, 0x0c, 0x0c, 0xd4, 0xd4, 0xd5, 
-	0xd7, 0xd7, 0xcf, 0xcc, 0xcc, 0xd3, 0xd3, 0xd3, 
-	0xce, 0xce, 0xd7, 0x14, 0x14, 0x13, 0x11, 0x11, 
-	0xe7, 0xe5, 0xe5, 0xdd, 0xdd, 0xe8, 0x30, 0x30, 
-	0x32, 0x34, 0x34, 0x3d, 0x3d, 0x3d, 0x3b, 0x3b, 
-	0x3b, 0x20, 0x20, 0x2a, 0x38, 0x38, 0x31, 0x28, 
-	0x28, 0x1f, 0x1c, 0x1c, 0x2f, 0x2f, 0x2f, 0x2e, 
-	0x2e, 0x36, 0x3d, 0x3d, 0x33, 0x2c, 0x2c, 0x38, 
-	0x38, 0x38, 0x3d, 0x3d, 0x33, 0x17, 0x17, 0xe7, 
-	0xda, 0xda, 0x2f, 0x2f, 0x2f, 0x33, 0x33, 0x31, 
-	0x2f, 0x2f, 0x1f, 0xf3, 0xf3, 0xe8, 0xe8, 0xe8, 
-	0x20, 0x20, 0x11, 0xe8, 0x20, 0x20, 0x20, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0x0c, 0x0c, 0x0d, 
-	0x11, 0x11, 0xec, 0xd3, 0xd3, 0xd2, 0xd2, 0xd2, 
-	0x09, 0x2f, 0x2f, 0x2d, 0x2c, 0x2c, 0x1c, 0x00, 
-	0x00, 0x18, 0x1a, 0x1a, 0xf0, 0xee, 0xee, 0x20, 
-	0x20, 0x20, 0xd8, 0xd8, 0xd8, 0x1a, 0x1a, 0x1a, 
-	0x1a, 0x1a, 0x1a, 0xd7, 0xd7, 0xd6, 0xd3, 0xd3, 
-	0xda, 0x00, 0x00, 0xed, 0xe5, 0xe5, 0xe6, 0xe8, 
-	0xe8, 0x13, 0x22, 0x22, 0x0f, 0xeb, 0xeb, 0x23, 
-	0x28, 0x28, 0xe8, 0xe8, 0xe8, 0x14, 0x14, 0x14, 
-	0x00, 0x00, 0x00, 0xe5, 0xe5, 0xea, 0x1a, 0x1a, 
-	0xe5, 0xd1, 0xd1, 0xde, 0x0c, 0x0c, 0x13, 0x17, 
-	0x17, 0xea, 0xe5, 0xe5, 0xdd, 0xdd, 0xdd, 0xd1, 
-	0xd1, 0xd1, 0xeb, 0xeb, 0xe1, 0xcf, 0xcf, 0xd8, 
-	0xe3, 0xe3, 0xdf, 0xdc, 0xdc, 0xea, 0x00, 0x00, 
-	0xd1, 0xd1, 0xd1, 0x1a, 0x1a, 0x1a, 0xdf, 0xdf, 
-	0xe0, 0xe5, 0xe5, 0xd9, 0xcd, 0xcd, 0xce, 0xce, 
-	0xce, 0xd9, 0xe8, 0xe8, 0xdc, 0xd9, 0xd9, 0xca, 
-	0xca, 0xca, 0x29, 0x29, 0x29, 0x33, 0x33, 0x30, 
-	0x11, 0x11, 0x1a, 0x22, 0x22, 0xe3, 0xcd, 0xcd, 
-	0xd1, 0xd3, 0xd3, 0xc3, 0xc3, 0xc3, 0xd2, 0xd2, 
-	0xd2, 0xc3, 0xc3, 0xc3, 0xc5, 0xc5, 0xc7, 0xc9, 
-	0xc9, 0xcc, 0xcf, 0xcf, 0xfc, 0x22, 0x22, 0xe5, 
-	0xe5, 0xe5, 0xee, 0xee, 0xec, 0xe5, 0xe5, 0xf3, 
-	0x14, 0x14, 0xe9, 0xdc, 0xdc, 0xd6, 0xd5, 0xda, 
-	0xda, 0xe8, 0x37, 0x37, 0x34, 0x31, 0x31, 0x1d, 
-	0x00, 0x00, 0x2d, 0x2d, 0x2a, 0xd2, 0xd2, 0xd1, 
-	0xd0, 0xd0, 0xcd, 0xca, 0xca, 0xc7, 0xc7, 0xc7, 
-	0xe5, 0xe5, 0xe3, 0xdc, 0xdc, 0xcb, 0xc3, 0xc3, 
-	0xc3, 0xc3, 0xc3, 0xe1, 0xe1, 0xe1, 0x1c, 0x1c, 
-	0xf5, 0xd9, 0xd9, 0xde, 0xe3, 0xe3, 0x1a, 0x1e, 
-	0x1e, 0xda, 0xda, 0xe1, 0x17, 0x17, 0xf6, 0xe6, 
-	0xe6, 0x1f, 0x26, 0x26, 0x30, 0x30, 0x2e, 0x20, 
-	0x20, 0xe9, 0xd5, 0xd5, 0xdc, 0xdf, 0xdf, 0x17, 
-	0x17, 0x14, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xc6, 
-	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 
-	0xc3, 0xc5, 0xd2, 0xd2, 0xcb, 0xc5, 0xc5, 0xd1, 
-	0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0x04, 0x11, 0x11, 
-	0xdf, 0xdf, 0xdf, 0xd5, 0xd5, 0xd5, 0x17, 0x17, 
-	0x17, 0xdf, 0xdf, 0xde, 0xd1, 0xd1, 0xd8, 0x26, 
-	0x26, 0x29, 0x2f, 0x2f, 0x1f, 0xe1, 0xe1, 0xed, 
-	0x11, 0x11, 0x2b, 0x3a, 0x3a, 0x35, 0x30, 0x30, 
-	0x33, 0x35, 0x35, 0x31, 0x2f, 0x2f, 0x24, 0x23, 
-	0x23, 0x3c, 0x3c, 0x3c, 0x29, 0x29, 0x29, 0x1c, 
-	0x1c, 0x17, 0xde, 0xde, 0xd6, 0xca, 0xca, 0xce, 
-	0xd4, 0xd4, 0xd1, 0xce, 0xce, 0xe8, 0x27, 0x27, 
-	0x29, 0x2a, 0x2a, 0x1f, 0x1f, 0x1f, 0x27, 0x27, 
-	0x27, 0xf3, 0xf3, 0x0c, 0x23, 0x23, 0x0f, 0xde, 
-	0xde, 0xd6, 0xd0, 0xd0, 0xd2, 0xd4, 0xd4, 0xd3, 
-	0xd3, 0xd3, 0xc4, 0xc4, 0xc4, 0xd6, 0xd6, 0xd4, 
-	0xc7, 0xc7, 0xcf, 0xdc, 0xdc, 0xd3, 0xcb, 0xcb, 
-	0xd2, 0xdb, 0xdb, 0xd4, 0xd0, 0xd0, 0xd4, 0xd5, 
-	0xd5, 0xd9, 0xd9, 0xd9, 0xe2, 0xe2, 0xe2, 0xeb, 
-	0xeb, 0xec, 0xef, 0xef, 0xd3, 0xc5, 0xc5, 0xc4, 
-	0xc4, 0xc4, 0xcb, 0xd3, 0xd3, 0xed, 0x0c, 0x0c, 
-	0xd5, 0xd5, 0xd5, 0xdb, 0xdb, 0xd5, 0xc4, 0xc4, 
-	0xc5, 0xc6, 0xc6, 0xc8, 0xca, 0xca, 0xd4, 0xdc, 
-	0xdc, 0xcc, 0xcb, 0xcb, 0xce, 0xce, 0xce, 0xcd, 
-	0xcd, 0xd6, 0xe8, 0xe8, 0xeb, 0xef, 0xef, 0xe5, 
-	0xe2, 0xe2, 0x00, 0x00, 0x00, 0x27, 0x27, 0x21, 
-	0xe8, 0xef, 0x00, 0x00, 0x18, 0x19, 0x19, 0x2b, 
-	0x2b, 0x1d, 0xd7, 0xd7, 0xd2, 0xce, 0xce, 0xcb, 
-	0xc9, 0xc9, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc9, 
-	0xce, 0xce, 0xcf, 0xd1, 0xd1, 0xce, 0xcd, 0xcd, 
-	0x21, 0x21, 0x21, 0x21, 0x21, 0xf1, 0xd9, 0xd9, 
-	0xd6, 0xd3, 0xd3, 0x19, 0x19, 0x19, 0xef, 0xef, 
-	0xe6, 0xdc, 0xdc, 0xd9, 0xd5, 0xd5, 0xc4, 0xc4, 
-	0xc4, 0xcc, 0xcc, 0xca, 0xc4, 0xc4, 0xc8, 0xcc, 
-	0xcc, 0xf3, 0x17, 0x17, 0xdb, 0xdb, 0xdf, 0xeb, 
-	0xeb, 0xea, 0xe8, 0xe8, 0x22, 0x25, 0x25, 0xe4, 
-	0xe4, 0xf8, 0x1d, 0x1d, 0x2e, 0x3a, 0x2e, 0x1d, 
-	0x1d, 0x2e, 0x3a, 0x3a, 0x2e, 0x1b, 0x1b, 0x13, 
-	0x0c, 0x0c, 0xf6, 0xf3, 0xf3, 0x00, 0x00, 0x00, 
-	0x35, 0x35, 0x35, 0x3b, 0x3b, 0x3b, 0x2e, 0x2e, 
-	0x2d, 0x22, 0x22, 0x21, 0x1b, 0x1b, 0x1d, 0x21, 
-	0x21, 0x36, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 
-	0x24, 0x24, 0x28, 0x2c, 0x2c, 0x31, 0x35, 0x35, 
-	0x28, 0x1d, 0x1d, 0x1a, 0x19, 0x19, 0x23, 0x24, 
-	0x24, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xd8, 0xcf, 0xcf, 0xd6, 0xe0, 0xe0, 0xea, 
-	0x0c, 0x0c, 0x12, 0x16, 0x16, 0xec, 0xe0, 0xe0, 
-	0xda, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xe2, 0xe2, 
-	0xe2, 0xe2, 0xe2, 0xdb, 0xd2, 0xd2, 0xd0, 0xce, 
-	0xce, 0xd1, 0xd4, 0xd4, 0xd2, 0xd1, 0xd1, 0xde, 
-	0xe0, 0xe0, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x0e, 
-	0x16, 0x16, 0x08, 0xeb, 0xeb, 0xf1, 0x00, 0x00, 
-	0x2a, 0x3a, 0x3a, 0x35, 0x32, 0x32, 0x3a, 0x3a, 
-	0x3a, 0x38, 0x38, 0x38, 0x22, 0x22, 0x1d, 0xe6, 
-	0xe6, 0x16, 0x2e, 0x2e, 0x28, 0x21, 0x21, 0x30, 
-	0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x35, 0x34, 0x34, 
-	0x3a, 0x3a, 0x3a, 0x00, 0x00, 0xe5, 0xd6, 0xd6, 
-	0xda, 0xdf, 0xdf, 0xf3, 0x1d, 0x1d, 0x0c, 0xf3, 
-	0xf3, 0x19, 0x19, 0x19, 0x31, 0x31, 0x2d, 0x1b, 
-	0x1b, 0xef, 0xdd, 0xdd, 0xd8, 0xd3, 0xd4, 0xe3, 
-	0xec, 0xec, 0x1f, 0x1f, 0x1b, 0xca, 0xca, 0xd3, 
-	0xe4, 0xe4, 0xd5, 0xd5, 0xdf, 0xdf, 0xe7, 0x36, 
-	0x36, 0x2e, 0x25, 0x25, 0x2a, 0x2f, 0x2f, 0x1b, 
-	0x13, 0x13, 0x31, 0x31, 0x33, 0x3a, 0x3a, 0x34, 
-	0x2e, 0x2e, 0x30, 0x33, 0x33, 0x2c, 0x2b, 0x2b, 
-	0x1d, 0x1d, 0x28, 0x38, 0x38, 0x30, 0x26, 0x26, 
-	0x2d, 0x30, 0x30, 0x2e, 0x2e, 0x2c, 0xef, 0xef, 
-	0x10, 0x1b, 0x1b, 0x00, 0xe4, 0xe4, 0x12, 0x13, 
-	0x13, 0xe4, 0xe4, 0x08, 0x1d, 0x1d, 0x1c, 0x1b, 
-	0x1b, 0xf2, 0xec, 0xec, 0x25, 0x25, 0x27, 0x29, 
-	0x29, 0x20, 0x13, 0x13, 0x1f, 0x20, 0x20, 0x33, 
-	0x33, 0x2e, 0x29, 0x29, 0x2e, 0x32, 0x32, 0x10, 
-	0x1f, 0x2e, 0x32, 0x32, 0x26, 0x10, 0x10, 0xef, 
-	0xe4, 0xe4, 0xe9, 0xef, 0xef, 0xe5, 0xe0, 0xe0, 
-	0x25, 0x29, 0x29, 0x00, 0xf3, 0xf3, 0xe6, 0xe6, 
-	0xe6, 0x2c, 0x2c, 0x2c, 0x20, 0x20, 0x20, 0x2d, 
-	0x2d, 0x2b, 0x19, 0x19, 0xf9, 0xd5, 0xd5, 0xd7, 
-	0xda, 0xda, 0xe1, 0xec, 0xec, 0x13, 0x20, 0x20, 
-	0x27, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x2f, 
-	0x2f, 0x2f, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x37, 
-	0x37, 0x37, 0x23, 0x23, 0x25, 0x2d, 0x2d, 0x20, 
-	0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xe9, 0xe9, 
-	0xe5, 0xe2, 0xe2, 0x12, 0x1d, 0x1d, 0x0d, 0x0c, 
-	0x0c, 0x2c, 0x2c, 0x2b, 0x1e, 0x1e, 0x13, 0xe1, 
-	0xe1, 0xf7, 0x1d, 0x1d, 0xef, 0xdc, 0xdc, 0xe5, 
-	0x00, 0x00, 0xdf, 0xda, 0xda, 0xe4, 0xe4, 0xe4, 
-	0x10, 0x10, 0x13, 0x22, 0x22, 0x22, 0x22, 0x22, 
-	0x10, 0xe4, 0xe4, 0xde, 0xd9, 0xd9, 0xef, 0x20, 
-	0x20, 0x14, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0x20, 
-	0x20, 0x20, 0xf4, 0xf4, 0xde, 0xc6, 0xc6, 0xc6, 
-	0xc6, 0xc6, 0xd4, 0x00, 0x00, 0xdd, 0xd1, 0xd1, 
-	0xe2, 0xec, 0xec, 0xe5, 0xe5, 0xe5, 0xdb, 0xdb, 
-	0xd8, 0xd1, 0xd1, 0xc9, 0xc6, 0xc6, 0xc6, 0xc6, 
-	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xdb, 
-	0xdb, 0xdc, 0xe1, 0xe1, 0xef, 0x16, 0x16, 0x1a, 
-	0x1e, 0x1e, 0xde, 0xd3, 0xd3, 0xd9, 0xd9, 0xd8, 
-	0xca, 0xca, 0xcc, 0xce, 0xea, 0x13, 0x13, 0x32, 
-	0x32, 0x32, 0x30, 0x30, 0x32, 0x34, 0x34, 0x2a, 
-	0x1c, 0x1c, 0xe5, 0xde, 0xde, 0xd6, 0xd6, 0xda, 
-	0xef, 0xef, 0x16, 0x21, 0x21, 0x21, 0x20, 0x20, 
-	0x27, 0x28, 0x28, 0x28, 0x28, 0x22, 0x10, 0x10, 
-	0x15, 0x18, 0x18, 0xee, 0xe1, 0xe1, 0xdf, 0xdf, 
-	0xdc, 0xd1, 0xd1, 0xcb, 0xc6, 0xc6, 0xc8, 0xc9, 
-	0xc9, 0xdb, 0xdc, 0xdb, 0xd4, 0xd4, 0xd0, 0xcb, 
-	0xcb, 0xca, 0xc9, 0xc9, 0xc7, 0xc7, 0xc6, 0xc6, 
-	0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xdc, 0xdc, 0xd1, 
-	0xd1, 0xd2, 0xd3, 0xd3, 0xd7, 0xdc, 0xdc, 0xe5, 
-	0xec, 0xec, 0xe4, 0xdc, 0xdc, 0xec, 0xec, 0xed, 
-	0xef, 0xef, 0xe2, 0xd6, 0xd6, 0xd2, 0xcf, 0xcf, 
-	0xda, 0xec, 0xec, 0x10, 0x1c, 0x1c, 0xee, 0xdb, 
-	0xdb, 0xf1, 0x20, 0x20, 0x0b, 0xe3, 0xe3, 0xdb, 
-	0xd5, 0xd5, 0xd3, 0xd2, 0xd2, 0xdc, 0xdf, 0xdf, 
-	0xdf, 0xdf, 0xdf, 0xd0, 0xd0, 0xd0, 0x20, 0x20, 
-	0x20, 0x24, 0x24, 0x1c, 0xd6, 0xd6, 0xd8, 0xdc, 
-	0xdc, 0xd2, 0xcb, 0xcb, 0xc6, 0xc6, 0xc6, 0xd2, 
-	0xf4, 0xf4, 0xde, 0xd2, 0xd2, 0xd1, 0xd0, 0xd0, 
-	0xd1, 0xd1, 0xd1, 0xcd, 0xcd, 0xcd, 0xd8, 0xd8, 
-	0xde, 0x20, 0x20, 0x20, 0x21, 0x21, 0x10, 0xe5, 
-	0xe5, 0xdb, 0xd4, 0xd4, 0xdf, 0xec, 0xec, 0x16, 
-	0x1a, 0x1a, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x1a, 
-	0xe3, 0xe3, 0xd8, 0xd0, 0xd0, 0xe0, 0x13, 0x13, 
-	0xee, 0xe1, 0xe1, 0xe9, 0x00, 0x00, 0x0a, 0x0b, 
-	0x0b, 0xd4, 0xd3, 0xd3, 0xd5, 0xd5, 0xd6, 0x10, 
-	0x10, 0x18, 0x22, 0x22, 0x28, 0x2d, 0x2d, 0x28, 
-	0x22, 0x22, 0x23, 0x24, 0x24, 0x1f, 0x1a, 0x1a, 
-	0x23, 0x24, 0x24, 0x30, 0x30, 0x28, 0xd3, 0xd3, 
-	0xcb, 0xc7, 0xc7, 0xd4, 0xef, 0xef, 0xda, 0xcf, 
-	0xcf, 0x0a, 0x28, 0x28, 0x31, 0x31, 0x31, 0x22, 
-	0x22, 0x19, 0xe5, 0xe5, 0xd6, 0xcb, 0xcb, 0xce, 
-	0xd1, 0xd1, 0xe2, 0x13, 0x13, 0xed, 0xec, 0xec, 
-	0xe7, 0xe7, 0xdf, 0xd7, 0xd7, 0xd4, 0xd2, 0xd2, 
-	0xd3, 0xd4, 0xd4, 0x17, 0x21, 0x21, 0xe3, 0xe3, 
-	0xea, 0x13, 0x13, 0x10, 0x0b, 0x0b, 0xea, 0xe0, 
-	0xe0, 0xdc, 0xda, 0xda, 0xd1, 0xd1, 0xd0, 0xcc, 
-	0xcc, 0xd9, 0xf4, 0xf4, 0x13, 0x1c, 0x1c, 0xed, 
-	0xe5, 0xe5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xdc, 
-	0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd6, 0xd6, 0xd8, 
-	0xde, 0xde, 0xee, 0x18, 0x18, 0xe1, 0xd0, 0xd0, 
-	0xcf, 0xcf, 0xd3, 0x21, 0x21, 0x21, 0x22, 0x22, 
-	0x22, 0x22, 0x22, 0x26, 0x26, 0x27, 0x2b, 0x2b, 
-	0x33, 0x38, 0x38, 0x31, 0x26, 0x26, 0x38, 0x38, 
-	0x35, 0xf4, 0xf4, 0x08, 0x0f, 0x0f, 0x2c, 0x38, 
-	0x38, 0x2b, 0x2b, 0xf8, 0x11, 0x38, 0x38, 0x2b, 
-	0x2b, 0x12, 0xc8, 0xc8, 0xcb, 0xce, 0xce, 0xd0, 
-	0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xcd, 0xcb, 0xcb, 
-	0xcc, 0xce, 0xce, 0xcb, 0xc7, 0xc7, 0xd0, 0xda, 
-	0xda, 0xe2, 0xf0, 0xf0, 0xeb, 0xea, 0xea, 0x03, 
-	0x0b, 0x0b, 0xd4, 0xd2, 0xd2, 0x0f, 0x0f, 0x0f, 
-	0xe7, 0xe7, 0xe4, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 
-	0xeb, 0x1f, 0x1f, 0x23, 0x27, 0x27, 0x25, 0x23, 
-	0x23, 0x19, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x14, 
-	0x18, 0x18, 0xcd, 0xcb, 0xcb, 0xe5, 0xe5, 0xed, 
-	0x22, 0x22, 0x18, 0xea, 0xea, 0x00, 0x15, 0x15, 
-	0xe9, 0xda, 0xda, 0xd7, 0xd4, 0xd4, 0xd0, 0xcd, 
-	0xcd, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xd0, 0x22, 
-	0x22, 0x24, 0x26, 0x26, 0x25, 0x25, 0x25, 0x1d, 
-	0x13, 0x13, 0x0d, 0x00, 0x00, 0x08, 0x0b, 0x0b, 
-	0x06, 0x00, 0x00, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 
-	0xdb, 0xdc, 0xdc, 0x1b, 0x32, 0x32, 0x31, 0x30, 
-	0x30, 0x21, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x2c, 
-	0x33, 0x33, 0x26, 0x26, 0x23, 0xd0, 0xd0, 0xd2, 
-	0xd6, 0xd6, 0xd5, 0xd4, 0xd4, 0xcf, 0xcb, 0xcb, 
-	0xd4, 0xe0, 0xe0, 0xe5, 0xe8, 0xe8, 0x1d, 0x1d, 
-	0x1c, 0x15, 0x15, 0x14, 0x12, 0x12, 0x15, 0x17, 
-	0x17, 0xe8, 0xd8, 0xd8, 0xdf, 0xe2, 0xe2, 0xdd, 
-	0xdd, 0xe3, 0x12, 0x12, 0x14, 0x15, 0x15, 0x1d, 
-	0x23, 0x23, 0x11, 0xe8, 0xe8, 0xe6, 0xe6, 0xe7, 
-	0x1d, 0x1d, 0x15, 0x00, 0x00, 0x1b, 0x26, 0x26, 
-	0x19, 0xf0, 0xf0, 0xdf, 0xdd, 0xdf, 0xf4, 0xf4, 
-	0xe7, 0xdf, 0xdf, 0xd9, 0xd5, 0xd5, 0xce, 0xca, 
-	0xca, 0xc8, 0xc8, 0xd2, 0x27, 0x27, 0x2d, 0x33, 
-	0x33, 0x2b, 0x20, 0x20, 0x06, 0xed, 0xed, 0x1d, 
-	0x1d, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x21, 
-	0x22, 0x22, 0x20, 0x20, 0x1b, 0x12, 0x12, 0x11, 
-	0x0f, 0x0f, 0xdd, 0xd4, 0xd4, 0xe8, 0xe8, 0x16, 
-	0x29, 0x29, 0x21, 0x15, 0x15, 0xf4, 0xea, 0xea, 
-	0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x1f, 0x24, 0x24, 
-	0x0e, 0xf4, 0xf0, 0xe0, 0xe0, 0xd4, 0xcc, 0xcc, 
-	0xd4, 0xdf, 0xdf, 0xd5, 0xcd, 0xcd, 0xd3, 0xda, 
-	0xda, 0xd8, 0xd7, 0xd7, 0xdc, 0xe2, 0xe2, 0xdb, 
-	0xd5, 0xd5, 0xd8, 0xdb, 0xdb, 0xce, 0xc8, 0xc8, 
-	0xcb, 0xcc, 0xcc, 0xd0, 0xd0, 0xd0, 0xc8, 0xc8, 
-	0xc8, 0xca, 0xca, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 
-	0xc8, 0xe7, 0x31, 0x31, 0x25, 0x12, 0x12, 0x15, 
-	0x17, 0x17, 0xf4, 0xe4, 0xe4, 0xe8, 0xed, 0xed, 
-	0xe7, 0xe4, 0xe4, 0x2f, 0x35, 0x35, 0x30, 0x30, 
-	0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x21, 0x15, 
-	0x15, 0x14, 0x12, 0x12, 0x21, 0x2b, 0x2b, 0x35, 
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 
-	0xd2, 0xd2, 0xd9, 0xe6, 0xe6, 0xe7, 0xe8, 0xe8, 
-	0x14, 0x23, 0x23, 0x25, 0x26, 0x26, 0x27, 0x28, 
-	0x28, 0x14, 0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0x29, 
-	0x2b, 0x2a, 0x20, 0x20, 0x1f, 0x1e, 0x1e, 0x26, 
-	0x2d, 0x2d, 0x2f, 0x30, 0x30, 0x31, 0x31, 0x31, 
-	0x31, 0x30, 0x30, 0x36, 0x36, 0x36, 0x2e, 0x2c, 
-	0x2b, 0x27, 0x27, 0x29, 0x2b, 0x2b, 0x2f, 0x33, 
-	0x33, 0x24, 0xf4, 0xf4, 0x08, 0x0f, 0x0f, 0xe5, 
-	0xdf, 0xdf, 0xdf, 0xdf, 0xe6, 0x22, 0x22, 0x20, 
-	0x1e, 0x1e, 0x2e, 0x36, 0x36, 0x35, 0x30, 0x30, 
-	0x2e, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 
-	0x30, 0x34, 0x34, 0x2f, 0x2b, 0x2b, 0x29, 0x27, 
-	0x27, 0x06, 0xe8, 0xe8, 0x21, 0x21, 0x1c, 0xe4, 
-	0xe4, 0xf7, 0x19, 0x19, 0x27, 0x30, 0x30, 0x1b, 
-	0x0b, 0x0b, 0x17, 0x17, 0x1f, 0x26, 0x26, 0x1a, 
-	0xf0, 0xf0, 0x0b, 0x15, 0x15, 0xf1, 0xed, 0xf4, 
-	0x22, 0x22, 0x28, 0x2d, 0x2d, 0x30, 0x33, 0x33, 
-	0xe6, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 
-	0xc9, 0xc9, 0xc9, 0xc9, 0xca, 0xca, 0xc9, 0xc9, 
-	0xc9, 0xc9, 0xc9, 0xc9, 0xcb, 0xcb, 0xd2, 0xdb, 
-	0xdb, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 0xd6, 0xd5, 
-	0xd5, 0xcf, 0xca, 0xca, 0xc9, 0xc9, 0xc9, 0xcc, 
-	0xcc, 0xcb, 0xca, 0xca, 0x13, 0x36, 0x36, 0x30, 
-	0x30, 0x34, 0x36, 0x36, 0x32, 0x2c, 0x2c, 0x25, 
-	0x1b, 0x1b, 0x1d, 0x23, 0x23, 0x2b, 0x34, 0x34, 
-	0x35, 0x36, 0x36, 0x16, 0xd0, 0xd0, 0xd3, 0xd7, 
-	0xd7, 0xda, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xe3, 
-	0xe8, 0xe8, 0x12, 0x21, 0x21, 0x27, 0x2d, 0x2d, 
-	0x2a, 0x27, 0x27, 0x10, 0xeb, 0xeb, 0x0f, 0x12, 
-	0x12, 0xe0, 0xe0, 0xde, 0xd2, 0xd2, 0xe0, 0x1f, 
-	0x1f, 0x20, 0x21, 0x21, 0x22, 0x23, 0x23, 0x23, 
-	0x23, 0x23, 0x20, 0x1c, 0x1c, 0x21, 0x26, 0x26, 
-	0xdd, 0xcd, 0xcd, 0xd9, 0xdc, 0xdc, 0xca, 0xca, 
-	0xcf, 0xdb, 0xdb, 0xd3, 0xcc, 0xcc, 0xcb, 0xca, 
-	0xca, 0xd6, 0xe8, 0xe8, 0x19, 0x28, 0x28, 0x23, 
-	0x1f, 0x1f, 0x13, 0x0b, 0x0b, 0xe7, 0xe6, 0xe8, 
-	0x1a, 0x1a, 0x1b, 0x1e, 0x1e, 0x21, 0x24, 0x24, 
-	0x00, 0xdb, 0xdb, 0xdd, 0xe0, 0xe0, 0xe8, 0x00, 
-	0x00, 0xe7, 0xde, 0xde, 0xf8, 0x19, 0x19, 0xe3, 
-	0xe0, 0xe1, 0x14, 0x14, 0x05, 0xe3, 0xe3, 0x10, 
-	0x23, 0x23, 0x2b, 0x32, 0x32, 0x29, 0x1e, 0x1e, 
-	0x21, 0x23, 0x23, 0xde, 0xd4, 0xd4, 0xe1, 0xe1, 
-	0xe1, 0xe1, 0xe1, 0xf4, 0x1a, 0x1a, 0x24, 0x2c, 
-	0x2c, 0x33, 0x35, 0x35, 0x32, 0x2e, 0x2e, 0x2c, 
-	0x2c, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-	0x35, 0x35, 0x32, 0x2e, 0x2e, 0xe9, 0xd2, 0xd2, 
-	0xe5, 0xe5, 0xeb, 0x18, 0x18, 0x08, 0xe9, 0xe9, 
-	0x00, 0x16, 0x16, 0x17, 0x18, 0x18, 0x1d, 0x20, 
-	0x20, 0x09, 0xeb, 0xeb, 0x1c, 0x1c, 0x0b, 0xe7, 
-	0xe7, 0x13, 0x23, 0x23, 0x34, 0x35, 0x33, 0x22, 
-	0x22, 0x25, 0x29, 0x29, 0x2b, 0x2c, 0x2c, 0x2e, 
-	0x2f, 0x2f, 0xeb, 0xe7, 0xe9, 0xed, 0xed, 0xf7, 
-	0x0f, 0x0f, 0x1e, 0x27, 0x27, 0x1b, 0x14, 0x0d, 
-	0xe7, 0xe7, 0x17, 0x27, 0x27, 0x1d, 0x00, 0x00, 
-	0x19, 0x1d, 0x1d, 0x18, 0x18, 0x0f, 0xf0, 0xf0, 
-	0xe3, 0xdb, 0xdb, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 
-	0xdb, 0xd6, 0xd6, 0xd4, 0xd3, 0xd3, 0xda, 0xdc, 
-	0xdc, 0xdb, 0xdb, 0xf0, 0x1f, 0x1f, 0x12, 0xeb, 
-	0xeb, 0xf1, 0xf5, 0x0f, 0x25, 0x25, 0x1c, 0x0a, 
-	0x0a, 0xe9, 0xdf, 0xdf, 0xdf, 0xe0, 0xe2, 0xe2, 
-	0xdc, 0xd7, 0xd7, 0xdd, 0xe5, 0xe5, 0xe2, 0xe0, 
-	0xe0, 0xe0, 0xe0, 0xe0, 0xea, 0x0a, 0x0a, 0x0f, 
-	0x12, 0x12, 0xe7, 0xe2, 0xe2, 0xd4, 0xd2, 0xd3, 
-	0xdf, 0xdf, 0xe3, 0x16, 0x16, 0x1d, 0x26, 0x26, 
-	0x1a, 0xf1, 0xf1, 0x07, 0x12, 0x12, 0x18, 0x1d, 
-	0x1d, 0x20, 0x23, 0x23, 0x1d, 0x16, 0x16, 0x17, 
-	0x18, 0x18, 0x1c, 0x1d, 0x1d, 0xeb, 0xe9, 0xea, 
-	0xee, 0xee, 0x15, 0x27, 0x27, 0x1c, 0xf5, 0xf5, 
-	0x19, 0x24, 0x24, 0x18, 0xf1, 0xf1, 0x0d, 0x16, 
-	0x16, 0x27, 0x2f, 0x2f, 0x2d, 0x2c, 0x2c, 0xe3, 
-	0xe0, 0xe4, 0x1c, 0x1c, 0x1e, 0x25, 0x25, 0x11, 
-	0xe2, 0xe2, 0xe8, 0xf1, 0xf1, 0x19, 0x25, 0x25, 
-	0x0e, 0xdf, 0xdf, 0xe1, 0xe3, 0xe3, 0xe4, 0xe5, 
-	0xe5, 0xde, 0xdb, 0xdb, 0xd0, 0xd0, 0xd3, 0xe1, 
-	0xe1, 0xe9, 0x00, 0x00, 0xe2, 0xd7, 0xd7, 0xda, 
-	0xdd, 0xdd, 0xd6, 0xd1, 0xd1, 0xdc, 0xf1, 0xf1, 
-	0xe0, 0xde, 0xdf, 0xe4, 0xe4, 0xe0, 0xdb, 0xdb, 
-	0xdc, 0xdd, 0xdd, 0xe7, 0x0a, 0x0a, 0xec, 0xe4, 
-	0xe4, 0xdb, 0xd7, 0xd7, 0xd2, 0xd2, 0xd4, 0xd7, 
-	0xd7, 0xdf, 0xeb, 0xeb, 0x0e, 0x1b, 0x1b, 0x22, 
-	0x28, 0x28, 0x19, 0x0a, 0x0a, 0x28, 0x29, 0x28, 
-	0x23, 0x23, 0x1b, 0x0e, 0x0e, 0x11, 0x14, 0x14, 
-	0xe7, 0xd9, 0xd9, 0xd5, 0xd2, 0xd2, 0xe0, 0xf1, 
-	0xf1, 0xe3, 0xe2, 0xe3, 0xe4, 0xe4, 0xde, 0xd9, 
-	0xd9, 0xd4, 0xd3, 0xd5, 0xd9, 0xd9, 0xd4, 0xd0, 
-	0xd0, 0xd0, 0xcf, 0xcf, 0xce, 0xcd, 0xcd, 0xd8, 
-	0xd8, 0xdb, 0xdf, 0xdf, 0xdc, 0xd9, 0xd9, 0xdc, 
-	0xdf, 0xdf, 0xcf, 0xcb, 0xcd, 0xd2, 0xd2, 0xd6, 
-	0xdb, 0xdb, 0xe6, 0x0e, 0x0e, 0xe7, 0xdf, 0xe0, 
-	0xe2, 0xe2, 0xe7, 0xee, 0xee, 0xd5, 0xcb, 0xcb, 
-	0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd5, 0xd6, 0xd6, 
-	0xda, 0xdd, 0xdd, 0xdb, 0xdb, 0xde, 0xe9, 0xe9, 
-	0xdc, 0xd4, 0xd4, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 
-	0xcc, 0xd4, 0xd4, 0xd9, 0xde, 0xde, 0xf1, 0x1b, 
-	0x1b, 0x1e, 0x21, 0x1f, 0x0a, 0x0a, 0xe1, 0xe1, 
-	0xe3, 0xe5, 0xe5, 0x18, 0x28, 0x28, 0x28, 0x27, 
-	0x27, 0x23, 0x1d, 0x1d, 0xf8, 0xe1, 0xe1, 0xe8, 
-	0xf5, 0xf5, 0x1b, 0x26, 0x26, 0x1f, 0x14, 0x14, 
-	0x1a, 0x1d, 0x1d, 0x10, 0x0a, 0x0c, 0x19, 0x19, 
-	0x1e, 0x28, 0x28, 0x26, 0x22, 0x22, 0xe6, 0xd0, 
-	0xd0, 0xd3, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd8, 
-	0xda, 0xda, 0xd2, 0xcc, 0xcc, 0xce, 0xd0, 0xd0, 
-	0xd9, 0xdb, 0xdb, 0xdd, 0xdd, 0xe8, 0x19, 0x19, 
-	0x1f, 0x24, 0x24, 0x23, 0x22, 0x22, 0x22, 0x23, 
-	0x23, 0x11, 0xe4, 0xe4, 0xdd, 0xd8, 0xd8, 0xe5, 
-	0x11, 0x11, 0x1d, 0x23, 0x23, 0xe6, 0xdc, 0xdd, 
-	0xe8, 0xe9, 0xe4, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 
-	0xe8, 0x18, 0x18, 0x18, 0x19, 0x19, 0x16, 0x11, 
-	0x11, 0xe3, 0xd6, 0xd6, 0xd9, 0xdc, 0xdc, 0xd8, 
-	0xd7, 0xdb, 0x1f, 0x1f, 0x10, 0xe4, 0xe4, 0xf5, 
-	0x18, 0x18, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0x11, 0x11, 0x11, 0xe5, 0xdf, 0xde, 0xdc, 0xdc, 
-	0xd9, 0xd5, 0xd5, 0xdd, 0xe9, 0xe9, 0xee, 0xf5, 
-	0xf5, 0x12, 0x1b, 0x1b, 0xf3, 0xe3, 0xe4, 0x06, 
-	0x0a, 0xee, 0xe4, 0xe4, 0xe3, 0xe1, 0xe1, 0xe6, 
-	0xec, 0xec, 0xde, 0xd5, 0xd5, 0xf5, 0x28, 0x28, 
-	0x20, 0x1c, 0x1a, 0xdd, 0xdb, 0xe0, 0xe9, 0xe9, 
-	0xdb, 0xd2, 0xd2, 0xdc, 0xec, 0xec, 0xe4, 0xdf, 
-	0xdf, 0xdc, 0xda, 0xda, 0xd6, 0xd5, 0xd8, 0xe8, 
-	0xe8, 0xdf, 0xd8, 0xd8, 0xd3, 0xd2, 0xe2, 0x1e, 
-	0x1e, 0x1f, 0x20, 0x20, 0x22, 0x24, 0x24, 0x24, 
-	0x25, 0x1c, 0xd4, 0xd4, 0xd0, 0xcc, 0xcc, 0xd4, 
-	0xde, 0xde, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd5, 
-	0xd1, 0xd1, 0xd9, 0xe3, 0xe3, 0xde, 0xd9, 0xd9, 
-	0xd8, 0xd7, 0xd2, 0xce, 0xce, 0xd0, 0xd2, 0xd2, 
-	0xdd, 0xf1, 0xee, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 
-	0xde, 0xea, 0xea, 0xe0, 0xd8, 0xd8, 0x25, 0x2f, 
-	0x2c, 0x21, 0x21, 0x13, 0xea, 0xea, 0xf0, 0x00, 
-	0x00, 0xf2, 0xee, 0xf0, 0x00, 0x00, 0xe8, 0xdf, 
-	0xdf, 0xf0, 0x19, 0x19, 0x0e, 0xee, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xde, 0xd5, 0xd5, 0xdf, 
-	0xf1, 0xf1, 0xe0, 0xd9, 0xd9, 0xe2, 0xe5, 0xe7, 
-	0x20, 0x23, 0x25, 0x28, 0x28, 0x19, 0xe3, 0xe3, 
-	0x0c, 0x20, 0x20, 0x1d, 0x1a, 0x1a, 0x1c, 0x1d, 
-	0x1d, 0x22, 0x25, 0x25, 0x27, 0x28, 0x28, 0x22, 
-	0x1a, 0x1a, 0x1f, 0x23, 0x23, 0x24, 0x24, 0x23, 
-	0x15, 0x13, 0x17, 0x1d, 0x1d, 0x19, 0x13, 0x13, 
-	0xf5, 0xe8, 0xe8, 0xe5, 0xe2, 0xe2, 0xe4, 0xe6, 
-	0xe6, 0xf5, 0x15, 0x15, 0xe6, 0xd8, 0xd8, 0xde, 
-	0xe6, 0xe6, 0xdc, 0xd7, 0xd7, 0xd8, 0xd8, 0xd9, 
-	0xe0, 0xe0, 0xd9, 0xcf, 0xcf, 0xd6, 0xdf, 0xdf, 
-	0xdc, 0xda, 0xda, 0xd3, 0xce, 0xce, 0xcd, 0xcd, 
-	0xcd, 0xce, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xd1, 
-	0xd6, 0xd6, 0xd8, 0xd8, 0xdb, 0xe2, 0xe2, 0xd7, 
-	0xcf, 0xcf, 0xd2, 0xd5, 0xd5, 0xd7, 0xd9, 0xd9, 
-	0xdc, 0xe1, 0xe1, 0x00, 0x1e, 0x1e, 0xf1, 0xea, 
-	0x08, 0x21, 0x21, 0x21, 0x22, 0x22, 0x21, 0x20, 
-	0x20, 0x18, 0x0a, 0x0a, 0xea, 0xe1, 0xe1, 0xde, 
-	0xdc, 0xdb, 0xd5, 0xd5, 0x00, 0x2a, 0x2a, 0x20, 
-	0x0e, 0x0e, 0x1f, 0x29, 0x29, 0x1f, 0x0e, 0x0e, 
-	0x11, 0x13, 0x13, 0x07, 0xf5, 0x09, 0x20, 0x21, 
-	0x1d, 0x17, 0x17, 0x19, 0x1c, 0x1c, 0xf3, 0xdf, 
-	0xdf, 0xe4, 0xea, 0xea, 0xe5, 0xe1, 0xe1, 0xe2, 
-	0xe2, 0xdd, 0xd0, 0xd0, 0xde, 0x0a, 0x0a, 0xea, 
-	0xe1, 0xe1, 0xe3, 0xe5, 0xe3, 0xe2, 0xe2, 0x13, 
-	0x26, 0x26, 0x20, 0x1a, 0x16, 0xea, 0xea, 0xdf, 
-	0xd7, 0xd7, 0xf0, 0x23, 0x23, 0x1c, 0x10, 0x10, 
-	0xe7, 0xe4, 0xf5, 0x18, 0x18, 0xef, 0xde, 0xde, 
-	0xdd, 0xdc, 0xdc, 0xe6, 0xec, 0xef, 0xf5, 0xf5, 
-	0xed, 0xe8, 0xe8, 0x0a, 0x1a, 0x1a, 0xe9, 0xe0, 
-	0xea, 0x0e, 0x0e, 0x1f, 0x29, 0x29, 0x25, 0x21, 
-	0x21, 0x14, 0xec, 0xec, 0xec, 0xec, 0xe8, 0xe5, 
-	0xe5, 0xe4, 0xe2, 0xe2, 0xf1, 0x17, 0x16, 0x06, 
-	0xf5, 0x16, 0x1f, 0x1f, 0x28, 0x2f, 0x2f, 0x26, 
-	0x18, 0x18, 0x2b, 0x30, 0x2b, 0x25, 0x25, 0x21, 
-	0x21, 0x25, 0x21, 0x1d, 0x1d, 0x28, 0x30, 0x30, 
-	0x2d, 0x2b, 0x2b, 0x23, 0x1d, 0x1d, 0x1d, 0x1d, 
-	0x1b, 0x0f, 0x0e, 0x09, 0xf5, 0xf5, 0xea, 0xe4, 
-	0xe4, 0xe2, 0xe0, 0xe0, 0xf5, 0x1d, 0x1d, 0x21, 
-	0x25, 0x25, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x31, 
-	0x28, 0x17, 0x17, 0x12, 0x0e, 0x10, 0x23, 0x26, 
-	0x28, 0x2c, 0x2c, 0x21, 0x10, 0x10, 0x15, 0x18, 
-	0x18, 0x07, 0xe8, 0xe8, 0x0a, 0x1a, 0x1a, 0x17, 
-	0x15, 0x15, 0x0a, 0xef, 0xef, 0xf2, 0xf5, 0xf5, 
-	0xe5, 0xdc, 0xdc, 0x20, 0x31, 0x31, 0x31, 0x31, 
-	0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x23, 
-	0x23, 0x1b, 0x0d, 0x0d, 0x13, 0x16, 0x16, 0xec, 
-	0xde, 0xde, 0xe4, 0xec, 0xec, 0x00, 0x13, 0x13, 
-	0xdf, 0xd8, 0xd8, 0xd9, 0xd9, 0xd3, 0xce, 0xce, 
-	0xd4, 0xdd, 0xdd, 0xd5, 0xce, 0xce, 0xd4, 0xdc, 
-	0xdc, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 
-	0xd3, 0xd2, 0xd1, 0xd1, 0xda, 0xe5, 0xe5, 0xe3, 
-	0xe1, 0xe1, 0xf0, 0x16, 0x16, 0x13, 0x0d, 0x0d, 
-	0x11, 0x13, 0xf3, 0xde, 0xde, 0x0f, 0x26, 0x26, 
-	0x1c, 0x00, 0x00, 0xf3, 0xef, 0xef, 0x15, 0x20, 
-	0x20, 0x0f, 0xe5, 0xe5, 0x12, 0x20, 0x1a, 0xda, 
-	0xd4, 0xd6, 0xda, 0xda, 0xe2, 0xef, 0xef, 0xdd, 
-	0xd3, 0xd3, 0xdf, 0xf5, 0xf5, 0xe9, 0xe1, 0xe1, 
-	0xe4, 0xe7, 0xea, 0xf9, 0x00, 0xdc, 0xcf, 0xcf, 
-	0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-	0xd4, 0xdb, 0xdb, 0xdb, 0xdb, 0xd3, 0xcf, 0xcf, 
-	0xcf, 0xd2, 0xd2, 0xe3, 0x19, 0x19, 0x12, 0x00, 
-	0xf9, 0xf3, 0xf2, 0x14, 0x1f, 0x1f, 0xf2, 0xdc, 
-	0xdc, 0xe3, 0xed, 0xf1, 0x18, 0x1c, 0x1d, 0x1d, 
-	0x1d, 0xed, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xe8, 
-	0xef, 0xf2, 0xf5, 0xf5, 0xea, 0xe3, 0xe3, 0xf0, 
-	0x14, 0x14, 0x07, 0xed, 0xe6, 0xda, 0xd9, 0xf2, 
-	0x22, 0x22, 0x24, 0x27, 0x27, 0x28, 0x29, 0x29, 
-	0x2a, 0x2b, 0x29, 0x27, 0x27, 0x2c, 0x30, 0x30, 
-	0x28, 0x1e, 0x1f, 0x20, 0x21, 0x07, 0xdf, 0xdf, 
-	0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xda, 0xd6, 
-	0xd6, 0xd7, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd5, 
-	0xd1, 0xd1, 0xd5, 0xd9, 0xd9, 0xd3, 0xcf, 0xcf, 
-	0xd0, 0xd1, 0xd2, 0xdf, 0xe6, 0xe8, 0xf1, 0xf2, 
-	0x0d, 0x18, 0x18, 0x00, 0xe7, 0xe7, 0xf6, 0x14, 
-	0x14, 0xf8, 0xe9, 0xe9, 0xec, 0xef, 0xef, 0xe8, 
-	0xe3, 0xe3, 0x00, 0x1c, 0x1c, 0x16, 0x10, 0x10, 
-	0x09, 0x00, 0xf6, 0xea, 0xe7, 0xe9, 0xec, 0xed, 
-	0xec, 0xeb, 0xeb, 0x0f, 0x1c, 0x1c, 0x09, 0xe6, 
-	0xe6, 0xe9, 0xed, 0xed, 0xf8, 0x10, 0x10, 0x07, 
-	0xf2, 0xf2, 0xe9, 0xe3, 0xe3, 0xe1, 0xdf, 0xdf, 
-	0xe8, 0xf2, 0xf3, 0x06, 0x09, 0x10, 0x18, 0x18, 
-	0x0d, 0xef, 0xef, 0x0d, 0x18, 0x18, 0x1e, 0x23, 
-	0x23, 0x13, 0xe6, 0xe6, 0xe0, 0xdb, 0xdb, 0xd2, 
-	0xd0, 0xd0, 0xd6, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 
-	0xdf, 0xdf, 0xe8, 0x09, 0x09, 0xf2, 0xeb, 0xeb, 
-	0xdf, 0xd7, 0xd7, 0xd3, 0xd0, 0xd1, 0xde, 0xe5, 
-	0xdf, 0xd9, 0xd9, 0xe2, 0xef, 0xef, 0xf4, 0x00, 
-	0x00, 0x17, 0x20, 0x20, 0x1c, 0x17, 0x17, 0x0e, 
-	0xf2, 0xf2, 0xf2, 0xf2, 0x08, 0x16, 0x17, 0x1b, 
-	0x1e, 0x1e, 0x09, 0xe3, 0xe3, 0xea, 0xf6, 0xf6, 
-	0x11, 0x19, 0x19, 0x00, 0xe6, 0xe6, 0xef, 0x00, 
-	0xf3, 0xec, 0xeb, 0xdc, 0xd2, 0xd2, 0xd8, 0xe0, 
-	0xe0, 0xd7, 0xd1, 0xd1, 0xd2, 0xd3, 0xd3, 0xda, 
-	0xe1, 0xe1, 0xe0, 0xe0, 0xdd, 0xdb, 0xda, 0xd9, 
-	0xd9, 0xd8, 0xd7, 0xd7, 0xd3, 0xd0, 0xd0, 0xe5, 
-	0x1b, 0x15, 0xf2, 0xf2, 0xe5, 0xdd, 0xdd, 0xe1, 
-	0xe6, 0xe6, 0xe2, 0xde, 0xdc, 0xd9, 0xd8, 0xdf, 
-	0xe8, 0xe8, 0xdd, 0xd5, 0xd5, 0xe4, 0x16, 0x09, 
-	0xe5, 0xe4, 0xe9, 0xf2, 0xf2, 0x07, 0x10, 0x10, 
-	0x07, 0xf2, 0xf2, 0xeb, 0xe8, 0xec, 0xf2, 0xf2, 
-	0xed, 0xe9, 0xe9, 0x0e, 0x1d, 0x1d, 0x1e, 0x1f, 
-	0x1d, 0x17, 0x16, 0x0d, 0xf2, 0xf2, 0xec, 0xe8, 
-	0xe8, 0xf6, 0x14, 0x15, 0x1b, 0x1d, 0x28, 0x2f, 
-	0x2f, 0x28, 0x1c, 0x1c, 0x1c, 0x1b, 0x1d, 0x26, 
-	0x29, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 
-	0x19, 0xf2, 0xf2, 0x15, 0x20, 0x20, 0x24, 0x26, 
-	0x27, 0x2a, 0x2b, 0x26, 0x1b, 0x1b, 0x1b, 0x1b, 
-	0x1b, 0x1f, 0x23, 0x23, 0x26, 0x29, 0x29, 0x2d, 
-	0x2e, 0x2e, 0x2b, 0x25, 0x25, 0x1b, 0x00, 0x00, 
-	0xf6, 0xf2, 0xf2, 0xe9, 0xe3, 0xe3, 0xe4, 0xe4, 
-	0xe6, 0xed, 0xf0, 0xe7, 0xde, 0xdd, 0xe5, 0xf0, 
-	0xf0, 0x12, 0x1c, 0x1c, 0x14, 0xf6, 0xf6, 0x16, 
-	0x20, 0x20, 0xf0, 0xda, 0xda, 0xe0, 0xe8, 0xe8, 
-	0xed, 0xf6, 0xf6, 0xea, 0xe3, 0xe3, 0xe0, 0xdd, 
-	0xdd, 0xdf, 0xdf, 0xdc, 0xd3, 0xd1, 0xd1, 0xd3, 
-	0xd3, 0xe5, 0x1b, 0x1b, 0x1d, 0x1e, 0x1e, 0xeb, 
-	0xd7, 0xd7, 0xe1, 0xf6, 0xf6, 0xf2, 0xf0, 0xf0, 
-	0xee, 0xed, 0xed, 0xea, 0xe8, 0xe9, 0xea, 0xea, 
-	0xea, 0xea, 0xea, 0xe9, 0xe8, 0xe8, 0xeb, 0xed, 
-	0xed, 0xe1, 0xd9, 0xd9, 0xda, 0xdc, 0xdc, 0xdd, 
-	0xde, 0xda, 0xd3, 0xd1, 0xd6, 0xdc, 0xdc, 0xd9, 
-	0xd7, 0xd7, 0xe0, 0xf0, 0xf0, 0x09, 0x13, 0x13, 
-	0xf4, 0xe7, 0xe7, 0xe6, 0xe5, 0xe8, 0xf0, 0xf6, 
-	0xe9, 0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe2, 0xe0, 
-	0xe0, 0xe6, 0xf0, 0xf0, 0x12, 0x1d, 0x1d, 0x16, 
-	0x09, 0xf7, 0xde, 0xd5, 0xd9, 0xde, 0xdf, 0xe4, 
-	0xec, 0xec, 0xf6, 0x0f, 0x0f, 0x16, 0x1b, 0x1b, 
-	0xf9, 0xe3, 0xe3, 0xe7, 0xec, 0xed, 0xef, 0xf0, 
-	0xea, 0xe6, 0xe6, 0xe5, 0xe4, 0xe4, 0xef, 0x0f, 
-	0xeb, 0xe0, 0xe0, 0xed, 0x13, 0x0e, 0xf4, 0xf2, 
-	0x13, 0x1d, 0x1d, 0x18, 0x11, 0x11, 0xec, 0xe0, 
-	0xe5, 0x10, 0x19, 0x13, 0x09, 0x09, 0x13, 0x19, 
-	0x19, 0x1a, 0x1b, 0x1d, 0x22, 0x25, 0x1c, 0x0d, 
-	0x0d, 0x09, 0x00, 0x00, 0xf2, 0xee, 0xee, 0xec, 
-	0xea, 0x06, 0x20, 0x25, 0x20, 0x19, 0x19, 0x0f, 
-	0xf0, 0xf0, 0xf9, 0x0d, 0x0e, 0x18, 0x1d, 0x23, 
-	0x29, 0x29, 0x22, 0x19, 0x19, 0x21, 0x27, 0x27, 
-	0x0b, 0xda, 0xe1, 0xee, 0xee, 0xe3, 0xdc, 0xdc, 
-	0xdb, 0xd9, 0xd9, 0xd5, 0xd2, 0xd6, 0xdb, 0xdb, 
-	0xdc, 0xdd, 0xdd, 0xe5, 0xf3, 0xf3, 0xe5, 0xe5, 
-	0xf3, 0xf3, 0x11, 0x1a, 0x1a, 0x14, 0x09, 0x09, 
-	0x09, 0x09, 0xf7, 0xed, 0xea, 0xe9, 0xe8, 0xe7, 
-	0xef, 0x09, 0x09, 0xe7, 0xdd, 0xdd, 0xde, 0xdf, 
-	0xdf, 0xdf, 0xde, 0xde, 0xe5, 0xee, 0xee, 0xf6, 
-	0x0c, 0x0c, 0x17, 0x1e, 0x1e, 0x1f, 0x21, 0x21, 
-	0x20, 0x20, 0x20, 0x1f, 0x1f, 0x23, 0x28, 0x2a, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x00, 
-	0x00, 0x1d, 0x27, 0x27, 0x21, 0x19, 0x19, 0x1d, 
-	0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1d, 0x1b, 0x1b, 
-	0x20, 0x23, 0x23, 0x26, 0x28, 0x24, 0x16, 0xf6, 
-	0xe7, 0xde, 0xdd, 0xe3, 0xec, 0xec, 0xf4, 0x0c, 
-	0x0c, 0x00, 0xf3, 0xf3, 0xee, 0xea, 0xea, 0xde, 
-	0xd6, 0xd6, 0xd9, 0xdb, 0xdb, 0xdd, 0xde, 0xe0, 
-	0xe4, 0xe5, 0xea, 0xf3, 0xf3, 0xe5, 0xdd, 0xdd, 
-	0xe3, 0xea, 0xea, 0x0e, 0x1b, 0x1b, 0x18, 0x13, 
-	0x17, 0x22, 0x29, 0x22, 0x17, 0x13, 0x18, 0x1c, 
-	0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x11, 
-	0xf6, 0xf6, 0xe6, 0xdd, 0xdd, 0xe1, 0xe6, 0xe5, 
-	0xe3, 0xe1, 0xe8, 0x08, 0x0f, 0x0e, 0x0c, 0x0c, 
-	0x1b, 0x24, 0x24, 0x23, 0x21, 0x21, 0x19, 0x09, 
-	0x09, 0xe8, 0xdf, 0xdf, 0xe3, 0xe8, 0xe3, 0xdf, 
-	0xde, 0x13, 0x29, 0x29, 0x20, 0x11, 0x11, 0x12, 
-	0x13, 0x13, 0x18, 0x1c, 0x1c, 0x1e, 0x20, 0x20, 
-	0x1f, 0x1e, 0x20, 0x21, 0x21, 0x1b, 0x13, 0x13, 
-	0x14, 0x16, 0x18, 0x1a, 0x19, 0x16, 0x13, 0x19, 
-	0x1d, 0x1d, 0xea, 0xd7, 0xd7, 0xdc, 0xe3, 0xe2, 
-	0xde, 0xda, 0xe0, 0xe8, 0xe9, 0x09, 0x19, 0x19, 
-	0x17, 0x14, 0x14, 0x17, 0x19, 0x15, 0x0d, 0xf6, 
-	0x13, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0xef, 0xdc, 
-	0xdc, 0xdf, 0xe3, 0xe7, 0xec, 0xee, 0xeb, 0xe9, 
-	0xe9, 0xf2, 0x0c, 0x0c, 0x13, 0x17, 0x12, 0xf1, 
-	0xe6, 0xea, 0xee, 0xee, 0xdf, 0xd5, 0xd5, 0xd8, 
-	0xdc, 0xdf, 0xee, 0x17, 0x1c, 0x20, 0x20, 0x23, 
-	0x25, 0x25, 0x22, 0x1f, 0x1d, 0x11, 0xee, 0x00, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0xf6, 0x0b, 
-	0x0f, 0x0c, 0xf6, 0xf6, 0x14, 0x1d, 0x1d, 0x1d, 
-	0x1e, 0x1e, 0x1f, 0x20, 0x20, 0x23, 0x26, 0x26, 
-	0x09, 0xdb, 0xda, 0xd5, 0xd3, 0xd6, 0xe1, 0xee, 
-	0xf0, 0xf2, 0xf3, 0xe5, 0xdd, 0xdd, 0xde, 0xe0, 
-	0xe0, 0xe9, 0x09, 0x09, 0x13, 0x18, 0x18, 0x00, 
-	0xe7, 0xe7, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 
-	0xdb, 0xd5, 0xd5, 0xdd, 0xe7, 0xe7, 0xef, 0x0c, 
-	0x09, 0xf3, 0xed, 0xf0, 0xf9, 0x09, 0x0a, 0x0c, 
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x11, 0x11, 0x0d, 
-	0x09, 0x09, 0x19, 0x22, 0x22, 0x25, 0x27, 0x27, 
-	0x21, 0x1b, 0x1b, 0x15, 0x0c, 0x15, 0x25, 0x2b, 
-	0x2b, 0x2b, 0x2b, 0x2b, 0x25, 0x25, 0x21, 0x1c, 
-	0x1c, 0x11, 0xee, 0xee, 0xf9, 0x0e, 0x0e, 0x00, 
-	0xf1, 0xf1, 0xe9, 0xe3, 0xec, 0x19, 0x25, 0x21, 
-	0x1c, 0x1a, 0x23, 0x29, 0x29, 0x2a, 0x2b, 0x2b, 
-	0x19, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xee, 0x11, 
-	0x11, 0x11, 0x12, 0xf5, 0xe6, 0xe1, 0xde, 0xdb, 
-	0xdb, 0xe1, 0xe7, 0xe7, 0xea, 0xed, 0xed, 0x12, 
-	0x1e, 0x1e, 0x15, 0xf6, 0xf6, 0x15, 0x1d, 0x1e, 
-	0x20, 0x22, 0x16, 0xf0, 0xe5, 0xe7, 0xea, 0xea, 
-	0x0a, 0x19, 0x19, 0x1f, 0x23, 0x23, 0x06, 0xdc, 
-	0xdc, 0xe3, 0xed, 0xe7, 0xe0, 0xd9, 0xdf, 0xe6, 
-	0xe8, 0xe5, 0xe2, 0xe2, 0xe0, 0xde, 0xde, 0xe3, 
-	0xe8, 0xe8, 0xe2, 0xdd, 0xdf, 0xe4, 0xeb, 0xe5, 
-	0xe1, 0xe1, 0xe3, 0xe5, 0xe8, 0xeb, 0xeb, 0xf2, 
-	0x08, 0xf6, 0xef, 0xeb, 0xe8, 0xe5, 0xe5, 0xe6, 
-	0xe7, 0xe7, 0xeb, 0xf1, 0xf1, 0xf2, 0xf3, 0x13, 
-	0x1c, 0x1c, 0x18, 0x14, 0x14, 0x19, 0x1d, 0x1d, 
-	0x18, 0x12, 0x14, 0x17, 0x1a, 0x0d, 0xeb, 0xeb, 
-	0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1a, 0x0e, 
-	0xf5, 0xed, 0xea, 0x00, 0x15, 0x15, 0x0c, 0xf1, 
-	0xf1, 0xee, 0xeb, 0xf7, 0x12, 0x19, 0x14, 0x0e, 
-	0x0e, 0x08, 0xf7, 0xf7, 0x1c, 0x27, 0x27, 0x27, 
-	0x27, 0x25, 0x23, 0x23, 0x22, 0x21, 0x21, 0x24, 
-	0x27, 0x23, 0x1e, 0x18, 0x17, 0x16, 0x16, 0x1d, 
-	0x21, 0x21, 0x1d, 0x18, 0x1d, 0x21, 0x21, 0x20, 
-	0x1f, 0x22, 0x25, 0x28, 0x1c, 0x08, 0xf1, 0xeb, 
-	0xe6, 0xe6, 0xeb, 0xf3, 0xf3, 0xe7, 0xdf, 0xdf, 
-	0xec, 0x14, 0x14, 0x0f, 0x08, 0x08, 0x00, 0xf7, 
-	0xf7, 0xeb, 0xe4, 0xe4, 0xe0, 0xdd, 0xdd, 0xda, 
-	0xd8, 0xd8, 0xd8, 0xd7, 0xd9, 0xdf, 0xe9, 0xf7, 
-	0x18, 0x22, 0x1d, 0x17, 0x13, 0x18, 0x1b, 0x1c, 
-	0x20, 0x24, 0x24, 0x0c, 0xde, 0xde, 0xe7, 0x00, 
-	0x00, 0xe5, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xf5, 
-	0x22, 0x22, 0x1e, 0x1a, 0x19, 0x0e, 0xed, 0xf6, 
-	0x0f, 0x15, 0x17, 0x19, 0x1a, 0x1e, 0x21, 0x21, 
-	0x1b, 0x13, 0x13, 0x16, 0x19, 0x19, 0x19, 0x19, 
-	0x19, 0x18, 0x17, 0x17, 0x0f, 0xf3, 0xf0, 0xed, 
-	0xe9, 0x11, 0x1b, 0x1f, 0x13, 0xed, 0xed, 0xf7, 
-	0x0e, 0x0e, 0x10, 0x12, 0x12, 0xe9, 0xdd, 0xdd, 
-	0xdc, 0xdc, 0xd9, 0xd6, 0xd5, 0xd5, 0xd7, 0xda, 
-	0xe1, 0xe9, 0xea, 0xe7, 0xe3, 0xe3, 0xdd, 0xd8, 
-	0xd8, 0xdf, 0xe7, 0xe7, 0xd7, 0xd5, 0xd5, 0xd5, 
-	0xd5, 0xd5, 0xd5, 0xd8, 0xd9, 0xda, 0xdb, 0xe0, 
-	0xe6, 0xe7, 0xe4, 0xe2, 0xe2, 0xdc, 0xd7, 0xd7, 
-	0xdb, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 
-	0xe4, 0xe9, 0xef, 0x08, 0x13, 0x13, 0x0d, 0xf7, 
-	0xf7, 0xf7, 0xf7, 0xf7, 0x10, 0x17, 0x17, 0x1a, 
-	0x1c, 0x0e, 0xec, 0xe2, 0xe0, 0xdf, 0xdf, 0xe0, 
-	0xe2, 0xe2, 0xdd, 0xd9, 0xd9, 0xdb, 0xe2, 0xe6, 
-	0xe9, 0xdb, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xdd, 
-	0xf1, 0x0f, 0x17, 0x1c, 0x1f, 0x21, 0x21, 0x1d, 
-	0x18, 0x18, 0x18, 0x17, 0x17, 0x1a, 0x1c, 0x18, 
-	0x14, 0x0e, 0xef, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 
-	0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe4, 0xe2, 0xe1, 
-	0xde, 0xdb, 0xdb, 0xde, 0xe2, 0xe2, 0xf7, 0x1b, 
-	0x14, 0x09, 0xef, 0x0f, 0x19, 0x19, 0x1d, 0x20, 
-	0x20, 0x1e, 0x1c, 0x1a, 0x18, 0x16, 0x17, 0x18, 
-	0x18, 0x1c, 0x20, 0x20, 0x15, 0xf1, 0xf0, 0xef, 
-	0xee, 0xe6, 0xe0, 0xe0, 0xdc, 0xd8, 0xd8, 0xda, 
-	0xdb, 0xdd, 0xdf, 0xe0, 0xde, 0xdf, 0xdc, 0xde, 
-	0xe0, 0xe9, 0xf2, 0x0b, 0xef, 0xe8, 0xe7, 0xea, 
-	0xee, 0xee, 0xf5, 0x0b, 0x0b, 0xec, 0xe3, 0xe3, 
-	0xdd, 0xd7, 0xd7, 0xda, 0xdd, 0xdd, 0xe5, 0xf1, 
-	0xf1, 0xe6, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 
-	0xe8, 0xe9, 0xeb, 0xef, 0xf2, 0xf5, 0x08, 0x13, 
-	0x18, 0x1d, 0x1a, 0x18, 0x17, 0x1a, 0x1c, 0x1d, 
-	0x20, 0x24, 0x24, 0x22, 0x20, 0x20, 0x20, 0x1f, 
-	0x1f, 0x19, 0x11, 0x11, 0x19, 0x1f, 0x1f, 0x1a, 
-	0x14, 0x14, 0x00, 0xeb, 0xed, 0xf1, 0x08, 0x0f, 
-	0x11, 0x14, 0xf7, 0xeb, 0xe8, 0xe3, 0xdf, 0xdf, 
-	0xe8, 0x08, 0x08, 0xec, 0xe3, 0xe3, 0xe0, 0xdc, 
-	0xdc, 0xe0, 0xe5, 0xe5, 0xe6, 0xe7, 0xe6, 0xe5, 
-	0xe3, 0xe1, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf, 
-	0xdf, 0xdf, 0xf2, 0x1b, 0x1b, 0x10, 0xf0, 0xf0, 
-	0x1c, 0x28, 0x27, 0x26, 0x23, 0x20, 0x1f, 0x1d, 
-	0x20, 0x22, 0x23, 0x23, 0x24, 0x24, 0x1e, 0x16, 
-	0x16, 0xf3, 0xe3, 0xe3, 0xe8, 0xee, 0xee, 0xec, 
-	0xeb, 0xec, 0xf0, 0xf7, 0xf4, 0xf2, 0xf0, 0xf1, 
-	0xf1, 0xf2, 0xe8, 0xe1, 0xe1, 0xe9, 0xf7, 0xf7, 
-	0x0d, 0x14, 0x14, 0x15, 0x16, 0x15, 0x0f, 0xf7, 
-	0x0b, 0x0f, 0x12, 0xee, 0xe3, 0xe2, 0xe5, 0xe8, 
-	0xe8, 0xeb, 0xee, 0xee, 0xf9, 0x0f, 0x0f, 0x0f, 
-	0x0f, 0x0f, 0x0e, 0x0d, 0xf2, 0xe9, 0xe9, 0xf5, 
-	0x12, 0x12, 0x0e, 0x08, 0x08, 0x12, 0x17, 0x13, 
-	0x0c, 0x0a, 0x15, 0x15, 0x1b, 0x1f, 0x1f, 0x1d, 
-	0x1b, 0x1c, 0x1d, 0x1e, 0x19, 0x12, 0x12, 0xf4, 
-	0xe8, 0xe8, 0xf1, 0x0d, 0x0d, 0x14, 0x18, 0x0c, 
-	0xf2, 0xe9, 0x1d, 0x28, 0x28, 0x28, 0x25, 0x25, 
-	0x26, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 
-	0x28, 0x26, 0x26, 0x22, 0x1e, 0x1e, 0x1d, 0x1b, 
-	0xfa, 0xe9, 0xe0, 0xe3, 0xe7, 0xe7, 0xf9, 0x17, 
-	0x17, 0xf4, 0xe4, 0xed, 0xf4, 0x14, 0xf9, 0xea, 
-	0xea, 0xeb, 0xed, 0xed, 0xe8, 0xe4, 0xe6, 0xe7, 
-	0xe9, 0x09, 0x19, 0x19, 0x18, 0x17, 0x17, 0x16, 
-	0x15, 0x0e, 0x0a, 0xf7, 0xf9, 0x00, 0x0f, 0x08, 
-	0xf7, 0xf8, 0xf9, 0x00, 0x0b, 0x0d, 0x11, 0x11, 
-	0x12, 0x12, 0x1f, 0x26, 0x27, 0x23, 0x1c, 0x1c, 
-	0x1e, 0x20, 0x20, 0x1e, 0x1c, 0x1c, 0x13, 0xf7, 
-	0xf7, 0x11, 0x18, 0x18, 0x13, 0x0d, 0x0d, 0x13, 
-	0x18, 0x18, 0x13, 0x0b, 0x0b, 0xec, 0xe3, 0xe3, 
-	0xf7, 0x1a, 0x1a, 0x1c, 0x1e, 0x1a, 0x18, 0x0f, 
-	0x15, 0x16, 0x1a, 0x17, 0x16, 0x15, 0x12, 0x0f, 
-	0x0f, 0x15, 0x19, 0x19, 0x0c, 0xec, 0xec, 0xea, 
-	0xe8, 0xe8, 0xe8, 0xe7, 0xe7, 0xf6, 0x15, 0x14, 
-	0x13, 0x11, 0x10, 0x0f, 0x0d, 0x0c, 0x0b, 0x0b, 
-	0x11, 0x15, 0x16, 0x11, 0x0b, 0x0b, 0x17, 0x1e, 
-	0x1e, 0x1b, 0x18, 0x18, 0x1b, 0x1d, 0x1d, 0x15, 
-	0xf7, 0xfa, 0x00, 0x08, 0x12, 0x15, 0x18, 0x0d, 
-	0xef, 0xef, 0xf4, 0x08, 0x08, 0xe5, 0xdb, 0xdb, 
-	0xe3, 0xef, 0xef, 0xf4, 0x08, 0x08, 0xe9, 0xe0, 
-	0xe3, 0xef, 0x17, 0x0d, 0xfc, 0xeb, 0xec, 0xed, 
-	0xed, 0xea, 0xe7, 0xe7, 0xe5, 0xe2, 0xe2, 0xe1, 
-	0xe0, 0xe0, 0xe8, 0xf7, 0xf7, 0xeb, 0xe5, 0xe6, 
-	0xe8, 0xed, 0x09, 0x10, 0x18, 0x19, 0x19, 0x19, 
-	0x19, 0x18, 0x18, 0x19, 0x1b, 0x1b, 0x15, 0x0b, 
-	0x0b, 0x12, 0x18, 0x19, 0x1b, 0x1e, 0x1c, 0x1b, 
-	0x19, 0x14, 0x0d, 0x0d, 0x0e, 0x0f, 0x0f, 0xf4, 
-	0xeb, 0xeb, 0x10, 0x1d, 0x1d, 0x1c, 0x1b, 0x15, 
-	0x0f, 0x0b, 0x12, 0x16, 0x16, 0x09, 0xec, 0xec, 
-	0xf6, 0x0f, 0x05, 0xf2, 0xea, 0xe5, 0xe5, 0xf3, 
-	0x15, 0x15, 0x16, 0x17, 0x13, 0x10, 0xf7, 0xe9, 
-	0xe4, 0xe1, 0xe4, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 
-	0xe1, 0xdd, 0xdf, 0xe0, 0xe4, 0xe7, 0xe9, 0xea, 
-	0xe9, 0xe9, 0xe9, 0xf8, 0x14, 0x11, 0xf2, 0xe5, 
-	0xe3, 0xe2, 0xe0, 0xe3, 0xe5, 0xe5, 0xe8, 0xeb, 
-	0xeb, 0xf1, 0x00, 0xf1, 0xef, 0xea, 0xe9, 0xe9, 
-	0xe9, 0xf5, 0x12, 0x12, 0x18, 0x1c, 0x1e, 0x1e, 
-	0x20, 0x17, 0x00, 0x00, 0xee, 0xe8, 0xe8, 0xe6, 
-	0xe5, 0xe9, 0xea, 0xef, 0xf2, 0xf8, 0xf8, 0xee, 
-	0xe9, 0xea, 0xf2, 0x0e, 0xf2, 0xee, 0xe9, 0xe6, 
-	0xee, 0xf1, 0xf2, 0xe9, 0xe9, 0xe6, 0xe4, 0xe4, 
-	0xe7, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0x14, 0x22, 
-	0x22, 0x1f, 0x1b, 0x17, 0xf8, 0xe3, 0xe3, 0xe4, 
-	0xe5, 0xef, 0xf5, 0x16, 0xf6, 0xf0, 0xe6, 0xea, 
-	0xeb, 0xee, 0xe6, 0xe2, 0xe1, 0xe5, 0xea, 0xea, 
-	0xe3, 0xdd, 0xdd, 0xe5, 0xf5, 0xf5, 0x0c, 0x14, 
-	0x14, 0x11, 0x0c, 0x0c, 0x09, 0x00, 0x00, 0x19, 
-	0x23, 0x23, 0x22, 0x22, 0x22, 0x21, 0x20, 0x19, 
-	0x17, 0x0a, 0x17, 0x1b, 0x1f, 0x1c, 0x18, 0x18, 
-	0x15, 0x13, 0x13, 0x15, 0x18, 0x18, 0x0d, 0xef, 
-	0xef, 0xe6, 0xe0, 0xe0, 0xe2, 0xe3, 0xe3, 0xe2, 
-	0xe2, 0xe4, 0xe5, 0xe6, 0xeb, 0xef, 0xf1, 0xf1, 
-	0xf1, 0xf1, 0xf6, 0x07, 0x07, 0xea, 0xe2, 0xe2, 
-	0xe4, 0xe6, 0xe8, 0xed, 0xf8, 0xf8, 0xf8, 0xf8, 
-	0xe8, 0xe6, 0xe0, 0xe6, 0xec, 0xef, 0xea, 0xe6, 
-	0xe6, 0xed, 0x00, 0x00, 0xfa, 0xf8, 0xf8, 0xee, 
-	0xe8, 0xe8, 0xeb, 0xee, 0xed, 0xe9, 0xe5, 0xe9, 
-	0xea, 0xf3, 0xf4, 0xf4, 0xf5, 0xf2, 0xf0, 0xef, 
-	0xef, 0xef, 0xef, 0x0c, 0x17, 0x17, 0x1e, 0x24, 
-	0x24, 0x21, 0x1c, 0x18, 0x16, 0x0a, 0x13, 0x17, 
-	0x19, 0x16, 0x12, 0x12, 0x1b, 0x22, 0x22, 0x24, 
-	0x25, 0x25, 0x21, 0x1b, 0x1e, 0x20, 0x25, 0x23, 
-	0x23, 0x22, 0x21, 0x20, 0x20, 0x1e, 0x1b, 0x1b, 
-	0x1b, 0x1b, 0x1a, 0x17, 0x12, 0x1a, 0x1b, 0x21, 
-	0x10, 0xea, 0xe5, 0xec, 0x00, 0x00, 0x12, 0x19, 
-	0x19, 0x18, 0x16, 0x11, 0x0e, 0xf3, 0x0e, 0x14, 
-	0x16, 0xfa, 0xe8, 0xe8, 0xe4, 0xe0, 0xe0, 0xea, 
-	0x0c, 0x15, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 
-	0x25, 0x25, 0x0c, 0xde, 0xde, 0xe0, 0xe2, 0xe5, 
-	0xe6, 0xe8, 0xe8, 0xe9, 0xe9, 0x15, 0x23, 0x23, 
-	0x1e, 0x18, 0x1a, 0x1b, 0x1d, 0x23, 0x24, 0x24, 
-	0x16, 0xe3, 0xe3, 0xe9, 0xf1, 0xe9, 0xe8, 0xe2, 
-	0xe8, 0xf0, 0xf1, 0x11, 0x1b, 0x1b, 0x17, 0x12, 
-	0x11, 0x11, 0x11, 0x17, 0x1b, 0x1b, 0x12, 0xf3, 
-	0xf3, 0x13, 0x1c, 0x15, 0x12, 0x00, 0x11, 0x17, 
-	0x17, 0x16, 0x0f, 0x0e, 0x11, 0x17, 0x17, 0x16, 
-	0x14, 0x14, 0x18, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 
-	0x1c, 0x1f, 0x1e, 0x1a, 0x14, 0x14, 0x14, 0x13, 
-	0x15, 0x16, 0x19, 0x17, 0x16, 0x12, 0xef, 0xed, 
-	0xe3, 0xe3, 0xe2, 0xe2, 0xe5, 0xe7, 0xe8, 0xeb, 
-	0xee, 0xee, 0xea, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 
-	0xe5, 0xe4, 0xe4, 0xe6, 0xe7, 0xe7, 0x0a, 0x1b, 
-	0x1b, 0x18, 0x16, 0x16, 0x18, 0x19, 0x15, 0x12, 
-	0x00, 0x10, 0x11, 0x16, 0x15, 0x15, 0x15, 0x17, 
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x24, 0x24, 
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x21, 
-	0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1d, 
-	0x1d, 0x20, 0x23, 0x23, 0x1a, 0x0c, 0x0c, 0x19, 
-	0x20, 0x20, 0x16, 0xf3, 0xfa, 0x12, 0x1b, 0x14, 
-	0x0d, 0xeb, 0xeb, 0xeb, 0xea, 0xf0, 0xf4, 0x00, 
-	0x00, 0x00, 0x00, 0x1a, 0x23, 0x23, 0x20, 0x1c, 
-	0x1c, 0x1b, 0x1a, 0x1a, 0x0e, 0xee, 0xf1, 0x0b, 
-	0x16, 0x14, 0x13, 0x0f, 0x14, 0x16, 0x18, 0x14, 
-	0x10, 0x0f, 0x16, 0x1b, 0x1b, 0x1d, 0x1f, 0x1f, 
-	0x1c, 0x1a, 0x19, 0x18, 0x16, 0x15, 0x14, 0x11, 
-	0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x10, 0x07, 
-	0x07, 0x15, 0x1d, 0x1d, 0x1e, 0x1f, 0x1c, 0x1c, 
-	0x18, 0x18, 0x19, 0x19, 0xf8, 0xe5, 0xe5, 0xe2, 
-	0xdf, 0xdf, 0xe4, 0xea, 0xed, 0xf3, 0x0f, 0x07, 
-	0x05, 0xf3, 0x0d, 0x15, 0x15, 0x0c, 0xf2, 0xf2, 
-	0x0a, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x15, 
-	0x0e, 0x05, 0xf5, 0x0c, 0x12, 0x12, 0xee, 0xe2, 
-	0xe2, 0xe2, 0xe2, 0xe5, 0xe5, 0xe7, 0xe9, 0xeb, 
-	0xec, 0xf0, 0xf8, 0xf8, 0xf0, 0xeb, 0xec, 0xee, 
-	0xf2, 0x11, 0x15, 0x1b, 0xef, 0xdd, 0xdd, 0xdd, 
-	0xdc, 0xdc, 0xdd, 0xde, 0xdd, 0xdd, 0xdc, 0xe2, 
-	0xe8, 0xe8, 0xf2, 0x0f, 0x0f, 0x0d, 0x0b, 0x0b, 
-	0x0a, 0x09, 0xe9, 0xe0, 0xe0, 0xe5, 0xed, 0xed, 
-	0xec, 0xeb, 0xf0, 0xf1, 0x00, 0xf0, 0xeb, 0xeb, 
-	0xeb, 0xeb, 0xed, 0xf0, 0x00, 0x13, 0x16, 0x1a, 
-	0x10, 0xf2, 0xf2, 0xed, 0xea, 0xea, 0xf1, 0x07, 
-	0x07, 0x0c, 0x10, 0x0f, 0xfa, 0xee, 0xef, 0xf2, 
-	0xf8, 0xed, 0xea, 0xe2, 0xe5, 0xe6, 0xec, 0xe7, 
-	0xe7, 0xe3, 0xdf, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-	0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe0, 
-	0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe8, 0xec, 0xec, 
-	0xec, 0xeb, 0xec, 0xec, 0xec, 0xe9, 0xe9, 0xe7, 
-	0xf2, 0x08, 0x11, 0x00, 0xef, 0xee, 0xe7, 0xe2, 
-	0xe2, 0xe2, 0xe2, 0xe2, 0xe7, 0xee, 0xee, 0xfa, 
-	0x10, 0x0c, 0xf8, 0xed, 0xe7, 0xe6, 0xe1, 0xeb, 
-	0xef, 0x0e, 0x11, 0x12, 0x13, 0xed, 0xe1, 0xe1, 
-	0xe6, 0xec, 0xec, 0xeb, 0xea, 0xea, 0xeb, 0xeb, 
-	0xeb, 0xed, 0xf0, 0xf0, 0xf0, 0xf1, 0xed, 0xed, 
-	0xea, 0xef, 0xf0, 0xf8, 0xe9, 0xe4, 0xe2, 0xe3, 
-	0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe9, 0xe9, 
-	0x07, 0x18, 0x18, 0x18, 0x18, 0x1a, 0x1b, 0x1e, 
-	0x1c, 0x1c, 0x1a, 0x11, 0x09, 0xf2, 0xf2, 0xf2, 
-	0xf2, 0x0f, 0x18, 0x18, 0x17, 0x15, 0x15, 0x10, 
-	0x07, 0x09, 0x0b, 0x0e, 0x14, 0x15, 0x18, 0x1b, 
-	0x1c, 0x1d, 0x17, 0x0e, 0x0e, 0x05, 0xf2, 0xf2, 
-	0xeb, 0xe6, 0xe7, 0xe7, 0xe8, 0xea, 0xea, 0xed, 
-	0xf5, 0x0a, 0x0d, 0xe9, 0xdf, 0xdf, 0xe1, 0xe4, 
-	0xe4, 0xea, 0xf1, 0x09, 0x0d, 0x17, 0x16, 0x16, 
-	0x16, 0x10, 0x08, 0x00, 0x09, 0x0d, 0x0d, 0xf9, 
-	0xf0, 0xef, 0xee, 0xec, 0xe7, 0xe7, 0xe4, 0xe9, 
-	0xef, 0xf0, 0xee, 0xed, 0xed, 0xfa, 0x11, 0x10, 
-	0x0f, 0x0d, 0xed, 0xea, 0xe4, 0xe4, 0xe4, 0xe4, 
-	0xe5, 0xe5, 0xe5, 0xdf, 0xde, 0xe0, 0xe1, 0xec, 
-	0xee, 0xf0, 0xf1, 0xee, 0xec, 0xec, 0xed, 0xee, 
-	0xed, 0xed, 0xed, 0xe5, 0xe3, 0xe0, 0xe3, 0xe8, 
-	0xe8, 0xe2, 0xde, 0xe2, 0xea, 0x14, 0x18, 0x19, 
-	0x1b, 0x0c, 0xe9, 0xe9, 0xe9, 0xe9, 0xee, 0xf2, 
-	0x0c, 0x13, 0x15, 0x18, 0x13, 0x09, 0x09, 0x0e, 
-	0x11, 0xee, 0xec, 0xe0, 0xde, 0xde, 0xde, 0xde, 
-	0xe2, 0xe2, 0xe1, 0xe0, 0xe5, 0xe6, 0xee, 0xee, 
-	0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0x00, 
-	0x00, 0xea, 0xe2, 0xe2, 0xe7, 0xed, 0xed, 0xeb, 
-	0xea, 0xea, 0xec, 0xee, 0xf0, 0x0f, 0x1b, 0x1a, 
-	0x19, 0x17, 0x18, 0x19, 0x1b, 0x1d, 0x1d, 0x20, 
-	0x19, 0x19, 0x0e, 0x04, 0xf8, 0xf3, 0x12, 0x19, 
-	0x1c, 0x17, 0x10, 0x10, 0x12, 0x14, 0x14, 0x12, 
-	0x10, 0x10, 0x13, 0x15, 0x15, 0x17, 0x19, 0x19, 
-	0x1b, 0x1d, 0x1c, 0x1b, 0x19, 0x0c, 0x0c, 0xeb, 
-	0xec, 0xed, 0xed, 0xef, 0xf0, 0xf0, 0xf9, 0x0c, 
-	0x0c, 0xf0, 0xe8, 0xe8, 0xe5, 0xe2, 0xe3, 0xe7, 
-	0xee, 0xf2, 0xf4, 0x09, 0x10, 0x11, 0x16, 0x16, 
-	0x16, 0x16, 0xf2, 0xeb, 0xe4, 0xe2, 0xe1, 0xe1, 
-	0xe6, 0xec, 0xec, 0xe8, 0xe4, 0xe4, 0xee, 0x10, 
-	0x10, 0x14, 0x18, 0x17, 0x16, 0x14, 0x12, 0x0f, 
-	0x00, 0xeb, 0xeb, 0xe4, 0xe6, 0xe6, 0xe8, 0xed, 
-	0xf2, 0xf5, 0xea, 0xe4, 0xe4, 0xe5, 0xe6, 0xe6, 
-	0xe7, 0xe7, 0xe8, 0xee, 0xf9, 0xef, 0xeb, 0xe5, 
-	0xeb, 0xeb, 0xf6, 0x0e, 0x12, 0x15, 0x0c, 0xf2, 
-	0xf2, 0xf1, 0xf0, 0xf0, 0x04, 0x10, 0x12, 0x15, 
-	0x19, 0x14, 0x14, 0x0c, 0x0f, 0x11, 0x12, 0xf2, 
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xea, 0xf1, 0xf1, 
-	0xf0, 0xf0, 0xec, 0xec, 0xe9, 0xeb, 0xed, 0xee, 
-	0xe8, 0xe3, 0xe3, 0xe6, 0xe8, 0xe8, 0xe6, 0xe4, 
-	0xe4, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-	0xe0, 0xe2, 0xe4, 0xe7, 0xec, 0xf7, 0xfd, 0x06, 
-	0x0c, 0x0d, 0x0d, 0x0e, 0xf8, 0xee, 0xee, 0xed, 
-	0xeb, 0xeb, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 
-	0x0e, 0x1d, 0x1c, 0x1b, 0x1b, 0x16, 0x10, 0x0f, 
-	0x0f, 0x0d, 0x08, 0x08, 0xf9, 0x12, 0x18, 0x19, 
-	0x11, 0xf5, 0xf2, 0xed, 0xe8, 0xe8, 0xe8, 0xe8, 
-	0xec, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 
-	0x08, 0x08, 0x16, 0x18, 0x1a, 0x1a, 0x15, 0x0e, 
-	0x12, 0x16, 0x1c, 0x13, 0x13, 0xf5, 0xf0, 0xec, 
-	0xec, 0xee, 0xef, 0xee, 0xee, 0xec, 0xec, 0xec, 
-	0xeb, 0xe9, 0xe7, 0xe7, 0xf8, 0x17, 0x16, 0x15, 
-	0x13, 0x13, 0x13, 0x16, 0x19, 0x19, 0x18, 0x17, 
-	0x17, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1a, 
-	0x12, 0x11, 0x11, 0x0f, 0x13, 0x13, 0x17, 0x11, 
-	0x11, 0x06, 0xef, 0xed, 0xe8, 0xe6, 0xe4, 0xe4, 
-	0xee, 0x0d, 0x0f, 0x11, 0x12, 0x12, 0x11, 0x10, 
-	0x10, 0x17, 0x1d, 0x1d, 0x16, 0x08, 0x07, 0xf8, 
-	0xf2, 0xef, 0xec, 0xe7, 0xe9, 0xea, 0xec, 0xed, 
-	0xed, 0xee, 0xf5, 0xfa, 0x0a, 0x00, 0xf6, 0xf5, 
-	0xf7, 0xf9, 0xf9, 0xee, 0xe9, 0xe9, 0xea, 0xeb, 
-	0xeb, 0xec, 0xed, 0xec, 0xec, 0xeb, 0xee, 0xee, 
-	0xf2, 0x08, 0x08, 0x11, 0x12, 0x12, 0x13, 0x0b, 
-	0xf9, 0xf4, 0xf5, 0xf7, 0xf7, 0x0f, 0x16, 0x16, 
-	0xf4, 0xe5, 0xe5, 0xe4, 0xe4, 0xe5, 0xf0, 0x13, 
-	0x11, 0x10, 0x0c, 0x12, 0x12, 0x15, 0x15, 0x15, 
-	0x15, 0x0b, 0xf8, 0xf0, 0xf7, 0x0a, 0x0a, 0xef, 
-	0xe7, 0xe7, 0xea, 0xee, 0xee, 0xeb, 0xe8, 0xe7, 
-	0xe6, 0xe3, 0xe4, 0xe4, 0xe5, 0xeb, 0xec, 0xf5, 
-	0x04, 0x09, 0x0b, 0x0f, 0x12, 0x12, 0x0f, 0x0b, 
-	0x0b, 0x11, 0x15, 0x0a, 0xf5, 0xe6, 0xec, 0xec, 
-	0xf4, 0xf8, 0xfb, 0x06, 0xfb, 0xf7, 0xf7, 0xe9, 
-	0xe2, 0xe2, 0xe5, 0xea, 0xf3, 0x07, 0x16, 0x18, 
-	0x18, 0x1a, 0x12, 0x0d, 0xf5, 0x0a, 0x0f, 0x10, 
-	0x16, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1b, 0x1d, 
-	0x1d, 0x1d, 0x1d, 0x10, 0x10, 0xed, 0xea, 0xe9, 
-	0xe7, 0xf0, 0x0c, 0x0c, 0xf7, 0xef, 0xf2, 0xf2, 
-	0xf5, 0xfb, 0x08, 0x08, 0x10, 0x15, 0x15, 0x12, 
-	0x0e, 0x06, 0x06, 0xf3, 0xee, 0xec, 0xea, 0xee, 
-	0xf3, 0xf3, 0xf0, 0xed, 0xf6, 0x09, 0x15, 0x15, 
-	0x15, 0x15, 0x15, 0x16, 0x16, 0x18, 0x19, 0x18, 
-	0x18, 0x16, 0x16, 0x16, 0x16, 0x12, 0x0d, 0x0b, 
-	0xf8, 0xf1, 0xf2, 0xf4, 0xf7, 0x0e, 0x0e, 0x15, 
-	0x0e, 0xfa, 0xf7, 0x0b, 0x11, 0x0c, 0xfb, 0xed, 
-	0xf4, 0xf4, 0x09, 0x0b, 0x0c, 0x0c, 0x10, 0x13, 
-	0x12, 0x0b, 0xf3, 0xf7, 0xf7, 0x05, 0xf3, 0xf0, 
-	0xee, 0xf2, 0xfa, 0xfa, 0x09, 0x0e, 0x09, 0x08, 
-	0xf6, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 
-	0xf3, 0xef, 0xec, 0xec, 0xf3, 0x09, 0x09, 0xed, 
-	0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe8, 0xea, 0xec, 
-	0xef, 0xf7, 0xed, 0xec, 0xe6, 0xec, 0xec, 0xf4, 
-	0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf3, 0xf2, 
-	0xf2, 0xef, 0xec, 0xec, 0x00, 0x13, 0x13, 0x0c, 
-	0xf5, 0xf5, 0xf1, 0xee, 0xee, 0xeb, 0xe8, 0xe9, 
-	0xe9, 0xea, 0xea, 0xea, 0xe9, 0x0a, 0x0a, 0x19, 
-	0x16, 0x14, 0x12, 0x07, 0xf2, 0xf1, 0xf0, 0xef, 
-	0xef, 0xf3, 0xfa, 0xfa, 0x00, 0x05, 0x05, 0x0a, 
-	0x0d, 0x0b, 0xfa, 0xf1, 0x03, 0x0c, 0x16, 0x12, 
-	0x12, 0x0d, 0xed, 0xed, 0xe4, 0xe4, 0xe4, 0xe5, 
-	0xe8, 0xea, 0xec, 0xe8, 0xe5, 0xe5, 0xec, 0x00, 
-	0x00, 0x07, 0x0a, 0x0a, 0xfb, 0xf4, 0xf4, 0xf4, 
-	0xf5, 0xf6, 0xf6, 0xf8, 0x0a, 0x0a, 0x10, 0xf5, 
-	0xf1, 0xea, 0xeb, 0xec, 0xec, 0xef, 0xf3, 0xf3, 
-	0xed, 0xe9, 0xe9, 0xea, 0xeb, 0xeb, 0xea, 0xe9, 
-	0xf5, 0xf5, 0x12, 0x0f, 0x0f, 0x0c, 0x00, 0xf3, 
-	0xf3, 0x05, 0x0e, 0x0e, 0xf5, 0xeb, 0xeb, 0xeb, 
-	0xea, 0xf2, 0xf2, 0x0b, 0x08, 0x08, 0x00, 0x05, 
-	0x07, 0x07, 0xf5, 0xef, 0xef, 0xee, 0xec, 0xec, 
-	0xeb, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 
-	0xed, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xef, 0xed, 
-	0xed, 0xef, 0xf2, 0xf1, 0xee, 0xea, 0xee, 0xef, 
-	0xf6, 0xf2, 0xf2, 0xef, 0xed, 0xec, 0xed, 0xed, 
-	0xf0, 0xec, 0xec, 0xe9, 0xee, 0xf6, 0xf8, 0xed, 
-	0xe7, 0xe8, 0xec, 0xf1, 0xf4, 0xf4, 0xfa, 0xf8, 
-	0xf7, 0xf6, 0xf4, 0xf2, 0xf2, 0xf1, 0xf0, 0xf3, 
-	0xf3, 0xf8, 0xee, 0xed, 0xe8, 0xee, 0xf6, 0xf6, 
-	0xf1, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-	0xec, 0xec, 0xec, 0xed, 0xed, 0xef, 0xf1, 0xf5, 
-	0xfa, 0xfb, 0x07, 0xf1, 0xeb, 0xeb, 0xf0, 0x00, 
-	0xf9, 0xf6, 0xf3, 0xf9, 0xf9, 0x09, 0xf7, 0xf3, 
-	0xf1, 0x0e, 0x18, 0x17, 0x17, 0x16, 0x12, 0x12, 
-	0x0d, 0x0f, 0x0f, 0x10, 0x0f, 0x0e, 0x0d, 0x0d, 
-	0x0d, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x10, 
-	0x0f, 0x12, 0x13, 0x16, 0x14, 0x14, 0x12, 0x10, 
-	0x10, 0x0d, 0x0f, 0x0f, 0x10, 0x12, 0x12, 0x14, 
-	0x15, 0x15, 0x15, 0x17, 0x17, 0x18, 0x19, 0x19, 
-	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 
-	0x16, 0x15, 0x12, 0x0c, 0x06, 0xf6, 0xee, 0xec, 
-	0xec, 0xeb, 0xf5, 0xf5, 0x10, 0x12, 0x12, 0x13, 
-	0x0f, 0x0c, 0x08, 0x0d, 0x11, 0x11, 0x0c, 0x00, 
-	0x00, 0x0c, 0x11, 0x11, 0x0f, 0x0c, 0x0c, 0x0b, 
-	0x08, 0x0c, 0x0e, 0x11, 0x11, 0x11, 0x12, 0x0d, 
-	0x0d, 0x00, 0xfc, 0xfc, 0xfa, 0x0a, 0x0b, 0x0f, 
-	0x0a, 0x05, 0xfa, 0xf9, 0xf8, 0xf8, 0xfa, 0x00, 
-	0x00, 0x0e, 0x14, 0x14, 0x15, 0x17, 0x17, 0x17, 
-	0x17, 0x17, 0x16, 0x16, 0x12, 0x12, 0x0e, 0x08, 
-	0x07, 0xf7, 0xf5, 0xf4, 0xf4, 0xf1, 0xef, 0xef, 
-	0xf2, 0xf6, 0xf6, 0xee, 0xe9, 0xe8, 0xe7, 0xe6, 
-	0xe9, 0xe9, 0xed, 0xef, 0xef, 0xf2, 0xef, 0xee, 
-	0xec, 0xf4, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0d, 
-	0x0f, 0x10, 0x11, 0x13, 0x10, 0x10, 0x0d, 0x0d, 
-	0x0d, 0x0d, 0xf3, 0xeb, 0xeb, 0xec, 0xed, 0xed, 
-	0xf1, 0xf8, 0xf9, 0xfc, 0x05, 0x0e, 0x0f, 0x14, 
-	0x11, 0x11, 0x0f, 0x11, 0x11, 0x13, 0x10, 0x0e, 
-	0x0d, 0x11, 0x15, 0x15, 0x11, 0x0b, 0x09, 0xfa, 
-	0xf2, 0xfa, 0xfc, 0x0c, 0x07, 0x07, 0xf9, 0xfc, 
-	0x01, 0x05, 0x03, 0x00, 0x00, 0xf5, 0xf1, 0xf1, 
-	0xed, 0xe9, 0xe9, 0xea, 0xea, 0xec, 0xef, 0xed, 
-	0xed, 0xeb, 0xed, 0xed, 0xef, 0xf3, 0x00, 0x00, 
-	0xf2, 0xed, 0xed, 0xed, 0xee, 0xec, 0xec, 0xea, 
-	0xe9, 0xe9, 0xe8, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-	0xe9, 0xe9, 0xec, 0xeb, 0xeb, 0xea, 0xe9, 0xe8, 
-	0xe8, 0xea, 0xef, 0xef, 0xef, 0xf0, 0xf6, 0x02, 
-	0x08, 0xf2, 0xeb, 0xeb, 0xec, 0xed, 0xf1, 0xf1, 
-	0xf6, 0x03, 0x05, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 
-	0x08, 0xf9, 0xf5, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 
-	0xef, 0xef, 0xef, 0xee, 0xf0, 0xf1, 0xf5, 0xf5, 
-	0xf5, 0xf5, 0xf0, 0xee, 0xed, 0xee, 0xee, 0xee, 
-	0xee, 0xef, 0xed, 0xec, 0xea, 0xeb, 0xeb, 0xec, 
-	0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf2, 0xf2, 
-	0x00, 0xf3, 0xf1, 0xee, 0xf8, 0x0a, 0x0e, 0x08, 
-	0xf6, 0xf7, 0xf3, 0xf1, 0xf1, 0xee, 0xec, 0xec, 
-	0xed, 0xef, 0xf0, 0xf3, 0xfb, 0xf1, 0xef, 0xea, 
-	0xec, 0xec, 0xed, 0xf2, 0xf2, 0x00, 0xfc, 0xfc, 
-	0xfb, 0xf3, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xef, 
-	0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf5, 0x04, 0x04, 
-	0x05, 0x06, 0x09, 0x0b, 0x0d, 0x0a, 0x09, 0xfb, 
-	0xf2, 0xf2, 0xee, 0xef, 0xef, 0xf0, 0xf2, 0xf3, 
-	0xf5, 0xf2, 0xf1, 0xf0, 0xf2, 0xf3, 0xf4, 0xf4, 
-	0xf4, 0xf4, 0xf0, 0xed, 0xed, 0xf1, 0xf8, 0xf9, 
-	0x00, 0x07, 0x05, 0x05, 0x00, 0x0c, 0x0c, 0x11, 
-	0x0b, 0x0b, 0xf8, 0x00, 0x05, 0x07, 0xf6, 0xf0, 
-	0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf8, 0x05, 
-	0x0d, 0x10, 0x10, 0x13, 0x12, 0x12, 0x11, 0x11, 
-	0x11, 0x11, 0x13, 0x15, 0x15, 0x13, 0x12, 0x12, 
-	0x11, 0x11, 0x12, 0x12, 0x13, 0x0b, 0x0b, 0xf3, 
-	0xf7, 0xf8, 0x00, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 
-	0x0b, 0x0c, 0x0c, 0x0c, 0x0d, 0x0e, 0x0d, 0x0d, 
-	0x0c, 0x0a, 0x0a, 0x08, 0x06, 0x06, 0x00, 0x06, 
-	0x06, 0x08, 0x09, 0x0a, 0x0a, 0x0c, 0x0d, 0x0d, 
-	0x09, 0x00, 0x06, 0x08, 0x0b, 0x08, 0x08, 0x04, 
-	0x09, 0x09, 0x0c, 0x0b, 0x0a, 0x09, 0x0d, 0x0f, 
-	0x0f, 0x0d, 0x09, 0x05, 0xf9, 0xf9, 0xf8, 0xf7, 
-	0xf2, 0xf2, 0xee, 0xf2, 0xf4, 0xfb, 0x00, 0x04, 
-	0x04, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 
-	0xeb, 0xee, 0xf0, 0xf1, 0xf5, 0x00, 0xf4, 0xf3, 
-	0xef, 0xf0, 0xf0, 0xf2, 0xf1, 0xf0, 0xef, 0x04, 
-	0x10, 0x10, 0x10, 0x0f, 0x0c, 0x0c, 0x08, 0xfa, 
-	0xf6, 0xf4, 0xef, 0xec, 0xec, 0xed, 0xee, 0xf2, 
-	0xf2, 0xf8, 0x04, 0x04, 0x08, 0xfb, 0xf5, 0xf5, 
-	0xf4, 0xf3, 0xf6, 0xf6, 0xfa, 0xf6, 0xf6, 0xf3, 
-	0xf2, 0xf1, 0xf1, 0xef, 0xed, 0xf1, 0xf3, 0x06, 
-	0xf5, 0xf5, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 
-	0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf6, 0xf6, 0xf5, 
-	0xf4, 0xf4, 0xf5, 0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 
-	0xf3, 0xf2, 0xf5, 0xf5, 0xf9, 0x0a, 0x0a, 0x0f, 
-	0x10, 0x10, 0x11, 0x0e, 0x0e, 0x09, 0x09, 0x09, 
-	0x09, 0x07, 0x06, 0x05, 0x0a, 0x0d, 0x0d, 0x0c, 
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x08, 0xfb, 0xf7, 
-	0xf7, 0xf5, 0xf8, 0xf8, 0x04, 0x00, 0x00, 0xfb, 
-	0xf4, 0xf4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-	0xef, 0xf0, 0xf0, 0xf1, 0xf5, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0x0a, 0x0a, 0x08, 0x06, 0xf8, 
-	0xf4, 0xee, 0xf0, 0xf0, 0xf2, 0xed, 0xed, 0xec, 
-	0xec, 0xec, 0xee, 0xf0, 0xf1, 0xf3, 0xf2, 0xf2, 
-	0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 
-	0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xef, 0xf3, 
-	0xf3, 0xf7, 0xf9, 0xf9, 0xfa, 0xf7, 0xf5, 0xf5, 
-	0xfb, 0x09, 0x09, 0xfc, 0xf5, 0xf9, 0x09, 0x0f, 
-	0x10, 0x10, 0x10, 0x0b, 0x0b, 0xf9, 0xfa, 0xfa, 
-	0xfc, 0x08, 0x0b, 0x0c, 0x0b, 0x0a, 0x0a, 0x0c, 
-	0x0e, 0x0d, 0x0d, 0x0b, 0x08, 0x08, 0x03, 0xfa, 
-	0xfa, 0xf7, 0xfa, 0xfa, 0x03, 0xf9, 0xf8, 0xf6, 
-	0x07, 0x0d, 0x0d, 0x07, 0xf7, 0xf8, 0xfc, 0x06, 
-	0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 
-	0x09, 0xf7, 0xf2, 0xf1, 0xf0, 0xf0, 0xf0, 0xf5, 
-	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x08, 
-	0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x08, 
-	0x08, 0x07, 0x07, 0x05, 0xf1, 0xf1, 0xee, 0xee, 
-	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 
-	0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xef, 0xee, 0xee, 
-	0xee, 0xef, 0xf5, 0xf5, 0x07, 0x08, 0x08, 0x09, 
-	0x0a, 0x0a, 0x0b, 0x0c, 0x0c, 0x0e, 0x0f, 0x10, 
-	0x10, 0x10, 0x0f, 0x0e, 0x0d, 0x0b, 0x0d, 0x0f, 
-	0x0f, 0x0b, 0x04, 0xfe, 0xfd, 0xfa, 0x07, 0x07, 
-	0x0b, 0x0b, 0x0b, 0x0c, 0xfb, 0xf2, 0xf4, 0xf4, 
-	0xf7, 0xf3, 0xf3, 0xf1, 0xf3, 0xf5, 0xf7, 0xf9, 
-	0x00, 0x04, 0x05, 0x07, 0x09, 0x09, 0x0a, 0x03, 
-	0xf9, 0xf6, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 
-	0xf6, 0xf6, 0xf6, 0xf8, 0xf8, 0xfc, 0x03, 0x03, 
-	0x06, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 
-	0xf6, 0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf8, 0xf8, 
-	0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 
-	0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xfc, 0xfb, 0xfb, 
-	0xfa, 0x04, 0x04, 0x08, 0xfd, 0xfb, 0xf6, 0xfd, 
-	0x05, 0x08, 0x08, 0x09, 0x09, 0x05, 0xfa, 0xfa, 
-	0xf6, 0xf3, 0xf3, 0xf5, 0xf7, 0xf8, 0xf8, 0xf9, 
-	0xfa, 0xfa, 0x00, 0xf7, 0xf7, 0xf4, 0xf6, 0xf6, 
-	0xf9, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0x04, 
-	0x08, 0x0c, 0x0b, 0x0b, 0x0b, 0x0d, 0x0e, 0x0e, 
-	0x0d, 0x0a, 0x0b, 0x0b, 0x0d, 0x0c, 0x0c, 0x0c, 
-	0x0b, 0x0b, 0x0a, 0x08, 0x08, 0x05, 0xf9, 0xf8, 
-	0xf5, 0xf9, 0x04, 0x06, 0xf9, 0xf5, 0xf5, 0xf5, 
-	0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xfc, 
-	0xfc, 0x07, 0x07, 0x07, 0x07, 0xf9, 0xf5, 0xf4, 
-	0xf5, 0xf5, 0xf6, 0xfa, 0x07, 0x06, 0x06, 0x05, 
-	0xf8, 0xf8, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 
-	0xf5, 0xf5, 0xf4, 0xf4, 0xfa, 0x08, 0x08, 0x03, 
-	0xf8, 0xf9, 0xfe, 0x07, 0x04, 0x03, 0xfa, 0x05, 
-	0x05, 0x08, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 
-	0x0b, 0x0b, 0x0b, 0x08, 0x03, 0x04, 0x04, 0x05, 
-	0x04, 0x04, 0x03, 0x06, 0x06, 0x08, 0xfa, 0xf8, 
-	0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf8, 0xf8, 0xf8, 
-	0xfe, 0xfe, 0x06, 0x08, 0x08, 0x09, 0x05, 0xfa, 
-	0xf9, 0x03, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 
-	0x0a, 0x08, 0x07, 0x05, 0x06, 0x07, 0x04, 0x03, 
-	0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfc, 0xf9, 
-	0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf9, 0xfa, 
-	0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfa, 0xf9, 0xfa, 
-	0xfa, 0xfc, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 
-	0xf9, 0xfc, 0xfb, 0xf9, 0xf6, 0xf9, 0xf9, 0xfc, 
-	0xfa, 0xfa, 0xf8, 0xfa, 0xfb, 0xfc, 0xfb, 0xfa, 
-	0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 
-	0xf8, 0xf7, 0xf6, 0xf7, 0xf6, 0xf7, 0xf6, 0xf7, 
-	0xf7, 0xf8, 0xf6, 0xf6, 0xf5, 0xf8, 0xf8, 0x03, 
-	0x02, 0x02, 0x00, 0xfb, 0xfb, 0xf9, 0xfb, 0xfb, 
-	0xfd, 0x06, 0x07, 0x08, 0x08, 0x07, 0x07, 0x05, 
-	0x01, 0x01, 0x05, 0x07, 0x07, 0x07, 0x06, 0x06, 
-	0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 
-	0x04, 0x04, 0x03, 0x01, 0x01, 0xfd, 0xfd, 0xfd, 
-	0xfd, 0xfc, 0xfc, 0xfb, 0x02, 0x03, 0x04, 0x04, 
-	0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 
-	0x03, 0xfc, 0xfb, 0xfb, 0xfa, 0xfc, 0xfc, 0x03, 
-	0x02, 0x02, 0x02, 0xfd, 0xfd, 0xfb, 0x01, 0x01, 
-	0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x00, 
-	0xfc, 0xfc, 0xfc, 0xfd, 0x02, 0x04, 0x05, 0x05, 
-	0x05, 0x05, 0x03, 0x03, 0xfc, 0xfb, 0xfb, 0xfa, 
-	0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfc, 0x01, 
-	0x01, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xfe, 0xfe, 
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0xfe, 
-	0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x00, 0x03, 0x03, 
-	0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 
-	0x01, 0x01, 0xfe, 0x00, 0x00, 0x01, 0x01, 0x01, 
-	0x01, 0x01, 0x02, 0x01, 0x01, 0xff, 0xff, 0xff, 
-	
-};
-
-const SoundData sound_thruster = 
-{
-	(uint8_t*)soundData,	//pointer to data
-	10880,	//length of data array
-	8,	//bits per sample
-	11000	//sample rate (hz)
-};
-
-////////////////////////////////////////////////////
-
@@ -50,6 +50,8 @@ static uint32_t mGameScore;
 static uint8_t mGameLevel;
 static uint8_t mGameOverFlag;
 
+static void Sprite_PlayerThrust(SpriteSpeed_t maxSpeed);
+
 
 ///////////////////////////////////////////
 //Local delay not linked to a timer
@@ -269,7 +271,12 @@ void Sprite_Player_Move(void)
 		//speed reduces to slow
 		if (!mPlayer.thrustTimeout)
 		{
-			if (mPlayer.speed == SPRITE_SPEED_MEDIUM)
+			if (mPlayer.speed == SPRITE_SPEED_FAST)
+			{
+				mPlayer.speed = SPRITE_SPEED_MEDIUM;					//reduce speed
+				mPlayer.thrustTimeout = SPRITE_THRUSTER_TIMEOUT_VALUE;	//reset
+			}
+			else if (mPlayer.speed == SPRITE_SPEED_MEDIUM)
 			{
 				mPlayer.speed = SPRITE_SPEED_SLOW;						//reduce speed
 				mPlayer.thrustTimeout = SPRITE_THRUSTER_TIMEOUT_VALUE;	//reset
@@ -290,6 +297,13 @@ void Sprite_Player_Move(void)
 		mPlayer.speed = SPRITE_SPEED_STOP;
 	}
 
+	//thrust is applied every frame while it's held,
+	//no thrust since the last move is a release
+	if (mPlayer.thrusterOn)
+		mPlayer.thrusterOn = 0x00;
+	else
+		Sound_Stop_Thruster();
+
 }
 
 /////////////////////////////////////////////////////
@@ -383,8 +397,8 @@ void Sprite_Astroid_Move(void)
 				//if !rem, all astroid is cleared and reset
 				if (!rem)
 				{
-					Sound_Play_LevelUp(); 	//play a sound
 					mGameLevel++;
+					Sound_Play_LevelUpTone(mGameLevel); 	//play a sound
 					Sprite_Astroid_Init(Sprite_GetGameSpeedFromLevel());  //reset the astroid
 				}
 
@@ -511,8 +525,8 @@ void Sprite_Missile_Move(void)
 						//if !rem, all astroid is cleared and reset
 						if (!rem)
 						{
-							Sound_Play_LevelUp(); 	//play a sound
 							mGameLevel++;
+							Sound_Play_LevelUpTone(mGameLevel); 	//play a sound
 							Sprite_Astroid_Init(Sprite_GetGameSpeedFromLevel());  //reset the astroid
 
 						}
@@ -1428,10 +1442,20 @@ SpriteDirection_t Sprite_PlayerGetRotation(void)
 //
 void Sprite_PlayerFireThruster(void)
 {
-	static uint8_t thrustCount = SPRITE_ACCELERATION_TIMEOUT_VALUE;
+	Sprite_PlayerThrust(SPRITE_SPEED_MEDIUM);
+}
 
-	//play sound
-	Sound_Play_Thruster();
+
+/////////////////////////////////////////
+//Player Thrust - accelerate up to maxSpeed.
+//Stop goes right to slow, each speed above that
+//takes SPRITE_ACCELERATION_TIMEOUT_VALUE calls.
+//Faster than maxSpeed, the ship keeps its speed
+//and slows down on the thruster timeout.
+//
+static void Sprite_PlayerThrust(SpriteSpeed_t maxSpeed)
+{
+	static uint8_t thrustCount = SPRITE_ACCELERATION_TIMEOUT_VALUE;
 
 	//enable thrusters and reset the timeout
 	//timeout counts down in player move function
@@ -1450,15 +1474,15 @@ void Sprite_PlayerFireThruster(void)
 		mPlayer.speed = SPRITE_SPEED_SLOW;
 		thrustCount = SPRITE_ACCELERATION_TIMEOUT_VALUE;
 	}
-	else if (mPlayer.speed == SPRITE_SPEED_SLOW)
+	else if (mPlayer.speed < maxSpeed)
 	{
-		//hold slow for thruster timeout value
+		//hold speed for the acceleration timeout value
 		if (thrustCount > 0)
 			thrustCount--;
 		else
 		{
 			thrustCount = SPRITE_ACCELERATION_TIMEOUT_VALUE;
-			mPlayer.speed = SPRITE_SPEED_MEDIUM;
+			mPlayer.speed++;
 		}
 
 	}
@@ -1466,6 +1490,66 @@ void Sprite_PlayerFireThruster(void)
 	//set the direction based on the current rotation.
 	Sprite_PlayerSetDirection(mPlayer.rotation);
 
+	//play sound - pitch follows the player speed
+	Sound_Play_ThrusterSpeed((uint8_t)mPlayer.speed);
+
+}
+
+
+/////////////////////////////////////////
+//Proportional thrust from the analog joystick.
+//level is 0 to SPRITE_CONTROL_FULL_SCALE, sets
+//the top speed the ship accelerates to.  0 or
+//less - no thrust this frame.
+//
+void Sprite_PlayerThrustProportional(int32_t level)
+{
+	if (level <= 0)
+		return;
+
+	if (level < SPRITE_THRUST_MEDIUM_LEVEL)
+		Sprite_PlayerThrust(SPRITE_SPEED_SLOW);
+	else if (level < SPRITE_THRUST_FAST_LEVEL)
+		Sprite_PlayerThrust(SPRITE_SPEED_MEDIUM);
+	else
+		Sprite_PlayerThrust(SPRITE_SPEED_FAST);
+}
+
+
+/////////////////////////////////////////
+//Proportional rotation from the analog joystick.
+//rate is +/- SPRITE_CONTROL_FULL_SCALE, + is CW.
+//Rotation steps per frame go from SPRITE_ROTATE_RATE_MIN
+//to SPRITE_ROTATE_RATE_MAX (Q8) with the rate, the
+//fraction carries over to the next frame.
+//
+void Sprite_PlayerRotateProportional(int32_t rate)
+{
+	static int32_t accumulator = 0x00;
+
+	if (!rate)
+	{
+		accumulator = 0x00;
+		return;
+	}
+
+	int32_t magnitude = (rate < 0) ? -rate : rate;
+
+	if (magnitude > SPRITE_CONTROL_FULL_SCALE)
+		magnitude = SPRITE_CONTROL_FULL_SCALE;
+
+	accumulator += SPRITE_ROTATE_RATE_MIN +
+			((SPRITE_ROTATE_RATE_MAX - SPRITE_ROTATE_RATE_MIN) * magnitude) / SPRITE_CONTROL_FULL_SCALE;
+
+	while (accumulator >= 256)
+	{
+		accumulator -= 256;
+
+		if (rate > 0)
+			Sprite_PlayerRotateCW();
+		else
+			Sprite_PlayerRotateCCW();
+	}
 }
 
 void Sprite_PlayerSetDirection(SpriteDirection_t direction)
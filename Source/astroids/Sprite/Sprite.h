@@ -42,6 +42,13 @@ and astroid sprites.
 #define SPRITE_THRUSTER_TIMEOUT_VALUE		40		//engine run timeout
 #define SPRITE_ACCELERATION_TIMEOUT_VALUE	10		//accelerating with thruster on
 
+//proportional controls - analog joystick
+#define SPRITE_CONTROL_FULL_SCALE			256		//full deflection
+#define SPRITE_ROTATE_RATE_MIN				64		//Q8 rotation steps per frame
+#define SPRITE_ROTATE_RATE_MAX				512
+#define SPRITE_THRUST_MEDIUM_LEVEL			96		//top speed by thrust level
+#define SPRITE_THRUST_FAST_LEVEL			224
+
 /////////////////////////////////////////
 //Direction enum
 //support only a few angles to make
@@ -236,6 +243,8 @@ void Sprite_PlayerSetRotation(SpriteDirection_t rotation);
 SpriteDirection_t Sprite_PlayerGetRotation(void);
 
 void Sprite_PlayerFireThruster(void);
+void Sprite_PlayerThrustProportional(int32_t level);
+void Sprite_PlayerRotateProportional(int32_t rate);
 void Sprite_PlayerSetDirection(SpriteDirection_t direction);
 SpriteDirection_t Sprite_PlayerGetDirection(void);
 
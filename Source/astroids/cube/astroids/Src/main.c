@@ -160,12 +160,18 @@ int main(void)
 
 		/* USER CODE BEGIN 3 */
 
-		//check digital joystick values if enabled
-#ifndef JOYSTICK_USE_ANALOG
+		//analog joystick - proportional rotate and thrust,
+		//else check digital joystick values
+#ifdef JOYSTICK_USE_ANALOG
+		Joystick_Update();
+		Sprite_PlayerRotateProportional(Joystick_GetAxis(JOYSTICK_AXIS_X));
+		Sprite_PlayerThrustProportional(Joystick_GetAxis(JOYSTICK_AXIS_Y));
+#else
 		Joystick_Digital_Read();
 #endif
 		////////////////////////////////////////
-		//Check Flags - Joystick
+		//Check Flags - Joystick.  Rotate and thrust
+		//can both be set (diagonals)
 		if (Sprite_PlayerGetRotateCWFlag() == 1)			//Rotate CW
 		{
 			Sprite_PlayerClearRotateCWFlag();
@@ -176,12 +182,14 @@ int main(void)
 			Sprite_PlayerClearRotateCCWFlag();
 			Sprite_PlayerRotateCCW();
 		}
-		else if (Sprite_PlayerGetThrusterFlag() == 1)		//Fire Engines
+
+		if (Sprite_PlayerGetThrusterFlag() == 1)			//Fire Engines
 		{
 			Sprite_PlayerFireThruster();
 			Sprite_PlayerClearThrusterFlag();
 		}
-		else if (Sprite_PlayerGetSpecialEventFlag() == 1)		//Special Event? Not sure
+
+		if (Sprite_PlayerGetSpecialEventFlag() == 1)		//Special Event? Not sure
 		{
 			HAL_GPIO_TogglePin(ledGreen_GPIO_Port, ledGreen_Pin);
 			Sprite_PlayerClearSpecialEventFlag();
@@ -337,6 +345,14 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
   }
 /* USER CODE BEGIN Callback 1 */
 
+	//////////////////////////////////////////
+	//TIM1 - HAL tick, 1khz.  Sample the digital
+	//joystick (does nothing with the analog one)
+	if (htim->Instance == TIM1)
+	{
+		Joystick_DigitalTick();
+	}
+
 	if (htim->Instance == TIM6)
 	{
 		HAL_GPIO_TogglePin(userGPIO_PG2_GPIO_Port, userGPIO_PG2_Pin);
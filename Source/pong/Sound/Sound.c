@@ -14,21 +14,56 @@ Sound - DAC output
 #include "Sound.h"
 #include "dac.h"
 #include "tim.h"
+#include "AssetPack.h"
+#include "pongIds.h"
+
+//sounds - loaded from the asset pack in Sound_Init
+static SoundData sound_droppedball;
+static SoundData sound_gameover;
+static SoundData sound_levelup;
+static SoundData sound_playerbounce;
+static SoundData sound_wallbounce;
+static SoundData sound_tilebounce;
 
 
 static uint8_t* waveData;
 static uint32_t waveCounter;
 static void Sound_PlaySound(const SoundData *sound);
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id);
 
 
 ////////////////////////////////
 //
 void Sound_Init(void)
 {
+	AssetPack pack;
+
 	//start the dac
 	HAL_TIM_Base_Stop_IT(&htim7);
 	HAL_DAC_Start(&hdac, DAC1_CHANNEL_2);
 	HAL_DAC_SetValue(&hdac, DAC1_CHANNEL_2, DAC_ALIGN_8B_R, 0x00);
+
+	//sound arrays are in the linked asset pack,
+	//a sound that's missing has length 0 and
+	//doesn't play
+	AssetPack_OpenLinked(&pack);
+
+	Sound_Load(&pack, &sound_droppedball, ASSET_ID_WAVDROPPEDBALL);
+	Sound_Load(&pack, &sound_gameover, ASSET_ID_WAVGAMEOVER);
+	Sound_Load(&pack, &sound_levelup, ASSET_ID_WAVLEVELUP);
+	Sound_Load(&pack, &sound_playerbounce, ASSET_ID_WAVPLAYERBOUNCE);
+	Sound_Load(&pack, &sound_wallbounce, ASSET_ID_WAVWALLBOUNCE);
+	Sound_Load(&pack, &sound_tilebounce, ASSET_ID_WAVTILEBOUNCE);
+}
+
+//////////////////////////////////////////////
+//Point a sound at its data in the asset pack
+static void Sound_Load(const AssetPack* pack, SoundData* sound, uint32_t id)
+{
+	uint32_t size = 0x00;
+
+	sound->pSoundData = AssetPack_GetAsset(pack, id, ASSET_TYPE_SOUND, &size);
+	sound->length = sound->pSoundData ? size : 0x00;
 }
 
 /////////////////////////////////////////////
@@ -29,13 +29,8 @@ typedef struct
 
 
 
-//sound arrays
-extern const SoundData sound_droppedball;
-extern const SoundData sound_gameover;			//ok
-extern const SoundData sound_levelup;			//ok
-extern const SoundData sound_playerbounce;		//ok
-extern const SoundData sound_wallbounce;		//ok
-extern const SoundData sound_tilebounce;		//ok
+//sound arrays are in the asset pack, see
+//AssetPack/Manifest/pong.txt
 
 
 
@@ -8,10 +8,13 @@ Sprite
 #include <string.h>
 
 #include "Sprite.h"
+#include "TileGrid.h"
+#include "levels.h"
 #include "Graphics.h"
 #include "Memory.h"
-#include "Bitmap.h"
+#include "bitmap.h"
 #include "TouchPanel.h"
+#include "TouchTrack.h"
 #include "SlidePot.h"		//adc
 
 #include "Sound.h"
@@ -27,10 +30,23 @@ static GameSpeed_t spriteGameSpeed = GAME_SPEED_LOW;
 
 //players and tiles
 static BallStruct mBall;
-static TileStruct mTile[NUM_TILES];
+static TileGrid mTileGrid;
 static PlayerStruct mPlayer;
+static SpriteAI mAI;
+static SpriteAIStats mAIStats;
 static uint8_t spriteBallMissedFlag = 0;
 
+static uint8_t Sprite_Ball_Sweep(int32_t x, int32_t y, int32_t rx, int32_t ry,
+		int32_t left, int32_t top, int32_t right, int32_t bottom, SpriteSweep* hit);
+static uint8_t Sprite_Ball_IsEarlier(const SpriteSweep* a, const SpriteSweep* b);
+static void Sprite_Ball_SetDirection(int32_t dx, int32_t dy);
+static uint32_t Sprite_InvSqrt(uint32_t n);
+static void Sprite_AI_Move(void);
+static int32_t Sprite_AI_PredictX(void);
+static int32_t Sprite_AI_Unfold(int32_t distance);
+static int32_t Sprite_AI_GetTurnY(void);
+static uint32_t Sprite_GetCycles(void);
+
 
 /////////////////////////////////////
 //init all sprites in the game
@@ -40,6 +56,12 @@ void Sprite_Init(void)
 	spriteBackColor = BLACK;
 	spriteGameLevel = 0;
 	spriteGameSpeed = GAME_SPEED_LOW;
+	memset(&mAIStats, 0x00, sizeof(mAIStats));
+
+#ifdef SPRITE_PROFILE_AI
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
 	Sprite_ResetGameScore();
 	Sprite_GameMode_SetMode(GAME_MODE_DEMO);
@@ -121,6 +143,79 @@ void Sprite_DisplayGameOver(void)
 }
 
 
+////////////////////////////////////////////
+//Touch panel 3 point calibration screen.
+//Draws a target at each calibration point and
+//waits for it to be touched and released.  The
+//last raw sample before release is used for the
+//point.  Solved coefficients are applied and
+//saved to flash.  Draws into layer 0.
+void Sprite_DisplayTouchCalibration(void)
+{
+	static const uint16_t targetX[3] = {30, 210, 120};
+	static const uint16_t targetY[3] = {40, 160, 290};
+	TouchPanelCalibPoint points[3];
+	TouchPanelCalib calib;
+	TouchPanelData data;
+
+	HAL_LTDC_SetAddress(&hltdc, (uint32_t)SDRAM_LCD_LAYER_0, 0);
+	LCD_SetTextBackColor(BLUE2);
+	LCD_SetTextLineColor(WHITE);
+
+	for (int i = 0 ; i < 3 ; i++)
+	{
+		LCD_Clear(0, BLUE2);
+		LCD_DrawString(0, 6, "  Touch Target");
+		LCD_DrawLine(0, targetX[i] - 10, targetY[i], targetX[i] + 10, targetY[i], WHITE);
+		LCD_DrawLine(0, targetX[i], targetY[i] - 10, targetX[i], targetY[i] + 10, WHITE);
+
+		//wait for the press
+		uint32_t count = TouchPanel_GetSampleCount();
+		while (TouchPanel_GetSampleCount() == count)
+		{
+			TouchPanel_Process();
+			HAL_Delay(10);
+		}
+
+		//track until released
+		uint32_t lastTick = HAL_GetTick();
+		while ((HAL_GetTick() - lastTick) < 200)
+		{
+			count = TouchPanel_GetSampleCount();
+			TouchPanel_Process();
+
+			if (TouchPanel_GetSampleCount() != count)
+				lastTick = HAL_GetTick();
+
+			HAL_Delay(10);
+		}
+
+		data = TouchPanel_getPosition();
+		points[i].xRaw = data.xRawPos;
+		points[i].yRaw = data.yRawPos;
+		points[i].xScreen = targetX[i];
+		points[i].yScreen = targetY[i];
+	}
+
+	LCD_Clear(0, BLUE2);
+
+	if (!TouchPanel_SolveCalibration(points, &calib))
+	{
+		TouchPanel_SetCalibration(&calib);
+
+		if (!TouchPanel_SaveCalibration())
+			LCD_DrawString(0, 6, "  Calibrated");
+		else
+			LCD_DrawString(0, 6, "  Save Failed");
+	}
+	else
+		LCD_DrawString(0, 6, "  Bad Points");
+
+	TouchTrack_Init();
+	HAL_Delay(1000);
+}
+
+
 void Sprite_DisplayGameStart(void)
 {
 	uint8_t buffer = Sprite_GetActiveDisplayBuffer();
@@ -137,6 +232,7 @@ void Sprite_DisplayGameStart(void)
 
 	LCD_SetTextLineColor(WHITE);
 
+	Sprite_ResetGameLevel();
 	Tile_Init();
 	Player_Init();
 	Ball_Init();
@@ -152,30 +248,22 @@ void Ball_Init(void)
 	mBall.image = &imgBall;		//must be first
 	mBall.x = 10;
 	mBall.y = 280;
+	mBall.posX = mBall.x << 8;
+	mBall.posY = mBall.y << 8;
 	mBall.sizeX = mBall.image->xSize;
 	mBall.sizeY = mBall.image->ySize;
-	mBall.angle = SPRITE_DIRECTION_45;
+	Sprite_Ball_SetDirection(1, -1);		//up and right
+
+	mAI.valid = 0;							//new ball, predict again
 }
 
 
+//////////////////////////////////
+//load the tile grid for the game level,
+//levels repeat after the last one
 void Tile_Init(void)
 {
-	uint16_t counter = 0x00;
-	for (int i = 0 ; i < NUM_TILE_ROWS ; i++)
-	{
-		for (int j = 0 ; j < NUM_TILE_COLS ; j++)
-		{
-			mTile[counter].life = 1;
-			mTile[counter].image = &imgTile;
-			mTile[counter].points = 30;
-			mTile[counter].sizeX = 30;
-			mTile[counter].sizeY = 30;
-			mTile[counter].x = 30 * j;
-			mTile[counter].y = (30 * i) + TILE_HEADER;
-
-			counter++;
-		}
-	}
+	TileGrid_Load(&mTileGrid, levelList[spriteGameLevel % NUM_LEVELS], tileTypes, NUM_TILE_TYPES);
 }
 
 ///////////////////////////////
@@ -188,238 +276,344 @@ void Player_Init(void)
 	mPlayer.image = &imgPlayer;
 	mPlayer.sizeX = mPlayer.image->xSize;
 	mPlayer.sizeY = mPlayer.image->ySize;
+
+	mAI.pos = (mPlayer.x + (mPlayer.sizeX / 2)) << 8;
+	mAI.vel = 0;
+	mAI.valid = 0;
 }
 
 
 //////////////////////////////////////////////
 //Ball Move
 //
+//Swept collision - the ball moves vx, vy * game speed
+//per call (Q8 pixels).  Instead of testing the overlap
+//at the end of the move, the motion segment is swept
+//against the walls, the paddle and the live tiles, and
+//the ball stops at the earliest contact.  The hit face
+//reflects the velocity (negate the component), the
+//paddle also adds english from the hit offset.  The
+//rest of the motion continues in the new direction, up
+//to SPRITE_BALL_MAX_HITS bounces per call.  Nothing can
+//be skipped over, so the game speed is only a
+//multiplier on the step.
+//
 void Sprite_Ball_Move(void)
 {
-	uint32_t bBot, bTop, bLeft, bRight, bX, bY = 0;		//ball
-	uint32_t tBot, tTop, tLeft, tRight, tX, tY = 0;		//tile/player
-
-	int dx, dy;
+	SpriteSweep hit, best;
+	TileRange range;
+	int target;
 	uint8_t flagTile = 0;
+	uint8_t flagPlayer = 0;
 	uint8_t flagBoundary = 0;
-	uint8_t tileIndex = 0;
-	SpriteDirection_t updated = mBall.angle;
-
-	//evaluate the location of the ball
-	bBot = mBall.y + mBall.sizeY;
-	bTop = mBall.y;
-	bLeft = mBall.x;
-	bRight = mBall.x + mBall.sizeX;
-	bX = (bLeft + bRight) / 2;
-	bY = (bTop + bBot) / 2;
-
-	///////////////////////////////////////////
-	//connect with player
-	tTop = mPlayer.y;
-	tBot = mPlayer.y + mPlayer.sizeY;
-	tLeft = mPlayer.x;
-	tRight = mPlayer.x + mPlayer.sizeX;
-	tY = (tBot + tTop) / 2;
-
-	//ball hit player, with downward direction only
-	if ((bX >= tLeft) && (bX <= tRight) && (bBot >= tTop) && (bBot <= (tTop + 4))
-			&& (mBall.angle > SPRITE_DIRECTION_180))
+
+	int32_t multiplier = (int32_t)Sprite_GetGameSpeed();
+	int32_t x = mBall.posX;
+	int32_t y = mBall.posY;
+	int32_t remain = 0x10000;					//Q16 part of the step left
+	int32_t rx = mBall.vx * multiplier;
+	int32_t ry = mBall.vy * multiplier;
+
+	for (int bounce = 0 ; bounce < SPRITE_BALL_MAX_HITS ; bounce++)
 	{
+		target = SPRITE_TARGET_NONE;
 
-		//play sound
-		Sound_Play_PlayerBounce();
+		//walls - boxes outside the play area
+		if (Sprite_Ball_Sweep(x, y, rx, ry, -SPRITE_WALL_DEPTH, -SPRITE_WALL_DEPTH,
+				SCREEN_LEFT, SCREEN_BOTTOM + SPRITE_WALL_DEPTH, &hit))
+		{
+			best = hit;
+			target = SPRITE_TARGET_WALL;
+		}
+
+		if ((Sprite_Ball_Sweep(x, y, rx, ry, SCREEN_RIGHT, -SPRITE_WALL_DEPTH,
+				SCREEN_RIGHT + SPRITE_WALL_DEPTH, SCREEN_BOTTOM + SPRITE_WALL_DEPTH, &hit))
+				&& ((target == SPRITE_TARGET_NONE) || (Sprite_Ball_IsEarlier(&hit, &best))))
+		{
+			best = hit;
+			target = SPRITE_TARGET_WALL;
+		}
+
+		if ((Sprite_Ball_Sweep(x, y, rx, ry, -SPRITE_WALL_DEPTH, -SPRITE_WALL_DEPTH,
+				SCREEN_RIGHT + SPRITE_WALL_DEPTH, SCREEN_TOP, &hit))
+				&& ((target == SPRITE_TARGET_NONE) || (Sprite_Ball_IsEarlier(&hit, &best))))
+		{
+			best = hit;
+			target = SPRITE_TARGET_WALL;
+		}
+
+		//player - top face only, with downward direction
+		if ((ry > 0) && (Sprite_Ball_Sweep(x, y, rx, ry, mPlayer.x, mPlayer.y,
+				mPlayer.x + mPlayer.sizeX, mPlayer.y + mPlayer.sizeY, &hit))
+				&& (hit.face & SPRITE_FACE_TOP)
+				&& ((target == SPRITE_TARGET_NONE) || (Sprite_Ball_IsEarlier(&hit, &best))))
+		{
+			best = hit;
+			target = SPRITE_TARGET_PLAYER;
+		}
+
+		//live tiles under the swept ball, pixels
+		int32_t left = ((rx < 0) ? (x + rx) : x) >> 8;
+		int32_t top = ((ry < 0) ? (y + ry) : y) >> 8;
+		int32_t right = ((((rx > 0) ? (x + rx) : x) + 0xFF) >> 8) + (int32_t)mBall.sizeX;
+		int32_t bottom = ((((ry > 0) ? (y + ry) : y) + 0xFF) >> 8) + (int32_t)mBall.sizeY;
+
+		if (TileGrid_GetRange(&mTileGrid, left, top, right, bottom, &range))
+		{
+			for (int row = range.row0 ; row <= range.row1 ; row++)
+			{
+				uint16_t alive = mTileGrid.alive[row] & range.colMask;
+				int32_t tTop = mTileGrid.y + (row * mTileGrid.sizeY);
+
+				while (alive)
+				{
+					int col = __builtin_ctz(alive);
+					int32_t tLeft = mTileGrid.x + (col * mTileGrid.sizeX);
+
+					alive &= (alive - 1);
+
+					if ((Sprite_Ball_Sweep(x, y, rx, ry, tLeft, tTop,
+							tLeft + mTileGrid.sizeX, tTop + mTileGrid.sizeY, &hit))
+							&& ((target == SPRITE_TARGET_NONE) || (Sprite_Ball_IsEarlier(&hit, &best))))
+					{
+						best = hit;
+						target = (row * TILE_GRID_MAX_COLS) + col;
+					}
+				}
+			}
+		}
+
+		//clear path - take the rest of the step
+		if (target == SPRITE_TARGET_NONE)
+		{
+			x += rx;
+			y += ry;
+			break;
+		}
+
+		//move to the contact, exact on the axis that hit
+		x += (int32_t)(((int64_t)rx * best.num) / best.den);
+		y += (int32_t)(((int64_t)ry * best.num) / best.den);
+		remain = (int32_t)(((int64_t)remain * (best.den - best.num)) / best.den);
+
+		//reflect
+		if (best.face & (SPRITE_FACE_TOP | SPRITE_FACE_BOTTOM))
+			mBall.vy = -mBall.vy;
+
+		if (best.face & (SPRITE_FACE_LEFT | SPRITE_FACE_RIGHT))
+			mBall.vx = -mBall.vx;
 
-		//corner - LHS
-		if (bLeft <= SCREEN_LEFT)
-			updated = SPRITE_DIRECTION_45;
-		//corner - RHS
-		else if (bRight >= SCREEN_RIGHT)
-			updated = SPRITE_DIRECTION_135;
+		if (target == SPRITE_TARGET_WALL)
+			flagBoundary = 1;
+
+		//english - push vx by the offset from the
+		//paddle center, then back to ball speed
+		else if (target == SPRITE_TARGET_PLAYER)
+		{
+			int32_t offset = ((x >> 8) + (int32_t)(mBall.sizeX / 2)) -
+					(int32_t)(mPlayer.x + (mPlayer.sizeX / 2));
+
+			Sprite_Ball_SetDirection(mBall.vx + (offset * SPRITE_PADDLE_ENGLISH), mBall.vy);
+			flagPlayer = 1;
+		}
+
+		//hit the tile, removed when out of hits
 		else
-			updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_HORIZONTAL);
+		{
+			spriteGameScore += TileGrid_Hit(&mTileGrid, target / TILE_GRID_MAX_COLS,
+					target % TILE_GRID_MAX_COLS);
+			flagTile = 1;
+		}
+
+		//rest of the step in the new direction
+		rx = (int32_t)(((int64_t)mBall.vx * multiplier * remain) >> 16);
+		ry = (int32_t)(((int64_t)mBall.vy * multiplier * remain) >> 16);
 	}
 
+	mBall.posX = x;
+	mBall.posY = y;
+	mBall.x = (uint32_t)(x >> 8);
+	mBall.y = (uint32_t)(y >> 8);
 
 	//ball drops out the bottom - set a flag to be evaluated in main
-	else if (bTop >= SCREEN_BOTTOM)
+	if ((y >> 8) >= SCREEN_BOTTOM)
 		spriteBallMissedFlag = 1;
 
-	//top - lhs corner
-	else if ((bTop <= SCREEN_TOP) && (bLeft <= SCREEN_LEFT))
+	//play only one sound if ball hits more than
+	//one thing in the same move
+	if (flagTile == 1)
+		Sound_Play_TileBounce();
+
+	else if (flagPlayer == 1)
+		Sound_Play_PlayerBounce();
+
+	else if (flagBoundary == 1)
+		Sound_Play_WallBounce();
+}
+
+
+//////////////////////////////////////////////
+//Sweep the ball at x, y along rx, ry (Q8 pixels)
+//against the box left, top, right, bottom (pixels,
+//right and bottom are one past the box).  Returns 1
+//if the ball touches the box within the step, moving
+//into it, with the time of contact num / den of the
+//step and the box face(s) hit.  Both faces are set
+//for an exact corner hit.  Ball already overlapping
+//the box is not a hit.
+static uint8_t Sprite_Ball_Sweep(int32_t x, int32_t y, int32_t rx, int32_t ry,
+		int32_t left, int32_t top, int32_t right, int32_t bottom, SpriteSweep* hit)
+{
+	int32_t enterX = 0, exitX = 0, spanX = 0;
+	int32_t enterY = 0, exitY = 0, spanY = 0;
+	int32_t sizeX = (int32_t)mBall.sizeX << 8;
+	int32_t sizeY = (int32_t)mBall.sizeY << 8;
+
+	left <<= 8;
+	top <<= 8;
+	right <<= 8;
+	bottom <<= 8;
+
+	//distances to enter and leave the box on each axis
+	if (rx > 0)
 	{
-		updated = SPRITE_DIRECTION_315;
-		flagBoundary = 1;
+		enterX = left - (x + sizeX);
+		exitX = right - x;
+		spanX = rx;
 	}
-
-	//top - rhs corner
-	else if ((bTop <= SCREEN_TOP) && (bRight >= SCREEN_RIGHT))
+	else if (rx < 0)
 	{
-		updated = SPRITE_DIRECTION_225;
-		flagBoundary = 1;
+		enterX = x - right;
+		exitX = (x + sizeX) - left;
+		spanX = -rx;
 	}
+	else if (((x + sizeX) <= left) || (x >= right))
+		return 0;
 
-	//top - in the middle somewhere
-	else if ((bTop <= SCREEN_TOP) && (bLeft > SCREEN_LEFT) && (bRight < SCREEN_RIGHT))
+	if (ry > 0)
 	{
-		updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_HORIZONTAL);
-		flagBoundary = 1;
+		enterY = top - (y + sizeY);
+		exitY = bottom - y;
+		spanY = ry;
 	}
-
-
-	else if (bLeft <= SCREEN_LEFT)
+	else if (ry < 0)
 	{
-		//check if it hit it parallel
-		if ((mBall.angle == SPRITE_DIRECTION_90) || (mBall.angle == SPRITE_DIRECTION_116))
-			updated = SPRITE_DIRECTION_45;
-		else if ((mBall.angle == SPRITE_DIRECTION_270) || (mBall.angle == SPRITE_DIRECTION_243))
-			updated = SPRITE_DIRECTION_315;
-		else
-			updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_VERTICAL);
+		enterY = y - bottom;
+		exitY = (y + sizeY) - top;
+		spanY = -ry;
+	}
+	else if (((y + sizeY) <= top) || (y >= bottom))
+		return 0;
 
-		flagBoundary = 1;
+	if ((!spanX) && (!spanY))
+		return 0;
 
-	}
+	//contact is when the later axis enters
+	int64_t order = 1;
 
-	else if (bRight >= SCREEN_RIGHT)
-	{
-		//check if it hit it parallel
-		if ((mBall.angle == SPRITE_DIRECTION_90) || (mBall.angle == SPRITE_DIRECTION_63))
-			updated = SPRITE_DIRECTION_135;
-		else if ((mBall.angle == SPRITE_DIRECTION_270) || (mBall.angle == SPRITE_DIRECTION_296))
-			updated = SPRITE_DIRECTION_225;
-		else
-			updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_VERTICAL);
+	if ((spanX) && (spanY))
+		order = ((int64_t)enterX * spanY) - ((int64_t)enterY * spanX);
+	else if (!spanX)
+		order = -1;
 
-		flagBoundary = 1;
+	hit->face = 0x00;
 
+	if (order >= 0)
+	{
+		hit->num = enterX;
+		hit->den = spanX;
+		hit->face |= (rx > 0) ? SPRITE_FACE_LEFT : SPRITE_FACE_RIGHT;
 	}
 
-	//hit a tile?
-	else
+	if (order <= 0)
 	{
-		spriteBallMissedFlag = 0;
+		hit->num = enterY;
+		hit->den = spanY;
+		hit->face |= (ry > 0) ? SPRITE_FACE_TOP : SPRITE_FACE_BOTTOM;
+	}
 
-		//for each tile....
-		for (int i = 0 ; i < NUM_TILES ; i++)
-		{
-			if (mTile[i].life == 1)
-			{
-				tBot = mTile[i].y + mTile[i].sizeY;
-				tTop = mTile[i].y;
-				tLeft = mTile[i].x;
-				tRight = mTile[i].x + mTile[i].sizeX;
-				tX = (tLeft + tRight) / 2;
-				tY = (tTop + tBot) / 2;
-
-				//connect on the top of the ball - bottom of a tile
-				if ((bTop <= tBot) && (bTop >= tY) && (bX >= tLeft) && (bX <= tRight))
-				{
-					//top of ball hit bottom of a tile
-					flagTile = 1;
-					tileIndex = i;
-					i = NUM_TILES - 1;
-					updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_HORIZONTAL);
-					break;
-				}
+	//behind the ball or past the end of the step
+	if ((hit->num < 0) || (hit->num > hit->den))
+		return 0;
 
-				//connect on the bottom of ball top of the tile
-				else if ((bBot >= tTop) && (bBot <= tY) && (bX >= tLeft) && (bX <= tRight))
-				{
-					//bottom of ball hit the top of a tile
-					flagTile = 1;
-					tileIndex = i;
-					i = NUM_TILES - 1;
-					updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_HORIZONTAL);
-					break;
-				}
+	//must still overlap on the other axis at contact
+	if ((spanX) && (((int64_t)hit->num * spanX) >= ((int64_t)exitX * hit->den)))
+		return 0;
 
-				//connect right side of ball with left side of tile
-				else if ((bRight >= tLeft) && (bRight <= tX) && (bY >= tTop) && (bY <= tBot))
-				{
-					//bottom of ball hit the top of a tile
-					flagTile = 1;
-					tileIndex = i;
-					i = NUM_TILES - 1;
-					updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_VERTICAL);
-					break;
-				}
+	if ((spanY) && (((int64_t)hit->num * spanY) >= ((int64_t)exitY * hit->den)))
+		return 0;
 
-				//connect left side of ball with right side of tile
-				else if ((bLeft <= tRight) && (bLeft >= tX) && (bY >= tTop) && (bY <= tBot))
-				{
-					//bottom of ball hit the top of a tile
-					flagTile = 1;
-					tileIndex = i;
-					i = NUM_TILES - 1;
-					updated = Sprite_GetReboundAngle(mBall.angle, SURFACE_VERTICAL);
-					break;
-				}
+	return 1;
+}
 
-				//don't do anything, and the updated stays as it
-				//was at the the top of the function
-				else
-				{
-					flagTile = 0;
-				}
-			}
-		}
-	}
 
+//////////////////////////////////////////////
+//Returns 1 if contact a happens before contact b
+static uint8_t Sprite_Ball_IsEarlier(const SpriteSweep* a, const SpriteSweep* b)
+{
+	if (((int64_t)a->num * b->den) < ((int64_t)b->num * a->den))
+		return 1;
 
+	return 0;
+}
 
-	//play only one sound if ball hits tile and boundary
-	//at the same time
 
-	//remove the tile
-	if (flagTile == 1)
-	{
-		mTile[tileIndex].life = 0;				//set life to 0
-		mTile[tileIndex].image = &imgTileBlank;	//clear the image
+//////////////////////////////////////////////
+//Set the ball velocity along dx, dy at the ball
+//speed.  The slope is limited so the ball can't
+//run flat, dy = 0 is taken as up.
+static void Sprite_Ball_SetDirection(int32_t dx, int32_t dy)
+{
+	int32_t maxX;
 
-		spriteGameScore += mTile[tileIndex].points;
+	if (!dy)
+		dy = -1;
 
-		//play sound
-		Sound_Play_TileBounce();
-	}
+	maxX = SPRITE_BALL_MAX_SLOPE * ((dy < 0) ? -dy : dy);
 
-	//hit a wall
-	else if (flagBoundary == 1)
-	{
-		Sound_Play_WallBounce();
-	}
+	if (dx > maxX)
+		dx = maxX;
+	else if (dx < -maxX)
+		dx = -maxX;
+
+	//length of dx, dy from the inverse square root
+	uint32_t inv = Sprite_InvSqrt((uint32_t)((dx * dx) + (dy * dy)));
 
-	//compute new x and y position from updated
-	//index x and y position by dx and dy
-	mBall.angle = updated;
-	dx = Sprite_Get_DX_FromAngle(updated);
-	dy = Sprite_Get_DY_FromAngle(updated);
+	mBall.vx = (int32_t)(((int64_t)dx * SPRITE_BALL_SPEED * inv) >> 24);
+	mBall.vy = (int32_t)(((int64_t)dy * SPRITE_BALL_SPEED * inv) >> 24);
+}
 
-	int multiplier = (int)Sprite_GetGameSpeed();
 
+//////////////////////////////////////////////
+//Fast integer inverse square root, Q24 result.
+//The leading bit gives a start within 0.84 - 1.19
+//of the answer, then 4 Newton steps
+//r = r * (3 - n * r^2) / 2.  n * r^2 stays near
+//2^48, so it fits 64 bits for any n.
+static uint32_t Sprite_InvSqrt(uint32_t n)
+{
+	if (!n)
+		return 0;
 
-	if ((dx < 0) && (mBall.x <=SCREEN_LEFT))
-	{
-		mBall.x += ((-1*dx) * multiplier);
-		mBall.y += (dy * multiplier);
-	}
-	else
+	int log2 = 31 - __builtin_clz(n);
+	uint64_t r = ((log2 & 0x01) ? 0x9837F0 : 0xD744FD) >> (log2 >> 1);
+
+	for (int i = 0 ; i < 4 ; i++)
 	{
-		mBall.x += (dx * multiplier);
-		mBall.y += (dy * multiplier);
+		uint64_t nr2 = ((uint64_t)n * r * r) >> 32;		//Q16
+		r = (r * (0x30000 - nr2)) >> 17;
 	}
 
+	return (uint32_t)r;
 }
 
 
 /////////////////////////////////////
 //Move the player to the new
-//x and y position.  For now, just
-//move the player to follow the x
-//position of the ball
-//After the slide pot is added, move
-//this to ADC
+//x and y position.  Demo mode runs the
+//paddle ai, the others use the touch
+//panel or the slide pot (ADC).
 //
-//use the touch panel to get the x position
 //this function is called in the main loop
 //
 //touch screen position is updated in the
@@ -429,21 +623,24 @@ void Sprite_Player_Move(void)
 {
 	TouchPanelData data;
 	uint16_t adcPosition;
+	uint16_t touchX, touchY;
 
 
 	if (spriteGameMode == GAME_MODE_DEMO)
-	{
-		if (mBall.x < (mPlayer.sizeX / 2))
-			mPlayer.x = 0;
-		else if (mBall.x > (SCREEN_RIGHT - mPlayer.sizeX))
-			mPlayer.x = SCREEN_RIGHT - mPlayer.sizeX;
-		else
-			mPlayer.x = mBall.x - (mPlayer.sizeX / 2);
-	}
+		Sprite_AI_Move();
+
 	else if (spriteGameMode == GAME_MODE_TOUCH_SCREEN)
 	{
-		data = TouchPanel_getPosition();
-		Sprite_SetPlayerX(data.xPos);
+		//filtered position, predicted to when the
+		//frame is on the screen.  holds the last
+		//position when not touched
+		if (TouchTrack_GetPosition(HAL_GetTick(), &touchX, &touchY))
+			Sprite_SetPlayerX(touchX);
+		else
+		{
+			data = TouchPanel_getPosition();
+			Sprite_SetPlayerX(data.xPos);
+		}
 	}
 
 	else if (spriteGameMode == GAME_MODE_SLIDE_POT)
@@ -454,6 +651,174 @@ void Sprite_Player_Move(void)
 }
 
 
+/////////////////////////////////////
+//Demo mode paddle.  Predicts where the
+//ball lands only when its direction
+//changes, then moves the paddle toward
+//that with bounded speed and acceleration.
+//The aim is moved off center a little for
+//each prediction, so the english varies.
+static void Sprite_AI_Move(void)
+{
+	if ((!mAI.valid) || (mBall.vx != mAI.vx) || (mBall.vy != mAI.vy))
+	{
+		uint32_t start = Sprite_GetCycles();
+		int32_t aim = (int32_t)((mAIStats.numPredictions * 7) % ((2 * SPRITE_AI_AIM_RANGE) + 1)) - SPRITE_AI_AIM_RANGE;
+
+		mAI.target = Sprite_AI_PredictX() - (aim << 8);
+		mAI.vx = mBall.vx;
+		mAI.vy = mBall.vy;
+		mAI.valid = 1;
+
+		mAIStats.lastCycles = Sprite_GetCycles() - start;
+		mAIStats.totalCycles += mAIStats.lastCycles;
+		if (mAIStats.lastCycles > mAIStats.maxCycles)
+			mAIStats.maxCycles = mAIStats.lastCycles;
+		mAIStats.numPredictions++;
+	}
+
+	mAIStats.numTicks++;
+
+	//fastest speed toward the target that can still
+	//stop on it, v = sqrt(2 * a * d), then limit the
+	//change in speed
+	int32_t error = mAI.target - mAI.pos;
+	uint32_t distance = (uint32_t)((error < 0) ? -error : error);
+	uint32_t stop = 2 * SPRITE_AI_ACCEL * distance;						//Q16
+	int32_t speed = (int32_t)(((uint64_t)stop * Sprite_InvSqrt(stop)) >> 24);	//Q8
+
+	if (speed > SPRITE_AI_MAX_SPEED)
+		speed = SPRITE_AI_MAX_SPEED;
+
+	if (error < 0)
+		speed = -speed;
+
+	int32_t accel = speed - mAI.vel;
+
+	if (accel > SPRITE_AI_ACCEL)
+		accel = SPRITE_AI_ACCEL;
+	else if (accel < -SPRITE_AI_ACCEL)
+		accel = -SPRITE_AI_ACCEL;
+
+	mAI.vel += accel;
+	mAI.pos += mAI.vel;
+
+	if (mAI.pos < 0)
+		mAI.pos = 0;
+
+	Sprite_SetPlayerX((uint16_t)(mAI.pos >> 8));
+
+	//stopped at the side of the screen
+	int32_t center = (mPlayer.x + (mPlayer.sizeX / 2)) << 8;
+
+	if ((center >> 8) != (mAI.pos >> 8))
+	{
+		mAI.pos = center;
+		mAI.vel = 0;
+	}
+}
+
+
+/////////////////////////////////////
+//Ball center x (Q8) when it reaches the
+//paddle.  Walls are unfolded - the ball
+//runs in a straight line across mirror
+//copies of the play area, the distance
+//across is folded back into it.  Going up,
+//the path turns at the lowest tile row if
+//the ball meets a live tile there, else at
+//the top.  Anything else changes the
+//direction and so gets a new prediction.
+static int32_t Sprite_AI_PredictX(void)
+{
+	int32_t contact = (int32_t)(mPlayer.y - mBall.sizeY) << 8;
+	int32_t distance;
+
+	if (mBall.vy > 0)
+		distance = contact - mBall.posY;
+	else
+	{
+		int32_t turn = Sprite_AI_GetTurnY();
+		distance = (mBall.posY - turn) + (contact - turn);
+	}
+
+	if ((distance <= 0) || (!mBall.vy))
+		return mBall.posX + ((int32_t)mBall.sizeX << 7);
+
+	return Sprite_AI_Unfold(distance) + ((int32_t)mBall.sizeX << 7);
+}
+
+
+/////////////////////////////////////
+//Ball x (Q8) after it moves distance
+//(Q8) up or down, walls unfolded
+static int32_t Sprite_AI_Unfold(int32_t distance)
+{
+	int32_t left = SCREEN_LEFT << 8;
+	int32_t width = ((SCREEN_RIGHT - SCREEN_LEFT - (int32_t)mBall.sizeX) << 8);
+	int32_t vy = (mBall.vy > 0) ? mBall.vy : -mBall.vy;
+
+	if ((width <= 0) || (!vy))
+		return mBall.posX;
+
+	int32_t across = (int32_t)(((int64_t)mBall.vx * distance) / vy);
+	int32_t x = ((mBall.posX - left) + across) % (2 * width);
+
+	if (x < 0)
+		x += 2 * width;
+	if (x > width)
+		x = (2 * width) - x;
+
+	return left + x;
+}
+
+
+/////////////////////////////////////
+//Ball top y (Q8) where a ball going up
+//turns down - the bottom of the lowest
+//tile row if it meets a live tile
+//there, else the top of the screen.
+static int32_t Sprite_AI_GetTurnY(void)
+{
+	TileRange range;
+	int row = mTileGrid.numRows - 1;
+
+	while ((row >= 0) && (!mTileGrid.alive[row]))
+		row--;
+
+	if (row < 0)
+		return SCREEN_TOP << 8;
+
+	int32_t turn = (mTileGrid.y + ((row + 1) * mTileGrid.sizeY));
+
+	if ((turn << 8) >= mBall.posY)
+		return SCREEN_TOP << 8;
+
+	int32_t x = Sprite_AI_Unfold(mBall.posY - (turn << 8)) >> 8;
+
+	if ((TileGrid_GetRange(&mTileGrid, x, turn - 1, x + (int32_t)mBall.sizeX, turn, &range))
+			&& (mTileGrid.alive[row] & range.colMask))
+		return turn << 8;
+
+	return SCREEN_TOP << 8;
+}
+
+
+void Sprite_GetAIStats(SpriteAIStats* stats)
+{
+	*stats = mAIStats;
+}
+
+static uint32_t Sprite_GetCycles(void)
+{
+#ifdef SPRITE_PROFILE_AI
+	return DWT->CYCCNT;
+#else
+	return 0x00;
+#endif
+}
+
+
 ///////////////////////////////////////////
 //draw app sprites in the game
 //use 2 buffers, always drawing
@@ -480,23 +845,41 @@ void Sprite_Draw(void)
 	int n = sprintf(buffer, "S:%04d L:%d P:%d", spriteGameScore, spriteGameLevel, mPlayer.numLives);
 	LCD_DrawStringLength(spriteActiveBuffer, 0, buffer, n);
 
+#ifdef SPRITE_SHOW_TOUCH_LATENCY
+	//fifo read to frame present latency, ms
+	if (spriteGameMode == GAME_MODE_TOUCH_SCREEN)
+	{
+		TouchTrackLatency latency;
+		TouchTrack_GetLatency(&latency);
+		memset(buffer, 0x00, 40);
+		n = sprintf(buffer, "T:%lu A:%lu M:%lu", (unsigned long)latency.last,
+				(unsigned long)latency.average, (unsigned long)latency.max);
+		LCD_DrawStringLength(spriteActiveBuffer, 1, buffer, n);
+	}
+#endif
+
 	//draw the game mode if in demo mode
 	if (spriteGameMode == GAME_MODE_DEMO)
 	{
 		LCD_DrawString(spriteActiveBuffer, 9, "   Demo Mode");
 		LCD_DrawString(spriteActiveBuffer, 10, "Press To Start");
+
+#ifdef SPRITE_PROFILE_AI
+		//predictions, average and max cycles each
+		memset(buffer, 0x00, 40);
+		n = sprintf(buffer, "P:%lu A:%lu M:%lu", (unsigned long)mAIStats.numPredictions,
+				(unsigned long)(mAIStats.numPredictions ? (mAIStats.totalCycles / mAIStats.numPredictions) : 0),
+				(unsigned long)mAIStats.maxCycles);
+		LCD_DrawStringLength(spriteActiveBuffer, 1, buffer, n);
+#endif
 	}
 
 
 	//draw the ball
 	LCD_DrawBitmapTransparent(spriteActiveBuffer, mBall.x, mBall.y, mBall.image, WHITE);
 
-	//draw the tiles
-	for (int i = 0 ; i < NUM_TILES ; i++)
-	{
-		if (mTile[i].life == 1)
-			LCD_DrawBitmapTransparent(spriteActiveBuffer, mTile[i].x, mTile[i].y, mTile[i].image, WHITE);
-	}
+	//draw the live tiles
+	TileGrid_Draw(&mTileGrid, spriteActiveBuffer);
 
 	//draw the player
 	if (mPlayer.numLives > 0)
@@ -509,6 +892,8 @@ void Sprite_Draw(void)
 	else
 		HAL_LTDC_SetAddress(&hltdc, (uint32_t)SDRAM_LCD_LAYER_1, 0);
 
+	//immediate reload - the frame is presented now
+	TouchTrack_FramePresented(HAL_GetTick());
 }
 
 uint8_t Sprite_GetActiveDisplayBuffer(void)
@@ -528,14 +913,7 @@ uint8_t Sprite_GetNumPlayers(void)
 //get remaining number of tiles
 uint16_t Sprite_GetNumTiles(void)
 {
-	uint16_t count = 0;
-	for (int i = 0 ; i < NUM_TILES ; i++)
-	{
-		if (mTile[i].life == 1)
-			count++;
-	}
-
-	return count;
+	return TileGrid_GetNumAlive(&mTileGrid);
 }
 
 
@@ -678,123 +1056,9 @@ void Sprite_SetPlayerX(uint16_t xPos)
 {
 	if (xPos < (mPlayer.sizeX / 2))
 		mPlayer.x = 0;
-	else if (xPos > (SCREEN_RIGHT - mPlayer.sizeX))
+	else if (xPos > (SCREEN_RIGHT - (mPlayer.sizeX / 2)))
 		mPlayer.x = SCREEN_RIGHT - mPlayer.sizeX;
 	else
 		mPlayer.x = xPos - (mPlayer.sizeX / 2);
 }
 
-
-//////////////////////////////////////////////
-//compute the rebound direction based on a source
-//object direction and a surface.  for now, only
-//allow surfaces that are horiz and vertical.
-//This is probably the case with all pong objects
-SpriteDirection_t Sprite_GetReboundAngle(SpriteDirection_t object, SurfaceOrientation_t orientation)
-{
-	if (orientation == SURFACE_HORIZONTAL)
-	{
-		switch(object)
-		{
-
-			case SPRITE_DIRECTION_0:	return	SPRITE_DIRECTION_0;
-			case SPRITE_DIRECTION_26:	return	SPRITE_DIRECTION_333;
-			case SPRITE_DIRECTION_45:	return	SPRITE_DIRECTION_315;
-			case SPRITE_DIRECTION_63:	return	SPRITE_DIRECTION_296;
-			case SPRITE_DIRECTION_90:	return	SPRITE_DIRECTION_270;
-			case SPRITE_DIRECTION_116:	return	SPRITE_DIRECTION_243;
-			case SPRITE_DIRECTION_135:	return	SPRITE_DIRECTION_225;
-			case SPRITE_DIRECTION_153:	return	SPRITE_DIRECTION_206;
-			case SPRITE_DIRECTION_180:	return	SPRITE_DIRECTION_180;
-			case SPRITE_DIRECTION_206:	return	SPRITE_DIRECTION_153;
-			case SPRITE_DIRECTION_225:	return	SPRITE_DIRECTION_135;
-			case SPRITE_DIRECTION_243:	return	SPRITE_DIRECTION_116;
-			case SPRITE_DIRECTION_270:	return	SPRITE_DIRECTION_90;
-			case SPRITE_DIRECTION_296:	return	SPRITE_DIRECTION_63;
-			case SPRITE_DIRECTION_315:	return	SPRITE_DIRECTION_45;
-			case SPRITE_DIRECTION_333:	return	SPRITE_DIRECTION_26;
-		}
-	}
-	else if (orientation == SURFACE_VERTICAL)
-	{
-		switch(object)
-		{
-			case SPRITE_DIRECTION_0:	return	SPRITE_DIRECTION_180;
-			case SPRITE_DIRECTION_26:	return	SPRITE_DIRECTION_153;
-			case SPRITE_DIRECTION_45:	return	SPRITE_DIRECTION_135;
-			case SPRITE_DIRECTION_63:	return	SPRITE_DIRECTION_116;
-			case SPRITE_DIRECTION_90:	return	SPRITE_DIRECTION_90;
-			case SPRITE_DIRECTION_116:	return	SPRITE_DIRECTION_63;
-			case SPRITE_DIRECTION_135:	return	SPRITE_DIRECTION_45;
-			case SPRITE_DIRECTION_153:	return	SPRITE_DIRECTION_26;
-			case SPRITE_DIRECTION_180:	return	SPRITE_DIRECTION_0;
-			case SPRITE_DIRECTION_206:	return	SPRITE_DIRECTION_333;
-			case SPRITE_DIRECTION_225:	return	SPRITE_DIRECTION_315;
-			case SPRITE_DIRECTION_243:	return	SPRITE_DIRECTION_296;
-			case SPRITE_DIRECTION_270:	return	SPRITE_DIRECTION_270;
-			case SPRITE_DIRECTION_296:	return	SPRITE_DIRECTION_243;
-			case SPRITE_DIRECTION_315:	return	SPRITE_DIRECTION_225;
-			case SPRITE_DIRECTION_333:	return	SPRITE_DIRECTION_206;
-		}
-	}
-	else
-	{
-		//do nothing
-	}
-
-	return SPRITE_DIRECTION_0;
-}
-
-int Sprite_Get_DX_FromAngle(SpriteDirection_t angle)
-{
-	switch(angle)
-	{
-		case SPRITE_DIRECTION_0:	return 2;
-		case SPRITE_DIRECTION_26:	return 2;
-		case SPRITE_DIRECTION_45:	return 2;
-		case SPRITE_DIRECTION_63:	return 1;
-		case SPRITE_DIRECTION_90:	return 0;
-		case SPRITE_DIRECTION_116:	return -1;
-		case SPRITE_DIRECTION_135:	return -2;
-		case SPRITE_DIRECTION_153:	return -2;
-		case SPRITE_DIRECTION_180:	return -2;
-		case SPRITE_DIRECTION_206:	return -2;
-		case SPRITE_DIRECTION_225:	return -2;
-		case SPRITE_DIRECTION_243:	return -1;
-		case SPRITE_DIRECTION_270:	return	0;
-		case SPRITE_DIRECTION_296:	return 1;
-		case SPRITE_DIRECTION_315:	return 2;
-		case SPRITE_DIRECTION_333:	return 2;
-	}
-
-	return 2;
-}
-
-
-//////////////////////////////////////////
-//y positive down
-int Sprite_Get_DY_FromAngle(SpriteDirection_t angle)
-{
-	switch(angle)
-	{
-		case SPRITE_DIRECTION_0:	return 0;
-		case SPRITE_DIRECTION_26:	return -1;
-		case SPRITE_DIRECTION_45:	return -2;
-		case SPRITE_DIRECTION_63:	return -2;
-		case SPRITE_DIRECTION_90:	return -2;
-		case SPRITE_DIRECTION_116:	return -2;
-		case SPRITE_DIRECTION_135:	return -2;
-		case SPRITE_DIRECTION_153:	return -1;
-		case SPRITE_DIRECTION_180:	return 0;
-		case SPRITE_DIRECTION_206:	return 1;
-		case SPRITE_DIRECTION_225:	return 2;
-		case SPRITE_DIRECTION_243:	return 2;
-		case SPRITE_DIRECTION_270:	return 2;
-		case SPRITE_DIRECTION_296:	return 2;
-		case SPRITE_DIRECTION_315:	return 2;
-		case SPRITE_DIRECTION_333:	return 1;
-	}
-
-	return 0;
-}
-
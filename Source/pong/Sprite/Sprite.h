@@ -16,11 +16,6 @@ Sprite header file
 
 ///////////////////////////////////
 //defines
-#define TILE_HEADER		30		//pixel offset from top
-#define NUM_TILES		40
-#define NUM_TILE_ROWS	5
-#define NUM_TILE_COLS	8
-
 #define SCREEN_TOP		8
 #define SCREEN_BOTTOM	311
 #define SCREEN_LEFT		8
@@ -30,38 +25,36 @@ Sprite header file
 #define PLAYER_DEFAULT_X	100
 #define PLAYER_DEFAULT_Y	290
 
+//ball motion and collision
+#define SPRITE_BALL_SPEED		((int32_t)0x02D4)	//Q8 pixels per move at GAME_SPEED_LOW
+#define SPRITE_BALL_MAX_SLOPE	2			//|vx| up to 2 * |vy|
+#define SPRITE_PADDLE_ENGLISH	((int32_t)12)		//Q8 vx per pixel off the paddle center
+#define SPRITE_BALL_MAX_HITS	4			//bounces resolved per move
+#define SPRITE_WALL_DEPTH		0x1000		//walls are boxes this deep
 
-////////////////////////////////
-//Direction enum
-//support only a few angles to make
-//the math easier and keep ball movements
-//at max pixels in any direction
-typedef enum
-{
-	SPRITE_DIRECTION_0,
-	SPRITE_DIRECTION_26,
-	SPRITE_DIRECTION_45,
-	SPRITE_DIRECTION_63,
-	SPRITE_DIRECTION_90,
-	SPRITE_DIRECTION_116,
-	SPRITE_DIRECTION_135,
-	SPRITE_DIRECTION_153,
-	SPRITE_DIRECTION_180,
-	SPRITE_DIRECTION_206,
-	SPRITE_DIRECTION_225,
-	SPRITE_DIRECTION_243,
-	SPRITE_DIRECTION_270,
-	SPRITE_DIRECTION_296,
-	SPRITE_DIRECTION_315,
-	SPRITE_DIRECTION_333,
-
-}SpriteDirection_t;
+#define SPRITE_TARGET_NONE		-1			//0 and up are tile cell, row * max cols + col
+#define SPRITE_TARGET_WALL		-2
+#define SPRITE_TARGET_PLAYER	-3
 
-typedef enum
-{
-	SURFACE_HORIZONTAL,
-	SURFACE_VERTICAL,
-}SurfaceOrientation_t;
+//faces of the box hit by the ball
+#define SPRITE_FACE_TOP			0x01
+#define SPRITE_FACE_BOTTOM		0x02
+#define SPRITE_FACE_LEFT		0x04
+#define SPRITE_FACE_RIGHT		0x08
+
+//demo mode paddle ai, Q8 pixels
+#define SPRITE_AI_MAX_SPEED		((int32_t)0x0C00)	//per tick
+#define SPRITE_AI_ACCEL			((int32_t)0x0200)	//per tick, per tick
+#define SPRITE_AI_AIM_RANGE		15					//+/- pixels off center, for english
+
+//uncomment to record the demo ai prediction cost
+//using the DWT cycle counter, shown in demo mode
+//and read with Sprite_GetAIStats
+//#define SPRITE_PROFILE_AI		1
+
+//uncomment to show touch panel latency (ms) in
+//touch screen mode - last, average, max
+//#define SPRITE_SHOW_TOUCH_LATENCY	1
 
 
 typedef enum
@@ -81,28 +74,53 @@ typedef enum
 //structs
 typedef struct 
 {
-	uint32_t x;
+	uint32_t x;				//pixels, from posX, posY
 	uint32_t y;
+	int32_t posX;			//Q8 pixels
+	int32_t posY;
+	int32_t vx;				//Q8 pixels per move at GAME_SPEED_LOW
+	int32_t vy;
 	uint32_t sizeX;
 	uint32_t sizeY;
-	SpriteDirection_t angle;
 	const ImageData* image;
 
 }BallStruct;
 
 
-//tiles
+//ball contact from a swept move, time
+//of contact is num / den of the step
 typedef struct
 {
-	uint8_t life;
-	uint32_t x;
-	uint32_t y;
-	uint32_t sizeX;
-	uint32_t sizeY;
-	uint16_t points;
-	void (*tileHandler)(void);
-	const ImageData* image;
-}TileStruct;
+	int32_t num;
+	int32_t den;
+	uint8_t face;
+}SpriteSweep;
+
+
+//demo mode paddle ai.  The landing x is predicted
+//when the ball changes direction, the paddle center
+//(pos, vel) chases it with bounded acceleration.
+typedef struct
+{
+	int32_t pos;			//paddle center, Q8 pixels
+	int32_t vel;			//Q8 pixels per tick
+	int32_t target;			//paddle center for the predicted hit
+	int32_t vx;				//ball velocity the prediction is for
+	int32_t vy;
+	uint8_t valid;
+}SpriteAI;
+
+//prediction cost, cycles are 0 unless
+//SPRITE_PROFILE_AI is set
+typedef struct
+{
+	uint32_t numPredictions;
+	uint32_t numTicks;
+	uint32_t lastCycles;
+	uint32_t maxCycles;
+	uint32_t totalCycles;
+}SpriteAIStats;
+
 
 //player
 typedef struct
@@ -136,6 +154,7 @@ uint8_t Sprite_GetBallMissedFlag(void);
 void Sprite_DisplayDroppedBall(void);
 void Sprite_DisplayGameOver(void);
 void Sprite_DisplayGameStart(void);
+void Sprite_DisplayTouchCalibration(void);
 
 
 
@@ -162,10 +181,9 @@ GameSpeed_t Sprite_GetGameSpeed(void);
 uint16_t Sprite_GetPlayerX(void);
 void Sprite_SetPlayerX(uint16_t xPos);
 
+void Sprite_GetAIStats(SpriteAIStats* stats);
+
 
-SpriteDirection_t Sprite_GetReboundAngle(SpriteDirection_t object, SurfaceOrientation_t orientation);
-int Sprite_Get_DX_FromAngle(SpriteDirection_t angle);	//base 2
-int Sprite_Get_DY_FromAngle(SpriteDirection_t angle);	//base 2
 
 
 #endif
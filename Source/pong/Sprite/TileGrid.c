@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////
+/*
+Tile Grid - the breakout tile field.
+
+See TileGrid.h for the level format.
+
+*/
+//////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <string.h>
+
+#include "TileGrid.h"
+#include "Graphics.h"
+
+
+///////////////////////////////////////////
+//Load a level into the grid.  Returns 0 if ok,
+//-1 if the level does not fit or uses an
+//unknown tile type.
+int TileGrid_Load(TileGrid* grid, const uint8_t* level, const TileType* types, uint8_t numTypes)
+{
+	uint8_t numRows = level[0];
+	uint8_t numCols = level[1];
+	const uint8_t* cells = &level[TILE_GRID_HEADER_SIZE];
+
+	if ((!numRows) || (numRows > TILE_GRID_MAX_ROWS) ||
+		(!numCols) || (numCols > TILE_GRID_MAX_COLS) ||
+		(!level[2]) || (!level[3]))
+		return -1;
+
+	memset(grid, 0x00, sizeof(TileGrid));
+
+	grid->numRows = numRows;
+	grid->numCols = numCols;
+	grid->sizeX = level[2];
+	grid->sizeY = level[3];
+	grid->x = level[4];
+	grid->y = level[5];
+	grid->types = types;
+	grid->numTypes = numTypes;
+
+	for (int row = 0 ; row < numRows ; row++)
+	{
+		for (int col = 0 ; col < numCols ; col++)
+		{
+			uint16_t n = (row * numCols) + col;
+			uint8_t type = (n & 0x01) ? (cells[n >> 1] & 0x0F) : (cells[n >> 1] >> 4);
+
+			if (type == TILE_TYPE_EMPTY)
+				continue;
+
+			if (type >= numTypes)
+				return -1;
+
+			grid->type[row][col] = type;
+			grid->hits[row][col] = types[type].hits;
+			grid->alive[row] |= (1u << col);
+			grid->numAlive++;
+		}
+	}
+
+	return 0;
+}
+
+
+uint16_t TileGrid_GetNumAlive(const TileGrid* grid)
+{
+	return grid->numAlive;
+}
+
+
+///////////////////////////////////////////
+//Cells under the box left, top, right, bottom
+//(right and bottom are one past the box).
+//Returns 0 if the box misses the grid.  A box no
+//larger than a cell covers at most four cells.
+uint8_t TileGrid_GetRange(const TileGrid* grid, int32_t left, int32_t top, int32_t right, int32_t bottom, TileRange* range)
+{
+	int32_t gridRight = grid->x + (grid->numCols * grid->sizeX);
+	int32_t gridBottom = grid->y + (grid->numRows * grid->sizeY);
+
+	if ((right <= grid->x) || (left >= gridRight) ||
+		(bottom <= grid->y) || (top >= gridBottom))
+		return 0;
+
+	if (left < grid->x)
+		left = grid->x;
+	if (right > gridRight)
+		right = gridRight;
+	if (top < grid->y)
+		top = grid->y;
+	if (bottom > gridBottom)
+		bottom = gridBottom;
+
+	uint32_t col0 = (uint32_t)(left - grid->x) / grid->sizeX;
+	uint32_t col1 = (uint32_t)(right - 1 - grid->x) / grid->sizeX;
+
+	range->row0 = (uint32_t)(top - grid->y) / grid->sizeY;
+	range->row1 = (uint32_t)(bottom - 1 - grid->y) / grid->sizeY;
+	range->colMask = (uint16_t)(((2u << col1) - 1) & ~((1u << col0) - 1));
+
+	return 1;
+}
+
+
+///////////////////////////////////////////
+//Hit a live cell.  Returns the points if the hit
+//clears it, 0 if it takes more hits.
+uint16_t TileGrid_Hit(TileGrid* grid, uint8_t row, uint8_t col)
+{
+	if (!(grid->alive[row] & (1u << col)))
+		return 0;
+
+	if (grid->hits[row][col] > 1)
+	{
+		grid->hits[row][col]--;
+		return 0;
+	}
+
+	grid->hits[row][col] = 0;
+	grid->alive[row] &= ~(1u << col);
+	grid->numAlive--;
+
+	return grid->types[grid->type[row][col]].points;
+}
+
+
+///////////////////////////////////////////
+//Draw the live cells, dead cells are skipped
+void TileGrid_Draw(const TileGrid* grid, uint32_t layer)
+{
+	for (int row = 0 ; row < grid->numRows ; row++)
+	{
+		uint16_t alive = grid->alive[row];
+		uint32_t y = grid->y + (row * grid->sizeY);
+
+		while (alive)
+		{
+			int col = __builtin_ctz(alive);
+			uint32_t x = grid->x + (col * grid->sizeX);
+			const TileType* type = &grid->types[grid->type[row][col]];
+
+			alive &= (alive - 1);
+
+			if (type->image)
+				LCD_DrawBitmapTransparent(layer, x, y, type->image, WHITE);
+			else
+				LCD_DrawBox(layer, x + 1, y + 1, grid->sizeX - 2, grid->sizeY - 2, type->color);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////
+/*
+Tile Grid - the breakout tile field.
+
+Tiles live on a grid of equal cells.  Each row keeps an
+alive bitmap (bit per column), each cell a type and the
+hits left to clear it.  A box in pixels maps to a range
+of cells, so collision only looks at the live cells
+under the ball, and drawing skips dead cells.
+
+Level format - compact, const byte array:
+[0] numRows
+[1] numCols
+[2] cell sizeX, pixels
+[3] cell sizeY, pixels
+[4] x of cell 0, 0
+[5] y of cell 0, 0
+then numRows * numCols cell types, 4 bits each, high
+nibble first, row by row.  Type 0 is an empty cell,
+other types index the TileType table.
+
+*/
+//////////////////////////////////////////////////////////
+
+#ifndef __TILE_GRID_H
+#define __TILE_GRID_H
+
+#include <stdint.h>
+
+#include "Graphics.h"
+
+
+#define TILE_GRID_MAX_ROWS			12
+#define TILE_GRID_MAX_COLS			16			//alive bitmap is uint16_t
+#define TILE_GRID_HEADER_SIZE		6
+
+#define TILE_TYPE_EMPTY				0x00
+
+
+//tile types, indexed by the level data
+typedef struct
+{
+	uint8_t hits;				//hits to clear
+	uint16_t points;			//for clearing it
+	uint16_t color;				//drawn as a box if no image
+	const ImageData* image;		//cell sized, or NULL
+}TileType;
+
+
+typedef struct
+{
+	uint16_t x;					//cell 0, 0
+	uint16_t y;
+	uint8_t sizeX;				//cell size
+	uint8_t sizeY;
+	uint8_t numRows;
+	uint8_t numCols;
+	uint16_t numAlive;
+	const TileType* types;
+	uint8_t numTypes;
+	uint16_t alive[TILE_GRID_MAX_ROWS];
+	uint8_t type[TILE_GRID_MAX_ROWS][TILE_GRID_MAX_COLS];
+	uint8_t hits[TILE_GRID_MAX_ROWS][TILE_GRID_MAX_COLS];
+}TileGrid;
+
+
+//cells under a box, inclusive
+typedef struct
+{
+	uint8_t row0;
+	uint8_t row1;
+	uint16_t colMask;			//columns col0 - col1
+}TileRange;
+
+
+int TileGrid_Load(TileGrid* grid, const uint8_t* level, const TileType* types, uint8_t numTypes);
+uint16_t TileGrid_GetNumAlive(const TileGrid* grid);
+uint8_t TileGrid_GetRange(const TileGrid* grid, int32_t left, int32_t top, int32_t right, int32_t bottom, TileRange* range);
+uint16_t TileGrid_Hit(TileGrid* grid, uint8_t row, uint8_t col);
+void TileGrid_Draw(const TileGrid* grid, uint32_t layer);
+
+
+#endif
@@ -0,0 +1,75 @@
+/*
+Breakout levels and tile types.
+
+Cell types are one hex digit each, so the level
+data reads like the layout on the screen.
+*/
+
+#include "levels.h"
+#include "Graphics.h"
+
+
+//type 0 is an empty cell
+const TileType tileTypes[NUM_TILE_TYPES] =
+{
+	{0, 0, BLACK, NULL},
+	{1, 30, WHITE, &imgTile},		//30x30 only
+	{1, 10, CYAN, NULL},
+	{2, 20, ORANGE, NULL},
+};
+
+
+//original layout - 8 x 5 tiles, 30 x 30
+static const uint8_t level0[] =
+{
+	5, 8, 30, 30, 0, 30,
+	0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11,
+};
+
+//16 x 12, 15 x 10 - two hit band in the middle
+static const uint8_t level1[] =
+{
+	12, 16, 15, 10, 0, 30,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+};
+
+//16 x 12, 15 x 10 - checkerboard with gaps
+static const uint8_t level2[] =
+{
+	12, 16, 15, 10, 0, 30,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+};
+
+
+const uint8_t* const levelList[NUM_LEVELS] =
+{
+	level0,
+	level1,
+	level2,
+};
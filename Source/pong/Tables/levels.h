@@ -0,0 +1,21 @@
+/*
+Breakout levels and tile types.  See TileGrid.h
+for the level format.
+*/
+
+#ifndef		__LEVELS_H
+#define		__LEVELS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "TileGrid.h"
+
+#define NUM_TILE_TYPES		4
+#define NUM_LEVELS			3
+
+extern const TileType tileTypes[];
+extern const uint8_t* const levelList[];
+
+
+#endif
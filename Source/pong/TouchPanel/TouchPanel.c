@@ -34,10 +34,38 @@ default y is increasing down (ok)
 
 normalize x and y read values to LCD_WIDTH and LCD_HEIGHT
 
+FIFO Pipeline:
+Nothing blocks in the EXTI interrupt anymore.  The EXTI
+callback starts a state machine on I2C3 that runs from
+the I2C / DMA complete callbacks:
+
+READ_SIZE - 1 byte DMA read of TSC_FIFO_SIZE
+READ_FIFO - DMA burst read of size * 3 bytes from
+            TSC_DATA_NAI, decoded into the sample queue,
+            then back to READ_SIZE until the fifo is empty
+CLEAR_INT - write INT_STA, then IDLE
+
+An EXTI edge while the machine is busy sets a pending flag
+and the machine restarts when it gets back to IDLE.  The
+sample queue is single producer (I2C callbacks) / single
+consumer (TouchPanel_Process in the main loop).
+
+Calibration:
+Samples are mapped to the screen with an affine
+transform solved from 3 touched targets, so it
+handles offset, scale, rotation and skew of the
+panel.  Coefficients are Q16, so the per sample
+cost is 4 multiplies and no divides.  The record
+is stored in flash sector 23 with a checksum.
+
 */
 //////////////////////////////////////////////////////////
 
+#include <stddef.h>
+#include <string.h>
+
 #include "TouchPanel.h"
+#include "TouchTrack.h"
 #include "i2c.h"
 #include "gpio.h"
 
@@ -46,6 +74,47 @@ normalize x and y read values to LCD_WIDTH and LCD_HEIGHT
 ///////////////////////////////////////////////
 //variables
 static TouchPanelData m_touchPanelData;
+static TouchPanelCalib m_calib;
+static uint32_t m_sampleCount = 0x00;
+
+//flash record for the calibration
+typedef struct
+{
+	uint32_t magic;
+	TouchPanelCalib calib;
+	uint32_t checksum;
+}TouchPanelCalibRecord;
+
+static uint32_t TouchPanel_CalibChecksum(const TouchPanelCalibRecord* record);
+
+
+///////////////////////////////////////////////
+//fifo pipeline
+typedef enum
+{
+	TP_STATE_IDLE,
+	TP_STATE_READ_SIZE,
+	TP_STATE_READ_FIFO,
+	TP_STATE_CLEAR_INT,
+}TouchPanelState_t;
+
+static volatile TouchPanelState_t m_state = TP_STATE_IDLE;
+static volatile uint8_t m_pending = 0x00;
+static uint8_t m_fifoSize = 0x00;
+static uint8_t m_burstCount = 0x00;
+static uint32_t m_burstTick = 0x00;
+static uint8_t m_intClear = 0x00;
+static uint8_t m_rxBuffer[TOUCH_PANEL_BURST_MAX * TOUCH_PANEL_SAMPLE_BYTES];
+
+static TouchPanelSample m_queue[TOUCH_PANEL_QUEUE_SIZE];
+static volatile uint32_t m_queueHead = 0x00;		//written by the i2c callbacks
+static volatile uint32_t m_queueTail = 0x00;		//written by the main loop
+static volatile uint32_t m_queueDropped = 0x00;
+
+static void TouchPanel_StartPipeline(void);
+static void TouchPanel_PipelineError(void);
+static void TouchPanel_PushSamples(const uint8_t* buffer, uint8_t count);
+static void TouchPanel_Normalize(TouchPanelData* data);
 
 ////////////////////////////////////////
 //reads the chip id and id version.
@@ -58,6 +127,9 @@ void TouchPanel_init(void)
 	m_touchPanelData.xRawPos = 0x00;
 	m_touchPanelData.yRawPos = 0x00;
 
+	TouchPanel_DefaultCalibration(&m_calib);
+	TouchTrack_Init();
+
 	//uint16_t chipID = TouchPanel_readChipID();
 	//uint8_t IDVersion = TouchPanel_readIDVersion();
 
@@ -93,8 +165,9 @@ void TouchPanel_init(void)
 	//int control - falling edge, edge interrupt, global 0x03
 	TouchPanel_writeReg1Byte(TP_REG_INT_CTRL, 0x03);
 
-	//enable touch detect interrupt
-	TouchPanel_writeReg1Byte(TP_REG_INT_EN, 0x01);
+	//enable touch detect and fifo threshold interrupts
+	//so samples keep streaming while the panel is held
+	TouchPanel_writeReg1Byte(TP_REG_INT_EN, TP_INT_TOUCH_DET | TP_INT_FIFO_TH);
 
 	//reset the fifo
 	TouchPanel_writeReg1Byte(TP_REG_TSC_FIFO_STA, 0x21);
@@ -260,33 +333,173 @@ TouchPanelData TouchPanel_readRawData(void)
 		data.xRawPos = tempX;
 		data.yRawPos = tempY;
 
-		//normalize to the width/heigth, accounting for the min and max
-		if (tempX < TOUCH_PANEL_CALIB_X_MIN)
-			tempX = 0;
-		else if (tempX > TOUCH_PANEL_CALIB_X_MAX)
-			tempX = TOUCH_PANEL_WIDTH;
-		else
-			tempX = (tempX - TOUCH_PANEL_CALIB_X_MIN) * TOUCH_PANEL_WIDTH / (TOUCH_PANEL_CALIB_X_MAX - TOUCH_PANEL_CALIB_X_MIN);
+		TouchPanel_Normalize(&data);
+	}
 
-		if (tempY < TOUCH_PANEL_CALIB_Y_MIN)
-			tempY = 0;
-		else if (tempY > TOUCH_PANEL_CALIB_Y_MAX)
-			tempY = TOUCH_PANEL_HEIGHT;
-		else
-			tempY = (tempY - TOUCH_PANEL_CALIB_Y_MIN) * TOUCH_PANEL_HEIGHT / (TOUCH_PANEL_CALIB_Y_MAX - TOUCH_PANEL_CALIB_Y_MIN);
+	return data;
+}
+
+
+////////////////////////////////////////
+//map the raw position to the screen with the
+//affine calibration, clipped to the panel size
+static void TouchPanel_Normalize(TouchPanelData* data)
+{
+	int32_t xRaw = data->xRawPos;
+	int32_t yRaw = data->yRawPos;
+
+	int32_t x = (m_calib.a * xRaw + m_calib.b * yRaw + m_calib.c) >> 16;
+	int32_t y = (m_calib.d * xRaw + m_calib.e * yRaw + m_calib.f) >> 16;
+
+	if (x < 0)
+		x = 0;
+	else if (x > TOUCH_PANEL_WIDTH)
+		x = TOUCH_PANEL_WIDTH;
+
+	if (y < 0)
+		y = 0;
+	else if (y > TOUCH_PANEL_HEIGHT)
+		y = TOUCH_PANEL_HEIGHT;
+
+	data->xPos = (uint16_t)x;
+	data->yPos = (uint16_t)y;
+}
+
+
+////////////////////////////////////////
+//Default calibration from the min / max
+//constants - same mapping as the original
+//normalize to width and height
+void TouchPanel_DefaultCalibration(TouchPanelCalib* calib)
+{
+	calib->a = (int32_t)((TOUCH_PANEL_WIDTH << 16) / (TOUCH_PANEL_CALIB_X_MAX - TOUCH_PANEL_CALIB_X_MIN));
+	calib->b = 0;
+	calib->c = -calib->a * (int32_t)TOUCH_PANEL_CALIB_X_MIN;
+
+	calib->d = 0;
+	calib->e = (int32_t)((TOUCH_PANEL_HEIGHT << 16) / (TOUCH_PANEL_CALIB_Y_MAX - TOUCH_PANEL_CALIB_Y_MIN));
+	calib->f = -calib->e * (int32_t)TOUCH_PANEL_CALIB_Y_MIN;
+}
 
-		data.xPos = (uint16_t)tempX;
-		data.yPos = (uint16_t)tempY;
+////////////////////////////////////////
+//Solve the affine calibration from 3 raw /
+//screen point pairs (Cramer's rule).
+//Returns 0 if ok, -1 if the points are in
+//a line (or too close together to use).
+int TouchPanel_SolveCalibration(const TouchPanelCalibPoint points[3], TouchPanelCalib* calib)
+{
+	int64_t x0 = (int64_t)points[0].xRaw - points[2].xRaw;
+	int64_t x1 = (int64_t)points[1].xRaw - points[2].xRaw;
+	int64_t y0 = (int64_t)points[0].yRaw - points[2].yRaw;
+	int64_t y1 = (int64_t)points[1].yRaw - points[2].yRaw;
+
+	int64_t det = x0 * y1 - x1 * y0;
+
+	//need a reasonable triangle of raw points
+	if ((det > -10000) && (det < 10000))
+		return -1;
+
+	int64_t sx0 = (int64_t)points[0].xScreen - points[2].xScreen;
+	int64_t sx1 = (int64_t)points[1].xScreen - points[2].xScreen;
+	int64_t sy0 = (int64_t)points[0].yScreen - points[2].yScreen;
+	int64_t sy1 = (int64_t)points[1].yScreen - points[2].yScreen;
+
+	int64_t a = ((sx0 * y1 - sx1 * y0) * 65536) / det;
+	int64_t b = ((x0 * sx1 - x1 * sx0) * 65536) / det;
+	int64_t d = ((sy0 * y1 - sy1 * y0) * 65536) / det;
+	int64_t e = ((x0 * sy1 - x1 * sy0) * 65536) / det;
+
+	calib->a = (int32_t)a;
+	calib->b = (int32_t)b;
+	calib->c = (int32_t)(((int64_t)points[2].xScreen * 65536) - a * points[2].xRaw - b * points[2].yRaw);
+	calib->d = (int32_t)d;
+	calib->e = (int32_t)e;
+	calib->f = (int32_t)(((int64_t)points[2].yScreen * 65536) - d * points[2].xRaw - e * points[2].yRaw);
+
+	return 0;
+}
+
+void TouchPanel_SetCalibration(const TouchPanelCalib* calib)
+{
+	m_calib = *calib;
+}
+
+void TouchPanel_GetCalibration(TouchPanelCalib* calib)
+{
+	*calib = m_calib;
+}
+
+static uint32_t TouchPanel_CalibChecksum(const TouchPanelCalibRecord* record)
+{
+	const uint32_t* ptr = (const uint32_t*)record;
+	uint32_t sum = 0x00;
+
+	for (uint32_t i = 0 ; i < (offsetof(TouchPanelCalibRecord, checksum) / 4) ; i++)
+		sum += ptr[i];
+
+	return ~sum;
+}
+
+////////////////////////////////////////
+//Load the calibration from flash.
+//Returns 0 if a valid record was loaded, -1 if
+//not (the default calibration stays in use).
+int TouchPanel_LoadCalibration(void)
+{
+	const TouchPanelCalibRecord* record = (const TouchPanelCalibRecord*)TOUCH_PANEL_CALIB_ADDRESS;
+
+	if ((record->magic != TOUCH_PANEL_CALIB_MAGIC) ||
+		(record->checksum != TouchPanel_CalibChecksum(record)))
+		return -1;
+
+	m_calib = record->calib;
+	return 0;
+}
+
+////////////////////////////////////////
+//Erase the calibration sector and write the
+//current calibration.  Blocks for the sector
+//erase, only call from the calibration screen.
+//Returns 0 if ok, -1 on a flash error.
+int TouchPanel_SaveCalibration(void)
+{
+	TouchPanelCalibRecord record;
+	FLASH_EraseInitTypeDef erase;
+	uint32_t sectorError = 0x00;
+	int result = 0;
+
+	record.magic = TOUCH_PANEL_CALIB_MAGIC;
+	record.calib = m_calib;
+	record.checksum = TouchPanel_CalibChecksum(&record);
+
+	erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+	erase.Sector = TOUCH_PANEL_CALIB_SECTOR;
+	erase.NbSectors = 1;
+	erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+	HAL_FLASH_Unlock();
+
+	if (HAL_FLASHEx_Erase(&erase, &sectorError) != HAL_OK)
+		result = -1;
+
+	const uint32_t* ptr = (const uint32_t*)&record;
+
+	for (uint32_t i = 0 ; (!result) && (i < (sizeof(record) / 4)) ; i++)
+	{
+		if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, TOUCH_PANEL_CALIB_ADDRESS + (i * 4), ptr[i]) != HAL_OK)
+			result = -1;
 	}
 
-	return data;
+	HAL_FLASH_Lock();
+
+	return result;
 }
 
 
 ////////////////////////////////////////
 //return the current touch location on the panel.
-//m_touchPanelData is updated in the isr, gpio exti
-//line interrupt.
+//m_touchPanelData is updated from the sample
+//queue in TouchPanel_Process().
 //
 TouchPanelData TouchPanel_getPosition(void)
 {
@@ -330,32 +543,217 @@ void TouchPanel_interruptClear(void)
 }
 
 
-///////////////////////////////////////////////////
-//Interrupt Callback from the TouchPanel
-//Triggers when the panel is touched.
-//There must be a flag you have to clear
-//in the panel registers because it only triggers
-//first time then no further detection
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+/////////////////////////////////////////////////
+//Get the oldest sample from the queue.
+//Returns 1 if a sample was read, 0 if empty.
+//Main loop only.
+uint8_t TouchPanel_GetSample(TouchPanelSample* sample)
 {
+	uint32_t tail = m_queueTail;
 
-	volatile TouchPanelData data;
-	volatile uint8_t size;
+	if (tail == m_queueHead)
+		return 0;
 
-	if (GPIO_Pin == Touch_Panel_EXTI15_Pin)
+	*sample = m_queue[tail & (TOUCH_PANEL_QUEUE_SIZE - 1)];
+	m_queueTail = tail + 1;
+
+	return 1;
+}
+
+/////////////////////////////////////////////////
+//Drain the sample queue, calibrate each sample,
+//run it through the tracking filter and update
+//the touch position with the newest sample.  Call from the
+//main loop once per frame.  Also restarts the
+//pipeline if an EXTI edge arrived while the bus
+//was busy or after an I2C error.
+void TouchPanel_Process(void)
+{
+	TouchPanelSample sample;
+	TouchPanelData data;
+
+	while (TouchPanel_GetSample(&sample))
+	{
+		data.xRawPos = sample.xRawPos;
+		data.yRawPos = sample.yRawPos;
+
+		TouchPanel_Normalize(&data);
+		TouchPanel_setPosition(data);
+		TouchTrack_AddSample(data.xPos, data.yPos, sample.tick);
+
+		m_sampleCount++;
+	}
+
+	if ((m_pending) && (m_state == TP_STATE_IDLE))
+		TouchPanel_StartPipeline();
+}
+
+/////////////////////////////////////////////////
+//Samples processed since power up - changes
+//whenever the panel is being touched
+uint32_t TouchPanel_GetSampleCount(void)
+{
+	return m_sampleCount;
+}
+
+/////////////////////////////////////////////////
+//Samples lost because the queue was full
+uint32_t TouchPanel_GetDroppedSamples(void)
+{
+	return m_queueDropped;
+}
+
+
+/////////////////////////////////////////////////
+//Start the fifo pipeline if idle, otherwise
+//flag it to run again when the current pass
+//completes.  Safe from the EXTI, I2C callbacks
+//and the main loop.
+static void TouchPanel_StartPipeline(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (m_state != TP_STATE_IDLE)
 	{
-		size = TouchPanel_GetFIFOSize();
+		m_pending = 1;
+		__set_PRIMASK(primask);
+		return;
+	}
+
+	m_state = TP_STATE_READ_SIZE;
+	m_pending = 0;
+	__set_PRIMASK(primask);
+
+	m_burstTick = HAL_GetTick();
+
+	if (HAL_I2C_Mem_Read_DMA(&hi2c3, TOUCH_PANEL_ADDRESS, TP_REG_TSC_FIFO_SIZE, 1, &m_fifoSize, 1) != HAL_OK)
+		TouchPanel_PipelineError();
+}
+
+/////////////////////////////////////////////////
+//Bus busy or error - drop back to idle and retry
+//from TouchPanel_Process()
+static void TouchPanel_PipelineError(void)
+{
+	m_state = TP_STATE_IDLE;
+	m_pending = 1;
+}
+
+/////////////////////////////////////////////////
+//Decode count 3 byte xy samples into the queue.
+//12 bit x and y packed x[11:4], x[3:0]y[11:8], y[7:0].
+//x is inverted to make increasing to the right.
+static void TouchPanel_PushSamples(const uint8_t* buffer, uint8_t count)
+{
+	uint32_t head = m_queueHead;
+
+	for (int i = 0 ; i < count ; i++)
+	{
+		const uint8_t* ptr = &buffer[i * TOUCH_PANEL_SAMPLE_BYTES];
 
-		//read data size times
-		for (int i = 0 ; i < size ; i++)
+		if ((head - m_queueTail) >= TOUCH_PANEL_QUEUE_SIZE)
 		{
-			data = TouchPanel_readRawData();
-			TouchPanel_setPosition(data);		//update position
+			m_queueDropped++;
+			continue;
 		}
 
+		TouchPanelSample* sample = &m_queue[head & (TOUCH_PANEL_QUEUE_SIZE - 1)];
+
+		uint16_t tempX = (((uint16_t)ptr[0]) << 4) | (ptr[1] >> 4);
+		uint16_t tempY = (((uint16_t)(ptr[1] & 0x0F)) << 8) | ptr[2];
+
+		sample->xRawPos = 4095 - tempX;
+		sample->yRawPos = tempY;
+		sample->tick = m_burstTick;
+
+		head++;
 	}
 
-	TouchPanel_interruptClear();		//clear the interrupt
+	m_queueHead = head;
 }
 
 
+/////////////////////////////////////////////////
+//I2C3 memory read complete - DMA transfer done.
+//Steps the fifo pipeline.
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance != I2C3)
+		return;
+
+	if (m_state == TP_STATE_READ_FIFO)
+	{
+		TouchPanel_PushSamples(m_rxBuffer, m_burstCount);
+		m_state = TP_STATE_READ_SIZE;
+
+		//fifo may have refilled while reading
+		if (HAL_I2C_Mem_Read_DMA(hi2c, TOUCH_PANEL_ADDRESS, TP_REG_TSC_FIFO_SIZE, 1, &m_fifoSize, 1) != HAL_OK)
+			TouchPanel_PipelineError();
+	}
+
+	else if (m_state == TP_STATE_READ_SIZE)
+	{
+		if (m_fifoSize > 0)
+		{
+			m_burstCount = m_fifoSize;
+			if (m_burstCount > TOUCH_PANEL_BURST_MAX)
+				m_burstCount = TOUCH_PANEL_BURST_MAX;
+
+			m_state = TP_STATE_READ_FIFO;
+
+			if (HAL_I2C_Mem_Read_DMA(hi2c, TOUCH_PANEL_ADDRESS, TP_REG_TSC_DATA_NAI, 1,
+					m_rxBuffer, m_burstCount * TOUCH_PANEL_SAMPLE_BYTES) != HAL_OK)
+				TouchPanel_PipelineError();
+		}
+		else
+		{
+			//fifo empty - clear the interrupts
+			m_state = TP_STATE_CLEAR_INT;
+			m_intClear = TP_INT_TOUCH_DET | TP_INT_FIFO_TH;
+
+			if (HAL_I2C_Mem_Write_IT(hi2c, TOUCH_PANEL_ADDRESS, TP_REG_INT_STA, 1, &m_intClear, 1) != HAL_OK)
+				TouchPanel_PipelineError();
+		}
+	}
+}
+
+/////////////////////////////////////////////////
+//I2C3 memory write complete - interrupt status
+//cleared, pipeline done.
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance != I2C3)
+		return;
+
+	if (m_state == TP_STATE_CLEAR_INT)
+	{
+		m_state = TP_STATE_IDLE;
+
+		if (m_pending)
+			TouchPanel_StartPipeline();
+	}
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance != I2C3)
+		return;
+
+	TouchPanel_PipelineError();
+}
+
+
+///////////////////////////////////////////////////
+//Interrupt Callback from the TouchPanel
+//Triggers when the panel is touched or the fifo
+//reaches the threshold.  Only starts the fifo
+//pipeline, the interrupt status is cleared by the
+//pipeline once the fifo is empty.
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+	if (GPIO_Pin == Touch_Panel_EXTI15_Pin)
+	{
+		TouchPanel_StartPipeline();
+	}
+}
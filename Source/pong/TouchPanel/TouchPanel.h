@@ -16,6 +16,14 @@ Next,
 enable the interrupt pin (EXTI line 15)
 read the x and y position from the touch panel
 
+FIFO Pipeline:
+The EXTI line only starts a non-blocking I2C3 DMA
+state machine.  It reads TSC_FIFO_SIZE, burst reads
+that many samples from the non auto increment data
+register, pushes them into a lock free queue and
+clears the interrupt status.  TouchPanel_Process()
+drains the queue from the main loop.
+
 
 */
 //////////////////////////////////////////////////////////
@@ -29,12 +37,19 @@ read the x and y position from the touch panel
 #define TOUCH_PANEL_WIDTH		240
 #define TOUCH_PANEL_HEIGHT		320
 
-//normalize to a range
+//default calibration - normalize to a range.
+//used until a 3 point calibration is stored
 #define TOUCH_PANEL_CALIB_X_MIN		((uint32_t)500)
 #define TOUCH_PANEL_CALIB_X_MAX		((uint32_t)3600)
 #define TOUCH_PANEL_CALIB_Y_MIN		((uint32_t)500)
 #define TOUCH_PANEL_CALIB_Y_MAX		((uint32_t)3600)
 
+//3 point calibration stored in the last flash
+//sector, see the linker script
+#define TOUCH_PANEL_CALIB_SECTOR	FLASH_SECTOR_23
+#define TOUCH_PANEL_CALIB_ADDRESS	((uint32_t)0x081E0000)
+#define TOUCH_PANEL_CALIB_MAGIC		((uint32_t)0x54434C42)		//"TCLB"
+
 //address
 #define TOUCH_PANEL_ADDRESS		0x82
 
@@ -65,6 +80,16 @@ read the x and y position from the touch panel
 #define TP_REG_TSC_DATA_Y			0x4F		//y data - 2 bytes
 #define TP_REG_TSC_DATA_Z			0x51		//z data - 1 byte
 #define TP_REG_TSC_DATA_XYZ			0x52		//xyz data - 4 bytes
+#define TP_REG_TSC_DATA_NAI			0xD7		//xyz data, no auto increment - each read pops the fifo
+
+//interrupt enable / status bits
+#define TP_INT_TOUCH_DET			0x01
+#define TP_INT_FIFO_TH				0x02
+
+//fifo pipeline
+#define TOUCH_PANEL_SAMPLE_BYTES	3			//x and y only - 12 bits each
+#define TOUCH_PANEL_BURST_MAX		32			//max samples per i2c burst
+#define TOUCH_PANEL_QUEUE_SIZE		32			//power of 2
 
 typedef struct
 {
@@ -76,6 +101,40 @@ typedef struct
 }TouchPanelData;
 
 
+////////////////////////////////////////
+//Affine calibration, Q16 coefficients
+//x = (a * xRaw + b * yRaw + c) >> 16
+//y = (d * xRaw + e * yRaw + f) >> 16
+typedef struct
+{
+	int32_t a;
+	int32_t b;
+	int32_t c;
+	int32_t d;
+	int32_t e;
+	int32_t f;
+}TouchPanelCalib;
+
+typedef struct
+{
+	uint16_t xRaw;
+	uint16_t yRaw;
+	uint16_t xScreen;
+	uint16_t yScreen;
+}TouchPanelCalibPoint;
+
+
+////////////////////////////////////////
+//Raw sample from the fifo pipeline with the
+//tick the burst was started (ms)
+typedef struct
+{
+	uint16_t xRawPos;
+	uint16_t yRawPos;
+	uint32_t tick;
+}TouchPanelSample;
+
+
 
 void TouchPanel_init(void);
 uint8_t TouchPanel_readReg1Byte(uint16_t reg);
@@ -98,6 +157,18 @@ TouchPanelData  TouchPanel_readRawData(void);
 TouchPanelData TouchPanel_getPosition(void);
 void TouchPanel_setPosition(TouchPanelData data);
 
+uint8_t TouchPanel_GetSample(TouchPanelSample* sample);
+void TouchPanel_Process(void);
+uint32_t TouchPanel_GetDroppedSamples(void);
+uint32_t TouchPanel_GetSampleCount(void);
+
+void TouchPanel_DefaultCalibration(TouchPanelCalib* calib);
+int TouchPanel_SolveCalibration(const TouchPanelCalibPoint points[3], TouchPanelCalib* calib);
+void TouchPanel_SetCalibration(const TouchPanelCalib* calib);
+void TouchPanel_GetCalibration(TouchPanelCalib* calib);
+int TouchPanel_LoadCalibration(void);
+int TouchPanel_SaveCalibration(void);
+
 uint8_t TouchPanel_touchDetected(void);
 uint8_t TouchPanel_interruptStatus(void);
 void TouchPanel_interruptClear(void);
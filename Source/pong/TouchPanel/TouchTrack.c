@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////
+/*
+Touch Tracking - filtering and prediction for the
+touch panel position.
+
+Alpha-beta filter, per axis:
+predict     xp = x + v * dt
+residual    r = z - xp
+update      x = xp + alpha * r
+            v = v + beta * r / dt
+
+Samples from the same fifo burst share a tick (dt = 0),
+those only pull the position toward the measurement.
+A gap longer than TOUCH_TRACK_TIMEOUT_MS is a new touch,
+the filter restarts at the sample with zero velocity.
+
+*/
+//////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <string.h>
+
+#include "TouchTrack.h"
+#include "TouchPanel.h"
+
+
+typedef struct
+{
+	int32_t pos;			//Q8 pixels
+	int32_t vel;			//Q8 pixels per ms
+}TouchTrackAxis;
+
+
+static TouchTrackAxis m_axisX;
+static TouchTrackAxis m_axisY;
+static uint32_t m_lastTick = 0x00;
+static uint8_t m_tracking = 0x00;
+static TouchTrackLatency m_latency;
+static uint32_t m_frameTick = 0x00;		//fifo read tick of the sample in the frame
+static uint8_t m_frameHasSample = 0x00;
+
+static void TouchTrack_UpdateAxis(TouchTrackAxis* axis, int32_t z, uint32_t dt);
+static uint16_t TouchTrack_Clamp(int32_t value, uint16_t max);
+
+
+void TouchTrack_Init(void)
+{
+	memset(&m_axisX, 0x00, sizeof(m_axisX));
+	memset(&m_axisY, 0x00, sizeof(m_axisY));
+	memset(&m_latency, 0x00, sizeof(m_latency));
+	m_lastTick = 0x00;
+	m_tracking = 0x00;
+	m_frameTick = 0x00;
+	m_frameHasSample = 0x00;
+}
+
+
+///////////////////////////////////////////
+//Add a calibrated sample (pixels) taken at tick
+void TouchTrack_AddSample(uint16_t x, uint16_t y, uint32_t tick)
+{
+	int32_t zx = ((int32_t)x) << 8;
+	int32_t zy = ((int32_t)y) << 8;
+
+	if ((!m_tracking) || ((tick - m_lastTick) > TOUCH_TRACK_TIMEOUT_MS))
+	{
+		m_axisX.pos = zx;
+		m_axisX.vel = 0;
+		m_axisY.pos = zy;
+		m_axisY.vel = 0;
+		m_lastTick = tick;
+		m_tracking = 1;
+		return;
+	}
+
+	uint32_t dt = tick - m_lastTick;
+
+	TouchTrack_UpdateAxis(&m_axisX, zx, dt);
+	TouchTrack_UpdateAxis(&m_axisY, zy, dt);
+
+	m_lastTick = tick;
+}
+
+static void TouchTrack_UpdateAxis(TouchTrackAxis* axis, int32_t z, uint32_t dt)
+{
+	int32_t predicted = axis->pos + axis->vel * (int32_t)dt;
+	int32_t residual = z - predicted;
+
+	axis->pos = predicted + ((TOUCH_TRACK_ALPHA * residual) >> 8);
+
+	if (dt > 0)
+		axis->vel += ((TOUCH_TRACK_BETA * residual) >> 8) / (int32_t)dt;
+}
+
+
+///////////////////////////////////////////
+//Position predicted to tick + the render lead.
+//Returns 1 and the position in x, y if the panel
+//is being touched, 0 if not (x, y hold the last
+//filtered position).  Notes the sample tick for
+//the latency measured at TouchTrack_FramePresented.
+uint8_t TouchTrack_GetPosition(uint32_t tick, uint16_t* x, uint16_t* y)
+{
+	if (!m_tracking)
+		return 0;
+
+	uint32_t age = tick - m_lastTick;
+
+	if (age > TOUCH_TRACK_TIMEOUT_MS)
+	{
+		//released - hold the last position
+		*x = TouchTrack_Clamp(m_axisX.pos >> 8, TOUCH_PANEL_WIDTH);
+		*y = TouchTrack_Clamp(m_axisY.pos >> 8, TOUCH_PANEL_HEIGHT);
+		return 0;
+	}
+
+	uint32_t horizon = age + TOUCH_TRACK_LEAD_MS;
+
+	if (horizon > TOUCH_TRACK_MAX_PREDICT_MS)
+		horizon = TOUCH_TRACK_MAX_PREDICT_MS;
+
+	*x = TouchTrack_Clamp((m_axisX.pos + m_axisX.vel * (int32_t)horizon) >> 8, TOUCH_PANEL_WIDTH);
+	*y = TouchTrack_Clamp((m_axisY.pos + m_axisY.vel * (int32_t)horizon) >> 8, TOUCH_PANEL_HEIGHT);
+
+	//this frame shows the newest sample
+	m_frameTick = m_lastTick;
+	m_frameHasSample = 1;
+
+	return 1;
+}
+
+
+///////////////////////////////////////////
+//Call once the frame is on the display, after
+//the ltdc address switch, with the current tick.
+//Measures the fifo read to present latency of the
+//sample the frame used, if it used one.
+void TouchTrack_FramePresented(uint32_t tick)
+{
+	if (!m_frameHasSample)
+		return;
+
+	m_frameHasSample = 0x00;
+
+	uint32_t latency = tick - m_frameTick;
+
+	m_latency.last = latency;
+	if (latency > m_latency.max)
+		m_latency.max = latency;
+
+	if (!m_latency.count)
+		m_latency.average = latency << 4;
+	else
+		m_latency.average += latency - (m_latency.average >> 4);
+
+	m_latency.count++;
+}
+
+static uint16_t TouchTrack_Clamp(int32_t value, uint16_t max)
+{
+	if (value < 0)
+		return 0;
+	if (value > max)
+		return max;
+	return (uint16_t)value;
+}
+
+
+///////////////////////////////////////////
+//Latency stats - average is returned in ms
+void TouchTrack_GetLatency(TouchTrackLatency* latency)
+{
+	*latency = m_latency;
+	latency->average = m_latency.average >> 4;
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////
+/*
+Touch Tracking - filtering and prediction for the
+touch panel position.
+
+Calibrated samples from the touch panel fifo pipeline
+run through a fixed point alpha-beta filter (position
+and velocity).  The position used for the paddle is
+predicted forward from the last sample to the time it
+is used plus the render lead, so it makes up for the
+sample to frame latency.
+
+Positions are Q8 pixels, velocity is Q8 pixels per ms.
+Ticks are HAL ticks (ms).
+
+Latency - measured end to end, from the start of the
+fifo read that produced the newest sample to the frame
+that used it being presented (the ltdc address switch,
+TouchTrack_FramePresented).  Available from
+TouchTrack_GetLatency.
+
+*/
+//////////////////////////////////////////////////////////
+
+#ifndef __TOUCH_TRACK_H
+#define __TOUCH_TRACK_H
+
+#include <stdint.h>
+
+
+#define TOUCH_TRACK_ALPHA				((int32_t)128)		//Q8 - 0.5
+#define TOUCH_TRACK_BETA				((int32_t)32)		//Q8 - 0.125
+#define TOUCH_TRACK_TIMEOUT_MS			((uint32_t)100)		//no samples - touch released
+#define TOUCH_TRACK_LEAD_MS				((uint32_t)16)		//prediction lead, position read to visible on the lcd
+#define TOUCH_TRACK_MAX_PREDICT_MS		((uint32_t)40)		//limit on prediction horizon
+
+
+typedef struct
+{
+	uint32_t last;			//ms
+	uint32_t average;		//ms, Q4 running average
+	uint32_t max;			//ms
+	uint32_t count;			//frames presented with touch data
+}TouchTrackLatency;
+
+
+void TouchTrack_Init(void);
+void TouchTrack_AddSample(uint16_t x, uint16_t y, uint32_t tick);
+uint8_t TouchTrack_GetPosition(uint32_t tick, uint16_t* x, uint16_t* y);
+void TouchTrack_FramePresented(uint32_t tick);
+void TouchTrack_GetLatency(TouchTrackLatency* latency);
+
+
+#endif
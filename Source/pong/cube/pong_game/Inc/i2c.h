@@ -55,6 +55,8 @@ extern I2C_HandleTypeDef hi2c3;
 
 /* USER CODE BEGIN Private defines */
 
+extern DMA_HandleTypeDef hdma_i2c3_rx;
+
 /* USER CODE END Private defines */
 
 extern void _Error_Handler(char *, int);
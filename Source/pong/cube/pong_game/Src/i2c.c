@@ -44,6 +44,9 @@
 
 /* USER CODE BEGIN 0 */
 
+//I2C3 RX on DMA1 Stream2 Channel 3 - touch panel fifo reads
+DMA_HandleTypeDef hdma_i2c3_rx;
+
 /* USER CODE END 0 */
 
 I2C_HandleTypeDef hi2c3;
@@ -100,6 +103,35 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef* i2cHandle)
     __HAL_RCC_I2C3_CLK_ENABLE();
   /* USER CODE BEGIN I2C3_MspInit 1 */
 
+    //I2C3 DMA Init - I2C3_RX
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    hdma_i2c3_rx.Instance = DMA1_Stream2;
+    hdma_i2c3_rx.Init.Channel = DMA_CHANNEL_3;
+    hdma_i2c3_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_i2c3_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_i2c3_rx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_i2c3_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_i2c3_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_i2c3_rx.Init.Mode = DMA_NORMAL;
+    hdma_i2c3_rx.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_i2c3_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_i2c3_rx) != HAL_OK)
+    {
+      _Error_Handler(__FILE__, __LINE__);
+    }
+
+    __HAL_LINKDMA(i2cHandle,hdmarx,hdma_i2c3_rx);
+
+    //DMA and I2C event / error interrupts - below the
+    //touch panel EXTI line so a burst can be started from it
+    HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
+    HAL_NVIC_SetPriority(I2C3_EV_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(I2C3_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C3_ER_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(I2C3_ER_IRQn);
+
   /* USER CODE END I2C3_MspInit 1 */
   }
 }
@@ -125,6 +157,11 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* i2cHandle)
 
   /* USER CODE BEGIN I2C3_MspDeInit 1 */
 
+    HAL_DMA_DeInit(i2cHandle->hdmarx);
+    HAL_NVIC_DisableIRQ(DMA1_Stream2_IRQn);
+    HAL_NVIC_DisableIRQ(I2C3_EV_IRQn);
+    HAL_NVIC_DisableIRQ(I2C3_ER_IRQn);
+
   /* USER CODE END I2C3_MspDeInit 1 */
   }
 } 
@@ -150,6 +150,14 @@ int main(void)
 	Sprite_Init();
 	Sound_Init();
 
+	//touch calibration - run the calibration screen if
+	//nothing is stored or the user button is held at boot
+	if ((TouchPanel_LoadCalibration() < 0) ||
+		(HAL_GPIO_ReadPin(UserButtonBlue_GPIO_Port, UserButtonBlue_Pin)))
+	{
+		Sprite_DisplayTouchCalibration();
+	}
+
 
   /* USER CODE END 2 */
 
@@ -157,6 +165,7 @@ int main(void)
   /* USER CODE BEGIN WHILE */
 	while (1)
 	{
+		TouchPanel_Process();		//drain touch samples
 		Sprite_Ball_Move();
 		Sprite_Player_Move();
 		Sprite_Draw();
@@ -199,9 +208,9 @@ int main(void)
 
 			HAL_Delay(1000);
 
+			Sprite_IncreaseGameLevel();		//before the tiles, picks the level
 			Tile_Init();
 			Ball_Init();
-			Sprite_IncreaseGameLevel();
 
 			HAL_Delay(1000);
 
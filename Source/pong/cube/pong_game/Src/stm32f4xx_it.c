@@ -37,6 +37,9 @@
 
 /* USER CODE BEGIN 0 */
 
+extern I2C_HandleTypeDef hi2c3;
+extern DMA_HandleTypeDef hdma_i2c3_rx;
+
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
@@ -245,5 +248,29 @@ void LTDC_ER_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+* @brief This function handles DMA1 stream2 global interrupt - I2C3 RX.
+*/
+void DMA1_Stream2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_i2c3_rx);
+}
+
+/**
+* @brief This function handles I2C3 event interrupt.
+*/
+void I2C3_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hi2c3);
+}
+
+/**
+* @brief This function handles I2C3 error interrupt.
+*/
+void I2C3_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hi2c3);
+}
+
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/